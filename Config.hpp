@@ -26,6 +26,38 @@
  */
 #define RPT_RUNTIME_PLATFORM @RPT_TARGET_PLATFORM@ // Necessary for conditional includes
 
+/**
+ * @brief `1` if Linux io_uring headers were found for build target, so `RpT::Network::IoUringBackend` is available,
+ * `0` otherwise
+ */
+#define RPT_IO_URING_AVAILABLE @RPT_IO_URING_AVAILABLE@
+
+/// Trace logging level RPT_MIN_LOG_LEVEL value
+#define RPT_LOG_LEVEL_TRACE 0
+/// Debug logging level RPT_MIN_LOG_LEVEL value
+#define RPT_LOG_LEVEL_DEBUG 1
+/// Info logging level RPT_MIN_LOG_LEVEL value
+#define RPT_LOG_LEVEL_INFO 2
+/// Warn logging level RPT_MIN_LOG_LEVEL value
+#define RPT_LOG_LEVEL_WARN 3
+/// Error logging level RPT_MIN_LOG_LEVEL value
+#define RPT_LOG_LEVEL_ERR 4
+/// Fatal logging level RPT_MIN_LOG_LEVEL value
+#define RPT_LOG_LEVEL_FATAL 5
+
+/**
+ * @brief Lowest logging level compiled in, configured with CMake cache variable of the same name
+ *
+ * Messages with a lower level are never logged, and `RPT_LOG_TRACE`/`RPT_LOG_DEBUG` calls below it expand to nothing.
+ */
+#define RPT_MIN_LOG_LEVEL @RPT_MIN_LOG_LEVEL_VALUE@
+
+/**
+ * @brief `1` if built with CMake option `RPT_ALLOCATION_PROFILING`, so global `operator new` counts heap allocations
+ * for each `RpT::Utils::AllocationSubsystem`, `0` otherwise
+ */
+#define RPT_ALLOCATION_PROFILING @RPT_ALLOCATION_PROFILING_VALUE@
+
 
 /**
  * @brief %Config constants
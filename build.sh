@@ -11,6 +11,7 @@ help=
 local=
 mingw=
 debug_features=
+pgo=
 
 ## Iterate args looking for :
 # --clear : Total remove of build/ directory
@@ -18,6 +19,7 @@ debug_features=
 # --local : Install path set to dist/install
 # --mingw : Enable "MinGW Makefiles" generator and $MSYSTEM_PREFIX system install path
 # --debug-features : Enable CMake targets for unit testing and doc generation, even if build type is Release
+# --pgo : Build instrumented binaries, train them with pgo/train.sh then rebuild them with profiles and LTO
 for arg in "$@"; do
   if [ "$arg" ]; then
     if [ "$arg" == "--clear" ]; then
@@ -30,6 +32,8 @@ for arg in "$@"; do
       mingw=1
     elif [ "$arg" == "--debug-features" ]; then
       debug_features=1
+    elif [ "$arg" == "--pgo" ]; then
+      pgo=1
     else
       echo -e "${BRIGHT_RED}Unknown argument \"$arg\".${RESET}"
       exit 1
@@ -57,6 +61,9 @@ if [ "$help" ]; then
   echo "                       prefix path to \$MSYSTEM_PREFIX. Required on MinGW."
   echo "    --debug-features : Enable CMake targets for unit testing and doc generation,"
   echo "                       even if this command use Release build."
+  echo "    --pgo            : Build instrumented binaries, train them with bundled"
+  echo "                       workload, then rebuild them with profile-guided and"
+  echo "                       link-time optimizations."
   echo
 
   exit 0
@@ -104,6 +111,14 @@ fi
 ar_exec="$(which "$AR")"
 ranlib_exec="$(which "$RANLIB")"
 
+# Profiles are reset before each training, so they always match current sources
+if [ "$pgo" ]; then
+  rm -r -f build/pgo-profiles
+  pgo_option="-DRPT_PGO=GENERATE -DRPT_LTO=ON"
+else
+  pgo_option="-DRPT_PGO=OFF -DRPT_LTO=OFF"
+fi
+
 
 # Will be set to 1 after whole script && operators execution
 # So if error occurs during script, && operators chain will be stopped, and $success will not be assigned
@@ -112,11 +127,21 @@ success=
 mkdir -p build && \
 cd build && \
 cmake --log-level=$log_level -DCMAKE_BUILD_TYPE=Release -DCMAKE_SYSTEM_PREFIX_PATH="../dist/install" $install_prefix \
-  -DCMAKE_AR="$ar_exec" -DCMAKE_RANLIB="$ranlib_exec" -G"$generator" $debug_features_option .. && \
+  -DCMAKE_AR="$ar_exec" -DCMAKE_RANLIB="$ranlib_exec" -G"$generator" $debug_features_option $pgo_option .. && \
 cmake --build . -- "-j$(nproc)" && \
 cd .. && \
 success=1
 
+# Instrumented binaries are trained, then rebuilt inside same directory so profiles match object files
+if [ "$pgo" ] && [ $success ]; then
+  success=
+
+  pgo/train.sh build && \
+  cmake -DRPT_PGO=USE build && \
+  cmake --build build -- "-j$(nproc)" && \
+  success=1
+fi
+
 # If error occurred, exits with 2 (runtime error) and print error message
 if [ ! $success ]; then
   echo -e "${BRIGHT_RED}Error occurred during build script, build might be incomplete.${RESET}"
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <Minigames-Services/Acores.hpp>
+#include <Minigames-Services/Bermudes.hpp>
+#include <Minigames-Services/Canaries.hpp>
+#include <Minigames-Services/MatchLog.hpp>
+#include <Minigames-Services/MatchReplay.hpp>
+#include <RpT-Config/Config.hpp>
+#include <RpT-Utils/CommandLineOptionsParser.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+
+constexpr int SUCCESS { 0 };
+constexpr int INVALID_ARGS { 1 };
+constexpr int RUNTIME_ERROR { 2 };
+constexpr int DIVERGENCE_FOUND { 3 };
+
+
+/// Constructs a new game for minigame logged matches were played with
+using GameFactory = std::unique_ptr<MinigamesServices::BoardGame> (*)();
+
+
+/// Divergence found for a logged match, with index of that match inside log
+struct DivergentMatch {
+    std::size_t match;
+    MinigamesServices::ReplayDivergence divergence;
+};
+
+/// Replay results for a contiguous shard of logged matches, only accessed by thread replaying that shard
+struct ShardReplay {
+    std::uint64_t replayedActions { 0 };
+    std::vector<DivergentMatch> divergentMatches;
+};
+
+
+/**
+ * @brief Parses RpT Minigame abbreviation, same as server `game` option, and retrieves factory for its games
+ *
+ * @param rpt_minigame Initial letter of minigame
+ *
+ * @returns Factory for selected minigame
+ *
+ * @throws RpT::Utils::OptionsError if abbreviation isn't 'a', 'b' or 'c'
+ */
+GameFactory parseMinigame(const std::string_view rpt_minigame) {
+    if (rpt_minigame == "a") {
+        return []() -> std::unique_ptr<MinigamesServices::BoardGame> {
+            return std::make_unique<MinigamesServices::Acores>();
+        };
+    } else if (rpt_minigame == "b") {
+        return []() -> std::unique_ptr<MinigamesServices::BoardGame> {
+            return std::make_unique<MinigamesServices::Bermudes>();
+        };
+    } else if (rpt_minigame == "c") {
+        return []() -> std::unique_ptr<MinigamesServices::BoardGame> {
+            return std::make_unique<MinigamesServices::Canaries>();
+        };
+    } else {
+        throw RpT::Utils::OptionsError { "game argument must be a, b or c" };
+    }
+}
+
+/**
+ * @brief Replays given shard of logged matches, each one into a new game
+ *
+ * @param matches Every logged match
+ * @param begin Index for first match of shard
+ * @param end Index following last match of shard
+ * @param new_game Factory for minigame matches were played with
+ * @param results Results for that shard
+ */
+void replayShard(const std::vector<MinigamesServices::LoggedMatch>& matches, const std::size_t begin,
+                 const std::size_t end, const GameFactory new_game, ShardReplay& results) {
+
+    for (std::size_t i { begin }; i < end; i++) {
+        const std::unique_ptr<MinigamesServices::BoardGame> game { new_game() };
+        const std::optional<MinigamesServices::ReplayDivergence> divergence {
+            MinigamesServices::replayMatch(*game, matches[i])
+        };
+
+        results.replayedActions += matches[i].actions.size();
+        if (divergence.has_value())
+            results.divergentMatches.push_back({ i, *divergence });
+    }
+}
+
+int main(const int argc, const char** argv) {
+    RpT::Utils::LoggingContext audit_logging;
+    RpT::Utils::LoggerView logger { "Main", audit_logging };
+
+    try {
+        // Read and parse command line options
+        const RpT::Utils::CommandLineOptionsParser cmd_line_options { argc, argv, { "game", "match-log", "threads" } };
+
+        logger.info("Running minigames audit {} on {}.", RpT::Config::VERSION, RpT::Config::runtimePlatformName());
+
+        // Log doesn't store minigame, as a server only runs one of them
+        const GameFactory new_game { parseMinigame(cmd_line_options.get("game")) };
+        const std::string log_path { cmd_line_options.get("match-log") };
+
+        // Defaults to every core, hardware concurrency might be unknown
+        std::size_t threads_count { std::max(std::thread::hardware_concurrency(), 1u) };
+        if (cmd_line_options.has("threads")) {
+            // String copy must be created anyway to use stoull function
+            const std::string threads_argument { cmd_line_options.get("threads") };
+            threads_count = std::stoull(threads_argument);
+
+            if (threads_count == 0)
+                throw RpT::Utils::OptionsError { "threads argument must be a positive number" };
+        }
+
+        // Matches are decoded once, so replay threads only run rules engines
+        std::vector<MinigamesServices::LoggedMatch> matches;
+        {
+            MinigamesServices::MatchLogReader reader { log_path };
+            MinigamesServices::LoggedMatch match;
+
+            while (reader.next(match))
+                matches.push_back(match);
+        }
+
+        logger.info("Replaying {} matches from {} with {} threads.", matches.size(), log_path, threads_count);
+
+        // Contiguous shards of same size, each thread accessing only its own results
+        std::vector<ShardReplay> shards { threads_count };
+        std::vector<std::thread> replay_threads;
+        replay_threads.reserve(threads_count);
+
+        const auto replay_begin { std::chrono::steady_clock::now() };
+
+        for (std::size_t i { 0 }; i < threads_count; i++) {
+            const std::size_t shard_begin { matches.size() * i / threads_count };
+            const std::size_t shard_end { matches.size() * (i + 1) / threads_count };
+
+            replay_threads.emplace_back(
+                    replayShard, std::cref(matches), shard_begin, shard_end, new_game, std::ref(shards[i]));
+        }
+
+        for (std::thread& replay_thread : replay_threads)
+            replay_thread.join();
+
+        const std::chrono::duration<double> replay_elapsed { std::chrono::steady_clock::now() - replay_begin };
+
+        std::uint64_t replayed_actions { 0 };
+        std::size_t divergent_matches { 0 };
+        for (const ShardReplay& shard : shards) { // Shards are ordered, so divergences are reported in log order
+            replayed_actions += shard.replayedActions;
+            divergent_matches += shard.divergentMatches.size();
+
+            for (const DivergentMatch& divergent_match : shard.divergentMatches) {
+                const MinigamesServices::LoggedMatch& match { matches[divergent_match.match] };
+
+                logger.error("Match #{} between {} and {} started at {} diverged at action {}: {}",
+                             divergent_match.match, match.whiteActor, match.blackActor, match.startedAt,
+                             divergent_match.divergence.action, divergent_match.divergence.reason);
+            }
+        }
+
+        const double elapsed_seconds { replay_elapsed.count() };
+        logger.info("Replayed {} matches and {} actions in {:.3f} s: {:.0f} matches/s, {:.0f} actions/s.",
+                    matches.size(), replayed_actions, elapsed_seconds, matches.size() / elapsed_seconds,
+                    replayed_actions / elapsed_seconds);
+
+        if (divergent_matches != 0) {
+            logger.error("{} matches diverged from logged results.", divergent_matches);
+
+            return DIVERGENCE_FOUND;
+        }
+
+        logger.info("Every match replayed as logged.");
+
+        return SUCCESS;
+    } catch (const RpT::Utils::OptionsError& err) {
+        logger.fatal("Command line error: {}", err.what());
+
+        return INVALID_ARGS;
+    } catch (const std::exception& err) {
+        logger.fatal("Runtime error: {}", err.what());
+
+        return RUNTIME_ERROR;
+    }
+}
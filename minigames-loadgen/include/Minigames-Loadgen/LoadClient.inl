@@ -0,0 +1,441 @@
+#ifndef RPT_MINIGAMES_SERVER_LOADCLIENT_INL
+#define RPT_MINIGAMES_SERVER_LOADCLIENT_INL
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <Minigames-Loadgen/LoadScenario.hpp>
+#include <Minigames-Loadgen/LoadStats.hpp>
+#include <RpT-Core/ServiceEventRequestProtocol.hpp>
+#include <RpT-Network/NetworkBackend.hpp>
+
+/**
+ * @file LoadClient.inl
+ */
+
+
+namespace MinigamesLoadgen {
+
+
+/**
+ * @brief Settings shared by every load client
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct ClientSettings {
+    /// Server host name, used for Websocket handshake and TLS SNI
+    std::string host;
+    /// Resolved server endpoints
+    boost::asio::ip::tcp::resolver::results_type endpoints;
+    /// Time at which clients stop playing and disconnect
+    std::chrono::steady_clock::time_point end;
+    /// Delay between two checkouts for clients which couldn't register
+    std::chrono::milliseconds checkoutInterval;
+};
+
+
+/**
+ * @brief Simulated player connected to server, measuring round-trip for each message expecting a response
+ *
+ * Client checks out server, then performs handshake if there is an available slot. Once registered, it plays
+ * scenario in a loop, sending next Service Request once previous one has been answered and step delay has elapsed.
+ * If server is full, client keeps checking out server instead. When settings end is reached, client logs out or closes
+ * connection.
+ *
+ * Every handler must run on the same thread as stats aren't synchronized.
+ *
+ * @tparam StreamT Underlying Websocket stream, `boost::beast::tcp_stream` or
+ * `boost::beast::ssl_stream<boost::beast::tcp_stream>`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<typename StreamT>
+class LoadClient : public std::enable_shared_from_this<LoadClient<StreamT>> {
+private:
+    using Clock = std::chrono::steady_clock;
+    using WebsocketStream = boost::beast::websocket::stream<StreamT>;
+    using RptlProtocol = RpT::Network::NetworkBackend;
+    using SerProtocol = RpT::Core::ServiceEventRequestProtocol;
+
+    /// TLS handshake is done only if underlying stream is secure
+    static constexpr bool SECURE { std::is_same_v<StreamT, boost::beast::ssl_stream<boost::beast::tcp_stream>> };
+
+    /// Maximum time for connection to be established, including TLS and Websocket handshakes
+    static constexpr std::chrono::seconds CONNECTION_TIMEOUT { 10 };
+
+    /// RPTL session progress
+    enum struct State {
+        Connecting, CheckingOut, LoggingIn, Playing, Observing, LoggingOut, Closed
+    };
+
+    const ClientSettings& settings_;
+    const LoadScenario& scenario_;
+    LoadStats& stats_;
+    const std::uint64_t uid_;
+    WebsocketStream stream_;
+    boost::asio::steady_timer timer_;
+    boost::beast::flat_buffer read_buffer_;
+    std::queue<std::string> outgoing_messages_;
+    bool writing_;
+    State state_;
+    std::size_t next_step_;
+    std::uint64_t next_ruid_;
+    /// Time at which message waiting for a response was sent
+    Clock::time_point sent_time_;
+
+    /// Retrieves shared ownership for this client, so it is kept alive by pending asynchronous operation handler
+    std::shared_ptr<LoadClient> self() {
+        return this->shared_from_this();
+    }
+
+    /// Stops any activity for this client, counting given error if any
+    void fail(const std::string& error_message) {
+        stats_.recordError(error_message);
+
+        state_ = State::Closed;
+        timer_.cancel();
+    }
+
+    /// Queues RPTL message, sent after every previously queued message
+    void send(std::string rptl_message) {
+        outgoing_messages_.push(std::move(rptl_message));
+
+        if (!writing_) // Beast doesn't allow concurrent writes on same stream
+            writeNext();
+    }
+
+    /// Sends oldest queued message, then next ones until queue is empty
+    void writeNext() {
+        writing_ = true;
+
+        stream_.async_write(boost::asio::buffer(outgoing_messages_.front()),
+                            [self { self() }](const boost::system::error_code& err, std::size_t) {
+            self->outgoing_messages_.pop();
+
+            if (err) {
+                if (self->state_ != State::Closed)
+                    self->fail("Write: " + err.message());
+
+                return;
+            }
+
+            if (self->outgoing_messages_.empty())
+                self->writing_ = false;
+            else
+                self->writeNext();
+        });
+    }
+
+    /// Sends message expecting a response, saving time so round-trip can be measured
+    void sendRequest(std::string rptl_message) {
+        sent_time_ = Clock::now();
+        send(std::move(rptl_message));
+    }
+
+    /// Calls action once delay has elapsed, or finishes session immediately if it would be after settings end
+    void afterDelay(const std::chrono::milliseconds delay, std::function<void()> action) {
+        if (state_ == State::Closed) // Message might be received while Websocket is closing
+            return;
+
+        if (Clock::now() + delay >= settings_.end) {
+            finish();
+            return;
+        }
+
+        timer_.expires_after(delay);
+        timer_.async_wait([self { self() }, action { std::move(action) }](const boost::system::error_code& err) {
+            if (err || self->state_ == State::Closed) // Cancelled because client stopped
+                return;
+
+            action();
+        });
+    }
+
+    /// Logs out if registered, otherwise closes Websocket
+    void finish() {
+        if (state_ == State::Playing) {
+            state_ = State::LoggingOut;
+            send(std::string { RptlProtocol::LOGOUT_COMMAND });
+        } else {
+            state_ = State::Closed;
+            stream_.async_close(boost::beast::websocket::close_code::normal,
+                                [self { self() }](const boost::system::error_code&) {});
+        }
+    }
+
+    /// Checks out server, expecting `AVAILABILITY` response
+    void checkout() {
+        sendRequest(std::string { RptlProtocol::CHECKOUT_COMMAND });
+    }
+
+    /// Sends next scenario step once its delay has elapsed
+    void scheduleNextStep() {
+        const ScenarioStep& step { scenario_.steps()[next_step_] };
+
+        afterDelay(step.delay, [this, &step]() {
+            std::string service_request { RptlProtocol::SERVICE_COMMAND };
+            service_request += ' ';
+            service_request += SerProtocol::REQUEST_PREFIX;
+            service_request += ' ' + std::to_string(next_ruid_) + ' ' + step.service + ' ' + step.command;
+
+            sendRequest(std::move(service_request));
+        });
+    }
+
+    /// Handles `AVAILABILITY <actors_count> <max_actors_number>`
+    void handleAvailability(const std::string_view arguments) {
+        stats_.recordRoundTrip(std::string { RptlProtocol::CHECKOUT_COMMAND }, Clock::now() - sent_time_);
+
+        const std::size_t count_end { arguments.find(' ') };
+        if (count_end == std::string_view::npos) {
+            fail("Ill-formed AVAILABILITY message");
+            return;
+        }
+
+        std::uint64_t actors_count;
+        std::uint64_t max_actors;
+
+        const char* const count_begin { arguments.data() };
+        const auto count_parsing { std::from_chars(count_begin, count_begin + count_end, actors_count) };
+        const auto max_parsing {
+            std::from_chars(count_begin + count_end + 1, count_begin + arguments.size(), max_actors)
+        };
+
+        if (count_parsing.ec != std::errc {} || max_parsing.ec != std::errc {}) {
+            fail("Ill-formed AVAILABILITY message");
+            return;
+        }
+
+        if (state_ == State::CheckingOut && actors_count < max_actors) { // Slot available, tries to take it
+            state_ = State::LoggingIn;
+
+            sendRequest(std::string { RptlProtocol::HANDSHAKE_COMMAND } + ' ' + std::to_string(uid_) + " Load"
+                        + std::to_string(uid_));
+        } else { // Server is full, keeps checking it out
+            if (state_ == State::CheckingOut) {
+                state_ = State::Observing;
+                stats_.observers++;
+            }
+
+            afterDelay(settings_.checkoutInterval, [this]() { checkout(); });
+        }
+    }
+
+    /// Handles `SERVICE <SRR_or_SE>`
+    void handleService(const std::string_view ser_command) {
+        const std::size_t prefix_end { ser_command.find(' ') };
+        const std::string_view prefix { ser_command.substr(0, prefix_end) };
+
+        if (prefix == SerProtocol::EVENT_PREFIX) {
+            stats_.events++;
+            return;
+        }
+
+        if (prefix != SerProtocol::RESPONSE_PREFIX || prefix_end == std::string_view::npos) {
+            fail("Unknown SER command " + std::string { prefix });
+            return;
+        }
+
+        // RESPONSE <RUID> OK, or RESPONSE <RUID> KO <ERR_MSG>
+        const std::string_view response { ser_command.substr(prefix_end + 1) };
+        const std::size_t ruid_end { std::min(response.find(' '), response.size()) };
+
+        std::uint64_t ruid;
+        const auto ruid_parsing { std::from_chars(response.data(), response.data() + ruid_end, ruid) };
+
+        if (ruid_parsing.ec != std::errc {} || state_ != State::Playing || ruid != next_ruid_) {
+            fail("Unexpected SRR " + std::string { response.substr(0, ruid_end) });
+            return;
+        }
+
+        const bool success { response.substr(ruid_end) == " OK" };
+        stats_.recordRoundTrip(scenario_.steps()[next_step_].messageKind(), Clock::now() - sent_time_, success);
+
+        // Response received, next step can be played
+        next_ruid_++;
+        next_step_ = (next_step_ + 1) % scenario_.steps().size();
+
+        scheduleNextStep();
+    }
+
+    /// Handles `INTERRUPT [ERR_MSG]`, after which server closes connection
+    void handleInterrupt(const std::string_view reason) {
+        if (state_ == State::LoggingIn) { // Another client took the last available slot
+            stats_.refusedHandshakes++;
+        } else if (state_ == State::LoggingOut) {
+            stats_.logouts++;
+        } else {
+            fail("Interrupted" + (reason.empty() ? std::string {} : ": " + std::string { reason }));
+            return;
+        }
+
+        state_ = State::Closed;
+        timer_.cancel();
+    }
+
+    /// Dispatches received RPTL message depending on its command
+    void handleMessage(const std::string_view rptl_message) {
+        const std::size_t command_end { std::min(rptl_message.find(' '), rptl_message.size()) };
+        const std::string_view command { rptl_message.substr(0, command_end) };
+        const std::string_view arguments { rptl_message.substr(std::min(command_end + 1, rptl_message.size())) };
+
+        if (command == RptlProtocol::AVAILABILITY_COMMAND) {
+            handleAvailability(arguments);
+        } else if (command == RptlProtocol::REGISTRATION_COMMAND) {
+            stats_.recordRoundTrip(std::string { RptlProtocol::HANDSHAKE_COMMAND }, Clock::now() - sent_time_);
+            stats_.registrations++;
+
+            state_ = State::Playing;
+            scheduleNextStep();
+        } else if (command == RptlProtocol::SERVICE_COMMAND) {
+            handleService(arguments);
+        } else if (command == RptlProtocol::LOGGED_IN_COMMAND || command == RptlProtocol::LOGGED_OUT_COMMAND) {
+            stats_.events++;
+        } else if (command == RptlProtocol::INTERRUPT_COMMAND) {
+            handleInterrupt(arguments);
+        } else {
+            fail("Unknown RPTL command " + std::string { command });
+        }
+    }
+
+    /// Reads next RPTL message, until connection is closed
+    void listen() {
+        read_buffer_.clear();
+
+        stream_.async_read(read_buffer_, [self { self() }](const boost::system::error_code& err, std::size_t) {
+            if (err) {
+                if (err == boost::beast::websocket::error::closed && self->state_ == State::LoggingIn) {
+                    // Unregistered client is closed without interrupt if another client took the last slot
+                    self->stats_.refusedHandshakes++;
+                } else if (err == boost::beast::websocket::error::closed && self->state_ == State::LoggingOut) {
+                    // Server might close connection before interrupt message is sent
+                    self->stats_.logouts++;
+                } else if (err == boost::beast::websocket::error::closed && self->state_ != State::Closed) {
+                    const std::string close_reason { self->stream_.reason().reason.c_str() };
+
+                    self->stats_.recordError("Closed by server" + (close_reason.empty() ? "" : ": " + close_reason));
+                } else if (self->state_ != State::Closed && err != boost::asio::error::operation_aborted) {
+                    // Server closes connection on its side after interrupt, which is expected
+                    self->stats_.recordError("Read: " + err.message());
+                }
+
+                self->state_ = State::Closed;
+                self->timer_.cancel();
+
+                return;
+            }
+
+            const boost::asio::const_buffer received_data { self->read_buffer_.cdata() };
+            self->handleMessage({ static_cast<const char*>(received_data.data()), received_data.size() });
+
+            self->listen();
+        });
+    }
+
+    /// Opens Websocket session once underlying stream is connected
+    void websocketHandshake() {
+        stream_.async_handshake(settings_.host, "/", [self { self() }](const boost::system::error_code& err) {
+            if (err) {
+                self->fail("Websocket handshake: " + err.message());
+                return;
+            }
+
+            // Connection established, Websocket stream manages its own timeouts from now on
+            boost::beast::get_lowest_layer(self->stream_).expires_never();
+            self->stream_.set_option(
+                    boost::beast::websocket::stream_base::timeout::suggested(boost::beast::role_type::client));
+
+            self->stats_.connections++;
+            self->stats_.recordRoundTrip("Connect", Clock::now() - self->sent_time_);
+
+            self->state_ = State::CheckingOut;
+            self->checkout();
+            self->listen();
+        });
+    }
+
+    /// Connects underlying stream then performs TLS handshake if required
+    void connect() {
+        sent_time_ = Clock::now(); // Connection time is measured from TCP connect to Websocket handshake
+        boost::beast::get_lowest_layer(stream_).expires_after(CONNECTION_TIMEOUT);
+
+        boost::beast::get_lowest_layer(stream_).async_connect(settings_.endpoints, [self { self() }](
+                const boost::system::error_code& err, const boost::asio::ip::tcp::endpoint&) {
+
+            if (err) {
+                self->fail("Connect: " + err.message());
+                return;
+            }
+
+            if constexpr (SECURE) {
+                auto& tls_stream { self->stream_.next_layer() };
+                // Server name indication for servers hosting many certificates
+                SSL_set_tlsext_host_name(tls_stream.native_handle(), self->settings_.host.c_str());
+
+                tls_stream.async_handshake(boost::asio::ssl::stream_base::client, [self](
+                        const boost::system::error_code& tls_err) {
+
+                    if (tls_err) {
+                        self->fail("TLS handshake: " + tls_err.message());
+                        return;
+                    }
+
+                    self->websocketHandshake();
+                });
+            } else {
+                self->websocketHandshake();
+            }
+        });
+    }
+
+public:
+    /**
+     * @brief Constructs client which isn't connected yet
+     *
+     * @tparam StreamArgs Types for Websocket stream constructor arguments
+     *
+     * @param settings Settings shared by every client, must outlive client
+     * @param scenario Scenario played once registered, must outlive client
+     * @param stats Stats shared by every client running on same thread, must outlive client
+     * @param uid Actor UID used for handshake, so it must be unique among clients
+     * @param stream_args Websocket stream constructor arguments, IO context and TLS context if any
+     */
+    template<typename... StreamArgs>
+    LoadClient(const ClientSettings& settings, const LoadScenario& scenario, LoadStats& stats, const std::uint64_t uid,
+               boost::asio::io_context& io_context, StreamArgs&&... stream_args)
+    : settings_ { settings }, scenario_ { scenario }, stats_ { stats }, uid_ { uid },
+    stream_ { io_context, std::forward<StreamArgs>(stream_args)... }, timer_ { io_context }, writing_ { false },
+    state_ { State::Connecting }, next_step_ { 0 }, next_ruid_ { 0 } {}
+
+    /**
+     * @brief Connects client after given delay, used to ramp up connections
+     *
+     * @param start_delay Waited time before connecting
+     */
+    void start(const Clock::duration start_delay) {
+        timer_.expires_after(start_delay);
+        timer_.async_wait([self { self() }](const boost::system::error_code& err) {
+            if (!err)
+                self->connect();
+        });
+    }
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_LOADCLIENT_INL
@@ -0,0 +1,108 @@
+#ifndef RPT_MINIGAMES_SERVER_LOADSCENARIO_HPP
+#define RPT_MINIGAMES_SERVER_LOADSCENARIO_HPP
+
+#include <chrono>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file LoadScenario.hpp
+ */
+
+
+namespace MinigamesLoadgen {
+
+
+/**
+ * @brief Thrown by `LoadScenario::parse()` if a scenario line is ill-formed
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class BadScenarioLine : public std::runtime_error {
+public:
+    /**
+     * @brief Constructs exception with error message for given line
+     *
+     * @param line_number Ill-formed line number, beginning at 1
+     * @param reason Why line is ill-formed
+     */
+    BadScenarioLine(const std::size_t line_number, const std::string& reason)
+    : std::runtime_error { "Scenario line " + std::to_string(line_number) + ": " + reason } {}
+};
+
+
+/**
+ * @brief Service Request sent by a registered load client, once previous request was answered and delay elapsed
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct ScenarioStep {
+    /// Waited time before request is sent
+    std::chrono::milliseconds delay;
+    /// Service handling request
+    std::string service;
+    /// SR command data sent to service
+    std::string command;
+
+    /**
+     * @brief Retrieves kind of message this step sends, used to group round-trip latencies
+     *
+     * @returns Service name with first command word, like `"Lobby READY"`
+     */
+    std::string messageKind() const;
+};
+
+
+/**
+ * @brief Service Requests played in a loop by each registered load client
+ *
+ * Scenario text format is one step for each line: `<delay_ms> <service> <command>`. Empty lines and lines beginning
+ * with `#` are ignored.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LoadScenario {
+private:
+    std::vector<ScenarioStep> steps_;
+
+public:
+    /**
+     * @brief Retrieves scenario played if none is given, readying up in Lobby, chatting then playing minigame
+     *
+     * @returns Default scenario
+     */
+    static LoadScenario defaultScenario();
+
+    /**
+     * @brief Parses scenario from given text input
+     *
+     * @param input Input to read scenario lines from
+     *
+     * @returns Parsed scenario
+     *
+     * @throws BadScenarioLine if any line is ill-formed, or if there isn't any step
+     */
+    static LoadScenario parse(std::istream& input);
+
+    /**
+     * @brief Constructs scenario playing given steps
+     *
+     * @param steps Steps to play, must not be empty
+     */
+    explicit LoadScenario(std::vector<ScenarioStep> steps);
+
+    /**
+     * @brief Retrieves scenario steps in playing order
+     *
+     * @returns Every step
+     */
+    const std::vector<ScenarioStep>& steps() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_LOADSCENARIO_HPP
@@ -0,0 +1,96 @@
+#ifndef RPT_MINIGAMES_SERVER_LOADSTATS_HPP
+#define RPT_MINIGAMES_SERVER_LOADSTATS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+/**
+ * @file LoadStats.hpp
+ */
+
+
+namespace MinigamesLoadgen {
+
+
+/**
+ * @brief Round-trip latencies and outcomes for one kind of client message
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct MessageStats {
+    /// Round-trip latencies, in microseconds
+    RpT::Utils::LatencyHistogram latency;
+    /// Messages answered successfully
+    std::uint64_t ok { 0 };
+    /// Messages answered with an error, like a KO Service Request Response
+    std::uint64_t ko { 0 };
+};
+
+
+/**
+ * @brief Results collected by load clients running on a single thread, merged once every thread has stopped
+ *
+ * Clients never log anything as logging isn't thread-safe, they count errors by message instead.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct LoadStats {
+    /// Connections which completed Websocket handshake
+    std::uint64_t connections { 0 };
+    /// Clients which completed RPTL handshake
+    std::uint64_t registrations { 0 };
+    /// Clients which only checked out server because it was full
+    std::uint64_t observers { 0 };
+    /// Clients interrupted during RPTL handshake, usually because another client took the last slot
+    std::uint64_t refusedHandshakes { 0 };
+    /// Clients which logged out and were disconnected cleanly
+    std::uint64_t logouts { 0 };
+    /// Service Event and broadcast RPTL messages received
+    std::uint64_t events { 0 };
+    /// Statistics for each kind of message expecting a response
+    std::map<std::string, MessageStats> messages;
+    /// Occurrences of each connection or protocol error
+    std::map<std::string, std::uint64_t> errors;
+
+    /**
+     * @brief Records a round-trip for given kind of message
+     *
+     * @param message_kind Kind of message, like `"LOGIN"` or `"Lobby READY"`
+     * @param round_trip Elapsed time between message sending and its response receiving
+     * @param success `false` if message was answered with an error
+     */
+    void recordRoundTrip(const std::string& message_kind, std::chrono::steady_clock::duration round_trip,
+                         bool success = true);
+
+    /**
+     * @brief Counts one occurrence of given error
+     *
+     * @param error_message Error description, occurrences with same description are counted together
+     */
+    void recordError(const std::string& error_message);
+
+    /**
+     * @brief Adds every result from given stats to this one
+     *
+     * @param other Stats to merge, left unchanged
+     */
+    void merge(const LoadStats& other);
+
+    /**
+     * @brief Prints human-readable report for collected results
+     *
+     * @param output Stream to print report to
+     * @param elapsed Load test duration, used to compute messages rate
+     */
+    void report(std::ostream& output, std::chrono::steady_clock::duration elapsed) const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_LOADSTATS_HPP
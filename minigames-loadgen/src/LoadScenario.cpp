@@ -0,0 +1,73 @@
+#include <Minigames-Loadgen/LoadScenario.hpp>
+
+#include <cassert>
+#include <charconv>
+
+
+namespace MinigamesLoadgen {
+
+
+std::string ScenarioStep::messageKind() const {
+    return service + ' ' + command.substr(0, command.find(' '));
+}
+
+
+LoadScenario LoadScenario::defaultScenario() {
+    return LoadScenario { {
+        { std::chrono::milliseconds { 500 }, "Lobby", "READY" },
+        { std::chrono::milliseconds { 500 }, "Chat", "HELLO from load client" },
+        { std::chrono::milliseconds { 500 }, "Minigame", "MOVE 1 1 2 2" },
+        { std::chrono::milliseconds { 500 }, "Minigame", "END" },
+        { std::chrono::milliseconds { 500 }, "Lobby", "READY" } // Ready state toggled back, so next loop is the same
+    } };
+}
+
+LoadScenario LoadScenario::parse(std::istream& input) {
+    std::vector<ScenarioStep> steps;
+
+    std::string line;
+    std::size_t line_number { 0 };
+    while (std::getline(input, line)) {
+        line_number++;
+
+        if (line.empty() || line.front() == '#') // Ignored lines
+            continue;
+
+        const std::size_t delay_end { line.find(' ') };
+        const std::size_t service_end { delay_end == std::string::npos ? delay_end : line.find(' ', delay_end + 1) };
+
+        if (service_end == std::string::npos)
+            throw BadScenarioLine { line_number, "Expected <delay_ms> <service> <command>" };
+
+        std::chrono::milliseconds::rep delay;
+        const char* const delay_begin { line.data() };
+        const auto [parsed_end, err] { std::from_chars(delay_begin, delay_begin + delay_end, delay) };
+
+        if (err != std::errc {} || parsed_end != delay_begin + delay_end || delay < 0)
+            throw BadScenarioLine { line_number, "Delay must be a positive number of milliseconds" };
+
+        std::string service { line.substr(delay_end + 1, service_end - delay_end - 1) };
+        std::string command { line.substr(service_end + 1) };
+
+        if (service.empty() || command.empty())
+            throw BadScenarioLine { line_number, "Service and command must not be empty" };
+
+        steps.push_back({ std::chrono::milliseconds { delay }, std::move(service), std::move(command) });
+    }
+
+    if (steps.empty())
+        throw BadScenarioLine { line_number, "Scenario must contain at least one step" };
+
+    return LoadScenario { std::move(steps) };
+}
+
+LoadScenario::LoadScenario(std::vector<ScenarioStep> steps) : steps_ { std::move(steps) } {
+    assert(!steps_.empty()); // Clients play steps in a loop, there must be at least one
+}
+
+const std::vector<ScenarioStep>& LoadScenario::steps() const {
+    return steps_;
+}
+
+
+}
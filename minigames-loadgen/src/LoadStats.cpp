@@ -0,0 +1,101 @@
+#include <Minigames-Loadgen/LoadStats.hpp>
+
+#include <iomanip>
+
+
+namespace MinigamesLoadgen {
+
+
+/// Percentile printed for each kind of message, with its column header
+struct ReportedPercentile {
+    double percentage;
+    const char* header;
+};
+
+constexpr ReportedPercentile REPORTED_PERCENTILES[] { { 50, "p50" }, { 90, "p90" }, { 99, "p99" }, { 99.9, "p99.9" } };
+
+
+/// Converts latency from histogram microseconds to printed milliseconds
+double toMilliseconds(const double microseconds) {
+    return microseconds / 1000;
+}
+
+
+void LoadStats::recordRoundTrip(const std::string& message_kind, const std::chrono::steady_clock::duration round_trip,
+                                const bool success) {
+
+    MessageStats& message_stats { messages[message_kind] }; // Created at first round-trip for that kind
+
+    message_stats.latency.record(std::chrono::duration_cast<std::chrono::microseconds>(round_trip).count());
+
+    if (success)
+        message_stats.ok++;
+    else
+        message_stats.ko++;
+}
+
+void LoadStats::recordError(const std::string& error_message) {
+    errors[error_message]++;
+}
+
+void LoadStats::merge(const LoadStats& other) {
+    connections += other.connections;
+    registrations += other.registrations;
+    observers += other.observers;
+    refusedHandshakes += other.refusedHandshakes;
+    logouts += other.logouts;
+    events += other.events;
+
+    for (const auto& [message_kind, other_stats] : other.messages) {
+        MessageStats& message_stats { messages[message_kind] };
+
+        message_stats.latency.merge(other_stats.latency);
+        message_stats.ok += other_stats.ok;
+        message_stats.ko += other_stats.ko;
+    }
+
+    for (const auto& [error_message, occurrences] : other.errors)
+        errors[error_message] += occurrences;
+}
+
+void LoadStats::report(std::ostream& output, const std::chrono::steady_clock::duration elapsed) const {
+    const double elapsed_seconds { std::chrono::duration<double> { elapsed }.count() };
+
+    output << "Connections: " << connections << ", registered: " << registrations << ", observers: " << observers
+           << ", refused handshakes: " << refusedHandshakes << ", clean logouts: " << logouts << '\n';
+    output << "Events received: " << events << " in " << std::fixed << std::setprecision(1) << elapsed_seconds
+           << " s\n\n";
+
+    output << std::left << std::setw(24) << "Message" << std::right << std::setw(10) << "Count"
+           << std::setw(10) << "Rate/s" << std::setw(8) << "KO %" << std::setw(10) << "Mean";
+
+    for (const ReportedPercentile& percentile : REPORTED_PERCENTILES)
+        output << std::setw(10) << percentile.header;
+
+    output << std::setw(10) << "Max" << "  (ms)\n";
+
+    for (const auto& [message_kind, message_stats] : messages) {
+        const std::uint64_t count { message_stats.ok + message_stats.ko };
+        const RpT::Utils::LatencyHistogram& latency { message_stats.latency };
+
+        output << std::left << std::setw(24) << message_kind << std::right << std::setw(10) << count
+               << std::setw(10) << std::setprecision(1) << (elapsed_seconds > 0 ? count / elapsed_seconds : 0)
+               << std::setw(8) << std::setprecision(2) << (100.0 * message_stats.ko / count)
+               << std::setw(10) << std::setprecision(3) << toMilliseconds(latency.mean());
+
+        for (const ReportedPercentile& percentile : REPORTED_PERCENTILES)
+            output << std::setw(10) << toMilliseconds(latency.percentile(percentile.percentage));
+
+        output << std::setw(10) << toMilliseconds(latency.max()) << '\n';
+    }
+
+    if (errors.empty())
+        return;
+
+    output << "\nErrors:\n";
+    for (const auto& [error_message, occurrences] : errors)
+        output << std::setw(10) << occurrences << "  " << error_message << '\n';
+}
+
+
+}
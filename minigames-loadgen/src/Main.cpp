@@ -0,0 +1,222 @@
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Minigames-Loadgen/LoadClient.inl>
+#include <Minigames-Loadgen/LoadScenario.hpp>
+#include <Minigames-Loadgen/LoadStats.hpp>
+#include <RpT-Config/Config.hpp>
+#include <RpT-Utils/CommandLineOptionsParser.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+
+constexpr int SUCCESS { 0 };
+constexpr int INVALID_ARGS { 1 };
+constexpr int RUNTIME_ERROR { 2 };
+
+constexpr std::uint16_t DEFAULT_PORT { 35555 };
+
+/// Time given to clients to log out once load test duration is over, before remaining connections are dropped
+constexpr std::chrono::seconds LOGOUT_GRACE_PERIOD { 5 };
+
+
+/**
+ * @brief Parses positive integer option if enabled, or keeps default value
+ *
+ * @param options Parsed command line options
+ * @param option Option name
+ * @param default_value Value if option isn't enabled
+ *
+ * @returns Parsed option value
+ *
+ * @throws RpT::Utils::OptionsError if option value is 0
+ */
+std::uint64_t positiveOption(const RpT::Utils::CommandLineOptionsParser& options, const std::string_view option,
+                             const std::uint64_t default_value) {
+
+    if (!options.has(option))
+        return default_value;
+
+    // String copy must be created anyway to use stoull function
+    const std::string option_argument { options.get(option) };
+    const std::uint64_t parsed_value { std::stoull(option_argument) };
+
+    if (parsed_value == 0)
+        throw RpT::Utils::OptionsError { std::string { option } + " argument must be a positive number" };
+
+    return parsed_value;
+}
+
+/**
+ * @brief Creates load clients using given stream type then runs each thread IO context until every client has
+ * finished, or grace period is over
+ *
+ * @tparam StreamT Websocket underlying stream type
+ * @tparam StreamArgs Types for additional Websocket stream constructor arguments
+ *
+ * @param settings Settings shared by every client
+ * @param scenario Scenario played by registered clients
+ * @param threads_stats Stats for each thread, one IO thread is run for each element
+ * @param clients_count Clients to create, distributed among threads
+ * @param first_uid Actor UID for first client, next clients use consecutive UIDs
+ * @param ramp_up Duration over which clients connections are spread
+ * @param stream_args Additional Websocket stream constructor arguments
+ */
+template<typename StreamT, typename... StreamArgs>
+void runClients(const MinigamesLoadgen::ClientSettings& settings, const MinigamesLoadgen::LoadScenario& scenario,
+                std::vector<MinigamesLoadgen::LoadStats>& threads_stats, const std::size_t clients_count,
+                const std::uint64_t first_uid, const std::chrono::steady_clock::duration ramp_up,
+                StreamArgs&... stream_args) {
+
+    const std::size_t threads_count { threads_stats.size() };
+
+    // Each thread runs its own IO context so stats don't need to be synchronized
+    std::vector<std::unique_ptr<boost::asio::io_context>> io_contexts;
+    io_contexts.reserve(threads_count);
+
+    for (std::size_t i { 0 }; i < threads_count; i++)
+        io_contexts.push_back(std::make_unique<boost::asio::io_context>());
+
+    for (std::size_t i { 0 }; i < clients_count; i++) {
+        const std::size_t thread_index { i % threads_count };
+
+        const auto new_client {
+            std::make_shared<MinigamesLoadgen::LoadClient<StreamT>>(
+                    settings, scenario, threads_stats[thread_index], first_uid + i, *io_contexts[thread_index],
+                    stream_args...)
+        };
+
+        new_client->start(ramp_up * i / clients_count);
+    }
+
+    std::vector<std::thread> io_threads;
+    io_threads.reserve(threads_count);
+
+    for (std::size_t i { 0 }; i < threads_count; i++) {
+        boost::asio::io_context& io_context { *io_contexts[i] };
+
+        // Clients which didn't disconnect in time are dropped, so thread always stops
+        io_threads.emplace_back([&io_context, &settings]() {
+            io_context.run_until(settings.end + LOGOUT_GRACE_PERIOD);
+        });
+    }
+
+    for (std::thread& io_thread : io_threads)
+        io_thread.join();
+}
+
+int main(const int argc, const char** argv) {
+    RpT::Utils::LoggingContext loadgen_logging;
+    RpT::Utils::LoggerView logger { "Main", loadgen_logging };
+
+    try {
+        // Read and parse command line options
+        const RpT::Utils::CommandLineOptionsParser cmd_line_options {
+            argc, argv, { "host", "port", "net-backend", "clients", "duration", "ramp-up", "threads",
+                          "checkout-interval", "first-uid", "scenario" }
+        };
+
+        logger.info("Running minigames load generator {} on {}.", RpT::Config::VERSION,
+                    RpT::Config::runtimePlatformName());
+
+        MinigamesLoadgen::ClientSettings settings;
+        settings.host = cmd_line_options.has("host") ? cmd_line_options.get("host") : "localhost";
+
+        std::uint16_t server_port { DEFAULT_PORT };
+        if (cmd_line_options.has("port")) {
+            // String copy must be created anyway to use stoull function
+            const std::string port_argument { cmd_line_options.get("port") };
+            const std::uint64_t parsed_port { std::stoull(port_argument) };
+
+            if (parsed_port > std::numeric_limits<std::uint16_t>::max())
+                throw RpT::Utils::OptionsError { "port argument must be included inside 0..65535" };
+
+            server_port = parsed_port;
+        }
+
+        // Same backends names as server, defaults to WSS (Safe Websocket)
+        std::string_view selected_network_backend { "wss" };
+        if (cmd_line_options.has("net-backend"))
+            selected_network_backend = cmd_line_options.get("net-backend");
+
+        const std::size_t clients_count { positiveOption(cmd_line_options, "clients", 100) };
+        const std::chrono::seconds duration { positiveOption(cmd_line_options, "duration", 30) };
+        const std::size_t threads_count { positiveOption(cmd_line_options, "threads", 1) };
+        const std::uint64_t first_uid { positiveOption(cmd_line_options, "first-uid", 1) };
+        settings.checkoutInterval = std::chrono::milliseconds {
+            positiveOption(cmd_line_options, "checkout-interval", 1000)
+        };
+
+        std::chrono::seconds ramp_up { 1 };
+        if (cmd_line_options.has("ramp-up")) {
+            // String copy must be created anyway to use stoull function
+            const std::string ramp_up_argument { cmd_line_options.get("ramp-up") };
+
+            ramp_up = std::chrono::seconds { std::stoull(ramp_up_argument) };
+        }
+
+        // Default scenario is played unless a scenario file is given
+        MinigamesLoadgen::LoadScenario scenario { MinigamesLoadgen::LoadScenario::defaultScenario() };
+        if (cmd_line_options.has("scenario")) {
+            const std::string scenario_path { cmd_line_options.get("scenario") };
+            std::ifstream scenario_file { scenario_path };
+
+            if (!scenario_file)
+                throw RpT::Utils::OptionsError { "Given scenario path couldn't be opened" };
+
+            scenario = MinigamesLoadgen::LoadScenario::parse(scenario_file);
+        }
+
+        // Resolved once, so thousands of clients don't query resolver
+        boost::asio::io_context resolver_context;
+        boost::asio::ip::tcp::resolver resolver { resolver_context };
+        settings.endpoints = resolver.resolve(settings.host, std::to_string(server_port));
+
+        logger.info("Connecting {} clients to {}:{} over {} s with {} threads, playing for {} s.", clients_count,
+                    settings.host, server_port, ramp_up.count(), threads_count, duration.count());
+
+        // Clients only access their own thread stats, merged once every thread stopped
+        std::vector<MinigamesLoadgen::LoadStats> threads_stats { threads_count };
+
+        const auto load_begin { std::chrono::steady_clock::now() };
+        settings.end = load_begin + ramp_up + duration;
+
+        if (selected_network_backend == "wss") { // Websockets switched from HTTPS
+            // Load testing is expected to run against self-signed certificates, so peer isn't verified
+            boost::asio::ssl::context tls_context { boost::asio::ssl::context::tls_client };
+            tls_context.set_verify_mode(boost::asio::ssl::verify_none);
+
+            runClients<boost::beast::ssl_stream<boost::beast::tcp_stream>>(
+                    settings, scenario, threads_stats, clients_count, first_uid, ramp_up, tls_context);
+        } else if (selected_network_backend == "unsafe-ws") { // Websockets switched from HTTP
+            runClients<boost::beast::tcp_stream>(
+                    settings, scenario, threads_stats, clients_count, first_uid, ramp_up);
+        } else { // Unknown network backend
+            const std::string backend_copy { selected_network_backend }; // Copy required for string concat
+
+            throw RpT::Utils::OptionsError { "Unknown networking backend " + backend_copy };
+        }
+
+        const auto load_elapsed { std::chrono::steady_clock::now() - load_begin };
+
+        MinigamesLoadgen::LoadStats total_stats;
+        for (const MinigamesLoadgen::LoadStats& thread_stats : threads_stats)
+            total_stats.merge(thread_stats);
+
+        total_stats.report(std::cout, load_elapsed);
+
+        logger.info("Load test done.");
+
+        return SUCCESS;
+    } catch (const RpT::Utils::OptionsError& err) {
+        logger.fatal("Command line error: {}", err.what());
+
+        return INVALID_ARGS;
+    } catch (const std::exception& err) {
+        logger.fatal("Runtime error: {}", err.what());
+
+        return RUNTIME_ERROR;
+    }
+}
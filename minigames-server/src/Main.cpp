@@ -1,5 +1,9 @@
+#include <chrono>
+#include <csignal>
+#include <fstream>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
 #include <boost/filesystem.hpp>
@@ -7,13 +11,23 @@
 #include <Minigames-Services/Bermudes.hpp>
 #include <Minigames-Services/Canaries.hpp>
 #include <Minigames-Services/ChatService.hpp>
-#include <Minigames-Services/LobbyService.hpp>
-#include <Minigames-Services/MinigameService.hpp>
+#include <Minigames-Services/MatchLog.hpp>
+#include <Minigames-Services/MinigameRoom.hpp>
 #include <RpT-Config/Config.hpp>
 #include <RpT-Core/Executor.hpp>
 #include <RpT-Core/InputEvent.hpp>
+#include <RpT-Core/InputRecorder.hpp>
+#include <RpT-Core/InputReplay.hpp>
+#include <RpT-Network/ClusterGateway.hpp>
+#include <RpT-Network/LoopbackBackend.hpp>
+#include <RpT-Network/MetricsEndpoint.hpp>
+#if RPT_IO_URING_AVAILABLE
+#include <RpT-Network/IoUringBackend.hpp>
+#endif
+#include <RpT-Network/RawTcpBackend.hpp>
 #include <RpT-Network/SafeBeastWebsocketBackend.hpp>
 #include <RpT-Network/UnsafeBeastWebsocketBackend.hpp>
+#include <RpT-Utils/AllocationProfiler.hpp>
 #include <RpT-Utils/CommandLineOptionsParser.hpp>
 
 
@@ -23,6 +37,24 @@ constexpr int RUNTIME_ERROR { 2 };
 
 constexpr std::uint16_t DEFAULT_PORT { 35555 };
 
+/// Spans kept by main loop tracer if trace-buffer option isn't given
+constexpr std::size_t DEFAULT_TRACE_BUFFER { 65536 };
+
+/// Main loop busy time ratio from which load is shed, if overload-saturation option isn't given
+constexpr double DEFAULT_OVERLOAD_SATURATION { 0.9 };
+/// Queued input events count from which load is shed, if overload-queue-depth option isn't given
+constexpr std::size_t DEFAULT_OVERLOAD_QUEUE_DEPTH { 1024 };
+
+
+/// Main loop tracer a dump is requested for when SIGUSR1 is received, if tracing is enabled
+RpT::Utils::LoopTracer* signaled_tracer { nullptr };
+
+/// Requests a main loop trace dump, only sets tracer atomic flag so it is async-signal-safe
+extern "C" void requestTraceDump(int) {
+    if (signaled_tracer)
+        signaled_tracer->requestDump();
+}
+
 
 /// Represents a parsed option for one of the 3 available RpT Minigames
 enum struct Minigame {
@@ -85,6 +117,99 @@ constexpr RpT::Utils::LogLevel parseLogLevel(const std::string_view level) {
         throw std::invalid_argument { "Unable to parse level \"" + std::string { level }+ "\"" };
 }
 
+/**
+ * @brief Parses asynchronous logging overflow policy string and converts to enum value.
+ *
+ * @param policy Policy name
+ *
+ * @throws RpT::Utils::OptionsError If policy string cannot be parsed into LogOverflowPolicy value
+ *
+ * @return Corresponding `RpT::Utils::LogOverflowPolicy` enum value
+ */
+RpT::Utils::LogOverflowPolicy parseLogOverflowPolicy(const std::string_view policy) {
+    if (policy == "block")
+        return RpT::Utils::LogOverflowPolicy::BLOCK;
+    else if (policy == "drop")
+        return RpT::Utils::LogOverflowPolicy::DROP;
+    else if (policy == "drop-oldest")
+        return RpT::Utils::LogOverflowPolicy::DROP_OLDEST;
+    else
+        throw RpT::Utils::OptionsError { "Unknown log-overflow policy: " + std::string { policy } };
+}
+
+/**
+ * @brief Parses comma-separated list of CPU cores indices.
+ *
+ * @param cpus Cores list, like `2,3,4`
+ *
+ * @throws RpT::Utils::OptionsError If any core index cannot be parsed
+ *
+ * @return Parsed cores indices, in given order
+ */
+std::vector<std::size_t> parseCpuList(const std::string_view cpus) {
+    std::vector<std::size_t> parsed_cpus;
+
+    std::size_t cpu_begin { 0 };
+    while (cpu_begin <= cpus.size()) {
+        const std::size_t cpu_end { std::min(cpus.find(',', cpu_begin), cpus.size()) };
+        const std::string_view cpu { cpus.substr(cpu_begin, cpu_end - cpu_begin) };
+
+        if (cpu.empty() || cpu.find_first_not_of("0123456789") != std::string_view::npos)
+            throw RpT::Utils::OptionsError { "Invalid CPU core index " + std::string { cpu } };
+
+        // String copy must be created anyway to use stoull function
+        parsed_cpus.push_back(std::stoull(std::string { cpu }));
+        cpu_begin = cpu_end + 1;
+    }
+
+    return parsed_cpus;
+}
+
+/**
+ * @brief Parses comma-separated list of cluster nodes endpoints, each one being an IP address followed by a port.
+ *
+ * @param nodes Nodes list, like `10.0.0.1:35555,10.0.0.2:35555`
+ *
+ * @throws RpT::Utils::OptionsError If any endpoint cannot be parsed
+ *
+ * @return Parsed endpoints, in given order
+ */
+std::vector<boost::asio::ip::tcp::endpoint> parseGatewayNodes(const std::string_view nodes) {
+    std::vector<boost::asio::ip::tcp::endpoint> parsed_nodes;
+
+    std::size_t node_begin { 0 };
+    while (node_begin <= nodes.size()) {
+        const std::size_t node_end { std::min(nodes.find(',', node_begin), nodes.size()) };
+        const std::string_view node { nodes.substr(node_begin, node_end - node_begin) };
+
+        // Port is after last colon, as IPv6 addresses also contain colons
+        const std::size_t port_separator { node.rfind(':') };
+        if (port_separator == std::string_view::npos)
+            throw RpT::Utils::OptionsError { "Missing port for gateway node " + std::string { node } };
+
+        std::string_view address { node.substr(0, port_separator) };
+        if (address.size() >= 2 && address.front() == '[' && address.back() == ']') // Bracketed IPv6 address
+            address = address.substr(1, address.size() - 2);
+
+        boost::system::error_code address_err;
+        const boost::asio::ip::address parsed_address {
+            boost::asio::ip::make_address(std::string { address }, address_err)
+        };
+
+        // String copy must be created anyway to use stoull function
+        const std::string port_argument { node.substr(port_separator + 1) };
+        const std::uint64_t parsed_port { std::stoull(port_argument) };
+
+        if (address_err || parsed_port > std::numeric_limits<std::uint16_t>::max())
+            throw RpT::Utils::OptionsError { "Invalid gateway node endpoint " + std::string { node } };
+
+        parsed_nodes.emplace_back(parsed_address, static_cast<std::uint16_t>(parsed_port));
+        node_begin = node_end + 1;
+    }
+
+    return parsed_nodes;
+}
+
 int main(const int argc, const char** argv) {
     RpT::Utils::LoggingContext server_logging;
     RpT::Utils::LoggerView logger { "Main", server_logging };
@@ -92,7 +217,17 @@ int main(const int argc, const char** argv) {
     try {
         // Read and parse command line options
         const RpT::Utils::CommandLineOptionsParser cmd_line_options {
-            argc, argv, { "game", "log-level", "testing", "ip", "port", "net-backend", "crt", "privkey" }
+            argc, argv, { "game", "log-level", "testing", "ip", "port", "net-backend", "crt", "privkey", "io-threads",
+                          "acceptors", "deflate", "deflate-level", "deflate-no-takeover", "tls-cache-size",
+                          "tls-no-tickets", "tls-key-rotation", "max-queued-messages", "max-queued-bytes",
+                          "loopback-script", "handshake-timeout", "login-timeout", "idle-timeout",
+                          "input-batch", "rooms", "room-workers", "task-workers", "bot-search", "log-queue",
+                          "log-overflow", "latency-report", "metrics-port", "trace-file", "trace-buffer",
+                          "record-inputs", "replay-inputs", "replay-pace", "overload-saturation",
+                          "overload-queue-depth", "rate-limit", "rate-burst", "iteration-arena", "spectators",
+                          "spectators-delay", "gateway-nodes", "handoff-socket", "take-over", "drain-timeout", "capacity",
+                          "ready-file", "busy-poll", "pin-cpu", "io-cpus",
+                          "room-cpus", "max-message-size", "match-log", "slow-requests", "session-grace" }
         };
 
         // Get game name from command line options and parses it to an available RpT Minigame
@@ -117,6 +252,25 @@ int main(const int argc, const char** argv) {
             }
         }
 
+        // Loggers created from now on are writing messages from a background thread if a queue capacity is given
+        if (cmd_line_options.has("log-queue")) {
+            // String copy must be created anyway to use stoull function
+            const std::string log_queue_argument { cmd_line_options.get("log-queue") };
+            const std::size_t log_queue_capacity { std::stoull(log_queue_argument) };
+
+            if (log_queue_capacity == 0)
+                throw RpT::Utils::OptionsError { "log-queue argument must be a positive number of messages" };
+
+            // Logging messages are dropped rather than stalling main loop, unless specified otherwise
+            RpT::Utils::LogOverflowPolicy log_overflow_policy { RpT::Utils::LogOverflowPolicy::DROP };
+            if (cmd_line_options.has("log-overflow"))
+                log_overflow_policy = parseLogOverflowPolicy(cmd_line_options.get("log-overflow"));
+
+            server_logging.enableAsyncLogging(log_queue_capacity, log_overflow_policy);
+
+            logger.debug("Asynchronous logging enabled with a queue of {} messages", log_queue_capacity);
+        }
+
         std::uint16_t server_local_port;
         // Try to get and parse server local port from command line options
         if (cmd_line_options.has("port")) {
@@ -164,12 +318,248 @@ int main(const int argc, const char** argv) {
         if (cmd_line_options.has("net-backend"))
             selected_network_bakcend = cmd_line_options.get("net-backend");
 
+        // Tuning options for Websocket backends, defaults keep connections on Executor thread
+        RpT::Network::BeastWebsocketBackendOptions websocket_options;
+        // Try to get and parse IO threads count running connections from command line options
+        if (cmd_line_options.has("io-threads")) {
+            // String copy must be created anyway to use stoull function
+            const std::string io_threads_argument { cmd_line_options.get("io-threads") };
+
+            websocket_options.ioThreads = std::stoull(io_threads_argument);
+
+            logger.debug("Switch IO threads count to {}", websocket_options.ioThreads);
+        }
+
+        // IO threads are pinned to given cores, only if a cores list is given
+        if (cmd_line_options.has("io-cpus")) {
+            websocket_options.ioThreadsCpus = parseCpuList(cmd_line_options.get("io-cpus"));
+
+            logger.debug("Pin IO threads to {} CPU cores", websocket_options.ioThreadsCpus.size());
+        }
+
+        // Try to get and parse acceptors count listening for connections from command line options
+        if (cmd_line_options.has("acceptors")) {
+            // String copy must be created anyway to use stoull function
+            const std::string acceptors_argument { cmd_line_options.get("acceptors") };
+
+            websocket_options.acceptors = std::stoull(acceptors_argument);
+
+            logger.debug("Switch acceptors count to {}", websocket_options.acceptors);
+        }
+
+        // Try to get and parse high watermarks for clients outgoing queues from command line options
+        if (cmd_line_options.has("max-queued-messages")) {
+            // String copy must be created anyway to use stoull function
+            const std::string max_messages_argument { cmd_line_options.get("max-queued-messages") };
+
+            websocket_options.outgoingLimits.highMessages = std::stoull(max_messages_argument);
+        }
+
+        if (cmd_line_options.has("max-queued-bytes")) {
+            // String copy must be created anyway to use stoull function
+            const std::string max_bytes_argument { cmd_line_options.get("max-queued-bytes") };
+
+            websocket_options.outgoingLimits.highBytes = std::stoull(max_bytes_argument);
+        }
+
+        // Try to get and parse maximum length for messages received from clients, so buffers never grow past it
+        if (cmd_line_options.has("max-message-size")) {
+            // String copy must be created anyway to use stoull function
+            const std::string max_message_argument { cmd_line_options.get("max-message-size") };
+
+            websocket_options.maxMessageSize = std::stoull(max_message_argument);
+            if (websocket_options.maxMessageSize == 0)
+                throw RpT::Utils::OptionsError { "max-message-size argument must be a positive bytes count" };
+        }
+
+        // Websocket compression is disabled unless explicitly enabled by command line options
+        if (cmd_line_options.has("deflate")) {
+            websocket_options.deflate = true;
+            // Context takeover compresses better with higher memory usage, kept unless disabled
+            websocket_options.deflateContextTakeover = !cmd_line_options.has("deflate-no-takeover");
+
+            if (cmd_line_options.has("deflate-level")) {
+                // String copy must be created anyway to use stoi function
+                const std::string deflate_level_argument { cmd_line_options.get("deflate-level") };
+                const int parsed_level { std::stoi(deflate_level_argument) };
+
+                if (parsed_level < 0 || parsed_level > 9)
+                    throw RpT::Utils::OptionsError { "deflate-level argument must be included inside 0..9" };
+
+                websocket_options.deflateLevel = parsed_level;
+            }
+
+            logger.debug("Enable permessage-deflate, level {}", websocket_options.deflateLevel);
+        }
+
+        // Try to get and parse TLS sessions resumption settings from command line options, used by WSS backend only
+        if (cmd_line_options.has("tls-cache-size")) {
+            // String copy must be created anyway to use stoull function
+            const std::string cache_size_argument { cmd_line_options.get("tls-cache-size") };
+
+            websocket_options.tlsSessionCacheSize = std::stoull(cache_size_argument);
+        }
+
+        if (cmd_line_options.has("tls-key-rotation")) {
+            // String copy must be created anyway to use stoull function
+            const std::string key_rotation_argument { cmd_line_options.get("tls-key-rotation") };
+            const std::uint64_t parsed_rotation { std::stoull(key_rotation_argument) };
+
+            if (parsed_rotation == 0)
+                throw RpT::Utils::OptionsError { "tls-key-rotation argument must be a positive number of seconds" };
+
+            websocket_options.tlsTicketKeyRotation = std::chrono::seconds { parsed_rotation };
+        }
+
+        websocket_options.tlsTickets = !cmd_line_options.has("tls-no-tickets");
+
+        // Try to get and parse connections timeouts from command line options, in seconds, 0 disabling a timeout
+        if (cmd_line_options.has("handshake-timeout")) { // Applied to both TLS and Websocket handshakes
+            // String copy must be created anyway to use stoull function
+            const std::string handshake_timeout_argument { cmd_line_options.get("handshake-timeout") };
+            const std::chrono::seconds handshake_timeout { std::stoull(handshake_timeout_argument) };
+
+            websocket_options.tlsHandshakeTimeout = handshake_timeout;
+            websocket_options.websocketHandshakeTimeout = handshake_timeout;
+        }
+
+        if (cmd_line_options.has("login-timeout")) {
+            // String copy must be created anyway to use stoull function
+            const std::string login_timeout_argument { cmd_line_options.get("login-timeout") };
+
+            websocket_options.loginTimeout = std::chrono::seconds { std::stoull(login_timeout_argument) };
+        }
+
+        if (cmd_line_options.has("idle-timeout")) {
+            // String copy must be created anyway to use stoull function
+            const std::string idle_timeout_argument { cmd_line_options.get("idle-timeout") };
+
+            websocket_options.idleTimeout = std::chrono::seconds { std::stoull(idle_timeout_argument) };
+        }
+
+        // Try to get and parse number of rooms hosted simultaneously, each one for 2 players
+        std::size_t rooms_count { 1 };
+        if (cmd_line_options.has("rooms")) {
+            // String copy must be created anyway to use stoull function
+            const std::string rooms_argument { cmd_line_options.get("rooms") };
+
+            rooms_count = std::stoull(rooms_argument);
+            if (rooms_count == 0)
+                throw RpT::Utils::OptionsError { "rooms argument must be a positive number of rooms" };
+
+            logger.debug("Hosting up to {} rooms", rooms_count);
+        }
+
+        // Try to get and parse time spent by each room bot to search its actions
+        std::size_t bot_search_ms { 1000 };
+        if (cmd_line_options.has("bot-search")) {
+            // String copy must be created anyway to use stoull function
+            const std::string bot_search_argument { cmd_line_options.get("bot-search") };
+
+            bot_search_ms = std::stoull(bot_search_argument);
+            if (bot_search_ms == 0)
+                throw RpT::Utils::OptionsError { "bot-search argument must be a positive number of milliseconds" };
+
+            logger.debug("Bot searches each action for {} ms", bot_search_ms);
+        }
+
+        // Try to get and parse number of actors which can watch each room game besides its players
+        std::size_t room_spectators { 0 };
+        if (cmd_line_options.has("spectators")) {
+            // String copy must be created anyway to use stoull function
+            const std::string spectators_argument { cmd_line_options.get("spectators") };
+
+            room_spectators = std::stoull(spectators_argument);
+
+            logger.debug("Each room accepts {} spectators", room_spectators);
+        }
+
+        // Try to get and parse delay between events batches sent to each room spectators
+        std::size_t spectators_delay_ms { 100 };
+        if (cmd_line_options.has("spectators-delay")) {
+            // String copy must be created anyway to use stoull function
+            const std::string spectators_delay_argument { cmd_line_options.get("spectators-delay") };
+
+            spectators_delay_ms = std::stoull(spectators_delay_argument);
+
+            logger.debug("Spectators events are batched every {} ms", spectators_delay_ms);
+        }
+
+        // Every room is filled by its players and spectators, so backend accepts enough actors for all of them
+        const std::size_t players_limit {
+            rooms_count * (MinigamesServices::MinigameRoom::PLAYERS + room_spectators)
+        };
+
+        // Try to get and parse bytes available for each main loop iteration transient data before heap is used
+        std::size_t iteration_arena_capacity { RpT::Utils::IterationArena::DEFAULT_CAPACITY };
+        if (cmd_line_options.has("iteration-arena")) {
+            // String copy must be created anyway to use stoull function
+            const std::string iteration_arena_argument { cmd_line_options.get("iteration-arena") };
+
+            iteration_arena_capacity = std::stoull(iteration_arena_argument);
+            if (iteration_arena_capacity == 0)
+                throw RpT::Utils::OptionsError { "iteration-arena argument must be a positive number of bytes" };
+        }
+
+        // Transient data of each main loop iteration, reset by executor, outlives backend
+        RpT::Utils::IterationArena iteration_arena { iteration_arena_capacity };
+        // Simulated clients script read by loopback backend, must be kept open as long as backend is running
+        std::ifstream loopback_script;
+        // Pipeline stages latencies, only recorded if a report has to be written at shutdown, outlives backend IO threads
+        RpT::Utils::PipelineLatencies pipeline_latencies;
+        // Runtime metrics, only updated if they are served, outlives backend IO threads
+        RpT::Utils::RuntimeMetrics runtime_metrics;
+        // SR commands pipeline contexts, only if a slow requests threshold is given, outlives metrics endpoint
+        std::optional<RpT::Utils::SlowRequestSampler> slow_requests_sampler;
+        // Main loop tracer, only if a trace file is given, outlives backend
+        std::optional<RpT::Utils::LoopTracer> loop_tracer;
+        // Main loop load, only if load must be shed past any threshold, outlives backend IO threads
+        std::optional<RpT::Utils::LoadMonitor> load_monitor;
+        // Recorded input events log, replayed instead of network backend traffic, must be kept open as long as it is replayed
+        std::ifstream replayed_inputs_log;
+        // Replays recorded input events without any client, if enabled
+        std::optional<RpT::Core::InputReplay> input_replay;
         // Dynamic selection from command line options, requires dynamic allocation
         std::unique_ptr<RpT::Network::NetworkBackend> network_backend;
+        // Selected backend if it is loading TLS context in background, waited for before main loop runs
+        RpT::Network::SafeBeastWebsocketBackend* tls_backend { nullptr };
         // Local server endpoint evaluated from configurable port and IP protocol version
         const boost::asio::ip::tcp::endpoint server_local_endpoint { server_local_protocol, server_local_port };
 
-        if (selected_network_bakcend == "wss") { // Websockets switched from HTTPS
+        if (cmd_line_options.has("gateway-nodes")) { // Routes clients to nodes hosting rooms instead of hosting them
+            RpT::Network::ClusterGateway gateway {
+                server_local_endpoint, parseGatewayNodes(cmd_line_options.get("gateway-nodes")), server_logging
+            };
+
+            gateway.run();
+
+            logger.info("Successfully shut down.");
+
+            return SUCCESS;
+        }
+
+        if (cmd_line_options.has("replay-inputs")) { // Recorded traffic fed to executor, no network backend
+            // Retrieves and copies option from command line
+            const std::string replay_option { cmd_line_options.get("replay-inputs") };
+
+            RpT::Core::ReplayPace replay_pace { RpT::Core::ReplayPace::Fast };
+            if (cmd_line_options.has("replay-pace")) {
+                const std::string_view replay_pace_option { cmd_line_options.get("replay-pace") };
+
+                if (replay_pace_option == "original")
+                    replay_pace = RpT::Core::ReplayPace::Original;
+                else if (replay_pace_option != "fast")
+                    throw RpT::Utils::OptionsError { "replay-pace argument must be \"fast\" or \"original\"" };
+            }
+
+            replayed_inputs_log.open(replay_option, std::ios::binary);
+            if (!replayed_inputs_log)
+                throw RpT::Utils::OptionsError { "Given replayed inputs log path couldn't be opened" };
+
+            input_replay.emplace(replayed_inputs_log, replay_pace);
+
+            logger.debug("Replaying input events from {}", replay_option);
+        } else if (selected_network_bakcend == "wss") { // Websockets switched from HTTPS
             logger.debug("Using Secure Websocket backend for IO interface.");
 
             // Retrieves and copies options from command line
@@ -189,19 +579,234 @@ int main(const int argc, const char** argv) {
                 throw RpT::Utils::OptionsError { "Given private key path isn't a valid path to reguler file" };
 
             // If both paths are valid, uses them to build backend with appropriate TLS features configuration
-            network_backend = std::make_unique<RpT::Network::SafeBeastWebsocketBackend>(
-                    certificate_option, private_key_option, server_local_endpoint, server_logging);
+            auto safe_backend { std::make_unique<RpT::Network::SafeBeastWebsocketBackend>(
+                    certificate_option, private_key_option, server_local_endpoint, server_logging, websocket_options,
+                    players_limit) };
+
+            tls_backend = safe_backend.get();
+            network_backend = std::move(safe_backend);
         } else if (selected_network_bakcend == "unsafe-ws") { // Websockets switched from HTTP
             logger.debug("Using NON-Secure Websocket backend for IO interface.");
 
             network_backend = std::make_unique<RpT::Network::UnsafeBeastWebsocketBackend>(
-                    server_local_endpoint, server_logging);
+                    server_local_endpoint, server_logging, websocket_options, players_limit);
+        } else if (selected_network_bakcend == "raw-tcp") { // Length-prefixed frames, for trusted internal clients
+            logger.debug("Using raw TCP backend for IO interface.");
+
+            RpT::Network::RawTcpBackendOptions tcp_options;
+            tcp_options.outgoingLimits = websocket_options.outgoingLimits; // Same watermarks as Websocket backends
+            tcp_options.maxMessageSize = websocket_options.maxMessageSize;
+
+            // Listening socket is passed to next deployed process, which might itself take it over from this one
+            if (cmd_line_options.has("handoff-socket"))
+                tcp_options.handoffPath = cmd_line_options.get("handoff-socket");
+
+            if (cmd_line_options.has("take-over")) {
+                tcp_options.takeOverPath = cmd_line_options.get("take-over");
+
+                logger.debug("Taking listening socket over from {}", tcp_options.takeOverPath);
+            }
+
+            if (cmd_line_options.has("drain-timeout")) {
+                // String copy must be created anyway to use stoull function
+                const std::string drain_timeout_argument { cmd_line_options.get("drain-timeout") };
+
+                tcp_options.drainTimeout = std::chrono::seconds { std::stoull(drain_timeout_argument) };
+            }
+
+            network_backend = std::make_unique<RpT::Network::RawTcpBackend>(
+                    server_local_endpoint, server_logging, tcp_options, players_limit);
+        } else if (selected_network_bakcend == "io-uring") { // Raw TCP framing on io_uring, Linux only
+#if RPT_IO_URING_AVAILABLE
+            logger.debug("Using io_uring backend for IO interface.");
+
+            RpT::Network::IoUringBackendOptions io_uring_options;
+            io_uring_options.outgoingLimits = websocket_options.outgoingLimits; // Same watermarks as Websocket backends
+            io_uring_options.maxMessageSize = websocket_options.maxMessageSize;
+
+            network_backend = std::make_unique<RpT::Network::IoUringBackend>(
+                    server_local_endpoint, server_logging, io_uring_options, players_limit);
+#else
+            throw RpT::Utils::OptionsError { "io_uring backend unavailable for this build" };
+#endif
+        } else if (selected_network_bakcend == "loopback") { // In-process simulated clients, for soak tests
+            logger.debug("Using loopback backend for IO interface.");
+
+            // Retrieves and copies option from command line
+            const std::string script_option { cmd_line_options.get("loopback-script") };
+
+            loopback_script.open(script_option);
+            if (!loopback_script)
+                throw RpT::Utils::OptionsError { "Given loopback script path couldn't be opened" };
+
+            network_backend = std::make_unique<RpT::Network::LoopbackBackend>(
+                    RpT::Network::LoopbackScript { loopback_script }, players_limit);
         } else { // Unknown network backend
             const std::string backend_copy { selected_network_bakcend }; // Copy required for string concat
 
             throw RpT::Utils::OptionsError { "Unknown networking backend " + backend_copy };
         }
 
+        const bool latency_report_enabled { cmd_line_options.has("latency-report") };
+        if (latency_report_enabled && network_backend) {
+            network_backend->recordLatencies(pipeline_latencies);
+
+            logger.debug("Enable pipeline latencies recording");
+        }
+
+        if (cmd_line_options.has("slow-requests")) {
+            // String copy must be created anyway to use stoull function
+            const std::string slow_requests_argument { cmd_line_options.get("slow-requests") };
+            const std::chrono::microseconds slow_requests_threshold { std::stoull(slow_requests_argument) };
+
+            if (slow_requests_threshold.count() == 0)
+                throw RpT::Utils::OptionsError { "slow-requests argument must be a positive number of microseconds" };
+
+            slow_requests_sampler.emplace(slow_requests_threshold);
+
+            logger.debug("Log SR commands slower than {} us", slow_requests_threshold.count());
+        }
+
+        if (cmd_line_options.has("trace-file")) {
+            std::size_t trace_buffer { DEFAULT_TRACE_BUFFER };
+            if (cmd_line_options.has("trace-buffer")) {
+                // String copy must be created anyway to use stoull function
+                const std::string trace_buffer_argument { cmd_line_options.get("trace-buffer") };
+
+                trace_buffer = std::stoull(trace_buffer_argument);
+                if (trace_buffer == 0)
+                    throw RpT::Utils::OptionsError { "trace-buffer argument must be a positive number of spans" };
+            }
+
+            loop_tracer.emplace(trace_buffer, std::string { cmd_line_options.get("trace-file") });
+            if (network_backend)
+                network_backend->recordTrace(*loop_tracer);
+
+#ifdef SIGUSR1
+            // Trace is dumped on demand, once current main loop iteration is done
+            signaled_tracer = &*loop_tracer;
+            std::signal(SIGUSR1, requestTraceDump);
+
+            logger.debug("Enable main loop tracing for {} spans, dumped on SIGUSR1", trace_buffer);
+#else
+            logger.debug("Enable main loop tracing for {} spans", trace_buffer);
+#endif
+        }
+
+        // Load is shed past any of main loop thresholds, only if one of them is given
+        if (cmd_line_options.has("overload-saturation") || cmd_line_options.has("overload-queue-depth")) {
+            double overload_saturation { DEFAULT_OVERLOAD_SATURATION };
+            if (cmd_line_options.has("overload-saturation")) {
+                // String copy must be created anyway to use stod function
+                const std::string saturation_argument { cmd_line_options.get("overload-saturation") };
+
+                overload_saturation = std::stod(saturation_argument);
+                if (!(overload_saturation > 0 && overload_saturation <= 1))
+                    throw RpT::Utils::OptionsError { "overload-saturation argument must be a ratio inside ]0;1]" };
+            }
+
+            std::size_t overload_queue_depth { DEFAULT_OVERLOAD_QUEUE_DEPTH };
+            if (cmd_line_options.has("overload-queue-depth")) {
+                // String copy must be created anyway to use stoull function
+                const std::string queue_depth_argument { cmd_line_options.get("overload-queue-depth") };
+
+                overload_queue_depth = std::stoull(queue_depth_argument);
+                if (overload_queue_depth == 0)
+                    throw RpT::Utils::OptionsError { "overload-queue-depth argument must be a positive events count" };
+            }
+
+            load_monitor.emplace(overload_saturation, overload_queue_depth);
+            if (network_backend)
+                network_backend->shedLoad(*load_monitor);
+
+            logger.debug("Shed load past {:.2f} main loop saturation or {} queued input events", overload_saturation,
+                         overload_queue_depth);
+        }
+
+        if (network_backend) // RPTL messages formatted for executor calls are transient
+            network_backend->useIterationArena(iteration_arena);
+
+        // Registries and messages pool are pre-sized, only if a clients capacity is given
+        if (cmd_line_options.has("capacity") && network_backend) {
+            // String copy must be created anyway to use stoull function
+            const std::string capacity_argument { cmd_line_options.get("capacity") };
+            const std::size_t clients_capacity { std::stoull(capacity_argument) };
+
+            network_backend->reserve(clients_capacity);
+
+            logger.debug("Pre-size registries for {} clients", clients_capacity);
+        }
+
+        // Executor thread spins on ready IO operations before blocking, only if a busy-poll window is given
+        if (cmd_line_options.has("busy-poll") && network_backend) {
+            // String copy must be created anyway to use stoull function
+            const std::string busy_poll_argument { cmd_line_options.get("busy-poll") };
+            const std::chrono::microseconds busy_poll_window { std::stoull(busy_poll_argument) };
+
+            network_backend->busyPoll(busy_poll_window);
+
+            logger.debug("Busy-poll for {} us before waiting for input events", busy_poll_window.count());
+        }
+
+        // Actors of lost connections are kept so their session can be resumed, only if a grace period is given
+        if (cmd_line_options.has("session-grace") && network_backend) {
+            // String copy must be created anyway to use stoull function
+            const std::string session_grace_argument { cmd_line_options.get("session-grace") };
+            const std::chrono::milliseconds session_grace { std::stoull(session_grace_argument) };
+
+            network_backend->resumeSessions(session_grace);
+
+            logger.debug("Keep actors of lost connections for {} ms", session_grace.count());
+        }
+
+        // SERVICE commands rate is limited for each actor, only if a rate is given
+        if (cmd_line_options.has("rate-limit") && network_backend) {
+            RpT::Network::RequestRateLimits rate_limits;
+
+            // String copy must be created anyway to use stod function
+            const std::string rate_limit_argument { cmd_line_options.get("rate-limit") };
+            rate_limits.requestsPerSecond = std::stod(rate_limit_argument);
+            if (!(rate_limits.requestsPerSecond > 0))
+                throw RpT::Utils::OptionsError { "rate-limit argument must be a positive requests per second rate" };
+
+            if (cmd_line_options.has("rate-burst")) {
+                // String copy must be created anyway to use stoull function
+                const std::string rate_burst_argument { cmd_line_options.get("rate-burst") };
+
+                rate_limits.burst = std::stoull(rate_burst_argument);
+                if (rate_limits.burst == 0)
+                    throw RpT::Utils::OptionsError { "rate-burst argument must be a positive number of requests" };
+            }
+
+            network_backend->limitRequests(rate_limits);
+
+            logger.debug("Limit each actor to {:.2f} requests per second, with bursts of {}",
+                         rate_limits.requestsPerSecond, rate_limits.burst);
+        }
+
+        // Optional HTTP listener scraped for runtime metrics, on its own port
+        std::optional<RpT::Network::MetricsEndpoint> metrics_endpoint;
+        const bool metrics_enabled { cmd_line_options.has("metrics-port") };
+        if (metrics_enabled) {
+            // String copy must be created anyway to use stoull function
+            const std::string metrics_port_argument { cmd_line_options.get("metrics-port") };
+            const std::uint64_t parsed_metrics_port { std::stoull(metrics_port_argument) };
+
+            if (parsed_metrics_port > std::numeric_limits<std::uint16_t>::max())
+                throw RpT::Utils::OptionsError { "metrics-port argument must be included inside 0..65535" };
+
+            if (network_backend)
+                network_backend->recordMetrics(runtime_metrics);
+
+            // Latencies and slow requests exemplars are served too if they are recorded
+            metrics_endpoint.emplace(
+                    boost::asio::ip::tcp::endpoint {
+                        server_local_protocol, static_cast<std::uint16_t>(parsed_metrics_port)
+                    },
+                    runtime_metrics, server_logging, latency_report_enabled ? &pipeline_latencies : nullptr,
+                    slow_requests_sampler ? &*slow_requests_sampler : nullptr);
+        }
+
         /*
          * Create executor with listed resources paths, game name argument and run main loop with dynamically
          * initialized NetworkBackend implementation
@@ -211,14 +816,136 @@ int main(const int argc, const char** argv) {
         if (cmd_line_options.has("testing")) {
             logger.info("Testing mode for CI, server will be immediately closed.");
 
-            network_backend->close();
+            if (network_backend)
+                network_backend->close();
+            else
+                input_replay->close();
+        }
+
+        // Backend is listening since it was constructed, so traffic can be routed to server while it is set up
+        if (network_backend && !network_backend->closed()) {
+            if (metrics_enabled)
+                runtime_metrics.serverReady();
+
+            if (cmd_line_options.has("ready-file")) {
+                // Retrieves and copies option from command line
+                const std::string ready_file_option { cmd_line_options.get("ready-file") };
+
+                std::ofstream ready_file { ready_file_option, std::ios::trunc };
+                if (!ready_file)
+                    throw RpT::Utils::OptionsError { "Given ready file path couldn't be opened" };
+
+                ready_file << "ready\n";
+            }
+
+            logger.info("Ready to accept clients.");
         }
 
         /*
          * Initializes executor for main loop without user-provided callbacks
          */
 
-        RpT::Core::Executor rpt_executor { *network_backend, server_logging };
+        // Main loop inputs come from replayed log or from network backend
+        RpT::Core::InputOutputInterface& io_interface {
+            input_replay ? static_cast<RpT::Core::InputOutputInterface&>(*input_replay) : *network_backend
+        };
+
+        // Recorded input events log, must be kept open as long as main loop is running
+        std::ofstream recorded_inputs_log;
+        // Decorates IO interface to record input events, if enabled
+        std::optional<RpT::Core::InputRecorder> input_recorder;
+        if (cmd_line_options.has("record-inputs")) {
+            // Retrieves and copies option from command line
+            const std::string record_option { cmd_line_options.get("record-inputs") };
+
+            recorded_inputs_log.open(record_option, std::ios::binary | std::ios::trunc);
+            if (!recorded_inputs_log)
+                throw RpT::Utils::OptionsError { "Given recorded inputs log path couldn't be opened" };
+
+            input_recorder.emplace(io_interface, recorded_inputs_log);
+
+            logger.debug("Recording input events into {}", record_option);
+        }
+
+        RpT::Core::Executor rpt_executor {
+            input_recorder ? static_cast<RpT::Core::InputOutputInterface&>(*input_recorder) : io_interface,
+            server_logging
+        };
+
+        if (latency_report_enabled)
+            rpt_executor.recordLatencies(pipeline_latencies);
+
+        if (metrics_enabled)
+            rpt_executor.recordMetrics(runtime_metrics);
+
+        if (slow_requests_sampler)
+            rpt_executor.sampleSlowRequests(*slow_requests_sampler);
+
+        if (loop_tracer)
+            rpt_executor.recordTrace(*loop_tracer);
+
+        if (load_monitor)
+            rpt_executor.monitorLoad(*load_monitor);
+
+        rpt_executor.useIterationArena(iteration_arena);
+
+        // Try to get and parse number of ready input events handled before clients are synced
+        if (cmd_line_options.has("input-batch")) {
+            // String copy must be created anyway to use stoull function
+            const std::string input_batch_argument { cmd_line_options.get("input-batch") };
+            const std::size_t inputs_batch_size { std::stoull(input_batch_argument) };
+
+            // Every sampled SR command of a batch must keep its ring slot until rooms are synced
+            if (slow_requests_sampler && inputs_batch_size >= slow_requests_sampler->ringCapacity())
+                throw RpT::Utils::OptionsError { "input-batch argument must be smaller than slow requests ring" };
+
+            rpt_executor.batchInputs(inputs_batch_size);
+
+            logger.debug("Switch inputs batch size to {}", inputs_batch_size);
+        }
+
+        // Try to get and parse number of workers running rooms steps, including executor thread
+        if (cmd_line_options.has("room-workers")) {
+            // String copy must be created anyway to use stoull function
+            const std::string room_workers_argument { cmd_line_options.get("room-workers") };
+            const std::size_t room_workers { std::stoull(room_workers_argument) };
+
+            rpt_executor.scheduleRooms(room_workers);
+
+            logger.debug("Switch rooms workers count to {}", room_workers);
+        }
+
+        // Try to get and parse number of workers running tasks offloaded by services
+        if (cmd_line_options.has("task-workers")) {
+            // String copy must be created anyway to use stoull function
+            const std::string task_workers_argument { cmd_line_options.get("task-workers") };
+            const std::size_t task_workers { std::stoull(task_workers_argument) };
+
+            rpt_executor.offloadTasks(task_workers);
+
+            logger.debug("Switch tasks workers count to {}", task_workers);
+        }
+
+        // Main loop thread is pinned to a dedicated core, only if one is given
+        if (cmd_line_options.has("pin-cpu")) {
+            // String copy must be created anyway to use stoull function
+            const std::string pin_cpu_argument { cmd_line_options.get("pin-cpu") };
+            const std::size_t loop_cpu { std::stoull(pin_cpu_argument) };
+
+            rpt_executor.pinLoopThread(loop_cpu);
+
+            logger.debug("Pin main loop thread to CPU {}", loop_cpu);
+        }
+
+        // Rooms workers threads are pinned to given cores, only if a cores list is given
+        if (cmd_line_options.has("room-cpus")) {
+            std::vector<std::size_t> room_workers_cpus { parseCpuList(cmd_line_options.get("room-cpus")) };
+            const std::size_t room_cpus_count { room_workers_cpus.size() };
+
+            rpt_executor.pinRoomWorkers(std::move(room_workers_cpus));
+
+            logger.debug("Pin rooms workers threads to {} CPU cores", room_cpus_count);
+        }
 
         /*
          * Initializes online services
@@ -238,41 +965,106 @@ int main(const int argc, const char** argv) {
                 }
         };
 
-        RpT::Core::ServiceContext services_context;
-        MinigamesServices::ChatService chat_svc { services_context, 2000 };
-        MinigamesServices::MinigameService minigame_svc { services_context, std::move(game_provider) };
-        MinigamesServices::LobbyService lobby_svc { services_context, minigame_svc, 5000 };
+        // Shared by every room services so timers tokens are unique across rooms
+        RpT::Core::ServiceContext timers_tokens_provider;
+
+        // Finished matches appended by every room, written from its own thread so main loop never waits for disk
+        std::optional<MinigamesServices::MatchLogWriter> match_log;
+        if (cmd_line_options.has("match-log")) {
+            // Retrieves and copies option from command line
+            const std::string match_log_option { cmd_line_options.get("match-log") };
+
+            match_log.emplace(match_log_option);
+
+            logger.debug("Appending finished matches into {}", match_log_option);
+        }
 
         /*
-         * Adds and removes players from Lobby when actors connects or disconnects to server
+         * Each room runs its own services, lobby is assigned to room actors
          */
 
-        rpt_executor.handle<RpT::Core::JoinedEvent>([&lobby_svc](const RpT::Core::JoinedEvent& event) {
-            lobby_svc.assignActor(event.actor());
-        });
+        // TLS context has been loaded while services were set up, loading error is fatal
+        if (tls_backend)
+            tls_backend->waitTlsContext();
+
+        const auto main_loop_begin { std::chrono::steady_clock::now() };
 
-        rpt_executor.handle<RpT::Core::LeftEvent>([&lobby_svc, &minigame_svc](const RpT::Core::LeftEvent& event) {
-            lobby_svc.removeActor(event.actor());
+        const bool done_successfully {
+            rpt_executor.runRooms([&timers_tokens_provider, &game_provider, &server_logging, bot_search_ms,
+                                   shed_load_monitor = load_monitor ? &*load_monitor : nullptr, room_spectators,
+                                   spectators_delay_ms, match_log_writer = match_log ? &*match_log : nullptr](
+                    const std::uint64_t id) {
 
-            // If one of the two players is disconnected during a game, then it should stop or it would never end
-            if (minigame_svc.isStarted())
-                minigame_svc.stop();
-        });
+                return std::make_unique<MinigamesServices::MinigameRoom>(
+                        id, timers_tokens_provider, game_provider, server_logging, 2000, 5000, bot_search_ms,
+                        shed_load_monitor, room_spectators, spectators_delay_ms, match_log_writer);
+            })
+        };
 
-        bool game_was_running { false }; // Previous loop iteration MinigameService state
-        rpt_executor.make([&game_was_running, &lobby_svc, &minigame_svc]() {
-            const bool is_game_running { minigame_svc.isStarted() }; // Current loop iteration MinigameService state
+        if (input_replay) { // Throughput compared between builds replaying same log
+            const std::chrono::duration<double, std::milli> replay_duration {
+                std::chrono::steady_clock::now() - main_loop_begin
+            };
 
-            // For each loop iteration, if the game go from running to not running, it stopped and clients must be
-            // notified about that
-            if (game_was_running && !is_game_running)
-                lobby_svc.notifyWaiting();
+            logger.info("Replayed {} input events in {:.3f} ms, {} timers events skipped",
+                        input_replay->replayedEvents(), replay_duration.count(), input_replay->skippedEvents());
+        }
 
-            // Save this loop iteration result for the next iteration check
-            game_was_running = is_game_running;
-        });
+        if (input_recorder)
+            logger.info("Recorded {} input events", input_recorder->recordedEvents());
+
+        if (match_log)
+            logger.info("Logged {} finished matches", match_log->appendedMatches());
+
+        logger.info("Iteration arena of {} bytes overflowed {} times", iteration_arena.capacity(),
+                    iteration_arena.overflows());
+
+        if (network_backend && network_backend->requestsLimiter()) {
+            logger.info("Dropped {} SERVICE commands exceeding actors requests rate",
+                        network_backend->requestsLimiter()->dropped());
+        }
+
+        if (latency_report_enabled) {
+            // Retrieves and copies option from command line
+            const std::string latency_report_option { cmd_line_options.get("latency-report") };
+
+            std::ofstream latency_report { latency_report_option };
+            if (latency_report) {
+                pipeline_latencies.exportTo(latency_report);
+
+                logger.info("Pipeline latencies written into {}", latency_report_option);
+            } else {
+                logger.error("Unable to write pipeline latencies into {}", latency_report_option);
+            }
+        }
+
+        if (loop_tracer) {
+#ifdef SIGUSR1
+            std::signal(SIGUSR1, SIG_DFL);
+            signaled_tracer = nullptr;
+#endif
+
+            // Latest spans are always written at shutdown
+            if (loop_tracer->dump())
+                logger.info("Main loop trace written into {}", cmd_line_options.get("trace-file"));
+            else
+                logger.error("Unable to write main loop trace into {}", cmd_line_options.get("trace-file"));
+        }
+
+        if constexpr (RpT::Utils::AllocationProfiler::ENABLED) { // Totals are also exported by metrics endpoint
+            for (std::size_t i { 0 }; i < RpT::Utils::AllocationProfiler::SUBSYSTEMS_COUNT; i++) {
+                const auto subsystem { static_cast<RpT::Utils::AllocationSubsystem>(i) };
+                const RpT::Utils::AllocationCounts allocations { RpT::Utils::AllocationProfiler::subsystem(subsystem) };
+
+                logger.info("Allocations for {}: {} ({} bytes)",
+                            RpT::Utils::AllocationProfiler::subsystemName(subsystem), allocations.allocations,
+                            allocations.bytes);
+            }
+        }
 
-        const bool done_successfully { rpt_executor.run({ chat_svc, minigame_svc, lobby_svc }) };
+        const std::size_t dropped_log_messages { server_logging.droppedMessages() };
+        if (dropped_log_messages > 0)
+            logger.warn("{} log messages dropped because logging queue was full", dropped_log_messages);
 
         // Process exit code depends on main loop result
         if (done_successfully) {
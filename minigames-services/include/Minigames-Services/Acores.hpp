@@ -20,20 +20,25 @@ private:
         Normal, Jump
     };
 
-    static constexpr std::initializer_list<std::initializer_list<Square>> INITIAL_GRID_ {
+    /// Moves reach at most 2 squares, for jumps
+    static constexpr int MAX_RANGE_ { 2 };
+
+    static constexpr GridLayout<5, 5> INITIAL_LAYOUT_ {{
             { WHITE, WHITE, WHITE, BLACK, BLACK },
             { WHITE, WHITE, WHITE, BLACK, BLACK },
             { WHITE, WHITE, EMPTY, BLACK, BLACK },
             { WHITE, WHITE, BLACK, BLACK, BLACK },
-            { WHITE, WHITE, BLACK, BLACK, BLACK },
-    };
+            { WHITE, WHITE, BLACK, BLACK, BLACK }
+    }};
+
+    static_assert(countSquares(INITIAL_LAYOUT_, WHITE) == 12 && countSquares(INITIAL_LAYOUT_, BLACK) == 12);
 
     std::optional<Move> last_move_;
 
     /// Tries to perform given move as normal, saving grid modifications into given reference argument
     void playNormal(GridUpdate& updates, AxisIterator move);
-    /// Tries to perform given move as jump with eat, saving grid modifications into given reference argument
-    void playJump(GridUpdate& updates, AxisIterator move);
+    /// Tries to perform given 2 squares move as jump with eat, saving grid modifications into given reference argument
+    void playJump(GridUpdate& updates);
 
 public:
     /// Constructs Açores minigame with game-specific initial configuration (12 pawns for each color/player)
@@ -45,6 +50,15 @@ public:
     /// Round is terminated if either last move if normal or player manually ended round
     bool isRoundTerminated() const override;
 
+    /// Normal move to a free neighbour unless a jump was performed, or jump over an opponent pawn to a free square
+    bool isLegal(const PawnMove& move) const override;
+
+    /// Copies game, jumps chain included
+    std::unique_ptr<BoardGame> clone() const override;
+
+    /// Moves of 1 or 2 squares toward any direction
+    std::vector<PawnMove> legalMoves() const override;
+
     /// Two available moves: normal or jump, then jumps chaining
     GridUpdate play(const Coordinates &from, const Coordinates &to) override;
 };
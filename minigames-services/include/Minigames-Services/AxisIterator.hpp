@@ -61,6 +61,59 @@ constexpr bool hasFlagOf(const AxisType axis, const AxisType direction) {
     return (axis_flags & direction_flags) != 0b0000;
 }
 
+/**
+ * @brief Retrieves axis toward the opposite direction of given axis
+ *
+ * @param axis Axis to reverse
+ *
+ * @returns Axis with each direction flag replaced by its opposite flag, for example `DownLeft` for `UpRight`
+ */
+constexpr AxisType opposite(const AxisType axis) {
+    const unsigned int axis_flags { static_cast<unsigned int>(axis) };
+
+    // Up and Left flags are moved onto Down and Right flags, and vice versa
+    return static_cast<AxisType>(((axis_flags & 0b1010) >> 1) | ((axis_flags & 0b0101) << 1));
+}
+
+
+/**
+ * @brief Set of allowed axes, one bit for each `AxisType` value, so checking if an axis is allowed is a single bit test
+ *
+ * @author ThisALV, https://github.com/ThisALV/
+ */
+class AxisMask {
+private:
+    unsigned int bits_;
+
+    /// Retrieves bit for given axis, `AxisType` values are below 16
+    static constexpr unsigned int bitFor(const AxisType axis) {
+        return 1u << static_cast<unsigned int>(axis);
+    }
+
+public:
+    /**
+     * @brief Constructs mask with bit enabled for each given axis, implicitly so directions lists can be passed
+     * where a mask is expected
+     *
+     * @param axes Axes allowed by mask
+     */
+    constexpr AxisMask(const std::initializer_list<AxisType> axes) : bits_ { 0 } {
+        for (const AxisType axis : axes)
+            bits_ |= bitFor(axis);
+    }
+
+    /**
+     * @brief Checks if given axis is allowed by mask
+     *
+     * @param axis Axis to check for
+     *
+     * @returns `true` if bit for `axis` is enabled, `false` otherwise
+     */
+    constexpr bool has(const AxisType axis) const {
+        return (bits_ & bitFor(axis)) != 0;
+    }
+};
+
 
 /**
  * @brief Iterates over orthogonal or diagonal axis linking one square inside a `Grid` to another
@@ -69,25 +122,20 @@ constexpr bool hasFlagOf(const AxisType axis, const AxisType direction) {
  * square because end-of-grid has been reached.
  *
  * @note This axis is a view, an interface of a given grid, it doesn't have any copy of squares inside the grid.
+ * Squares positions are computed on demand from the axis direction, so no storage is allocated for the axis. Number
+ * of squares before end-of-grid is computed once at construction, so moving forward doesn't check grid bounds.
  *
  * @author ThisALV, https://github.com/ThisALV/
  */
 class AxisIterator {
 private:
-    /// Elements iterated by this class, composed of a square inside this axis, and its position inside ctor grid
-    template<typename Element>
-    struct IteratedElement {
-        Coordinates position;
-        Element& state;
-    };
-
     /// Direction to move the iterator coordinates forward
     struct DirectionVector {
         int x;
         int y;
 
-        /// Retrieves the given coordinates if moved by current vector
-        Coordinates moves(const Coordinates& from) const;
+        /// Retrieves the given coordinates if moved by current vector the given number of times
+        Coordinates moves(const Coordinates& from, int times = 1) const;
     };
 
     /// Facility to retrieve direction from `DIRECTION_VECTORS_`
@@ -144,18 +192,45 @@ private:
         return static_cast<AxisType>(axis_flags);
     }
 
+    /// Number of squares following given origin square toward given axis inside a grid with given dimensions
+    static constexpr int rayLength(const int lines, const int columns, const Coordinates& origin,
+                                   const AxisType axis) {
+
+        // Squares remaining toward each direction, unbounded if axis isn't toward it
+        int vertical_length { lines + columns };
+        int horizontal_length { lines + columns };
+
+        if (hasFlagOf(axis, AxisType::Up))
+            vertical_length = origin.line - 1;
+        else if (hasFlagOf(axis, AxisType::Down))
+            vertical_length = lines - origin.line;
+
+        if (hasFlagOf(axis, AxisType::Left))
+            horizontal_length = origin.column - 1;
+        else if (hasFlagOf(axis, AxisType::Right))
+            horizontal_length = columns - origin.column;
+
+        // Diagonal axis ends as soon as one of its directions reaches end-of-grid
+        return vertical_length < horizontal_length ? vertical_length : horizontal_length;
+    }
+
+    const Grid& grid_;
     const bool mutable_grid_;
     const AxisType direction_;
+    const DirectionVector axis_vector_;
+    const Coordinates origin_;
 
-    std::vector<IteratedElement<Square>> axis_;
-    std::vector<IteratedElement<const Square>> const_axis_;
-    std::size_t current_pos_;
-    std::size_t destination_pos_;
+    int current_pos_;
+    int destination_pos_;
+    // Position of last square inside grid
+    int last_pos_;
 
-    /// Called by both constructors to build iterable constant or not axis vector depending on mutable_grid_ flag set
-    /// by each constructor
-    void initializeAxis(const Grid& grid, const Coordinates& from, const Coordinates& to,
-                        std::initializer_list<AxisType> allowed_directions);
+    /// Called by both constructors to check for axis squares and direction, then to save destination and last
+    /// positions inside axis
+    void initializeAxis(const Coordinates& from, const Coordinates& to, AxisMask allowed_directions);
+
+    /// Moves current position to next square inside axis, retrieving new position
+    Coordinates nextPosition();
 
 public:
     /// 8 diagonal AND orthogonal directions
@@ -174,23 +249,30 @@ public:
             AxisType::UpLeft, AxisType::DownRight, AxisType::UpRight, AxisType::DownLeft
     };
 
+    /// Mask allowing `EVERY_DIRECTION`
+    static constexpr AxisMask EVERY_DIRECTION_MASK { EVERY_DIRECTION };
+    /// Mask allowing `EVERY_ORTHOGONAL_DIRECTION`
+    static constexpr AxisMask EVERY_ORTHOGONAL_DIRECTION_MASK { EVERY_ORTHOGONAL_DIRECTION };
+    /// Mask allowing `EVERY_DIAGONAL_DIRECTION`
+    static constexpr AxisMask EVERY_DIAGONAL_DIRECTION_MASK { EVERY_DIAGONAL_DIRECTION };
+
     /**
      * @brief Constructs axis linking square at `from` coordinates to square at `to` coordinates
      *
      * @param grid Grid to get squares references from
      * @param from Coordinates for the player current pawn
      * @param to Coordinates for the player destination square
-     * @param allowed_directions Directions into which the player can move
+     * @param allowed_directions Mask of directions into which the player can move
      *
      * @throws BadCoordinates if there isn't any axis linking `from` and `to` squares, or if one of these squares
      * doesn't exist inside given `grid`
      */
     explicit AxisIterator(Grid& grid, const Coordinates& from, const Coordinates& to,
-                          std::initializer_list<AxisType> allowed_directions = EVERY_DIRECTION);
+                          AxisMask allowed_directions = EVERY_DIRECTION_MASK);
 
     /// Same as mutable grid constructor but retrieved `Square` states cannot be modified
     explicit AxisIterator(const Grid& grid, const Coordinates& from, const Coordinates& to,
-                          std::initializer_list<AxisType> allowed_directions = EVERY_DIRECTION);
+                          AxisMask allowed_directions = EVERY_DIRECTION_MASK);
 
     /**
      * @brief Retrieves calculated axis iterator direction
@@ -20,7 +20,10 @@ private:
         Elimination, Flip
     };
 
-    static constexpr std::initializer_list<std::initializer_list<Square>> INITIAL_GRID_ {
+    /// Number of lines and of columns
+    static constexpr int DIMENSION_ { 9 };
+
+    static constexpr GridLayout<DIMENSION_, DIMENSION_> INITIAL_LAYOUT_ {{
             { BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK },
             { BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK },
             { BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK },
@@ -29,19 +32,26 @@ private:
             { EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY },
             { WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE },
             { WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE },
-            { WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE },
-    };
+            { WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE }
+    }};
+
+    static_assert(countSquares(INITIAL_LAYOUT_, WHITE) == 27 && countSquares(INITIAL_LAYOUT_, BLACK) == 27);
+
+    /// Retrieves square right before destination of given move, which is flipped by a flips-take
+    static Coordinates flippedSquare(const Coordinates& from, const Coordinates& to);
 
-    /// Checks for every squares between origin and destination ,or distance-from-destination square if `until` is
-    /// specified, to be empty
-    static void checkFreeTrajectory(AxisIterator& move_trajectory, int until = 0);
+    /// Checks if every square strictly between two squares linked by an axis is empty
+    bool isFreeTrajectory(const Coordinates& from, const Coordinates& to) const;
+
+    /// Same as `isFreeTrajectory()`, but throws if it isn't
+    void checkFreeTrajectory(const Coordinates& from, const Coordinates& to) const;
 
     std::optional<Move> last_move_;
 
     /// Tries to perform given move as elimination-take, saving grid modifications into given reference argument
-    void playElimination(GridUpdate& updates, AxisIterator move);
+    void playElimination(GridUpdate& updates, int move_range);
     /// Tries to perform given move as flip-take, saving grid modifications into given reference argument
-    void playFlip(GridUpdate& updates, AxisIterator move);
+    void playFlip(GridUpdate& updates, int move_range);
 
 public:
     /// Constructs Bermudes minigame with game-specific initial configuration (27 pawns for each color/player)
@@ -53,6 +63,15 @@ public:
     /// Round is necessarily terminated if player did a elimination-take move
     bool isRoundTerminated() const override;
 
+    /// Elimination-take of an opponent pawn or flips-take over an opponent pawn, with free squares in between
+    bool isLegal(const PawnMove& move) const override;
+
+    /// Copies game, last move included
+    std::unique_ptr<BoardGame> clone() const override;
+
+    /// Moves of any range toward any direction
+    std::vector<PawnMove> legalMoves() const override;
+
     /// Two available moves: elimination-take or flips-take, then flips-take chaining
     GridUpdate play(const Coordinates &from, const Coordinates &to) override;
 };
@@ -0,0 +1,129 @@
+#ifndef RPT_MINIGAMES_SERVICES_BITBOARD_HPP
+#define RPT_MINIGAMES_SERVICES_BITBOARD_HPP
+
+/**
+ * @file Bitboard.hpp
+ */
+
+#include <bitset>
+#include <cstddef>
+#include <Minigames-Services/AxisIterator.hpp>
+
+
+namespace MinigamesServices {
+
+
+/**
+ * @brief Occupancy masks for each pawn color of a `Grid`, so game rules can check many squares at once using bitwise
+ * operations
+ *
+ * Each line is followed by a guard column which is never set, so shifting a mask toward a direction never moves a
+ * square from a grid border to the opposite border of the next or previous line. This guard column, and the squares
+ * past the last line, are discarded from every shifted mask.
+ *
+ * @note It is a copy of grid squares state, it must be updated with `set()` each time a square of the grid changes.
+ *
+ * @author ThisALV, https://github.com/ThisALV/
+ */
+class Bitboard {
+public:
+    /// Maximum number of squares, guard columns included, for a grid to fit inside masks
+    static constexpr std::size_t MAX_SQUARES { 128 };
+
+    /// One bit for each square, set if the square is part of the mask
+    using Mask = std::bitset<MAX_SQUARES>;
+
+private:
+    int lines_count_;
+    int columns_count_;
+    int stride_; // Bits for each line, guard column included
+    Mask squares_; // Every square inside grid, without guard columns
+    Mask white_pawns_;
+    Mask black_pawns_;
+
+    /// Bit index for given coordinates, which must be inside grid
+    std::size_t indexOf(const Coordinates& coords) const;
+
+    /// Bits offset to move a square by one toward given direction
+    int offsetFor(AxisType direction) const;
+
+public:
+    /**
+     * @brief Constructs masks with squares state for given grid
+     *
+     * @param grid Grid to copy squares state from
+     *
+     * @throws BadDimensions if grid has too many squares to fit inside masks
+     */
+    explicit Bitboard(const Grid& grid);
+
+    /**
+     * @brief Retrieves state of square at given coordinates
+     *
+     * @param coords Square coordinates, must be inside grid
+     *
+     * @returns Square state
+     */
+    Square at(const Coordinates& coords) const;
+
+    /**
+     * @brief Updates state of square at given coordinates
+     *
+     * @param coords Square coordinates, must be inside grid
+     * @param state New square state
+     */
+    void set(const Coordinates& coords, Square state);
+
+    /**
+     * @brief Retrieves mask with only given square set
+     *
+     * @param coords Square coordinates, must be inside grid
+     *
+     * @returns Mask for given square
+     */
+    Mask maskOf(const Coordinates& coords) const;
+
+    /**
+     * @brief Retrieves squares kept by pawns of given color
+     *
+     * @param color `Square::White` or `Square::Black`
+     *
+     * @returns Mask of every square with given color
+     *
+     * @throws BadSquareState if `color` is `Square::Free`
+     */
+    Mask pawnsOf(Square color) const;
+
+    /**
+     * @brief Retrieves squares which aren't kept by any pawn
+     *
+     * @returns Mask of every free square inside grid
+     */
+    Mask freeSquares() const;
+
+    /**
+     * @brief Moves each square of given mask by one toward given direction
+     *
+     * @param squares Mask to move squares from
+     * @param direction Direction to move squares toward
+     *
+     * @returns Mask of moved squares, without squares which were moved outside grid
+     */
+    Mask shifted(const Mask& squares, AxisType direction) const;
+
+    /**
+     * @brief Retrieves squares strictly between two squares linked by a diagonal or an orthogonal axis
+     *
+     * @param from First square of axis, must be inside grid
+     * @param to Last square of axis, must be inside grid and linked with `from` by an axis
+     *
+     * @returns Mask of squares between `from` and `to`, empty if they are neighbours
+     */
+    Mask between(const Coordinates& from, const Coordinates& to) const;
+};
+
+
+}
+
+
+#endif // RPT_MINIGAMES_SERVICES_BITBOARD_HPP
@@ -5,8 +5,16 @@
  * @file BoardGame.hpp
  */
 
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <Minigames-Services/Bitboard.hpp>
 #include <Minigames-Services/Grid.hpp>
 
 
@@ -50,6 +58,21 @@ struct SquareUpdate {
     }
 };
 
+/**
+ * @brief Represents a pawn move from one square to another, as passed to `BoardGame::play()`
+ */
+struct PawnMove {
+    /// Square containing the moved pawn before move
+    Coordinates from;
+    /// Square containing the moved pawn after move
+    Coordinates to;
+
+    /// Checks if `from` and `to` fields are both equals with corresponding fields for given `rhs`
+    constexpr bool operator==(const PawnMove& rhs) const {
+        return from == rhs.from && to == rhs.to;
+    }
+};
+
 /**
  * @brief Represents every update about a `Grid` after a call to `BoardGame::play()`
  */
@@ -73,15 +96,37 @@ struct GridUpdate {
  */
 class BoardGame {
 private:
+    /// Lines and columns offsets to move by one square toward each direction, in `AxisIterator::EVERY_DIRECTION` order
+    static constexpr std::array<Coordinates, 8> DIRECTION_STEPS_ {{
+            { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 }, { -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 }
+    }};
+    /// Orthogonal directions are the first ones inside `DIRECTION_STEPS_`
+    static constexpr std::size_t ORTHOGONAL_DIRECTIONS_COUNT_ { 4 };
+
     const unsigned int pawns_count_thershold;
 
     Player current_player_;
     bool has_moved_;
+    // Zobrist hash for grid squares and current round player
+    std::uint64_t position_hash_;
+    // Number of rounds which began with each position
+    std::unordered_map<std::uint64_t, unsigned int> positions_occurrences_;
+    // Position hash and `hasLegalMove()` default implementation result for this position at round beginning
+    mutable std::optional<std::pair<std::uint64_t, bool>> has_legal_move_cache_;
+
+    /// Updates given square inside `game_bitboard_` and position hash
+    void syncSquare(const Coordinates& square, Square state);
+
+    /// Constructs a game from an already built initial grid, see public constructors for parameters
+    BoardGame(const Grid& initial_grid, unsigned int white_pawns, unsigned int black_pawns,
+              unsigned int pawns_count_threshold);
 
 protected:
     /// Grid used to store and manipulate squares and pawns for board game, should be modified inside `play()` by
     /// move actions
     Grid game_grid_;
+    /// Pawns occupancy masks for `game_grid_`, kept up to date by calling `syncBitboard()` inside `play()`
+    Bitboard game_bitboard_;
     /// Number of pawns inside grid for white player
     unsigned int white_pawns_;
     /// Number of pawns inside grid for black player
@@ -96,12 +141,33 @@ protected:
      * @param pawns_count_threshold A minimum of pawns to have for a player. If current count is less than threshold,
      * opponent wins the game.
      *
-     * @throws BadDimensions if initial grid is invalid
+     * @throws BadDimensions if initial grid is invalid, or too large for `Bitboard`
      * @throws std::invalid_argument if `pawns_count_threshold == 0`
      */
     BoardGame(std::initializer_list<std::initializer_list<Square>> initial_grid,
               unsigned int white_pawns, unsigned int black_pawns, unsigned int pawns_count_threshold);
 
+    /**
+     * @brief Constructs a game with a specific initial layout, which dimensions are checked at compile time and which
+     * pawns are counted for each player
+     *
+     * @param initial_layout Grid state at the beginning of a new game
+     * @param pawns_count_threshold A minimum of pawns to have for a player. If current count is less than threshold,
+     * opponent wins the game.
+     *
+     * @throws std::invalid_argument if `pawns_count_threshold == 0`
+     */
+    template<std::size_t Lines, std::size_t Columns>
+    BoardGame(const GridLayout<Lines, Columns>& initial_layout, const unsigned int pawns_count_threshold) :
+    BoardGame { Grid { initial_layout }, countSquares(initial_layout, WHITE), countSquares(initial_layout, BLACK),
+                pawns_count_threshold } {
+
+        static_assert(Lines * (Columns + 1) <= Bitboard::MAX_SQUARES, "Grid is too large to fit inside bitboard");
+    }
+
+    /// Copies whole game state, only available for `clone()` implementations
+    BoardGame(const BoardGame&) = default;
+
     /**
      * @brief Enables moved flags, means that player into current round did at least one move, expected to be called
      * from `play()` implementation
@@ -109,18 +175,82 @@ protected:
     void moved();
 
     /**
-     * @brief Accessor for `moved()` flag
+     * @brief Copies every square modified by a move from `game_grid_` into `game_bitboard_` and updates position hash,
+     * expected to be called from `play()` implementation once grid has been modified
      *
-     * @returns `true` if `moved()` was called, `false` otherwise
+     * @param updates Squares modified by move
      */
-    bool hasMoved() const;
+    void syncBitboard(const GridUpdate& updates);
+
+    /**
+     * @brief Retrieves number of squares a pawn is moving through without throwing any exception
+     *
+     * @param move Move to get range for
+     * @param diagonals_allowed If `false`, only orthogonal axis are valid
+     *
+     * @returns Number of moves toward axis direction to go from origin to destination, or uninitialized if any square
+     * is outside grid or if there isn't any allowed axis linking them
+     */
+    std::optional<int> moveRange(const PawnMove& move, bool diagonals_allowed) const;
+
+    /**
+     * @brief Enumerates every legal move from squares kept by current player pawns, expected to be called from
+     * `legalMoves()` implementation
+     *
+     * Range and directions are known at compile time so candidates loops can be unrolled, and candidates are checked
+     * with `Game::isLegal()` without any virtual call.
+     *
+     * @tparam Game Game implementation calling this method, which `isLegal()` checks candidates
+     * @tparam MaxRange Maximum number of squares between a move origin and destination, destination included
+     * @tparam DiagonalsAllowed If `false`, only orthogonal moves are enumerated
+     *
+     * @returns Every move among enumerated ones for which `Game::isLegal()` returns `true`
+     */
+    template<typename Game, int MaxRange, bool DiagonalsAllowed>
+    std::vector<PawnMove> enumerateLegalMoves() const {
+        static_assert(std::is_base_of_v<BoardGame, Game>, "Moves can only be enumerated for a board game");
+        static_assert(MaxRange > 0, "Moves must have at least one square range");
+
+        constexpr std::size_t directions_count {
+            DiagonalsAllowed ? DIRECTION_STEPS_.size() : ORTHOGONAL_DIRECTIONS_COUNT_
+        };
+
+        const Game& game { static_cast<const Game&>(*this) };
+        const Square current_player_color { colorFor(current_player_) };
+
+        std::vector<PawnMove> legal_moves;
+        for (int line { 1 }; line <= game_grid_.linesCount(); line++) {
+            for (int column { 1 }; column <= game_grid_.columnsCount(); column++) {
+                const Coordinates from { line, column };
+
+                if (game_bitboard_.at(from) != current_player_color) // Only current player pawns can be moved
+                    continue;
+
+                for (std::size_t direction_i { 0 }; direction_i < directions_count; direction_i++) {
+                    const auto [line_step, column_step] { DIRECTION_STEPS_[direction_i] };
+
+                    // Each square toward direction is a candidate, until range or grid border is reached
+                    for (int range { 1 }; range <= MaxRange; range++) {
+                        const PawnMove candidate { from, { line + line_step * range, column + column_step * range } };
+
+                        if (!game_grid_.isInsideGrid(candidate.to))
+                            break;
+
+                        if (game.Game::isLegal(candidate))
+                            legal_moves.push_back(candidate);
+                    }
+                }
+            }
+        }
+
+        return legal_moves;
+    }
 
 public:
     /*
-     * Entity class semantic
+     * Entity class semantic, copied only with `clone()`
      */
 
-    BoardGame(const BoardGame&) = delete;
     BoardGame& operator=(const BoardGame&) = delete;
 
     bool operator==(const BoardGame&) const = delete;
@@ -132,6 +262,36 @@ public:
      */
     const Grid& grid() const;
 
+    /**
+     * @brief Copies this game in its current state, so moves can be played onto copy without modifying it
+     *
+     * @returns Independent game with same grid, round and moves state
+     */
+    virtual std::unique_ptr<BoardGame> clone() const = 0;
+
+    /**
+     * @brief Accessor for `moved()` flag
+     *
+     * @returns `true` if current round player did at least one move, `false` otherwise
+     */
+    bool hasMoved() const;
+
+    /**
+     * @brief Retrieves Zobrist hash for current position, updated incrementally with each move
+     *
+     * Two positions with same squares state and same current round player have the same hash.
+     *
+     * @returns 64 bits hash for grid squares and current round player
+     */
+    std::uint64_t positionHash() const;
+
+    /**
+     * @brief Retrieves number of rounds which began with current position, so repeated positions can be detected
+     *
+     * @returns Number of rounds which began with same `positionHash()`, initial round included
+     */
+    unsigned int positionOccurrences() const;
+
     /**
      * @brief Switch current player to other player, definitely terminating current player round
      *
@@ -178,6 +338,32 @@ public:
      */
     virtual bool isRoundTerminated() const = 0;
 
+    /**
+     * @brief Checks if given move can be played by current player, without modifying game
+     *
+     * @param move Move to check for
+     *
+     * @returns `true` if `play()` would succeed with given move, `false` otherwise
+     */
+    virtual bool isLegal(const PawnMove& move) const = 0;
+
+    /**
+     * @brief Retrieves every move which can be played by current player, without modifying game
+     *
+     * @returns Every move for which `isLegal()` returns `true`
+     */
+    virtual std::vector<PawnMove> legalMoves() const = 0;
+
+    /**
+     * @brief Checks if current player can play any move
+     *
+     * Default behavior checks if `legalMoves()` isn't empty, caching result for current position at round beginning.
+     * Implementations can override it with a cheaper check.
+     *
+     * @returns `true` if `legalMoves()` isn't empty, `false` otherwise
+     */
+    virtual bool hasLegalMove() const;
+
     /**
      * @brief Plays given move for current player
      *
@@ -0,0 +1,150 @@
+#ifndef RPT_MINIGAMES_SERVICES_BOARDGAMESEARCH_HPP
+#define RPT_MINIGAMES_SERVICES_BOARDGAMESEARCH_HPP
+
+/**
+ * @file BoardGameSearch.hpp
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <Minigames-Services/BoardGame.hpp>
+
+
+namespace MinigamesServices {
+
+
+/// Thrown by `BoardGameSearch::bestAction()` if current round player can neither move nor end its round
+class NoActionAvailable : public std::logic_error {
+public:
+    /// Constructs error with basic error message
+    NoActionAvailable() : std::logic_error { "Current round player cannot perform any action" } {}
+};
+
+
+/**
+ * @brief Looks for best action of current round player inside a `BoardGame` with an alpha-beta search bounded by time
+ *
+ * Search deepens iteratively until given time budget is exhausted, then retrieves best action found by last
+ * completed depth. Actions are moves enumerated with `BoardGame::legalMoves()`, plus ending round if current player
+ * already moved and can chain other moves. Each action is played onto a `BoardGame::clone()`.
+ *
+ * Positions at a round beginning are stored inside a transposition table keyed with `BoardGame::positionHash()`, so
+ * they are searched once for each depth and their best action is tried first at next depth. Table is kept between
+ * searches, as next round positions are often already stored.
+ *
+ * @note Not thread-safe, an instance must be used by one search at a time. A search running on another thread can be
+ * cancelled with an atomic flag.
+ *
+ * @author ThisALV, https://github.com/ThisALV/
+ */
+class BoardGameSearch {
+public:
+    /// Move to play, or uninitialized to end current round
+    using Action = std::optional<PawnMove>;
+
+    /// Score for a won position, other scores are pawns count differences below it
+    static constexpr int VICTORY_SCORE { 1000000 };
+
+private:
+    /// Search stops as soon as a depth is reached, even if there is time left
+    static constexpr unsigned int MAX_DEPTH { 64 };
+    /// Table is cleared when it reaches this size, so memory usage stays bounded
+    static constexpr std::size_t MAX_TRANSPOSITIONS { 1 << 20 };
+
+    /// How stored score bounds real score for a position
+    enum struct Bound {
+        Exact, Lower, Upper
+    };
+
+    /// Result of a previous search at a round beginning
+    struct Transposition {
+        unsigned int depth;
+        int score;
+        Bound bound;
+        Action bestAction;
+    };
+
+    std::unordered_map<std::uint64_t, Transposition> transpositions_;
+    std::chrono::steady_clock::time_point deadline_;
+    // Flag checked with deadline, if any
+    const std::atomic_bool* cancelled_;
+    std::size_t visited_nodes_;
+    unsigned int completed_depth_;
+
+    /// Every action current round player can perform, uninitialized for ending round
+    static std::vector<Action> actionsFor(const BoardGame& game);
+
+    /// Plays given action onto a copy of given game, going to next round if played move terminated it
+    static std::unique_ptr<BoardGame> played(const BoardGame& game, const Action& action);
+
+    /// Score for current round player, pawns count difference with opponent
+    static int evaluate(const BoardGame& game);
+
+    /// Moves given action to actions front, if it is one of them
+    static void tryFirst(std::vector<Action>& actions, const Action& first_action);
+
+    /// Counts a visited node, then throws if search was cancelled or if deadline has been reached, only checking clock
+    /// once every few nodes
+    void visitNode();
+
+    /// Retrieves score of given action for current round player of given game
+    int actionScore(const BoardGame& game, const Action& action, unsigned int depth, int alpha, int beta);
+
+    /// Negamax with alpha-beta pruning, retrieves score for current round player
+    int negamax(const BoardGame& game, unsigned int depth, int alpha, int beta);
+
+    /// Retrieves best action with its score among given root actions, searched up to given depth
+    std::pair<Action, int> searchRoot(const BoardGame& game, const std::vector<Action>& actions, unsigned int depth);
+
+public:
+    /// Constructs search with an empty transpositions table
+    BoardGameSearch();
+
+    /*
+     * Entity class semantic
+     */
+
+    BoardGameSearch(const BoardGameSearch&) = delete;
+    BoardGameSearch& operator=(const BoardGameSearch&) = delete;
+
+    /**
+     * @brief Searches for best action of current round player until given time budget is exhausted
+     *
+     * @param game Game to search action for, not modified
+     * @param time_budget Maximum search duration, exceeded by at most a few nodes visit
+     * @param cancelled Optional flag which stops search like an exhausted time budget as soon as it is set, must outlive
+     * search
+     *
+     * @returns Best action found, or first available action if no depth could be completed
+     *
+     * @throws NoActionAvailable if current round player cannot perform any action
+     */
+    Action bestAction(const BoardGame& game, std::chrono::milliseconds time_budget,
+                      const std::atomic_bool* cancelled = nullptr);
+
+    /**
+     * @brief Retrieves number of positions visited by last search
+     *
+     * @returns Visited nodes count, root included
+     */
+    std::size_t visitedNodes() const;
+
+    /**
+     * @brief Retrieves deepest depth fully searched by last search
+     *
+     * @returns Number of actions ahead returned action was chosen with, 0 if no depth could be completed
+     */
+    unsigned int completedDepth() const;
+};
+
+
+}
+
+
+#endif // RPT_MINIGAMES_SERVICES_BOARDGAMESEARCH_HPP
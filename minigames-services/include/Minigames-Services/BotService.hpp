@@ -0,0 +1,148 @@
+#ifndef RPT_MINIGAMES_SERVICES_BOTSERVICE_HPP
+#define RPT_MINIGAMES_SERVICES_BOTSERVICE_HPP
+
+/**
+ * @file BotService.hpp
+ */
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <Minigames-Services/BoardGameSearch.hpp>
+#include <Minigames-Services/LobbyService.hpp>
+#include <Minigames-Services/MinigameService.hpp>
+#include <RpT-Core/Service.hpp>
+#include <RpT-Utils/TextProtocolParser.hpp>
+
+
+namespace MinigamesServices {
+
+
+/**
+ * @brief Computer-controlled opponent which can take an available `LobbyService` seat, so an actor waiting for a
+ * second player can play `MinigameService` game
+ *
+ * Bot is a virtual actor with UID `BOT_ACTOR`, it is never inside any room so events targeting it alone are never
+ * sent. Once seated, it is ready for each game, and every action it performs is submitted to Lobby and Minigame
+ * services as regular SR commands.
+ *
+ * At bot round, a `BoardGameSearch` looks for its next action during time budget inside a task submitted to
+ * `Executor` workers, so its loop is never blocked. Once task completed, found action is submitted.
+ *
+ * Protocol:
+ *
+ * Service Requests:
+ * - `JOIN`: bot takes an available seat inside Lobby
+ * - `LEAVE`: bot leaves its seat
+ *
+ * Service Events:
+ * - `JOINED <uid>`: bot took a seat inside Lobby as actor with given UID
+ * - `LEFT`: bot no longer has a seat inside Lobby
+ *
+ * @note User must call `play()` after each handled input event, and must call `leave()` before assigning an actor to
+ * Lobby if bot is seated.
+ *
+ * @author ThisALV, https://github.com/ThisALV/
+ */
+class BotService : public RpT::Core::Service {
+public:
+    /// UID reserved for bot actor inside Lobby and Minigame services
+    static constexpr std::uint64_t BOT_ACTOR { std::numeric_limits<std::uint64_t>::max() };
+
+private:
+    /// An operation requested to the bot
+    enum struct Command {
+        Join, Leave
+    };
+
+    /// Parses a command for bot
+    class CommandParser : public RpT::Utils::TextProtocolParser {
+    private:
+        Command parsed_command_;
+
+    public:
+        /// Parses given SR command
+        explicit CommandParser(std::string_view bot_command);
+
+        /// `Command` requested by given SR command
+        Command command() const;
+    };
+
+    /// Search reused from one round to the next, shared with task running it as it is owned by worker thread
+    struct SharedSearch {
+        BoardGameSearch search;
+        std::atomic_bool cancelled;
+    };
+
+    LobbyService& lobby_;
+    MinigameService& minigame_;
+    bool seated_;
+    const std::chrono::milliseconds search_budget_;
+    std::shared_ptr<SharedSearch> shared_search_;
+    // Search task has been submitted and isn't completed yet, so shared search isn't used by another one meanwhile
+    bool searching_;
+    // Position hash when pending search began, so action isn't played if game changed meanwhile
+    std::uint64_t searched_position_;
+
+    /// Stops pending search, if any, so its action will not be played
+    void cancelSearch();
+
+    /// Submits given search action to Minigame, if search wasn't cancelled and game is still at searched position
+    void submitAction(const BoardGameSearch::Action& action);
+
+public:
+    /**
+     * @brief Constructs bot which isn't seated yet
+     *
+     * @param run_context Context used by every server `Service`
+     * @param lobby Lobby into which bot takes a seat
+     * @param minigame Minigame bot plays, run by given Lobby
+     * @param search_budget_ms Time spent to search each action
+     */
+    BotService(RpT::Core::ServiceContext& run_context, LobbyService& lobby, MinigameService& minigame,
+               std::size_t search_budget_ms);
+
+    /// Cancels pending search so worker thread doesn't keep running it
+    ~BotService();
+
+    /// Retrieves service name "Bot"
+    std::string_view name() const override;
+
+    /**
+     * @brief Checks if bot currently has a seat inside Lobby
+     *
+     * @returns `true` if `join()` was called without a later call to `leave()`, `false` otherwise
+     */
+    bool isSeated() const;
+
+    /**
+     * @brief Takes an available seat inside Lobby
+     *
+     * @throws BadPlayersState if bot is already seated, or if there isn't any available seat
+     */
+    void join();
+
+    /**
+     * @brief Leaves bot seat inside Lobby, stopping game if it is running as it would never end
+     *
+     * @throws BadPlayersState if bot isn't seated
+     */
+    void leave();
+
+    /**
+     * @brief Makes bot progress: gets ready if Lobby is waiting, or begins to search an action if it is bot round
+     *
+     * Does nothing if bot isn't seated or if a search task is still pending, even if it was cancelled.
+     */
+    void play();
+
+    /// Handles JOIN and LEAVE commands, from any actor
+    RpT::Utils::HandlingResult handleRequestCommand(std::uint64_t actor, std::string_view sr_command_data) override;
+};
+
+
+}
+
+
+#endif // RPT_MINIGAMES_SERVICES_BOTSERVICE_HPP
@@ -5,6 +5,7 @@
  * @file Canaries.hpp
  */
 
+#include <array>
 #include <Minigames-Services/AxisIterator.hpp>
 #include <Minigames-Services/BoardGame.hpp>
 
@@ -15,21 +16,48 @@ namespace MinigamesServices {
 /// Implements RpT-Minigame "Canaries"
 class Canaries : public BoardGame {
 private:
-    static constexpr std::initializer_list<std::initializer_list<Square>> INITIAL_GRID_ {
+    /// Moves reach at most 2 squares, for eats
+    static constexpr int MAX_RANGE_ { 2 };
+
+    static constexpr GridLayout<4, 4> INITIAL_LAYOUT_ {{
             { BLACK, BLACK, BLACK, BLACK },
             { BLACK, BLACK, BLACK, BLACK },
             { WHITE, WHITE, WHITE, WHITE },
             { WHITE, WHITE, WHITE, WHITE }
-    };
+    }};
+
+    static_assert(countSquares(INITIAL_LAYOUT_, WHITE) == 8 && countSquares(INITIAL_LAYOUT_, BLACK) == 8);
 
     /// Tries to perform given move as normal, saving grid modifications into given reference argument
     void playNormal(GridUpdate& updates, AxisIterator move);
     /// Tries to perform given move as eat, saving grid modifications into given reference argument
     void playEat(GridUpdate& updates, AxisIterator move);
 
+    /// One mask of move origins for each orthogonal direction, in `AxisIterator::EVERY_ORTHOGONAL_DIRECTION` order
+    using OriginsMasks = std::array<Bitboard::Mask, 4>;
+
+    /// Number of moves, normal or eat, which can be performed by white player
+    unsigned int white_mobility_;
+    /// Number of moves, normal or eat, which can be performed by black player
+    unsigned int black_mobility_;
+
+    /// Retrieves squares from which given player can perform a move toward given direction
+    Bitboard::Mask movableOrigins(Player player, AxisType direction) const;
+
+    /// Counts moves which can be performed by given player from given origins for each direction
+    unsigned int mobilityFrom(Player player, const OriginsMasks& origins) const;
+
+    /// Updates mobility of each player for moves whose squares were modified, must be called before grid
+    /// modifications are synced into bitboard
+    void syncMobility(const GridUpdate& updates);
+
     /// Checks if any move, normal or eat, can be performed by given player
     bool isBlocked(Player player) const;
 
+protected:
+    /// Counts moves which can be performed by each player on the whole grid, required if grid was reset
+    void recountMobility();
+
 public:
     /// Constructs Canaries minigame with game-specific initial configuration (8 pawns for each color/player)
     Canaries();
@@ -40,6 +68,18 @@ public:
     /// Round is terminated if player as move, no chaining available in this game
     bool isRoundTerminated() const override;
 
+    /// Orthogonal normal move to a free neighbour, or jump over an own pawn to eat an opponent pawn
+    bool isLegal(const PawnMove& move) const override;
+
+    /// Copies game, mobility counters included
+    std::unique_ptr<BoardGame> clone() const override;
+
+    /// Moves of 1 or 2 squares toward any orthogonal direction
+    std::vector<PawnMove> legalMoves() const override;
+
+    /// Checks for current player mobility, without enumerating moves
+    bool hasLegalMove() const override;
+
     /// Two available moves: normal or jump, then jumps chaining
     GridUpdate play(const Coordinates &from, const Coordinates &to) override;
 };
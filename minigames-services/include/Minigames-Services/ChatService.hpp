@@ -5,8 +5,12 @@
  * @file ChatService.hpp
  */
 
+#include <array>
+#include <vector>
 #include <RpT-Core/Service.hpp>
 #include <RpT-Core/Timer.hpp>
+#include <RpT-Utils/FlatHashMap.hpp>
+#include <RpT-Utils/LoadMonitor.hpp>
 
 
 /// Contains RpT Minigames project relative services, like chat, Açores, Bermudes and Canaries
@@ -22,30 +26,131 @@ namespace MinigamesServices {
  */
 std::string trim(std::string_view chat_message);
 
+/**
+ * @brief Retrieves trimmed part of given string view without copying it
+ *
+ * @param chat_message Sent chat message
+ *
+ * @returns View to chars which aren't beginning or trailing whitespaces
+ */
+std::string_view trimmed(std::string_view chat_message);
+
 
 /**
- * @brief Basic messaging service with actors which implements a cooldown (minimal delay) between each sent message
+ * @brief Basic messaging service with actors which implements a per-actor cooldown (minimal delay) between each sent
+ * message
+ *
+ * Cooldowns are kept inside a wheel of `COOLDOWN_SLOTS` slots driven by a single timer, each tick lasting a slot
+ * fraction of cooldown, so tracking many actors doesn't require one timer for each of them. Actor can send a new
+ * message once wheel went back to slot it was put inside, so cooldown is rounded down to tick granularity. A tick might
+ * be late by up to half its duration, so wheels of many rooms tick with a single wakeup.
+ *
+ * Messages are emitted immediately until a threshold of messages sent during current tick is reached. Past it, traffic
+ * is high and any other one is kept and emitted with next tick inside a single `MESSAGES` event, so chat doesn't flood
+ * clients with one event per message.
+ *
+ * Recent messages are kept inside a bounded history which is sent inside a single `HISTORY` event to actors joining
+ * late.
+ *
+ * Service Events:
+ * - `MESSAGE_FROM <uid> <message>`: Actor sent given message
+ * - `MESSAGES [<uid> <length> <message>]...`: Actors sent these messages during previous tick
+ * - `HISTORY [<uid> <length> <message>]...`: Recent messages, from oldest to newest, sent to joining actor only
+ *
+ * Length prefixes count message bytes, as messages might contain whitespaces. Every event is best-effort, so clients
+ * receive game events first and chat is dropped first for congested clients.
+ *
+ * If a load monitor is given, chat is the first service to be shed: every message is rejected while main loop is
+ * overloaded, so running minigames keep their latency.
+ *
+ * @note `flush()` must be called after each input event so cooldowns wheel keeps going on.
  */
 class ChatService : public RpT::Core::Service {
+public:
+    /// Number of ticks for each cooldown
+    static constexpr std::size_t COOLDOWN_SLOTS { 8 };
+    /// Number of messages kept inside history if none is given
+    static constexpr std::size_t DEFAULT_HISTORY_SIZE { 32 };
+    /// Number of messages emitted immediately during each tick if none is given
+    static constexpr std::size_t DEFAULT_BATCHING_THRESHOLD { 4 };
+
 private:
+    /// Message kept inside history
+    struct HistoryEntry {
+        std::uint64_t actor;
+        std::string message;
+    };
+
+    /// Appends given message with its author and length prefix to given event command
+    static void appendMessage(std::string& event_command, std::uint64_t actor, std::string_view message);
+
     const std::string cooldown_msg_;
+    // Triggers at each cooldowns wheel tick, running while any actor is cooling down
     RpT::Core::Timer cooldown_;
+    const RpT::Utils::LoadMonitor* load_;
+    // Actors put inside each wheel slot, released once wheel is back to their slot
+    std::array<std::vector<std::uint64_t>, COOLDOWN_SLOTS> cooldown_slots_;
+    std::size_t current_slot_;
+    // Actors cooling down, with slot each of them was put inside
+    RpT::Utils::FlatHashMap<std::uint64_t, std::size_t> cooling_actors_;
+    // Messages emitted immediately during each tick, next ones being batched
+    const std::size_t batching_threshold_;
+    // Messages sent during current tick
+    std::size_t tick_messages_;
+    // MESSAGES event command for messages kept until next tick, empty if there isn't any
+    std::string batched_messages_;
+    // Ring buffer, next entry to be overwritten is the oldest one
+    std::vector<HistoryEntry> history_;
+    std::size_t history_next_;
+    std::size_t history_size_;
+
+    /// Saves given message into history, overwriting oldest one if full
+    void keepInHistory(std::uint64_t actor, std::string_view message);
 
 public:
     /**
-     * @brief Initializes service inside given context with given delay between each message
+     * @brief Initializes service inside given context with given delay between each message of the same actor
      *
      * @param run_context Context containing server services, providing events & timers ID
-     * @param cooldown_ms Delay to wait before sending next message when a message is sent
+     * @param cooldown_ms Delay to wait before sending next message when a message is sent by an actor
+     * @param load_monitor Main loop load, messages being rejected while it is overloaded, if any
+     * @param history_size Number of recent messages sent to late joiners
+     * @param batching_threshold Number of messages sent during a tick before next ones are batched until next tick
      */
-    explicit ChatService(RpT::Core::ServiceContext& run_context, std::size_t cooldown_ms);
+    ChatService(RpT::Core::ServiceContext& run_context, std::size_t cooldown_ms,
+                const RpT::Utils::LoadMonitor* load_monitor = nullptr,
+                std::size_t history_size = DEFAULT_HISTORY_SIZE,
+                std::size_t batching_threshold = DEFAULT_BATCHING_THRESHOLD);
 
     /// Retrieves service name `Chat`
     std::string_view name() const override;
 
     /**
-     * @brief Sends given Service Request command data as message if at least one of its chars isn't a whitespace and
-     * if previous message was send since more than `ChatService` cooldown milliseconds
+     * @brief Checks if given actor has to wait before sending another message
+     *
+     * @param actor UID for actor to check cooldown for
+     *
+     * @returns `true` if actor sent a message less than cooldown milliseconds ago
+     */
+    bool isCoolingDown(std::uint64_t actor) const;
+
+    /**
+     * @brief If cooldowns wheel ticked, releases actors inside reached slot and emits messages kept during previous
+     * tick, then begins next tick if any actor is still cooling down
+     */
+    void flush();
+
+    /**
+     * @brief Emits `HISTORY` event with recent messages to given actor, if any message was sent
+     *
+     * @param actor UID for actor joining late
+     */
+    void sendHistory(std::uint64_t actor);
+
+    /**
+     * @brief Sends given Service Request command data as message if at least one of its chars isn't a whitespace, if
+     * actor previous message was send since more than `ChatService` cooldown milliseconds and if server isn't
+     * overloaded
      *
      * @param actor UID for actor who's sending a message
      * @param sr_command_data Raw message to be send
@@ -5,7 +5,10 @@
  * @file Grid.hpp
  */
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <stdexcept>
 #include <vector>
@@ -95,17 +98,64 @@ constexpr Square WHITE { Square::White };
 constexpr Square BLACK { Square::Black };
 
 
+/**
+ * @brief Squares of a grid with dimensions known at compile time, line after line, so game-specific initial
+ * configurations can be checked by `static_assert`
+ *
+ * @tparam Lines Number of lines
+ * @tparam Columns Number of squares inside each line
+ */
+template<std::size_t Lines, std::size_t Columns>
+using GridLayout = std::array<std::array<Square, Columns>, Lines>;
+
+/**
+ * @brief Counts squares with given state inside a layout, usable at compile time
+ *
+ * @param layout Layout to count squares from
+ * @param state State of counted squares
+ *
+ * @returns Number of squares inside `layout` which are `state`
+ */
+template<std::size_t Lines, std::size_t Columns>
+constexpr unsigned int countSquares(const GridLayout<Lines, Columns>& layout, const Square state) {
+    unsigned int count { 0 };
+    for (const std::array<Square, Columns>& line : layout) {
+        for (const Square square : line) {
+            if (square == state)
+                count++;
+        }
+    }
+
+    return count;
+}
+
+
 /**
  * @brief Abstraction for a grid of squares which may contain pawns, used by minigames to make their game board
  *
  * A grid can be initialized with a specific configuration, provides access to specific axis to work easier into
  * diagonal and orthogonal bases and to check easily distance between two pawns.
  *
+ * Squares are stored contiguously inside instance, line after line, with a fixed stride of `MAX_DIMENSION` squares
+ * per line. Subscript operator checks coordinates at the API boundary, `unchecked()` is provided for game rules and
+ * `AxisIterator` which already know coordinates are inside grid.
+ *
  * @author ThisALV, https://github.com/ThisALV/
  */
 class Grid {
+public:
+    /// Maximum number of lines or columns for a grid
+    static constexpr int MAX_DIMENSION { 26 };
+
 private:
-    std::vector<std::vector<Square>> squares_matrix_;
+    std::array<Square, MAX_DIMENSION * MAX_DIMENSION> squares_;
+    int lines_count_;
+    int columns_count_;
+
+    /// Index inside `squares_` for given coordinates, which must be inside grid
+    static constexpr std::size_t indexOf(const Coordinates& coords) {
+        return static_cast<std::size_t>((coords.line - 1) * MAX_DIMENSION + (coords.column - 1));
+    }
 
 public:
     /**
@@ -119,6 +169,36 @@ public:
      */
     Grid(std::initializer_list<std::initializer_list<Square>> initial_configuration);
 
+    /**
+     * @brief Constructs a grid containing squares with state given by argument, dimensions being checked at compile
+     * time instead of throwing `BadDimensions`
+     *
+     * @param initial_layout Lines of squares with a specific state
+     */
+    template<std::size_t Lines, std::size_t Columns>
+    explicit Grid(const GridLayout<Lines, Columns>& initial_layout) :
+    squares_ {}, lines_count_ { static_cast<int>(Lines) }, columns_count_ { static_cast<int>(Columns) } {
+        static_assert(Lines > 0 && Columns > 0, "Zero dimension for height or width isn't allowed");
+        static_assert(Lines <= MAX_DIMENSION && Columns <= MAX_DIMENSION, "A grid dimension cannot exceed maximum");
+
+        int line_number { 1 };
+        // Copies each line squares at the beginning of its stride
+        for (const std::array<Square, Columns>& line : initial_layout) {
+            std::copy(line.begin(), line.end(), squares_.begin() + indexOf({ line_number, 1 }));
+            line_number++;
+        }
+    }
+
+    /// Retrieves number of lines inside grid
+    int linesCount() const {
+        return lines_count_;
+    }
+
+    /// Retrieves number of columns inside grid
+    int columnsCount() const {
+        return columns_count_;
+    }
+
     /**
      * @brief Checks if a square with given coordinates exists inside current grid
      *
@@ -126,7 +206,10 @@ public:
      *
      * @returns `true` if square exists inside grid, `false` otherwise
      */
-    bool isInsideGrid(const Coordinates& coords) const;
+    bool isInsideGrid(const Coordinates& coords) const {
+        // Checks if line number if not above lines count, same for column number
+        return coords.line > 0 && coords.line <= lines_count_ && coords.column > 0 && coords.column <= columns_count_;
+    }
 
     /**
      * @brief Retrieves square at given coordinates inside grid
@@ -141,6 +224,26 @@ public:
 
     /// Same as non-const subscript operator, but with constness guarantee
     const Square& operator[](const Coordinates& coords) const;
+
+    /**
+     * @brief Retrieves square at given coordinates inside grid without any bounds checking
+     *
+     * @param coords Coordinates to retrieve a square from, must be inside grid
+     *
+     * @returns Reference to `Square` inside grid at given position
+     */
+    Square& unchecked(const Coordinates& coords) {
+        assert(isInsideGrid(coords));
+
+        return squares_[indexOf(coords)];
+    }
+
+    /// Same as non-const `unchecked()`, but with constness guarantee
+    const Square& unchecked(const Coordinates& coords) const {
+        assert(isInsideGrid(coords));
+
+        return squares_[indexOf(coords)];
+    }
 };
 
 
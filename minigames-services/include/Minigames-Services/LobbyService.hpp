@@ -8,6 +8,7 @@
 #include <Minigames-Services/MinigameService.hpp>
 #include <RpT-Core/Service.hpp>
 #include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/ServiceCoroutine.hpp>
 #include <RpT-Utils/TextProtocolParser.hpp>
 
 
@@ -29,7 +30,7 @@ public:
  * There are 2 available actor slots: 1 for the white player, 1 for the black player.
  * When an new actor is registered, it is assigned to an available slot, if any.
  * As soon as both players are ready, the underlying timer is started, then at its time out RpT-Minigame session can
- * start with the 2 assigned actors to players.
+ * start with the 2 assigned actors to players. Time out might be late by up to `COUNTDOWN_SLACK_MS`.
  *
  * The players list is identical to the server actors list. Each logged in actor is a member inside Lobby.
  *
@@ -37,6 +38,7 @@ public:
  *
  * Service Requests:
  * - READY: used to toggle Ready/Not ready player state
+ * - SNAPSHOT: used by any actor, typically a reconnecting one, to receive current Lobby state in a single event
  *
  * Service Events:
  * - `READY_PLAYER <uid>`: player for this actor is ready to start
@@ -45,12 +47,17 @@ public:
  * - `END_COUNTDOWN`: Countdown initiated by BEGIN_COUNTDOWN is cancelled
  * - `PLAYING`: A game is now running
  * - `WAITING`: Game was stopped, Lobby is now waiting for actors to be ready. State for every player is reset.
+ * - `SNAPSHOT <WAITING|COUNTDOWN|PLAYING> [ready_uid]...`: Lobby state and ready players, sent to requesting actor only
  *
  * @note User must ensures that `notifyWaiting()` is called as soon as underlying minigame is stopped.
  *
  * @author ThisALV, https://github.com/ThisALV/
  */
 class LobbyService : public RpT::Core::Service {
+public:
+    /// Time starting countdown is allowed to end late, so countdowns of many rooms end with a single wakeup
+    static constexpr std::size_t COUNTDOWN_SLACK_MS { 100 };
+
 private:
     /// Represent an assigned actor and its current state inside the %Lobby
     struct Entrant {
@@ -58,11 +65,17 @@ private:
         bool isReady;
     };
 
-    /// Parses received command to check if it matches with the only available command which is `READY`
+    /// Parses received command to check if it matches with an available command, `READY` or `SNAPSHOT`
     class CommandParser : public RpT::Utils::TextProtocolParser {
+    private:
+        bool snapshot_;
+
     public:
         /// Parses given SR command
         explicit CommandParser(std::string_view lobby_command);
+
+        /// Checks if parsed command is `SNAPSHOT` instead of `READY`
+        bool isSnapshot() const;
     };
 
     MinigameService& minigame_session_;
@@ -70,10 +83,18 @@ private:
     std::optional<Entrant> black_player_actor_;
     unsigned int ready_players_;
     RpT::Core::Timer starting_countdown_;
+    // Runs countdown then starts minigame, cancelled if a player is no longer ready
+    RpT::Core::ServiceCoroutine starting_flow_;
 
     /// Retrieves actor associated with given UID
     std::optional<Entrant>& playerFor(std::uint64_t actor_uid);
 
+    /// Emits SNAPSHOT event with current Lobby state, sent to given actor only
+    void emitSnapshot(std::uint64_t actor);
+
+    /// Syncs players with beginning countdown, awaits it, then starts minigame with assigned players
+    void startingFlow();
+
     /// If it has begun, starting countdown will be stopped and players will be synced with that countdown cancellation
     void cancelCountdown();
 
@@ -114,7 +135,18 @@ public:
      */
     void removeActor(std::uint64_t actor_uid);
 
-    /// Handles READY command from actors to start the minigame, only READY command is available
+    /**
+     * @brief Checks if player assigned with given actor is ready to start
+     *
+     * @param actor_uid UID of actor to check ready state for
+     *
+     * @returns `true` if actor toggled READY state on since last game start, `false` otherwise
+     *
+     * @throws BadPlayersState if given UID isn't assigned to any player
+     */
+    bool isReady(std::uint64_t actor_uid) const;
+
+    /// Handles READY command from actors to start the minigame, and SNAPSHOT command from any actor
     RpT::Utils::HandlingResult handleRequestCommand(std::uint64_t actor, std::string_view sr_command_data) override;
 
     /**
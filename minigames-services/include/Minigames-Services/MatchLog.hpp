@@ -0,0 +1,241 @@
+#ifndef RPT_MINIGAMES_SERVICES_MATCHLOG_HPP
+#define RPT_MINIGAMES_SERVICES_MATCHLOG_HPP
+
+/**
+ * @file MatchLog.hpp
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <Minigames-Services/Grid.hpp>
+
+
+namespace MinigamesServices {
+
+
+/**
+ * @brief Thrown by `MatchLogWriter` and `MatchLogReader` if log can't be opened, or if it is ill-formed or truncated
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class BadMatchLog : public std::runtime_error {
+public:
+    /**
+     * @brief Constructs exception with custom error message
+     *
+     * @param reason Why log couldn't be used
+     */
+    explicit BadMatchLog(const std::string& reason) : std::runtime_error { "Match log: " + reason } {}
+};
+
+
+/// How a logged match ended
+enum struct MatchResult : std::uint8_t {
+    Stopped, WhiteVictory, BlackVictory
+};
+
+
+/**
+ * @brief Action played during a logged match: a pawn move, or current player ending its round
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct MatchAction {
+    /// `true` if player ended its round, coordinates are then meaningless
+    bool roundEnd;
+    /// Square with moved pawn
+    Coordinates from;
+    /// Square pawn was moved into
+    Coordinates to;
+};
+
+
+/**
+ * @brief Finished match, from its `START` to its result
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct LoggedMatch {
+    /// UID for actor playing as white
+    std::uint64_t whiteActor;
+    /// UID for actor playing as black
+    std::uint64_t blackActor;
+    /// Milliseconds since Unix epoch when match started
+    std::uint64_t startedAt;
+    /// Every successfully played action, in order
+    std::vector<MatchAction> actions;
+    /// How match ended
+    MatchResult result;
+};
+
+
+/**
+ * @brief Binary format for match logs, appended by `MatchLogWriter` and scanned by `MatchLogReader`
+ *
+ * Log begins with `MAGIC` then `VERSION` byte. Each match is then appended as an unsigned LEB128 varint for record
+ * length, so readers can skip matches without decoding them, followed by record:
+ * - varints for white actor UID, black actor UID and start time in milliseconds since Unix epoch
+ * - varint actions count, then each action as `0` byte followed by varints for origin line, origin column,
+ * destination line and destination column for a move, or `1` byte for a round end
+ * - result byte, `MatchResult` value
+ *
+ * Coordinates are always positive, as only moves accepted by board game are logged.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct MatchLogFormat {
+    /// Bytes every log begins with
+    static constexpr std::string_view MAGIC { "RPTMATCH" };
+    /// Format version, incremented at each incompatible change
+    static constexpr std::uint8_t VERSION { 1 };
+};
+
+
+/**
+ * @brief Appends finished matches into a log file from a background writer thread, see `MatchLogFormat`
+ *
+ * Matches are encoded by appending thread, then queued so disk is only accessed by writer thread. Log file is flushed
+ * each time queue has been emptied, so a complete record is never left inside writer buffers for long. Matches can be
+ * appended by many threads, so every room can share same writer.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MatchLogWriter {
+private:
+    std::ofstream output_;
+
+    std::mutex queue_mutex_;
+    // Notified when a match is queued or writer is stopping
+    std::condition_variable queue_filled_;
+    std::vector<std::string> queued_records_;
+    bool stopping_;
+
+    std::atomic<std::uint64_t> appended_matches_;
+
+    // Started last, once log file has been opened
+    std::thread writer_;
+
+    /// Writer thread loop, writes queued records until writer is stopping and queue is empty
+    void writeQueue();
+
+public:
+    /**
+     * @brief Opens given log file to append matches at its end, writing header if it is a new log, then starts
+     * writer thread
+     *
+     * @param log_path Path for log file, created if it doesn't exist
+     *
+     * @throws BadMatchLog if file can't be opened, or if it isn't a log with current format version
+     */
+    explicit MatchLogWriter(const std::string& log_path);
+
+    /// Writes remaining queued matches, then joins writer thread
+    ~MatchLogWriter();
+
+    /*
+     * Entity class semantic
+     */
+
+    MatchLogWriter(const MatchLogWriter&) = delete;
+    MatchLogWriter& operator=(const MatchLogWriter&) = delete;
+
+    /**
+     * @brief Encodes given match and queues it for writer thread, without waiting for disk
+     *
+     * @param match Finished match to log
+     */
+    void append(const LoggedMatch& match);
+
+    /**
+     * @brief Retrieves number of matches appended since construction
+     *
+     * @returns Appended matches count, including ones which might not be written yet
+     */
+    std::uint64_t appendedMatches() const;
+};
+
+
+/**
+ * @brief Scans matches stored inside a log file mapped into memory, see `MatchLogFormat`
+ *
+ * Records are decoded straight from mapped file, so large logs are read without copying them into process buffers.
+ * Matches appended after reader construction aren't seen.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MatchLogReader {
+private:
+    boost::interprocess::file_mapping log_file_;
+    boost::interprocess::mapped_region mapped_log_;
+    std::string_view log_;
+    // Beginning of next record
+    std::size_t position_;
+
+    /// Reads a single byte from given record, throws if record is truncated
+    static std::uint8_t readByte(std::string_view record, std::size_t& position);
+
+    /// Reads an unsigned LEB128 varint from given record, throws if it is truncated or doesn't fit into 64 bits
+    static std::uint64_t readVarint(std::string_view record, std::size_t& position);
+
+    /// Reads a varint for a board coordinate, throws if it doesn't fit into an int
+    static int readCoordinate(std::string_view record, std::size_t& position);
+
+    /// Reads next record length then retrieves record, throws if it is truncated
+    std::string_view nextRecord();
+
+public:
+    /**
+     * @brief Maps given log file into memory then checks its header
+     *
+     * @param log_path Path for log file to scan
+     *
+     * @throws BadMatchLog if file can't be mapped, if header is missing or if log was written with another format
+     * version
+     */
+    explicit MatchLogReader(const std::string& log_path);
+
+    /*
+     * Entity class semantic
+     */
+
+    MatchLogReader(const MatchLogReader&) = delete;
+    MatchLogReader& operator=(const MatchLogReader&) = delete;
+
+    /**
+     * @brief Decodes next match into given one
+     *
+     * Given match actions storage is reused, so scanning many matches doesn't allocate for each of them.
+     *
+     * @param match Match to overwrite with next logged one
+     *
+     * @returns `true` if a match was read, `false` if end of log has been reached
+     *
+     * @throws BadMatchLog if record is ill-formed or truncated
+     */
+    bool next(LoggedMatch& match);
+
+    /**
+     * @brief Skips next match without decoding it
+     *
+     * @returns `true` if a match was skipped, `false` if end of log has been reached
+     *
+     * @throws BadMatchLog if record is truncated
+     */
+    bool skip();
+};
+
+
+}
+
+
+#endif // RPT_MINIGAMES_SERVICES_MATCHLOG_HPP
@@ -0,0 +1,49 @@
+#ifndef RPT_MINIGAMES_SERVICES_MATCHREPLAY_HPP
+#define RPT_MINIGAMES_SERVICES_MATCHREPLAY_HPP
+
+/**
+ * @file MatchReplay.hpp
+ */
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <Minigames-Services/BoardGame.hpp>
+#include <Minigames-Services/MatchLog.hpp>
+
+
+namespace MinigamesServices {
+
+
+/**
+ * @brief Difference between a logged match and the way rules engine plays it again
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct ReplayDivergence {
+    /// Index for diverging action, or actions count if every action was replayed but match ended differently
+    std::size_t action;
+    /// What rules engine did instead of logged match
+    std::string reason;
+};
+
+
+/**
+ * @brief Plays every action of given logged match into given game, as `MinigameService` did while match was running,
+ * then checks that game ended with logged result
+ *
+ * A round is terminated by replay itself once a move leaves current player without anything to do, as service did
+ * without logging any round end action.
+ *
+ * @param game Newly constructed game, for same minigame logged match was played with
+ * @param match Logged match to replay
+ *
+ * @returns First divergence found, or uninitialized if game ended exactly as logged
+ */
+std::optional<ReplayDivergence> replayMatch(BoardGame& game, const LoggedMatch& match);
+
+
+}
+
+
+#endif // RPT_MINIGAMES_SERVICES_MATCHREPLAY_HPP
@@ -0,0 +1,90 @@
+#ifndef RPT_MINIGAMES_SERVICES_MINIGAMEROOM_HPP
+#define RPT_MINIGAMES_SERVICES_MINIGAMEROOM_HPP
+
+/**
+ * @file MinigameRoom.hpp
+ */
+
+#include <Minigames-Services/BotService.hpp>
+#include <Minigames-Services/ChatService.hpp>
+#include <Minigames-Services/LobbyService.hpp>
+#include <Minigames-Services/MinigameService.hpp>
+#include <RpT-Core/Room.hpp>
+#include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/Timer.hpp>
+#include <RpT-Utils/LoggingContext.hpp>
+
+
+namespace MinigamesServices {
+
+
+/**
+ * @brief Room for 2 players and optional spectators, with its own Chat, Minigame, Lobby and Bot services
+ *
+ * Actors receive chat history and are assigned to lobby when they join room, then removed from lobby when they leave
+ * it. Once both seats are taken, next actors join as spectators: they receive room-wide events batched every
+ * spectators delay, so broadcasting moves to players doesn't get slower as audience grows. A spectator takes seat of a
+ * player which left room. If a player leaves during a game, game is stopped as it would never end. Lobby is notified
+ * back to waiting state once game stopped.
+ *
+ * An actor alone inside room can ask bot to take the other lobby seat. Bot gives its seat back as soon as another
+ * actor joins room, or as soon as its opponent leaves room.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MinigameRoom : public RpT::Core::Room {
+private:
+    RpT::Core::ServiceContext services_context_;
+    ChatService chat_svc_;
+    MinigameService minigame_svc_;
+    LobbyService lobby_svc_;
+    BotService bot_svc_;
+    // Sends room-wide events kept for spectators once it triggers
+    RpT::Core::Timer spectators_flush_;
+    // Previous routine call MinigameService state
+    bool game_was_running_;
+
+public:
+    /// Players inside a minigame
+    static constexpr std::size_t PLAYERS { 2 };
+
+    /**
+     * @brief Constructs empty room running its own services
+     *
+     * @param id Room unique ID
+     * @param timers_tokens_provider Context shared by every room so timers tokens are unique across them
+     * @param game_provider Provides minigame played when both players are ready
+     * @param logging_context Context for room SER Protocol logging
+     * @param chat_cooldown_ms Minimum delay between 2 messages sent by same actor
+     * @param lobby_countdown_ms Delay before minigame starts once both players are ready
+     * @param bot_search_ms Time spent by bot to search each of its actions
+     * @param load_monitor Main loop load, chat being throttled while it is overloaded, if any
+     * @param spectators Actors which can watch game besides players
+     * @param spectators_delay_ms Delay between spectators events batches
+     * @param match_log Log shared by every room to append finished matches into, if any
+     */
+    MinigameRoom(std::uint64_t id, RpT::Core::ServiceContext& timers_tokens_provider, BoardGameProvider game_provider,
+                 RpT::Utils::LoggingContext& logging_context, std::size_t chat_cooldown_ms = 2000,
+                 std::size_t lobby_countdown_ms = 5000, std::size_t bot_search_ms = 1000,
+                 const RpT::Utils::LoadMonitor* load_monitor = nullptr, std::size_t spectators = 0,
+                 std::size_t spectators_delay_ms = 100, MatchLogWriter* match_log = nullptr);
+
+    /// Sends chat history to actor, then assigns it to a lobby player slot, taking it from bot if required, or makes it
+    /// a spectator if both seats are taken
+    void actorJoined(const RpT::Core::JoinedEvent& event) override;
+
+    /// Removes actor from lobby with bot if seated, stopping game if it is running, then seats a spectator if any
+    void actorLeft(const RpT::Core::LeftEvent& event) override;
+
+    /// Begins spectators delay, events kept meanwhile being flushed once it triggers
+    void spectatorsBacklogged() override;
+
+    /// Notifies lobby if game stopped since previous call, flushes chat, then makes bot progress
+    void routine() override;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVICES_MINIGAMEROOM_HPP
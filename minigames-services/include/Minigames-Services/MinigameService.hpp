@@ -7,7 +7,9 @@
 
 #include <functional>
 #include <memory>
+#include <set>
 #include <Minigames-Services/BoardGame.hpp>
+#include <Minigames-Services/MatchLog.hpp>
 #include <RpT-Core/Service.hpp>
 #include <RpT-Utils/TextProtocolParser.hpp>
 
@@ -37,6 +39,17 @@ using BoardGameProvider = std::function<std::unique_ptr<BoardGame>()>;
  * Each connected actor will be assigned to a `Player` (black or white) when starting the game using the `start()`
  * method.
  *
+ * Any actor can send `GRID_DELTA` request at any moment to receive each move as one `GRID_DELTA` event, containing
+ * move coordinates followed by each updated square, instead of `SQUARE_STATE` events followed by a `MOVED` event.
+ *
+ * While a game is running, any actor can send `SNAPSHOT` request to receive a single
+ * `SNAPSHOT <white_uid> <black_uid> <round> <white_pawns> <black_pawns> <lines> <columns> <squares>` event, where
+ * squares are listed line after line as one `F`, `W` or `B` char each. Reconnecting clients rebuild board from it
+ * instead of replaying every move.
+ *
+ * If a `MatchLogWriter` is given, every played move and round end is kept while game is running, and whole match is
+ * appended into log once game ends by a victory or is stopped.
+ *
  * @author ThisALV, https://github.com/ThisALV/
  */
 class MinigameService : public RpT::Core::Service {
@@ -57,9 +70,6 @@ private:
 
         /// `Action` requested by given SR command
         Action action() const;
-
-        /// Retrieves unparsed coordinates given as arguments for `MOVE` command
-        std::string_view moveCommand() const;
     };
 
     /// Parses a player movement (a pawn from a square to another)
@@ -67,10 +77,14 @@ private:
     private:
         Coordinates parsed_from_;
         Coordinates parsed_to_;
+        bool valid_;
 
     public:
-        /// Parses given Move action
-        explicit MoveActionParser(std::string_view move_action_command);
+        /// Parses coordinates following given `MOVE` action without throwing, `isValid()` must be checked first
+        explicit MoveActionParser(const MinigameRequestParser& move_request);
+
+        /// Checks if 4 integer coordinates were parsed
+        bool isValid() const;
 
         /// Parsed coordinates for square with pawn to move
         Coordinates from() const;
@@ -84,12 +98,31 @@ private:
     std::unique_ptr<BoardGame> current_game_;
     std::uint64_t white_player_actor_;
     std::uint64_t black_player_actor_;
+    // Actors receiving moves as GRID_DELTA events
+    std::set<std::uint64_t> grid_delta_actors_;
+    MatchLogWriter* const match_log_;
+    // Running game actions kept for match log, if any
+    LoggedMatch logged_match_;
+    // Running game hasn't been appended into match log yet
+    bool match_pending_;
+
+    /// Appends running game into match log, if any, with given result
+    void logMatch(MatchResult result);
+
+    /// Emits SQUARE_STATE and MOVED events for given move, sent to given actors only if any
+    void emitSquareStates(const GridUpdate& updates, std::initializer_list<std::uint64_t> targets);
+
+    /// Emits GRID_DELTA event for given move, sent to given actors only if any
+    void emitGridDelta(const GridUpdate& updates, std::initializer_list<std::uint64_t> targets);
+
+    /// Emits SNAPSHOT event for running game, sent to given actor only
+    void emitSnapshot(std::uint64_t actor);
 
     /// Goes to next round for board game and emits ROUND_FOR %Service Event
     void terminateRound();
 
     /// Handler for move action command
-    void handleMove(std::string_view move_command_args);
+    void handleMove(const MinigameRequestParser& move_request);
 
 public:
     /**
@@ -97,8 +130,10 @@ public:
      *
      * @param run_context Context into which Services run
      * @param rpt_minigame_provider Function which return new RpT-Minigame to run with %Service
+     * @param match_log Log to append finished matches into, if any, must outlive service
      */
-    MinigameService(RpT::Core::ServiceContext& run_context, BoardGameProvider rpt_minigame_provider);
+    MinigameService(RpT::Core::ServiceContext& run_context, BoardGameProvider rpt_minigame_provider,
+                    MatchLogWriter* match_log = nullptr);
 
     /// Retrieves service name "Minigame"
     std::string_view name() const override;
@@ -128,6 +163,31 @@ public:
      */
     bool isStarted() const;
 
+    /**
+     * @brief Accessor for running board game, so its state can be read without playing
+     *
+     * @returns Immutable board game session started by `start()`
+     *
+     * @throws BadBoardGameState if game isn't running
+     */
+    const BoardGame& game() const;
+
+    /**
+     * @brief Retrieves actor assigned to current round player
+     *
+     * @returns UID of actor which is expected to play
+     *
+     * @throws BadBoardGameState if game isn't running
+     */
+    std::uint64_t currentActor() const;
+
+    /**
+     * @brief Forgets any capability enabled by given actor, expected to be called when actor leaves
+     *
+     * @param actor UID for actor to forget
+     */
+    void forgetActor(std::uint64_t actor);
+
     /// Handles play from current player to make board game progress
     RpT::Utils::HandlingResult handleRequestCommand(std::uint64_t actor, std::string_view sr_command_data) override;
 };
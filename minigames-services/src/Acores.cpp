@@ -6,7 +6,7 @@
 namespace MinigamesServices {
 
 
-Acores::Acores() : BoardGame { INITIAL_GRID_, 12, 12, 1 } {}
+Acores::Acores() : BoardGame { INITIAL_LAYOUT_, 1 } {}
 
 void Acores::playNormal(GridUpdate& updates, AxisIterator move) {
     if (last_move_ == Move::Jump) // Checks for a jumps chaining to not have begun
@@ -18,29 +18,34 @@ void Acores::playNormal(GridUpdate& updates, AxisIterator move) {
         throw BadSquareState { "Movement destination is kept by another pawn" };
 
     // Applies movement modifications to grid
-    game_grid_[updates.moveOrigin] = Square::Free; // Target pawn no longer into origin square
+    game_grid_.unchecked(updates.moveOrigin) = Square::Free; // Target pawn no longer into origin square
     destination = colorFor(currentRound()); // It appears into destination square
 
     // No jumps chaining available after a normal move
     last_move_ = Move::Normal;
 }
 
-void Acores::playJump(GridUpdate& updates, AxisIterator move) {
+void Acores::playJump(GridUpdate& updates) {
     const Square current_player_color { colorFor(currentRound()) };
+    const auto [from_line, from_column] { updates.moveOrigin };
+    const auto [to_line, to_column] { updates.moveDestination };
 
-    Square& skipped_square { move.moveForward() }; // Tries to move a first time on the square to jump
-    const Coordinates skipped_square_position { move.currentPosition() }; // Saved for GridUpdate updated squares
+    // Pawn moves 2 squares along its axis, so jumped square is the one in the middle
+    const Coordinates skipped_square_position { (from_line + to_line) / 2, (from_column + to_column) / 2 };
 
-    if (skipped_square != flip(current_player_color)) // Must jump (or eat) an opponent pawn
+    // Must jump (or eat) an opponent pawn
+    if (game_bitboard_.at(skipped_square_position) != flip(current_player_color))
         throw BadSquareState { "Jumped square must contains a pawn of opponent color" };
 
-    if (move.moveForward() != Square::Free) // Pawn which is jumping must land on a free square
+    // Pawn which is jumping must land on a free square
+    if (game_bitboard_.at(updates.moveDestination) != Square::Free)
         throw BadSquareState { "Movement destination is kept by another pawn" };
 
     // Applies movement modifications to grid
-    game_grid_[updates.moveOrigin] = Square::Free; // Target pawn no longer into origin square
-    skipped_square = Square::Free; // Pawn inside square between two players is eaten
-    game_grid_[updates.moveDestination] = current_player_color; // It appears into destination square
+    game_grid_.unchecked(updates.moveOrigin) = Square::Free; // Target pawn no longer into origin square
+    // Pawn inside square between two players is eaten
+    game_grid_.unchecked(skipped_square_position) = Square::Free;
+    game_grid_.unchecked(updates.moveDestination) = current_player_color; // It appears into destination square
 
     // One pawn from opponent is removed from board
     if (currentRound() == Player::White)
@@ -55,6 +60,37 @@ void Acores::playJump(GridUpdate& updates, AxisIterator move) {
     last_move_ = Move::Jump;
 }
 
+bool Acores::isLegal(const PawnMove& move) const {
+    const Square current_player_color { colorFor(currentRound()) };
+    const std::optional<int> move_range { moveRange(move, true) };
+
+    if (!move_range.has_value() || game_bitboard_.at(move.from) != current_player_color)
+        return false;
+
+    switch (*move_range) {
+    case 1: // Normal move unavailable once a jumps chaining has begun
+        return last_move_ != Move::Jump && game_bitboard_.at(move.to) == Square::Free;
+    case 2: { // Jump over the square in the middle
+        const Coordinates skipped_square_position {
+            (move.from.line + move.to.line) / 2, (move.from.column + move.to.column) / 2
+        };
+
+        return game_bitboard_.at(skipped_square_position) == flip(current_player_color) &&
+               game_bitboard_.at(move.to) == Square::Free;
+    }
+    default:
+        return false;
+    }
+}
+
+std::unique_ptr<BoardGame> Acores::clone() const {
+    return std::make_unique<Acores>(*this);
+}
+
+std::vector<PawnMove> Acores::legalMoves() const {
+    return enumerateLegalMoves<Acores, MAX_RANGE_, true>();
+}
+
 Player Acores::nextRound() {
     // New player hasn't do anything yet, no last move for him
     last_move_.reset();
@@ -76,7 +112,7 @@ GridUpdate Acores::play(const Coordinates& from, const Coordinates& to) {
     AxisIterator move { game_grid_, from, to };
 
     // Origin square must contains a pawn of current player color
-    if (game_grid_[from] != colorFor(currentRound()))
+    if (game_grid_.unchecked(from) != colorFor(currentRound()))
         throw BadSquareState { "Action target square must be kept by a pawn of current player" };
 
     const int move_range { -move.distanceFromDestination() }; // Destination not passed, returned distance is negative
@@ -86,12 +122,13 @@ GridUpdate Acores::play(const Coordinates& from, const Coordinates& to) {
         playNormal(updates, std::move(move));
         break;
     case 2: // Distance of 2: jumps & eats move
-        playJump(updates, std::move(move));
+        playJump(updates);
         break;
     default:
         throw BadCoordinates { "Selected squares are too far, no available move" };
     }
 
+    syncBitboard(updates);
     // At this point, a move is performed: round can now be terminated
     moved();
 
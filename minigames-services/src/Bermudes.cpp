@@ -4,37 +4,49 @@
 namespace MinigamesServices {
 
 
-void Bermudes::checkFreeTrajectory(AxisIterator& move_trajectory, const int until) {
-    Square next { move_trajectory.moveForward() };
-    // Iterates over each square between moved pawn and its destination
-    while (move_trajectory.distanceFromDestination() != until) {
-        if (next != Square::Free) { // Each squares between destination
-            const auto [current_line, current_col] { move_trajectory.currentPosition() };
-
-            throw BadSquareState {
-                    "Square at " + std::to_string(current_line) + std::to_string(current_col) +
-                    "inside trajectory isn't empty"
-            };
-        }
-
-        // Go to next square for checking its state
-        next = move_trajectory.moveForward();
-    }
+namespace {
+
+
+/// Retrieves -1, 0 or 1 step toward given delta direction
+int stepToward(const int delta) {
+    return (delta > 0) - (delta < 0);
+}
+
+
 }
 
-Bermudes::Bermudes() : BoardGame { INITIAL_GRID_, 27, 27, 6 } {}
 
-void Bermudes::playElimination(GridUpdate& updates, AxisIterator move) {
+Coordinates Bermudes::flippedSquare(const Coordinates& from, const Coordinates& to) {
+    // One square backward from destination toward origin
+    return { to.line - stepToward(to.line - from.line), to.column - stepToward(to.column - from.column) };
+}
+
+bool Bermudes::isFreeTrajectory(const Coordinates& from, const Coordinates& to) const {
+    const Bitboard::Mask free_squares { game_bitboard_.freeSquares() };
+    const Bitboard::Mask trajectory { game_bitboard_.between(from, to) };
+
+    // Every square inside trajectory must be free
+    return (trajectory & ~free_squares).none();
+}
+
+void Bermudes::checkFreeTrajectory(const Coordinates& from, const Coordinates& to) const {
+    if (!isFreeTrajectory(from, to))
+        throw BadSquareState { "Trajectory between your pawn and its destination isn't empty" };
+}
+
+Bermudes::Bermudes() : BoardGame { INITIAL_LAYOUT_, 6 } {}
+
+void Bermudes::playElimination(GridUpdate& updates, const int move_range) {
     const Player current_player { currentRound() };
 
-    if (-move.distanceFromDestination() < 2) // Checks to have at least one square between origin and destination
+    if (move_range < 2) // Checks to have at least one square between origin and destination
         throw BadCoordinates { "At least 1 square required between your pawn and the eliminated one" };
 
-    checkFreeTrajectory(move);
+    checkFreeTrajectory(updates.moveOrigin, updates.moveDestination);
 
     // Applies modifications to grid
-    game_grid_[updates.moveOrigin] = Square::Free; // Selected pawn moves out of its square
-    game_grid_[updates.moveDestination] = colorFor(current_player); // To replace pawn inside destination
+    game_grid_.unchecked(updates.moveOrigin) = Square::Free; // Selected pawn moves out of its square
+    game_grid_.unchecked(updates.moveDestination) = colorFor(current_player); // To replace pawn inside destination
 
     // One pawn of opponent was removed from grid
     if (current_player == Player::White)
@@ -46,24 +58,26 @@ void Bermudes::playElimination(GridUpdate& updates, AxisIterator move) {
     last_move_ = Move::Elimination;
 }
 
-void Bermudes::playFlip(GridUpdate& updates, AxisIterator move) {
+void Bermudes::playFlip(GridUpdate& updates, const int move_range) {
     const Player current_player { currentRound() };
     const Square current_player_color { colorFor(current_player) };
 
-    checkFreeTrajectory(move, -1); // Every squares between the square before which is flipped must be empty
+    if (move_range < 2) // Checks to have a square to flip between origin and destination
+        throw BadCoordinates { "At least 1 square required between your pawn and its destination" };
+
+    // Saved for later grid updates notification
+    const Coordinates flipped_position { flippedSquare(updates.moveOrigin, updates.moveDestination) };
 
-    // Saves position of flipped square for later grid updates notification
-    const Coordinates flipped_position { move.currentPosition() };
-    // Flipped square reached, get its current state through iterator current position (because it's already there)
-    Square& flipped { game_grid_[flipped_position] };
-    // One square after the flipped square is the movement destination
-    Square& destination { move.moveForward() };
+    checkFreeTrajectory(updates.moveOrigin, flipped_position); // Every squares before the flipped one must be empty
+
+    Square& flipped { game_grid_.unchecked(flipped_position) };
+    Square& destination { game_grid_.unchecked(updates.moveDestination) };
 
     if (flipped != flip(current_player_color)) // Checks for flipped square to belong to the opponent
         throw BadSquareState { "Flipped square isn't kept by an opponent pawn" };
 
     // Applies modifications to grid
-    game_grid_[updates.moveOrigin] = Square::Free; // Selected pawn moved from its previous square
+    game_grid_.unchecked(updates.moveOrigin) = Square::Free; // Selected pawn moved from its previous square
     flipped = current_player_color; // Flips square of opponent
     destination = current_player_color;
 
@@ -83,6 +97,35 @@ void Bermudes::playFlip(GridUpdate& updates, AxisIterator move) {
     last_move_ = Move::Flip;
 }
 
+bool Bermudes::isLegal(const PawnMove& move) const {
+    const Square current_player_color { colorFor(currentRound()) };
+    const std::optional<int> move_range { moveRange(move, true) };
+
+    // Both moves require at least one square between origin and destination
+    if (!move_range.has_value() || *move_range < 2 || game_bitboard_.at(move.from) != current_player_color)
+        return false;
+
+    const Square destination_state { game_bitboard_.at(move.to) };
+    if (destination_state == Square::Free) { // Flips-take
+        const Coordinates flipped_position { flippedSquare(move.from, move.to) };
+
+        return isFreeTrajectory(move.from, flipped_position) &&
+               game_bitboard_.at(flipped_position) == flip(current_player_color);
+    } else if (destination_state == flip(current_player_color)) { // Elimination-take
+        return isFreeTrajectory(move.from, move.to);
+    } else {
+        return false;
+    }
+}
+
+std::unique_ptr<BoardGame> Bermudes::clone() const {
+    return std::make_unique<Bermudes>(*this);
+}
+
+std::vector<PawnMove> Bermudes::legalMoves() const {
+    return enumerateLegalMoves<Bermudes, DIMENSION_ - 1, true>();
+}
+
 Player Bermudes::nextRound() {
     // New player hasn't do anything yet, no last move for him
     last_move_.reset();
@@ -106,18 +149,21 @@ GridUpdate Bermudes::play(const Coordinates& from, const Coordinates& to) {
     AxisIterator move { game_grid_, from, to };
 
     // Origin square must contains a pawn of current player color
-    if (game_grid_[from] != current_player_color)
+    if (game_grid_.unchecked(from) != current_player_color)
         throw BadSquareState { "Action target square must be kept by a pawn of current player" };
 
+    const int move_range { -move.distanceFromDestination() }; // Destination not passed, returned distance is negative
+
     // Depending on opponent pawn into destination square or not, a move is choosen
-    const Square destination_state { game_grid_[to] };
+    const Square destination_state { game_grid_.unchecked(to) };
     if (destination_state == Square::Free) // Destination empty, jumps over previous square to take by flip
-        playFlip(updates, std::move(move));
+        playFlip(updates, move_range);
     else if (destination_state == flip(current_player_color)) // Destination busy, jumps into destination to eliminate
-        playElimination(updates, std::move(move));
+        playElimination(updates, move_range);
     else
         throw BadSquareState { "Movement destination cannot be one of your pawns" };
 
+    syncBitboard(updates);
     // At this point, a move is performed: round can now be terminated
     moved();
 
@@ -0,0 +1,125 @@
+#include <Minigames-Services/Bitboard.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+
+namespace MinigamesServices {
+
+
+namespace {
+
+
+/// Retrieves -1, 0 or 1 depending on given integer sign
+int sign(const int x) {
+    return (x > 0) - (x < 0);
+}
+
+
+}
+
+
+std::size_t Bitboard::indexOf(const Coordinates& coords) const {
+    assert(coords.line > 0 && coords.line <= lines_count_ && coords.column > 0 && coords.column <= columns_count_);
+
+    return static_cast<std::size_t>((coords.line - 1) * stride_ + (coords.column - 1));
+}
+
+int Bitboard::offsetFor(const AxisType direction) const {
+    int offset { 0 };
+
+    // Moving toward next line means moving for a whole line bits, guard column included
+    if (hasFlagOf(direction, AxisType::Up))
+        offset -= stride_;
+    else if (hasFlagOf(direction, AxisType::Down))
+        offset += stride_;
+
+    if (hasFlagOf(direction, AxisType::Left))
+        offset--;
+    else if (hasFlagOf(direction, AxisType::Right))
+        offset++;
+
+    return offset;
+}
+
+Bitboard::Bitboard(const Grid& grid) :
+lines_count_ { grid.linesCount() }, columns_count_ { grid.columnsCount() }, stride_ { columns_count_ + 1 } {
+    if (static_cast<std::size_t>(lines_count_ * stride_) > MAX_SQUARES)
+        throw BadDimensions { "Grid is too large to fit inside bitboard" };
+
+    for (int line { 1 }; line <= lines_count_; line++) {
+        for (int column { 1 }; column <= columns_count_; column++) {
+            const Coordinates square { line, column };
+
+            squares_.set(indexOf(square));
+            set(square, grid.unchecked(square));
+        }
+    }
+}
+
+Square Bitboard::at(const Coordinates& coords) const {
+    const std::size_t i { indexOf(coords) };
+
+    if (white_pawns_.test(i))
+        return Square::White;
+    else if (black_pawns_.test(i))
+        return Square::Black;
+    else
+        return Square::Free;
+}
+
+void Bitboard::set(const Coordinates& coords, const Square state) {
+    const std::size_t i { indexOf(coords) };
+
+    white_pawns_.set(i, state == Square::White);
+    black_pawns_.set(i, state == Square::Black);
+}
+
+Bitboard::Mask Bitboard::maskOf(const Coordinates& coords) const {
+    return Mask {}.set(indexOf(coords));
+}
+
+Bitboard::Mask Bitboard::pawnsOf(const Square color) const {
+    if (color == Square::Free)
+        throw BadSquareState { "Only squares kept by a player have pawns" };
+
+    return color == Square::White ? white_pawns_ : black_pawns_;
+}
+
+Bitboard::Mask Bitboard::freeSquares() const {
+    return squares_ & ~(white_pawns_ | black_pawns_);
+}
+
+Bitboard::Mask Bitboard::shifted(const Mask& squares, const AxisType direction) const {
+    const int offset { offsetFor(direction) };
+
+    // Squares moved onto a guard column or past the last line are no longer inside grid
+    if (offset > 0)
+        return (squares << static_cast<std::size_t>(offset)) & squares_;
+    else
+        return (squares >> static_cast<std::size_t>(-offset)) & squares_;
+}
+
+Bitboard::Mask Bitboard::between(const Coordinates& from, const Coordinates& to) const {
+    const int line_offset { to.line - from.line };
+    const int column_offset { to.column - from.column };
+
+    // Must be an orthogonal or diagonal axis
+    assert(line_offset == 0 || column_offset == 0 || std::abs(line_offset) == std::abs(column_offset));
+
+    // Bits offset to move from one square of axis to the next one
+    const int step { sign(line_offset) * stride_ + sign(column_offset) };
+    const int squares_between { std::max(std::abs(line_offset), std::abs(column_offset)) - 1 };
+
+    Mask axis_squares;
+    int i { static_cast<int>(indexOf(from)) };
+    for (int square { 0 }; square < squares_between; square++) {
+        i += step;
+        axis_squares.set(static_cast<std::size_t>(i));
+    }
+
+    return axis_squares;
+}
+
+
+}
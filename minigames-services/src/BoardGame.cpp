@@ -1,29 +1,144 @@
 #include <Minigames-Services/BoardGame.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <Minigames-Services/AxisIterator.hpp>
+
 
 namespace MinigamesServices {
 
 
+namespace {
+
+
+/// Random keys XORed into position hash for each pawn inside grid, and for black player round
+struct ZobristKeys {
+    std::array<std::uint64_t, Grid::MAX_DIMENSION * Grid::MAX_DIMENSION * 2> pawns;
+    std::uint64_t black_round;
+};
+
+/// SplitMix64 generator, so keys are generated at compile-time and are the same for each run
+constexpr std::uint64_t nextRandomKey(std::uint64_t& state) {
+    state += 0x9e3779b97f4a7c15;
+
+    std::uint64_t key { state };
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111eb;
+
+    return key ^ (key >> 31);
+}
+
+constexpr ZobristKeys generateZobristKeys() {
+    ZobristKeys keys {};
+    std::uint64_t state { 0 };
+
+    for (std::uint64_t& pawn_key : keys.pawns)
+        pawn_key = nextRandomKey(state);
+
+    keys.black_round = nextRandomKey(state);
+
+    return keys;
+}
+
+constexpr ZobristKeys ZOBRIST_KEYS { generateZobristKeys() };
+
+/// Retrieves key for given square state at given coordinates, free squares don't modify hash
+std::uint64_t zobristKey(const Coordinates& square, const Square state) {
+    if (state == Square::Free)
+        return 0;
+
+    const std::size_t square_i {
+        static_cast<std::size_t>((square.line - 1) * Grid::MAX_DIMENSION + (square.column - 1))
+    };
+
+    return ZOBRIST_KEYS.pawns[square_i * 2 + (state == Square::Black ? 1 : 0)];
+}
+
+
+}
+
+
 BoardGame::BoardGame(std::initializer_list<std::initializer_list<Square>> initial_grid, unsigned int white_pawns,
                      unsigned int black_pawns, unsigned int pawns_count_threshold) :
+BoardGame { Grid { initial_grid }, white_pawns, black_pawns, pawns_count_threshold } {}
+
+BoardGame::BoardGame(const Grid& initial_grid, const unsigned int white_pawns, const unsigned int black_pawns,
+                     const unsigned int pawns_count_threshold) :
 pawns_count_thershold { pawns_count_threshold }, current_player_ { Player::White }, has_moved_ { false },
-game_grid_ { initial_grid }, white_pawns_ { white_pawns }, black_pawns_ { black_pawns } {
+position_hash_ { 0 }, game_grid_ { initial_grid }, game_bitboard_ { game_grid_ }, white_pawns_ { white_pawns },
+black_pawns_ { black_pawns } {
     if (pawns_count_threshold == 0) // A minimal value for pawns count cannot be 0, or it would never be reached
         throw std::invalid_argument { "Pawns count loose threshold must be positive strict" };
+
+    // Initial position hash contains every pawn of initial grid, white player round doesn't have any key
+    for (int line { 1 }; line <= game_grid_.linesCount(); line++) {
+        for (int column { 1 }; column <= game_grid_.columnsCount(); column++) {
+            const Coordinates square { line, column };
+
+            position_hash_ ^= zobristKey(square, game_grid_.unchecked(square));
+        }
+    }
+
+    positions_occurrences_[position_hash_]++;
 }
 
 const Grid& BoardGame::grid() const {
     return game_grid_;
 }
 
+std::uint64_t BoardGame::positionHash() const {
+    return position_hash_;
+}
+
+unsigned int BoardGame::positionOccurrences() const {
+    const auto occurrences { positions_occurrences_.find(position_hash_) };
+
+    return occurrences == positions_occurrences_.end() ? 0 : occurrences->second;
+}
+
 void BoardGame::moved() {
     has_moved_ = true;
 }
 
+void BoardGame::syncSquare(const Coordinates& square, const Square state) {
+    // Previous state is still inside bitboard, its key is removed from hash and replaced by new state key
+    position_hash_ ^= zobristKey(square, game_bitboard_.at(square)) ^ zobristKey(square, state);
+
+    game_bitboard_.set(square, state);
+}
+
+void BoardGame::syncBitboard(const GridUpdate& updates) {
+    syncSquare(updates.moveOrigin, game_grid_.unchecked(updates.moveOrigin));
+    syncSquare(updates.moveDestination, game_grid_.unchecked(updates.moveDestination));
+
+    for (const SquareUpdate& additional_update : updates.updatedSquares)
+        syncSquare(additional_update.square, additional_update.updatedState);
+}
+
 bool BoardGame::hasMoved() const {
     return has_moved_;
 }
 
+std::optional<int> BoardGame::moveRange(const PawnMove& move, const bool diagonals_allowed) const {
+    const auto [from, to] { move };
+
+    if (!game_grid_.isInsideGrid(from) || !game_grid_.isInsideGrid(to))
+        return {};
+
+    const int lines_offset { std::abs(to.line - from.line) };
+    const int columns_offset { std::abs(to.column - from.column) };
+
+    // Exactly one of the two offsets is null for an orthogonal axis, none of them for a diagonal axis
+    const bool orthogonal { (lines_offset == 0) != (columns_offset == 0) };
+    const bool diagonal { lines_offset == columns_offset && lines_offset != 0 };
+
+    if (!orthogonal && !(diagonal && diagonals_allowed))
+        return {};
+
+    return std::max(lines_offset, columns_offset);
+}
+
 Player BoardGame::nextRound() {
     if (!has_moved_) // Checks for at one move to have been done, as skipping turn isn't allowed
         throw MoveRequired {};
@@ -36,6 +151,10 @@ Player BoardGame::nextRound() {
     else
         current_player_ = Player::White;
 
+    // Round player is part of position
+    position_hash_ ^= ZOBRIST_KEYS.black_round;
+    positions_occurrences_[position_hash_]++;
+
     // Retrieves it
     return current_player_;
 }
@@ -52,6 +171,17 @@ unsigned int BoardGame::pawnsFor(const Player pawns_owner) const {
         return black_pawns_;
 }
 
+bool BoardGame::hasLegalMove() const {
+    // Moves already played inside current round might change available moves, so only round beginning is cached
+    if (has_moved_)
+        return !legalMoves().empty();
+
+    if (!has_legal_move_cache_.has_value() || has_legal_move_cache_->first != position_hash_)
+        has_legal_move_cache_.emplace(position_hash_, !legalMoves().empty());
+
+    return has_legal_move_cache_->second;
+}
+
 std::optional<Player> BoardGame::victoryFor() const {
     // If a has less then threshold count of pawns inside grid, his opponent won
     if (white_pawns_ < pawns_count_thershold)
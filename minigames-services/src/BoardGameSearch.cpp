@@ -0,0 +1,234 @@
+#include <Minigames-Services/BoardGameSearch.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+
+namespace MinigamesServices {
+
+
+namespace {
+
+
+/// Thrown inside search when deadline has been reached or search was cancelled, so every pending node is unwound
+struct SearchTimeout {};
+
+/// Number of visited nodes between two clock checks
+constexpr std::size_t CLOCK_CHECK_INTERVAL { 256 };
+
+
+}
+
+
+std::vector<BoardGameSearch::Action> BoardGameSearch::actionsFor(const BoardGame& game) {
+    const std::vector<PawnMove> legal_moves { game.legalMoves() };
+    std::vector<Action> actions { legal_moves.begin(), legal_moves.end() };
+
+    // Round can be ended once player moved, if it wasn't already terminated by its last move
+    if (game.hasMoved())
+        actions.emplace_back();
+
+    return actions;
+}
+
+std::unique_ptr<BoardGame> BoardGameSearch::played(const BoardGame& game, const Action& action) {
+    std::unique_ptr<BoardGame> next_position { game.clone() };
+
+    if (!action.has_value()) { // Ends round
+        next_position->nextRound();
+    } else {
+        next_position->play(action->from, action->to);
+
+        // Like `MinigameService`, goes to next round as soon as a move terminated it, unless game is over
+        if (!next_position->victoryFor().has_value() && next_position->isRoundTerminated())
+            next_position->nextRound();
+    }
+
+    return next_position;
+}
+
+int BoardGameSearch::evaluate(const BoardGame& game) {
+    const Player current_player { game.currentRound() };
+    const Player opponent { current_player == Player::White ? Player::Black : Player::White };
+
+    return static_cast<int>(game.pawnsFor(current_player)) - static_cast<int>(game.pawnsFor(opponent));
+}
+
+void BoardGameSearch::tryFirst(std::vector<Action>& actions, const Action& first_action) {
+    const auto first_action_it { std::find(actions.begin(), actions.end(), first_action) };
+
+    // Other actions order is kept
+    if (first_action_it != actions.end())
+        std::rotate(actions.begin(), first_action_it, first_action_it + 1);
+}
+
+void BoardGameSearch::visitNode() {
+    visited_nodes_++;
+
+    // Flag is cheap to load, unlike clock
+    if (cancelled_ != nullptr && cancelled_->load(std::memory_order_relaxed))
+        throw SearchTimeout {};
+
+    if (visited_nodes_ % CLOCK_CHECK_INTERVAL == 0 && std::chrono::steady_clock::now() >= deadline_)
+        throw SearchTimeout {};
+}
+
+int BoardGameSearch::actionScore(const BoardGame& game, const Action& action, const unsigned int depth,
+                                 const int alpha, const int beta) {
+
+    const std::unique_ptr<BoardGame> next_position { played(game, action) };
+
+    // Same player might still be playing after its move, then score doesn't need to be negated
+    if (next_position->currentRound() == game.currentRound())
+        return negamax(*next_position, depth - 1, alpha, beta);
+    else
+        return -negamax(*next_position, depth - 1, -beta, -alpha);
+}
+
+int BoardGameSearch::negamax(const BoardGame& game, const unsigned int depth, int alpha, int beta) {
+    visitNode();
+
+    const std::optional<Player> winner { game.victoryFor() };
+    if (winner.has_value())
+        return *winner == game.currentRound() ? VICTORY_SCORE : -VICTORY_SCORE;
+
+    if (depth == 0)
+        return evaluate(game);
+
+    // Available moves inside a round depend on previous moves (like jumps chaining) which aren't part of position
+    // hash, so only positions at a round beginning are stored
+    const bool round_beginning { !game.hasMoved() };
+    const int initial_alpha { alpha };
+    std::optional<Action> stored_action;
+
+    if (round_beginning) {
+        const auto transposition { transpositions_.find(game.positionHash()) };
+
+        if (transposition != transpositions_.end()) {
+            const Transposition& stored { transposition->second };
+            stored_action = stored.bestAction;
+
+            if (stored.depth >= depth) { // Stored score is reliable enough for this search
+                if (stored.bound == Bound::Exact)
+                    return stored.score;
+                else if (stored.bound == Bound::Lower)
+                    alpha = std::max(alpha, stored.score);
+                else
+                    beta = std::min(beta, stored.score);
+
+                if (alpha >= beta)
+                    return stored.score;
+            }
+        }
+    }
+
+    std::vector<Action> actions { actionsFor(game) };
+    if (actions.empty()) // Player is blocked and will never be able to end its round
+        return -VICTORY_SCORE;
+
+    // Previous best action is the most likely to cause a cutoff
+    if (stored_action.has_value())
+        tryFirst(actions, *stored_action);
+
+    int best_score { -VICTORY_SCORE - 1 };
+    Action best_action;
+    for (const Action& action : actions) {
+        const int score { actionScore(game, action, depth, alpha, beta) };
+
+        if (score > best_score) {
+            best_score = score;
+            best_action = action;
+        }
+
+        alpha = std::max(alpha, score);
+        if (alpha >= beta) // Opponent will never let this position happen
+            break;
+    }
+
+    if (round_beginning) {
+        if (transpositions_.size() >= MAX_TRANSPOSITIONS)
+            transpositions_.clear();
+
+        Bound bound;
+        if (best_score <= initial_alpha)
+            bound = Bound::Upper;
+        else if (best_score >= beta)
+            bound = Bound::Lower;
+        else
+            bound = Bound::Exact;
+
+        transpositions_[game.positionHash()] = { depth, best_score, bound, best_action };
+    }
+
+    return best_score;
+}
+
+std::pair<BoardGameSearch::Action, int> BoardGameSearch::searchRoot(const BoardGame& game,
+                                                                   const std::vector<Action>& actions,
+                                                                   const unsigned int depth) {
+
+    Action best_action { actions.front() };
+    int best_score { -VICTORY_SCORE - 1 };
+
+    for (const Action& action : actions) {
+        // Only actions strictly better than current best one are required to get their exact score
+        const int score { actionScore(game, action, depth, best_score, VICTORY_SCORE + 1) };
+
+        if (score > best_score) {
+            best_score = score;
+            best_action = action;
+        }
+    }
+
+    return { best_action, best_score };
+}
+
+BoardGameSearch::BoardGameSearch() : cancelled_ { nullptr }, visited_nodes_ { 0 }, completed_depth_ { 0 } {}
+
+BoardGameSearch::Action BoardGameSearch::bestAction(const BoardGame& game,
+                                                    const std::chrono::milliseconds time_budget,
+                                                    const std::atomic_bool* const cancelled) {
+
+    deadline_ = std::chrono::steady_clock::now() + time_budget;
+    cancelled_ = cancelled;
+    visited_nodes_ = 1; // Root is visited
+    completed_depth_ = 0;
+
+    std::vector<Action> actions { actionsFor(game) };
+    if (actions.empty())
+        throw NoActionAvailable {};
+
+    Action best_action { actions.front() };
+    if (actions.size() == 1) // No choice, no need to search
+        return best_action;
+
+    for (unsigned int depth { 1 }; depth <= MAX_DEPTH; depth++) {
+        try {
+            const auto [depth_best_action, best_score] { searchRoot(game, actions, depth) };
+
+            best_action = depth_best_action;
+            completed_depth_ = depth;
+
+            if (std::abs(best_score) == VICTORY_SCORE) // Game outcome is known, deeper search wouldn't change it
+                break;
+        } catch (const SearchTimeout&) { // Time budget exhausted, partially searched depth is ignored
+            break;
+        }
+
+        // Next depth searches previous best action first, so it prunes more nodes
+        tryFirst(actions, best_action);
+    }
+
+    return best_action;
+}
+
+std::size_t BoardGameSearch::visitedNodes() const {
+    return visited_nodes_;
+}
+
+unsigned int BoardGameSearch::completedDepth() const {
+    return completed_depth_;
+}
+
+
+}
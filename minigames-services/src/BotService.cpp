@@ -0,0 +1,164 @@
+#include <Minigames-Services/BotService.hpp>
+
+#include <chrono>
+#include <RpT-Core/ServiceEventRequestProtocol.hpp> // For BadServiceRequest exception
+#include <RpT-Utils/AllocationProfiler.hpp>
+
+
+namespace MinigamesServices {
+
+
+BotService::CommandParser::CommandParser(const std::string_view bot_command)
+: RpT::Utils::TextProtocolParser { bot_command, 1 } {
+    const std::string_view unparsed_command { getParsedWord(0) };
+
+    // Tries to parse for each available command
+    if (unparsed_command == "JOIN")
+        parsed_command_ = Command::Join;
+    else if (unparsed_command == "LEAVE")
+        parsed_command_ = Command::Leave;
+    else // If no known command could have been parsed, then request is ill-formed
+        throw RpT::Core::BadServiceRequest { "Unknown command: " + std::string { unparsed_command } };
+}
+
+BotService::Command BotService::CommandParser::command() const {
+    return parsed_command_;
+}
+
+
+BotService::BotService(RpT::Core::ServiceContext& run_context, LobbyService& lobby, MinigameService& minigame,
+                       const std::size_t search_budget_ms)
+: RpT::Core::Service { run_context },
+lobby_ { lobby }, minigame_ { minigame }, seated_ { false },
+search_budget_ { static_cast<std::chrono::milliseconds::rep>(search_budget_ms) },
+shared_search_ { std::make_shared<SharedSearch>() }, searching_ { false }, searched_position_ { 0 } {}
+
+BotService::~BotService() {
+    // Worker thread must not keep searching until its deadline while service is destroyed
+    shared_search_->cancelled = true;
+}
+
+void BotService::cancelSearch() {
+    // Cancelled search stops within a few nodes visit, its task still completes so shared search is free again
+    shared_search_->cancelled = true;
+}
+
+void BotService::submitAction(const BoardGameSearch::Action& action) {
+    // Game might have been stopped or modified since search began
+    if (shared_search_->cancelled || !minigame_.isStarted() || minigame_.currentActor() != BOT_ACTOR
+        || minigame_.game().positionHash() != searched_position_) {
+
+        return;
+    }
+
+    std::string action_command;
+    if (action.has_value()) { // Moves a pawn
+        action_command = "MOVE " + std::to_string(action->from.line) + ' ' + std::to_string(action->from.column)
+                         + ' ' + std::to_string(action->to.line) + ' ' + std::to_string(action->to.column);
+    } else { // Ends round
+        action_command = "END";
+    }
+
+    // Submitted as any other player command
+    minigame_.handleRequestCommand(BOT_ACTOR, action_command);
+}
+
+std::string_view BotService::name() const {
+    return "Bot";
+}
+
+bool BotService::isSeated() const {
+    return seated_;
+}
+
+void BotService::join() {
+    if (seated_)
+        throw BadPlayersState { "Bot is already seated" };
+
+    lobby_.assignActor(BOT_ACTOR); // Might fail if every seat is taken
+    seated_ = true;
+
+    emitEvent("JOINED " + std::to_string(BOT_ACTOR));
+    // Bot is always ready to play
+    lobby_.handleRequestCommand(BOT_ACTOR, "READY");
+}
+
+void BotService::leave() {
+    if (!seated_)
+        throw BadPlayersState { "Bot isn't seated" };
+
+    cancelSearch();
+    lobby_.removeActor(BOT_ACTOR);
+    seated_ = false;
+
+    // Bot was playing if a game is running, which would then never end
+    if (minigame_.isStarted())
+        minigame_.stop();
+
+    emitEvent("LEFT");
+}
+
+void BotService::play() {
+    if (!seated_ || searching_) // Nothing to do, or already searching
+        return;
+
+    if (!minigame_.isStarted()) {
+        // Lobby resets ready state when a game starts, so bot gets ready again for next one
+        if (!lobby_.isReady(BOT_ACTOR))
+            lobby_.handleRequestCommand(BOT_ACTOR, "READY");
+
+        return;
+    }
+
+    if (minigame_.currentActor() != BOT_ACTOR)
+        return;
+
+    const BoardGame& game { minigame_.game() };
+
+    // Bot cannot perform any action, game would never end
+    if (!game.hasMoved() && !game.hasLegalMove()) {
+        minigame_.stop();
+
+        return;
+    }
+
+    searched_position_ = game.positionHash();
+    shared_search_->cancelled = false;
+    searching_ = true;
+
+    // Searches on a copy, as game might be modified by executor thread during search
+    submitTask([shared_search = shared_search_, searched_game = game.clone(), search_budget = search_budget_]() {
+        const RpT::Utils::AllocationScope games_allocations { RpT::Utils::AllocationSubsystem::Games };
+
+        return shared_search->search.bestAction(*searched_game, search_budget, &shared_search->cancelled);
+    }, [this](const BoardGameSearch::Action& action) {
+        searching_ = false;
+
+        submitAction(action);
+    });
+}
+
+RpT::Utils::HandlingResult BotService::handleRequestCommand(const std::uint64_t,
+                                                            const std::string_view sr_command_data) {
+
+    // Parses SR command
+    const CommandParser command_parser { sr_command_data };
+
+    try { // Seat state might not allow requested command
+        switch (command_parser.command()) {
+        case Command::Join:
+            join();
+            break;
+        case Command::Leave:
+            leave();
+            break;
+        }
+    } catch (const BadPlayersState& err) {
+        return RpT::Utils::HandlingResult { err.what() };
+    }
+
+    return {};
+}
+
+
+}
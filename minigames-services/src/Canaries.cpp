@@ -1,6 +1,5 @@
 #include <Minigames-Services/Canaries.hpp>
 
-#include <array>
 #include <utility>
 
 
@@ -14,7 +13,7 @@ void Canaries::playNormal(GridUpdate& updates, AxisIterator move) {
         throw BadSquareState { "Movement destination is kept by another pawn" };
 
     // Applies movement modifications to grid
-    game_grid_[updates.moveOrigin] = Square::Free; // Target pawn no longer into origin square
+    game_grid_.unchecked(updates.moveOrigin) = Square::Free; // Target pawn no longer into origin square
     destination = colorFor(currentRound()); // It appears into destination square
 }
 
@@ -31,7 +30,7 @@ void Canaries::playEat(GridUpdate& updates, AxisIterator move) {
         throw BadSquareState { "Movement destination doesn't contain an opponent pawn to eat" };
 
     // Applies movement modifications to grid
-    game_grid_[updates.moveOrigin] = Square::Free;
+    game_grid_.unchecked(updates.moveOrigin) = Square::Free;
     eaten = current_player_color; // Square where opponent's pawn is eaten now contain our moved pawn
 
     // Saves stats updates
@@ -41,60 +40,82 @@ void Canaries::playEat(GridUpdate& updates, AxisIterator move) {
         white_pawns_--;
 }
 
-bool Canaries::isBlocked(const Player player) const {
+Bitboard::Mask Canaries::movableOrigins(const Player player, const AxisType direction) const {
     const Square player_color { colorFor(player) };
+    const AxisType backward { opposite(direction) };
+
+    const Bitboard::Mask player_pawns { game_bitboard_.pawnsOf(player_color) };
+    const Bitboard::Mask opponent_pawns { game_bitboard_.pawnsOf(flip(player_color)) };
+
+    // Squares moved backward so each of them is at the position of the pawn which would reach it
+    const Bitboard::Mask free_neighbours { game_bitboard_.shifted(game_bitboard_.freeSquares(), backward) };
+    const Bitboard::Mask own_neighbours { game_bitboard_.shifted(player_pawns, backward) };
+    const Bitboard::Mask eaten_squares {
+        game_bitboard_.shifted(game_bitboard_.shifted(opponent_pawns, backward), backward)
+    };
+
+    // Normal move if direct neighbour is empty, eat move if it is an own pawn followed by an opponent pawn
+    return player_pawns & (free_neighbours | (own_neighbours & eaten_squares));
+}
+
+unsigned int Canaries::mobilityFrom(const Player player, const OriginsMasks& origins) const {
+    unsigned int mobility { 0 };
+
+    std::size_t direction_i { 0 };
+    for (const AxisType direction : AxisIterator::EVERY_ORTHOGONAL_DIRECTION)
+        mobility += (movableOrigins(player, direction) & origins[direction_i++]).count();
+
+    return mobility;
+}
 
-    // For each square kept by given player, tests for every possible move if it is available
-    for (int line { 1 }; line <= 4; line++) {
-        for (int column { 1 }; column <= 4; column++) {
-            const Coordinates checked_square { line, column };
-
-            // For a move to be available from current square, it must be kept by given player
-            if (game_grid_[checked_square] == player_color) {
-                // Each orthogonal axis will be checked for available moves
-                const std::array<std::pair<int, int>, 4> orthogonal_vectors {
-                        std::make_pair<int, int>(1, 0),
-                        std::make_pair<int, int>(-1, 0),
-                        std::make_pair<int, int>(0, 1),
-                        std::make_pair<int, int>(0, -1),
-                };
-
-                for (const auto& [line_offset, col_offset] : orthogonal_vectors) {
-                    // Next orthogonal direction to check for
-                    const Coordinates neighbour { line + line_offset, column + col_offset };
-                    // Possible destination for a jump move, one square after the direct neighbour calculated previously
-                    const Coordinates after_neighbour { line + 2 * line_offset, column + 2 * col_offset };
-
-                    // No move is possible if grid border is met right into current direction
-                    if (!game_grid_.isInsideGrid(neighbour))
-                        continue;
-
-                    // Get content of 1st neighbour
-                    const Square direct_neighbour { game_grid_[neighbour] };
-                    // If it is empty, then a normal move can be performed, player isn't blocked
-                    if (direct_neighbour == Square::Free)
-                        return false;
-
-                    // If it is kept by a player's own pawn, a jump/eat move might be possible if and only if next
-                    // square is inside grid and is a pawn of the opponent color
-                    const bool jump_eat_available {
-                        direct_neighbour == player_color &&
-                        game_grid_.isInsideGrid(after_neighbour) &&
-                        game_grid_[after_neighbour] == flip(player_color)
-                    };
-
-                    if (jump_eat_available)
-                        return false;
-                }
-            }
-        }
+void Canaries::syncMobility(const GridUpdate& updates) {
+    Bitboard::Mask modified_squares {
+        game_bitboard_.maskOf(updates.moveOrigin) | game_bitboard_.maskOf(updates.moveDestination)
+    };
+
+    for (const SquareUpdate& additional_update : updates.updatedSquares)
+        modified_squares |= game_bitboard_.maskOf(additional_update.square);
+
+    // A move depends on its origin, its direct neighbour and the square after, so only moves from a modified square
+    // or from one or two squares backward are affected
+    OriginsMasks affected_origins;
+    std::size_t direction_i { 0 };
+    for (const AxisType direction : AxisIterator::EVERY_ORTHOGONAL_DIRECTION) {
+        const AxisType backward { opposite(direction) };
+        const Bitboard::Mask one_square_backward { game_bitboard_.shifted(modified_squares, backward) };
+
+        affected_origins[direction_i++] =
+                modified_squares | one_square_backward | game_bitboard_.shifted(one_square_backward, backward);
     }
 
-    // If no move was detected as available, then player is blocked
-    return true;
+    // Removes affected moves with previous grid state, bitboard isn't synced yet
+    white_mobility_ -= mobilityFrom(Player::White, affected_origins);
+    black_mobility_ -= mobilityFrom(Player::Black, affected_origins);
+
+    syncBitboard(updates);
+
+    // Then adds affected moves with current grid state
+    white_mobility_ += mobilityFrom(Player::White, affected_origins);
+    black_mobility_ += mobilityFrom(Player::Black, affected_origins);
 }
 
-Canaries::Canaries() : BoardGame { INITIAL_GRID_, 8, 8, 2 } {}
+bool Canaries::isBlocked(const Player player) const {
+    return (player == Player::White ? white_mobility_ : black_mobility_) == 0;
+}
+
+void Canaries::recountMobility() {
+    const Bitboard::Mask every_square {
+        game_bitboard_.freeSquares() | game_bitboard_.pawnsOf(Square::White) | game_bitboard_.pawnsOf(Square::Black)
+    };
+    const OriginsMasks every_origin { every_square, every_square, every_square, every_square };
+
+    white_mobility_ = mobilityFrom(Player::White, every_origin);
+    black_mobility_ = mobilityFrom(Player::Black, every_origin);
+}
+
+Canaries::Canaries() : BoardGame { INITIAL_LAYOUT_, 2 } {
+    recountMobility();
+}
 
 std::optional<Player> Canaries::victoryFor() const {
     // First, checks if any player can no longer play anymore. In that case, he lose
@@ -106,6 +127,41 @@ std::optional<Player> Canaries::victoryFor() const {
         return BoardGame::victoryFor();
 }
 
+bool Canaries::isLegal(const PawnMove& move) const {
+    const Square current_player_color { colorFor(currentRound()) };
+    const std::optional<int> move_range { moveRange(move, false) };
+
+    if (!move_range.has_value() || game_bitboard_.at(move.from) != current_player_color)
+        return false;
+
+    switch (*move_range) {
+    case 1: // Normal move
+        return game_bitboard_.at(move.to) == Square::Free;
+    case 2: { // Jump over an own pawn to eat an opponent pawn
+        const Coordinates jumped_square_position {
+            (move.from.line + move.to.line) / 2, (move.from.column + move.to.column) / 2
+        };
+
+        return game_bitboard_.at(jumped_square_position) == current_player_color &&
+               game_bitboard_.at(move.to) == flip(current_player_color);
+    }
+    default:
+        return false;
+    }
+}
+
+std::unique_ptr<BoardGame> Canaries::clone() const {
+    return std::make_unique<Canaries>(*this);
+}
+
+std::vector<PawnMove> Canaries::legalMoves() const {
+    return enumerateLegalMoves<Canaries, MAX_RANGE_, false>();
+}
+
+bool Canaries::hasLegalMove() const {
+    return !isBlocked(currentRound());
+}
+
 bool Canaries::isRoundTerminated() const {
     return hasMoved();
 }
@@ -114,10 +170,10 @@ GridUpdate Canaries::play(const Coordinates& from, const Coordinates& to) {
     // A pawn will be moved from `from` to `to`, no square update as grid isn't modified yet
     GridUpdate updates { {}, from, to };
     // Move along axis selected by player, if any
-    AxisIterator move { game_grid_, from, to, AxisIterator::EVERY_ORTHOGONAL_DIRECTION };
+    AxisIterator move { game_grid_, from, to, AxisIterator::EVERY_ORTHOGONAL_DIRECTION_MASK };
 
     // Origin square must contains a pawn of current player color
-    if (game_grid_[from] != colorFor(currentRound()))
+    if (game_grid_.unchecked(from) != colorFor(currentRound()))
         throw BadSquareState { "Action target square must be kept by a pawn of current player" };
 
     const int move_range { -move.distanceFromDestination() }; // Destination not passed, returned distance is negative
@@ -133,6 +189,7 @@ GridUpdate Canaries::play(const Coordinates& from, const Coordinates& to) {
         throw BadCoordinates { "Selected squares are too far, no available move" };
     }
 
+    syncMobility(updates); // Also syncs bitboard
     // At this point, a move is performed: round can now be terminated
     moved();
 
@@ -4,7 +4,25 @@
 namespace MinigamesServices {
 
 
+namespace {
+
+
+/// KO for messages shed while server is overloaded
+constexpr RpT::Utils::StaticErrorMessage CHAT_THROTTLED_ERROR { "Chat is throttled while server is overloaded" };
+/// KO for messages containing only whitespaces
+constexpr RpT::Utils::StaticErrorMessage EMPTY_MESSAGE_ERROR { "Message cannot be empty" };
+
+
+}
+
+
 std::string trim(const std::string_view chat_message) {
+    const std::string_view trimmed_message { trimmed(chat_message) };
+
+    return { trimmed_message.cbegin(), trimmed_message.cend() }; // Copy-elision for trimmed chat message
+}
+
+std::string_view trimmed(const std::string_view chat_message) {
     auto msg_begin { chat_message.cbegin() };
     auto msg_end { chat_message.cend() };
 
@@ -19,38 +37,135 @@ std::string trim(const std::string_view chat_message) {
             msg_end--;
     }
 
-    return { msg_begin, msg_end }; // Copy-elision for substring containing trimmed chat message
+    return chat_message.substr(msg_begin - chat_message.cbegin(), msg_end - msg_begin);
 }
 
 
-ChatService::ChatService(RpT::Core::ServiceContext& run_context, const std::size_t cooldown_ms)
+void ChatService::appendMessage(std::string& event_command, const std::uint64_t actor,
+                                const std::string_view message) {
+
+    event_command += ' ';
+    event_command += std::to_string(actor);
+    event_command += ' ';
+    event_command += std::to_string(message.size());
+    event_command += ' ';
+    event_command += message;
+}
+
+ChatService::ChatService(RpT::Core::ServiceContext& run_context, const std::size_t cooldown_ms,
+                         const RpT::Utils::LoadMonitor* const load_monitor, const std::size_t history_size,
+                         const std::size_t batching_threshold)
 : RpT::Core::Service { run_context, { cooldown_ } },
   cooldown_msg_ { "Last message when sent less than " + std::to_string(cooldown_ms) + " ms ago" },
-  cooldown_ { run_context, cooldown_ms } {}
+  cooldown_ { run_context, cooldown_ms / COOLDOWN_SLOTS, cooldown_ms / COOLDOWN_SLOTS / 2 }, load_ { load_monitor },
+  current_slot_ { 0 }, batching_threshold_ { batching_threshold }, tick_messages_ { 0 }, history_(history_size),
+  history_next_ { 0 }, history_size_ { 0 } {}
 
 std::string_view ChatService::name() const {
     return "Chat";
 }
 
+void ChatService::keepInHistory(const std::uint64_t actor, const std::string_view message) {
+    if (history_.empty()) // History is disabled
+        return;
+
+    HistoryEntry& entry { history_[history_next_] };
+    entry.actor = actor;
+    entry.message.assign(message); // Overwritten entry capacity is reused
+
+    history_next_ = (history_next_ + 1) % history_.size();
+    if (history_size_ < history_.size())
+        history_size_++;
+}
+
+bool ChatService::isCoolingDown(const std::uint64_t actor) const {
+    return cooling_actors_.count(actor) == 1;
+}
+
+void ChatService::flush() {
+    if (cooldown_.hasTriggered()) { // Wheel ticked since previous call
+        cooldown_.clear();
+
+        // Actors put inside reached slot a whole wheel turn ago can send messages again
+        current_slot_ = (current_slot_ + 1) % COOLDOWN_SLOTS;
+        for (const std::uint64_t released_actor : cooldown_slots_[current_slot_])
+            cooling_actors_.erase(released_actor);
+
+        cooldown_slots_[current_slot_].clear();
+
+        if (!batched_messages_.empty()) // Messages kept during previous tick are sent together
+            emitBestEffortEvent(batched_messages_);
+
+        batched_messages_.clear(); // Copied into events arena, buffer capacity is reused by next tick
+        tick_messages_ = 0;
+    }
+
+    // Wheel keeps going on while any actor is cooling down
+    if (cooldown_.isFree() && !cooling_actors_.empty())
+        cooldown_.requestCountdown();
+}
+
+void ChatService::sendHistory(const std::uint64_t actor) {
+    if (history_size_ == 0) // Nothing to catch up with
+        return;
+
+    std::string history_command { "HISTORY" };
+
+    // Oldest entry is next one to be overwritten if history is full, or first one otherwise
+    const std::size_t oldest_entry { history_size_ == history_.size() ? history_next_ : 0 };
+    for (std::size_t i { 0 }; i < history_size_; i++) {
+        const HistoryEntry& entry { history_[(oldest_entry + i) % history_.size()] };
+
+        appendMessage(history_command, entry.actor, entry.message);
+    }
+
+    emitBestEffortEvent(history_command, { actor });
+}
+
 RpT::Utils::HandlingResult ChatService::handleRequestCommand(const std::uint64_t actor,
                                                              const std::string_view sr_command_data) {
 
-    // Copies message data to trim then send it if it is not "invisible"
-    const std::string chat_message { trim(sr_command_data) };
+    if (load_ && load_->overloaded()) // Checked first, so shed messages don't even get parsed
+        return RpT::Utils::HandlingResult { CHAT_THROTTLED_ERROR };
+
+    // Message is trimmed without being copied, only event command owns its data
+    const std::string_view chat_message { trimmed(sr_command_data) };
 
     if (chat_message.empty()) // Checks for chat message to not be "invisible" (<=> empty after trim)
-        return RpT::Utils::HandlingResult { "Message cannot be empty" };
+        return RpT::Utils::HandlingResult { EMPTY_MESSAGE_ERROR };
 
-    if (cooldown_.hasTriggered()) // If previous cooldown timed out, a new message can be sent, disable countdown
-        cooldown_.clear();
+    if (isCoolingDown(actor)) // If actor cooldown is still running, then message cannot be sent
+        return RpT::Utils::HandlingResult { RpT::Utils::StaticErrorMessage { cooldown_msg_ } }; // Owned by service
+
+    keepInHistory(actor, chat_message);
+
+    if (tick_messages_ < batching_threshold_) { // Traffic is low, message is sent to actors immediately
+        const std::string actor_uid { std::to_string(actor) };
+
+        std::string message_command;
+        message_command.reserve(13 + actor_uid.size() + 1 + chat_message.size()); // "MESSAGE_FROM " takes 13 chars
+
+        message_command += "MESSAGE_FROM ";
+        message_command += actor_uid;
+        message_command += ' ';
+        message_command += chat_message;
+
+        emitBestEffortEvent(message_command);
+    } else { // Threshold was reached during this tick, this one waits for next tick
+        if (batched_messages_.empty())
+            batched_messages_ = "MESSAGES";
+
+        appendMessage(batched_messages_, actor, chat_message);
+    }
+
+    tick_messages_++;
 
-    if (!cooldown_.isFree()) // If cooldown timer is still running, then message cannot be sent
-        return RpT::Utils::HandlingResult { cooldown_msg_ };
+    // Starts actor cooldown, next message not before given milliseconds delay, once wheel is back to current slot
+    cooldown_slots_[current_slot_].push_back(actor);
+    cooling_actors_.try_emplace(actor, current_slot_);
 
-    // Sends message to actors
-    emitEvent("MESSAGE_FROM " + std::to_string(actor) + ' ' + chat_message);
-    // Starts messages cooldown, next message not before given milliseconds delay
-    cooldown_.requestCountdown();
+    if (cooldown_.isFree()) // Wheel begins to tick if no actor was cooling down
+        cooldown_.requestCountdown();
 
     return {}; // Request successfully handled
 }
@@ -7,9 +7,13 @@ namespace MinigamesServices {
 
 
 LobbyService::CommandParser::CommandParser(const std::string_view lobby_command)
-: RpT::Utils::TextProtocolParser { lobby_command, 1 } {
-    if (getParsedWord(0) != "READY") // This is the only available command for that service
-        throw RpT::Core::BadServiceRequest { "Only READY command is available for Lobby" };
+: RpT::Utils::TextProtocolParser { lobby_command, 1 }, snapshot_ { getParsedWord(0) == "SNAPSHOT" } {
+    if (!snapshot_ && getParsedWord(0) != "READY") // These are the only available commands for that service
+        throw RpT::Core::BadServiceRequest { "Only READY and SNAPSHOT commands are available for Lobby" };
+}
+
+bool LobbyService::CommandParser::isSnapshot() const {
+    return snapshot_;
 }
 
 
@@ -26,6 +30,45 @@ std::optional<LobbyService::Entrant>& LobbyService::playerFor(const std::uint64_
         throw std::invalid_argument { "Actor " + std::to_string(actor_uid) + " isn't assigned to any player" };
 }
 
+void LobbyService::emitSnapshot(const std::uint64_t actor) {
+    std::string snapshot_command { "SNAPSHOT " };
+
+    if (minigame_session_.isStarted())
+        snapshot_command += "PLAYING";
+    else if (ready_players_ == 2) // Both players ready means starting countdown has been requested
+        snapshot_command += "COUNTDOWN";
+    else
+        snapshot_command += "WAITING";
+
+    // Ready players are listed so client doesn't need every READY_PLAYER and WAITING_FOR_PLAYER event
+    for (const std::optional<Entrant>* entrant : { &white_player_actor_, &black_player_actor_ }) {
+        if (entrant->has_value() && (*entrant)->isReady)
+            snapshot_command += ' ' + std::to_string((*entrant)->actorUid);
+    }
+
+    emitEvent(snapshot_command, { actor });
+}
+
+void LobbyService::startingFlow() {
+    RPT_COROUTINE(starting_flow_) {
+        // Syncs clients with beginning countdown so they can perform a countdown on their side too
+        emitEvent("BEGIN_COUNTDOWN " + std::to_string(starting_countdown_.countdown()));
+
+        // If a game has been started once, timer is cleared before its countdown is requested again
+        RPT_AWAIT_TIMER(starting_countdown_);
+
+        // When countdown is done, starts minigame with configured/assigned players
+        minigame_session_.start(white_player_actor_->actorUid, black_player_actor_->actorUid);
+
+        // Notifies clients that Lobby is idling as game is running
+        emitEvent("PLAYING");
+        // Resets state for preparation of next game after the current one
+        ready_players_ = 0;
+        white_player_actor_->isReady = false;
+        black_player_actor_->isReady = false;
+    }
+}
+
 void LobbyService::cancelCountdown() {
     // Clients will be notified if they were waiting for minigame to start
     if (starting_countdown_.isPending())
@@ -33,6 +76,7 @@ void LobbyService::cancelCountdown() {
 
     // If countdown hasn't begun, it will not have any effect, can be called in any state
     starting_countdown_.clear();
+    starting_flow_.cancel();
 }
 
 LobbyService::LobbyService(RpT::Core::ServiceContext& run_context, MinigameService& rpt_minigame,
@@ -40,7 +84,8 @@ LobbyService::LobbyService(RpT::Core::ServiceContext& run_context, MinigameServi
                            RpT::Core::Service { run_context, { starting_countdown_ } },
                            minigame_session_ { rpt_minigame },
                            ready_players_ { 0 },
-                           starting_countdown_ { run_context, countdown_ms } {}
+                           starting_countdown_ { run_context, countdown_ms, COUNTDOWN_SLACK_MS },
+                           starting_flow_ { [this]() { startingFlow(); } } {}
 
 std::string_view LobbyService::name() const {
     return "Lobby";
@@ -88,12 +133,28 @@ void LobbyService::removeActor(const std::uint64_t actor_uid) {
     }
 }
 
+bool LobbyService::isReady(const std::uint64_t actor_uid) const {
+    if (white_player_actor_.has_value() && white_player_actor_->actorUid == actor_uid)
+        return white_player_actor_->isReady;
+    else if (black_player_actor_.has_value() && black_player_actor_->actorUid == actor_uid)
+        return black_player_actor_->isReady;
+    else
+        throw BadPlayersState { "Actor " + std::to_string(actor_uid) + " isn't assigned to any player" };
+}
+
 RpT::Utils::HandlingResult LobbyService::handleRequestCommand(
         const std::uint64_t actor, const std::string_view sr_command_data) {
 
-    // Parses "READY" command
+    // Parses "READY" or "SNAPSHOT" command
     const CommandParser parsed_command { sr_command_data };
 
+    // Any actor can ask for Lobby state, even if it isn't assigned to a player
+    if (parsed_command.isSnapshot()) {
+        emitSnapshot(actor);
+
+        return {};
+    }
+
     // Reference to the isReady field of the appropriate Entrant
     bool& ready_flag { playerFor(actor)->isReady };
     // Flag is complemented without calling playerFor() 2 times
@@ -109,23 +170,7 @@ RpT::Utils::HandlingResult LobbyService::handleRequestCommand(
     }
 
     if (ready_players_ == 2) { // If all players are ready now, begins countdown for minigame to start
-        starting_countdown_.clear(); // If a game has been started once, then timer needs to be puts into Disabled state
-        starting_countdown_.requestCountdown();
-
-        // When countdown is done, starts minigame with configured/assigned players
-        starting_countdown_.onNextTrigger([this]() {
-            minigame_session_.start(white_player_actor_->actorUid, black_player_actor_->actorUid);
-
-            // Notifies clients that Lobby is idling as game is running
-            emitEvent("PLAYING");
-            // Resets state for preparation of next game after the current one
-            ready_players_ = 0;
-            white_player_actor_->isReady = false;
-            black_player_actor_->isReady = false;
-        });
-
-        // Syncs clients with beginning countdown so they can perform a countdown on their side too
-        emitEvent("BEGIN_COUNTDOWN " + std::to_string(starting_countdown_.countdown()));
+        starting_flow_.start();
     } else { // If not every player is ready, cancel countdown
         cancelCountdown();
     }
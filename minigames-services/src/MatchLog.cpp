@@ -0,0 +1,281 @@
+#include <Minigames-Services/MatchLog.hpp>
+
+#include <limits>
+#include <boost/interprocess/exceptions.hpp>
+
+
+namespace MinigamesServices {
+
+
+namespace {
+
+
+/// Maximum number of bytes for an unsigned LEB128 varint holding 64 bits
+constexpr std::size_t MATCH_LOG_MAX_VARINT_LENGTH { 10 };
+
+constexpr std::uint8_t MOVE_ACTION { 0 };
+constexpr std::uint8_t ROUND_END_ACTION { 1 };
+
+
+/// Appends given value as an unsigned LEB128 varint
+void appendMatchVarint(std::string& output, std::uint64_t value) {
+    // 7 bits for each byte, most significant bit set if another byte follows
+    while (value >= 0x80) {
+        output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    output.push_back(static_cast<char>(value));
+}
+
+/// Encodes given match as a record prefixed with its length
+std::string encodeMatch(const LoggedMatch& match) {
+    std::string record;
+    appendMatchVarint(record, match.whiteActor);
+    appendMatchVarint(record, match.blackActor);
+    appendMatchVarint(record, match.startedAt);
+    appendMatchVarint(record, match.actions.size());
+
+    for (const MatchAction& action : match.actions) {
+        if (action.roundEnd) {
+            record.push_back(static_cast<char>(ROUND_END_ACTION));
+        } else {
+            record.push_back(static_cast<char>(MOVE_ACTION));
+            appendMatchVarint(record, static_cast<std::uint64_t>(action.from.line));
+            appendMatchVarint(record, static_cast<std::uint64_t>(action.from.column));
+            appendMatchVarint(record, static_cast<std::uint64_t>(action.to.line));
+            appendMatchVarint(record, static_cast<std::uint64_t>(action.to.column));
+        }
+    }
+
+    record.push_back(static_cast<char>(match.result));
+
+    std::string prefixed_record;
+    appendMatchVarint(prefixed_record, record.size());
+    prefixed_record += record;
+
+    return prefixed_record;
+}
+
+/// Checks if given file is missing or empty, so header must be written
+bool isNewLog(const std::string& log_path) {
+    std::ifstream log_file { log_path, std::ios::binary };
+
+    return !log_file || log_file.peek() == std::ifstream::traits_type::eof();
+}
+
+/// Checks that given log begins with a header for current format version
+void checkHeader(const std::string_view log) {
+    const std::size_t header_length { MatchLogFormat::MAGIC.size() + 1 };
+
+    if (log.size() < header_length || log.substr(0, MatchLogFormat::MAGIC.size()) != MatchLogFormat::MAGIC)
+        throw BadMatchLog { "Missing header" };
+
+    const auto version { static_cast<std::uint8_t>(log[MatchLogFormat::MAGIC.size()]) };
+    if (version != MatchLogFormat::VERSION)
+        throw BadMatchLog { "Unsupported format version " + std::to_string(version) };
+}
+
+
+}
+
+
+/*
+ * Writer
+ */
+
+void MatchLogWriter::writeQueue() {
+    std::vector<std::string> written_records;
+
+    std::unique_lock<std::mutex> queue_lock { queue_mutex_ };
+    while (true) {
+        queue_filled_.wait(queue_lock, [this]() { return stopping_ || !queued_records_.empty(); });
+
+        if (queued_records_.empty()) // Stopping and every record has been written
+            return;
+
+        // Queue is taken at once, so appending threads aren't blocked while records are written
+        written_records.swap(queued_records_);
+        queue_lock.unlock();
+
+        for (const std::string& record : written_records)
+            output_.write(record.data(), static_cast<std::streamsize>(record.size()));
+
+        output_.flush(); // Readers can see every appended match once queue is empty
+        written_records.clear();
+
+        queue_lock.lock();
+    }
+}
+
+MatchLogWriter::MatchLogWriter(const std::string& log_path) : stopping_ { false }, appended_matches_ { 0 } {
+    const bool new_log { isNewLog(log_path) };
+
+    if (!new_log) { // Matches are appended to an existing log, which must be using same format
+        std::ifstream existing_log { log_path, std::ios::binary };
+        std::string header(MatchLogFormat::MAGIC.size() + 1, '\0');
+        existing_log.read(header.data(), static_cast<std::streamsize>(header.size()));
+
+        checkHeader(std::string_view { header.data(), static_cast<std::size_t>(existing_log.gcount()) });
+    }
+
+    output_.open(log_path, std::ios::binary | std::ios::app);
+    if (!output_)
+        throw BadMatchLog { "Unable to open " + log_path };
+
+    if (new_log) {
+        output_.write(MatchLogFormat::MAGIC.data(), static_cast<std::streamsize>(MatchLogFormat::MAGIC.size()));
+        output_.put(static_cast<char>(MatchLogFormat::VERSION));
+        output_.flush();
+    }
+
+    writer_ = std::thread { [this]() { writeQueue(); } };
+}
+
+MatchLogWriter::~MatchLogWriter() {
+    {
+        const std::lock_guard<std::mutex> queue_lock { queue_mutex_ };
+
+        stopping_ = true;
+    }
+
+    queue_filled_.notify_one();
+    writer_.join();
+}
+
+void MatchLogWriter::append(const LoggedMatch& match) {
+    std::string record { encodeMatch(match) }; // Encoded outside of lock
+
+    {
+        const std::lock_guard<std::mutex> queue_lock { queue_mutex_ };
+
+        queued_records_.push_back(std::move(record));
+    }
+
+    appended_matches_.fetch_add(1, std::memory_order_relaxed);
+    queue_filled_.notify_one();
+}
+
+std::uint64_t MatchLogWriter::appendedMatches() const {
+    return appended_matches_.load(std::memory_order_relaxed);
+}
+
+/*
+ * Reader
+ */
+
+std::uint8_t MatchLogReader::readByte(const std::string_view record, std::size_t& position) {
+    if (position >= record.size())
+        throw BadMatchLog { "Truncated record" };
+
+    return static_cast<std::uint8_t>(record[position++]);
+}
+
+std::uint64_t MatchLogReader::readVarint(const std::string_view record, std::size_t& position) {
+    std::uint64_t value { 0 };
+
+    for (std::size_t i { 0 }; i < MATCH_LOG_MAX_VARINT_LENGTH; i++) {
+        const std::uint8_t next_byte { readByte(record, position) };
+        const std::uint64_t value_bits { next_byte & 0x7Fu };
+
+        // Last byte can only hold most significant bit for a 64 bits value
+        if (i == MATCH_LOG_MAX_VARINT_LENGTH - 1 && value_bits > 1)
+            throw BadMatchLog { "Varint overflows 64 bits" };
+
+        value |= value_bits << (7 * i);
+
+        if ((next_byte & 0x80) == 0) // No byte follows
+            return value;
+    }
+
+    throw BadMatchLog { "Varint overflows 64 bits" };
+}
+
+int MatchLogReader::readCoordinate(const std::string_view record, std::size_t& position) {
+    const std::uint64_t coordinate { readVarint(record, position) };
+    if (coordinate > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+        throw BadMatchLog { "Coordinate " + std::to_string(coordinate) + " is too large" };
+
+    return static_cast<int>(coordinate);
+}
+
+std::string_view MatchLogReader::nextRecord() {
+    const std::uint64_t record_length { readVarint(log_, position_) };
+    if (record_length > log_.size() - position_)
+        throw BadMatchLog { "Truncated record" };
+
+    const std::string_view record { log_.substr(position_, record_length) };
+    position_ += record_length;
+
+    return record;
+}
+
+MatchLogReader::MatchLogReader(const std::string& log_path) : position_ { MatchLogFormat::MAGIC.size() + 1 } {
+    try {
+        log_file_ = boost::interprocess::file_mapping { log_path.c_str(), boost::interprocess::read_only };
+        mapped_log_ = boost::interprocess::mapped_region { log_file_, boost::interprocess::read_only };
+    } catch (const boost::interprocess::interprocess_exception& err) { // Also thrown if file is empty
+        throw BadMatchLog { "Unable to map " + log_path + ": " + err.what() };
+    }
+
+    log_ = std::string_view { static_cast<const char*>(mapped_log_.get_address()), mapped_log_.get_size() };
+    checkHeader(log_);
+}
+
+bool MatchLogReader::next(LoggedMatch& match) {
+    if (position_ == log_.size())
+        return false;
+
+    const std::string_view record { nextRecord() };
+    std::size_t record_position { 0 };
+
+    match.whiteActor = readVarint(record, record_position);
+    match.blackActor = readVarint(record, record_position);
+    match.startedAt = readVarint(record, record_position);
+
+    const std::uint64_t actions_count { readVarint(record, record_position) };
+    if (actions_count > record.size()) // Each action takes at least 1 byte
+        throw BadMatchLog { "Actions count " + std::to_string(actions_count) + " exceeds record length" };
+
+    match.actions.clear();
+    for (std::uint64_t i { 0 }; i < actions_count; i++) {
+        const std::uint8_t action_type { readByte(record, record_position) };
+
+        if (action_type == ROUND_END_ACTION) {
+            match.actions.push_back({ true, {}, {} });
+        } else if (action_type == MOVE_ACTION) {
+            MatchAction move { false, {}, {} };
+            move.from.line = readCoordinate(record, record_position);
+            move.from.column = readCoordinate(record, record_position);
+            move.to.line = readCoordinate(record, record_position);
+            move.to.column = readCoordinate(record, record_position);
+
+            match.actions.push_back(move);
+        } else {
+            throw BadMatchLog { "Unknown action type " + std::to_string(action_type) };
+        }
+    }
+
+    const std::uint8_t result { readByte(record, record_position) };
+    if (result > static_cast<std::uint8_t>(MatchResult::BlackVictory))
+        throw BadMatchLog { "Unknown match result " + std::to_string(result) };
+
+    match.result = static_cast<MatchResult>(result);
+
+    if (record_position != record.size())
+        throw BadMatchLog { "Unexpected bytes after match result" };
+
+    return true;
+}
+
+bool MatchLogReader::skip() {
+    if (position_ == log_.size())
+        return false;
+
+    nextRecord();
+
+    return true;
+}
+
+
+}
@@ -0,0 +1,81 @@
+#include <Minigames-Services/MatchReplay.hpp>
+
+
+namespace MinigamesServices {
+
+
+namespace {
+
+
+/// Human-readable name for given match result, used inside divergence reasons
+std::string replayedResultName(const MatchResult result) {
+    switch (result) {
+    case MatchResult::WhiteVictory:
+        return "white victory";
+    case MatchResult::BlackVictory:
+        return "black victory";
+    default:
+        return "stopped";
+    }
+}
+
+
+}
+
+
+std::optional<ReplayDivergence> replayMatch(BoardGame& game, const LoggedMatch& match) {
+    const std::size_t actions_count { match.actions.size() };
+
+    for (std::size_t i { 0 }; i < actions_count; i++) {
+        const MatchAction& action { match.actions[i] };
+
+        try {
+            if (action.roundEnd) {
+                game.nextRound();
+
+                continue;
+            }
+
+            if (game.isRoundTerminated())
+                return ReplayDivergence { i, "Move played after round was terminated" };
+
+            game.play(action.from, action.to);
+        } catch (const std::logic_error& err) { // Rules engine refused logged action
+            return ReplayDivergence { i, err.what() };
+        }
+
+        const std::optional<Player> winner { game.victoryFor() };
+        if (winner.has_value()) { // Service stopped game right after that move, so it must be the last one
+            const MatchResult replayed_result {
+                *winner == Player::White ? MatchResult::WhiteVictory : MatchResult::BlackVictory
+            };
+
+            if (i != actions_count - 1)
+                return ReplayDivergence { i, "Match ended with " + replayedResultName(replayed_result) };
+
+            if (replayed_result != match.result) {
+                return ReplayDivergence {
+                    actions_count,
+                    "Match ended with " + replayedResultName(replayed_result) + " instead of "
+                    + replayedResultName(match.result)
+                };
+            }
+
+            return {};
+        }
+
+        if (game.isRoundTerminated()) // Service terminated round itself, without any logged action
+            game.nextRound();
+    }
+
+    if (match.result != MatchResult::Stopped) { // Last action didn't make anyone win
+        return ReplayDivergence {
+            actions_count, "Match was still running instead of " + replayedResultName(match.result)
+        };
+    }
+
+    return {};
+}
+
+
+}
@@ -0,0 +1,100 @@
+#include <Minigames-Services/MinigameRoom.hpp>
+
+
+namespace MinigamesServices {
+
+
+MinigameRoom::MinigameRoom(const std::uint64_t id, RpT::Core::ServiceContext& timers_tokens_provider,
+                           BoardGameProvider game_provider, RpT::Utils::LoggingContext& logging_context,
+                           const std::size_t chat_cooldown_ms, const std::size_t lobby_countdown_ms,
+                           const std::size_t bot_search_ms, const RpT::Utils::LoadMonitor* const load_monitor,
+                           const std::size_t spectators, const std::size_t spectators_delay_ms,
+                           MatchLogWriter* const match_log)
+: RpT::Core::Room { id, PLAYERS + spectators },
+services_context_ { timers_tokens_provider },
+chat_svc_ { services_context_, chat_cooldown_ms, load_monitor },
+minigame_svc_ { services_context_, std::move(game_provider), match_log },
+lobby_svc_ { services_context_, minigame_svc_, lobby_countdown_ms },
+bot_svc_ { services_context_, lobby_svc_, minigame_svc_, bot_search_ms },
+spectators_flush_ { services_context_, spectators_delay_ms, spectators_delay_ms / 2 },
+game_was_running_ { false } {
+
+    // Not owned by any service, but its countdown must still be began by Executor
+    services_context_.timerWatched(spectators_flush_);
+
+    // Services are constructed, they can now be registered
+    runServices({ chat_svc_, minigame_svc_, lobby_svc_, bot_svc_ }, logging_context);
+}
+
+void MinigameRoom::actorJoined(const RpT::Core::JoinedEvent& event) {
+    // Players and spectators both catch up with messages sent before they joined
+    chat_svc_.sendHistory(event.actor());
+
+    // Joined actor is already inside room, so it isn't counted
+    const std::size_t seated_actors { actors().size() - spectators().size() - 1 };
+
+    if (seated_actors == PLAYERS) { // Both seats are taken, actor can only watch
+        setSpectator(event.actor(), true);
+        return;
+    }
+
+    // Bot was only waiting for a second actor, which takes its seat
+    if (bot_svc_.isSeated())
+        bot_svc_.leave();
+
+    lobby_svc_.assignActor(event.actor());
+}
+
+void MinigameRoom::actorLeft(const RpT::Core::LeftEvent& event) {
+    if (isSpectator(event.actor())) // Spectators aren't assigned to any service
+        return;
+
+    lobby_svc_.removeActor(event.actor());
+    minigame_svc_.forgetActor(event.actor());
+
+    // Bot has no one to play with anymore
+    if (bot_svc_.isSeated())
+        bot_svc_.leave();
+
+    // If one of the two players is disconnected during a game, then it should stop or it would never end
+    if (minigame_svc_.isStarted())
+        minigame_svc_.stop();
+
+    if (!spectators().empty()) { // Seat is free again, spectator which is waiting takes it
+        const std::uint64_t seated_spectator { *spectators().begin() };
+
+        setSpectator(seated_spectator, false);
+        lobby_svc_.assignActor(seated_spectator);
+    }
+}
+
+void MinigameRoom::spectatorsBacklogged() {
+    if (spectators_flush_.hasTriggered()) // Previous batch has been flushed, timer can be used again
+        spectators_flush_.clear();
+
+    if (!spectators_flush_.isFree()) // Batch is already waiting for its flush
+        return;
+
+    spectators_flush_.onNextTrigger([this]() { flushSpectators(); });
+    spectators_flush_.requestCountdown();
+}
+
+void MinigameRoom::routine() {
+    const bool is_game_running { minigame_svc_.isStarted() }; // Current routine call MinigameService state
+
+    // If the game go from running to not running, it stopped and clients must be notified about that
+    if (game_was_running_ && !is_game_running)
+        lobby_svc_.notifyWaiting();
+
+    // Save this call result for the next call check
+    game_was_running_ = is_game_running;
+
+    // Chat cooldowns wheel might have ticked with this input event
+    chat_svc_.flush();
+
+    // Bot might have to get ready or to play after this input event
+    bot_svc_.play();
+}
+
+
+}
@@ -1,13 +1,59 @@
 #include <Minigames-Services/MinigameService.hpp>
 
 #include <array>
+#include <cassert>
+#include <chrono>
+#include <optional>
 #include <RpT-Core/ServiceEventRequestProtocol.hpp> // For BadServiceRequest exception
+#include <RpT-Utils/AllocationProfiler.hpp>
 #include <utility>
 
 
 namespace MinigamesServices {
 
 
+namespace {
+
+
+/// Request command enabling GRID_DELTA events for its author
+constexpr std::string_view GRID_DELTA_REQUEST { "GRID_DELTA" };
+/// Request command asking for a snapshot of running game sent to its author only
+constexpr std::string_view SNAPSHOT_REQUEST { "SNAPSHOT" };
+
+/// KO for requests received while no game is running
+constexpr RpT::Utils::StaticErrorMessage GAME_STOPPED_ERROR { "Game is stopped" };
+/// KO for game actions requested by an actor who isn't current player
+constexpr RpT::Utils::StaticErrorMessage NOT_YOUR_TURN_ERROR { "This is not your turn" };
+
+
+/// Stringifies given square state as an event argument
+std::string_view stateArg(const Square state) {
+    switch (state) {
+    case Square::Free:
+        return "FREE";
+    case Square::White:
+        return "WHITE";
+    default:
+        return "BLACK";
+    }
+}
+
+/// Stringifies given square state as a single char inside snapshot squares list
+char stateChar(const Square state) {
+    switch (state) {
+    case Square::Free:
+        return 'F';
+    case Square::White:
+        return 'W';
+    default:
+        return 'B';
+    }
+}
+
+
+}
+
+
 MinigameService::MinigameRequestParser::MinigameRequestParser(const std::string_view sr_command)
 : RpT::Utils::TextProtocolParser { sr_command, 1 } {
     const std::string_view unparsed_action { getParsedWord(0) };
@@ -25,17 +71,16 @@ MinigameService::Action MinigameService::MinigameRequestParser::action() const {
     return parsed_action_;
 }
 
-std::string_view MinigameService::MinigameRequestParser::moveCommand() const {
-    // To access move command arguments, we must be sure to have a MOVE command in the first place
-    if (parsed_action_ != Action::Move)
-        throw RpT::Core::BadServiceRequest { "Cannot get args for a non-MOVE action command" };
 
-    return unparsedWords(); // MOVE command, retrieves unparsed arguments
-}
+MinigameService::MoveActionParser::MoveActionParser(const MinigameRequestParser& move_request)
+: RpT::Utils::TextProtocolParser { move_request, 4, std::nothrow }, parsed_from_ {}, parsed_to_ {},
+valid_ { false } {
 
+    // Coordinates are arguments following MOVE action
+    assert(move_request.action() == Action::Move);
 
-MinigameService::MoveActionParser::MoveActionParser(const std::string_view move_action_command)
-: RpT::Utils::TextProtocolParser { move_action_command, 4 }, parsed_from_ {}, parsed_to_ {} {
+    if (!hasExpectedWords()) // Missing coordinates, command is invalid
+        return;
 
     // Access for each integer to be parsed into that command, into the right apparition order
     const std::array<int*, 4> coordinates_to_parse {
@@ -44,16 +89,19 @@ MinigameService::MoveActionParser::MoveActionParser(const std::string_view move_
 
     // Parses each integer argument in the right order
     for (std::size_t arg_i { 0 }; arg_i < coordinates_to_parse.size(); arg_i++) {
-        const std::string arg_copy { getParsedWord(arg_i) }; // Arg needs to be copied for integer conversion
-
-        try { // Tries to parse as integer
-            *(coordinates_to_parse[arg_i]) = std::stoi(arg_copy);
-        } catch (const std::logic_error& err) { // If failed, throw custom error with message
-            throw RpT::Core::BadServiceRequest {
-                "Unable to parse MOVE arg #" + std::to_string(arg_i) + ": " + err.what()
-            };
-        }
+        const std::optional<int> parsed_coordinate { parseInteger<int>(getParsedWord(arg_i)) };
+
+        if (!parsed_coordinate.has_value()) // If failed, parsing stops and command is invalid
+            return;
+
+        *(coordinates_to_parse[arg_i]) = *parsed_coordinate;
     }
+
+    valid_ = true;
+}
+
+bool MinigameService::MoveActionParser::isValid() const {
+    return valid_;
 }
 
 Coordinates MinigameService::MoveActionParser::from() const {
@@ -65,9 +113,11 @@ Coordinates MinigameService::MoveActionParser::to() const {
 }
 
 
-MinigameService::MinigameService(RpT::Core::ServiceContext& run_context, BoardGameProvider rpt_minigame_provider)
+MinigameService::MinigameService(RpT::Core::ServiceContext& run_context, BoardGameProvider rpt_minigame_provider,
+                                 MatchLogWriter* const match_log)
 : RpT::Core::Service { run_context }, rpt_minigame_provider_ { std::move(rpt_minigame_provider) },
-white_player_actor_ { 0 }, black_player_actor_ { 0 } {} // Game didn't start, UID assigned to players doesn't matter
+white_player_actor_ { 0 }, black_player_actor_ { 0 }, // Game didn't start, UID assigned to players doesn't matter
+match_log_ { match_log }, logged_match_ {}, match_pending_ { false } {}
 
 std::string_view MinigameService::name() const {
     return "Minigame";
@@ -80,8 +130,20 @@ void MinigameService::start(const std::uint64_t white_player_actor, const std::u
     white_player_actor_ = white_player_actor;
     black_player_actor_ = black_player_actor;
 
-    // Initializes RpT-Minigame board game with polymorphic value returned by provider
-    current_game_ = rpt_minigame_provider_();
+    { // Initializes RpT-Minigame board game with polymorphic value returned by provider
+        const RpT::Utils::AllocationScope games_allocations { RpT::Utils::AllocationSubsystem::Games };
+
+        current_game_ = rpt_minigame_provider_();
+    }
+
+    if (match_log_) { // Actions storage is kept from previous match
+        logged_match_.whiteActor = white_player_actor_;
+        logged_match_.blackActor = black_player_actor_;
+        logged_match_.startedAt = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+        logged_match_.actions.clear();
+        match_pending_ = true;
+    }
 
     // Sends to clients so they know minigame has begun, and which actor is which player
     emitEvent("START " + std::to_string(white_player_actor_) + ' ' + std::to_string(black_player_actor_));
@@ -90,7 +152,12 @@ void MinigameService::start(const std::uint64_t white_player_actor, const std::u
 }
 
 void MinigameService::terminateRound() {
-    const Player next_player { current_game_->nextRound() }; // Tries to go for next round, might fail
+    // Tries to go for next round, might fail
+    const Player next_player { [this]() {
+        const RpT::Utils::AllocationScope games_allocations { RpT::Utils::AllocationSubsystem::Games };
+
+        return current_game_->nextRound();
+    }() };
 
     std::string round_command_arg;
     // Sets command argument depending on next round player
@@ -106,21 +173,26 @@ void MinigameService::terminateRound() {
 RpT::Utils::HandlingResult MinigameService::handleRequestCommand(
         const std::uint64_t actor, const std::string_view sr_command_data) {
 
+    // Capability can be enabled by any actor at any moment, even if it isn't playing
+    if (sr_command_data == GRID_DELTA_REQUEST) {
+        grid_delta_actors_.insert(actor);
+
+        return {};
+    }
+
     if (!current_game_) // Cannot handle any request if a game is not running to perform any action
-        return RpT::Utils::HandlingResult { "Game is stopped" };
+        return RpT::Utils::HandlingResult { GAME_STOPPED_ERROR };
 
-    /*
-     * Checks for SR author to be the actor who's currently playing
-     */
+    // Any actor can ask for running game state, a reconnecting one rebuilds its board from that single event
+    if (sr_command_data == SNAPSHOT_REQUEST) {
+        emitSnapshot(actor);
 
-    std::uint64_t expected_actor;
-    if (current_game_->currentRound() == Player::White)
-        expected_actor = white_player_actor_;
-    else
-        expected_actor = black_player_actor_;
+        return {};
+    }
 
-    if (actor != expected_actor)
-        return RpT::Utils::HandlingResult { "This is not your turn" };
+    // Checks for SR author to be the actor who's currently playing
+    if (actor != currentActor())
+        return RpT::Utils::HandlingResult { NOT_YOUR_TURN_ERROR };
 
     // Parses SR command
     const MinigameRequestParser command_parser { sr_command_data };
@@ -128,52 +200,120 @@ RpT::Utils::HandlingResult MinigameService::handleRequestCommand(
     // Calls correct handler depending on performed action
     switch (command_parser.action()) {
     case Action::Move:
-        handleMove(command_parser.moveCommand());
+        handleMove(command_parser);
         break;
     case Action::End:
         terminateRound();
+
+        if (match_log_) // Only logged once next round has begun
+            logged_match_.actions.push_back({ true, {}, {} });
+
         break;
     }
 
     return {}; // Command was handled successfully, nothing more to do
 }
 
-void MinigameService::handleMove(const std::string_view move_command_args) {
-    // Parses coordinates arguments
-    const MoveActionParser move_parser { move_command_args };
+void MinigameService::emitSquareStates(const GridUpdate& updates,
+                                       const std::initializer_list<std::uint64_t> targets) {
+
+    for (const auto& [square, updatedState] : updates.updatedSquares) {
+        emitEvent("SQUARE_STATE " + std::to_string(square.line) + ' ' + std::to_string(square.column)
+                  + ' ' + std::string { stateArg(updatedState) }, targets);
+    }
+
+    const auto [from_line, from_column] { updates.moveOrigin };
+    const auto [to_line, to_column] { updates.moveDestination };
+
+    // Syncs clients with pawn concerned by this move
+    emitEvent("MOVED " + std::to_string(from_line) + ' ' + std::to_string(from_column)
+              + ' ' + std::to_string(to_line) + ' ' + std::to_string(to_column), targets);
+}
+
+void MinigameService::emitGridDelta(const GridUpdate& updates, const std::initializer_list<std::uint64_t> targets) {
+    const auto [from_line, from_column] { updates.moveOrigin };
+    const auto [to_line, to_column] { updates.moveDestination };
+
+    std::string grid_delta_command {
+        "GRID_DELTA " + std::to_string(from_line) + ' ' + std::to_string(from_column)
+        + ' ' + std::to_string(to_line) + ' ' + std::to_string(to_column)
+    };
+
+    // Coordinates take at most 2 digits each, and a state takes at most 5 chars
+    grid_delta_command.reserve(grid_delta_command.size() + updates.updatedSquares.size() * 12);
+
+    // Each updated square is appended as coordinates followed by its new state
+    for (const auto& [square, updatedState] : updates.updatedSquares) {
+        grid_delta_command += ' ';
+        grid_delta_command += std::to_string(square.line);
+        grid_delta_command += ' ';
+        grid_delta_command += std::to_string(square.column);
+        grid_delta_command += ' ';
+        grid_delta_command += stateArg(updatedState);
+    }
+
+    emitEvent(grid_delta_command, targets);
+}
+
+void MinigameService::emitSnapshot(const std::uint64_t actor) {
+    const Grid& grid { current_game_->grid() };
+    const Player round { current_game_->currentRound() };
+
+    std::string snapshot_command {
+        "SNAPSHOT " + std::to_string(white_player_actor_) + ' ' + std::to_string(black_player_actor_)
+        + (round == Player::White ? " WHITE " : " BLACK ")
+        + std::to_string(current_game_->pawnsFor(Player::White)) + ' '
+        + std::to_string(current_game_->pawnsFor(Player::Black)) + ' '
+        + std::to_string(grid.linesCount()) + ' ' + std::to_string(grid.columnsCount()) + ' '
+    };
+
+    snapshot_command.reserve(snapshot_command.size() + grid.linesCount() * grid.columnsCount());
+
+    // Squares are appended line after line, one char each, so whole grid is a single argument
+    for (int line { 1 }; line <= grid.linesCount(); line++) {
+        for (int column { 1 }; column <= grid.columnsCount(); column++)
+            snapshot_command += stateChar(grid[{ line, column }]);
+    }
+
+    emitEvent(snapshot_command, { actor });
+}
+
+void MinigameService::handleMove(const MinigameRequestParser& move_request) {
+    // Parses coordinates arguments, continuing after MOVE action
+    const MoveActionParser move_parser { move_request };
+
+    if (!move_parser.isValid()) // Coordinates must be given as 4 integers
+        throw RpT::Core::BadServiceRequest { "MOVE args must be 4 integer coordinates" };
 
     // Checks that any move can still be performed
     if (current_game_->isRoundTerminated())
         throw BadBoardGameState { "Cannot make any move, round terminated" };
 
     // Plays move for received coordinates saving every update which occurred into the grid
-    const GridUpdate unsync_updates { current_game_->play(move_parser.from(), move_parser.to()) };
-
-    // Syncs every square that were updated by this move
-    for (const auto& [square, updatedState] : unsync_updates.updatedSquares) {
-        std::string square_state_sync_arg; // Argument for SQUARE_STATE command corresponding to stringified state
-        switch (updatedState) { // Stringifies new state to append it to command
-        case Square::Free:
-            square_state_sync_arg = "FREE";
-            break;
-        case Square::White:
-            square_state_sync_arg = "WHITE";
-            break;
-        case Square::Black:
-            square_state_sync_arg = "BLACK";
-            break;
-        }
+    const GridUpdate unsync_updates { [this, &move_parser]() {
+        const RpT::Utils::AllocationScope games_allocations { RpT::Utils::AllocationSubsystem::Games };
 
-        emitEvent("SQUARE_STATE " + std::to_string(square.line) + ' ' + std::to_string(square.column)
-                  + ' ' + square_state_sync_arg);
-    }
+        return current_game_->play(move_parser.from(), move_parser.to());
+    }() };
 
-    const auto [from_line, from_column] { unsync_updates.moveOrigin };
-    const auto [to_line, to_column] { unsync_updates.moveDestination };
+    if (match_log_) // Move was accepted by board game
+        logged_match_.actions.push_back({ false, move_parser.from(), move_parser.to() });
 
-    // Syncs clients with pawn concerned by this move
-    emitEvent("MOVED " + std::to_string(from_line) + ' ' + std::to_string(from_column)
-              + ' ' + std::to_string(to_line) + ' ' + std::to_string(to_column));
+    const bool white_grid_delta { grid_delta_actors_.count(white_player_actor_) == 1 };
+    const bool black_grid_delta { grid_delta_actors_.count(black_player_actor_) == 1 };
+
+    // Syncs every square that were updated by this move and the moved pawn, using the format enabled by each player
+    if (white_grid_delta && black_grid_delta) {
+        emitGridDelta(unsync_updates, {});
+    } else if (!white_grid_delta && !black_grid_delta) {
+        emitSquareStates(unsync_updates, {});
+    } else { // Each player has its own format
+        const std::uint64_t grid_delta_actor { white_grid_delta ? white_player_actor_ : black_player_actor_ };
+        const std::uint64_t square_states_actor { white_grid_delta ? black_player_actor_ : white_player_actor_ };
+
+        emitGridDelta(unsync_updates, { grid_delta_actor });
+        emitSquareStates(unsync_updates, { square_states_actor });
+    }
 
     // Syncs clients with new pawns count for each player, so they don't need to recalculate it themselves
     emitEvent("PAWN_COUNTS " + std::to_string(current_game_->pawnsFor(Player::White)) + ' '
@@ -191,6 +331,7 @@ void MinigameService::handleMove(const std::string_view move_command_args) {
 
         // Sync clients and stop game as a player has won
         emitEvent("VICTORY_FOR " + victory_command_arg);
+        logMatch(*possible_winner == Player::White ? MatchResult::WhiteVictory : MatchResult::BlackVictory);
         stop();
 
         current_game_.reset(); // Stops current game by deleting it once it has been stopped properly with SE sent
@@ -204,15 +345,40 @@ void MinigameService::stop() {
     if (!current_game_) // Checks for a game to be currently running
         throw BadBoardGameState { "Game is not running" };
 
+    logMatch(MatchResult::Stopped); // Does nothing if match has already been logged with a victory
     current_game_.reset(); // Stops current game by deleting it
 
     emitEvent("STOP"); // Sync clients with new game state
 }
 
+void MinigameService::logMatch(const MatchResult result) {
+    if (!match_pending_) // Victory logs match before stopping game, which must not log it again
+        return;
+
+    logged_match_.result = result;
+    match_log_->append(logged_match_);
+    match_pending_ = false;
+}
+
 bool MinigameService::isStarted() const {
     // If pointer is holding a value to a board game, then it is currently running
     return static_cast<bool>(current_game_);
 }
 
+const BoardGame& MinigameService::game() const {
+    if (!current_game_) // Checks for a game to be currently running
+        throw BadBoardGameState { "Game is not running" };
+
+    return *current_game_;
+}
+
+std::uint64_t MinigameService::currentActor() const {
+    return game().currentRound() == Player::White ? white_player_actor_ : black_player_actor_;
+}
+
+void MinigameService::forgetActor(const std::uint64_t actor) {
+    grid_delta_actors_.erase(actor);
+}
+
 
 }
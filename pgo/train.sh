@@ -0,0 +1,100 @@
+#!/bin/bash
+
+
+## Escape consts
+RESET="\033[m"
+BRIGHT_RED="\033[91m"
+
+
+## Trains binaries instrumented with RPT_PGO=GENERATE, writing execution profiles used by RPT_PGO=USE build
+#
+# Usage: pgo/train.sh [build_dir]
+#
+# Server is first run with loopback backend playing bundled script for each game, so parsing and dispatching code is
+# trained without any network noise. Then it is run with unsafe-ws backend, under load generator clients playing bundled
+# scenario. Server is stopped using SIGTERM, so it shuts down normally and profiles are written.
+#
+# Environment variables:
+# RPT_PGO_LOOPBACK_RUNS : Number of times loopback script is played in a row for each game (default: 200)
+# RPT_PGO_CLIENTS : Number of load generator clients (default: 64)
+# RPT_PGO_DURATION : Load generator duration in seconds (default: 20)
+# RPT_PGO_PORT : Port used by server under load generator (default: 35557)
+
+training_dir="$(cd "$(dirname "$0")" && pwd)"
+build_dir="${1:-build}"
+
+server="$build_dir/minigames-server/minigames-server"
+loadgen="$build_dir/minigames-loadgen/minigames-loadgen"
+
+loopback_runs="${RPT_PGO_LOOPBACK_RUNS:-200}"
+clients="${RPT_PGO_CLIENTS:-64}"
+duration="${RPT_PGO_DURATION:-20}"
+port="${RPT_PGO_PORT:-35557}"
+
+if [ ! -x "$server" ] || [ ! -x "$loadgen" ]; then
+  echo -e "${BRIGHT_RED}Server and load generator must be built inside $build_dir first.${RESET}"
+  exit 1
+fi
+
+work_dir="$(mktemp -d)"
+trap 'rm -r -f "$work_dir"' EXIT
+
+# Loopback script played many times in a row, clients leave at the end of each run so they can join again
+for ((run = 0; run < loopback_runs; run++)); do
+  cat "$training_dir/training.rptl"
+done > "$work_dir/training.rptl"
+
+# Same script for every game, moves invalid for a game are rejected, which is trained too
+for game in a b c; do
+  echo "Training with loopback backend on game $game..."
+
+  if ! "$server" --game "$game" --net-backend loopback --loopback-script "$work_dir/training.rptl" \
+      > "$work_dir/loopback-$game.log" 2>&1; then
+    echo -e "${BRIGHT_RED}Loopback training failed, see server logs:${RESET}"
+    tail -n 20 "$work_dir/loopback-$game.log"
+    exit 2
+  fi
+done
+
+echo "Training with load generator for ${duration}s..."
+
+# Rooms for every client to have a seat, spectators are trained by loopback script already
+rooms=$(((clients + 1) / 2))
+
+"$server" --game a --net-backend unsafe-ws --port "$port" --rooms "$rooms" --ready-file "$work_dir/ready" \
+  > "$work_dir/server.log" 2>&1 &
+server_pid=$!
+
+# Waits for server to listen, and fails if it stopped meanwhile
+while [ ! -f "$work_dir/ready" ]; do
+  if ! kill -0 "$server_pid" 2> /dev/null; then
+    echo -e "${BRIGHT_RED}Server stopped before being ready, see server logs:${RESET}"
+    tail -n 20 "$work_dir/server.log"
+    exit 2
+  fi
+
+  sleep 0.1
+done
+
+"$loadgen" --net-backend unsafe-ws --port "$port" --clients "$clients" --duration "$duration" \
+  --scenario "$training_dir/training-scenario.txt"
+loadgen_status=$?
+
+# Normal shutdown, so instrumented server writes its profile at exit
+kill -TERM "$server_pid"
+wait "$server_pid"
+server_status=$?
+
+if [ $loadgen_status -ne 0 ] || [ $server_status -ne 0 ]; then
+  echo -e "${BRIGHT_RED}Load generator training failed, see server logs:${RESET}"
+  tail -n 20 "$work_dir/server.log"
+  exit 2
+fi
+
+# Clang writes raw profiles which must be merged before being used, GCC profiles are used as is
+profiles_dir="$(sed -n 's/^RPT_PGO_DIR:PATH=//p' "$build_dir/CMakeCache.txt")"
+if compgen -G "$profiles_dir/*.profraw" > /dev/null; then
+  "${LLVM_PROFDATA:-llvm-profdata}" merge -output="$profiles_dir/default.profdata" "$profiles_dir"/*.profraw || exit 2
+fi
+
+echo "Training done."
@@ -0,0 +1,113 @@
+#ifndef RPT_MINIGAMES_SERVER_ACTORUIDSSET_HPP
+#define RPT_MINIGAMES_SERVER_ACTORUIDSSET_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+/**
+ * @file ActorUidsSet.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief Set of actor UIDs stored inline while it is small, used to select which actors must receive a Service Event
+ *
+ * Most events are targeting 1 or 2 actors, so up to `INLINE_CAPACITY` UIDs are stored inside instance itself without
+ * any heap allocation. Larger sets are moved into a heap allocated buffer. UIDs are kept in insertion order, lookups
+ * are linear as sets are expected to be small.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class ActorUidsSet {
+public:
+    /// Maximum number of UIDs stored without heap allocation
+    static constexpr std::size_t INLINE_CAPACITY { 4 };
+
+private:
+    std::array<std::uint64_t, INLINE_CAPACITY> inline_uids_;
+    // Only used once set is too large for inline storage
+    std::vector<std::uint64_t> heap_uids_;
+    std::size_t size_;
+
+    /// Checks if UIDs have been moved into heap allocated buffer
+    bool isInline() const;
+
+public:
+    /// Constructs empty set
+    ActorUidsSet();
+
+    /**
+     * @brief Constructs set containing each given UID once
+     *
+     * @param actor_uids UIDs to insert, duplicates are ignored
+     */
+    ActorUidsSet(std::initializer_list<std::uint64_t> actor_uids);
+
+    /**
+     * @brief Constructs set containing each UID inside given range once
+     *
+     * @tparam InputIterator Iterator type for range of UIDs
+     *
+     * @param begin Range beginning
+     * @param end Range end
+     */
+    template<typename InputIterator>
+    ActorUidsSet(InputIterator begin, InputIterator end) : ActorUidsSet {} {
+        for (InputIterator actor_uid { begin }; actor_uid != end; actor_uid++)
+            insert(*actor_uid);
+    }
+
+    /**
+     * @brief Checks if two sets contain same UIDs, no matter their order
+     *
+     * @param rhs Set to compare with this instance
+     *
+     * @returns `true` if both sets contain same UIDs, `false` otherwise
+     */
+    bool operator==(const ActorUidsSet& rhs) const;
+
+    /// Returns the opposite of `operator==`
+    bool operator!=(const ActorUidsSet& rhs) const;
+
+    /**
+     * @brief Inserts given UID if it isn't already inside set
+     *
+     * @param actor_uid UID to insert
+     *
+     * @returns `true` if UID was inserted, `false` if it was already inside set
+     */
+    bool insert(std::uint64_t actor_uid);
+
+    /**
+     * @brief Checks if given UID is inside set
+     *
+     * @param actor_uid UID to look for
+     *
+     * @returns `true` if set contains given UID, `false` otherwise
+     */
+    bool contains(std::uint64_t actor_uid) const;
+
+    /// Retrieves number of UIDs inside set
+    std::size_t size() const;
+
+    /// Checks if set doesn't contain any UID
+    bool empty() const;
+
+    /// Retrieves iterator to first UID
+    const std::uint64_t* begin() const;
+
+    /// Retrieves iterator past last UID
+    const std::uint64_t* end() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_ACTORUIDSSET_HPP
@@ -2,16 +2,31 @@
 #define RPTOGETHER_SERVER_EXECUTOR_HPP
 
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 #include <RpT-Core/InputOutputInterface.hpp>
+#include <RpT-Core/Room.hpp>
+#include <RpT-Core/RoomScheduler.hpp>
 #include <RpT-Core/Service.hpp>
 #include <RpT-Core/ServiceEventRequestProtocol.hpp>
+#include <RpT-Core/ServiceTask.hpp>
+#include <RpT-Core/TaskPool.hpp>
 #include <RpT-Core/Timer.hpp>
+#include <RpT-Utils/FlatHashMap.hpp>
+#include <RpT-Utils/IterationArena.hpp>
 #include <RpT-Utils/LoggerView.hpp>
+#include <RpT-Utils/LoadMonitor.hpp>
+#include <RpT-Utils/LoopTracer.hpp>
+#include <RpT-Utils/PipelineLatencies.hpp>
+#include <RpT-Utils/RuntimeMetrics.hpp>
+#include <RpT-Utils/SlowRequestSampler.hpp>
 
 /**
  * @file Executor.hpp
@@ -46,15 +61,22 @@ public:
  * When input event of a certain type is received, event type default handler is executed first, then user-provided
  * handler is called with input event as only argument.
  *
- * After event specific handlers have been called, %Executor will check for Timer instances in services which are
- * into Ready state (waiting for countdown). All of them will be registered with their token inside pending timers
- * registry, then `InputOutputInterface` implementation will do its job and begin waiting timers countdown.
+ * After event specific handlers have been called, routine handler, which is user-provided, is called to make
+ * application progress with updated Services state. Then, all events emitted by Services are sent to actors.
  *
- * After required timers countdown have begun, routine handler, which is user-provided, is called to
- * make application progress with updated Services state.
+ * If inputs batching is enabled with `batchInputs()`, these steps are repeated for every input event already ready,
+ * up to batch size, without waiting. Ready `TimerEvent`s don't count toward batch size, so timers triggered together
+ * by IO interface thanks to their slack (see `Timer::slack()`) are handled inside a single iteration.
  *
- * Finally, all events emitted by Services are sent to actors. Then, if IO interface is still open, next input event
- * is waited for.
+ * If rooms scheduling is enabled with `scheduleRooms()`, rooms part of each batch input events handling, from rooms
+ * default handlers to rooms service events polling, runs on a pool of workers once whole batch has been received.
+ *
+ * Finally, %Executor will check for Timer instances in services which entered Ready state (waiting for countdown).
+ * All of them will be registered with their token inside pending timers registry, then `InputOutputInterface`
+ * implementation will do its job and begin waiting timers countdown. Tasks submitted by services are registered the
+ * same way, then run by a pool of workers, each of them being completed by submitting service room once its
+ * `TaskCompletedEvent` has been emitted by IO interface. Then, if IO interface is still open, next input event is
+ * waited for.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
@@ -92,8 +114,8 @@ private:
         Executor& instance_;
         // Provided by Executor
         const Utils::LoggerView logger_;
-        // Executor::run() scoped SER Protocol instance, not available during configuration
-        ServiceEventRequestProtocol* ser_protocol_;
+        // Executor::run() scoped rooms registry, not available during configuration
+        Rooms* rooms_;
 
         /*
          * Default constructible routines
@@ -104,14 +126,15 @@ private:
         InputEventHandler<TimerEvent> userTimerHandler;
         InputEventHandler<JoinedEvent> userJoinedHandler;
         InputEventHandler<LeftEvent> userLeftHandler;
+        InputEventHandler<TaskCompletedEvent> userTaskCompletedHandler;
 
     public:
-        /// Constructs visitor in configuration mode (SER Protocol instance not initialized yet)
+        /// Constructs visitor in configuration mode (rooms registry not initialized yet)
         explicit InputEventVisitor(Executor& running_instance);
 
         /// Checks if events visitor is ready for executor to run, or if it is still into configuration mode
         /// Defines if Executor current instance is running or not, as visitor must be marked as configured as soon
-        /// as main loop start and SER Protocol instance is provided
+        /// as main loop start and rooms registry is provided
         bool isConfigured() const;
 
         /// Checks for each available input event type and updates appropriate handler
@@ -130,25 +153,61 @@ private:
                 updatedHandler = &userJoinedHandler;
             else if constexpr (std::is_same_v<LeftEvent, InputEventT>)
                 updatedHandler = &userLeftHandler;
+            else if constexpr (std::is_same_v<TaskCompletedEvent, InputEventT>)
+                updatedHandler = &userTaskCompletedHandler;
             else // Other are unsupported
                 throw std::logic_error { "Unsupported InputEvenT" };
 
             *updatedHandler = std::move(event_handler);
         }
 
-        /// Finish configuration mode, providing run() scoped SER Protocol instance
-        void markReady(ServiceEventRequestProtocol& ser_protocol);
+        /// Finish configuration mode, providing run() scoped rooms registry
+        void markReady(Rooms& rooms);
 
         /// No default behavior
         void operator()(NoneEvent event) const;
-        /// Default behavior: handles SR command, and send back response to actor who emitted event
+        /// Default behavior: handles SR command inside actor room, and send back response to actor who emitted event
         void operator()(ServiceRequestEvent event) const;
         /// Default behavior: marks timer with given token as triggered ans removes it from pending timers registry
         void operator()(TimerEvent event) const;
-        /// No default behavior
+        /// Default behavior: assigns actor to a room
         void operator()(JoinedEvent event) const;
-        /// No default behavior
+        /// Default behavior: removes actor from its room
         void operator()(LeftEvent event) const;
+        /// Default behavior: completes task with given token inside its room and removes it from pending tasks registry
+        void operator()(TaskCompletedEvent event) const;
+    };
+
+    /// SR command response which has to be sent back to actor
+    struct ReplyOutput {
+        std::uint64_t actor;
+        std::string sr_response;
+    };
+
+    /// Pipeline which has to be closed with given error, as SR command couldn't be parsed
+    struct ClosedPipelineOutput {
+        std::uint64_t actor;
+        std::string error;
+    };
+
+    /// Output produced by a room while it handles input events, sent by Executor thread
+    using RoomOutput = std::variant<ReplyOutput, ClosedPipelineOutput, ServiceEvent>;
+
+    /// Input event to handle inside a room, with timer to trigger if it is a timer event
+    struct RoomInput {
+        AnyInputEvent event;
+        Timer* triggered_timer;
+        // Task to complete, if any
+        std::shared_ptr<ServiceTask> completed_task;
+        // Ring context written while SR command goes through room, if it is sampled
+        Utils::SampledRequest* sampled_request;
+    };
+
+    /// Inputs a room must handle for current batch, with outputs it produced
+    struct RoomJob {
+        Room* room;
+        std::vector<RoomInput> inputs;
+        std::vector<RoomOutput> outputs;
     };
 
     Utils::LoggingContext& logger_context_;
@@ -156,7 +215,101 @@ private:
     InputOutputInterface& io_interface_;
     InputEventVisitor events_visitor_;
     std::function<void()> loop_routine_;
-    std::unordered_map<std::uint64_t, std::reference_wrapper<Timer>> pending_timers_;
+    // Each pending timer with room it was began for
+    Utils::FlatHashMap<std::uint64_t, std::pair<std::reference_wrapper<Timer>, Room*>> pending_timers_;
+    // Each submitted task not completed yet with room it was submitted from
+    Utils::FlatHashMap<std::uint64_t, std::pair<std::shared_ptr<ServiceTask>, Room*>> pending_tasks_;
+    std::uint64_t tasks_count_;
+    std::size_t task_workers_;
+    // run() scoped, only started once a task has been submitted, or before main loop thread is pinned
+    std::optional<TaskPool> task_pool_;
+    // Reused at each loop iteration to retrieve submitted tasks
+    std::vector<ServiceTask> submitted_tasks_;
+    std::size_t inputs_batch_size_;
+    // Room for input events which aren't related to any room, if any
+    Room* default_room_;
+    // Room current input event was handled inside, if any
+    Room* input_room_;
+    std::size_t room_workers_;
+    // run() scoped, only if rooms scheduling is enabled
+    RoomScheduler* room_scheduler_;
+    // Jobs for rooms with inputs inside current batch, allocated capacities are reused
+    std::vector<RoomJob> room_jobs_;
+    std::size_t room_jobs_count_;
+    // Rebuilt for each batch from iteration arena, if any, as arena memory is reused by next iteration
+    std::optional<std::pmr::unordered_map<const Room*, std::size_t>> room_jobs_index_;
+    std::vector<RoomScheduler::Step> room_steps_;
+    // Rooms which handled input events inside current batch, listed once
+    std::vector<Room*> batch_rooms_;
+    // Reused at each loop iteration to retrieve Ready timers without allocating
+    std::vector<Timer*> ready_timers_;
+    // Pipeline stages latencies are recorded into, if any
+    Utils::PipelineLatencies* latencies_;
+    // Runtime metrics updated while handling input events, if any
+    Utils::RuntimeMetrics* metrics_;
+    // SR commands pipeline contexts are sampled into, if any
+    Utils::SlowRequestSampler* slow_requests_;
+    // Context for current input event, if it is a sampled SR command
+    Utils::SampledRequest* input_sample_;
+    // Reused at each loop iteration to retrieve slow requests to log
+    std::vector<Utils::SampledRequest> unreported_slow_requests_;
+    // Main loop iterations are traced into, if any
+    Utils::LoopTracer* tracer_;
+    // Main loop busy and waiting times are reported to, if any
+    Utils::LoadMonitor* load_;
+    // Transient data of each iteration is allocated from, and reset at iteration end, if any
+    Utils::IterationArena* arena_;
+    // CPU core main loop thread is pinned to, if any
+    std::optional<std::size_t> loop_cpu_;
+    // CPU cores rooms workers threads are pinned to, empty if they aren't pinned
+    std::vector<std::size_t> room_workers_cpus_;
+
+    /// Starts workers running tasks submitted by services
+    void startTaskPool();
+
+    /// Retrieves current batch job for given room, listing room for current batch if it isn't yet
+    RoomJob& jobFor(Room& room);
+
+    /// Handles room part of given input event now, or queues it for room step if rooms scheduling is enabled
+    void handleInsideRoom(Room& room, RoomInput input);
+
+    /// Handles room part of given input event inside given room, without any access to Executor state, so it can run
+    /// on any worker
+    static void handleRoomInput(Room& room, const RoomInput& input, std::vector<RoomOutput>& outputs,
+                                Utils::PipelineLatencies* latencies, Utils::RuntimeMetrics* metrics);
+
+    /// Calls routine for given room then polls its service events, without any access to Executor state, so it can
+    /// run on any worker
+    static void syncRoom(Room& room, std::vector<RoomOutput>& outputs, Utils::PipelineLatencies* latencies);
+
+    /// Room step unit: handles every queued input for job room, room being synced after each of them
+    static void stepRoom(RoomJob& job, Utils::PipelineLatencies* latencies, Utils::RuntimeMetrics* metrics,
+                         Utils::SlowRequestSampler* slow_requests);
+
+    /// Stamps sync end for given SR command context, with service events polled for it, then reports it to sampler
+    static void finishSample(Utils::SlowRequestSampler& slow_requests, Utils::SampledRequest& sampled_request,
+                             std::size_t polled_events);
+
+    /// Logs slow SR commands reported by sampler since last iteration
+    void logSlowRequests();
+
+    /// Sends given outputs with IO interface, in order, then clears them
+    void sendRoomOutputs(std::vector<RoomOutput>& outputs);
+
+    /// Runs every queued room job with rooms scheduler, then sends their outputs
+    void runRoomJobs();
+
+    /// Recycles events storage of current batch rooms, as every event they emitted has been sent
+    void recycleEventsStorage();
+
+    /// Runs tasks submitted by current batch rooms on tasks pool, starting it if it isn't yet
+    void beginSubmittedTasks();
+
+    /// Begins countdown for timers listed as Ready by current batch rooms, then clears batch rooms
+    void beginReadyTimers();
+
+    /// Runs main loop with given rooms registry, see `run()`
+    bool runLoop(Rooms& rooms);
 
 public:
     /**
@@ -207,12 +360,167 @@ public:
      * Put into this routine every action or check that must be performed every time the application continue its
      * execution, no matter what type of input event where emitted.
      *
-     * @param loop_routine Routine to call after input event specific handling for each main loop iteration
+     * @param loop_routine Routine to call after each input event specific handling
      *
      * @throws BadExecutorMode if `run()` has already been called
      */
     void make(std::function<void()> loop_routine);
 
+    /**
+     * @brief Setup maximum number of input events handled for each main loop iteration
+     *
+     * After first input event has been waited for, every input event already ready is handled, up to given number,
+     * before timers countdowns begin and IO interface is waited for again, so clients are synced once for the whole
+     * batch. Loop's routine and service events polling still happen for each input event, so SRR and SE keep their
+     * order. Timer events aren't counted. Default is 1, handling a single input event for each iteration, along with
+     * every timer event ready before it.
+     *
+     * @param inputs_batch_size Maximum number of input events for each main loop iteration
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     * @throws std::invalid_argument if given size is 0
+     */
+    void batchInputs(std::size_t inputs_batch_size);
+
+    /**
+     * @brief Setup number of workers running rooms part of input events handling
+     *
+     * With more than 1 worker, input events for a whole batch are received first, rooms being assigned and
+     * user-provided handlers being called for each of them. Then, every room with input events runs its step on a
+     * pool of workers: its default handlers, routine and service events polling for each of its input events. Rooms
+     * steps are independent, a room being handled by a single worker at a time, so services don't require any lock.
+     * Outputs are sent by %Executor thread once every step is done, in order for each room.
+     *
+     * As user-provided handlers and loop's routine run before rooms steps, they must not access rooms services. Rooms
+     * actors are updated as soon as an actor joins or leaves, for the whole batch. Default is 1, every input event being
+     * handled sequentially by %Executor thread.
+     *
+     * @note Every room services must only share their timers tokens provider, which must not create any timer while
+     * rooms steps are running.
+     *
+     * @param workers_count Number of workers, including %Executor thread
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     * @throws std::invalid_argument if given count is 0
+     */
+    void scheduleRooms(std::size_t workers_count);
+
+    /**
+     * @brief Setup number of workers running tasks submitted by services with `ServiceContext::submitTask()`
+     *
+     * Tasks pool is only started once first task has been submitted. Default is 1 worker.
+     *
+     * @param workers_count Number of worker threads, in addition to %Executor thread
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     * @throws std::invalid_argument if given count is 0
+     */
+    void offloadTasks(std::size_t workers_count);
+
+    /**
+     * @brief Setup CPU core main loop thread is pinned to once `run()` has been called
+     *
+     * Rooms and tasks workers are started before pinning, so they don't inherit main loop thread affinity. Combined
+     * with IO interface busy-poll, it keeps caches warm and avoids migrations for latency sensitive hosts. Disabled by
+     * default.
+     *
+     * @param cpu Index of CPU core, pinning failure will be thrown by `run()` as `std::system_error`
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void pinLoopThread(std::size_t cpu);
+
+    /**
+     * @brief Setup CPU cores rooms workers threads are pinned to, if rooms scheduling is enabled
+     *
+     * Workers threads, excluding %Executor thread, are pinned in order to listed cores, cycling if there are less cores
+     * than threads. As a room step is preferably run by same worker, room state stays in caches of that worker core.
+     * Cores should be on %Executor thread NUMA node, as rooms are opened by it. Disabled by default.
+     *
+     * @param cpus Indices of CPU cores, pinning failure will be thrown by `run()` as `std::system_error`
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void pinRoomWorkers(std::vector<std::size_t> cpus);
+
+    /**
+     * @brief Setup latencies recording for pipeline stages handled by executor
+     *
+     * Receive stage is recorded for each input event stamped by IO interface, when %Executor begins to handle it.
+     * Dispatch stage is recorded for each SR command handled by a room, and polling stage each time a room polls its
+     * service events. Every service records its own SR commands handling. Disabled by default.
+     *
+     * @param latencies Histograms to record into, must outlive executor run
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void recordLatencies(Utils::PipelineLatencies& latencies);
+
+    /**
+     * @brief Setup sampling of SR commands pipeline contexts
+     *
+     * For each SR command handled inside a room, actor, intended service, stages time points, request and response
+     * sizes and IO interface queue depth are written into sampler ring. Commands which took longer than sampler
+     * threshold from their read to their room sync are logged as warnings once iteration is done. Disabled by default.
+     *
+     * @param slow_requests Sampler to write contexts into, must outlive executor run, its ring capacity must be
+     * greater than inputs batch size
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void sampleSlowRequests(Utils::SlowRequestSampler& slow_requests);
+
+    /**
+     * @brief Setup runtime metrics updated by executor
+     *
+     * Handled input events, pending timers, occupied rooms and SR commands results for each service are counted.
+     * Disabled by default.
+     *
+     * @param metrics Metrics to update, must outlive executor run
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void recordMetrics(Utils::RuntimeMetrics& metrics);
+
+    /**
+     * @brief Setup main loop iterations tracing
+     *
+     * Each iteration records spans for input waiting, handling of each input event named after its type, loop's
+     * routine, room sync, next input polling, rooms steps and timers countdowns beginning. If a dump has been requested
+     * meanwhile, trace is written once iteration is done. Disabled by default.
+     *
+     * @param tracer Tracer to record spans into, must outlive executor run
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void recordTrace(Utils::LoopTracer& tracer);
+
+    /**
+     * @brief Setup main loop load monitoring
+     *
+     * Each iteration reports time spent waiting for an input event, time spent busy with its batch, and input events
+     * still pending inside IO interface once it's done. Overload state changes are logged, and exported with runtime
+     * metrics if they are recorded. Disabled by default.
+     *
+     * @param load_monitor Monitor to report iterations to, must outlive executor run
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void monitorLoad(Utils::LoadMonitor& load_monitor);
+
+    /**
+     * @brief Setup arena for transient data of each main loop iteration
+     *
+     * Batch rooms index is allocated from arena, which is reset at the end of each iteration, so other components
+     * sharing it, like IO interface formatting RPTL messages, can allocate their transient data from it too. Disabled
+     * by default, heap is used instead.
+     *
+     * @param arena Arena to allocate from and reset, must outlive executor run
+     *
+     * @throws BadExecutorMode if `run()` has already been called
+     */
+    void useIterationArena(Utils::IterationArena& arena);
+
     /**
      * @brief Starts executor main loop
      *
@@ -220,11 +528,26 @@ public:
      * conditions.
      *
      * @param services Access to services which will be registered inside `run()` local `ServiceEventRequestProtocol`
-     * instance.
+     * instance, all of them running inside a single room hosting every actor.
      *
      * @returns `true` if properly shutdown, `false` if an error occurred
      */
     bool run(std::initializer_list<std::reference_wrapper<Service>> services);
+
+    /**
+     * @brief Starts executor main loop with many independent rooms, each actor being assigned to a room when it joins
+     *
+     * Room for each input event is the one of actor who triggered it, or the one timer was began for. Room routine and
+     * Service Events polling are only done for that room. Input events which aren't related to any room, like
+     * `NoneEvent`, don't have any room handling them.
+     *
+     * @param room_factory Constructs each room when no opened room is waiting for players or empty
+     * @param match_bucket Splits actors into match buckets, for example by latency or skill, every actor inside same
+     * bucket if empty
+     *
+     * @returns `true` if properly shutdown, `false` if an error occurred
+     */
+    bool runRooms(Rooms::RoomFactory room_factory, Rooms::MatchBucket match_bucket = nullptr);
 };
 
 
@@ -1,6 +1,7 @@
 #ifndef RPTOGETHER_SERVER_INPUTEVENT_HPP
 #define RPTOGETHER_SERVER_INPUTEVENT_HPP
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 #include <stdexcept>
@@ -25,17 +26,24 @@ namespace RpT::Core {
  * Each event type might provides more informations about input event. Should be visited using visitor pattern to access
  * those informations.
  *
+ * Event types are only held by value inside `AnyInputEvent` variant and never deleted through base class, so base
+ * class has no vtable and moving an event is moving its fields only.
+ *
  * Events are received and emitted by actors. An actor is a connected client who can interferes with server
  * execution, by sending Service Request command, as an example. Each actor is identified with UID, a 64bits unsigned
  * integer.
  *
+ * An event triggered by a client message might be stamped with time message was received at, so latency until it is
+ * handled can be measured.
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class InputEvent {
 private:
     std::uint64_t actor_;
+    std::chrono::steady_clock::time_point received_at_;
 
-public:
+protected:
     /**
      * @brief Base constructor for initializing emitted UID
      *
@@ -43,15 +51,30 @@ public:
      */
     explicit InputEvent(std::uint64_t actor);
 
-    // Necessary for correct deletion of subclasses instances
-    virtual ~InputEvent() = default;
+    // Not virtual, events are never deleted through base class
+    ~InputEvent() = default;
 
+public:
     /**
      * @brief Get actor who emitted this event
      *
      * @returns Actor UID
      */
     std::uint64_t actor() const;
+
+    /**
+     * @brief Get time message which triggered this event was received at
+     *
+     * @returns Receive time point, or default-constructed time point (clock epoch) if event wasn't stamped
+     */
+    std::chrono::steady_clock::time_point receivedAt() const;
+
+    /**
+     * @brief Stamps event with time message which triggered it was received at
+     *
+     * @param received_at Receive time point
+     */
+    void receivedAt(std::chrono::steady_clock::time_point received_at);
 };
 
 /// Event emitted if interface is closed
@@ -174,6 +197,28 @@ public:
     Utils::HandlingResult disconnectionReason() const;
 };
 
+/// Event emitted when work of a task submitted by a service has been done on a worker thread
+class TaskCompletedEvent : public InputEvent {
+private:
+    std::uint64_t token_;
+
+public:
+    /**
+     * @brief Constructs task completed event for task with given token
+     *
+     * @param actor Ignored, tasks are completed by server workers
+     * @param token Token for task which has been completed
+     */
+    explicit TaskCompletedEvent(std::uint64_t actor, std::uint64_t token);
+
+    /**
+     * @brief Retrieves token for task which has been completed
+     *
+     * @returns Token for completed task
+     */
+    std::uint64_t token() const;
+};
+
 
 }
 
@@ -0,0 +1,165 @@
+#ifndef RPT_MINIGAMES_SERVER_INPUTEVENTSLOG_HPP
+#define RPT_MINIGAMES_SERVER_INPUTEVENTSLOG_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <RpT-Core/InputOutputInterface.hpp>
+
+/**
+ * @file InputEventsLog.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief Thrown by `InputEventsLogReader` if log is ill-formed or truncated
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class BadInputEventsLog : public std::runtime_error {
+public:
+    /**
+     * @brief Constructs exception with custom error message
+     *
+     * @param reason Why log couldn't be read
+     */
+    explicit BadInputEventsLog(const std::string& reason) : std::runtime_error { "Input events log: " + reason } {}
+};
+
+
+/**
+ * @brief Input event read from a log, with its time offset since first logged event
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct LoggedInputEvent {
+    /// Time elapsed between first logged event and this one
+    std::chrono::nanoseconds offset;
+    /// Logged event, never stamped with a receive time
+    AnyInputEvent event;
+    /// `true` if event was stamped with time triggering message was received at when it was logged
+    bool stamped;
+};
+
+
+/**
+ * @brief Binary format for input events logs, written by `InputEventsLogWriter` and read by `InputEventsLogReader`
+ *
+ * Log begins with `MAGIC` then `VERSION` byte. Each event is then encoded as a record beginning with its type byte,
+ * `AnyInputEvent` types index, ORed with `STAMPED_FLAG` if event was stamped. Follows an unsigned LEB128 varint for
+ * offset since previous record, in nanoseconds, then a varint for event actor. Event specific fields are appended:
+ * - `ServiceRequestEvent`: varint length then SR command bytes
+ * - `TimerEvent`: varint timer token
+ * - `JoinedEvent`: varint length then actor name bytes
+ * - `LeftEvent`: `0` byte for a clean disconnection, or `1` byte followed by varint length then error message bytes
+ * - `TaskCompletedEvent`: varint task token
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct InputEventsLogFormat {
+    /// Bytes every log begins with
+    static constexpr std::string_view MAGIC { "RPTINPUT" };
+    /// Format version, incremented at each incompatible change
+    static constexpr std::uint8_t VERSION { 1 };
+    /// Type byte flag for stamped events
+    static constexpr std::uint8_t STAMPED_FLAG { 0x80 };
+};
+
+
+/**
+ * @brief Writes input events into a binary log, see `InputEventsLogFormat`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class InputEventsLogWriter {
+private:
+    std::ostream& output_;
+    std::chrono::nanoseconds last_offset_;
+
+public:
+    /**
+     * @brief Writes log header into given stream
+     *
+     * @param output Stream to write log into, must outlive writer
+     */
+    explicit InputEventsLogWriter(std::ostream& output);
+
+    /*
+     * Entity class semantic
+     */
+
+    InputEventsLogWriter(const InputEventsLogWriter&) = delete;
+    InputEventsLogWriter& operator=(const InputEventsLogWriter&) = delete;
+
+    /**
+     * @brief Appends record for given event
+     *
+     * @param offset Time elapsed since first logged event, clamped to previous record offset so records stay ordered
+     * @param event Event to log
+     */
+    void write(std::chrono::nanoseconds offset, const AnyInputEvent& event);
+
+    /// Flushes every written record into underlying stream
+    void flush();
+};
+
+
+/**
+ * @brief Reads input events from a binary log, see `InputEventsLogFormat`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class InputEventsLogReader {
+private:
+    std::istream& input_;
+    std::chrono::nanoseconds last_offset_;
+
+    /// Reads a single byte, throws if log is truncated
+    std::uint8_t readByte();
+
+    /// Reads an unsigned LEB128 varint, throws if log is truncated or varint doesn't fit into 64 bits
+    std::uint64_t readVarint();
+
+    /// Reads a varint length then as many bytes
+    std::string readString();
+
+public:
+    /**
+     * @brief Reads and checks log header from given stream
+     *
+     * @param input Stream to read log from, must outlive reader
+     *
+     * @throws BadInputEventsLog if header is missing or if log was written with another format version
+     */
+    explicit InputEventsLogReader(std::istream& input);
+
+    /*
+     * Entity class semantic
+     */
+
+    InputEventsLogReader(const InputEventsLogReader&) = delete;
+    InputEventsLogReader& operator=(const InputEventsLogReader&) = delete;
+
+    /**
+     * @brief Reads next record
+     *
+     * @returns Next logged event, uninitialized if end of log has been reached
+     *
+     * @throws BadInputEventsLog if record is ill-formed or truncated
+     */
+    std::optional<LoggedInputEvent> next();
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_INPUTEVENTSLOG_HPP
@@ -1,7 +1,8 @@
 #ifndef RPTOGETHER_SERVER_INPUTOUTPUTINTERFACE_HPP
 #define RPTOGETHER_SERVER_INPUTOUTPUTINTERFACE_HPP
 
-#include <boost/variant.hpp>
+#include <optional>
+#include <variant>
 #include <RpT-Core/InputEvent.hpp>
 #include <RpT-Core/ServiceEvent.hpp>
 #include <RpT-Core/Timer.hpp>
@@ -16,7 +17,11 @@ namespace RpT::Core {
 
 
 /// For using visitor pattern on received input event. See `InputOutputInterface::waitForInput()`.
-using AnyInputEvent = boost::variant<NoneEvent, ServiceRequestEvent, TimerEvent, JoinedEvent, LeftEvent>;
+using AnyInputEvent = std::variant<NoneEvent, ServiceRequestEvent, TimerEvent, JoinedEvent, LeftEvent,
+                                   TaskCompletedEvent>;
+
+// Every input event is moved through queue and loop, no event type must be much larger than a service request one
+static_assert(sizeof(AnyInputEvent) <= 64, "Input events must fit into a cache line");
 
 
 /**
@@ -71,15 +76,34 @@ public:
      */
     virtual AnyInputEvent waitForInput() = 0;
 
+    /**
+     * @brief Retrieves an input event only if one already occurred, without blocking
+     *
+     * Used by `Executor` to handle many input events before syncing clients. Default implementation never has any
+     * input event ready.
+     *
+     * @returns Input event if one is ready, uninitialized if `waitForInput()` would have to block
+     */
+    virtual std::optional<AnyInputEvent> pollInput();
+
+    /**
+     * @brief Retrieves number of input events already received but not retrieved yet
+     *
+     * Used by `Executor` to monitor its load. Default implementation doesn't queue any input event.
+     *
+     * @returns Input events waiting to be retrieved
+     */
+    virtual std::size_t pendingInputs() const;
+
     /**
      * @brief Output response to actor for a given service request
      *
      * Allows to inform an actor if a requested succeeded, and if not, what error happened.
      *
      * @param sr_actor Actor for SR command that this SRR is replying for
-     * @param sr_response SRR for received SR command
+     * @param sr_response SRR for received SR command, moved so implementation can prefix it without copying
      */
-    virtual void replyTo(std::uint64_t sr_actor, const std::string& sr_response) = 0;
+    virtual void replyTo(std::uint64_t sr_actor, std::string sr_response) = 0;
 
     /**
      * @brief Dispatch an event emitted by a service to all actors
@@ -97,6 +121,26 @@ public:
      */
     virtual void beginTimer(Timer& ready_timer) = 0;
 
+    /**
+     * @brief Notifies that task with given token has been submitted to a worker thread, so implementation expects
+     * `completeTask()` call for it
+     *
+     * Called by %Executor thread. Default implementation does nothing.
+     *
+     * @param token Token for submitted task
+     */
+    virtual void beginTask(std::uint64_t token);
+
+    /**
+     * @brief Notifies that work for task with given token has been done. Implementation must emit
+     * `TaskCompletedEvent` for task token with any actor, waking up `waitForInput()` if it is blocking.
+     *
+     * @note Called by worker thread which ran task, implementation must be thread-safe.
+     *
+     * @param token Token for task which has run
+     */
+    virtual void completeTask(std::uint64_t token) = 0;
+
     /**
      * @brief Closes pipeline with given actor and shutdown reason so it no longer can emit input events
      *
@@ -0,0 +1,87 @@
+#ifndef RPT_MINIGAMES_SERVER_INPUTRECORDER_HPP
+#define RPT_MINIGAMES_SERVER_INPUTRECORDER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <RpT-Core/InputEventsLog.hpp>
+#include <RpT-Core/InputOutputInterface.hpp>
+
+/**
+ * @file InputRecorder.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief IO interface decorator writing each input event retrieved from recorded interface into a binary log, so
+ * traffic can be replayed later with `InputReplay`
+ *
+ * Every operation is forwarded to recorded interface. Events are timestamped relatively to first recorded event, so
+ * idle time before first client doesn't have to be replayed. Decorator is closed as soon as recorded interface is,
+ * log being flushed at that time.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class InputRecorder : public InputOutputInterface {
+private:
+    InputOutputInterface& recorded_interface_;
+    InputEventsLogWriter log_writer_;
+    // Uninitialized until first event has been recorded
+    std::optional<std::chrono::steady_clock::time_point> first_event_at_;
+    std::uint64_t recorded_events_;
+
+    /// Appends given event into log
+    void record(const AnyInputEvent& event);
+
+    /// Marks decorator as closed and flushes log if recorded interface has been closed
+    void checkClosed();
+
+public:
+    /**
+     * @brief Constructs decorator writing log header into given stream
+     *
+     * @param recorded_interface Interface to retrieve input events from and to forward operations to
+     * @param log Stream to write log into, must outlive decorator
+     */
+    InputRecorder(InputOutputInterface& recorded_interface, std::ostream& log);
+
+    /// Waits for recorded interface input event, then records it
+    AnyInputEvent waitForInput() override;
+
+    /// Polls recorded interface input event, then records it if any
+    std::optional<AnyInputEvent> pollInput() override;
+
+    std::size_t pendingInputs() const override;
+
+    void replyTo(std::uint64_t sr_actor, std::string sr_response) override;
+
+    void outputEvent(const ServiceEvent& event) override;
+
+    void beginTimer(Timer& ready_timer) override;
+
+    void beginTask(std::uint64_t token) override;
+
+    void completeTask(std::uint64_t token) override;
+
+    void closePipelineWith(std::uint64_t actor, const Utils::HandlingResult& clean_shutdown) override;
+
+    /// Closes recorded interface then flushes log
+    void close() override;
+
+    /**
+     * @brief Retrieves number of events written into log
+     *
+     * @returns Recorded events count
+     */
+    std::uint64_t recordedEvents() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_INPUTRECORDER_HPP
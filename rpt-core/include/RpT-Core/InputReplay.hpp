@@ -0,0 +1,139 @@
+#ifndef RPT_MINIGAMES_SERVER_INPUTREPLAY_HPP
+#define RPT_MINIGAMES_SERVER_INPUTREPLAY_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <unordered_set>
+#include <RpT-Core/InputEventsLog.hpp>
+#include <RpT-Core/InputOutputInterface.hpp>
+
+/**
+ * @file InputReplay.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief How fast `InputReplay` feeds logged events
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+enum struct ReplayPace {
+    /// Each event is ready as soon as previous one has been retrieved, measuring maximum throughput
+    Fast,
+    /// Each event is ready once its recorded offset has elapsed since first event was retrieved
+    Original
+};
+
+
+/**
+ * @brief IO interface replaying input events from a log written by `InputRecorder`, so recorded traffic can be fed
+ * into an `Executor` without any client
+ *
+ * Outputs are discarded. Timers begun by executor are only triggered by their logged `TimerEvent`, so replay stays
+ * deterministic. A logged timer event is skipped if its timer isn't pending, which only happens if replaying build
+ * behaves differently from recording one. Same goes for tasks, which are only completed by their logged
+ * `TaskCompletedEvent`, whenever their worker actually ran them. Events stamped when they were recorded are stamped again with time they are
+ * retrieved at, so receive latencies can be compared between builds.
+ *
+ * Interface closes itself once last logged event has been retrieved.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class InputReplay : public InputOutputInterface {
+private:
+    InputEventsLogReader log_reader_;
+    const ReplayPace pace_;
+    // Read ahead, so interface can be closed as soon as last event is retrieved
+    std::optional<LoggedInputEvent> next_event_;
+    // Uninitialized until first event has been retrieved
+    std::optional<std::chrono::steady_clock::time_point> first_event_at_;
+    // Tokens for timers begun by executor and not yet triggered or cleared
+    std::unordered_set<std::uint64_t> pending_timers_;
+    // Tokens for tasks begun by executor and not yet completed
+    std::unordered_set<std::uint64_t> pending_tasks_;
+    std::uint64_t replayed_events_;
+    std::uint64_t skipped_events_;
+
+    /**
+     * @brief Retrieves next logged event which can be replayed, skipping timers and tasks events for timers and tasks
+     * which aren't pending
+     *
+     * @param wait If `true`, waits for event to be ready with original pace, otherwise only retrieves it if it is
+     * ready now
+     *
+     * @returns Replayed event, uninitialized if log is done or if next event isn't ready and mustn't be waited for
+     */
+    std::optional<AnyInputEvent> replayNext(bool wait);
+
+public:
+    /**
+     * @brief Constructs interface reading log header and first record from given stream
+     *
+     * @param log Stream to read log from, must outlive interface
+     * @param pace How fast events are replayed
+     *
+     * @throws BadInputEventsLog if log header or first record is ill-formed
+     */
+    explicit InputReplay(std::istream& log, ReplayPace pace = ReplayPace::Fast);
+
+    /**
+     * @brief Retrieves next logged event, waiting for its offset with original pace
+     *
+     * @returns Next logged event, or a `NoneEvent` if log is done
+     *
+     * @throws BadInputEventsLog if next record is ill-formed
+     */
+    AnyInputEvent waitForInput() override;
+
+    /**
+     * @brief Retrieves next logged event if it is ready
+     *
+     * @returns Next logged event, uninitialized if log is done or if its offset hasn't elapsed yet with original pace
+     *
+     * @throws BadInputEventsLog if next record is ill-formed
+     */
+    std::optional<AnyInputEvent> pollInput() override;
+
+    /// Discarded
+    void replyTo(std::uint64_t sr_actor, std::string sr_response) override;
+
+    /// Discarded
+    void outputEvent(const ServiceEvent& event) override;
+
+    /// Marks timer as pending until its logged timer event is replayed or until it is cleared
+    void beginTimer(Timer& ready_timer) override;
+
+    /// Marks task as pending until its logged task completed event is replayed
+    void beginTask(std::uint64_t token) override;
+
+    /// Discarded, task completion is replayed as logged
+    void completeTask(std::uint64_t token) override;
+
+    /// Discarded, actor events are still replayed as logged
+    void closePipelineWith(std::uint64_t actor, const Utils::HandlingResult& clean_shutdown) override;
+
+    /**
+     * @brief Retrieves number of logged events fed to executor
+     *
+     * @returns Replayed events count
+     */
+    std::uint64_t replayedEvents() const;
+
+    /**
+     * @brief Retrieves number of logged timers and tasks events skipped because their timer or task wasn't pending
+     *
+     * @returns Skipped events count
+     */
+    std::uint64_t skippedEvents() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_INPUTREPLAY_HPP
@@ -0,0 +1,411 @@
+#ifndef RPT_MINIGAMES_SERVER_ROOM_HPP
+#define RPT_MINIGAMES_SERVER_ROOM_HPP
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <RpT-Core/InputEvent.hpp>
+#include <RpT-Core/ServiceEventRequestProtocol.hpp>
+#include <RpT-Utils/LoggingContext.hpp>
+
+/**
+ * @file Room.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/// Thrown by `Room` and `Rooms` when an actor cannot join or leave a room
+class BadRoomActor : public std::logic_error {
+public:
+    /// Constructs error with formatted message from given actor UID and given failure reason
+    BadRoomActor(const std::uint64_t actor, const std::string& reason)
+    : std::logic_error { "Actor " + std::to_string(actor) + ": " + reason } {}
+};
+
+
+/**
+ * @brief Thrown by `Room` operations requiring services while they haven't been registered yet, or by
+ * `Room::runServices()` if they have already been registered
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class BadRoomServices : public std::logic_error {
+public:
+    /// Constructs error for room with given ID and given failure reason
+    BadRoomServices(const std::uint64_t room_id, const std::string& reason)
+    : std::logic_error { "Room " + std::to_string(room_id) + ": " + reason } {}
+};
+
+
+/**
+ * @brief Independent game session, its own services running inside their own SER Protocol instance and only synced
+ * with actors which joined it
+ *
+ * Services Events which target every actor are only sent to room actors, unless room capacity is `UNLIMITED`, which
+ * means room hosts every actor so events are broadcast.
+ *
+ * Room can be constructed directly from already constructed services. Subclasses owning their services must use
+ * protected constructor, then call `runServices()` inside their own constructor once services are constructed. They
+ * can also override `actorJoined()`, `actorLeft()` and `routine()` to make their services progress.
+ *
+ * @note Services inside different rooms should use different `ServiceContext` instances, sharing same timers tokens
+ * provider so tokens are unique inside process.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class Room {
+public:
+    /// Capacity for room hosting every actor
+    static constexpr std::size_t UNLIMITED { std::numeric_limits<std::size_t>::max() };
+
+private:
+    std::uint64_t id_;
+    std::size_t capacity_;
+    std::unordered_set<std::uint64_t> actors_;
+    // Room actors which only watch, subset of actors
+    std::unordered_set<std::uint64_t> spectators_;
+    // Room-wide events which haven't been sent to spectators yet
+    std::vector<ServiceEvent> spectators_backlog_;
+    // Flushed room-wide events, targeting spectators, polled before any other event
+    std::deque<ServiceEvent> spectators_events_;
+    // Initialized once services are registered
+    std::optional<ServiceEventRequestProtocol> ser_protocol_;
+
+    /// Retrieves SER Protocol instance, throws `BadRoomServices` if services haven't been registered yet
+    ServiceEventRequestProtocol& serProtocol();
+
+    /// Same as non-const overload
+    const ServiceEventRequestProtocol& serProtocol() const;
+
+protected:
+    /**
+     * @brief Constructs empty room without any service, subclass must call `runServices()`
+     *
+     * @param id Room unique ID
+     * @param capacity Maximum number of actors inside room
+     */
+    Room(std::uint64_t id, std::size_t capacity);
+
+    /**
+     * @brief Registers given services to run inside room SER Protocol instance
+     *
+     * @param services Services to run, must outlive room
+     * @param logging_context Context for room SER Protocol logging
+     *
+     * @throws BadRoomServices if services have already been registered
+     * @throws ServiceNameAlreadyRegistered if a service name appears twice into services list
+     */
+    void runServices(std::initializer_list<std::reference_wrapper<Service>> services,
+                     Utils::LoggingContext& logging_context);
+
+    /**
+     * @brief Makes given room actor a spectator, or a player again
+     *
+     * Spectators don't receive room-wide events when they are emitted. These events are kept inside a backlog until
+     * `flushSpectators()` is called, then they are all sent to every spectator at once, so cost of broadcasting an
+     * event to players doesn't depend on audience size. Events targeting spectators explicitly are still sent
+     * immediately.
+     *
+     * @param actor UID for actor inside room
+     * @param spectating `true` to make actor a spectator, `false` to make it a player
+     *
+     * @throws BadRoomActor if actor isn't inside room
+     */
+    void setSpectator(std::uint64_t actor, bool spectating);
+
+    /**
+     * @brief Sends every room-wide event kept since previous flush to current spectators, in emission order
+     *
+     * Flushed events are retrieved by next `pollServiceEvent()` calls, as best-effort events. Backlog is dropped if
+     * there isn't any spectator anymore.
+     */
+    void flushSpectators();
+
+    /**
+     * @brief Called by `pollServiceEvent()` when a room-wide event is kept for spectators while backlog was empty,
+     * so subclass can schedule next `flushSpectators()` call. Does nothing by default.
+     */
+    virtual void spectatorsBacklogged();
+
+public:
+    /**
+     * @brief Constructs empty room running given services
+     *
+     * @param id Room unique ID
+     * @param capacity Maximum number of actors inside room
+     * @param services Services to run, must outlive room
+     * @param logging_context Context for room SER Protocol logging
+     *
+     * @throws ServiceNameAlreadyRegistered if a service name appears twice into services list
+     */
+    Room(std::uint64_t id, std::size_t capacity, std::initializer_list<std::reference_wrapper<Service>> services,
+         Utils::LoggingContext& logging_context);
+
+    // Entity class semantic, polymorphic base class
+
+    Room(const Room&) = delete;
+    Room& operator=(const Room&) = delete;
+
+    virtual ~Room() = default;
+
+    /**
+     * @brief Retrieves room ID
+     *
+     * @returns ID given at construction
+     */
+    std::uint64_t id() const;
+
+    /**
+     * @brief Retrieves room capacity
+     *
+     * @returns Maximum number of actors inside room
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Retrieves actors inside room
+     *
+     * @returns UIDs for every actor which joined and hasn't left yet
+     */
+    const std::unordered_set<std::uint64_t>& actors() const;
+
+    /**
+     * @brief Retrieves room actors which are spectators
+     *
+     * @returns UIDs for every spectator, each one also being inside `actors()`
+     */
+    const std::unordered_set<std::uint64_t>& spectators() const;
+
+    /**
+     * @brief Checks if given actor is a spectator inside room
+     *
+     * @param actor UID for actor to check
+     *
+     * @returns `true` if actor is inside room as spectator
+     */
+    bool isSpectator(std::uint64_t actor) const;
+
+    /// Checks if room capacity is reached
+    bool isFull() const;
+
+    /// Checks if there isn't any actor inside room
+    bool isEmpty() const;
+
+    /**
+     * @brief Adds given actor to room
+     *
+     * @param actor UID for actor joining room
+     *
+     * @throws BadRoomActor if room is full or if actor is already inside room
+     */
+    void join(std::uint64_t actor);
+
+    /**
+     * @brief Removes given actor from room, as player or spectator
+     *
+     * @param actor UID for actor leaving room
+     *
+     * @throws BadRoomActor if actor isn't inside room
+     */
+    void leave(std::uint64_t actor);
+
+    /**
+     * @brief Handles SR command with room SER Protocol instance
+     *
+     * @param actor UID for actor who's trying to execute that SR command
+     * @param service_request Service Request command to handle
+     * @param latencies If not null, records time taken by intended service to handle command
+     * @param metrics If not null, counts command result for intended service
+     * @param sampled_request If not null, intended service name and its handling duration are written into it
+     *
+     * @returns Service Request Response (SRR) which has to sent to SR actor
+     *
+     * @throws BadServiceRequest if SR command is ill-formed
+     * @throws BadRoomServices if services haven't been registered yet
+     */
+    std::string handleServiceRequest(std::uint64_t actor, std::string_view service_request,
+                                     Utils::PipelineLatencies* latencies = nullptr,
+                                     Utils::RuntimeMetrics* metrics = nullptr,
+                                     Utils::SampledRequest* sampled_request = nullptr);
+
+    /**
+     * @brief Polls next Service Event emitted inside room, targeting room actors if it targets everyone
+     *
+     * Unless room capacity is `UNLIMITED`, targets outside room are removed, and events without any target left are
+     * skipped. Events targeting everyone only target players, and are kept for spectators until they are flushed.
+     *
+     * @returns Next SE if it exists, uninitialized otherwise
+     *
+     * @throws BadRoomServices if services haven't been registered yet
+     */
+    std::optional<ServiceEvent> pollServiceEvent();
+
+    /**
+     * @brief Recycles events storage of room services once polled events have been sent, events kept for spectators
+     * owning their data
+     *
+     * @throws BadRoomServices if services haven't been registered yet
+     */
+    void recycleEventsStorage();
+
+    /**
+     * @brief Retrieves every context running room services, listing their Ready timers
+     *
+     * @returns Each different context listed once
+     *
+     * @throws BadRoomServices if services haven't been registered yet
+     */
+    const std::vector<ServiceContext*>& servicesContexts() const;
+
+    /**
+     * @brief Called by `Executor` once given actor joined room, before user-provided handler. Does nothing by default.
+     *
+     * @param event Event for actor which joined room
+     */
+    virtual void actorJoined(const JoinedEvent& event);
+
+    /**
+     * @brief Called by `Executor` when given actor leaves room, while it is still inside room and before
+     * user-provided handler. Does nothing by default.
+     *
+     * @param event Event for actor which is leaving room
+     */
+    virtual void actorLeft(const LeftEvent& event);
+
+    /**
+     * @brief Called by `Executor` after each input event handled inside room, before its Service Events are polled.
+     * Does nothing by default.
+     */
+    virtual void routine();
+};
+
+
+/**
+ * @brief Matchmaking registry assigning actors to rooms, opening a new room with given factory if no room is waiting
+ * for players
+ *
+ * Actors are split into match buckets, for example by latency or skill, all actors being inside same bucket by
+ * default. Each bucket queues rooms with actors waiting for opponents, so a joining actor is paired in constant time
+ * with actors which have been waiting for longest time inside its bucket. If none is waiting, actor takes a room
+ * emptied by its previous actors, or a new room opened with factory.
+ *
+ * Rooms are never closed, a room emptied by its actors leaving is reused by next actor which doesn't find any waiting
+ * room, whatever its bucket is.
+ *
+ * First room is opened at construction, so its services are registered before any actor joins.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class Rooms {
+public:
+    /// Constructs a new room with the given ID
+    using RoomFactory = std::function<std::unique_ptr<Room>(std::uint64_t room_id)>;
+    /// Retrieves match bucket for given actor, only actors inside same bucket are paired
+    using MatchBucket = std::function<std::uint64_t(std::uint64_t actor)>;
+
+private:
+    RoomFactory room_factory_;
+    MatchBucket match_bucket_;
+    // Indexed by room ID, as rooms are never closed
+    std::vector<std::unique_ptr<Room>> opened_rooms_;
+    // Bucket each room was filled for, indexed by room ID
+    std::vector<std::uint64_t> rooms_bucket_;
+    // For each bucket, rooms which had actors waiting for opponents when queued. Entries are checked once they reach
+    // queue front, so rooms filled or emptied since then are skipped without searching queue.
+    std::unordered_map<std::uint64_t, std::deque<Room*>> waiting_rooms_;
+    // Opened rooms without any actor, reused before any new room is opened
+    std::vector<Room*> empty_rooms_;
+    std::unordered_map<std::uint64_t, Room*> actors_rooms_;
+
+    /// Opens new room using next ID, empty until caller makes an actor join it
+    Room& open();
+
+    /// Retrieves first room still waiting for opponents inside given bucket, skipping outdated queue entries
+    Room* nextWaitingRoom(std::uint64_t bucket);
+
+public:
+    /**
+     * @brief Constructs registry, opening first room
+     *
+     * @param room_factory Constructs each room when required, must not return `nullptr`
+     * @param match_bucket Splits actors into buckets, every actor inside same bucket if empty
+     */
+    explicit Rooms(RoomFactory room_factory, MatchBucket match_bucket = nullptr);
+
+    // Entity class semantic
+
+    Rooms(const Rooms&) = delete;
+    Rooms& operator=(const Rooms&) = delete;
+
+    /**
+     * @brief Makes given actor join room waiting for longest time inside its bucket, or an empty room if none is
+     * waiting
+     *
+     * @param actor UID for actor to assign
+     *
+     * @returns Room actor joined
+     *
+     * @throws BadRoomActor if actor is already inside a room
+     */
+    Room& assign(std::uint64_t actor);
+
+    /**
+     * @brief Makes given actor leave its room
+     *
+     * @param actor UID for actor to unassign
+     *
+     * @returns Room actor left
+     *
+     * @throws BadRoomActor if actor isn't inside any room
+     */
+    Room& unassign(std::uint64_t actor);
+
+    /**
+     * @brief Retrieves room given actor is inside
+     *
+     * @param actor UID for actor to find room for
+     *
+     * @returns Pointer to actor room, or `nullptr` if actor isn't inside any room
+     */
+    Room* roomOf(std::uint64_t actor) const;
+
+    /**
+     * @brief Retrieves first opened room
+     *
+     * @returns Room with ID 0
+     */
+    Room& first();
+
+    /**
+     * @brief Retrieves number of opened rooms
+     *
+     * @returns Rooms opened since construction, including empty ones
+     */
+    std::size_t count() const;
+
+    /**
+     * @brief Retrieves number of rooms with at least one actor inside
+     *
+     * @returns Opened rooms which aren't empty
+     */
+    std::size_t occupiedCount() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_ROOM_HPP
@@ -0,0 +1,120 @@
+#ifndef RPT_MINIGAMES_SERVER_ROOMSCHEDULER_HPP
+#define RPT_MINIGAMES_SERVER_ROOMSCHEDULER_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file RoomScheduler.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief Runs batches of independent room steps across a pool of worker threads, idle workers stealing steps from
+ * busy ones
+ *
+ * Each step is pushed to its preferred worker queue, so a room keeps being handled by same worker from one batch to
+ * the next. Workers handle their own queue in order, then steal from other queues end once it is empty. A long step
+ * therefore only stalls the worker running it, other steps queued behind it are stolen.
+ *
+ * Thread calling `run()` is the first worker, so a scheduler with 1 worker doesn't start any thread.
+ *
+ * @note Steps inside same batch must not share any state, as they might run concurrently.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class RoomScheduler {
+public:
+    /// Step to run with worker it should preferably run on
+    struct Step {
+        std::size_t affinity;
+        std::function<void()> routine;
+    };
+
+private:
+    /// Steps waiting for a worker, with their own lock so workers only contend when stealing
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Step*> steps;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> threads_;
+
+    // Protects following fields, used to begin and end batches
+    std::mutex batch_mutex_;
+    std::condition_variable batch_begun_;
+    std::condition_variable batch_done_;
+    std::uint64_t batch_id_;
+    std::size_t remaining_steps_;
+    std::exception_ptr first_error_;
+    bool stopping_;
+
+    /// Retrieves next step for given worker, from its own queue or stolen from others, or `nullptr` if every queue is
+    /// empty
+    Step* nextStep(std::size_t worker);
+
+    /// Runs steps for given worker until every queue is empty
+    void work(std::size_t worker);
+
+    /// Worker thread waiting for each batch to begin
+    void workerThread(std::size_t worker);
+
+    /// Stops and joins worker threads
+    void stopWorkers();
+
+public:
+    /**
+     * @brief Starts worker threads, optionally pinned to given CPU cores
+     *
+     * Started threads are pinned in order to listed cores, cycling if there are less cores than threads. Rooms
+     * handled by pinned workers keep their caches warm, as steps are preferably run by same worker.
+     *
+     * @param workers_count Number of workers, including thread calling `run()`
+     * @param workers_cpus CPU cores started threads are pinned to, empty to leave placement to scheduler
+     *
+     * @throws std::invalid_argument if there is no worker
+     * @throws std::system_error if a thread couldn't be pinned to its core
+     */
+    explicit RoomScheduler(std::size_t workers_count, const std::vector<std::size_t>& workers_cpus = {});
+
+    // Entity class semantic, threads are referencing instance
+
+    RoomScheduler(const RoomScheduler&) = delete;
+    RoomScheduler& operator=(const RoomScheduler&) = delete;
+
+    /// Stops and joins worker threads
+    ~RoomScheduler();
+
+    /**
+     * @brief Retrieves number of workers
+     *
+     * @returns Number of workers, including thread calling `run()`
+     */
+    std::size_t workersCount() const;
+
+    /**
+     * @brief Runs every given step, returning once all of them are done
+     *
+     * @param steps Steps for current batch, each one running once
+     *
+     * @throws Exception thrown by first failed step, once every step is done
+     */
+    void run(std::vector<Step>& steps);
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_ROOMSCHEDULER_HPP
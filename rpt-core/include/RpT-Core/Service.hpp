@@ -3,7 +3,6 @@
 
 #include <functional>
 #include <optional>
-#include <queue>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -12,7 +11,9 @@
 #include <RpT-Core/ServiceContext.hpp>
 #include <RpT-Core/ServiceEvent.hpp>
 #include <RpT-Core/Timer.hpp>
+#include <RpT-Utils/ByteArena.hpp>
 #include <RpT-Utils/HandlingResult.hpp>
+#include <RpT-Utils/RingQueue.hpp>
 
 /**
  * @file Service.hpp
@@ -57,24 +58,42 @@ public:
  * virtual method.
  *
  * Implementations will access protected method `emitEvent()` so they can trigger events later polled by any SER
- * Protocol instance, and will uses superclass constructor arguments to watch timers so their state will be checked at
- * each %Executor loop iteration using `getWaitingTimers()`.
+ * Protocol instance, protected method `submitTask()` so CPU-heavy work doesn't block %Executor loop, and will uses
+ * superclass constructor arguments to watch timers so they will notify service `ServiceContext` when entering Ready
+ * state.
  *
  * Each service possesses its own events queue, and each event contains a event ID provided by `ServiceContext`, which
  * allows knowing what event was triggered first (as ID is growing from low to high) and an event command,
- * corresponding to words after `EVENT` prefix and service name inside Service Event command.
+ * corresponding to words after `EVENT` prefix and service name inside Service Event command. Queue is a ring reused
+ * from one event to the next, and event commands are copied into a service-owned arena, so polled events only borrow
+ * their data. Arena is recycled by `recycleEventsStorage()` once queue has been drained and polled events sent, so
+ * emitting events at steady rate doesn't allocate.
  *
- * Each service also has a references vector for watched timers which can be used by %Executor to survey any timer
- * that entered the Ready state. %Executor then will pass Ready state timers to `InputOutputInterface` implementation.
+ * Each service also has a references set for watched timers. Watched timers entering Ready state are listed by run
+ * context, %Executor then will pass them to `InputOutputInterface` implementation. `getWaitingTimers()` can still be
+ * used to check every watched timer state.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
 class Service {
 private:
     ServiceContext& run_context_;
-    std::queue<std::pair<std::size_t, ServiceEvent>> events_queue_;
+    /// Queued event, which command is stored inside events arena
+    struct QueuedEvent {
+        std::size_t id;
+        std::string_view command;
+        std::optional<ActorUidsSet> targets;
+        bool bestEffort;
+    };
+
+    Utils::RingQueue<QueuedEvent> events_queue_;
+    Utils::ByteArena events_arena_;
     std::set<Timer*> watched_timers_; // Using pointers because reference_wrapper doesn't offer == operator
 
+    /// Pushes event with given command and targets into queue, giving it next event ID
+    void pushEvent(std::string_view event_command, std::initializer_list<std::uint64_t> event_targets,
+                   bool best_effort);
+
 protected:
     /**
      * @brief Emits event command into service
@@ -82,7 +101,28 @@ protected:
      * @param event_command Event command to emit (words coming after `EVENT` prefix and service name in SE command)
      * @param event_targets List of UIDs for actor which must receive that event. *If empty, every must receive it.*
      */
-    void emitEvent(std::string event_command, std::initializer_list<std::uint64_t> event_targets = {});
+    void emitEvent(std::string_view event_command, std::initializer_list<std::uint64_t> event_targets = {});
+
+    /**
+     * @brief Emits best-effort event command into service, which IO interface might delay or drop, see
+     * `ServiceEvent::asBestEffort()`
+     *
+     * @param event_command Event command to emit (words coming after `EVENT` prefix and service name in SE command)
+     * @param event_targets List of UIDs for actor which must receive that event. *If empty, every must receive it.*
+     */
+    void emitBestEffortEvent(std::string_view event_command,
+                             std::initializer_list<std::uint64_t> event_targets = {});
+
+    /**
+     * @brief Submits CPU-heavy work to run on a worker thread, see `ServiceContext::submitTask()`
+     *
+     * @param work Called by a worker thread, must only access data it owns
+     * @param completion Called with work result by %Executor thread once work is done
+     */
+    template<typename Work, typename Completion>
+    void submitTask(Work work, Completion completion) {
+        run_context_.submitTask(std::move(work), std::move(completion));
+    }
 
 public:
     /*
@@ -142,12 +182,19 @@ public:
      *
      * @note Called by `ServiceEventRequestProtocol` instance to dispatch across actors, shouldn't be called by user.
      *
-     * @returns `ServiceEvent` with command and targets list for next queued event
+     * @returns `ServiceEvent` with command and targets list for next queued event, borrowing command from events arena
      *
      * @throws EmptyEventsQueue if queue is empty so event cannot be polled
      */
     ServiceEvent pollEvent();
 
+    /**
+     * @brief Reuses events arena if every queued event has been polled, invalidating data borrowed by polled events
+     *
+     * @note Called by `Executor` once polled events have been sent, shouldn't be called by user.
+     */
+    void recycleEventsStorage();
+
     /**
      * @brief Checks for every timers owned and watched by %Service which are waiting for their countdown to begin
      *
@@ -155,6 +202,15 @@ public:
      */
     std::vector<std::reference_wrapper<Timer>> getWaitingTimers();
 
+    /**
+     * @brief Retrieves context service is running inside, listing watched timers in Ready state
+     *
+     * @note Called by `Executor` to begin countdown of Ready timers, shouldn't be called by user.
+     *
+     * @returns Context given at construction
+     */
+    ServiceContext& runContext();
+
     /**
      * @brief Get service name for registration
      *
@@ -2,6 +2,14 @@
 #define RPT_MINIGAMES_SERVER_SERVICECONTEXT_HPP
 
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+#include <RpT-Core/ServiceTask.hpp>
+#include <RpT-Utils/InlineCallback.hpp>
+#include <RpT-Utils/RingQueue.hpp>
 
 /**
  * @file ServiceContext.hpp
@@ -11,18 +19,53 @@
 namespace RpT::Core {
 
 
+class Service;
+class Timer;
+
+
+/// Callbacks registered for a timer state, most timers have only a few of them so they don't allocate
+using TimerCallbacks = Utils::InlineCallbacks<4>;
+
+
 /**
  * @brief Provides a context for services to run, same instance expected for constructs all Service instances
  * registered in same SER Protocol.
  *
- * Instance is used for providing events ID.
+ * Instance is used for providing events ID and timers token. It also lists watched timers which entered Ready state, so
+ * %Executor begins their countdown without checking state for every watched timer at each loop iteration.
+ *
+ * Events emitted by services are logged in ID order with their emitter, so SER Protocol retrieves next event to poll
+ * without checking every service events queue.
+ *
+ * Timers clear callbacks, registered by %Executor and IO interface, can be deferred while services are running on
+ * another thread than %Executor one, so they are called later by %Executor thread.
+ *
+ * Tasks submitted by services are listed the same way as Ready timers, so %Executor runs them on its task pool at
+ * current loop iteration end.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
 class ServiceContext {
+public:
+    /// Logged event ID with service which emitted it
+    struct EmittedEvent {
+        std::size_t id;
+        Service* emitter;
+    };
+
 private:
     std::size_t events_count_;
     std::size_t timers_count_;
+    // Context providing timers token instead of this one, if any
+    ServiceContext* timers_tokens_provider_;
+    // Only addresses are used, as timers might be watched by a service before they are constructed
+    std::unordered_set<const Timer*> watched_timers_;
+    std::vector<Timer*> ready_timers_;
+    // Log is in ID order as IDs are growing, events polled without SER Protocol remain until they are at front
+    Utils::RingQueue<EmittedEvent> emitted_events_;
+    bool clear_callbacks_deferred_;
+    std::vector<Utils::InlineCallback> deferred_clear_callbacks_;
+    std::vector<ServiceTask> submitted_tasks_;
 
 public:
     /**
@@ -30,6 +73,16 @@ public:
      */
     ServiceContext();
 
+    /**
+     * @brief Initialize events count at 0, timers token being provided by given context so they are unique across
+     * every context sharing same provider
+     *
+     * Used when many groups of services run inside same process, as timers are identified by their token only.
+     *
+     * @param timers_tokens_provider Context providing timers token, must outlive constructed context
+     */
+    explicit ServiceContext(ServiceContext& timers_tokens_provider);
+
     /**
      * @brief Increments events count and retrieves its previous value
      *
@@ -40,13 +93,140 @@ public:
     std::size_t newEventPushed();
 
     /**
-     * @brief Increments timers count and retrieves its previous value
+     * @brief Increments events count and retrieves its previous value, logging given service as that event emitter
+     *
+     * @note Called by `Service::emitEvent()` for retrieving triggered event ID, shouldn't be called by user.
+     *
+     * @param emitter Service which emitted that event, must not be destroyed while its events are logged
+     *
+     * @return Previous value for events count
+     */
+    std::size_t newEventPushed(Service& emitter);
+
+    /**
+     * @brief Retrieves oldest logged event
+     *
+     * @note Event might have already been polled directly from its emitter, caller must check for it.
+     *
+     * @returns Pointer to oldest logged event, or `nullptr` if log is empty
+     */
+    const EmittedEvent* oldestEmittedEvent() const;
+
+    /**
+     * @brief Removes oldest logged event, do nothing if log is empty
+     */
+    void popEmittedEvent();
+
+    /**
+     * @brief Increments timers count and retrieves its previous value, or retrieves a token from timers tokens
+     * provider if any
      *
      * @note Called by `Timer` constructor to determine instance token, shouldn't be called by user
      *
      * @returns A free `Timer` token to use
      */
     std::size_t newTimerCreated();
+
+    /**
+     * @brief Lists given timer each time it enters Ready state, so its countdown will begin at current %Executor loop
+     * iteration end
+     *
+     * @note Called by `Service::watchTimer()`, shouldn't be called by user.
+     *
+     * @param watched_timer Timer to list, must not be moved nor destroyed while it is watched
+     */
+    void timerWatched(const Timer& watched_timer);
+
+    /**
+     * @brief Stops listing given timer, removing it from Ready timers if it was listed
+     *
+     * @note Called by `Service::forgetTimer()`, shouldn't be called by user.
+     *
+     * @param forgotten_timer Timer which must not have its countdown began anymore
+     */
+    void timerForgotten(const Timer& forgotten_timer);
+
+    /**
+     * @brief Lists given timer as Ready if it is watched
+     *
+     * @note Called by `Timer::requestCountdown()`, shouldn't be called by user.
+     *
+     * @param ready_timer Timer which entered Ready state
+     */
+    void timerReady(Timer& ready_timer);
+
+    /**
+     * @brief Moves every listed Ready timer, in requests order, into given vector which is cleared before
+     *
+     * Both vectors are swapped, so their allocated capacities are reused at next call.
+     *
+     * @note A timer might have been cleared, or even requested again, since it was listed. Caller must check for it to
+     * still be Ready.
+     *
+     * @param ready_timers Vector receiving Ready timers
+     */
+    void takeReadyTimers(std::vector<Timer*>& ready_timers);
+
+    /**
+     * @brief Calls given clear callbacks for a timer which has been cleared, or keeps them for
+     * `runDeferredClearCallbacks()` if they are deferred
+     *
+     * @note Called by `Timer::clear()`, shouldn't be called by user.
+     *
+     * @param clear_callbacks Callbacks registered for cleared timer, moved if they are deferred
+     */
+    void timerCleared(TimerCallbacks& clear_callbacks);
+
+    /**
+     * @brief Enables or disables deferring for next timers clear callbacks
+     *
+     * @param deferred `true` if clear callbacks must be kept until `runDeferredClearCallbacks()` is called
+     */
+    void deferClearCallbacks(bool deferred);
+
+    /**
+     * @brief Calls every deferred clear callback in timers clear order, then consumes them
+     */
+    void runDeferredClearCallbacks();
+
+    /**
+     * @brief Submits CPU-heavy work to run on a worker thread, given completion being called with its result by
+     * %Executor thread, inside submitting service room, once `TaskCompletedEvent` has been handled
+     *
+     * Work must only access data it owns, as services keep running while it is. Completion might find service state
+     * modified since submission, and should check for its result to still be relevant.
+     *
+     * @tparam Work Callable without argument returning work result, or `void`, might be move-only
+     * @tparam Completion Copyable callable taking work result, or without argument if work returns `void`
+     *
+     * @param work Called by a worker thread
+     * @param completion Called by %Executor thread once work is done, not called if work threw
+     */
+    template<typename Work, typename Completion>
+    void submitTask(Work work, Completion completion) {
+        using Result = std::invoke_result_t<Work&>;
+
+        if constexpr (std::is_void_v<Result>) {
+            submitted_tasks_.emplace_back(std::packaged_task<void()> { std::move(work) }, std::move(completion));
+        } else { // Result is stored by worker thread, then retrieved by completion once work is known to be done
+            const auto result { std::make_shared<std::optional<Result>>() };
+
+            submitted_tasks_.emplace_back(
+                    std::packaged_task<void()> { [work = std::move(work), result]() mutable {
+                        result->emplace(work());
+                    } },
+                    [completion = std::move(completion), result]() mutable { completion(std::move(**result)); });
+        }
+    }
+
+    /**
+     * @brief Moves every submitted task, in submission order, into given vector which is cleared before
+     *
+     * Both vectors are swapped, so their allocated capacities are reused at next call.
+     *
+     * @param submitted_tasks Vector receiving submitted tasks
+     */
+    void takeSubmittedTasks(std::vector<ServiceTask>& submitted_tasks);
 };
 
 
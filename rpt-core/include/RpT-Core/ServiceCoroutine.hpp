@@ -0,0 +1,138 @@
+#ifndef RPT_MINIGAMES_SERVER_SERVICECOROUTINE_HPP
+#define RPT_MINIGAMES_SERVER_SERVICECOROUTINE_HPP
+
+#include <cstdint>
+#include <RpT-Core/Timer.hpp>
+#include <RpT-Utils/InlineCallback.hpp>
+
+/**
+ * @file ServiceCoroutine.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief Resume point for a stackless coroutine run by a service, so a flow spanning several timers countdown is
+ * written as sequential code instead of chaining `Timer::onNextTrigger()` callbacks across states
+ *
+ * Coroutine body is a member function of owning service, given at construction, which wraps its statements inside
+ * `RPT_COROUTINE()` and suspends itself with `RPT_AWAIT_TIMER()`. Awaited timer countdown is requested, and body is
+ * called again once it triggered, resuming right after awaiting statement. As triggered timers are handled by
+ * %Executor, coroutine is resumed by %Executor thread, without any other thread nor any allocation: only a resume point
+ * is kept, and resumption is registered as an inline timer callback.
+ *
+ * As body returns when it is suspended, its local variables don't live across `RPT_AWAIT_TIMER()`. Flow state must be
+ * kept inside service members, and compiler rejects a local variable whose initialization would be jumped over at
+ * resumption.
+ *
+ * Body must return `void`. Calling it while coroutine is done doesn't do anything, until it is started again.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class ServiceCoroutine {
+public:
+    /// Resume point for a coroutine which will run its body from beginning
+    static constexpr int START { 0 };
+    /// Resume point for a coroutine which ran its body until end
+    static constexpr int DONE { -1 };
+
+private:
+    Utils::InlineCallback body_;
+    int resume_point_;
+    // Incremented each time coroutine is suspended or started, so a stale resumption doesn't run body again
+    std::uint64_t suspensions_count_;
+
+public:
+    /**
+     * @brief Constructs coroutine which is done, so body doesn't run until `start()` is called
+     *
+     * @param body Service member call running coroutine body, must fit inside `Utils::InlineCallback`
+     */
+    explicit ServiceCoroutine(Utils::InlineCallback body);
+
+    /*
+     * Entity class semantic
+     */
+
+    ServiceCoroutine(const ServiceCoroutine&) = delete;
+    ServiceCoroutine& operator=(const ServiceCoroutine&) = delete;
+
+    /**
+     * @brief Retrieves point body must resume from
+     *
+     * @note Used by `RPT_COROUTINE()`, shouldn't be called by user.
+     *
+     * @returns `START`, `DONE` or line of statement coroutine is suspended at
+     */
+    int resumePoint() const;
+
+    /// Checks if coroutine is waiting for a timer to trigger
+    bool isSuspended() const;
+
+    /// Checks if coroutine ran until end of its body, or if it was cancelled
+    bool isDone() const;
+
+    /**
+     * @brief Runs body from beginning, cancelling current suspension if any
+     */
+    void start();
+
+    /**
+     * @brief Marks coroutine as done, so it will not be resumed even if awaited timer triggers
+     *
+     * @note Awaited timer isn't cleared, it is up to service to clear it if its countdown must stop.
+     */
+    void cancel();
+
+    /**
+     * @brief Suspends coroutine at given point until given timer triggers
+     *
+     * Timer is cleared first if it isn't Disabled, so its countdown always begins again. It can then be awaited again
+     * as soon as coroutine resumed from its trigger.
+     *
+     * @note Used by `RPT_AWAIT_TIMER()`, shouldn't be called by user.
+     *
+     * @param resume_point Line of awaiting statement
+     * @param awaited_timer Timer to request countdown for, must outlive its countdown
+     */
+    void suspendOn(int resume_point, Timer& awaited_timer);
+
+    /**
+     * @brief Marks coroutine as done once its body reached its end
+     *
+     * @note Used by `RPT_COROUTINE()`, shouldn't be called by user.
+     */
+    void finish();
+};
+
+
+}
+
+
+/**
+ * @brief Runs following statement as given `RpT::Core::ServiceCoroutine` body, resuming from its current resume point
+ *
+ * Coroutine is marked as done once statement completed without being suspended.
+ */
+#define RPT_COROUTINE(coroutine) \
+    for (RpT::Core::ServiceCoroutine& rpt_coroutine_ { coroutine }; !rpt_coroutine_.isDone(); rpt_coroutine_.finish()) \
+        switch (rpt_coroutine_.resumePoint()) \
+            case RpT::Core::ServiceCoroutine::START:
+
+/**
+ * @brief Requests given `RpT::Core::Timer` countdown then suspends enclosing `RPT_COROUTINE()`, which resumes right
+ * after this statement once timer triggered
+ *
+ * Only one await statement per line, as resume point is line number.
+ */
+#define RPT_AWAIT_TIMER(timer) \
+    do { \
+        rpt_coroutine_.suspendOn(__LINE__, timer); \
+        return; \
+        case __LINE__:; \
+    } while (false)
+
+
+#endif //RPT_MINIGAMES_SERVER_SERVICECOROUTINE_HPP
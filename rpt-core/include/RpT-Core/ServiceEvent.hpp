@@ -4,7 +4,8 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
-#include <unordered_set>
+#include <string_view>
+#include <RpT-Core/ActorUidsSet.hpp>
 
 /**
  * @file ServiceEvent.hpp
@@ -32,14 +33,30 @@ public:
  * For example, if polled with `ServiceEventRequestProtocol::pollServiceEvent()`, the new instance`command()` return
  * will be prefixed with `EVENT <service_name> <event_data>`.
  *
+ * Prefixes are layered apart from Event data, so data written by emitting service is never copied by higher protocols:
+ * they can write `prefix()` and `data()` next to each other as output.
+ *
+ * Event data might be borrowed from storage owned by emitting service, so polling an event doesn't copy it. Borrowed
+ * data is only valid until emitting service reuses its storage, once its events have been sent, so an event kept for
+ * longer must own its data with `owningData()`.
+ *
+ * An event can be marked as best-effort if it isn't required for clients to keep playing, like chat messages or
+ * spectators updates. IO interface may then send it after other events, or drop it under backpressure.
+ *
  * @author ThisALV, https://github.com/ThisALV/
  */
 class ServiceEvent {
 private:
     /// Optional set of actors which must receive that Event
-    std::optional<std::unordered_set<std::uint64_t>> targets_;
-    /// Command providing Event data
-    std::string command_;
+    std::optional<ActorUidsSet> targets_;
+    /// Protocol commands inserted by higher protocols, outermost first
+    std::string prefix_;
+    /// Event data, as emitted by service, unused if data is borrowed
+    std::string data_;
+    /// Event data inside storage owned by emitting service, uninitialized if data is owned
+    std::optional<std::string_view> borrowed_data_;
+    /// Event may be delayed behind other events or dropped by IO interface
+    bool best_effort_;
 
 public:
     /**
@@ -48,14 +65,25 @@ public:
      * @param command SE data representation
      * @param actor_uids Set of actor UIDs which must receive that SE, uninitialized if all actors must receive it
      */
-    explicit ServiceEvent(std::string command, std::optional<std::unordered_set<std::uint64_t>> actor_uids = {});
+    explicit ServiceEvent(std::string command, std::optional<ActorUidsSet> actor_uids = {});
+
+    /**
+     * @brief Constructs a Service Event which data is borrowed from storage owned by emitting service
+     *
+     * @param command SE data representation, must stay valid until event is sent or owns its data
+     * @param actor_uids Set of actor UIDs which must receive that SE, uninitialized if all actors must receive it
+     *
+     * @returns Event viewing given command without copying it
+     */
+    static ServiceEvent borrowing(std::string_view command, std::optional<ActorUidsSet> actor_uids = {});
 
     /**
      * @brief Checks if two SE are the same event
      *
      * @param rhs Event to compare with this instance
      *
-     * @returns `true` if both command and optional actor UIDs list are equal from `*this` to `rhs`, `false` otherwise
+     * @returns `true` if both command and optional actor UIDs list are equal from `*this` to `rhs`, `false` otherwise,
+     * no matter how commands are split between prefix and data
      */
     bool operator==(const ServiceEvent& rhs) const;
 
@@ -69,14 +97,61 @@ public:
      *
      * @returns A new instance with SE event data prefixed using given higher protocol command
      */
-    ServiceEvent prefixWith(const std::string& higher_protocol_prefix) const;
+    ServiceEvent prefixWith(std::string_view higher_protocol_prefix) const &;
+
+    /**
+     * @brief Inserts given protocol command at the SE command data beginning, moving data and targets into returned
+     * instance
+     *
+     * @param higher_protocol_prefix Protocol command to insert
+     *
+     * @returns This instance moved, with SE event data prefixed using given higher protocol command
+     */
+    ServiceEvent prefixWith(std::string_view higher_protocol_prefix) &&;
+
+    /**
+     * @brief Replaces actors which must receive this SE, moving command into returned instance
+     *
+     * @param actor_uids Set of actor UIDs which must receive that SE, uninitialized if all actors must receive it
+     *
+     * @returns This instance moved, with given targets
+     */
+    ServiceEvent withTargets(std::optional<ActorUidsSet> actor_uids) &&;
 
     /**
-     * @brief Retrieves a view on SE command
+     * @brief Marks this SE as best-effort, moving command and targets into returned instance
      *
-     * @returns View on SE command data
+     * @returns This instance moved, marked as best-effort
      */
-    std::string_view command() const;
+    ServiceEvent asBestEffort() &&;
+
+    /**
+     * @brief Copies borrowed data, if any, so this SE can be kept after emitting service reused its storage
+     *
+     * @returns This instance moved, owning its data
+     */
+    ServiceEvent owningData() &&;
+
+    /**
+     * @brief Retrieves SE command, concatenating prefix and data
+     *
+     * @returns Copy of whole SE command
+     */
+    std::string command() const;
+
+    /**
+     * @brief Retrieves a view on protocol commands inserted by `prefixWith()`
+     *
+     * @returns View on SE command prefix, empty if it was never prefixed
+     */
+    std::string_view prefix() const;
+
+    /**
+     * @brief Retrieves a view on Event data, which follows `prefix()` inside SE command
+     *
+     * @returns View on SE data emitted by service
+     */
+    std::string_view data() const;
 
     /**
      * @brief Checks if this Service Event must be sent to every registered actor
@@ -92,7 +167,14 @@ public:
      *
      * @throws NoUidsList if every registered actor must receive that SE <=> if `targetEveryone() == true`
      */
-    const std::unordered_set<std::uint64_t>& targets() const;
+    const ActorUidsSet& targets() const;
+
+    /**
+     * @brief Checks if this Service Event is best-effort, so it might be delayed or dropped
+     *
+     * @returns `true` if `asBestEffort()` was called, `false` otherwise
+     */
+    bool bestEffort() const;
 };
 
 
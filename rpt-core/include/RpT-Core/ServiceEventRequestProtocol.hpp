@@ -4,15 +4,19 @@
 #include <deque>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <optional>
 #include <queue>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <unordered_map>
+#include <vector>
 #include <RpT-Core/Service.hpp>
 #include <RpT-Utils/HandlingResult.hpp>
 #include <RpT-Utils/LoggerView.hpp>
+#include <RpT-Utils/PipelineLatencies.hpp>
+#include <RpT-Utils/RuntimeMetrics.hpp>
+#include <RpT-Utils/SlowRequestSampler.hpp>
 #include <RpT-Utils/TextProtocolParser.hpp>
 
 
@@ -127,14 +131,17 @@ public:
  * @author ThisALV, https://github.com/ThisALV
  */
 class ServiceEventRequestProtocol {
-private:
+public:
     // Prefix for Service Request (SR) commands
     static constexpr std::string_view REQUEST_PREFIX { "REQUEST" };
     // Prefix for Service Request Response (SRR) commands
     static constexpr std::string_view RESPONSE_PREFIX { "RESPONSE" };
     // Prefix for Service Event (SE) commands
     static constexpr std::string_view EVENT_PREFIX { "EVENT" };
+    // Extra capacity reserved at SRR buffer end, so higher level protocols can prefix it without any reallocation
+    static constexpr std::size_t SR_RESPONSE_HEADROOM { 16 };
 
+private:
     /**
      * @brief Parses given SR command prefix, request UID and intended service's name
      *
@@ -142,17 +149,18 @@ private:
      */
     class ServiceRequestCommandParser : public Utils::TextProtocolParser {
     private:
-        std::uint64_t parsed_ruid_;
+        std::optional<std::uint64_t> parsed_ruid_;
 
     public:
-        /// Constructs parser for given command, will parse exactly 3 words for prefix, RUID conversion and service name
+        /// Constructs parser for given command, will parse exactly 3 words for prefix, RUID conversion and service name.
+        /// Doesn't throw, `hasExpectedWords()` must be checked first.
         explicit ServiceRequestCommandParser(std::string_view sr_command);
 
         /// Checks if SR command begins with correct prefix
         bool isValidRequest() const;
 
-        /// Retrieves RUID
-        std::uint64_t ruid() const;
+        /// Retrieves RUID, uninitialized if it isn't an unsigned integer of 64 bits
+        std::optional<std::uint64_t> ruid() const;
 
         /// Retrieves intended service name
         std::string_view intendedServiceName() const;
@@ -161,8 +169,40 @@ private:
         std::string_view commandData() const;
     };
 
+    /// Service ID for dispatch table slots which aren't used
+    static constexpr std::size_t FREE_SLOT { std::numeric_limits<std::size_t>::max() };
+
+    /// Dispatch table slot for a service name
+    struct DispatchSlot {
+        std::string_view name;
+        std::size_t serviceId { FREE_SLOT };
+    };
+
     Utils::LoggerView logger_;
-    std::unordered_map<std::string_view, std::reference_wrapper<Service>> running_services_;
+    // Running services, indexed by their ID which is their registration order
+    std::vector<std::reference_wrapper<Service>> running_services_;
+    // Open addressing table mapping each running service name to its ID, frozen once protocol is constructed
+    std::vector<DispatchSlot> dispatch_table_;
+    // Each different context running services, logging their emitted events
+    std::vector<ServiceContext*> services_contexts_;
+
+    /// Cheap hash for service names, only using name length and its first and last chars
+    static std::size_t dispatchHash(std::string_view name);
+
+    /// Retrieves slot for given service name inside dispatch table, which is empty if service isn't running
+    const DispatchSlot& findSlot(std::string_view service) const;
+
+    /// Retrieves running service with given name, `nullptr` if there isn't any
+    Service* findService(std::string_view service) const;
+
+    /// Checks for given service instance to be the one registered under its name
+    bool isRunning(const Service& service) const;
+
+    /// Drops oldest events logged by given context while they cannot be polled, then retrieves oldest remaining one
+    const ServiceContext::EmittedEvent* nextPollableEvent(ServiceContext& services_context) const;
+
+    /// Writes `RESPONSE <RUID> OK`, or `RESPONSE <RUID> KO <ERR_MSG>` if any error message, into one reserved buffer
+    static std::string formatResponse(std::uint64_t request_uid, std::optional<std::string_view> error_message);
 
 public:
     /*
@@ -177,7 +217,8 @@ public:
     /**
      * @brief Initialize SER Protocol with given services to run
      *
-     * Each service will be named from its `Service::name()` returned value.
+     * Each service will be named from its `Service::name()` returned value. Services set is frozen here, so names
+     * are dispatched with a table built once.
      *
      * @throws ServiceNameAlreadyRegistered if a service name appears twice into services list
      *
@@ -203,19 +244,44 @@ public:
      *
      * @param actor UID for actor who's trying to execute that SR command
      * @param service_request Service Request command to handle
+     * @param latencies If not null, records time taken by intended service to handle command
+     * @param metrics If not null, counts command result for intended service
+     * @param sampled_request If not null, intended service name and its handling duration are written into it
      *
-     * @returns Service Request Response (SRR) which has to sent to SR actor
+     * @returns Service Request Response (SRR) which has to sent to SR actor, formatted inside a single buffer with at
+     * least `SR_RESPONSE_HEADROOM` unused capacity
      *
      * @throws BadServiceRequest if SR command is ill-formed
      */
-    std::string handleServiceRequest(std::uint64_t actor, std::string_view service_request);
+    std::string handleServiceRequest(std::uint64_t actor, std::string_view service_request,
+                                     Utils::PipelineLatencies* latencies = nullptr,
+                                     Utils::RuntimeMetrics* metrics = nullptr,
+                                     Utils::SampledRequest* sampled_request = nullptr);
 
     /**
      * @brief Poll next Service Event in services queue, do nothing if queue is empty
      *
+     * Next event is found from services context events log, so polling doesn't depend on number of services. Logged
+     * events which were already polled from their service, or which were emitted by a service not running inside this
+     * protocol, are dropped from log.
+     *
      * @returns Optional value, initialized to next SE if it exists, uninitialized otherwise
      */
     std::optional<ServiceEvent> pollServiceEvent();
+
+    /**
+     * @brief Recycles events storage of every registered service, see `Service::recycleEventsStorage()`
+     *
+     * @note Polled events borrowing their data must have been sent or own their data.
+     */
+    void recycleEventsStorage();
+
+    /**
+     * @brief Retrieves each different context running registered services, so their Ready timers can be checked
+     *
+     * @returns Contexts in services registration order, listed once each
+     */
+    const std::vector<ServiceContext*>& servicesContexts() const;
 };
 
 
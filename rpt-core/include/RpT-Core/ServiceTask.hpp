@@ -0,0 +1,64 @@
+#ifndef RPT_MINIGAMES_SERVER_SERVICETASK_HPP
+#define RPT_MINIGAMES_SERVER_SERVICETASK_HPP
+
+#include <functional>
+#include <future>
+
+/**
+ * @file ServiceTask.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief CPU-heavy work submitted by a service with `ServiceContext::submitTask()`, run by a worker thread so
+ * %Executor loop isn't blocked, then completed by %Executor thread
+ *
+ * Work must not access any service state which might be modified meanwhile, it rather works on copied data, and
+ * stores its result inside state shared with completion. Completion is called inside room of submitting service,
+ * once `TaskCompletedEvent` for task token has been handled, so it is the only one to access service state.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class ServiceTask {
+private:
+    std::packaged_task<void()> work_;
+    std::future<void> work_done_;
+    std::function<void()> completion_;
+
+public:
+    /**
+     * @brief Constructs task which hasn't run yet
+     *
+     * @param work Called by worker thread, might own move-only data
+     * @param completion Called by `complete()` once work is done
+     */
+    ServiceTask(std::packaged_task<void()> work, std::function<void()> completion);
+
+    /**
+     * @brief Runs task work, exception thrown by work is kept for `complete()`
+     *
+     * @note Called by a task pool worker, shouldn't be called by user.
+     */
+    void run();
+
+    /**
+     * @brief Waits for work to be done, then calls completion
+     *
+     * Work is normally done already, as `TaskCompletedEvent` is emitted once it has run. Waiting is only required
+     * when completed tasks are replayed.
+     *
+     * @note Called by %Executor thread, or by worker running room of submitting service, shouldn't be called by user.
+     *
+     * @throws Exception thrown by work, in which case completion isn't called
+     */
+    void complete();
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_SERVICETASK_HPP
@@ -0,0 +1,95 @@
+#ifndef RPT_MINIGAMES_SERVER_TASKPOOL_HPP
+#define RPT_MINIGAMES_SERVER_TASKPOOL_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <RpT-Core/ServiceTask.hpp>
+
+/**
+ * @file TaskPool.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief Runs services tasks on a pool of worker threads, in submission order, notifying each task token once its
+ * work is done
+ *
+ * Unlike `RoomScheduler`, caller doesn't wait for submitted tasks: notifier is called by worker thread, so it must be
+ * thread-safe. It is usually `InputOutputInterface::completeTask()`, so completion is handled by %Executor thread as
+ * any other input event.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class TaskPool {
+public:
+    /// Called by worker thread with token for each task which has run
+    using CompletionNotifier = std::function<void(std::uint64_t)>;
+
+private:
+    /// Task waiting for a worker, with token it is notified with
+    struct QueuedTask {
+        std::uint64_t token;
+        std::shared_ptr<ServiceTask> task;
+    };
+
+    CompletionNotifier notifier_;
+    std::vector<std::thread> threads_;
+
+    // Protects following fields
+    std::mutex queue_mutex_;
+    std::condition_variable task_queued_;
+    std::deque<QueuedTask> queued_tasks_;
+    bool stopping_;
+
+    /// Worker thread running queued tasks until pool is stopping
+    void workerThread();
+
+public:
+    /**
+     * @brief Starts worker threads
+     *
+     * @param workers_count Number of worker threads
+     * @param notifier Called with task token each time a task has run
+     *
+     * @throws std::invalid_argument if there is no worker
+     */
+    TaskPool(std::size_t workers_count, CompletionNotifier notifier);
+
+    // Entity class semantic, threads are referencing instance
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    /// Stops and joins worker threads, tasks which didn't begin to run are dropped without being notified
+    ~TaskPool();
+
+    /**
+     * @brief Retrieves number of worker threads
+     *
+     * @returns Number of worker threads
+     */
+    std::size_t workersCount() const;
+
+    /**
+     * @brief Queues given task, which will be run by next available worker
+     *
+     * @param token Token notified once task has run
+     * @param task Task to run, shared so it is kept alive until it has run even if caller completed it meanwhile
+     */
+    void submit(std::uint64_t token, std::shared_ptr<ServiceTask> task);
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_TASKPOOL_HPP
@@ -5,7 +5,7 @@
  * @file Timer.hpp
  */
 
-#include <functional>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -66,7 +66,8 @@ public:
  * @note As routines are only available for one lifecycle, each `clear()` resets `Triggered` state registered
  * routines even if `Triggered` state wasn't reach at any moment.
  *
- * @note Timer state modification inside state specific routine/callback results in undefined behavior.
+ * @note Timer state modification inside state specific routine/callback results in undefined behavior, except for
+ * clearing timer then requesting its countdown again from a `Triggered` callback.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
@@ -89,10 +90,14 @@ private:
 
     std::uint64_t token_;
     std::size_t countdown_ms_;
+    std::size_t slack_ms_;
     TimerState current_state_;
+    // Notified when countdown is requested, so it can list this timer if watched
+    ServiceContext* token_provider_;
 
-    std::vector<std::function<void()>> clear_callbacks_;
-    std::vector<std::function<void()>> trigger_callbacks_;
+    // Stored inline, so registering callbacks when countdown begins doesn't allocate
+    TimerCallbacks clear_callbacks_;
+    TimerCallbacks trigger_callbacks_;
 
     /// Throws `BadTimerState` if current state is not the one expected for given operation name
     void checkStateForOperation(std::string_view operation_name);
@@ -104,8 +109,10 @@ public:
      *
      * @param token_provider `ServiceContext` of service using and owning this timer
      * @param countdown_ms Time in milliseconds to stay into pending mode once countdown has begun
+     * @param slack_ms Time in milliseconds timer is allowed to trigger late, so IO interface can trigger it with other
+     * timers in a single wakeup, `0` if it must trigger on time
      */
-    Timer(ServiceContext& token_provider, std::size_t countdown_ms);
+    Timer(ServiceContext& token_provider, std::size_t countdown_ms, std::size_t slack_ms = 0);
 
     // Entity semantic class
 
@@ -131,6 +138,13 @@ public:
      */
     std::size_t countdown() const;
 
+    /**
+     * @brief Retrieves time timer is allowed to trigger late, in milliseconds
+     *
+     * @returns Timer slack in milliseconds, `0` if it must trigger on time
+     */
+    std::size_t slack() const;
+
     /// Checks if current state is Disabled
     bool isFree() const;
     /// Checks if current state is Ready
@@ -143,17 +157,17 @@ public:
     /**
      * @brief Calls given routine next time and only next time state is updated to `Disabled` *inside current lifecycle*
      *
-     * @param callback Routine to call
+     * @param callback Routine to call, must fit inside `Utils::InlineCallback`
      */
-    void onNextClear(std::function<void()> callback);
+    void onNextClear(Utils::InlineCallback callback);
 
     /**
      * @brief Calls given routine next time and only next time state is updated to `Triggered`
      * *inside current lifecycle*
      *
-     * @param callback Routine to call
+     * @param callback Routine to call, must fit inside `Utils::InlineCallback`
      */
-    void onNextTrigger(std::function<void()> callback);
+    void onNextTrigger(Utils::InlineCallback callback);
 
     /**
      * @brief Marks timer as Disabled
@@ -161,7 +175,7 @@ public:
     void clear();
 
     /**
-     * @brief Marks timer as Ready
+     * @brief Marks timer as Ready, notifying `ServiceContext` which provided token
      *
      * @throws BadTimerState if timer is not Disabled
      */
@@ -185,6 +199,30 @@ public:
 };
 
 
+/**
+ * @brief Computes tick at which a countdown beginning at given tick must expire, delayed up to next multiple of given
+ * slack so every countdown with same slack expiring inside same slack window shares same deadline
+ *
+ * Used by `InputOutputInterface` implementations, so timers with a slack trigger together with a single wakeup.
+ *
+ * @param now Tick at which countdown begins, in milliseconds
+ * @param countdown_ms Countdown duration in milliseconds, see `Timer::countdown()`
+ * @param slack_ms Allowed lateness in milliseconds, see `Timer::slack()`
+ *
+ * @returns Deadline which is never earlier than `now + countdown_ms`, and never later than `now + countdown_ms +
+ * slack_ms - 1`
+ */
+constexpr std::uint64_t coalescedDeadline(const std::uint64_t now, const std::size_t countdown_ms,
+                                          const std::size_t slack_ms) {
+    const std::uint64_t exact_deadline { now + countdown_ms };
+
+    if (slack_ms <= 1) // Every tick is a multiple of 1, no coalescing is possible
+        return exact_deadline;
+
+    return (exact_deadline + slack_ms - 1) / slack_ms * slack_ms;
+}
+
+
 }
 
 
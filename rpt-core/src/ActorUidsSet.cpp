@@ -0,0 +1,72 @@
+#include <RpT-Core/ActorUidsSet.hpp>
+
+#include <algorithm>
+
+
+namespace RpT::Core {
+
+
+bool ActorUidsSet::isInline() const {
+    return heap_uids_.empty(); // Heap buffer is only filled once inline storage overflowed
+}
+
+ActorUidsSet::ActorUidsSet() : inline_uids_ {}, size_ { 0 } {}
+
+ActorUidsSet::ActorUidsSet(const std::initializer_list<std::uint64_t> actor_uids)
+: ActorUidsSet { actor_uids.begin(), actor_uids.end() } {}
+
+bool ActorUidsSet::operator==(const ActorUidsSet& rhs) const {
+    if (size_ != rhs.size_)
+        return false;
+
+    // Same size and no duplicates, so every UID from this set must be found inside other one
+    return std::all_of(begin(), end(), [&rhs](const std::uint64_t actor_uid) {
+        return rhs.contains(actor_uid);
+    });
+}
+
+bool ActorUidsSet::operator!=(const ActorUidsSet& rhs) const {
+    return !(*this == rhs);
+}
+
+bool ActorUidsSet::insert(const std::uint64_t actor_uid) {
+    if (contains(actor_uid))
+        return false;
+
+    if (!isInline()) {
+        heap_uids_.push_back(actor_uid);
+    } else if (size_ < INLINE_CAPACITY) {
+        inline_uids_[size_] = actor_uid;
+    } else { // Inline storage is full, every UID is moved to heap
+        heap_uids_.reserve(INLINE_CAPACITY * 2);
+        heap_uids_.assign(inline_uids_.begin(), inline_uids_.end());
+        heap_uids_.push_back(actor_uid);
+    }
+
+    size_++;
+
+    return true;
+}
+
+bool ActorUidsSet::contains(const std::uint64_t actor_uid) const {
+    return std::find(begin(), end(), actor_uid) != end();
+}
+
+std::size_t ActorUidsSet::size() const {
+    return size_;
+}
+
+bool ActorUidsSet::empty() const {
+    return size_ == 0;
+}
+
+const std::uint64_t* ActorUidsSet::begin() const {
+    return isInline() ? inline_uids_.data() : heap_uids_.data();
+}
+
+const std::uint64_t* ActorUidsSet::end() const {
+    return begin() + size_;
+}
+
+
+}
@@ -1,48 +1,67 @@
 #include <RpT-Core/Executor.hpp>
 
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <string_view>
 #include <RpT-Core/ServiceEventRequestProtocol.hpp>
+#include <RpT-Utils/AllocationProfiler.hpp>
+#include <RpT-Utils/ThreadAffinity.hpp>
 
 
 namespace RpT::Core {
 
 
+namespace {
+
+
+/// Name for each input event type, indexed with `AnyInputEvent` types order, labels handling spans and allocations
+constexpr std::array<std::string_view, std::variant_size_v<AnyInputEvent>> INPUT_EVENTS_NAMES {
+    "NoneEvent", "ServiceRequestEvent", "TimerEvent", "JoinedEvent", "LeftEvent", "TaskCompletedEvent"
+};
+
+/// Converts given sampled stage duration into logged microseconds
+std::int64_t sampledMicroseconds(const Utils::SampledRequest::Clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+
+}
+
+
 Executor::InputEventVisitor::InputEventVisitor(Executor& running_instance)
-: instance_ { running_instance }, logger_ { instance_.logger_ }, ser_protocol_ { nullptr } {}
+: instance_ { running_instance }, logger_ { instance_.logger_ }, rooms_ { nullptr } {}
 
 bool Executor::InputEventVisitor::isConfigured() const {
-    return static_cast<bool>(ser_protocol_);
+    return static_cast<bool>(rooms_);
 }
 
-void Executor::InputEventVisitor::markReady(ServiceEventRequestProtocol& ser_protocol) {
-    ser_protocol_ = &ser_protocol;
+void Executor::InputEventVisitor::markReady(Rooms& rooms) {
+    rooms_ = &rooms;
 }
 
 void Executor::InputEventVisitor::operator()(NoneEvent event) const {
-    logger_.trace("Null event");
+    RPT_LOG_TRACE(logger_, "Null event");
+
+    if (instance_.default_room_) // Room hosting every actor has to be synced anyway
+        instance_.handleInsideRoom(*instance_.default_room_, { event, nullptr });
 
     // Input event will not be used anymore, can be moved to user callback
     userNoneHandler(std::move(event));
 }
 
 void Executor::InputEventVisitor::operator()(ServiceRequestEvent event) const {
-    logger_.debug("SR command received from player {}", event.actor());
+    RPT_LOG_DEBUG(logger_, "SR command received from player {}", event.actor());
 
     const std::uint64_t actor_uid { event.actor() };
-    try { // Tries to parse SR command
-        // Give SR command to parse and execute by SER Protocol
-        const std::string sr_command_response {
-                ser_protocol_->handleServiceRequest(event.actor(), event.serviceRequest())
-        };
+    Room* const actor_room { rooms_->roomOf(actor_uid) };
 
-        // Replies to actor with command handling result
-        instance_.io_interface_.replyTo(actor_uid, sr_command_response);
-    } catch (const BadServiceRequest& err) { // If command cannot be parsed, SRR cannot be sent, pipeline broken
-        // It is no longer possible to sync SR with actor as RUID might be wrong, closing pipeline with thrown
-        // exception message
-        instance_.io_interface_.closePipelineWith(
-                actor_uid, Utils::HandlingResult { err.what() });
+    if (actor_room) { // Give SR command to parse and execute by actor room SER Protocol
+        instance_.handleInsideRoom(*actor_room, { event, nullptr, nullptr, instance_.input_sample_ });
+    } else { // SR cannot be handled by any services, pipeline broken
+        instance_.io_interface_.closePipelineWith(actor_uid, Utils::HandlingResult { "Not inside any room" });
 
-        logger_.error("SER Protocol broken for actor {}: {}. Closing pipeline...", actor_uid, err.what());
+        logger_.error("SR command from actor {} which isn't inside any room. Closing pipeline...", actor_uid);
     }
 
     userServiceRequestHandler(std::move(event));
@@ -50,36 +69,368 @@ void Executor::InputEventVisitor::operator()(ServiceRequestEvent event) const {
 
 void Executor::InputEventVisitor::operator()(TimerEvent event) const {
     const std::uint64_t timer_token { event.token() }; // Token for timer which timed out
-    logger_.trace("Triggering timer {}", timer_token);
+    RPT_LOG_TRACE(logger_, "Triggering timer {}", timer_token);
 
     const auto timer_to_trigger { instance_.pending_timers_.find(timer_token) }; // Retrieves timer by its token
-    assert(timer_to_trigger != instance_.pending_timers_.cend()); // Must be sure timer actually exists
+    assert(timer_to_trigger != instance_.pending_timers_.end()); // Must be sure timer actually exists
 
-    timer_to_trigger->second.get().trigger(); // Trigger timed out timer
+    const auto [timer, timer_room] { timer_to_trigger->second };
     instance_.pending_timers_.erase(timer_to_trigger); // Timer is no longer pending, removes it from registry
 
+    // Services owning this timer are running inside room it was began for, which triggers it
+    instance_.handleInsideRoom(*timer_room, { event, &timer.get() });
+
     userTimerHandler(std::move(event));
 }
 
 void Executor::InputEventVisitor::operator()(JoinedEvent event) const {
     logger_.info("Player \"{}\" joined server as actor {}", event.playerName(), event.actor());
 
+    Room& actor_room { rooms_->assign(event.actor()) };
+    RPT_LOG_DEBUG(logger_, "Actor {} assigned to room {}", event.actor(), actor_room.id());
+
+    instance_.handleInsideRoom(actor_room, { event, nullptr });
+
     userJoinedHandler(std::move(event));
 }
 
 void Executor::InputEventVisitor::operator()(LeftEvent event) const {
     logger_.info("Actor {} left server", event.actor());
 
+    Room* const actor_room { rooms_->roomOf(event.actor()) };
+    if (actor_room) { // Actor might have left before being assigned to any room
+        // Left room hook is called now if rooms aren't scheduled, while actor is still inside room
+        instance_.handleInsideRoom(*actor_room, { event, nullptr });
+
+        rooms_->unassign(event.actor());
+    }
+
     userLeftHandler(std::move(event));
 }
 
+void Executor::InputEventVisitor::operator()(TaskCompletedEvent event) const {
+    const std::uint64_t task_token { event.token() }; // Token for task which has run
+    RPT_LOG_TRACE(logger_, "Completing task {}", task_token);
+
+    const auto task_to_complete { instance_.pending_tasks_.find(task_token) }; // Retrieves task by its token
+    assert(task_to_complete != instance_.pending_tasks_.end()); // Must be sure task actually exists
+
+    auto [task, task_room] { std::move(task_to_complete->second) };
+    instance_.pending_tasks_.erase(task_to_complete); // Task is no longer pending, removes it from registry
+
+    // Service which submitted this task is running inside room it was submitted from, which completes it
+    instance_.handleInsideRoom(*task_room, { event, nullptr, std::move(task) });
+
+    userTaskCompletedHandler(std::move(event));
+}
+
+
+Executor::RoomJob& Executor::jobFor(Room& room) {
+    const auto room_job_index { room_jobs_index_->find(&room) };
+    if (room_job_index != room_jobs_index_->end())
+        return room_jobs_[room_job_index->second];
+
+    // Previous batches jobs are reused, so are their allocated capacities
+    if (room_jobs_count_ == room_jobs_.size())
+        room_jobs_.emplace_back();
+
+    RoomJob& room_job { room_jobs_[room_jobs_count_] };
+    room_job.room = &room;
+
+    room_jobs_index_->insert({ &room, room_jobs_count_ });
+    room_jobs_count_++;
+
+    if (std::find(batch_rooms_.cbegin(), batch_rooms_.cend(), &room) == batch_rooms_.cend())
+        batch_rooms_.push_back(&room);
+
+    return room_job;
+}
+
+void Executor::handleInsideRoom(Room& room, RoomInput input) {
+    input_room_ = &room;
+
+    RoomJob& room_job { jobFor(room) };
+
+    if (room_scheduler_) { // Handled later by room step
+        room_job.inputs.push_back(std::move(input));
+    } else { // Handled now, so outputs are sent before user-provided handler is called
+        handleRoomInput(room, input, room_job.outputs, latencies_, metrics_);
+        sendRoomOutputs(room_job.outputs);
+    }
+}
+
+void Executor::handleRoomInput(Room& room, const RoomInput& input, std::vector<RoomOutput>& outputs,
+                               Utils::PipelineLatencies* const latencies, Utils::RuntimeMetrics* const metrics) {
+
+    if (const auto* const sr_event { std::get_if<ServiceRequestEvent>(&input.event) }) {
+        const std::uint64_t actor_uid { sr_event->actor() };
+        Utils::SampledRequest* const sampled_request { input.sampled_request };
+        const auto dispatch_begin { Utils::PipelineLatencies::Clock::now() };
+
+        if (sampled_request)
+            sampled_request->dispatchedAt = dispatch_begin;
+
+        try { // Tries to parse SR command
+            // Give SR command to parse and execute by room SER Protocol, then replies to actor with handling result
+            outputs.emplace_back(ReplyOutput {
+                actor_uid,
+                room.handleServiceRequest(actor_uid, sr_event->serviceRequest(), latencies, metrics, sampled_request)
+            });
+
+            if (latencies || sampled_request) { // Clock isn't read again if dispatch isn't recorded
+                const auto dispatch_end { Utils::PipelineLatencies::Clock::now() };
+
+                if (latencies)
+                    latencies->record(Utils::PipelineStage::Dispatch, dispatch_end - dispatch_begin);
+
+                if (sampled_request) {
+                    sampled_request->repliedAt = dispatch_end;
+                    sampled_request->responseBytes = std::get<ReplyOutput>(outputs.back()).sr_response.size();
+                }
+            }
+        } catch (const BadServiceRequest& err) { // If command cannot be parsed, SRR cannot be sent, pipeline broken
+            // It is no longer possible to sync SR with actor as RUID might be wrong, closing pipeline with thrown
+            // exception message
+            outputs.emplace_back(ClosedPipelineOutput { actor_uid, err.what() });
+
+            if (sampled_request)
+                sampled_request->repliedAt = Utils::PipelineLatencies::Clock::now();
+        }
+    } else if (std::get_if<TimerEvent>(&input.event)) {
+        assert(input.triggered_timer); // Timer is retrieved by Executor thread from pending timers
+
+        const Utils::AllocationScope services_allocations { Utils::AllocationSubsystem::Services };
+
+        // Might have been cleared by previous input event inside same batch
+        if (input.triggered_timer->isPending())
+            input.triggered_timer->trigger(); // Trigger timed out timer
+    } else if (const auto* const joined_event { std::get_if<JoinedEvent>(&input.event) }) {
+        const Utils::AllocationScope services_allocations { Utils::AllocationSubsystem::Services };
+
+        room.actorJoined(*joined_event);
+    } else if (const auto* const left_event { std::get_if<LeftEvent>(&input.event) }) {
+        const Utils::AllocationScope services_allocations { Utils::AllocationSubsystem::Services };
+
+        room.actorLeft(*left_event);
+    } else if (std::get_if<TaskCompletedEvent>(&input.event)) {
+        assert(input.completed_task); // Task is retrieved by Executor thread from pending tasks
+
+        const Utils::AllocationScope services_allocations { Utils::AllocationSubsystem::Services };
+
+        input.completed_task->complete();
+    }
+}
+
+void Executor::syncRoom(Room& room, std::vector<RoomOutput>& outputs, Utils::PipelineLatencies* const latencies) {
+    {
+        const Utils::AllocationScope services_allocations { Utils::AllocationSubsystem::Services };
+
+        room.routine();
+    }
+
+    const auto polling_begin { Utils::PipelineLatencies::Clock::now() };
+
+    // After all required handlers and operations have been done, events emitted by services should also be handled in
+    // the order they appeared so clients can be synced with server services state. They are polled for each input
+    // event so they keep their order with SRR sent by next input events.
+
+    std::optional<ServiceEvent> next_svc_event { room.pollServiceEvent() }; // Read first event
+    while (next_svc_event) { // Then while next event actually exists, handles it
+        outputs.emplace_back(std::move(*next_svc_event));
+
+        next_svc_event = room.pollServiceEvent(); // Read next event
+    }
+
+    if (latencies)
+        latencies->recordSince(Utils::PipelineStage::Polling, polling_begin);
+}
+
+void Executor::stepRoom(RoomJob& job, Utils::PipelineLatencies* const latencies,
+                        Utils::RuntimeMetrics* const metrics, Utils::SlowRequestSampler* const slow_requests) {
+
+    for (const RoomInput& input : job.inputs) {
+        handleRoomInput(*job.room, input, job.outputs, latencies, metrics);
+
+        const std::size_t previous_outputs { job.outputs.size() };
+        syncRoom(*job.room, job.outputs, latencies);
+
+        if (input.sampled_request) // Only set if sampler is given
+            finishSample(*slow_requests, *input.sampled_request, job.outputs.size() - previous_outputs);
+    }
+}
+
+void Executor::finishSample(Utils::SlowRequestSampler& slow_requests, Utils::SampledRequest& sampled_request,
+                            const std::size_t polled_events) {
+
+    sampled_request.syncedAt = Utils::SampledRequest::Clock::now();
+    sampled_request.polledEvents = polled_events;
+
+    slow_requests.finish(sampled_request);
+}
+
+void Executor::logSlowRequests() {
+    unreported_slow_requests_.clear();
+    slow_requests_->takeUnreported(unreported_slow_requests_);
+
+    for (const Utils::SampledRequest& slow_request : unreported_slow_requests_) {
+        logger_.warn("Slow SR command from actor {} to service \"{}\": {} us end-to-end, queued {} us, "
+                     "scheduled {} us, dispatch {} us including service {} us, sync {} us. {} bytes request, "
+                     "{} bytes response, {} pending inputs, {} handled before inside batch, {} polled events.",
+                     slow_request.actor, slow_request.serviceName(), sampledMicroseconds(slow_request.endToEnd()),
+                     sampledMicroseconds(slow_request.handledAt - slow_request.receivedAt),
+                     sampledMicroseconds(slow_request.dispatchedAt - slow_request.handledAt),
+                     sampledMicroseconds(slow_request.repliedAt - slow_request.dispatchedAt),
+                     sampledMicroseconds(slow_request.serviceHandling),
+                     sampledMicroseconds(slow_request.syncedAt - slow_request.repliedAt),
+                     slow_request.requestBytes, slow_request.responseBytes, slow_request.pendingInputs,
+                     slow_request.batchPosition, slow_request.polledEvents);
+    }
+}
+
+void Executor::sendRoomOutputs(std::vector<RoomOutput>& outputs) {
+    for (RoomOutput& output : outputs) {
+        if (auto* const reply { std::get_if<ReplyOutput>(&output) }) {
+            io_interface_.replyTo(reply->actor, std::move(reply->sr_response));
+        } else if (auto* const closed_pipeline { std::get_if<ClosedPipelineOutput>(&output) }) {
+            io_interface_.closePipelineWith(closed_pipeline->actor, Utils::HandlingResult { closed_pipeline->error });
+
+            logger_.error("SER Protocol broken for actor {}: {}. Closing pipeline...",
+                          closed_pipeline->actor, closed_pipeline->error);
+        } else {
+            ServiceEvent& svc_event { std::get<ServiceEvent>(output) };
+
+            RPT_LOG_DEBUG(logger_, "Output event: {}{}", svc_event.prefix(), svc_event.data());
+            io_interface_.outputEvent(std::move(svc_event)); // Sent across actors
+        }
+    }
+
+    outputs.clear();
+}
+
+void Executor::runRoomJobs() {
+    assert(room_scheduler_);
+
+    room_steps_.clear();
+    for (std::size_t job_index { 0 }; job_index < room_jobs_count_; job_index++) {
+        RoomJob& room_job { room_jobs_[job_index] };
+
+        // Timers clear callbacks are registered by Executor and IO interface, which are only accessed by this thread
+        for (ServiceContext* services_context : room_job.room->servicesContexts())
+            services_context->deferClearCallbacks(true);
+
+        // Same room is preferably handled by same worker from one batch to the next
+        room_steps_.push_back({ room_job.room->id(), [
+                &room_job, latencies = latencies_, metrics = metrics_, slow_requests = slow_requests_]() {
+
+            stepRoom(room_job, latencies, metrics, slow_requests);
+        } });
+    }
+
+    RPT_LOG_DEBUG(logger_, "Running {} rooms steps...", room_steps_.size());
+    room_scheduler_->run(room_steps_);
+    RPT_LOG_DEBUG(logger_, "Rooms steps done.");
+
+    for (std::size_t job_index { 0 }; job_index < room_jobs_count_; job_index++) {
+        RoomJob& room_job { room_jobs_[job_index] };
+
+        sendRoomOutputs(room_job.outputs);
+        room_job.inputs.clear();
+
+        for (ServiceContext* services_context : room_job.room->servicesContexts()) {
+            services_context->deferClearCallbacks(false);
+            services_context->runDeferredClearCallbacks();
+        }
+    }
+}
+
+void Executor::recycleEventsStorage() {
+    for (Room* batch_room : batch_rooms_)
+        batch_room->recycleEventsStorage();
+}
+
+void Executor::startTaskPool() {
+    task_pool_.emplace(task_workers_, [this](const std::uint64_t task_token) {
+        io_interface_.completeTask(task_token);
+    });
+
+    logger_.info("Tasks offloaded on {} workers.", task_workers_);
+}
+
+void Executor::beginSubmittedTasks() {
+    // Handlers on services might have been called, runs tasks they submitted since then
+    for (Room* batch_room : batch_rooms_) {
+        for (ServiceContext* services_context : batch_room->servicesContexts()) {
+            services_context->takeSubmittedTasks(submitted_tasks_);
+
+            if (!submitted_tasks_.empty() && !task_pool_) // Workers are only started if they are actually required
+                startTaskPool();
+
+            for (ServiceTask& submitted_task : submitted_tasks_) {
+                const std::uint64_t task_token { tasks_count_++ };
+                const auto task { std::make_shared<ServiceTask>(std::move(submitted_task)) };
+
+                const auto insert_result { pending_tasks_.insert({ task_token, { task, batch_room } }) };
+                assert(insert_result.second); // Checks for token and task insertion into registry
+
+                io_interface_.beginTask(task_token); // Notified before task might be completed
+                task_pool_->submit(task_token, task);
+            }
+        }
+    }
+}
+
+void Executor::beginReadyTimers() {
+    // Handlers on services might have been called, begins countdown for timers listed as Ready since then
+    for (Room* batch_room : batch_rooms_) {
+        for (ServiceContext* services_context : batch_room->servicesContexts()) {
+            services_context->takeReadyTimers(ready_timers_);
+
+            for (Timer* ready_timer : ready_timers_) {
+                // Might have been cleared, or listed twice if requested again after clear, since it was listed
+                if (!ready_timer->isWaitingCountdown())
+                    continue;
+
+                const std::size_t timer_token { ready_timer->token() };
+                const auto insert_result { pending_timers_.insert({ timer_token, { *ready_timer, batch_room } }) };
+
+                assert(insert_result.second); // Checks for token and timer ref insertion into registry
+
+                ready_timer->onNextClear([this, timer_token]() {
+                    // If timer is set to Disabled without having been triggered, then executor didn't remove its
+                    // entry from pending timers dictionary, it must be done otherwise it cannot be enabled used
+
+                    pending_timers_.erase(timer_token); // Will erase if not removed by begin triggered before
+                });
+                io_interface_.beginTimer(*ready_timer); // Will be set to pending by implementation
+            }
+        }
+    }
+
+    batch_rooms_.clear();
+}
+
 
 Executor::Executor(InputOutputInterface& io_interface, Utils::LoggingContext& logger_context) :
     logger_context_ { logger_context },
     logger_ { "Executor", logger_context_ },
     io_interface_ { io_interface },
     events_visitor_ { *this },
-    loop_routine_ { []() {} } /* default behavior of loop's routine is to do nothing */ {}
+    loop_routine_ { []() {} } /* default behavior of loop's routine is to do nothing */,
+    inputs_batch_size_ { 1 },
+    default_room_ { nullptr },
+    input_room_ { nullptr },
+    room_workers_ { 1 },
+    room_scheduler_ { nullptr },
+    room_jobs_count_ { 0 },
+    tasks_count_ { 0 },
+    task_workers_ { 1 },
+    latencies_ { nullptr },
+    metrics_ { nullptr },
+    slow_requests_ { nullptr },
+    input_sample_ { nullptr },
+    tracer_ { nullptr },
+    load_ { nullptr },
+    arena_ { nullptr } {}
 
 void Executor::make(std::function<void()> loop_routine) {
     if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
@@ -88,67 +439,324 @@ void Executor::make(std::function<void()> loop_routine) {
     loop_routine_ = std::move(loop_routine);
 }
 
+void Executor::batchInputs(const std::size_t inputs_batch_size) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    if (inputs_batch_size == 0)
+        throw std::invalid_argument { "At least 1 input event must be handled for each main loop iteration" };
+
+    inputs_batch_size_ = inputs_batch_size;
+}
+
+void Executor::scheduleRooms(const std::size_t workers_count) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    if (workers_count == 0)
+        throw std::invalid_argument { "At least 1 worker is required to handle rooms" };
+
+    room_workers_ = workers_count;
+}
+
+void Executor::offloadTasks(const std::size_t workers_count) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    if (workers_count == 0)
+        throw std::invalid_argument { "At least 1 worker is required to run tasks" };
+
+    task_workers_ = workers_count;
+}
+
+void Executor::pinLoopThread(const std::size_t cpu) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    loop_cpu_ = cpu;
+}
+
+void Executor::pinRoomWorkers(std::vector<std::size_t> cpus) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    room_workers_cpus_ = std::move(cpus);
+}
+
+void Executor::recordLatencies(Utils::PipelineLatencies& latencies) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    latencies_ = &latencies;
+}
+
+void Executor::sampleSlowRequests(Utils::SlowRequestSampler& slow_requests) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    slow_requests_ = &slow_requests;
+}
+
+void Executor::recordMetrics(Utils::RuntimeMetrics& metrics) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    metrics_ = &metrics;
+}
+
+void Executor::recordTrace(Utils::LoopTracer& tracer) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    tracer_ = &tracer;
+}
+
+void Executor::monitorLoad(Utils::LoadMonitor& load_monitor) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    load_ = &load_monitor;
+}
+
+void Executor::useIterationArena(Utils::IterationArena& arena) {
+    if (events_visitor_.isConfigured()) // Configured underlying visitor means run() has been called once
+        throw BadExecutorMode {};
+
+    arena_ = &arena;
+}
+
 bool Executor::run(std::initializer_list<std::reference_wrapper<Service>> services) {
-    // Protocol initialization with created services
-    ServiceEventRequestProtocol ser_protocol { services, logger_context_ };
+    // Single room hosting every actor, running given services which outlive it
+    Rooms rooms { [this, services](const std::uint64_t room_id) {
+        return std::make_unique<Room>(room_id, Room::UNLIMITED, services, logger_context_);
+    } };
+
+    // Every event is related to the only room
+    default_room_ = &rooms.first();
+
+    return runLoop(rooms);
+}
+
+bool Executor::runRooms(Rooms::RoomFactory room_factory, Rooms::MatchBucket match_bucket) {
+    Rooms rooms { std::move(room_factory), std::move(match_bucket) };
+
+    return runLoop(rooms);
+}
+
+bool Executor::runLoop(Rooms& rooms) {
     // run() called, ends configuration mode
-    events_visitor_.markReady(ser_protocol);
+    events_visitor_.markReady(rooms);
+
+    // Workers threads are only started if rooms steps must run on many of them
+    std::optional<RoomScheduler> room_scheduler;
+    if (room_workers_ > 1) {
+        room_scheduler.emplace(room_workers_, room_workers_cpus_);
+        room_scheduler_ = &*room_scheduler;
+
+        logger_.info("Rooms scheduled on {} workers.", room_workers_);
+    }
+
+    if (loop_cpu_.has_value()) {
+        // Pinned thread affinity would be inherited by tasks workers started from main loop
+        if (!task_pool_)
+            startTaskPool();
+
+        Utils::pinCurrentThread(*loop_cpu_);
+
+        logger_.info("Main loop pinned to CPU {}.", *loop_cpu_);
+    }
 
     logger_.info("Starts main loop.");
 
     try { // Any errors occurring during main loop execution will
         while (!io_interface_.closed()) { // Main loop must run as long as inputs and outputs with players can occur
+            if (tracer_)
+                tracer_->beginIteration();
+
+            // Clock isn't read if load isn't monitored
+            Utils::LoadMonitor::Clock::time_point wait_begin;
+            if (load_)
+                wait_begin = Utils::LoadMonitor::Clock::now();
+
             // Blocking until receiving external event to handle (timer, data packet, etc.)
-            const AnyInputEvent input_event { io_interface_.waitForInput() };
+            AnyInputEvent input_event { [this]() {
+                const Utils::TraceSpan wait_span { tracer_, "waitForInput" };
 
-            boost::apply_visitor(events_visitor_, input_event);
+                return io_interface_.waitForInput();
+            }() };
 
-            // Handlers on services might have been called, checks for waiting timers
-            for (auto service : services) {
-                for (auto waiting_timer : service.get().getWaitingTimers()) { // For each Ready timer in each service
-                    const std::size_t timer_token { waiting_timer.get().token() };
-                    const auto insert_result { pending_timers_.insert({ timer_token, waiting_timer }) };
+            Utils::LoadMonitor::Clock::time_point busy_begin;
+            if (load_)
+                busy_begin = Utils::LoadMonitor::Clock::now();
 
-                    assert(insert_result.second); // Checks for token and timer ref insertion into registry
+            room_jobs_index_.emplace(arena_ ? &arena_->resource() : std::pmr::get_default_resource());
 
-                    waiting_timer.get().onNextClear([this, timer_token]() {
-                        // If timer is set to Disabled without having been triggered, then executor didn't remove its
-                        // entry from pending timers dictionary, it must be done otherwise it cannot be enabled used
+            std::size_t handled_inputs { 0 };
+            while (true) { // Handles every ready input event inside batch before syncing with clients
+                if (latencies_) {
+                    const auto received_at {
+                        std::visit([](const InputEvent& event) { return event.receivedAt(); }, input_event)
+                    };
 
-                        pending_timers_.erase(timer_token); // Will erase if not removed by begin triggered before
-                    });
-                    io_interface_.beginTimer(waiting_timer.get()); // Will be set to pending by implementation
+                    // Only events triggered by a client message are stamped
+                    if (received_at != Utils::PipelineLatencies::Clock::time_point {})
+                        latencies_->recordSince(Utils::PipelineStage::Receive, received_at);
                 }
+
+                if (metrics_)
+                    metrics_->inputEventHandled();
+
+                // Allocations done by this thread until room is synced are attributed to handled event
+                Utils::AllocationCounts event_allocations_begin;
+                if constexpr (Utils::AllocationProfiler::ENABLED)
+                    event_allocations_begin = Utils::AllocationProfiler::currentThread();
+
+                input_sample_ = nullptr; // Only SR commands are sampled
+                if (slow_requests_) {
+                    if (const auto* const sr_event { std::get_if<ServiceRequestEvent>(&input_event) }) {
+                        Utils::SampledRequest& sampled_request { slow_requests_->begin() };
+                        const auto handled_at { Utils::SampledRequest::Clock::now() };
+                        const auto received_at { sr_event->receivedAt() };
+
+                        sampled_request.actor = sr_event->actor();
+                        sampled_request.handledAt = handled_at;
+                        // Events which weren't stamped by IO interface are considered as read when handled
+                        sampled_request.receivedAt = received_at == Utils::SampledRequest::Clock::time_point {}
+                                ? handled_at
+                                : received_at;
+                        sampled_request.requestBytes = sr_event->serviceRequest().size();
+                        sampled_request.pendingInputs = io_interface_.pendingInputs();
+                        sampled_request.batchPosition = handled_inputs;
+
+                        input_sample_ = &sampled_request;
+                    }
+                }
+
+                input_room_ = nullptr; // Visitor sets room event is related to, if any
+                {
+                    const Utils::TraceSpan handler_span { tracer_, INPUT_EVENTS_NAMES[input_event.index()] };
+
+                    std::visit(events_visitor_, input_event);
+                }
+
+                // Calls routine for operations which must be performed or checked for iteration no matter which input
+                // event were emitted
+
+                RPT_LOG_TRACE(logger_, "Entering loop routine...");
+                {
+                    const Utils::TraceSpan routine_span { tracer_, "loopRoutine" };
+
+                    loop_routine_();
+                }
+                RPT_LOG_TRACE(logger_, "Loop routine done.");
+
+                if (input_room_ && !room_scheduler_) { // Only room which handled input event might have progressed
+                    RPT_LOG_DEBUG(logger_, "Syncing room {}...", input_room_->id());
+
+                    const Utils::TraceSpan sync_span { tracer_, "syncRoom" };
+
+                    std::vector<RoomOutput>& room_outputs { jobFor(*input_room_).outputs };
+                    syncRoom(*input_room_, room_outputs, latencies_);
+
+                    if (input_sample_) // Reply has already been sent, every output was polled by sync
+                        finishSample(*slow_requests_, *input_sample_, room_outputs.size());
+
+                    sendRoomOutputs(room_outputs);
+
+                    RPT_LOG_DEBUG(logger_, "Room synced.");
+                }
+
+                if constexpr (Utils::AllocationProfiler::ENABLED) {
+                    Utils::AllocationProfiler::inputEventHandled(
+                            INPUT_EVENTS_NAMES[input_event.index()],
+                            Utils::AllocationProfiler::currentThread() - event_allocations_begin);
+                }
+
+                // Timers coalesced by IO interface are handled inside same iteration, whatever batch size
+                if (!std::holds_alternative<TimerEvent>(input_event))
+                    handled_inputs++;
+
+                if (handled_inputs == inputs_batch_size_ || io_interface_.closed()) // Batch is done
+                    break;
+
+                std::optional<AnyInputEvent> next_input_event { [this]() {
+                    const Utils::TraceSpan drain_span { tracer_, "pollInput" };
+
+                    return io_interface_.pollInput();
+                }() };
+
+                if (!next_input_event.has_value()) // No more input event ready, batch is done
+                    break;
+
+                input_event = std::move(*next_input_event);
             }
 
-            // Calls routine for operations which must be performed or checked for iteration no matter which input
-            // event were emitted
+            if (room_scheduler_) { // Whole batch has been received, rooms can run their steps
+                const Utils::TraceSpan steps_span { tracer_, "roomSteps" };
+
+                runRoomJobs();
+            }
+
+            // Batch is done, its jobs are not used anymore
+            room_jobs_count_ = 0;
+            room_jobs_index_.reset(); // Destroyed before arena memory is reused
+
+            recycleEventsStorage(); // Batch outputs have all been sent
 
-            logger_.trace("Entering loop routine...");
-            loop_routine_();
-            logger_.trace("Loop routine done.");
+            {
+                const Utils::TraceSpan tasks_span { tracer_, "beginSubmittedTasks" };
 
-            // After all required handlers and operations have been done, events emitted by services should also be
-            // handled in the order they appeared so clients can be synced with server services state
+                beginSubmittedTasks();
+            }
 
-            logger_.debug("Polling service events...");
+            {
+                const Utils::TraceSpan timers_span { tracer_, "beginReadyTimers" };
 
-            std::optional<ServiceEvent> next_svc_event { ser_protocol.pollServiceEvent() }; // Read first event
-            while (next_svc_event) { // Then while next event actually exists, handles it
-                logger_.debug("Output event: {}", next_svc_event->command());
-                io_interface_.outputEvent(std::move(*next_svc_event)); // Sent across actors
+                beginReadyTimers();
+            }
 
-                next_svc_event = ser_protocol.pollServiceEvent(); // Read next event
+            if (metrics_) { // Updated once timers triggered or cleared by whole batch have been removed
+                metrics_->pendingTimers(pending_timers_.size());
+                metrics_->occupiedRooms(rooms.occupiedCount());
             }
 
-            logger_.debug("Events polled.");
+            if (slow_requests_) // Requests of this iteration are all synced
+                logSlowRequests();
+
+            if (load_) {
+                const std::size_t queue_depth { io_interface_.pendingInputs() };
+                const bool overload_changed {
+                    load_->iterationDone(busy_begin - wait_begin, Utils::LoadMonitor::Clock::now() - busy_begin,
+                                         queue_depth)
+                };
+
+                if (overload_changed && load_->overloaded()) {
+                    logger_.warn("Main loop overloaded, saturation {:.2f}, {} queued input events. Shedding load.",
+                                 load_->saturation(), queue_depth);
+                } else if (overload_changed) {
+                    logger_.info("Main loop recovered, saturation {:.2f}.", load_->saturation());
+                }
+
+                if (metrics_)
+                    metrics_->loopLoad(load_->saturation(), load_->overloaded());
+            }
+
+            if (arena_) // Transient data of this iteration isn't used anymore
+                arena_->reset();
+
+            if (tracer_ && tracer_->dumpIfRequested()) // Iteration spans are all recorded
+                logger_.info("Main loop trace dumped.");
         }
 
         logger_.info("Stopped.");
+        room_scheduler_ = nullptr;
+        task_pool_.reset(); // Running tasks are done before services they might use are destroyed
 
         return true;
     } catch (const std::exception& err) {
         logger_.error("Runtime error: {}", err.what());
+        room_scheduler_ = nullptr;
+        task_pool_.reset();
 
         return false;
     }
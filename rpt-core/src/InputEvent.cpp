@@ -7,12 +7,20 @@ namespace RpT::Core {
  * Base class
  */
 
-InputEvent::InputEvent(std::uint64_t actor) : actor_ { actor } {}
+InputEvent::InputEvent(std::uint64_t actor) : actor_ { actor }, received_at_ {} {}
 
 std::uint64_t InputEvent::actor() const {
     return actor_;
 }
 
+std::chrono::steady_clock::time_point InputEvent::receivedAt() const {
+    return received_at_;
+}
+
+void InputEvent::receivedAt(const std::chrono::steady_clock::time_point received_at) {
+    received_at_ = received_at;
+}
+
 /*
  * None
  */
@@ -64,5 +72,16 @@ Utils::HandlingResult LeftEvent::disconnectionReason() const {
     return disconnection_reason_;
 }
 
+/*
+ * Task completed
+ */
+
+TaskCompletedEvent::TaskCompletedEvent(const std::uint64_t actor, const std::uint64_t token)
+: InputEvent { actor }, token_ { token } {}
+
+std::uint64_t TaskCompletedEvent::token() const {
+    return token_;
+}
+
 
 }
@@ -0,0 +1,197 @@
+#include <RpT-Core/InputEventsLog.hpp>
+
+#include <algorithm>
+
+
+namespace RpT::Core {
+
+
+namespace {
+
+
+/// Maximum number of bytes for an unsigned LEB128 varint holding 64 bits
+constexpr std::size_t MAX_VARINT_LENGTH { 10 };
+
+/// Maximum length for SR commands, actors names and errors messages, so ill-formed lengths don't allocate too much
+constexpr std::uint64_t MAX_STRING_LENGTH { 16 * 1024 * 1024 };
+
+constexpr std::uint8_t NONE_EVENT { 0 };
+constexpr std::uint8_t SERVICE_REQUEST_EVENT { 1 };
+constexpr std::uint8_t TIMER_EVENT { 2 };
+constexpr std::uint8_t JOINED_EVENT { 3 };
+constexpr std::uint8_t LEFT_EVENT { 4 };
+constexpr std::uint8_t TASK_COMPLETED_EVENT { 5 };
+
+constexpr std::uint8_t CLEAN_DISCONNECTION { 0 };
+constexpr std::uint8_t CRASHED_DISCONNECTION { 1 };
+
+
+/// Appends given value as an unsigned LEB128 varint
+void appendVarint(std::string& output, std::uint64_t value) {
+    // 7 bits for each byte, most significant bit set if another byte follows
+    while (value >= 0x80) {
+        output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    output.push_back(static_cast<char>(value));
+}
+
+/// Appends given string length as a varint, then its bytes
+void appendString(std::string& output, const std::string_view value) {
+    appendVarint(output, value.length());
+    output.append(value);
+}
+
+
+}
+
+
+/*
+ * Writer
+ */
+
+InputEventsLogWriter::InputEventsLogWriter(std::ostream& output) : output_ { output }, last_offset_ { 0 } {
+    output_.write(InputEventsLogFormat::MAGIC.data(), static_cast<std::streamsize>(InputEventsLogFormat::MAGIC.size()));
+    output_.put(static_cast<char>(InputEventsLogFormat::VERSION));
+}
+
+void InputEventsLogWriter::write(const std::chrono::nanoseconds offset, const AnyInputEvent& event) {
+    const std::chrono::nanoseconds record_offset { std::max(offset, last_offset_) };
+    const bool stamped {
+        std::visit([](const InputEvent& input_event) {
+            return input_event.receivedAt() != std::chrono::steady_clock::time_point {};
+        }, event)
+    };
+
+    const auto event_type { static_cast<std::uint8_t>(event.index()) };
+
+    std::string record;
+    record.push_back(static_cast<char>(stamped ? event_type | InputEventsLogFormat::STAMPED_FLAG : event_type));
+    appendVarint(record, static_cast<std::uint64_t>((record_offset - last_offset_).count()));
+    appendVarint(record, std::visit([](const InputEvent& input_event) { return input_event.actor(); }, event));
+
+    if (const auto* const sr_event { std::get_if<ServiceRequestEvent>(&event) }) {
+        appendString(record, sr_event->serviceRequest());
+    } else if (const auto* const timer_event { std::get_if<TimerEvent>(&event) }) {
+        appendVarint(record, timer_event->token());
+    } else if (const auto* const joined_event { std::get_if<JoinedEvent>(&event) }) {
+        appendString(record, joined_event->playerName());
+    } else if (const auto* const left_event { std::get_if<LeftEvent>(&event) }) {
+        const Utils::HandlingResult disconnection_reason { left_event->disconnectionReason() };
+
+        if (disconnection_reason) {
+            record.push_back(static_cast<char>(CLEAN_DISCONNECTION));
+        } else {
+            record.push_back(static_cast<char>(CRASHED_DISCONNECTION));
+            appendString(record, disconnection_reason.errorMessage());
+        }
+    } else if (const auto* const task_event { std::get_if<TaskCompletedEvent>(&event) }) {
+        appendVarint(record, task_event->token());
+    }
+
+    output_.write(record.data(), static_cast<std::streamsize>(record.size()));
+    last_offset_ = record_offset;
+}
+
+void InputEventsLogWriter::flush() {
+    output_.flush();
+}
+
+/*
+ * Reader
+ */
+
+std::uint8_t InputEventsLogReader::readByte() {
+    const auto next_byte { input_.get() };
+    if (next_byte == std::istream::traits_type::eof())
+        throw BadInputEventsLog { "Truncated record" };
+
+    return static_cast<std::uint8_t>(next_byte);
+}
+
+std::uint64_t InputEventsLogReader::readVarint() {
+    std::uint64_t value { 0 };
+
+    for (std::size_t i { 0 }; i < MAX_VARINT_LENGTH; i++) {
+        const std::uint8_t next_byte { readByte() };
+        const std::uint64_t value_bits { next_byte & 0x7Fu };
+
+        // Last byte can only hold most significant bit for a 64 bits value
+        if (i == MAX_VARINT_LENGTH - 1 && value_bits > 1)
+            throw BadInputEventsLog { "Varint overflows 64 bits" };
+
+        value |= value_bits << (7 * i);
+
+        if ((next_byte & 0x80) == 0) // No byte follows
+            return value;
+    }
+
+    throw BadInputEventsLog { "Varint overflows 64 bits" };
+}
+
+std::string InputEventsLogReader::readString() {
+    const std::uint64_t length { readVarint() };
+    if (length > MAX_STRING_LENGTH)
+        throw BadInputEventsLog { "String length " + std::to_string(length) + " is too long" };
+
+    std::string value(length, '\0');
+    if (!input_.read(value.data(), static_cast<std::streamsize>(length)))
+        throw BadInputEventsLog { "Truncated string" };
+
+    return value;
+}
+
+InputEventsLogReader::InputEventsLogReader(std::istream& input) : input_ { input }, last_offset_ { 0 } {
+    std::string magic(InputEventsLogFormat::MAGIC.size(), '\0');
+    if (!input_.read(magic.data(), static_cast<std::streamsize>(magic.size())) || magic != InputEventsLogFormat::MAGIC)
+        throw BadInputEventsLog { "Missing header" };
+
+    const auto version { input_.get() };
+    if (version != InputEventsLogFormat::VERSION)
+        throw BadInputEventsLog { "Unsupported format version " + std::to_string(version) };
+}
+
+std::optional<LoggedInputEvent> InputEventsLogReader::next() {
+    const auto type_byte { input_.get() };
+    if (type_byte == std::istream::traits_type::eof()) // Records boundary, end of log
+        return {};
+
+    const bool stamped { (type_byte & InputEventsLogFormat::STAMPED_FLAG) != 0 };
+    const auto event_type { static_cast<std::uint8_t>(type_byte & ~InputEventsLogFormat::STAMPED_FLAG) };
+
+    const std::chrono::nanoseconds offset {
+        last_offset_ + std::chrono::nanoseconds { static_cast<std::chrono::nanoseconds::rep>(readVarint()) }
+    };
+    const std::uint64_t actor { readVarint() };
+
+    last_offset_ = offset;
+
+    switch (event_type) {
+    case NONE_EVENT:
+        return LoggedInputEvent { offset, NoneEvent { actor }, stamped };
+    case SERVICE_REQUEST_EVENT:
+        return LoggedInputEvent { offset, ServiceRequestEvent { actor, readString() }, stamped };
+    case TIMER_EVENT:
+        return LoggedInputEvent { offset, TimerEvent { actor, readVarint() }, stamped };
+    case JOINED_EVENT:
+        return LoggedInputEvent { offset, JoinedEvent { actor, readString() }, stamped };
+    case LEFT_EVENT: {
+        const std::uint8_t disconnection { readByte() };
+
+        if (disconnection == CLEAN_DISCONNECTION)
+            return LoggedInputEvent { offset, LeftEvent { actor }, stamped };
+        else if (disconnection == CRASHED_DISCONNECTION)
+            return LoggedInputEvent { offset, LeftEvent { actor, readString() }, stamped };
+        else
+            throw BadInputEventsLog { "Unknown disconnection kind " + std::to_string(disconnection) };
+    }
+    case TASK_COMPLETED_EVENT:
+        return LoggedInputEvent { offset, TaskCompletedEvent { actor, readVarint() }, stamped };
+    default:
+        throw BadInputEventsLog { "Unknown event type " + std::to_string(event_type) };
+    }
+}
+
+
+}
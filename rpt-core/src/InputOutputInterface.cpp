@@ -5,6 +5,16 @@ namespace RpT::Core {
 
 InputOutputInterface::InputOutputInterface() : closed_ { false } {}
 
+std::optional<AnyInputEvent> InputOutputInterface::pollInput() {
+    return {};
+}
+
+std::size_t InputOutputInterface::pendingInputs() const {
+    return 0;
+}
+
+void InputOutputInterface::beginTask(std::uint64_t) {}
+
 void InputOutputInterface::close() {
     closed_ = true;
 }
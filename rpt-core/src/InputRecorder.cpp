@@ -0,0 +1,86 @@
+#include <RpT-Core/InputRecorder.hpp>
+
+
+namespace RpT::Core {
+
+
+void InputRecorder::record(const AnyInputEvent& event) {
+    const auto recorded_at { std::chrono::steady_clock::now() };
+    if (!first_event_at_)
+        first_event_at_ = recorded_at;
+
+    log_writer_.write(recorded_at - *first_event_at_, event);
+    recorded_events_++;
+}
+
+void InputRecorder::checkClosed() {
+    if (!closed() && recorded_interface_.closed()) { // Recorded interface closed itself, no more event will come
+        log_writer_.flush();
+        InputOutputInterface::close();
+    }
+}
+
+InputRecorder::InputRecorder(InputOutputInterface& recorded_interface, std::ostream& log)
+: recorded_interface_ { recorded_interface }, log_writer_ { log }, recorded_events_ { 0 } {}
+
+AnyInputEvent InputRecorder::waitForInput() {
+    AnyInputEvent input_event { recorded_interface_.waitForInput() };
+
+    record(input_event);
+    checkClosed();
+
+    return input_event;
+}
+
+std::optional<AnyInputEvent> InputRecorder::pollInput() {
+    std::optional<AnyInputEvent> input_event { recorded_interface_.pollInput() };
+
+    if (input_event)
+        record(*input_event);
+
+    checkClosed();
+
+    return input_event;
+}
+
+std::size_t InputRecorder::pendingInputs() const {
+    return recorded_interface_.pendingInputs();
+}
+
+void InputRecorder::replyTo(const std::uint64_t sr_actor, std::string sr_response) {
+    recorded_interface_.replyTo(sr_actor, std::move(sr_response));
+}
+
+void InputRecorder::outputEvent(const ServiceEvent& event) {
+    recorded_interface_.outputEvent(event);
+}
+
+void InputRecorder::beginTimer(Timer& ready_timer) {
+    recorded_interface_.beginTimer(ready_timer);
+}
+
+void InputRecorder::beginTask(const std::uint64_t token) {
+    recorded_interface_.beginTask(token);
+}
+
+void InputRecorder::completeTask(const std::uint64_t token) {
+    recorded_interface_.completeTask(token);
+}
+
+void InputRecorder::closePipelineWith(const std::uint64_t actor, const Utils::HandlingResult& clean_shutdown) {
+    recorded_interface_.closePipelineWith(actor, clean_shutdown);
+}
+
+void InputRecorder::close() {
+    recorded_interface_.close();
+
+    log_writer_.flush();
+    InputOutputInterface::close();
+}
+
+std::uint64_t InputRecorder::recordedEvents() const {
+    return recorded_events_;
+}
+
+
+}
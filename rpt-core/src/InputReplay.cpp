@@ -0,0 +1,117 @@
+#include <RpT-Core/InputReplay.hpp>
+
+#include <thread>
+
+
+namespace RpT::Core {
+
+
+std::optional<AnyInputEvent> InputReplay::replayNext(const bool wait) {
+    while (next_event_) {
+        const auto now { std::chrono::steady_clock::now() };
+        if (!first_event_at_) // Offsets are replayed from first retrieved event
+            first_event_at_ = now;
+
+        const auto ready_at { *first_event_at_ + next_event_->offset };
+        if (pace_ == ReplayPace::Original && ready_at > now) {
+            if (!wait)
+                return {};
+
+            std::this_thread::sleep_until(ready_at);
+        }
+
+        LoggedInputEvent logged_event { std::move(*next_event_) };
+        next_event_ = log_reader_.next();
+
+        if (const auto* const timer_event { std::get_if<TimerEvent>(&logged_event.event) }) {
+            // Executor only knows pending timers, replayed timer must be one of them
+            if (pending_timers_.erase(timer_event->token()) == 0) {
+                skipped_events_++;
+                continue;
+            }
+        } else if (const auto* const task_event { std::get_if<TaskCompletedEvent>(&logged_event.event) }) {
+            // Same for tasks
+            if (pending_tasks_.erase(task_event->token()) == 0) {
+                skipped_events_++;
+                continue;
+            }
+        }
+
+        if (logged_event.stamped) {
+            const auto retrieved_at { std::chrono::steady_clock::now() };
+
+            std::visit([retrieved_at](InputEvent& event) { event.receivedAt(retrieved_at); },
+                                 logged_event.event);
+        }
+
+        replayed_events_++;
+
+        return std::move(logged_event.event);
+    }
+
+    return {};
+}
+
+InputReplay::InputReplay(std::istream& log, const ReplayPace pace)
+: log_reader_ { log }, pace_ { pace }, replayed_events_ { 0 }, skipped_events_ { 0 } {
+    next_event_ = log_reader_.next();
+}
+
+AnyInputEvent InputReplay::waitForInput() {
+    std::optional<AnyInputEvent> replayed_event { replayNext(true) };
+
+    if (!next_event_) // Log is done, executor stops once this event has been handled
+        close();
+
+    if (!replayed_event) // Only remaining events were skipped
+        return NoneEvent { 0 };
+
+    return std::move(*replayed_event);
+}
+
+std::optional<AnyInputEvent> InputReplay::pollInput() {
+    if (closed())
+        return {};
+
+    std::optional<AnyInputEvent> replayed_event { replayNext(false) };
+
+    if (!next_event_) // Log is done, executor stops once this event has been handled
+        close();
+
+    return replayed_event;
+}
+
+void InputReplay::replyTo(std::uint64_t, std::string) {}
+
+void InputReplay::outputEvent(const ServiceEvent&) {}
+
+void InputReplay::beginTimer(Timer& ready_timer) {
+    const std::uint64_t token { ready_timer.token() };
+
+    ready_timer.beginCountdown(); // Countdown itself is replayed by logged timer event
+    pending_timers_.insert(token);
+
+    // If RpT timer is cancelled (clear()), then its logged timer event must be skipped
+    ready_timer.onNextClear([this, token]() {
+        pending_timers_.erase(token);
+    });
+}
+
+void InputReplay::beginTask(const std::uint64_t token) {
+    pending_tasks_.insert(token);
+}
+
+void InputReplay::completeTask(std::uint64_t) {}
+
+void InputReplay::closePipelineWith(std::uint64_t, const Utils::HandlingResult&) {}
+
+std::uint64_t InputReplay::replayedEvents() const {
+    return replayed_events_;
+}
+
+std::uint64_t InputReplay::skippedEvents() const {
+    return skipped_events_;
+}
+
+
+}
@@ -0,0 +1,297 @@
+#include <RpT-Core/Room.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace RpT::Core {
+
+
+ServiceEventRequestProtocol& Room::serProtocol() {
+    if (!ser_protocol_.has_value())
+        throw BadRoomServices { id_, "Services aren't registered yet" };
+
+    return *ser_protocol_;
+}
+
+const ServiceEventRequestProtocol& Room::serProtocol() const {
+    if (!ser_protocol_.has_value())
+        throw BadRoomServices { id_, "Services aren't registered yet" };
+
+    return *ser_protocol_;
+}
+
+Room::Room(const std::uint64_t id, const std::size_t capacity) : id_ { id }, capacity_ { capacity } {}
+
+void Room::setSpectator(const std::uint64_t actor, const bool spectating) {
+    if (actors_.count(actor) == 0)
+        throw BadRoomActor { actor, "Not inside room " + std::to_string(id_) };
+
+    if (spectating)
+        spectators_.insert(actor);
+    else
+        spectators_.erase(actor);
+}
+
+void Room::flushSpectators() {
+    if (!spectators_.empty()) {
+        const ActorUidsSet spectators { spectators_.begin(), spectators_.end() };
+
+        for (ServiceEvent& kept_event : spectators_backlog_)
+            spectators_events_.push_back(std::move(kept_event).withTargets(spectators).asBestEffort());
+    }
+
+    spectators_backlog_.clear();
+}
+
+void Room::spectatorsBacklogged() {}
+
+void Room::runServices(const std::initializer_list<std::reference_wrapper<Service>> services,
+                       Utils::LoggingContext& logging_context) {
+
+    if (ser_protocol_.has_value())
+        throw BadRoomServices { id_, "Services are already registered" };
+
+    ser_protocol_.emplace(services, logging_context);
+}
+
+Room::Room(const std::uint64_t id, const std::size_t capacity,
+           const std::initializer_list<std::reference_wrapper<Service>> services,
+           Utils::LoggingContext& logging_context) : Room { id, capacity } {
+
+    runServices(services, logging_context);
+}
+
+std::uint64_t Room::id() const {
+    return id_;
+}
+
+std::size_t Room::capacity() const {
+    return capacity_;
+}
+
+const std::unordered_set<std::uint64_t>& Room::actors() const {
+    return actors_;
+}
+
+const std::unordered_set<std::uint64_t>& Room::spectators() const {
+    return spectators_;
+}
+
+bool Room::isSpectator(const std::uint64_t actor) const {
+    return spectators_.count(actor) == 1;
+}
+
+bool Room::isFull() const {
+    return actors_.size() == capacity_;
+}
+
+bool Room::isEmpty() const {
+    return actors_.empty();
+}
+
+void Room::join(const std::uint64_t actor) {
+    if (isFull())
+        throw BadRoomActor { actor, "Room " + std::to_string(id_) + " is full" };
+
+    if (!actors_.insert(actor).second) // If insertion failed because actor is already inside room...
+        throw BadRoomActor { actor, "Already inside room " + std::to_string(id_) };
+}
+
+void Room::leave(const std::uint64_t actor) {
+    if (actors_.erase(actor) != 1) // If actor hasn't been removed because it isn't inside room...
+        throw BadRoomActor { actor, "Not inside room " + std::to_string(id_) };
+
+    spectators_.erase(actor);
+}
+
+std::string Room::handleServiceRequest(const std::uint64_t actor, const std::string_view service_request,
+                                       Utils::PipelineLatencies* const latencies,
+                                       Utils::RuntimeMetrics* const metrics,
+                                       Utils::SampledRequest* const sampled_request) {
+
+    return serProtocol().handleServiceRequest(actor, service_request, latencies, metrics, sampled_request);
+}
+
+std::optional<ServiceEvent> Room::pollServiceEvent() {
+    if (!spectators_events_.empty()) { // Flushed events are sent as soon as possible, so delay doesn't grow
+        ServiceEvent spectators_event { std::move(spectators_events_.front()) };
+        spectators_events_.pop_front();
+
+        return spectators_event;
+    }
+
+    std::optional<ServiceEvent> next_event { serProtocol().pollServiceEvent() };
+
+    // Room which hosts every actor doesn't need to check for targets
+    if (capacity_ == UNLIMITED)
+        return next_event;
+
+    // Events targeting only actors outside room, like virtual actors played by services, are skipped
+    while (next_event.has_value()) {
+        // Room which doesn't host every actor must not sync actors from other rooms
+        if (next_event->targetEveryone()) {
+            if (spectators_.empty())
+                return std::move(*next_event).withTargets(ActorUidsSet { actors_.begin(), actors_.end() });
+
+            // Spectators will receive this event with next flush, only players receive it now
+            // Kept until next flush, so data isn't borrowed from emitting service anymore
+            spectators_backlog_.push_back(ServiceEvent { *next_event }.owningData());
+            if (spectators_backlog_.size() == 1)
+                spectatorsBacklogged();
+
+            ActorUidsSet players;
+            for (const std::uint64_t actor : actors_) {
+                if (spectators_.count(actor) == 0)
+                    players.insert(actor);
+            }
+
+            if (!players.empty())
+                return std::move(*next_event).withTargets(std::move(players));
+
+            next_event = serProtocol().pollServiceEvent();
+            continue;
+        }
+
+        const ActorUidsSet& targets { next_event->targets() };
+        const auto is_inside_room { [this](const std::uint64_t actor) { return actors_.count(actor) == 1; } };
+
+        if (std::all_of(targets.begin(), targets.end(), is_inside_room)) // Usual case, targets are kept
+            return next_event;
+
+        ActorUidsSet room_targets;
+        for (const std::uint64_t target : targets) {
+            if (is_inside_room(target))
+                room_targets.insert(target);
+        }
+
+        if (!room_targets.empty())
+            return std::move(*next_event).withTargets(std::move(room_targets));
+
+        next_event = serProtocol().pollServiceEvent();
+    }
+
+    return next_event;
+}
+
+void Room::recycleEventsStorage() {
+    serProtocol().recycleEventsStorage();
+}
+
+const std::vector<ServiceContext*>& Room::servicesContexts() const {
+    return serProtocol().servicesContexts();
+}
+
+void Room::actorJoined(const JoinedEvent&) {}
+
+void Room::actorLeft(const LeftEvent&) {}
+
+void Room::routine() {}
+
+
+Room& Rooms::open() {
+    const std::uint64_t room_id { opened_rooms_.size() }; // Rooms are never closed, so IDs are following each other
+
+    std::unique_ptr<Room> opened_room { room_factory_(room_id) };
+    assert(opened_room); // Factory must construct a room
+
+    Room& room { *opened_room };
+    opened_rooms_.push_back(std::move(opened_room));
+    rooms_bucket_.push_back(0);
+
+    return room;
+}
+
+Room* Rooms::nextWaitingRoom(const std::uint64_t bucket) {
+    const auto bucket_queue { waiting_rooms_.find(bucket) };
+    if (bucket_queue == waiting_rooms_.end())
+        return nullptr;
+
+    std::deque<Room*>& queued_rooms { bucket_queue->second };
+    while (!queued_rooms.empty()) {
+        Room* const queued_room { queued_rooms.front() };
+
+        // Room might have been filled, emptied or reused for another bucket since it was queued
+        if (!queued_room->isFull() && !queued_room->isEmpty() && rooms_bucket_[queued_room->id()] == bucket)
+            return queued_room;
+
+        queued_rooms.pop_front();
+    }
+
+    return nullptr;
+}
+
+Rooms::Rooms(RoomFactory room_factory, MatchBucket match_bucket)
+: room_factory_ { std::move(room_factory) }, match_bucket_ { std::move(match_bucket) } {
+    empty_rooms_.push_back(&open());
+}
+
+Room& Rooms::assign(const std::uint64_t actor) {
+    if (actors_rooms_.count(actor) == 1)
+        throw BadRoomActor { actor, "Already inside a room" };
+
+    const std::uint64_t bucket { match_bucket_ ? match_bucket_(actor) : 0 };
+    Room* room { nextWaitingRoom(bucket) };
+
+    if (!room) { // Nobody is waiting inside this bucket, actor begins waiting inside an empty room
+        if (empty_rooms_.empty()) {
+            room = &open();
+        } else {
+            room = empty_rooms_.back();
+            empty_rooms_.pop_back();
+        }
+
+        rooms_bucket_[room->id()] = bucket;
+    }
+
+    const bool was_empty { room->isEmpty() };
+
+    room->join(actor);
+    actors_rooms_.insert({ actor, room });
+
+    // Room begins waiting for opponents, other rooms are still at their place inside queue
+    if (was_empty && !room->isFull())
+        waiting_rooms_[bucket].push_back(room);
+
+    return *room;
+}
+
+Room& Rooms::unassign(const std::uint64_t actor) {
+    const auto actor_room { actors_rooms_.find(actor) };
+    if (actor_room == actors_rooms_.end())
+        throw BadRoomActor { actor, "Not inside any room" };
+
+    Room& room { *actor_room->second };
+    actors_rooms_.erase(actor_room);
+
+    const bool was_full { room.isFull() };
+    room.leave(actor);
+
+    if (room.isEmpty()) // Available for any bucket
+        empty_rooms_.push_back(&room);
+    else if (was_full) // Remaining actors are waiting for a new opponent
+        waiting_rooms_[rooms_bucket_[room.id()]].push_back(&room);
+
+    return room;
+}
+
+Room* Rooms::roomOf(const std::uint64_t actor) const {
+    const auto actor_room { actors_rooms_.find(actor) };
+
+    return actor_room == actors_rooms_.cend() ? nullptr : actor_room->second;
+}
+
+Room& Rooms::first() {
+    return *opened_rooms_.front();
+}
+
+std::size_t Rooms::count() const {
+    return opened_rooms_.size();
+}
+
+std::size_t Rooms::occupiedCount() const {
+    return opened_rooms_.size() - empty_rooms_.size();
+}
+
+
+}
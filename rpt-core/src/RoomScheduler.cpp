@@ -0,0 +1,171 @@
+#include <RpT-Core/RoomScheduler.hpp>
+
+#include <stdexcept>
+#include <system_error>
+#include <RpT-Utils/ThreadAffinity.hpp>
+
+
+namespace RpT::Core {
+
+
+RoomScheduler::Step* RoomScheduler::nextStep(const std::size_t worker) {
+    { // Own queue is handled in order, so rooms steps keep their affinity
+        WorkerQueue& own_queue { *queues_[worker] };
+        const std::lock_guard<std::mutex> own_lock { own_queue.mutex };
+
+        if (!own_queue.steps.empty()) {
+            Step* const next_step { own_queue.steps.front() };
+            own_queue.steps.pop_front();
+
+            return next_step;
+        }
+    }
+
+    // Steals last queued step from other workers, beginning with next one so victims are spread
+    for (std::size_t offset { 1 }; offset < queues_.size(); offset++) {
+        WorkerQueue& victim_queue { *queues_[(worker + offset) % queues_.size()] };
+        const std::lock_guard<std::mutex> victim_lock { victim_queue.mutex };
+
+        if (!victim_queue.steps.empty()) {
+            Step* const stolen_step { victim_queue.steps.back() };
+            victim_queue.steps.pop_back();
+
+            return stolen_step;
+        }
+    }
+
+    return nullptr;
+}
+
+void RoomScheduler::work(const std::size_t worker) {
+    Step* next_step { nextStep(worker) };
+
+    while (next_step) {
+        std::exception_ptr step_error;
+        try {
+            next_step->routine();
+        } catch (...) { // Kept for run() caller
+            step_error = std::current_exception();
+        }
+
+        {
+            const std::lock_guard<std::mutex> batch_lock { batch_mutex_ };
+
+            if (step_error && !first_error_)
+                first_error_ = step_error;
+
+            if (--remaining_steps_ == 0) // Last step done, batch can be ended
+                batch_done_.notify_one();
+        }
+
+        next_step = nextStep(worker);
+    }
+}
+
+void RoomScheduler::workerThread(const std::size_t worker) {
+    std::uint64_t handled_batch_id { 0 };
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> batch_lock { batch_mutex_ };
+            const auto batch_begun { [this, handled_batch_id]() {
+                return stopping_ || batch_id_ != handled_batch_id;
+            } };
+
+            batch_begun_.wait(batch_lock, batch_begun);
+
+            if (stopping_)
+                return;
+
+            handled_batch_id = batch_id_;
+        }
+
+        work(worker);
+    }
+}
+
+void RoomScheduler::stopWorkers() {
+    {
+        const std::lock_guard<std::mutex> batch_lock { batch_mutex_ };
+        stopping_ = true;
+    }
+
+    batch_begun_.notify_all();
+
+    for (std::thread& worker_thread : threads_)
+        worker_thread.join();
+}
+
+RoomScheduler::RoomScheduler(const std::size_t workers_count, const std::vector<std::size_t>& workers_cpus)
+: batch_id_ { 0 }, remaining_steps_ { 0 }, stopping_ { false } {
+    if (workers_count == 0)
+        throw std::invalid_argument { "At least 1 worker is required to run rooms steps" };
+
+    for (std::size_t worker { 0 }; worker < workers_count; worker++)
+        queues_.push_back(std::make_unique<WorkerQueue>());
+
+    // First worker is run() caller
+    for (std::size_t worker { 1 }; worker < workers_count; worker++)
+        threads_.emplace_back([this, worker]() { workerThread(worker); });
+
+    if (workers_cpus.empty())
+        return;
+
+    try {
+        for (std::size_t thread_index { 0 }; thread_index < threads_.size(); thread_index++)
+            Utils::pinThread(threads_[thread_index], workers_cpus[thread_index % workers_cpus.size()]);
+    } catch (const std::system_error&) { // Destructor isn't called, started threads must be joined anyway
+        stopWorkers();
+
+        throw;
+    }
+}
+
+RoomScheduler::~RoomScheduler() {
+    stopWorkers();
+}
+
+std::size_t RoomScheduler::workersCount() const {
+    return queues_.size();
+}
+
+void RoomScheduler::run(std::vector<Step>& steps) {
+    if (steps.empty())
+        return;
+
+    // Set before any step is queued, as a worker still looking for steps from previous batch might run it
+    {
+        const std::lock_guard<std::mutex> batch_lock { batch_mutex_ };
+
+        remaining_steps_ = steps.size();
+        first_error_ = nullptr;
+        batch_id_++;
+    }
+
+    for (Step& step : steps) {
+        WorkerQueue& preferred_queue { *queues_[step.affinity % queues_.size()] };
+        const std::lock_guard<std::mutex> queue_lock { preferred_queue.mutex };
+
+        preferred_queue.steps.push_back(&step);
+    }
+
+    batch_begun_.notify_all();
+
+    work(0); // Caller is also a worker
+
+    std::exception_ptr batch_error;
+    {
+        std::unique_lock<std::mutex> batch_lock { batch_mutex_ };
+        const auto batch_done { [this]() { return remaining_steps_ == 0; } };
+
+        batch_done_.wait(batch_lock, batch_done);
+
+        batch_error = first_error_;
+    }
+
+    if (batch_error)
+        std::rethrow_exception(batch_error);
+}
+
+
+}
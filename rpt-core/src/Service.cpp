@@ -18,6 +18,9 @@ void Service::watchTimer(Timer& timer_to_watch) {
 
     if (!insertion_result.second) // If insertion failed because it is already watched...
         throw BadWatchedToken { timer_to_watch, "Already watched" };
+
+    // Ready state will be listed by this service context
+    run_context_.timerWatched(timer_to_watch);
 }
 
 void Service::forgetTimer(Timer& watched_timer) {
@@ -26,40 +29,67 @@ void Service::forgetTimer(Timer& watched_timer) {
 
     if (removed_count != 1) // If given timer have NOT been removed because it isn't watched...
         throw BadWatchedToken { watched_timer, "Not watched" };
+
+    run_context_.timerForgotten(watched_timer);
+}
+
+ServiceContext& Service::runContext() {
+    return run_context_;
 }
 
-void Service::emitEvent(std::string event_command, const std::initializer_list<std::uint64_t> event_targets) {
-    // Event counter is growing, ID is given so trigger order is kept
-    const std::size_t event_id { run_context_.newEventPushed() };
+void Service::pushEvent(const std::string_view event_command,
+                        const std::initializer_list<std::uint64_t> event_targets, const bool best_effort) {
 
-    std::optional<std::unordered_set<std::uint64_t>> targets_list;
+    // Event counter is growing, ID is given so trigger order is kept, and this service is logged as its emitter
+    const std::size_t event_id { run_context_.newEventPushed(*this) };
+
+    std::optional<ActorUidsSet> targets_list;
     // If and only if at least 1 actor UID is provided, select listed UIDs to receive that Event
     if (!std::empty(event_targets))
         targets_list.emplace(event_targets);
     // Else, uninitialized list will be passed so every actor will receive Event
 
-    // Moves Event command inside queue, copies references for UIDs using initializer_list then pushes Service Event
-    events_queue_.push({
-        event_id, ServiceEvent { std::move(event_command), std::move(targets_list) }
-    });
+    // Copies Event command inside arena, UIDs are stored inline for usual small targets lists, then pushes it
+    events_queue_.push({ event_id, events_arena_.copy(event_command), std::move(targets_list), best_effort });
+}
+
+void Service::emitEvent(const std::string_view event_command,
+                        const std::initializer_list<std::uint64_t> event_targets) {
+
+    pushEvent(event_command, event_targets, false);
+}
+
+void Service::emitBestEffortEvent(const std::string_view event_command,
+                                  const std::initializer_list<std::uint64_t> event_targets) {
+
+    pushEvent(event_command, event_targets, true);
 }
 
 std::optional<std::size_t> Service::checkEvent() const {
-    return events_queue_.empty() ? EMPTY_QUEUE : events_queue_.front().first;
+    return events_queue_.empty() ? EMPTY_QUEUE : events_queue_.front().id;
 }
 
 ServiceEvent Service::pollEvent() {
     if (events_queue_.empty()) // There must be at least one event to poll, checked with checkEvent() call
         throw EmptyEventsQueue { name() };
 
-    // Event is moved from queue to local, and will be returned by copy-elision later
-    ServiceEvent event_command { std::move(events_queue_.front().second) };
-    // Moved event can now be destroyed inside queue
+    // Event borrows its command from arena, which will be kept until events storage is recycled
+    QueuedEvent& queued_event { events_queue_.front() };
+    ServiceEvent event_command { ServiceEvent::borrowing(queued_event.command, std::move(queued_event.targets)) };
+    if (queued_event.bestEffort)
+        event_command = std::move(event_command).asBestEffort();
+
+    // Moved event can now be released inside queue
     events_queue_.pop();
 
     return event_command;
 }
 
+void Service::recycleEventsStorage() {
+    if (events_queue_.empty()) // Commands of queued events must not be overwritten
+        events_arena_.reset();
+}
+
 std::vector<std::reference_wrapper<Timer>> Service::getWaitingTimers() {
     std::vector<std::reference_wrapper<Timer>> ready_timers;
     ready_timers.reserve(watched_timers_.size()); // Max number of ready timers is number of current timers
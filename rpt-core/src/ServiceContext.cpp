@@ -1,18 +1,90 @@
 #include <RpT-Core/ServiceContext.hpp>
 
+#include <algorithm>
+
 
 namespace RpT::Core {
 
 
-ServiceContext::ServiceContext() : events_count_ { 0 }, timers_count_ { 0 } {}
+ServiceContext::ServiceContext()
+: events_count_ { 0 }, timers_count_ { 0 }, timers_tokens_provider_ { nullptr }, clear_callbacks_deferred_ { false } {}
+
+ServiceContext::ServiceContext(ServiceContext& timers_tokens_provider)
+: events_count_ { 0 }, timers_count_ { 0 }, timers_tokens_provider_ { &timers_tokens_provider },
+clear_callbacks_deferred_ { false } {}
 
 std::size_t ServiceContext::newEventPushed() {
     return events_count_++;
 }
 
+std::size_t ServiceContext::newEventPushed(Service& emitter) {
+    const std::size_t event_id { newEventPushed() };
+    emitted_events_.push({ event_id, &emitter });
+
+    return event_id;
+}
+
+const ServiceContext::EmittedEvent* ServiceContext::oldestEmittedEvent() const {
+    return emitted_events_.empty() ? nullptr : &emitted_events_.front();
+}
+
+void ServiceContext::popEmittedEvent() {
+    if (!emitted_events_.empty())
+        emitted_events_.pop();
+}
+
 std::size_t ServiceContext::newTimerCreated() {
+    if (timers_tokens_provider_) // Tokens must be unique across every context sharing this provider
+        return timers_tokens_provider_->newTimerCreated();
+
     return timers_count_++;
 }
 
+void ServiceContext::timerWatched(const Timer& watched_timer) {
+    watched_timers_.insert(&watched_timer);
+}
+
+void ServiceContext::timerForgotten(const Timer& forgotten_timer) {
+    watched_timers_.erase(&forgotten_timer);
+
+    ready_timers_.erase(std::remove(ready_timers_.begin(), ready_timers_.end(), &forgotten_timer),
+                        ready_timers_.end());
+}
+
+void ServiceContext::timerReady(Timer& ready_timer) {
+    if (watched_timers_.count(&ready_timer) == 1)
+        ready_timers_.push_back(&ready_timer);
+}
+
+void ServiceContext::takeReadyTimers(std::vector<Timer*>& ready_timers) {
+    ready_timers.clear();
+    ready_timers.swap(ready_timers_);
+}
+
+void ServiceContext::timerCleared(TimerCallbacks& clear_callbacks) {
+    for (std::size_t i { 0 }; i < clear_callbacks.size(); i++) {
+        if (clear_callbacks_deferred_) // Kept until caller thread is allowed to run them
+            deferred_clear_callbacks_.push_back(std::move(clear_callbacks[i]));
+        else
+            clear_callbacks[i]();
+    }
+}
+
+void ServiceContext::deferClearCallbacks(const bool deferred) {
+    clear_callbacks_deferred_ = deferred;
+}
+
+void ServiceContext::runDeferredClearCallbacks() {
+    for (Utils::InlineCallback& clear_callback : deferred_clear_callbacks_)
+        clear_callback();
+
+    deferred_clear_callbacks_.clear();
+}
+
+void ServiceContext::takeSubmittedTasks(std::vector<ServiceTask>& submitted_tasks) {
+    submitted_tasks.clear();
+    submitted_tasks.swap(submitted_tasks_);
+}
+
 
 }
@@ -0,0 +1,59 @@
+#include <RpT-Core/ServiceCoroutine.hpp>
+
+#include <cassert>
+
+
+namespace RpT::Core {
+
+
+ServiceCoroutine::ServiceCoroutine(Utils::InlineCallback body)
+: body_ { std::move(body) }, resume_point_ { DONE }, suspensions_count_ { 0 } {}
+
+int ServiceCoroutine::resumePoint() const {
+    return resume_point_;
+}
+
+bool ServiceCoroutine::isSuspended() const {
+    return resume_point_ != START && resume_point_ != DONE;
+}
+
+bool ServiceCoroutine::isDone() const {
+    return resume_point_ == DONE;
+}
+
+void ServiceCoroutine::start() {
+    resume_point_ = START;
+    suspensions_count_++; // Previous suspension, if any, must not resume body
+
+    body_();
+}
+
+void ServiceCoroutine::cancel() {
+    resume_point_ = DONE;
+    suspensions_count_++;
+}
+
+void ServiceCoroutine::suspendOn(const int resume_point, Timer& awaited_timer) {
+    assert(resume_point != START && resume_point != DONE); // Lines are numbered from 1
+
+    // Awaited again right after it triggered, or awaited while another flow was using it
+    if (!awaited_timer.isFree())
+        awaited_timer.clear();
+
+    resume_point_ = resume_point;
+    const std::uint64_t suspension { ++suspensions_count_ };
+
+    awaited_timer.requestCountdown();
+    awaited_timer.onNextTrigger([this, suspension]() {
+        // Coroutine might have been cancelled or started again while timer was pending
+        if (suspension == suspensions_count_)
+            body_();
+    });
+}
+
+void ServiceCoroutine::finish() {
+    resume_point_ = DONE;
+}
+
+
+}
@@ -4,35 +4,89 @@
 namespace RpT::Core {
 
 
-ServiceEvent::ServiceEvent(std::string command, std::optional<std::unordered_set<std::uint64_t>> actor_uids)
-: targets_ { std::move(actor_uids) }, command_ { std::move(command) } {}
+ServiceEvent::ServiceEvent(std::string command, std::optional<ActorUidsSet> actor_uids)
+: targets_ { std::move(actor_uids) }, data_ { std::move(command) }, best_effort_ { false } {}
+
+ServiceEvent ServiceEvent::borrowing(const std::string_view command, std::optional<ActorUidsSet> actor_uids) {
+    ServiceEvent event { std::string {}, std::move(actor_uids) }; // Empty owned data doesn't allocate
+    event.borrowed_data_ = command;
+
+    return event;
+}
 
 bool ServiceEvent::operator==(const ServiceEvent& rhs) const {
-    return command_ == rhs.command_ && targets_ == rhs.targets_;
+    return command() == rhs.command() && targets_ == rhs.targets_;
 }
 
 bool ServiceEvent::operator!=(const ServiceEvent& rhs) const {
     return !(*this == rhs);
 }
 
-ServiceEvent ServiceEvent::prefixWith(const std::string& higher_protocol_prefix) const {
-    return ServiceEvent { higher_protocol_prefix + command_, targets_ };
+ServiceEvent ServiceEvent::prefixWith(const std::string_view higher_protocol_prefix) const & {
+    return ServiceEvent { *this }.prefixWith(higher_protocol_prefix);
+}
+
+ServiceEvent ServiceEvent::prefixWith(const std::string_view higher_protocol_prefix) && {
+    prefix_.insert(0, higher_protocol_prefix); // Only prefixes are moved, data stays where service wrote it
+
+    return std::move(*this);
+}
+
+ServiceEvent ServiceEvent::withTargets(std::optional<ActorUidsSet> actor_uids) && {
+    targets_ = std::move(actor_uids);
+
+    return std::move(*this);
+}
+
+ServiceEvent ServiceEvent::asBestEffort() && {
+    best_effort_ = true;
+
+    return std::move(*this);
+}
+
+ServiceEvent ServiceEvent::owningData() && {
+    if (borrowed_data_.has_value()) {
+        data_.assign(*borrowed_data_);
+        borrowed_data_.reset();
+    }
+
+    return std::move(*this);
+}
+
+std::string ServiceEvent::command() const {
+    const std::string_view event_data { data() };
+
+    std::string command;
+    command.reserve(prefix_.size() + event_data.size());
+
+    command += prefix_;
+    command += event_data;
+
+    return command;
+}
+
+std::string_view ServiceEvent::prefix() const {
+    return prefix_;
 }
 
-std::string_view ServiceEvent::command() const {
-    return command_;
+std::string_view ServiceEvent::data() const {
+    return borrowed_data_.has_value() ? *borrowed_data_ : std::string_view { data_ };
 }
 
 bool ServiceEvent::targetEveryone() const {
     return !targets_.has_value(); // No UIDs list means every actor receives it
 }
 
-const std::unordered_set<std::uint64_t>& ServiceEvent::targets() const {
+const ActorUidsSet& ServiceEvent::targets() const {
     if (targetEveryone()) // Checks for a UIDs list to be available
         throw NoUidsList {};
 
     return *targets_;
 }
 
+bool ServiceEvent::bestEffort() const {
+    return best_effort_;
+}
+
 
 }
@@ -2,30 +2,26 @@
 
 #include <algorithm>
 #include <cassert>
+#include <charconv>
+#include <limits>
+#include <RpT-Utils/AllocationProfiler.hpp>
 
 
 namespace RpT::Core {
 
 
 ServiceEventRequestProtocol::ServiceRequestCommandParser::ServiceRequestCommandParser(
-        const std::string_view sr_command) : Utils::TextProtocolParser { sr_command, 3 } {
+        const std::string_view sr_command) : Utils::TextProtocolParser { sr_command, 3, std::nothrow } {
 
-    try {
-        const std::string ruid_copy { getParsedWord(1) }; // Required for conversion to unsigned integer
-
-        // `unsigned long long` return type, which is ALWAYS 64 bits large
-        // See: https://en.cppreference.com/w/cpp/language/types
-        parsed_ruid_ = std::stoull(ruid_copy);
-    } catch (const std::invalid_argument&) { // If parsed actor UID argument isn't a valid unsigned integer
-        throw BadServiceRequest { "Request UID must be an unsigned integer of 64 bits" };
-    }
+    if (hasExpectedWords()) // RUID can only be converted if it was parsed, uninitialized if conversion fails
+        parsed_ruid_ = parseInteger<std::uint64_t>(getParsedWord(1));
 }
 
 bool ServiceEventRequestProtocol::ServiceRequestCommandParser::isValidRequest() const {
     return getParsedWord(0) == REQUEST_PREFIX;
 }
 
-std::uint64_t ServiceEventRequestProtocol::ServiceRequestCommandParser::ruid() const {
+std::optional<std::uint64_t> ServiceEventRequestProtocol::ServiceRequestCommandParser::ruid() const {
     return parsed_ruid_;
 }
 
@@ -44,6 +40,15 @@ ServiceEventRequestProtocol::ServiceEventRequestProtocol(
 
         logger_ { "SER-Protocol", logging_context } {
 
+    running_services_.reserve(services.size());
+
+    // At most half of the slots are used, so probe sequences stay short
+    std::size_t dispatch_table_size { 1 };
+    while (dispatch_table_size < services.size() * 2)
+        dispatch_table_size <<= 1;
+
+    dispatch_table_.resize(dispatch_table_size);
+
     // Each given service reference must be registered as running service
     for (const auto service_ref : services) {
         const std::string_view service_name { service_ref.get().name() };
@@ -51,111 +56,256 @@ ServiceEventRequestProtocol::ServiceEventRequestProtocol(
         if (isRegistered(service_name)) // Service name must be unique among running services
             throw ServiceNameAlreadyRegistered { service_name };
 
-        const auto service_registration_result { running_services_.insert({ service_name, service_ref }) };
-        // Must be sure that service has been successfully registered, this is why insertion result is saved
-        assert(service_registration_result.second);
+        // Probes from name hash until a free slot is found, there is always one as table is never full
+        std::size_t slot_index { dispatchHash(service_name) & (dispatch_table_size - 1) };
+        while (dispatch_table_[slot_index].serviceId != FREE_SLOT)
+            slot_index = (slot_index + 1) & (dispatch_table_size - 1);
+
+        dispatch_table_[slot_index] = { service_name, running_services_.size() };
+        running_services_.push_back(service_ref);
+
+        RPT_LOG_DEBUG(logger_, "Registered service {}.", service_name);
 
-        logger_.debug("Registered service {}.", service_name);
+        ServiceContext* const service_context { &service_ref.get().runContext() };
+        // Services are expected to share same context, each different context is only listed once
+        const auto listed_context { std::find(services_contexts_.cbegin(), services_contexts_.cend(), service_context) };
+        if (listed_context == services_contexts_.cend())
+            services_contexts_.push_back(service_context);
     }
 }
 
+std::size_t ServiceEventRequestProtocol::dispatchHash(const std::string_view name) {
+    if (name.empty())
+        return 0;
+
+    return name.size() * 31 + static_cast<unsigned char>(name.front()) * 7 + static_cast<unsigned char>(name.back());
+}
+
+const ServiceEventRequestProtocol::DispatchSlot& ServiceEventRequestProtocol::findSlot(
+        const std::string_view service) const {
+
+    const std::size_t table_mask { dispatch_table_.size() - 1 };
+
+    // Probes from name hash until slot with that name or a free slot is met, table is never full
+    std::size_t slot_index { dispatchHash(service) & table_mask };
+    while (dispatch_table_[slot_index].serviceId != FREE_SLOT && dispatch_table_[slot_index].name != service)
+        slot_index = (slot_index + 1) & table_mask;
+
+    return dispatch_table_[slot_index];
+}
+
+Service* ServiceEventRequestProtocol::findService(const std::string_view service) const {
+    const DispatchSlot& service_slot { findSlot(service) };
+
+    if (service_slot.serviceId == FREE_SLOT) // No service registered with that name
+        return nullptr;
+
+    return &running_services_[service_slot.serviceId].get();
+}
+
+bool ServiceEventRequestProtocol::isRunning(const Service& service) const {
+    return findService(service.name()) == &service;
+}
+
+const ServiceContext::EmittedEvent* ServiceEventRequestProtocol::nextPollableEvent(
+        ServiceContext& services_context) const {
+
+    const ServiceContext::EmittedEvent* oldest_event { services_context.oldestEmittedEvent() };
+    while (oldest_event) {
+        // Event must still be next inside its emitter queue, and emitter must be running inside this protocol
+        if (oldest_event->emitter->checkEvent() == oldest_event->id && isRunning(*oldest_event->emitter))
+            break;
+
+        RPT_LOG_TRACE(logger_, "Event {} can no longer be polled, dropped.", oldest_event->id);
+
+        services_context.popEmittedEvent();
+        oldest_event = services_context.oldestEmittedEvent();
+    }
+
+    return oldest_event;
+}
+
+
+std::string ServiceEventRequestProtocol::formatResponse(const std::uint64_t request_uid,
+                                                        const std::optional<std::string_view> error_message) {
+
+    // Large enough for any 64 bits unsigned integer decimal representation
+    char ruid_digits[std::numeric_limits<std::uint64_t>::digits10 + 1];
+    const auto [ruid_end, conversion_error] { std::to_chars(std::begin(ruid_digits), std::end(ruid_digits),
+                                                            request_uid) };
+
+    assert(conversion_error == std::errc {}); // Buffer is large enough for conversion to always succeed
+
+    const std::string_view ruid { ruid_digits, static_cast<std::size_t>(ruid_end - ruid_digits) };
+    // `OK` or `KO <ERR_MSG>`
+    const std::size_t status_length { error_message ? 3 + error_message->size() : 2 };
+
+    std::string sr_response;
+    // Whole SRR `RESPONSE <RUID> <STATUS>` is written once, with room for a higher protocol prefix
+    sr_response.reserve(RESPONSE_PREFIX.size() + 1 + ruid.size() + 1 + status_length + SR_RESPONSE_HEADROOM);
+
+    sr_response += RESPONSE_PREFIX;
+    sr_response += ' ';
+    sr_response += ruid;
+    sr_response += ' ';
+
+    if (error_message) {
+        sr_response += "KO ";
+        sr_response += *error_message;
+    } else {
+        sr_response += "OK";
+    }
+
+    return sr_response;
+}
 
 bool ServiceEventRequestProtocol::isRegistered(const std::string_view service) const {
-    return running_services_.count(service) == 1; // Returns if service name is present among running services
+    return findService(service) != nullptr; // Returns if service name is present among running services
 }
 
 std::string ServiceEventRequestProtocol::handleServiceRequest(const std::uint64_t actor,
-                                                              const std::string_view service_request) {
+                                                              const std::string_view service_request,
+                                                              Utils::PipelineLatencies* const latencies,
+                                                              Utils::RuntimeMetrics* const metrics,
+                                                              Utils::SampledRequest* const sampled_request) {
 
-    logger_.trace("Handling SR command from \"{}\": {}", actor, service_request);
+    const Utils::AllocationScope ser_allocations { Utils::AllocationSubsystem::Ser };
 
-    std::uint64_t request_uid;
-    std::string_view intended_service_name;
-    std::string_view command_data;
-    try { // Tries to parse received SR command
-        const ServiceRequestCommandParser sr_command_parser { service_request }; // Parsing
+    RPT_LOG_TRACE(logger_, "Handling SR command from \"{}\": {}", actor, service_request);
 
-        if (!sr_command_parser.isValidRequest()) // Checks for SER command prefix, must be REQUEST for a SR command
-            throw InvalidRequestFormat { service_request, "Expected SER command prefix \"REQUEST\" for SR command" };
+    // Parsing, ill-formed SR command is reported by parser so only one exception is thrown for it
+    const ServiceRequestCommandParser sr_command_parser { service_request };
 
-        // Set given parameters to corresponding parsed (or not) arguments
-        intended_service_name = sr_command_parser.intendedServiceName();
-        request_uid = sr_command_parser.ruid();
-        command_data = sr_command_parser.commandData();
-    } catch (const Utils::NotEnoughWords& err) { // Catches error if SER command format is invalid
+    if (!sr_command_parser.hasExpectedWords()) // Checks for SER command format
         throw InvalidRequestFormat { service_request, "Expected SER command prefix and request service name" };
-    }
+
+    if (!sr_command_parser.isValidRequest()) // Checks for SER command prefix, must be REQUEST for a SR command
+        throw InvalidRequestFormat { service_request, "Expected SER command prefix \"REQUEST\" for SR command" };
+
+    const std::optional<std::uint64_t> parsed_ruid { sr_command_parser.ruid() };
+    if (!parsed_ruid.has_value()) // Checks for RUID to be an unsigned integer which fits in 64 bits
+        throw BadServiceRequest { "Request UID must be an unsigned integer of 64 bits" };
+
+    // Set given parameters to corresponding parsed arguments
+    const std::uint64_t request_uid { *parsed_ruid };
+    const std::string_view intended_service_name { sr_command_parser.intendedServiceName() };
+    const std::string_view command_data { sr_command_parser.commandData() };
 
     assert(!intended_service_name.empty()); // Service name must be initialized if try statement passed successfully
 
-    // Checks for intended service registration
-    if (!isRegistered(intended_service_name))
-        throw ServiceNotFound { intended_service_name };
+    if (sampled_request)
+        sampled_request->serviceName(intended_service_name);
 
-    Service& intended_service { running_services_.at(intended_service_name).get() };
+    // Checks for intended service registration, dispatch table is only searched once
+    Service* const found_service { findService(intended_service_name) };
+    if (!found_service)
+        throw ServiceNotFound { intended_service_name };
 
-    logger_.trace("SR command successfully parsed, handled by service: {}", intended_service_name);
+    Service& intended_service { *found_service };
 
-    // SRR beginning is always `RESPONSE <RUID>`
-    const std::string sr_response_prefix {
-        std::string { RESPONSE_PREFIX } + ' ' + std::to_string(request_uid) + ' '
-    };
+    RPT_LOG_TRACE(logger_, "SR command successfully parsed, handled by service: {}", intended_service_name);
 
     // Try to handle SR command, catching errors occurring inside handlers
     try {
+        const auto handling_begin { Utils::PipelineLatencies::Clock::now() };
+
         // Handles SR command and saves result
-        const Utils::HandlingResult command_result { intended_service.handleRequestCommand(actor, command_data) };
+        Utils::HandlingResult command_result;
+        { // Allocations done by service handler are attributed to services, not to SER protocol
+            const Utils::AllocationScope services_allocations { Utils::AllocationSubsystem::Services };
+
+            command_result = intended_service.handleRequestCommand(actor, command_data);
+        }
+
+        if (latencies || sampled_request) { // Clock isn't read again if handling isn't recorded
+            const auto handling_duration { Utils::PipelineLatencies::Clock::now() - handling_begin };
+
+            if (latencies)
+                latencies->recordService(intended_service_name, handling_duration);
+
+            if (sampled_request)
+                sampled_request->serviceHandling = handling_duration;
+        }
+
+        if (metrics) {
+            metrics->serviceRequestHandled(intended_service_name, command_result
+                    ? Utils::ServiceRequestResult::Ok
+                    : Utils::ServiceRequestResult::Ko);
+        }
 
         if (command_result) // If command was successfully handled, must retrieves OK Service Request Response
-            return sr_response_prefix + "OK";
+            return formatResponse(request_uid, {});
         else // Else, command failed and KO response must be retrieved
-            return sr_response_prefix + "KO " + command_result.errorMessage();
+            return formatResponse(request_uid, command_result.errorMessage());
     } catch (const std::exception& err) { // If exception is thrown by intended service
         logger_.error("Service \"{}\" failed to handle command: {}" , intended_service_name, err.what());
 
+        if (metrics)
+            metrics->serviceRequestHandled(intended_service_name, Utils::ServiceRequestResult::Error);
+
         // Retrieves error Service Request Response with given caught message `RESPONSE <RUID> KO <ERR_MSG>`
-        return sr_response_prefix + "KO " + err.what();
+        return formatResponse(request_uid, std::string_view { err.what() });
     }
 }
 
 std::optional<ServiceEvent> ServiceEventRequestProtocol::pollServiceEvent() {
+    const Utils::AllocationScope ser_allocations { Utils::AllocationSubsystem::Ser };
+
     // Will be set to Service which has the lowest ID if any of them emitted a an event
     Service* latest_event_emitter { nullptr };
+    // Context which logged that event, so it can be removed from log once polled
+    ServiceContext* latest_event_context { nullptr };
 
     std::size_t lowest_event_id;
-    for (auto registered_service : running_services_) {
-        Service& service { registered_service.second.get() };
-
-        const std::optional<std::size_t> next_event_id { service.checkEvent() };
+    for (ServiceContext* services_context : services_contexts_) {
+        const ServiceContext::EmittedEvent* next_event { nextPollableEvent(*services_context) };
 
-        if (next_event_id.has_value()) { // Skip service if has an empty events queue
-            logger_.trace("Service {} last event ID: {}", service.name(), *next_event_id);
+        if (next_event) { // Skip context if none of its events can be polled
+            RPT_LOG_TRACE(logger_, "Service {} last event ID: {}", next_event->emitter->name(), next_event->id);
 
             // If there isn't any event to poll or current was triggered first...
-            if (!latest_event_emitter || next_event_id < lowest_event_id) {
+            if (!latest_event_emitter || next_event->id < lowest_event_id) {
                 // ...then set new event emitter, and update lowest ID
-                latest_event_emitter = &service;
-                lowest_event_id = *next_event_id;
+                latest_event_emitter = next_event->emitter;
+                latest_event_context = services_context;
+                lowest_event_id = next_event->id;
             }
-        } else {
-            logger_.trace("Service {} hasn't any event.", service.name());
         }
     }
 
     if (latest_event_emitter) { // If there is any emitted event, format it and move it into polled event
-        const std::string service_name_copy { latest_event_emitter->name() }; // Required for concatenation
+        const std::string_view service_name { latest_event_emitter->name() };
         // Latest event is popped from queue to be polled as next event
-        const ServiceEvent next_event { latest_event_emitter->pollEvent() };
+        ServiceEvent next_event { latest_event_emitter->pollEvent() };
+        latest_event_context->popEmittedEvent();
+
+        RPT_LOG_TRACE(logger_, "Polled event from service {}: {}", service_name, next_event.data());
+
+        // SER command prefix `EVENT <SERVICE_NAME> ` formatted inside a single buffer
+        std::string event_prefix;
+        event_prefix.reserve(EVENT_PREFIX.size() + 1 + service_name.size() + 1);
 
-        logger_.trace("Polled event from service {}: {}", latest_event_emitter->name(), next_event.command());
+        event_prefix += EVENT_PREFIX;
+        event_prefix += ' ';
+        event_prefix += service_name;
+        event_prefix += ' ';
 
         // SE event data prefixed with SER command EVENT and Service name to format a full and valid SER command
-        return next_event.prefixWith(std::string { EVENT_PREFIX } + ' ' + service_name_copy + ' ');
+        return std::move(next_event).prefixWith(event_prefix);
     } else {
-        logger_.trace("No event to retrieve");
+        RPT_LOG_TRACE(logger_, "No event to retrieve");
 
         return {};
     }
 }
 
+void ServiceEventRequestProtocol::recycleEventsStorage() {
+    for (Service& service : running_services_)
+        service.recycleEventsStorage();
+}
+
+const std::vector<ServiceContext*>& ServiceEventRequestProtocol::servicesContexts() const {
+    return services_contexts_;
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include <RpT-Core/ServiceTask.hpp>
+
+
+namespace RpT::Core {
+
+
+ServiceTask::ServiceTask(std::packaged_task<void()> work, std::function<void()> completion)
+: work_ { std::move(work) }, work_done_ { work_.get_future() }, completion_ { std::move(completion) } {}
+
+void ServiceTask::run() {
+    work_(); // Exception, if any, is stored into shared state
+}
+
+void ServiceTask::complete() {
+    work_done_.get(); // Rethrows work exception, if any
+
+    completion_();
+}
+
+
+}
@@ -0,0 +1,70 @@
+#include <RpT-Core/TaskPool.hpp>
+
+#include <chrono>
+#include <stdexcept>
+
+
+namespace RpT::Core {
+
+
+/// Bounded waits on steady clock, condition being checked again after each period
+constexpr std::chrono::milliseconds TASK_WAIT_PERIOD { 100 };
+
+
+void TaskPool::workerThread() {
+    while (true) {
+        QueuedTask next_task;
+        {
+            std::unique_lock<std::mutex> queue_lock { queue_mutex_ };
+            const auto task_ready { [this]() { return stopping_ || !queued_tasks_.empty(); } };
+
+            while (!task_queued_.wait_for(queue_lock, TASK_WAIT_PERIOD, task_ready)) {}
+
+            if (stopping_)
+                return;
+
+            next_task = std::move(queued_tasks_.front());
+            queued_tasks_.pop_front();
+        }
+
+        next_task.task->run();
+        notifier_(next_task.token);
+    }
+}
+
+TaskPool::TaskPool(const std::size_t workers_count, CompletionNotifier notifier)
+: notifier_ { std::move(notifier) }, stopping_ { false } {
+    if (workers_count == 0)
+        throw std::invalid_argument { "At least 1 worker is required to run tasks" };
+
+    for (std::size_t worker { 0 }; worker < workers_count; worker++)
+        threads_.emplace_back([this]() { workerThread(); });
+}
+
+TaskPool::~TaskPool() {
+    {
+        const std::lock_guard<std::mutex> queue_lock { queue_mutex_ };
+        stopping_ = true;
+    }
+
+    task_queued_.notify_all();
+
+    for (std::thread& worker_thread : threads_)
+        worker_thread.join();
+}
+
+std::size_t TaskPool::workersCount() const {
+    return threads_.size();
+}
+
+void TaskPool::submit(const std::uint64_t token, std::shared_ptr<ServiceTask> task) {
+    {
+        const std::lock_guard<std::mutex> queue_lock { queue_mutex_ };
+        queued_tasks_.push_back({ token, std::move(task) });
+    }
+
+    task_queued_.notify_one();
+}
+
+
+}
@@ -11,8 +11,9 @@ void Timer::checkStateForOperation(const std::string_view operation_name) {
         throw BadTimerState { std::string { operation_name }, expected_state, current_state_ };
 }
 
-Timer::Timer(ServiceContext& token_provider, const std::size_t countdown_ms)
-: token_ { token_provider.newTimerCreated() }, countdown_ms_ { countdown_ms }, current_state_ { TimerState::Disabled } {}
+Timer::Timer(ServiceContext& token_provider, const std::size_t countdown_ms, const std::size_t slack_ms)
+: token_ { token_provider.newTimerCreated() }, countdown_ms_ { countdown_ms }, slack_ms_ { slack_ms },
+current_state_ { TimerState::Disabled }, token_provider_ { &token_provider } {}
 
 std::uint64_t Timer::token() const {
     return token_;
@@ -22,6 +23,10 @@ std::size_t Timer::countdown() const {
     return countdown_ms_;
 }
 
+std::size_t Timer::slack() const {
+    return slack_ms_;
+}
+
 bool Timer::isFree() const {
     return current_state_ == TimerState::Disabled;
 }
@@ -38,22 +43,21 @@ bool Timer::hasTriggered() const {
     return current_state_ == TimerState::Triggered;
 }
 
-void Timer::onNextClear(std::function<void()> callback) {
+void Timer::onNextClear(Utils::InlineCallback callback) {
     // Pushes routine at end of array
-    clear_callbacks_.push_back(std::move(callback));
+    clear_callbacks_.push(std::move(callback));
 }
 
-void Timer::onNextTrigger(std::function<void()> callback) {
+void Timer::onNextTrigger(Utils::InlineCallback callback) {
     // Pushes routine at end of array
-    trigger_callbacks_.push_back(std::move(callback));
+    trigger_callbacks_.push(std::move(callback));
 }
 
 void Timer::clear() {
     current_state_ = TimerState::Disabled;
 
-    // Disabled reached, calls every routine (or callbacks)...
-    for (const std::function<void()>& state_callback : clear_callbacks_)
-        state_callback();
+    // Disabled reached, calls every routine (or callbacks), unless context defers them...
+    token_provider_->timerCleared(clear_callbacks_);
     // ...then consumes all of them by cleaning their array
     clear_callbacks_.clear();
 
@@ -64,6 +68,8 @@ void Timer::clear() {
 void Timer::requestCountdown() {
     checkStateForOperation("requestCountdown");
     current_state_ = TimerState::Ready;
+
+    token_provider_->timerReady(*this); // Listed if watched, so countdown begins without watched timers being checked
 }
 
 std::size_t Timer::beginCountdown() {
@@ -77,11 +83,14 @@ void Timer::trigger() {
     checkStateForOperation("trigger");
     current_state_ = TimerState::Triggered;
 
-    // Disabled reached, calls every routine (or callbacks)...
-    for (const std::function<void()>& state_callback : trigger_callbacks_)
-        state_callback();
-    // ...then consumes all of them by cleaning their array
+    // Callbacks are moved out first, so one of them can clear timer and request its countdown again without newly
+    // registered callbacks being consumed...
+    TimerCallbacks triggered_callbacks { std::move(trigger_callbacks_) };
     trigger_callbacks_.clear();
+
+    // ...then Triggered reached, calls every routine (or callbacks)
+    for (std::size_t i { 0 }; i < triggered_callbacks.size(); i++)
+        triggered_callbacks[i]();
 }
 
 
@@ -1,16 +1,34 @@
 #ifndef RPTOGETHER_SERVER_BEASTWEBSOCKETBACKENDBASE_INL
 #define RPTOGETHER_SERVER_BEASTWEBSOCKETBACKENDBASE_INL
 
+#include <atomic>
 #include <chrono>
+#include <optional>
 #include <sstream>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <variant>
+#include <vector>
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/signal_set.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/beast.hpp>
 #include <RpT-Config/Config.hpp>
+#include <RpT-Network/BeastWebsocketBackendOptions.hpp>
+#include <RpT-Network/BinaryRptlCodec.hpp>
+#include <RpT-Network/MessagesBatch.hpp>
+#include <RpT-Network/MpscRing.hpp>
 #include <RpT-Network/NetworkBackend.hpp>
+#include <RpT-Network/OutgoingMessagesQueue.hpp>
+#include <RpT-Network/TimerWheel.hpp>
+#include <RpT-Utils/AllocationProfiler.hpp>
 #include <RpT-Utils/LoggerView.hpp>
+#include <RpT-Utils/ThreadAffinity.hpp>
 
 /**
  * @file BeastWebsocketBackendBase.inl
@@ -33,6 +51,11 @@ namespace RpT::Network {
  * As all IO operations complete asynchronously, any error result in WS stream to be closed next time `waitForEvent()
  * ` is called.
  *
+ * Each connection is running on its own strand. If IO threads are enabled, these strands are run by IO threads so
+ * TLS and Websocket framing costs are moved outside of Executor thread. In any case, backend state (clients registry,
+ * input events queue, logging) is only accessed from Executor thread: connections handlers forward their results to
+ * it using `dispatchToExecutor()`.
+ *
  * `BeastWebsocketBackendBase` subclass responsibility is to establish any valid Websocket stream using given
  * `TcpStream` as underlying stream from incoming established TCP connection (using TCP socket).
  *
@@ -46,12 +69,73 @@ protected: // Must be defined early so it can be used all along the class defini
     /// Top-level WS stream used to communicate with clients with RPTL protocol, depends on underlying `TcpStream`
     using WebsocketStream = boost::beast::websocket::stream<TcpStream>;
 
+    /// Websocket subprotocol a client offers during handshake to receive queued RPTL messages inside batch envelopes
+    static constexpr std::string_view BATCHING_SUBPROTOCOL { "rptl-batch" };
+    /// Websocket subprotocol a client offers during handshake to exchange RPTL messages encoded by `BinaryRptlCodec`
+    static constexpr std::string_view BINARY_SUBPROTOCOL { "rptl-binary" };
+    /// Websocket subprotocol a client offers during handshake to combine binary mode and batching
+    static constexpr std::string_view BINARY_BATCHING_SUBPROTOCOL { "rptl-binary-batch" };
+
+    /// Websocket features negotiated with a client during handshake
+    struct NegotiatedFeatures {
+        /// Client offered `BATCHING_SUBPROTOCOL`, queued RPTL messages are sent inside batch envelopes
+        bool batching { false };
+        /// Client offered permessage-deflate extension and server enabled it, messages are compressed
+        bool compression { false };
+        /// Client selected binary mode, messages are encoded by `BinaryRptlCodec` inside binary frames
+        bool binary { false };
+    };
+
 private:
-    /// Handles message sending result to given client token
+    /// Websocket stream connected with a client, with its own RPTL messages pipeline so clients are synced
+    /// independently
+    ///
+    /// Members are only accessed from stream executor, which is connection strand. Read buffer is the exception: it
+    /// is handed to Executor thread once a message is received, and given back when next message is listened.
+    struct ClientConnection {
+        WebsocketStream stream;
+        boost::beast::flat_buffer readBuffer;
+        OutgoingMessagesQueue remainingMessages;
+        bool sending;
+        bool batching;
+        bool compressing;
+        // Set before connection is registered, so it can also be read from Executor thread
+        bool binary;
+        bool closing;
+        // Queue overflowed and client is being killed, no more message is queued
+        bool evicted;
+        // RPTL messages or batches payload bytes sent, before any compression or framing
+        std::uint64_t sentBytes;
+    };
+
+    /// Read operation result handed from connection strand to Executor thread
+    struct ReceivedMessage {
+        std::uint64_t clientToken;
+        boost::system::error_code error;
+        std::shared_ptr<ClientConnection> connection;
+        // Read completion time point, so receive latency includes time waited before Executor thread handled it
+        std::chrono::steady_clock::time_point receivedAt;
+    };
+
+    /// Maximum number of read messages waiting for Executor thread before falling back on posted handlers
+    static constexpr std::size_t RECEIVED_MESSAGES_CAPACITY { 4096 };
+
+    /// Maximum length for HTTP upgrade request, Beast default headers limit
+    static constexpr std::size_t UPGRADE_REQUEST_MAX { 8 * 1024 };
+
+    /// Read buffer storage kept by an idle connection, larger storage left by a burst is released before next read
+    static constexpr std::size_t IDLE_READ_BUFFER_CAPACITY { 4 * 1024 };
+
+    /// Handles message sending result to given client token, called from connection strand
     class SentMessageHandler {
     private:
         BeastWebsocketBackendBase& protocol_instance_;
         const std::uint64_t client_token_;
+        const std::shared_ptr<ClientConnection> connection_;
+        // Sent data is owned by handler, so it is still valid until write operation completed
+        const std::variant<MessageBuffer, std::shared_ptr<const MessagesBatch>> sent_data_;
+        // Time point oldest sent message was queued at
+        const std::chrono::steady_clock::time_point queued_at_;
 
     public:
         /**
@@ -59,30 +143,57 @@ private:
          *
          * @param protocol_instance Instance which sent message to client
          * @param client_token Client who must receive instance message
+         * @param connection Connection used to send message
+         * @param sent_data RPTL message or messages batch which has been sent, kept alive until handler is destroyed
+         * @param queued_at Time point oldest sent message was queued at
          */
-        SentMessageHandler(BeastWebsocketBackendBase& protocol_instance, const std::uint64_t client_token)
-        : protocol_instance_ { protocol_instance }, client_token_ { client_token } {}
+        SentMessageHandler(BeastWebsocketBackendBase& protocol_instance, const std::uint64_t client_token,
+                           std::shared_ptr<ClientConnection> connection,
+                           std::variant<MessageBuffer, std::shared_ptr<const MessagesBatch>> sent_data,
+                           const std::chrono::steady_clock::time_point queued_at)
+        : protocol_instance_ { protocol_instance }, client_token_ { client_token },
+        connection_ { std::move(connection) }, sent_data_ { std::move(sent_data) }, queued_at_ { queued_at } {}
 
         /// Makes handler callable object
-        void operator()(const boost::system::error_code& err, std::size_t) {
-            // No matter if async_write succeeded or not, RPTL message should not be handled twice, so pop it from queue
-            protocol_instance_.merged_remaining_messages_.pop();
+        void operator()(const boost::system::error_code& err, const std::size_t sent_bytes) {
+            if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
+                return;
+
+            // Sent messages have already been popped from queue, so next messages can be sent
+            connection_->sending = false;
+            connection_->sentBytes += sent_bytes;
+
+            if (Utils::RuntimeMetrics* const metrics { protocol_instance_.metrics() })
+                metrics->bytesSent(sent_bytes);
 
             // Handles error with connection closure, as specified by RPTL protocol
             // An error for one RPTL message must NOT crash other client connections, so error is fatal for client only
-            if (err && err != boost::asio::error::operation_aborted) { // Ignores if server stopped
-                std::string error_message { err.message() }; // Retrieves Asio error code associated message
+            if (err) {
+                // Retrieved error message can be moved inside message sent handler result
+                protocol_instance_.dispatchToExecutor([&protocol_instance = protocol_instance_,
+                                                       client_token = client_token_,
+                                                       error_message { err.message() }]() mutable {
 
-                protocol_instance_.logger_.error("Unable to send message to client {}: {}", client_token_, error_message);
+                    if (!protocol_instance.isConnected(client_token)) // Client might have been closed meanwhile
+                        return;
 
-                // As RPTL protocol requires, connection if closed if any error occurred, using specific error message
-                // Retrieved error message can be moved inside message sent handler result
-                protocol_instance_.killClient(client_token_, Utils::HandlingResult { error_message });
+                    protocol_instance.logger_.error(
+                            "Unable to send message to client {}: {}", client_token, error_message);
+
+                    // As RPTL protocol requires, connection if closed if any error occurred, using specific error
+                    // message, but actor is kept if its session can be resumed
+                    protocol_instance.loseClient(client_token, Utils::HandlingResult { std::move(error_message) });
+                });
+
+                return; // Client will be closed, no need to send it remaining messages
             }
 
-            // If no error occurred, checks for messages queue and send next message recursively if any
-            if (!protocol_instance_.merged_remaining_messages_.empty())
-                protocol_instance_.sendRemainingMessages();
+            if (Utils::PipelineLatencies* const latencies { protocol_instance_.latencies() })
+                latencies->recordSince(Utils::PipelineStage::Write, queued_at_);
+
+            // If no error occurred, checks for this client messages queue and send next message recursively if any
+            if (!connection_->closing && !connection_->remainingMessages.empty())
+                protocol_instance_.sendRemainingMessages(client_token_, connection_);
         }
     };
 
@@ -114,10 +225,40 @@ private:
             if constexpr (std::is_same_v<Core::LeftEvent, SimplifiedInputEventT>) {
                 // As LeftEvent was triggered by logout command, we know no error occurred
                 protocol_instance_.killClient(sender_token_);
+            } else if constexpr (std::is_same_v<Core::JoinedEvent, SimplifiedInputEventT>) {
+                // Client logged in on time, destroyed deadline is cancelled
+                protocol_instance_.login_deadlines_.erase(sender_token_);
             }
         }
     };
 
+    /// Converts backend options into Beast extension settings, extension is only offered if deflate is enabled
+    static boost::beast::websocket::permessage_deflate makeDeflateOptions(const BeastWebsocketBackendOptions& options) {
+        boost::beast::websocket::permessage_deflate deflate_options;
+        deflate_options.server_enable = options.deflate;
+        deflate_options.server_max_window_bits = options.deflateWindowBits;
+        deflate_options.server_no_context_takeover = !options.deflateContextTakeover;
+        deflate_options.compLevel = options.deflateLevel;
+
+        return deflate_options;
+    }
+
+    /// Converts backend options into Beast Websocket timeouts, idle connections are pinged only if idle timeout is enabled
+    static boost::beast::websocket::stream_base::timeout makeWebsocketTimeouts(
+            const BeastWebsocketBackendOptions& options) {
+
+        const auto timeout_or_none { [](const std::chrono::milliseconds timeout) {
+            return timeout.count() > 0 ? timeout : boost::beast::websocket::stream_base::none();
+        } };
+
+        boost::beast::websocket::stream_base::timeout websocket_timeouts;
+        websocket_timeouts.handshake_timeout = timeout_or_none(options.websocketHandshakeTimeout);
+        websocket_timeouts.idle_timeout = timeout_or_none(options.idleTimeout);
+        websocket_timeouts.keep_alive_pings = options.idleTimeout.count() > 0;
+
+        return websocket_timeouts;
+    }
+
     static std::vector<int> getCaughtSignals() {
         std::vector<int> caught_signals { SIGTERM }; // SIGTERM is always caught and always exist
         caught_signals.reserve(3); // At least 3 caught Posix signals: SIGINT, SIGTERM and SIGHUP
@@ -133,147 +274,391 @@ private:
         return caught_signals;
     }
 
-    /// RPTL message with client destination token so it can be saved inside global protocol queue
-    struct QueuedMessage {
-        std::uint64_t client;
-        std::shared_ptr<std::string> rptlMessage;
-    };
-
     // Provides logging features
     Utils::LoggerView logger_;
-
-    // Provides running context for all async IO operations
+    // Permessage-deflate extension settings applied to each Websocket stream before handshake, read-only once built
+    const boost::beast::websocket::permessage_deflate deflate_options_;
+    // Watermarks for messages waiting to be sent to each client
+    const OutgoingQueueLimits outgoing_limits_;
+    // Maximum length for a message received from each client, read buffers being limited to it
+    const std::size_t max_message_size_;
+    // Time given to a client for sending HTTP upgrade request, 0 if unlimited
+    const std::chrono::milliseconds upgrade_timeout_;
+    // Websocket handshake, closure and idle connections timeouts applied to each stream before handshake
+    const boost::beast::websocket::stream_base::timeout websocket_timeouts_;
+    // Time given to a connected client for logging in, 0 if unlimited
+    const std::chrono::milliseconds login_timeout_;
+    // Congested and evicted clients counters, only accessed from Executor thread
+    BackpressureStats backpressure_stats_;
+
+    // Provides running context for Executor thread async operations: timers, signals and backend state handlers
     boost::asio::io_context async_io_context_;
-    // Websocket stream using given TCP stream for each client token
-    std::unordered_map<std::uint64_t, WebsocketStream> clients_stream_;
+    // Runs every timer countdown with a single Asio timer, from Executor thread
+    AsioTimerWheel timers_wheel_;
+    // Provides running context for connections strands when IO threads are enabled
+    boost::asio::io_context io_threads_context_;
+    // Keeps IO threads running while they are waiting for connections operations
+    std::optional<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> io_threads_work_;
+    // Threads running IO threads context, empty if connections are run by Executor thread
+    std::vector<std::thread> io_threads_;
+    // Messages read by connections strands, waiting to be handled by Executor thread
+    MpscRing<ReceivedMessage> received_messages_;
+    // Set once a drain of received messages has been posted to Executor thread, until that drain begins
+    std::atomic<bool> received_messages_drain_posted_;
+    // Websocket stream using given TCP stream and outgoing messages pipeline for each client token
+    std::unordered_map<std::uint64_t, std::shared_ptr<ClientConnection>> clients_stream_;
+    // Timer killing client if it is still unregistered once expired, for each client which hasn't logged in yet
+    std::unordered_map<std::uint64_t, boost::asio::steady_timer> login_deadlines_;
     // Posix signals handling to stop server
     boost::asio::signal_set stop_signals_handling_;
-    // Provides ready TCP connection to open WS stream from
-    boost::asio::ip::tcp::acceptor tcp_acceptor_;
+    // Provide ready TCP connections to open WS stream from, sharing local endpoint if there are many of them
+    std::vector<boost::asio::ip::tcp::acceptor> tcp_acceptors_;
     // Keep total clients count so an unique token can be given to each new client
     std::uint64_t tokens_count_;
-    // As only one async_write operation at once is allowed, every queue should be synced by merging them into one
-    // single queue
-    std::queue<QueuedMessage> merged_remaining_messages_;
+
+    /**
+     * @brief Opens acceptors listening on given local endpoint, using `SO_REUSEPORT` so kernel balances incoming
+     * connections between them if there are many
+     *
+     * With IO threads enabled, many acceptors run on their own strand so accepting is spread across IO threads.
+     *
+     * @param local_endpoint Endpoint clients will connect to
+     * @param acceptors_count Number of acceptors to open, falls back to 1 if `SO_REUSEPORT` isn't available
+     */
+    void openAcceptors(const boost::asio::ip::tcp::endpoint& local_endpoint, std::size_t acceptors_count) {
+#if RPT_RUNTIME_PLATFORM != RPT_RUNTIME_UNIX
+        if (acceptors_count > 1) { // SO_REUSEPORT only available for Unix runtime platform
+            logger_.warn("Many acceptors unavailable on this platform, using a single one.");
+            acceptors_count = 1;
+        }
+#endif
+
+        if (acceptors_count <= 1) { // Single acceptor is run by Executor thread, no socket option required
+            tcp_acceptors_.emplace_back(async_io_context_, local_endpoint);
+            return;
+        }
+
+        logger_.info("Accepting connections with {} acceptors.", acceptors_count);
+
+        // If port is chosen by system, every acceptor must be bound to the port given to first one
+        boost::asio::ip::tcp::endpoint shared_endpoint { local_endpoint };
+
+        tcp_acceptors_.reserve(acceptors_count);
+        for (std::size_t i { 0 }; i < acceptors_count; i++) {
+            boost::asio::ip::tcp::acceptor& acceptor { tcp_acceptors_.emplace_back(newConnectionStrand()) };
+
+            acceptor.open(shared_endpoint.protocol());
+            acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address { true });
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+            acceptor.set_option(boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> { true });
+#endif
+            acceptor.bind(shared_endpoint);
+            acceptor.listen();
+
+            shared_endpoint = acceptor.local_endpoint();
+        }
+    }
 
     /**
      * @brief Starts listening for incoming client TCP connection on local endpoint
      */
     void start() {
-        logger_.info("Open IO interface on local port {}.", tcp_acceptor_.local_endpoint().port());
+        logger_.info("Open IO interface on local port {}.", tcp_acceptors_.front().local_endpoint().port());
+
+        for (boost::asio::ip::tcp::acceptor& acceptor : tcp_acceptors_)
+            waitNextClient(acceptor);
+    }
+
+    /**
+     * @brief Retrieves a new strand for a connection to be running on
+     *
+     * @returns Strand from IO threads context if they are enabled, from Executor thread context otherwise
+     */
+    boost::asio::any_io_executor newConnectionStrand() {
+        if (io_threads_.empty())
+            return boost::asio::make_strand(async_io_context_);
+        else
+            return boost::asio::make_strand(io_threads_context_);
+    }
 
-        waitNextClient();
+    /**
+     * @brief Checks if given client stream is still inside registry, must be called from Executor thread
+     *
+     * @param client_token Token for client to check
+     *
+     * @returns If client stream hasn't been closed yet
+     */
+    bool isConnected(const std::uint64_t client_token) const {
+        return clients_stream_.count(client_token) == 1;
     }
 
     /**
      * @brief Sends next queued message for given client, async handler will recursively send next message when
      * operation will complete
      *
-     * @param client_token Token for queue to send messages from
-     * @param remaining_messages Pop-only queue for PRTL messages to send once next message have been sent successfully
+     * As only one async_write operation at once is allowed for each stream, every client has its own pipeline so a
+     * slow client cannot delay messages sent to other clients. If client negotiated batching, every queued message is
+     * sent with one gathered write into a single frame.
+     *
+     * Must be called from connection strand.
+     *
+     * @param client_token Token for client to send messages to
+     * @param connection Client connection containing queue for RPTL messages to send
      */
-    void sendRemainingMessages() {
-        // Shared_ptr for RPTL message is not popped from queue, so message data is still valid during async_write
-        const QueuedMessage message_owner { merged_remaining_messages_.front() };
-
-        if (clients_stream_.count(message_owner.client) == 1) { // If destination client is still connected, send msg
-            // Buffer read by Asio to send message, data must be valid until handler call finished, so const buffer data
-            // is owned by RPTL message shared pointer, alive until queued message is popped from queue
-            const boost::asio::const_buffer message_buffer {
-                    message_owner.rptlMessage->data(), message_owner.rptlMessage->size()
-            };
-
-            clients_stream_.at(message_owner.client).async_write(
-                    message_buffer, SentMessageHandler { *this, message_owner.client });
-        } else { // If client is disconnected, skip this message and go to next message if any
-            merged_remaining_messages_.pop(); // Skip this RPTL message
-
-            if (!merged_remaining_messages_.empty())
-                sendRemainingMessages();
+    void sendRemainingMessages(const std::uint64_t client_token, const std::shared_ptr<ClientConnection>& connection) {
+        connection->sending = true; // Next messages will be sent once these ones will have been sent
+
+        // Oldest message is about to be popped
+        const std::chrono::steady_clock::time_point queued_at { connection->remainingMessages.frontQueuedAt() };
+
+        if (connection->batching) { // Every pending message is sent at once inside a single frame
+            // Batch takes messages ownership, it must lives until handler is destroyed
+            std::queue<MessageBuffer> batched_messages { connection->remainingMessages.popAll() };
+            auto envelope { MessagesBatch::Envelope::Text };
+
+            if (connection->binary) { // Messages are shared with other clients, so encoded ones are copies
+                envelope = MessagesBatch::Envelope::Binary;
+
+                std::queue<MessageBuffer> encoded_messages;
+                while (!batched_messages.empty()) {
+                    encoded_messages.push(messagesPool().acquire(BinaryRptlCodec::encode(*batched_messages.front())));
+
+                    batched_messages.pop();
+                }
+
+                batched_messages.swap(encoded_messages);
+            }
+
+            const auto messages_batch { std::make_shared<MessagesBatch>(batched_messages, envelope) };
+
+            if (Utils::RuntimeMetrics* const runtime_metrics { metrics() })
+                runtime_metrics->queueDepth(client_token, 0);
+
+            connection->stream.async_write(
+                    messages_batch->buffers(),
+                    SentMessageHandler { *this, client_token, connection, messages_batch, queued_at });
+        } else {
+            // Message is owned by handler, it cannot be handled twice
+            MessageBuffer next_message { connection->remainingMessages.pop() };
+
+            if (Utils::RuntimeMetrics* const runtime_metrics { metrics() })
+                runtime_metrics->queueDepth(client_token, connection->remainingMessages.size());
+
+            if (connection->binary) // Message is shared with other clients, so encoded one is a copy
+                next_message = messagesPool().acquire(BinaryRptlCodec::encode(*next_message));
+
+            // Buffer read by Asio to send message, data must be valid until handler call finished, so const buffer
+            // data is owned by RPTL message buffer, alive until handler is destroyed
+            const boost::asio::const_buffer message_buffer { next_message->data(), next_message->size() };
+
+            connection->stream.async_write(
+                    message_buffer, SentMessageHandler {
+                        *this, client_token, connection, std::move(next_message), queued_at
+                    });
         }
     }
 
-    /// Accepts next incoming TCP client connection, then wait for next client again
-    void waitNextClient() {
-        logger_.trace("Waiting for new TCP connection...");
-
-        tcp_acceptor_.async_accept([this](
+    /**
+     * @brief Accepts next incoming TCP client connection with given acceptor, then wait for next client again
+     *
+     * Handler is called from acceptor executor, which is an IO thread strand if there are many acceptors.
+     *
+     * @param acceptor Acceptor to accept connection with
+     */
+    void waitNextClient(boost::asio::ip::tcp::acceptor& acceptor) {
+        // Accepted connection will be running on its own strand
+        acceptor.async_accept(newConnectionStrand(), [this, &acceptor](
                 const boost::system::error_code& err, boost::asio::ip::tcp::socket new_client_connection) {
 
             if (err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
                 return;
 
-            if (err) {
-                logger_.error("Unable to accept TCP from {}: {}", endpointFor(new_client_connection), err.message());
-            } else {
-                logger_.debug("Accepted TCP connection from {}", endpointFor(new_client_connection));
+            // Logging must be done by Executor thread, as acceptor might be run by an IO thread
+            dispatchToExecutor([this, remote_endpoint { endpointFor(new_client_connection) }, err]() {
+                if (err)
+                    logger_.error("Unable to accept TCP from {}: {}", remote_endpoint, err.message());
+                else
+                    logger_.debug("Accepted TCP connection from {}", remote_endpoint);
+            });
 
-                // Tries to asynchronously open WS stream with TCP connection established from new client
+            // Tries to asynchronously open WS stream with TCP connection established from new client
+            if (!err)
                 openWebsocketStream(std::move(new_client_connection));
-            }
 
-            waitNextClient(); // In any case, server must be waiting again for the next TCP connection
+            waitNextClient(acceptor); // In any case, server must be waiting again for the next TCP connection
+        });
+    }
+
+    /**
+     * @brief Starts countdown for given client to log in, killing it if it is still unregistered once countdown is done,
+     * must be called from Executor thread
+     *
+     * Countdown is cancelled when client logs in or its stream is closed. Client which resumed a session owns an actor
+     * without logging in, so it is kept once countdown is done.
+     *
+     * @param client_token Token for newly connected client
+     */
+    void waitForLogin(const std::uint64_t client_token) {
+        boost::asio::steady_timer& login_deadline {
+            login_deadlines_.try_emplace(client_token, async_io_context_, login_timeout_).first->second
+        };
+
+        login_deadline.async_wait([this, client_token](const boost::system::error_code& err) {
+            if (err == boost::asio::error::operation_aborted) // Client logged in or was closed meanwhile
+                return;
+
+            login_deadlines_.erase(client_token); // Timer isn't used anymore
+
+            if (!isAlive(client_token)) // Already killed, its stream will be closed anyways
+                return;
+
+            if (hasActor(client_token)) // Session resumed, no JoinedEvent cancelled countdown
+                return;
+
+            logger_.warn("Client {} didn't log in within {} ms, closing connection.",
+                         client_token, login_timeout_.count());
+
+            killClient(client_token, Utils::HandlingResult { "Login timeout" });
         });
     }
 
     /**
-     * @brief Receives and handles incoming message from given client
+     * @brief Receives incoming message from given client on its connection strand, then handles it from Executor
+     * thread
+     *
+     * Next message will be listened only once this one has been handled.
      *
      * @param client_token Token for client to be listening for
      */
     void listenMessageFrom(const std::uint64_t client_token) {
         logger_.trace("Listening next message from {}...", client_token);
 
-        // A new buffer has to be initialized for each received/sent message as multiple messages could be
-        // sent/received before handlers call
-        const auto read_buffer { std::make_shared<boost::beast::flat_buffer>() };
-        // Buffer should lives for both async_read and callback handler operations, so shared pointer is used
+        const std::shared_ptr<ClientConnection> connection { clients_stream_.at(client_token) };
 
-        clients_stream_.at(client_token).async_read(*read_buffer, [this, read_buffer, client_token](
-                const boost::system::error_code& err, const std::size_t) {
+        boost::asio::dispatch(connection->stream.get_executor(), [this, connection, client_token]() {
+            // Previous message has been handled, so its data can be dropped keeping buffer storage for this one
+            connection->readBuffer.clear();
+            // Unless a burst made it grow, as connection might then stay idle for long holding that storage
+            if (connection->readBuffer.capacity() > IDLE_READ_BUFFER_CAPACITY)
+                connection->readBuffer.shrink_to_fit();
+
+            // Connection owns buffer, so it lives for both async_read and callback handler operations
+            connection->stream.async_read(connection->readBuffer, [this, connection, client_token](
+                    const boost::system::error_code& err, const std::size_t) {
 
-            if (err) {
                 if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
                     return;
 
-                Utils::HandlingResult message_handling_result; // No error for now
-                if (err == boost::beast::websocket::error::closed) { // Client sent a close frame
-                    logger_.info("Websocket close frame from client {}", client_token);
-                } else { // Ignores if server stopped
-                    const std::string error_message { err.message() };
+                // No read is pending until message has been handled, buffer can be safely viewed from Executor thread
+                ReceivedMessage received_message {
+                    client_token, err, connection, std::chrono::steady_clock::now()
+                };
+
+                if (!received_messages_.tryPush(received_message)) { // Ring is full, falls back on a dedicated handler
+                    dispatchToExecutor([this, connection, client_token, err,
+                                        received_at = received_message.receivedAt]() {
 
-                    logger_.error("Failed to receive message from client {}: {}", client_token, error_message);
-                    // Error occurred, sets correct message handling result with given error message
-                    message_handling_result = Utils::HandlingResult { error_message };
+                        handleReceivedMessage(client_token, err, *connection, received_at);
+                    });
+
+                    return;
                 }
 
-                // In any case, an error means that client must NOT be listened anymore
-                killClient(client_token, message_handling_result);
+                // A single drain for every message pushed until it begins, so Executor thread is woken up once
+                if (!received_messages_drain_posted_.exchange(true))
+                    dispatchToExecutor([this]() { drainReceivedMessages(); });
+            });
+        });
+    }
+
+    /**
+     * @brief Handles every message received inside ring, must be called from Executor thread
+     */
+    void drainReceivedMessages() {
+        // Messages pushed from now might not be polled by this drain, so next ones must post another drain. Exchanged
+        // so messages pushed before drain was posted are visible.
+        received_messages_drain_posted_.exchange(false);
+
+        std::optional<ReceivedMessage> received_message { received_messages_.tryPop() };
+        while (received_message.has_value()) {
+            handleReceivedMessage(received_message->clientToken, received_message->error,
+                                  *received_message->connection, received_message->receivedAt);
+
+            received_message = received_messages_.tryPop();
+        }
+    }
+
+    /**
+     * @brief Handles message received from given client then listens for next one, must be called from Executor
+     * thread
+     *
+     * @param client_token Token for client message was received from
+     * @param err Error returned by read operation
+     * @param connection Connection with read buffer containing received RPTL message, meaningless if an error
+     * occurred
+     * @param received_at Read operation completion time point
+     */
+    void handleReceivedMessage(const std::uint64_t client_token, const boost::system::error_code& err,
+                               const ClientConnection& connection,
+                               const std::chrono::steady_clock::time_point received_at) {
+
+        if (!isConnected(client_token)) // Client stream might have been closed while message was being read
+            return;
+
+        if (err) {
+            Utils::HandlingResult message_handling_result; // No error for now
+            if (err == boost::beast::websocket::error::closed) { // Client sent a close frame
+                logger_.info("Websocket close frame from client {}", client_token);
+            } else if (err == boost::beast::websocket::error::message_too_big) { // Payload was never buffered
+                logger_.warn("Client {} sent a message longer than {} bytes", client_token, max_message_size_);
+
+                message_handling_result = Utils::HandlingResult {
+                    "Message longer than " + std::to_string(max_message_size_) + " bytes"
+                };
+            } else {
+                const std::string error_message { err.message() };
+
+                logger_.error("Failed to receive message from client {}: {}", client_token, error_message);
+
+                // Connection was lost without client closing it, so actor is kept if its session can be resumed
+                loseClient(client_token, Utils::HandlingResult { error_message });
 
                 return;
             }
 
-            // Const readable for received message
-            const boost::asio::const_buffer readonly_buffer { read_buffer->cdata() };
+            // In any case, an error means that client must NOT be listened anymore
+            killClient(client_token, message_handling_result);
 
-            // Reinterpret generic void pointer to cstring with buffer-defined message length
-            std::string rptl_message { reinterpret_cast<const char*>(readonly_buffer.data()), readonly_buffer.size() };
+            return;
+        }
 
-            try {
-                Core::AnyInputEvent client_triggered_event { handleMessage(client_token, rptl_message) };
+        // Const readable for received message
+        const boost::asio::const_buffer readonly_buffer { connection.readBuffer.cdata() };
+        // Reinterpret generic void pointer to cstring with buffer-defined message length, no copy done
+        std::string_view rptl_message {
+            reinterpret_cast<const char*>(readonly_buffer.data()), readonly_buffer.size()
+        };
+
+        try {
+            std::string decoded_message; // Only used in binary mode, as text message must be rebuilt
+            if (connection.binary) {
+                decoded_message = BinaryRptlCodec::decode(rptl_message); // May throws if binary message ill-formed
+                rptl_message = decoded_message;
+            }
 
-                // Visits triggered event checking for type
-                boost::apply_visitor(TriggeredInputEventVisitor { *this, client_token }, client_triggered_event);
+            Core::AnyInputEvent client_triggered_event { handleMessage(client_token, rptl_message, received_at) };
 
-                pushInputEvent(std::move(client_triggered_event)); // Moves triggered event into queue
-                listenMessageFrom(client_token); // Then listens next message from current client
-            } catch (const std::exception& err) { // Any error in message handling results into client disconnection
-                logger_.error("During {} message handling: {}", client_token, err.what());
+            // Visits triggered event checking for type
+            std::visit(TriggeredInputEventVisitor { *this, client_token }, client_triggered_event);
 
-                // Client will be disconnect for thrown error reason
-                killClient(client_token, Utils::HandlingResult { err.what() });
-            }
-        });
+            pushInputEvent(std::move(client_triggered_event)); // Moves triggered event into queue
+            listenMessageFrom(client_token); // Then listens next message from current client
+        } catch (const std::exception& err) { // Any error in message handling results into client disconnection
+            logger_.error("During {} message handling: {}", client_token, err.what());
+
+            // Client will be disconnect for thrown error reason
+            killClient(client_token, Utils::HandlingResult { err.what() });
+        }
     }
 
     /**
@@ -291,32 +676,47 @@ private:
         // If any error occurred for disconnection to happen, then set error code with custom message, for close
         // frame and interrupt command message
         if (!disconnection_reason) {
-            const std::string& error_message { disconnection_reason.errorMessage() };
+            const std::string_view error_message { disconnection_reason.errorMessage() };
 
             websocket_close_reason.code = boost::beast::websocket::close_code::internal_error;
-            websocket_close_reason.reason = error_message;
+            websocket_close_reason.reason.assign(error_message.data(), error_message.size());
         }
 
         removeClient(client_token); // Once disconnection reason has been sent to client, it can be removed
+        login_deadlines_.erase(client_token); // Cancels countdown if client was closed before logging in
 
-        // Moves client stream entry as it will be closed and no more operation should be performed on
-        // Use of shared_ptr because stream must not be destroyed before Websocket closure was handled
-        const auto dead_client_stream {
-            std::make_shared<WebsocketStream>(std::move(clients_stream_.at(client_token)))
-        };
+        // Moves client connection entry as it will be closed and no more operation should be performed on
+        // Shared ownership because stream must not be destroyed before Websocket closure was handled
+        const std::shared_ptr<ClientConnection> dead_client { std::move(clients_stream_.at(client_token)) };
 
         const std::size_t removed_streams_count { clients_stream_.erase(client_token) };
         // Must be sure that exactly ony client stream and messages queue entry have been removed
         assert(removed_streams_count == 1);
 
-        // Does and handles Websocket closure for dead client
-        dead_client_stream->async_close(websocket_close_reason, [this, dead_client_stream, client_token](
-                const boost::system::error_code& err) {
+        boost::asio::dispatch(dead_client->stream.get_executor(), [this, dead_client, websocket_close_reason,
+                                                                  client_token]() {
+
+            dead_client->closing = true; // No more RPTL message will be sent to this client
+
+            dispatchToExecutor([this, client_token, sent_bytes { dead_client->sentBytes },
+                                compressing { dead_client->compressing }]() {
 
-            // If for any reason clean Websocket closure failed, TCP connection will be closed anyways, but a warning
-            // message must be logged
-            if (err)
-                logger_.warn("Unclean disconnection with client {}: {}", client_token, err.message());
+                logger_.debug("Sent {} payload bytes to client {}, compressed: {}.",
+                              sent_bytes, client_token, compressing);
+            });
+
+            // Does and handles Websocket closure for dead client
+            dead_client->stream.async_close(websocket_close_reason, [this, dead_client, client_token](
+                    const boost::system::error_code& err) {
+
+                // If for any reason clean Websocket closure failed, TCP connection will be closed anyways, but a
+                // warning message must be logged
+                if (err && err != boost::asio::error::operation_aborted) {
+                    dispatchToExecutor([this, client_token, error_message { err.message() }]() {
+                        logger_.warn("Unclean disconnection with client {}: {}", client_token, error_message);
+                    });
+                }
+            });
         });
     }
 
@@ -340,7 +740,23 @@ protected:
     }
 
     /**
-     * @brief Provides class logging features
+     * @brief Stops IO threads context and waits for every IO thread to be done
+     *
+     * Subclasses owning state used by connections handlers must call it from their destructor, as IO threads would
+     * otherwise still be running once that state has been destroyed.
+     */
+    void stopIoThreads() {
+        io_threads_work_.reset();
+        io_threads_context_.stop();
+
+        for (std::thread& io_thread : io_threads_) {
+            if (io_thread.joinable())
+                io_thread.join();
+        }
+    }
+
+    /**
+     * @brief Provides class logging features, must only be used from Executor thread
      *
      * @returns A copy for member logger view
      */
@@ -348,9 +764,126 @@ protected:
         return logger_;
     }
 
+    /**
+     * @brief Retrieves context run by Executor thread while it is waiting for events, so subclasses can handle their
+     * own async operations, like signals, from that thread
+     *
+     * @returns Context for async operations handled by Executor thread
+     */
+    boost::asio::io_context& executorContext() {
+        return async_io_context_;
+    }
+
+    /**
+     * @brief Runs given function from Executor thread, required for connections handlers to access backend state or
+     * logging features as they might be called from IO threads
+     *
+     * @tparam Function Callable object without arguments
+     *
+     * @param function Function to call next time Executor thread is waiting for events
+     */
+    template<typename Function>
+    void dispatchToExecutor(Function&& function) {
+        boost::asio::post(async_io_context_, std::forward<Function>(function));
+    }
+
+    /**
+     * @brief Reads HTTP upgrade request then accepts Websocket handshake, negotiating RPTL messages batching and binary
+     * mode from offered subprotocols, and permessage-deflate if enabled by backend options
+     *
+     * @tparam AcceptHandler Callable with `const boost::system::error_code&` and `const NegotiatedFeatures&` arguments
+     *
+     * @param new_client_stream Stream owner, with underlying layers ready to handshake Websocket
+     * @param handler Called when Websocket handshake finished
+     */
+    template<typename AcceptHandler>
+    void acceptWebsocket(const std::shared_ptr<WebsocketStream>& new_client_stream, AcceptHandler handler) {
+        namespace http = boost::beast::http;
+
+        // Both must be alive until upgrade request has been read, request body cannot grow buffer past headers limit
+        const auto request_buffer { std::make_shared<boost::beast::flat_buffer>(UPGRADE_REQUEST_MAX) };
+        const auto upgrade_request { std::make_shared<http::request<http::string_body>>() };
+
+        // Must be set before handshake so extension can be negotiated
+        new_client_stream->set_option(deflate_options_);
+
+        // Client which connected without sending upgrade request must not hold its connection forever
+        if (upgrade_timeout_.count() > 0)
+            boost::beast::get_lowest_layer(*new_client_stream).expires_after(upgrade_timeout_);
+        else
+            boost::beast::get_lowest_layer(*new_client_stream).expires_never();
+
+        http::async_read(new_client_stream->next_layer(), *request_buffer, *upgrade_request,
+                         [this, new_client_stream, request_buffer, upgrade_request, handler { std::move(handler) }](
+                                 const boost::system::error_code& err, const std::size_t) mutable {
+
+            if (err) { // Handshake cannot be done without upgrade request
+                handler(err, NegotiatedFeatures {});
+                return;
+            }
+
+            NegotiatedFeatures negotiated;
+            // Only one subprotocol can be selected, so first one known by server is selected as client preference
+            std::string_view selected_subprotocol;
+
+            // Checks every Websocket subprotocol offered by client
+            const http::token_list offered_subprotocols { (*upgrade_request)[http::field::sec_websocket_protocol] };
+            for (const boost::beast::string_view subprotocol : offered_subprotocols) {
+                const std::string_view subprotocol_name { subprotocol.data(), subprotocol.size() };
+
+                if (subprotocol_name == BATCHING_SUBPROTOCOL) {
+                    selected_subprotocol = BATCHING_SUBPROTOCOL;
+                    negotiated.batching = true;
+                } else if (subprotocol_name == BINARY_SUBPROTOCOL) {
+                    selected_subprotocol = BINARY_SUBPROTOCOL;
+                    negotiated.binary = true;
+                } else if (subprotocol_name == BINARY_BATCHING_SUBPROTOCOL) {
+                    selected_subprotocol = BINARY_BATCHING_SUBPROTOCOL;
+                    negotiated.batching = true;
+                    negotiated.binary = true;
+                }
+
+                if (!selected_subprotocol.empty())
+                    break;
+            }
+
+            // Beast negotiates extension by itself, offer is checked here only to know if messages will be compressed
+            negotiated.compression = deflate_options_.server_enable && http::ext_list {
+                (*upgrade_request)[http::field::sec_websocket_extensions]
+            }.exists("permessage-deflate");
+
+            if (!selected_subprotocol.empty()) { // Confirms subprotocol selection to client
+                new_client_stream->set_option(boost::beast::websocket::stream_base::decorator(
+                        [selected_subprotocol](boost::beast::websocket::response_type& response) {
+
+                    response.set(http::field::sec_websocket_protocol, boost::beast::string_view {
+                        selected_subprotocol.data(), selected_subprotocol.size()
+                    });
+                }));
+            }
+
+            // Messages are sent inside binary frames in binary mode
+            new_client_stream->binary(negotiated.binary);
+
+            // From now on, Websocket stream handles its own timeouts and sends pings if client is idle, which requires
+            // underlying TCP stream to not have any deadline
+            boost::beast::get_lowest_layer(*new_client_stream).expires_never();
+            new_client_stream->set_option(websocket_timeouts_);
+
+            new_client_stream->async_accept(*upgrade_request, [new_client_stream, upgrade_request, negotiated,
+                                                                handler { std::move(handler) }](
+                    const boost::system::error_code& err) mutable {
+
+                handler(err, negotiated);
+            });
+        });
+    }
+
     /**
      * @brief Must asynchronously open Websocket stream using `addClientStream()` from given established TCP connection
      *
+     * Given connection is running on its own strand, so its operations handlers might be called from IO threads.
+     *
      * @param new_client_connection TCP connection ready to handshake into upper protocols layer
      */
     virtual void openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) = 0;
@@ -358,65 +891,143 @@ protected:
 
     /**
      * @brief Inserts new client using server-defined token and given Websocket stream, should be called by
-     * `openWebsocketStream()` implementation
+     * `openWebsocketStream()` implementation from connection strand
      *
      * If any error occurres during client token insertion, stream will be closed
      *
      * @param new_client_connection Underlying TCP socket, required for debugging informations
      * @param new_client_stream Produced Websocket stream from TCP connection
+     * @param negotiated Features client negotiated during Websocket handshake
      */
-    void addClientStream(const boost::asio::ip::tcp::socket& new_client_connection, WebsocketStream new_client_stream) {
-        const std::string remote_endpoint { endpointFor(new_client_connection) };
+    void addClientStream(const boost::asio::ip::tcp::socket& new_client_connection, WebsocketStream new_client_stream,
+                         const NegotiatedFeatures& negotiated = {}) {
 
-        try {
-            const std::uint64_t new_client_token { tokens_count_++ };
+        // Retrieved from connection strand as socket must not be accessed from Executor thread
+        std::string remote_endpoint { endpointFor(new_client_connection) };
 
-            logger_.debug("New token for {}: {}", remote_endpoint, new_client_token);
+        // Frame headers announcing a longer message fail read before payload is received
+        new_client_stream.read_message_max(max_message_size_);
 
-            // Add token into connected clients NetworkBackend registry
-            addClient(new_client_token); // May throws if token insertion failed
-            // Move produced stream into clients stream registry
-            const auto insert_stream_result {
-                clients_stream_.insert({ new_client_token, std::move(new_client_stream) })
-            };
+        const auto new_connection {
+            std::make_shared<ClientConnection>(ClientConnection {
+                std::move(new_client_stream), boost::beast::flat_buffer { max_message_size_ },
+                OutgoingMessagesQueue { outgoing_limits_ }, false,
+                negotiated.batching, negotiated.compression, negotiated.binary, false, false, 0
+            })
+        };
 
-            // Checks if client stream and messages queue insertions has been done
-            assert(insert_stream_result.second);
+        // Clients registry is owned by Executor thread
+        dispatchToExecutor([this, new_connection, remote_endpoint { std::move(remote_endpoint) }]() {
+            try {
+                const std::uint64_t new_client_token { tokens_count_++ };
+
+                logger_.debug("New token for {}: {}{}{}{}", remote_endpoint, new_client_token,
+                              new_connection->batching ? " (batching)" : "",
+                              new_connection->compressing ? " (deflate)" : "",
+                              new_connection->binary ? " (binary)" : "");
+
+                // Add token into connected clients NetworkBackend registry
+                addClient(new_client_token); // May throws if token insertion failed
+                // Move produced stream into clients stream registry, with an empty messages pipeline
+                const auto insert_stream_result { clients_stream_.insert({ new_client_token, new_connection }) };
+
+                // Checks if client stream and messages queue insertions has been done
+                assert(insert_stream_result.second);
+
+                if (login_timeout_.count() > 0) // Client connection must not be kept if it never logs in
+                    waitForLogin(new_client_token);
+
+                listenMessageFrom(new_client_token); // Now client stream was added, it can be listened
+            } catch (const std::exception& err) { // Any token insertion error must result in stream closure
+                logger_.error("Unable to add client for {}: {}", remote_endpoint, err.what());
+
+                // Directly closes Websocket stream as client hasn't been added yet
+                boost::asio::dispatch(new_connection->stream.get_executor(), [this, new_connection, remote_endpoint]() {
+                    new_connection->stream.async_close(boost::beast::websocket::internal_error,
+                                                       [this, new_connection, remote_endpoint](
+                            const boost::system::error_code& closure_err) {
+
+                        if (closure_err == boost::asio::error::operation_aborted) // Ignores if server stopped
+                            return;
+
+                        dispatchToExecutor([this, remote_endpoint, closure_err]() {
+                            if (closure_err)
+                                logger_.error("Client {} websocket closure: {}",
+                                              remote_endpoint, closure_err.message());
+                            else
+                                logger_.debug("Client {} websocket closed prematurely: {}",
+                                              remote_endpoint, closure_err.message());
+                        });
+                    });
+                });
+            }
+        });
+    }
 
-            listenMessageFrom(new_client_token); // Now client stream was added, it can be listened
-        } catch (const std::exception& err) { // Any token insertion error must result in stream closure
-            logger_.error("Unable to add client for {}: {}", remote_endpoint, err.what());
+    /// Syncs client state with server state by sending recursively each flushed message to given client
+    void syncClient(const std::uint64_t client_token, MessagesQueueView client_messages_queue) final {
+        if (!client_messages_queue.hasNext()) // Nothing to send, connection strand doesn't have to be called
+            return;
+
+        // Each message is kept with its priority, as it is queued into connection pipeline by connection strand
+        std::vector<std::pair<MessageBuffer, MessagePriority>> flushed_messages;
+        while (client_messages_queue.hasNext()) {
+            const MessagePriority priority { client_messages_queue.nextPriority() };
+            flushed_messages.emplace_back(client_messages_queue.next(), priority);
+        }
 
-            // Directly closes Websocket stream as client hasn't been added yet
-            new_client_stream.async_close(boost::beast::websocket::internal_error,
-                                          [this, &remote_endpoint](const boost::system::error_code& closure_err) {
+        const std::shared_ptr<ClientConnection> connection { clients_stream_.at(client_token) };
 
-                if (closure_err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
-                    return;
+        // Messages pipeline is owned by connection strand
+        boost::asio::dispatch(connection->stream.get_executor(), [this, connection, client_token,
+                                                                 flushed_messages { std::move(flushed_messages) }]() {
 
-                if (closure_err)
-                    logger_.error("Client {} websocket closure: {}",
-                                  remote_endpoint, closure_err.message());
-                else
-                    logger_.debug("Client {} websocket closed prematurely: {}",
-                                  remote_endpoint, closure_err.message());
-            });
-        }
-    }
+            if (connection->closing || connection->evicted) // Closed connection will not send anything else
+                return;
 
-    /// Syncs client state with server state by sending recursively each flushed message to given client
-    void syncClient(const std::uint64_t client_token, MessagesQueueView client_messages_queue) final {
-        // If there is any message inside merged queue, then recursive async calls are still running
-        const bool sending_messages { !merged_remaining_messages_.empty() };
+            // Appends flushed messages to this client own pipeline, as long as client reads them fast enough
+            std::uint64_t dropped_messages { 0 };
+            for (const auto& [message, priority] : flushed_messages) {
+                const auto push_result { connection->remainingMessages.push(message, priority) };
 
-        // Merges this client queue with global queue, saving client token destination
-        while (client_messages_queue.hasNext())
-            merged_remaining_messages_.push({ client_token, client_messages_queue.next() });
+                if (push_result == OutgoingMessagesQueue::PushResult::Dropped) { // Congested client doesn't receive it
+                    dropped_messages++;
+                } else if (push_result == OutgoingMessagesQueue::PushResult::Congested) {
+                    dispatchToExecutor([this, client_token]() {
+                        backpressure_stats_.congestions++;
 
-        // Initiates recursive calls if no recursive async calls are already sending RPTL messages inside queue and
-        // there is new messages to send
-        if (!sending_messages && !merged_remaining_messages_.empty())
-            sendRemainingMessages();
+                        logger_.debug("Client {} is congested.", client_token);
+                    });
+                } else if (push_result == OutgoingMessagesQueue::PushResult::Overflowed) {
+                    connection->evicted = true; // Queued messages are still sent until connection is closed
+
+                    dispatchToExecutor([this, client_token]() {
+                        if (!isConnected(client_token)) // Client stream might have been closed meanwhile
+                            return;
+
+                        backpressure_stats_.evictions++;
+
+                        logger_.warn("Client {} outgoing queue overflowed, evicting it.", client_token);
+                        killClient(client_token, Utils::HandlingResult { "Too slow to receive messages" });
+                    });
+
+                    break; // Client will be closed, following messages are dropped
+                }
+            }
+
+            if (dropped_messages > 0) {
+                dispatchToExecutor([this, dropped_messages]() {
+                    backpressure_stats_.droppedMessages += dropped_messages;
+                });
+            }
+
+            // Initiates recursive calls if no recursive async calls are already sending RPTL messages inside client
+            // queue
+            if (!connection->sending)
+                sendRemainingMessages(client_token, connection);
+            else if (Utils::RuntimeMetrics* const runtime_metrics { metrics() }) // Waiting for pending write
+                runtime_metrics->queueDepth(client_token, connection->remainingMessages.size());
+        });
     }
 
     /**
@@ -425,22 +1036,12 @@ protected:
     void waitForEvent() final {
         // As interaction with clients might occurres, they must be synced with server and game state
         synchronize();
+        // If busy-poll is enabled, blocking wait is avoided for an input event occurring shortly after
+        spinForEvent();
 
         while (!inputReady()) { // While input events queue is empty
-            std::vector<std::uint64_t> dead_clients;
-            // Max count of dead clients is count of actual clients
-            dead_clients.reserve(clients_stream_.size());
-
-            // Checks for all dead clients
-            for (const auto& client : clients_stream_) {
-                const std::uint64_t token { client.first }; // Retrieves token for current entry
-
-                if (!isAlive(token)) // If connection is dead, it must be closed
-                    dead_clients.push_back(token);
-            }
-
-            // As clients_stream_ elements must not be erased during iteration, closeStream() calls are deferred
-            for (const std::uint64_t dead_client_token : dead_clients)
+            // Only clients killed since previous iteration must be closed
+            for (const std::uint64_t dead_client_token : pollKilledClients())
                 closeStream(dead_client_token);
 
             // Wait for next asynchronous IO operation handler, it may triggers an input event
@@ -448,6 +1049,19 @@ protected:
         }
     }
 
+    /// Closes killed clients streams, then runs every ready asynchronous IO operation handler
+    void pollReadyEvents() final {
+        for (const std::uint64_t dead_client_token : pollKilledClients())
+            closeStream(dead_client_token);
+
+        async_io_context_.poll();
+    }
+
+    /// Posts completed tasks pushing into Executor thread events loop, interrupting its wait
+    void wakeForCompletedTasks() final {
+        dispatchToExecutor([this]() { pushCompletedTasks(); });
+    }
+
 public:
     /**
      * @brief Constructs IO interface listening for new TCP connections on given local endpoint
@@ -457,14 +1071,27 @@ public:
      *
      * @param local_endpoint Endpoint clients will connect to
      * @param logging_context Context for WS backend logging features
+     * @param options Tuning options for connections handling and accepting
      * @param players_limit Maximum number of actors registered simultaneously
      */
     explicit BeastWebsocketBackendBase(const boost::asio::ip::tcp::endpoint& local_endpoint,
-                                       Utils::LoggingContext& logging_context, const std::size_t players_limit = 2)
+                                       Utils::LoggingContext& logging_context,
+                                       const BeastWebsocketBackendOptions& options = {},
+                                       const std::size_t players_limit = 2)
     : NetworkBackend { players_limit },
     logger_ { "WS-Backend", logging_context },
+    deflate_options_ { makeDeflateOptions(options) },
+    outgoing_limits_ { options.outgoingLimits },
+    max_message_size_ { options.maxMessageSize },
+    upgrade_timeout_ { options.websocketHandshakeTimeout },
+    websocket_timeouts_ { makeWebsocketTimeouts(options) },
+    login_timeout_ { options.loginTimeout },
+    timers_wheel_ { async_io_context_, [this](const std::uint64_t token) {
+        pushInputEvent(Core::TimerEvent { 0, token }); // Actor UID doesn't matter, timer token does
+    } },
+    received_messages_ { RECEIVED_MESSAGES_CAPACITY },
+    received_messages_drain_posted_ { false },
     stop_signals_handling_ { async_io_context_ },
-    tcp_acceptor_ { async_io_context_, local_endpoint },
     tokens_count_ { 0 } {
         Utils::LoggerView logger { getLogger() }; // Avoid to create LoggerView for each added signal
 
@@ -488,40 +1115,93 @@ public:
             }
         });
 
+        if (options.deflate)
+            logger.info("Offering permessage-deflate compression at level {}.", options.deflateLevel);
+
+        logger.debug("Timeouts: {} ms for Websocket handshake, {} ms for login, {} ms idle (0 if disabled).",
+                     options.websocketHandshakeTimeout.count(), options.loginTimeout.count(),
+                     options.idleTimeout.count());
+
+        if (options.ioThreads > 0) { // Connections are run by Executor thread otherwise
+            logger.info("Running connections on {} IO threads.", options.ioThreads);
+
+            // IO threads must be kept running even if there isn't any connection
+            io_threads_work_.emplace(boost::asio::make_work_guard(io_threads_context_));
+
+            io_threads_.reserve(options.ioThreads);
+            for (std::size_t i { 0 }; i < options.ioThreads; i++) {
+                io_threads_.emplace_back([this]() {
+                    // Every connection handler run here belongs to network backend
+                    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
+
+                    // Connections handlers aren't expected to throw, but if one does it must not terminate server
+                    while (!io_threads_context_.stopped()) {
+                        try {
+                            io_threads_context_.run();
+                        } catch (const std::exception& err) {
+                            dispatchToExecutor([this, error_message { std::string { err.what() } }]() {
+                                logger_.error("Unhandled error inside IO thread: {}", error_message);
+                            });
+                        }
+                    }
+                });
+            }
+
+            if (!options.ioThreadsCpus.empty()) {
+                try {
+                    for (std::size_t i { 0 }; i < io_threads_.size(); i++)
+                        Utils::pinThread(io_threads_[i], options.ioThreadsCpus[i % options.ioThreadsCpus.size()]);
+                } catch (const std::system_error&) { // Destructor isn't called, running IO threads must be joined
+                    stopIoThreads();
+
+                    throw;
+                }
+
+                logger.info("IO threads pinned to {} CPU cores.", options.ioThreadsCpus.size());
+            }
+        }
+
+        // Acceptors might be run by IO threads, so they can only be opened once these threads are known
+        openAcceptors(local_endpoint, options.acceptors);
+
         start(); // Required to start because there is no way to use polymorphism on template class
     }
 
     /**
-     * @brief Set Ready timer state to Pending, then uses an Asio steady clock to asynchronously wait for timer
-     * countdown to be done
+     * @brief Retrieves port acceptors are bound to, useful if it was chosen by system
+     *
+     * @returns Local port for incoming connections
      */
-    void beginTimer(Core::Timer& ready_timer) final {
-        // Retrieves token for timer which will be pending
-        const std::uint64_t token { ready_timer.token() };
-        // Retrieves duration to wait asynchronously and set state to Pending, into std::chrono compatible type
-        const std::chrono::milliseconds countdown { ready_timer.beginCountdown() };
-
-        // Must NOT on the stack as timer will be pending asynchronously, owning shared with Asio timer async handler
-        const auto asio_timer { std::make_shared<boost::asio::steady_timer>(async_io_context_, countdown) };
+    std::uint16_t localPort() const {
+        return tcp_acceptors_.front().local_endpoint().port();
+    }
 
-        // If RpT timer is cancelled (clear()), then this Boost.Asio steady_timer must also be cancelled
-        ready_timer.onNextClear([asio_timer]() {
-            asio_timer->cancel();
-        });
+    /**
+     * @brief Retrieves how many times clients outgoing queues reached their watermarks, must be called from Executor
+     * thread
+     *
+     * @returns Backpressure counters since backend was constructed
+     */
+    const BackpressureStats& backpressureStats() const {
+        return backpressure_stats_;
+    }
 
-        // Does timer countdown
-        asio_timer->async_wait([this, token, asio_timer](const boost::system::error_code& err) {
-            if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
-                return;
+    /// Waits for IO threads to be done, if any
+    ~BeastWebsocketBackendBase() override {
+        stopIoThreads();
+    }
 
-            if (err) { // Does not trigger timer if error occurred while it was pending
-                logger_.error("Pending timer {} countdown: {}", token, err.message());
-                return;
-            }
+    /// Running IO threads are accessing instance state
+    BeastWebsocketBackendBase(const BeastWebsocketBackendBase&) = delete;
+    /// Running IO threads are accessing instance state
+    BeastWebsocketBackendBase& operator=(const BeastWebsocketBackendBase&) = delete;
 
-            // Actor UID doesn't matter, timer token does
-            pushInputEvent(Core::TimerEvent { 0, token });
-        });
+    /**
+     * @brief Set Ready timer state to Pending, then schedules its countdown inside timers wheel, driven by a single
+     * Asio steady timer
+     */
+    void beginTimer(Core::Timer& ready_timer) final {
+        timers_wheel_.beginTimer(ready_timer);
     }
 
     /**
@@ -533,19 +1213,18 @@ public:
         // One token for each client
         client_tokens.reserve(clients_stream_.size());
 
-        // Each client must be disocnnected
-        for (const auto& client : clients_stream_) {
-            const std::uint64_t token { client.first }; // Retrieves token for current entry
+        // As clients_stream_ elements must not be erased during iteration, killClient() calls are deferred
+        for (const auto& client : clients_stream_)
+            client_tokens.push_back(client.first);
 
-            client_tokens.push_back(token);
-            // Client must be unregistered before being removed
+        // Each client must be disconnected
+        for (const std::uint64_t token : client_tokens)
             killClient(token); // No error, server closed
-        }
 
         synchronize(); // Sends interrupt messages to clients before disconnection
 
-        // As clients_stream_ elements must not be erased during iteration, closeStream() calls are deferred
-        for (const std::uint64_t dead_client_token : client_tokens)
+        // Now every client is dead, including ones which were already killed before and not closed yet
+        for (const std::uint64_t dead_client_token : pollKilledClients())
             closeStream(dead_client_token);
 
         // A null event must be pushed so waitForEvent() can properly return
@@ -555,6 +1234,7 @@ public:
         // As all players will be disconnected, don't care about syncing server state with LOGGED_OUT broadcast message
         // Handlers execution can be stopped right now
         async_io_context_.stop();
+        stopIoThreads();
 
         // Then IO interface can be considered closed
         InputOutputInterface::close();
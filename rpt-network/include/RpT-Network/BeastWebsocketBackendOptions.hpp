@@ -0,0 +1,65 @@
+#ifndef RPT_MINIGAMES_SERVER_BEASTWEBSOCKETBACKENDOPTIONS_HPP
+#define RPT_MINIGAMES_SERVER_BEASTWEBSOCKETBACKENDOPTIONS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+#include <RpT-Network/OutgoingMessagesQueue.hpp>
+
+/**
+ * @file BeastWebsocketBackendOptions.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Tuning options for `BeastWebsocketBackendBase` implementations, default values keep every connection
+ * handled by Executor thread
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct BeastWebsocketBackendOptions {
+    /// Number of threads running connections IO operations (TLS, Websocket framing), `0` to run them on Executor thread
+    std::size_t ioThreads { 0 };
+    /// CPU cores IO threads are pinned to, in order and cycling if there are less cores than threads, empty to leave
+    /// placement to scheduler. As connections state is allocated by IO threads, it stays on their cores NUMA nodes.
+    std::vector<std::size_t> ioThreadsCpus {};
+    /// Number of acceptors listening on local endpoint with `SO_REUSEPORT`, each one on its own IO threads strand
+    std::size_t acceptors { 1 };
+    /// Watermarks for RPTL messages waiting to be sent to each client, a client exceeding high watermark is evicted
+    OutgoingQueueLimits outgoingLimits {};
+    /// Maximum length for a received RPTL message, a client announcing a longer Websocket message is disconnected before
+    /// its payload is read, so connection read buffer never grows past it
+    std::size_t maxMessageSize { 64 * 1024 };
+    /// Offers permessage-deflate extension to clients during Websocket handshake
+    bool deflate { false };
+    /// Keeps compression context between messages, disabling it saves memory per connection but compresses worse
+    bool deflateContextTakeover { true };
+    /// Deflate compression level from `0` to `9`
+    int deflateLevel { 8 };
+    /// Maximum LZ77 window size, as a power of 2 from `9` to `15`
+    int deflateWindowBits { 15 };
+    /// Maximum number of TLS sessions cached by server for resumption, `0` disables cache, only used by WSS backend
+    std::size_t tlsSessionCacheSize { 1024 };
+    /// Issues TLS session tickets so clients can resume sessions without server-side state, only used by WSS backend
+    bool tlsTickets { true };
+    /// Time after which a new key encrypts TLS session tickets, only used by WSS backend
+    std::chrono::seconds tlsTicketKeyRotation { std::chrono::hours { 1 } };
+    /// Maximum duration for a client to complete TLS handshake, `0` disables it, only used by WSS backend
+    std::chrono::milliseconds tlsHandshakeTimeout { std::chrono::seconds { 10 } };
+    /// Maximum duration for a client to send HTTP upgrade request then complete Websocket handshake, `0` disables it
+    std::chrono::milliseconds websocketHandshakeTimeout { std::chrono::seconds { 10 } };
+    /// Maximum duration for a connected client to log in with RPTL handshake, `0` disables it
+    std::chrono::milliseconds loginTimeout { std::chrono::seconds { 20 } };
+    /// Maximum duration without any data received from a connected client, a ping is sent halfway so a live client
+    /// always answers in time, `0` disables it
+    std::chrono::milliseconds idleTimeout { std::chrono::seconds { 60 } };
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_BEASTWEBSOCKETBACKENDOPTIONS_HPP
@@ -0,0 +1,110 @@
+#ifndef RPT_MINIGAMES_SERVER_BINARYRPTLCODEC_HPP
+#define RPT_MINIGAMES_SERVER_BINARYRPTLCODEC_HPP
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * @file BinaryRptlCodec.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Thrown by `BinaryRptlCodec::decode()` if binary message is ill-formed
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class BadBinaryMessage : public std::logic_error {
+public:
+    /**
+     * @brief Constructs exception with custom error message
+     *
+     * @param reason Why binary message couldn't be decoded
+     */
+    explicit BadBinaryMessage(const std::string& reason) : std::logic_error { "Binary RPTL: " + reason } {}
+};
+
+
+/**
+ * @brief Compact binary encoding for RPTL and SER messages, sent by clients which negotiated binary mode
+ *
+ * A text message is made of words separated by a single space. Each word is encoded as a token beginning with a tag
+ * byte:
+ * - `0x00` followed by an unsigned LEB128 varint length then word bytes, for any word
+ * - `0x01` followed by an unsigned LEB128 varint, for canonical decimal numbers fitting in 64 bits
+ * - `0x40 | n`, for canonical decimal number `n` from 0 to 63
+ * - `0x80 | i`, for protocol keyword at index `i` inside `KEYWORDS`
+ *
+ * Encoding is lossless: decoded message is exactly the encoded text message, including consecutive spaces which are
+ * encoded as empty words. An empty binary message decodes into an empty text message.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class BinaryRptlCodec {
+public:
+    /// RPTL and SER protocol words encoded as a single byte, index must never change as it is part of binary format
+    static constexpr std::array<std::string_view, 14> KEYWORDS {
+        "SERVICE", "LOGIN", "LOGOUT", "CHECKOUT", "AVAILABILITY", "REGISTRATION", "INTERRUPT", "LOGGED_IN",
+        "LOGGED_OUT", "REQUEST", "RESPONSE", "EVENT", "OK", "KO"
+    };
+
+    static constexpr std::uint8_t STRING_TAG { 0x00 };
+    static constexpr std::uint8_t NUMBER_TAG { 0x01 };
+    static constexpr std::uint8_t SMALL_NUMBER_TAG { 0x40 };
+    static constexpr std::uint8_t KEYWORD_TAG { 0x80 };
+
+    /// Greatest number encoded with a single tag byte
+    static constexpr std::uint64_t MAX_SMALL_NUMBER { 0x3F };
+
+    /**
+     * @brief Appends given value as an unsigned LEB128 varint
+     *
+     * @param output String to append varint to
+     * @param value Value to encode
+     */
+    static void appendVarint(std::string& output, std::uint64_t value);
+
+    /**
+     * @brief Reads an unsigned LEB128 varint from given position, moving position after it
+     *
+     * @param input Data to read varint from
+     * @param position Varint beginning, set to varint end once read
+     *
+     * @returns Decoded value
+     *
+     * @throws BadBinaryMessage if varint is truncated or doesn't fit into 64 bits
+     */
+    static std::uint64_t readVarint(std::string_view input, std::size_t& position);
+
+    /**
+     * @brief Encodes given text message into binary format
+     *
+     * @param text_message RPTL text message
+     *
+     * @returns Binary message
+     */
+    static std::string encode(std::string_view text_message);
+
+    /**
+     * @brief Decodes given binary message into text format
+     *
+     * @param binary_message Binary message received from client
+     *
+     * @returns RPTL text message
+     *
+     * @throws BadBinaryMessage if binary message is ill-formed
+     */
+    static std::string decode(std::string_view binary_message);
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_BINARYRPTLCODEC_HPP
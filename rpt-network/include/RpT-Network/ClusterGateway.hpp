@@ -0,0 +1,200 @@
+#ifndef RPT_MINIGAMES_SERVER_CLUSTERGATEWAY_HPP
+#define RPT_MINIGAMES_SERVER_CLUSTERGATEWAY_HPP
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/signal_set.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+/**
+ * @file ClusterGateway.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Routes clients connections to backend nodes running `RawTcpBackend`, so rooms are hosted by several servers
+ * without clients knowing cluster topology
+ *
+ * Clients speak the same length-prefixed RPTL framing as with `RawTcpBackend`. Gateway waits for first frame of each
+ * client to choose its node: a `LOGIN` for an actor name already placed goes to same node, so a reconnecting actor
+ * finds its room back, a `RESUME` goes to node which received latest `LOGIN` for that actor UID, as only this node
+ * holds its detached session, and any other client goes to least loaded node. Node load is number of clients gateway is
+ * currently routing to it, which is exact as long as every client connects through gateway. Once node is chosen,
+ * gateway opens a TCP connection to it and relays bytes in both directions without parsing them again, so each
+ * actor traffic, `SERVICE` commands included, is always handled by node hosting its room.
+ *
+ * Placements are remembered for at most `MAX_PLACEMENTS` actor names and as many actor UIDs, oldest ones being
+ * forgotten first. Only first frame is parsed, so client which sends `LOGIN` after another command isn't placed.
+ *
+ * Every connection is run by thread calling `run()`.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class ClusterGateway {
+public:
+    /// Number of actor names which placement is remembered
+    static constexpr std::size_t MAX_PLACEMENTS { 64 * 1024 };
+    /// Size for each relayed bytes chunk
+    static constexpr std::size_t RELAY_BUFFER_SIZE { 16 * 1024 };
+
+private:
+    /// Client connection and its connection to node it is routed to
+    struct RoutedClient {
+        boost::asio::ip::tcp::socket client;
+        boost::asio::ip::tcp::socket node;
+        // Bytes received before node was chosen, first frame included
+        std::vector<char> firstBytes;
+        std::array<char, RELAY_BUFFER_SIZE> toNode;
+        std::array<char, RELAY_BUFFER_SIZE> toClient;
+        // Node index, uninitialized until first frame has been received
+        std::optional<std::size_t> routedNode;
+        bool closed;
+    };
+
+    // Provides logging features
+    Utils::LoggerView logger_;
+    const std::vector<boost::asio::ip::tcp::endpoint> nodes_;
+    // Longer first frames result into client disconnection
+    const std::size_t max_message_size_;
+    // Clients currently routed to each node
+    std::vector<std::size_t> nodes_load_;
+    // Node for each placed actor name
+    std::unordered_map<std::string, std::size_t> placements_;
+    // Placed actor names, oldest first
+    std::deque<std::string> placements_order_;
+    // Node for each logged in actor UID, which holds its session
+    std::unordered_map<std::uint64_t, std::size_t> session_placements_;
+    // Placed actor UIDs, oldest first
+    std::deque<std::uint64_t> session_placements_order_;
+    // Runs every connection and relay operation
+    boost::asio::io_context async_io_context_;
+    // Posix signals handling to stop gateway
+    boost::asio::signal_set stop_signals_handling_;
+    // Provides incoming client connections
+    boost::asio::ip::tcp::acceptor tcp_acceptor_;
+
+    /// Accepts next incoming TCP connection, then waits for next connection again
+    void waitNextClient();
+
+    /// Reads bytes from client until its first frame is complete, then routes it
+    void readFirstFrame(const std::shared_ptr<RoutedClient>& routed_client);
+
+    /**
+     * @brief Chooses node for given first RPTL message
+     *
+     * @param first_message First message received from client
+     *
+     * @returns Node placed actor name is hosted by if message is a `LOGIN`, node which logged actor in if message is a
+     * `RESUME`, least loaded node otherwise
+     */
+    std::size_t chooseNode(std::string_view first_message);
+
+    /// Retrieves index of node with fewest routed clients, first one if several nodes are equally loaded
+    std::size_t leastLoadedNode() const;
+
+    /// Remembers given node for given actor name, forgetting oldest placement if there are too many of them
+    void place(std::string_view actor_name, std::size_t node);
+
+    /// Remembers given node for given actor UID session, forgetting oldest placement if there are too many of them
+    void placeSession(std::uint64_t actor_uid, std::size_t node);
+
+    /// Connects to node given client is routed to, then forwards its first bytes and relays both directions
+    void connectNode(const std::shared_ptr<RoutedClient>& routed_client);
+
+    /// Reads next bytes from given source socket and writes them into given destination socket, then relays again
+    void relay(const std::shared_ptr<RoutedClient>& routed_client, boost::asio::ip::tcp::socket& source,
+               boost::asio::ip::tcp::socket& destination, std::array<char, RELAY_BUFFER_SIZE>& buffer);
+
+    /// Closes both client and node connections, if it hasn't been done already, then unloads its node
+    void closeClient(RoutedClient& routed_client);
+
+public:
+    /**
+     * @brief Constructs gateway listening for new TCP connections on given local endpoint
+     *
+     * In addition to that, constructor will initialize an Asio signal set listening for `SIGINT` and `SIGTERM` to
+     * stop gateway when required.
+     *
+     * @param local_endpoint Endpoint clients will connect to
+     * @param nodes Endpoints for nodes running `RawTcpBackend`
+     * @param logging_context Context for gateway logging features
+     * @param max_message_size Maximum length for first RPTL message received from a client
+     *
+     * @throws std::invalid_argument if no node is given
+     */
+    ClusterGateway(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                   std::vector<boost::asio::ip::tcp::endpoint> nodes, Utils::LoggingContext& logging_context,
+                   std::size_t max_message_size = 64 * 1024);
+
+    /*
+     * Entity class semantic
+     */
+
+    ClusterGateway(const ClusterGateway&) = delete;
+    ClusterGateway& operator=(const ClusterGateway&) = delete;
+
+    /**
+     * @brief Retrieves port acceptor is listening on, useful if it was chosen by system
+     *
+     * @returns Local port for incoming connections
+     */
+    std::uint16_t localPort() const;
+
+    /**
+     * @brief Routes clients until gateway is stopped, blocking calling thread
+     */
+    void run();
+
+    /**
+     * @brief Stops routing clients, can be called from any thread
+     */
+    void stop();
+
+    /**
+     * @brief Retrieves number of clients currently routed to given node, must not be called while `run()` is running
+     * on another thread
+     *
+     * @param node Index of node inside endpoints given at construction
+     *
+     * @returns Routed clients count
+     */
+    std::size_t nodeLoad(std::size_t node) const;
+
+    /**
+     * @brief Retrieves node given actor name is placed on, must not be called while `run()` is running on another
+     * thread
+     *
+     * @param actor_name Name given by `LOGIN` command
+     *
+     * @returns Index of node, uninitialized if actor name isn't placed
+     */
+    std::optional<std::size_t> placementFor(std::string_view actor_name) const;
+
+    /**
+     * @brief Retrieves node a `RESUME` for given actor UID is routed to, must not be called while `run()` is running on
+     * another thread
+     *
+     * @param actor_uid UID given by latest `LOGIN` command for that actor
+     *
+     * @returns Index of node, uninitialized if actor UID isn't placed
+     */
+    std::optional<std::size_t> sessionPlacementFor(std::uint64_t actor_uid) const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_CLUSTERGATEWAY_HPP
@@ -0,0 +1,241 @@
+#ifndef RPT_MINIGAMES_SERVER_IOURING_HPP
+#define RPT_MINIGAMES_SERVER_IOURING_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <linux/io_uring.h>
+
+/**
+ * @file IoUring.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Thrown if a Linux io_uring system call failed
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class IoUringError : public std::runtime_error {
+public:
+    /**
+     * @brief Constructs exception with error message for given errno value
+     *
+     * @param operation Failed operation
+     * @param error_number Errno value returned by failed system call
+     */
+    IoUringError(const std::string& operation, int error_number);
+};
+
+
+/**
+ * @brief Submission and completion queues shared with Linux kernel, set up with raw system calls so no external
+ * library is required
+ *
+ * Submission queue entries are retrieved with `prepare()` and passed to kernel with `submit()`, which may also wait
+ * for completions. Completion queue entries are then consumed with `forEachCompletion()`. Queues are not thread-safe,
+ * they must be used from a single thread.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class IoUring {
+public:
+    /// Result for a completed operation
+    struct Completion {
+        /// Value given for submitted operation
+        std::uint64_t userData;
+        /// Operation result, negative errno value if it failed
+        std::int32_t result;
+        /// `IORING_CQE_F_*` flags
+        std::uint32_t flags;
+    };
+
+private:
+    int ring_fd_;
+    // Memory mapped from kernel for submission and completion rings, which may be the same mapping
+    void* sq_ring_;
+    std::size_t sq_ring_size_;
+    void* cq_ring_;
+    std::size_t cq_ring_size_;
+    io_uring_sqe* sqes_;
+    std::size_t sqes_size_;
+
+    unsigned* sq_head_;
+    unsigned* sq_tail_;
+    unsigned sq_mask_;
+    unsigned sq_entries_;
+    unsigned* sq_array_;
+    // Tail for entries prepared since, it is published to kernel when submitted
+    unsigned sq_local_tail_;
+
+    unsigned* cq_head_;
+    unsigned* cq_tail_;
+    unsigned cq_mask_;
+    io_uring_cqe* cqes_;
+
+    /// Unmaps rings memory and closes ring, if they were set up
+    void release();
+
+public:
+    /**
+     * @brief Sets up rings with given number of submission queue entries
+     *
+     * @param entries Submission queue entries, rounded up to a power of 2 by kernel
+     *
+     * @throws IoUringError if kernel is unable to set up rings
+     */
+    explicit IoUring(unsigned entries);
+
+    /// Unregisters and unmaps everything, cancelling any pending operation
+    ~IoUring();
+
+    /// Rings are mapped for this instance only
+    IoUring(const IoUring&) = delete;
+    /// Rings are mapped for this instance only
+    IoUring& operator=(const IoUring&) = delete;
+
+    /**
+     * @brief Retrieves next submission queue entry, initialized to a basic operation on given file descriptor
+     *
+     * If submission queue is full, prepared entries are submitted first.
+     *
+     * @param opcode `IORING_OP_*` operation
+     * @param fd File descriptor to operate on
+     * @param user_data Value given back inside operation completion
+     *
+     * @returns Entry to complete with operation specific fields, valid until next call to `submit()`
+     *
+     * @throws IoUringError if submission queue is full and entries couldn't be submitted
+     */
+    io_uring_sqe& prepare(std::uint8_t opcode, int fd, std::uint64_t user_data);
+
+    /**
+     * @brief Submits every prepared entry, then waits until at least given number of operations completed
+     *
+     * @param wait_count Completions to wait for, `0` to return immediately
+     *
+     * @throws IoUringError if system call failed for any other reason than interruption or busy completion queue
+     */
+    void submit(unsigned wait_count = 0);
+
+    /**
+     * @brief Consumes every available completion
+     *
+     * Handler may prepare new entries, they will be submitted at next `submit()` call.
+     *
+     * @tparam Handler Callable object with `const Completion&` argument
+     *
+     * @param handler Called for each completion, in order
+     */
+    template<typename Handler>
+    void forEachCompletion(Handler&& handler) {
+        // Head is read again for each entry, as handler might consume completions itself
+        while (true) {
+            const unsigned head { *cq_head_ }; // Only modified by this thread
+
+            // Kernel writes entries before updating tail, so acquire is required to read them
+            if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+                break;
+
+            const io_uring_cqe& cqe { cqes_[head & cq_mask_] };
+            const Completion completion { cqe.user_data, cqe.res, cqe.flags };
+
+            // Entry is copied, so it can be given back to kernel before handler is called
+            __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+
+            handler(completion);
+        }
+    }
+
+    /**
+     * @brief Registers a ring of buffers provided to kernel for operations selecting their buffer from given group
+     *
+     * @param registration Ring memory, entries and group ID
+     *
+     * @throws IoUringError if kernel doesn't support provided buffers rings
+     */
+    void registerBuffersRing(const io_uring_buf_reg& registration);
+
+    /**
+     * @brief Unregisters buffers ring for given group
+     *
+     * @param group_id Group to unregister
+     */
+    void unregisterBuffersRing(std::uint16_t group_id);
+};
+
+
+/**
+ * @brief Fixed set of same-size buffers provided to kernel, so receive operations select a free buffer themselves and
+ * no buffer is allocated for each read
+ *
+ * Buffers are allocated once, contiguously. A buffer given back by a completion is owned by user until it is recycled.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class IoUringBuffers {
+private:
+    IoUring& ring_;
+    const std::uint16_t group_id_;
+    const std::size_t buffer_size_;
+    unsigned count_;
+    std::vector<char> storage_;
+    io_uring_buf_ring* buffers_ring_;
+    std::size_t buffers_ring_size_;
+    // Tail for buffers recycled since, published to kernel with next recycling
+    std::uint16_t tail_;
+
+public:
+    /**
+     * @brief Allocates and registers buffers for given ring
+     *
+     * @param ring Ring running operations selecting buffers
+     * @param group_id Group ID those operations must select buffers from
+     * @param count Number of buffers, rounded up to a power of 2, at most 32768
+     * @param buffer_size Size for each buffer
+     *
+     * @throws IoUringError if buffers ring couldn't be registered
+     */
+    IoUringBuffers(IoUring& ring, std::uint16_t group_id, unsigned count, std::size_t buffer_size);
+
+    /// Unregisters then deallocates buffers
+    ~IoUringBuffers();
+
+    /// Buffers are registered for this instance only
+    IoUringBuffers(const IoUringBuffers&) = delete;
+    /// Buffers are registered for this instance only
+    IoUringBuffers& operator=(const IoUringBuffers&) = delete;
+
+    /**
+     * @brief Retrieves group ID operations must select buffers from
+     *
+     * @returns Buffers group ID
+     */
+    std::uint16_t groupId() const;
+
+    /**
+     * @brief Retrieves data for given buffer, selected by a completed operation
+     *
+     * @param buffer_id Buffer ID given by completion flags
+     *
+     * @returns Beginning of buffer
+     */
+    const char* data(std::uint16_t buffer_id) const;
+
+    /**
+     * @brief Gives buffer back to kernel, so it can be selected by next operations
+     *
+     * @param buffer_id Buffer ID given by completion flags
+     */
+    void recycle(std::uint16_t buffer_id);
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_IOURING_HPP
@@ -0,0 +1,274 @@
+#ifndef RPT_MINIGAMES_SERVER_IOURINGBACKEND_HPP
+#define RPT_MINIGAMES_SERVER_IOURINGBACKEND_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <boost/asio/ip/tcp.hpp>
+#include <RpT-Network/IoUring.hpp>
+#include <RpT-Network/NetworkBackend.hpp>
+#include <RpT-Network/OutgoingMessagesQueue.hpp>
+#include <RpT-Network/RawTcpBackend.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+/**
+ * @file IoUringBackend.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Tuning options for `IoUringBackend`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct IoUringBackendOptions {
+    /// Watermarks for RPTL messages waiting to be sent to each client, a client exceeding high watermark is evicted
+    OutgoingQueueLimits outgoingLimits {};
+    /// Maximum length for a received RPTL message, a client announcing a longer frame is disconnected
+    std::size_t maxMessageSize { 64 * 1024 };
+    /// Submission queue entries, rounded up to a power of 2
+    unsigned ringEntries { 4096 };
+    /// Buffers shared by every connection to receive bytes into, rounded up to a power of 2, at most 32768
+    unsigned receiveBuffers { 1024 };
+    /// Size for each receive buffer
+    std::size_t receiveBufferSize { 4096 };
+};
+
+
+/**
+ * @brief Experimental Linux IO interface implementation running every connection on an io_uring instance, exchanging
+ * RPTL messages inside length-prefixed frames like `RawTcpBackend` does
+ *
+ * Incoming connections are accepted by a single multishot accept operation, and each client bytes are received by a
+ * single multishot receive operation selecting its buffer from a fixed set shared by every connection, so neither
+ * re-arming nor read buffer allocation happens for each message. Operations for many connections are submitted, and
+ * their completions are retrieved, with a single system call each time `waitForEvent()` runs.
+ *
+ * Timers countdowns, stop signals and completed tasks wake-ups are also io_uring operations, so there isn't any other
+ * event loop.
+ *
+ * Requires Linux 6.0 or later, for multishot receive with provided buffers rings.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class IoUringBackend : public NetworkBackend {
+private:
+    /// Operation kind for a submission, stored inside user data most significant byte
+    enum struct Operation : std::uint8_t {
+        Accept, Receive, Send, Timer, TimerRemoval, Signal, TasksCompleted
+    };
+
+    /// RPTL messages sent with a single gathered send, kept alive until send operation completed
+    struct SentFrames {
+        std::vector<MessageBuffer> messages;
+        std::vector<RawTcpBackend::FrameHeader> headers;
+        std::vector<iovec> buffers;
+        // Index of first buffer which hasn't been fully sent yet
+        std::size_t nextBuffer;
+        // Time point oldest sent message was queued at
+        std::chrono::steady_clock::time_point queuedAt;
+        msghdr header;
+    };
+
+    /// TCP connection with a client, with its own RPTL messages pipeline so clients are synced independently
+    struct ClientConnection {
+        int fd;
+        // Received bytes for an incomplete frame, beginning with its header
+        std::string pendingBytes;
+        OutgoingMessagesQueue remainingMessages;
+        SentFrames sentFrames;
+        bool sending;
+        // Multishot receive operation still generates completions
+        bool receiving;
+        // Removed from registry, socket is shut down once remaining messages have been sent
+        bool closing;
+        // Queue overflowed and client is being killed, no more message is queued
+        bool evicted;
+    };
+
+    /// Countdown for a pending timer, kernel reads timeout until operation completes
+    struct PendingTimer {
+        std::uint64_t token;
+        __kernel_timespec timeout;
+    };
+
+    static std::uint64_t userData(Operation operation, std::uint64_t id);
+
+    static std::vector<int> getCaughtSignals();
+
+    /// Opens TCP socket listening on given local endpoint, throws `boost::system::system_error` if it fails
+    static int openListener(const boost::asio::ip::tcp::endpoint& local_endpoint);
+
+    /// Tries to get string representation for socket remote endpoint, `"UNKNOWN"` if it fails
+    static std::string endpointFor(int socket_fd);
+
+    // Provides logging features
+    Utils::LoggerView logger_;
+    // Watermarks for messages waiting to be sent to each client
+    const OutgoingQueueLimits outgoing_limits_;
+    // Longer frames received from a client result into its disconnection
+    const std::size_t max_message_size_;
+    // Congested and evicted clients counters
+    BackpressureStats backpressure_stats_;
+    // Submits and completes every operation
+    IoUring ring_;
+    // Receive operations select their buffer from these ones
+    IoUringBuffers receive_buffers_;
+    // Listening socket for incoming TCP connections
+    int listener_fd_;
+    std::uint16_t local_port_;
+    // Posix signals to stop server are read from it, blocked so their default action doesn't happen
+    int signal_fd_;
+    signalfd_siginfo caught_signal_;
+    sigset_t previous_signals_mask_;
+    // Written by workers threads each time a task has been completed, so waiting for completions is interrupted
+    int tasks_fd_;
+    eventfd_t completed_tasks_count_;
+    // TCP connection and outgoing messages pipeline for each client token, even closing ones with pending operations
+    std::unordered_map<std::uint64_t, std::unique_ptr<ClientConnection>> clients_connection_;
+    // Timers countdowns, for each timer operation ID
+    std::unordered_map<std::uint64_t, PendingTimer> pending_timers_;
+    std::uint64_t timers_count_;
+    // Keep total clients count so an unique token can be given to each new client
+    std::uint64_t tokens_count_;
+
+    /// Submits accept operation generating a completion for each incoming connection
+    void acceptClients();
+
+    /// Submits receive operation generating a completion each time bytes are received from given client
+    void receiveFrom(std::uint64_t client_token, ClientConnection& connection);
+
+    /// Submits read operation for next caught Posix signal
+    void waitSignal();
+
+    /// Submits read operation for next tasks completion
+    void waitCompletedTasks();
+
+    /// Handles completed operation depending on its kind
+    void handleCompletion(const IoUring::Completion& completion);
+
+    /// Registers new client for accepted connection, or logs error
+    void handleAccepted(const IoUring::Completion& completion);
+
+    /// Handles received bytes for given client, or kills it if connection closed or failed
+    void handleReceived(std::uint64_t client_token, const IoUring::Completion& completion);
+
+    /// Handles send result for given client, sending remaining frames or next messages
+    void handleSent(std::uint64_t client_token, const IoUring::Completion& completion);
+
+    /**
+     * @brief Handles every complete frame inside given bytes, keeping incomplete frame inside connection
+     *
+     * @param client_token Token for client bytes were received from
+     * @param connection Connection bytes were received from
+     * @param received_bytes Bytes received by last operation
+     */
+    void handleReceivedBytes(std::uint64_t client_token, ClientConnection& connection,
+                             std::string_view received_bytes);
+
+    /**
+     * @brief Handles every complete frame from beginning of given bytes, stopping if client is killed
+     *
+     * @param client_token Token for client bytes were received from
+     * @param frames Received bytes, beginning with a frame header
+     *
+     * @returns Number of bytes handled, meaningless if client was killed meanwhile
+     */
+    std::size_t handleFrames(std::uint64_t client_token, std::string_view frames);
+
+    /// Handles one received RPTL message, any error resulting in client being killed
+    void handleReceivedMessage(std::uint64_t client_token, std::string_view rptl_message);
+
+    /// Submits a single gathered send for every queued message for given client
+    void sendRemainingMessages(std::uint64_t client_token, ClientConnection& connection);
+
+    /// Submits send for frames which haven't been sent yet
+    void sendFrames(std::uint64_t client_token, ClientConnection& connection);
+
+    /// Removes given killed client, its connection is shut down once already queued messages have been sent
+    void closeConnection(std::uint64_t client_token);
+
+    /// Closes and forgets given closing connection if it doesn't have any pending operation left
+    void releaseConnection(std::uint64_t client_token);
+
+protected:
+    /// Appends flushed messages to client pipeline, evicting client if its queue overflowed
+    void syncClient(std::uint64_t client_token, MessagesQueueView client_messages_queue) final;
+
+    /// Submits prepared operations and handles completions until input events queue is no longer empty
+    void waitForEvent() final;
+
+    /// Closes killed clients connections, then submits prepared operations and handles posted completions without waiting
+    void pollReadyEvents() final;
+
+    /// Writes tasks event file descriptor, so its pending read operation completes
+    void wakeForCompletedTasks() final;
+
+public:
+    /**
+     * @brief Constructs IO interface listening for new TCP connections on given local endpoint
+     *
+     * In addition to that, constructor will block then read `SIGINT` and `SIGTERM` signals to close IO interface when
+     * required.
+     *
+     * @param local_endpoint Endpoint clients will connect to
+     * @param logging_context Context for io_uring backend logging features
+     * @param options Tuning options for rings and connections handling
+     * @param players_limit Maximum number of actors registered simultaneously
+     *
+     * @throws IoUringError if running kernel doesn't support required io_uring features
+     * @throws boost::system::system_error if listening socket couldn't be opened
+     */
+    explicit IoUringBackend(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                            Utils::LoggingContext& logging_context, const IoUringBackendOptions& options = {},
+                            std::size_t players_limit = 2);
+
+    /// Closes every remaining file descriptor, pending operations are cancelled with ring
+    ~IoUringBackend() override;
+
+    /// Pending operations are referring to instance state
+    IoUringBackend(const IoUringBackend&) = delete;
+    /// Pending operations are referring to instance state
+    IoUringBackend& operator=(const IoUringBackend&) = delete;
+
+    /**
+     * @brief Retrieves port listening socket is bound to, useful if it was chosen by system
+     *
+     * @returns Local port for incoming connections
+     */
+    std::uint16_t localPort() const;
+
+    /**
+     * @brief Retrieves how many times clients outgoing queues reached their watermarks
+     *
+     * @returns Backpressure counters since backend was constructed
+     */
+    const BackpressureStats& backpressureStats() const;
+
+    /**
+     * @brief Set Ready timer state to Pending, then submits a timeout operation completing once countdown is done
+     */
+    void beginTimer(Core::Timer& ready_timer) final;
+
+    /**
+     * @brief Closes all opened TCP connections, stops handling IO operations, then mark IO interface as closed
+     */
+    void close() final;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_IOURINGBACKEND_HPP
@@ -0,0 +1,215 @@
+#ifndef RPT_MINIGAMES_SERVER_LOOPBACKBACKEND_HPP
+#define RPT_MINIGAMES_SERVER_LOOPBACKBACKEND_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <RpT-Network/NetworkBackend.hpp>
+
+/**
+ * @file LoopbackBackend.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief In-process `NetworkBackend` implementation where clients are simulated from inside server process, used for
+ * benchmarks and soak tests without any socket or IO thread
+ *
+ * Simulated clients are connected with `connect()` and send RPTL messages with `send()`. Messages sent by server to
+ * clients are counted and may be observed with a received messages handler.
+ *
+ * Each call to `waitForEvent()` handles, in order of priority: next message sent by a simulated client, then oldest
+ * begun task which is waited for to complete, then earliest pending timer which is triggered immediately as simulated
+ * time jumps to its deadline, then asks messages generator for more client activity. Backend closes itself when generator is exhausted and there is nothing left to handle, so
+ * runs are deterministic and never wait for wall clock time. Polling input without waiting only handles messages
+ * already sent by simulated clients.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LoopbackBackend : public NetworkBackend {
+public:
+    /// Called when there is nothing left to handle, must return `false` once there isn't any more client activity
+    using MessagesGenerator = std::function<bool(LoopbackBackend&)>;
+    /// Called for each RPTL message sent by server to a simulated client
+    using ReceivedMessageHandler = std::function<void(std::uint64_t, const std::string&)>;
+
+private:
+    /// RPTL message sent by a simulated client, not handled yet
+    struct ClientMessage {
+        std::uint64_t token;
+        std::string message;
+    };
+
+    MessagesGenerator messages_generator_;
+    ReceivedMessageHandler received_message_handler_;
+    std::unordered_set<std::uint64_t> connected_clients_;
+    std::queue<ClientMessage> clients_messages_;
+    /// Pending timers tokens sorted by simulated deadline, in milliseconds
+    std::multimap<std::uint64_t, std::uint64_t> pending_timers_;
+    // Tasks begun by executor, completed in that order whatever order workers ran them in
+    std::queue<std::uint64_t> begun_tasks_;
+    // Protects tokens for tasks which have run but haven't been completed yet, as they are listed by workers threads
+    std::mutex ran_tasks_mutex_;
+    std::condition_variable task_ran_;
+    std::unordered_set<std::uint64_t> ran_tasks_;
+    std::uint64_t simulated_time_;
+    std::uint64_t received_messages_count_;
+    std::uint64_t tokens_count_;
+
+    /// Handles oldest message sent by a simulated client, killing it if message triggered an error or a logout
+    void handleNextClientMessage();
+
+    /// Moves simulated time to earliest pending timer deadline and triggers that timer
+    void triggerNextTimer();
+
+    /// Waits for oldest begun task to have run, without any simulated time elapsing, then completes that task
+    void completeNextTask();
+
+protected:
+    /// Counts each message then calls received message handler with it, if any
+    void syncClient(std::uint64_t client_token, MessagesQueueView client_messages_queue) final;
+
+    /// Handles simulated clients activity until an input event is triggered or backend is closed
+    void waitForEvent() final;
+
+    /// Handles every message already sent by simulated clients, neither timers nor generator are involved
+    void pollReadyEvents() final;
+
+public:
+    /**
+     * @brief Constructs backend without any simulated client
+     *
+     * @param messages_generator Called each time there is nothing left to handle, backend is closed at the first time
+     * there is nothing to handle if no generator is given
+     * @param actors_limit Maximum number of actors registered simultaneously
+     */
+    explicit LoopbackBackend(MessagesGenerator messages_generator = {}, std::size_t actors_limit = 2);
+
+    /**
+     * @brief Sets handler called for each RPTL message sent by server to any simulated client
+     *
+     * @param handler Handler receiving client token and sent message
+     */
+    void onReceivedMessage(ReceivedMessageHandler handler);
+
+    /**
+     * @brief Connects new simulated client
+     *
+     * @returns Token for new client
+     */
+    std::uint64_t connect();
+
+    /**
+     * @brief Queues RPTL message sent by given simulated client, handled after every previously queued message
+     *
+     * @param client_token Sender client token
+     * @param message RPTL message sent by client, ignored if client has been disconnected before it is handled
+     */
+    void send(std::uint64_t client_token, std::string message);
+
+    /**
+     * @brief Closes connection for given simulated client, as if its socket had been closed
+     *
+     * @param client_token Client to disconnect
+     */
+    void disconnect(std::uint64_t client_token);
+
+    /**
+     * @brief Checks if given simulated client is still connected
+     *
+     * @param client_token Client to check for
+     *
+     * @returns `true` if client is connected and hasn't been killed
+     */
+    bool isConnected(std::uint64_t client_token) const;
+
+    /**
+     * @brief Retrieves connected simulated clients count
+     *
+     * @returns Number of simulated clients which haven't been disconnected yet
+     */
+    std::size_t connectedCount() const;
+
+    /**
+     * @brief Retrieves how many messages have been sent by server to simulated clients
+     *
+     * @returns Total number of messages synced with simulated clients
+     */
+    std::uint64_t receivedMessagesCount() const;
+
+    /**
+     * @brief Retrieves simulated time elapsed since backend construction, which only goes forward when timers are
+     * triggered
+     *
+     * @returns Elapsed simulated time
+     */
+    std::chrono::milliseconds simulatedTime() const;
+
+    /// Schedules timer trigger at simulated time deadline
+    void beginTimer(Core::Timer& ready_timer) final;
+
+    /// Queues task so it is completed after previously begun ones
+    void beginTask(std::uint64_t token) final;
+
+    /// Lists task as ran, waking up `waitForEvent()` if it was waiting for it
+    void completeTask(std::uint64_t token) final;
+
+    /// Disconnects every simulated client then mark IO interface as closed
+    void close() final;
+};
+
+
+/**
+ * @brief `LoopbackBackend::MessagesGenerator` reading simulated clients messages from a script, one per line
+ *
+ * Each line is made of a client number, a space then RPTL message sent by this client. Client is connected the first
+ * time its number appears. A line with client number only disconnects this client. Empty lines and lines beginning
+ * with `#` are ignored.
+ *
+ * A single line is read each time generator is called, so server handles and answers each message before next one is
+ * sent.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LoopbackScript {
+private:
+    std::istream& script_;
+    std::unordered_map<std::uint64_t, std::uint64_t> clients_token_;
+
+public:
+    /**
+     * @brief Constructs generator reading given script
+     *
+     * @param script Script input stream, must be valid as long as generator is used
+     */
+    explicit LoopbackScript(std::istream& script);
+
+    /**
+     * @brief Reads next script line and plays it on given backend
+     *
+     * @param backend Backend to play line on
+     *
+     * @returns `false` if script end has been reached
+     *
+     * @throws BadClientMessage if line client number is invalid
+     */
+    bool operator()(LoopbackBackend& backend);
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_LOOPBACKBACKEND_HPP
@@ -0,0 +1,72 @@
+#ifndef RPT_MINIGAMES_SERVER_MESSAGESBATCH_HPP
+#define RPT_MINIGAMES_SERVER_MESSAGESBATCH_HPP
+
+#include <queue>
+#include <string>
+#include <vector>
+#include <boost/asio/buffer.hpp>
+#include <RpT-Network/MessagesPool.hpp>
+
+/**
+ * @file MessagesBatch.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Several RPTL messages sent together inside one single frame, with a single gathered write
+ *
+ * Batch envelope is made of each RPTL message prefixed by its size in bytes, then a colon. For example, messages
+ * `LOGGED_IN 1 Alvis` and `LOGGED_OUT 1` will be sent as `17:LOGGED_IN 1 Alvis12:LOGGED_OUT 1`.
+ *
+ * With binary envelope, used by clients which negotiated binary mode, size prefix is an unsigned LEB128 varint without
+ * any separator.
+ *
+ * Batch owns its messages so buffers sequence is valid as long as batch is alive.
+ *
+ * @author ThisALV, https://github.com/ThisALV/
+ */
+class MessagesBatch {
+public:
+    /// Format for size prefixing each RPTL message inside batch
+    enum struct Envelope {
+        Text, Binary
+    };
+
+private:
+    std::vector<MessageBuffer> messages_;
+    std::string headers_;
+    std::vector<boost::asio::const_buffer> buffers_;
+
+public:
+    /**
+     * @brief Constructs batch from every message inside given queue, which will then be empty
+     *
+     * @param messages_queue RPTL messages to send together
+     * @param envelope Format for messages size prefix
+     */
+    explicit MessagesBatch(std::queue<MessageBuffer>& messages_queue,
+                           Envelope envelope = Envelope::Text);
+
+    /**
+     * @brief Retrieves number of RPTL messages inside batch
+     *
+     * @returns Count of messages
+     */
+    std::size_t count() const;
+
+    /**
+     * @brief Retrieves buffers sequence to write for whole batch, alternating between each message header and data
+     *
+     * @returns Buffers sequence for a gathered write operation
+     */
+    const std::vector<boost::asio::const_buffer>& buffers() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_MESSAGESBATCH_HPP
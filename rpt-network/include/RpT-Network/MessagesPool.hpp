@@ -0,0 +1,205 @@
+#ifndef RPT_MINIGAMES_SERVER_MESSAGESPOOL_HPP
+#define RPT_MINIGAMES_SERVER_MESSAGESPOOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file MessagesPool.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+class MessagesPool;
+
+
+/**
+ * @brief Storage for a RPTL message inside pool slabs, only accessed through `MessageBuffer` handles
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct PooledMessage {
+    /// RPTL message data, its capacity is kept when storage is recycled
+    std::string content;
+    /// Number of `MessageBuffer` handles sharing this message
+    std::atomic<std::size_t> references;
+    /// Pool this storage must be given back to
+    MessagesPool* pool;
+    /// Next storage inside pool free list, if any
+    PooledMessage* nextFree;
+};
+
+
+/**
+ * @brief Ref-counted handle to a RPTL message borrowed from a `MessagesPool`
+ *
+ * Message is shared by every copy of a handle, and its storage is given back to pool once last copy is destroyed.
+ * Unlike shared pointers, reference counter lives inside pooled storage so no control block has to be allocated.
+ *
+ * Counter stays atomic as connections strands might release messages from IO threads.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MessageBuffer {
+private:
+    PooledMessage* message_;
+
+    /// Drops reference to current message, giving it back to pool if it was the last one
+    void release();
+
+public:
+    /**
+     * @brief Constructs handle to given pooled message, which must already count this new reference
+     *
+     * @param message Pooled message storage, `nullptr` for an empty handle
+     */
+    explicit MessageBuffer(PooledMessage* message = nullptr);
+
+    MessageBuffer(const MessageBuffer& rhs);
+    MessageBuffer& operator=(const MessageBuffer& rhs);
+    MessageBuffer(MessageBuffer&& rhs) noexcept;
+    MessageBuffer& operator=(MessageBuffer&& rhs) noexcept;
+
+    /// Drops reference to message, if any
+    ~MessageBuffer();
+
+    /**
+     * @brief Retrieves RPTL message data
+     *
+     * @returns Message data, undefined behavior if handle is empty
+     */
+    const std::string& operator*() const;
+
+    /**
+     * @brief Retrieves RPTL message data
+     *
+     * @returns Pointer to message data, `nullptr` if handle is empty
+     */
+    const std::string* operator->() const;
+
+    /**
+     * @brief Checks if handle refers to a message
+     *
+     * @returns `true` if handle isn't empty
+     */
+    explicit operator bool() const;
+
+    /**
+     * @brief Retrieves number of handles sharing this message
+     *
+     * @returns References count, 0 if handle is empty
+     */
+    std::size_t useCount() const;
+
+    /**
+     * @brief Checks if both handles share the same message, like shared pointers comparison
+     *
+     * @param rhs Other handle
+     *
+     * @returns `true` if both handles refer to same storage or are both empty
+     */
+    bool operator==(const MessageBuffer& rhs) const;
+
+    /// Checks if handles refer to different messages
+    bool operator!=(const MessageBuffer& rhs) const;
+};
+
+
+/**
+ * @brief Recycles RPTL messages storage, so queuing a message for many clients doesn't allocate once pool is warm
+ *
+ * Storages are allocated by slabs and kept inside a free list when they aren't referenced anymore. A recycled storage
+ * keeps its string capacity, unless it exceeds `MAX_RETAINED_CAPACITY` so a single huge message doesn't stay in
+ * memory.
+ *
+ * Messages are acquired by Executor thread, but they might be given back by IO threads, so free list is locked.
+ *
+ * Pool must outlive every message acquired from it.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MessagesPool {
+private:
+    friend class MessageBuffer;
+
+    const std::size_t slab_size_;
+    std::vector<std::unique_ptr<PooledMessage[]>> slabs_;
+    // Protects free list and in-use counter, as messages might be released from any thread
+    mutable std::mutex free_messages_lock_;
+    PooledMessage* free_messages_;
+    std::size_t in_use_;
+
+    /// Gives back storage which is no longer referenced
+    void release(PooledMessage& message);
+
+    /// Allocates a new slab and chains its storages into free list, free list lock must be owned
+    void allocateSlab();
+
+public:
+    /// Number of storages allocated at once when free list is empty, if none is given
+    static constexpr std::size_t DEFAULT_SLAB_SIZE { 256 };
+    /// Capacity above which a recycled message data is freed
+    static constexpr std::size_t MAX_RETAINED_CAPACITY { 64 * 1024 };
+
+    /**
+     * @brief Constructs pool without any slab yet
+     *
+     * @param slab_size Number of storages allocated at once
+     *
+     * @throws std::invalid_argument if slab size is 0
+     */
+    explicit MessagesPool(std::size_t slab_size = DEFAULT_SLAB_SIZE);
+
+    /*
+     * Entity class semantic
+     */
+
+    MessagesPool(const MessagesPool&) = delete;
+    MessagesPool& operator=(const MessagesPool&) = delete;
+
+    /// Checks every message has been given back in debug mode
+    ~MessagesPool();
+
+    /**
+     * @brief Copies given RPTL message into a recycled storage, allocating a new slab if none is free
+     *
+     * @param content Message data
+     *
+     * @returns Handle which is the single reference to new message
+     */
+    MessageBuffer acquire(std::string_view content);
+
+    /**
+     * @brief Allocates slabs until pool has at least given storages count, so first messages don't allocate slabs
+     *
+     * @param messages_count Number of storages expected to be used simultaneously
+     */
+    void reserve(std::size_t messages_count);
+
+    /**
+     * @brief Retrieves number of storages allocated by pool
+     *
+     * @returns Slabs count multiplied by slab size
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Retrieves number of storages currently referenced
+     *
+     * @returns Messages acquired and not given back yet
+     */
+    std::size_t inUse() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_MESSAGESPOOL_HPP
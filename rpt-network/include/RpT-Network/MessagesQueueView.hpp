@@ -2,9 +2,9 @@
 #define RPT_MINIGAMES_SERVER_MESSAGESQUEUEVIEW_HPP
 
 #include <functional>
-#include <memory>
 #include <queue>
 #include <stdexcept>
+#include <RpT-Network/MessagesPool.hpp>
 
 /**
  * @file MessagesQueueView.hpp
@@ -28,22 +28,48 @@ public:
 };
 
 
+/**
+ * @brief Priority class for a RPTL message sent to a client
+ *
+ * Critical messages are sent before best-effort ones. Order is kept between messages of a same class only.
+ */
+enum struct MessagePriority {
+    /// Protocol and game messages, which client is waiting for to keep playing
+    Critical,
+    /// Messages which can be delayed or dropped under backpressure, like chat or spectators updates
+    BestEffort
+};
+
+
 /**
  * Provides access to a RPTL messages queue consumation forbidding insertion/add operations.
  *
+ * Messages queue might be made of a critical lane and a best-effort lane, in which case every critical message is
+ * consumed before best-effort ones.
+ *
  * @author ThisALV, https://github.com/ThisALV/
  */
 class MessagesQueueView {
 private:
-    std::reference_wrapper<std::queue<std::shared_ptr<std::string>>> messages_queue_;
+    std::reference_wrapper<std::queue<MessageBuffer>> messages_queue_;
+    // Consumed once critical lane is empty, if any
+    std::queue<MessageBuffer>* best_effort_queue_;
 
 public:
     /**
-     * @brief Constructs view for given messages queue
+     * @brief Constructs view for given messages queue, every message being critical
      *
      * @param messages_queue RPTL messages queue to provide access
      */
-    explicit MessagesQueueView(std::queue<std::shared_ptr<std::string>>& messages_queue);
+    explicit MessagesQueueView(std::queue<MessageBuffer>& messages_queue);
+
+    /**
+     * @brief Constructs view for given critical and best-effort messages lanes
+     *
+     * @param critical_queue Critical RPTL messages, consumed first
+     * @param best_effort_queue Best-effort RPTL messages, consumed once critical lane is empty
+     */
+    MessagesQueueView(std::queue<MessageBuffer>& critical_queue, std::queue<MessageBuffer>& best_effort_queue);
 
     /**
      * @brief Checks if every message has been consumed or not.
@@ -52,6 +78,15 @@ public:
      */
     bool hasNext() const;
 
+    /**
+     * @brief Retrieves priority class for message `next()` will retrieve
+     *
+     * @returns Priority for next RPTL message
+     *
+     * @throws NoMoreMessage if queue is empty
+     */
+    MessagePriority nextPriority() const;
+
     /**
      * @brief Retrieves next RPTL message and removes it from queue
      *
@@ -59,7 +94,7 @@ public:
      *
      *
      */
-    std::shared_ptr<std::string> next();
+    MessageBuffer next();
 };
 
 
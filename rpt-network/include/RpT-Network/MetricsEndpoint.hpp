@@ -0,0 +1,122 @@
+#ifndef RPT_MINIGAMES_SERVER_METRICSENDPOINT_HPP
+#define RPT_MINIGAMES_SERVER_METRICSENDPOINT_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+#include <RpT-Utils/PipelineLatencies.hpp>
+#include <RpT-Utils/RuntimeMetrics.hpp>
+#include <RpT-Utils/SlowRequestSampler.hpp>
+
+/**
+ * @file MetricsEndpoint.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief HTTP listener serving runtime metrics with Prometheus text exposition format, so server can be scraped
+ *
+ * Listener runs on its own thread with its own IO context, so scrapes never delay Executor thread or clients
+ * connections. Metrics are read while they are updated, each of them being thread-safe.
+ *
+ * `GET /metrics` is answered with every `Utils::RuntimeMetrics` sample, followed by pipeline latencies summaries if
+ * they are recorded, and by slow requests exemplars if they are sampled. Any other target is answered with 404, any
+ * other method with 405. A single request is served for each connection, which is closed once response has been
+ * written.
+ *
+ * `GET /status` is answered with server availability for load balancers health checks, so they don't have to
+ * connect as RPTL clients and use `CHECKOUT`. Body is a JSON object with registered actors count, actors limit,
+ * occupied rooms count and main loop saturation. Status is 200 if server is ready, isn't overloaded and isn't full,
+ * 503 otherwise.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MetricsEndpoint {
+public:
+    /// Path scraped metrics are served at
+    static constexpr std::string_view METRICS_TARGET { "/metrics" };
+    /// Path availability is served at
+    static constexpr std::string_view STATUS_TARGET { "/status" };
+
+private:
+    const Utils::RuntimeMetrics& metrics_;
+    const Utils::PipelineLatencies* const latencies_;
+    const Utils::SlowRequestSampler* const slow_requests_;
+    boost::asio::io_context listener_context_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    // Started last, once acceptor is listening
+    std::thread listener_thread_;
+
+    /// Accepts next scraper connection, then waits for next one again
+    void acceptNext();
+
+    /**
+     * @brief Formats every sample inside a response body
+     *
+     * @returns Prometheus text exposition body
+     */
+    std::string formatMetrics() const;
+
+    /**
+     * @brief Formats server availability inside a response body
+     *
+     * @returns JSON availability object
+     */
+    std::string formatStatus() const;
+
+    /**
+     * @brief Checks if server can be given new clients
+     *
+     * @returns `true` if server is ready, its main loop isn't overloaded and actors limit hasn't been reached
+     */
+    bool available() const;
+
+    /// Reads request from given connected scraper and writes response
+    void serve(boost::asio::ip::tcp::socket scraper_connection);
+
+public:
+    /**
+     * @brief Constructs endpoint listening on given local endpoint and starts its listener thread
+     *
+     * @param local_endpoint Endpoint to listen for scrapers on, port 0 lets system choose one
+     * @param metrics Runtime metrics to serve, must outlive endpoint
+     * @param logging_context Context to log listening endpoint with
+     * @param latencies Pipeline latencies to serve, if any, must outlive endpoint
+     * @param slow_requests Slow requests exemplars to serve, if any, must outlive endpoint
+     *
+     * @throws boost::system::system_error if listener couldn't be opened on given endpoint
+     */
+    MetricsEndpoint(const boost::asio::ip::tcp::endpoint& local_endpoint, const Utils::RuntimeMetrics& metrics,
+                    Utils::LoggingContext& logging_context, const Utils::PipelineLatencies* latencies = nullptr,
+                    const Utils::SlowRequestSampler* slow_requests = nullptr);
+
+    /// Stops listening and joins listener thread, pending scrapes are aborted
+    ~MetricsEndpoint();
+
+    /*
+     * Entity class semantic
+     */
+
+    MetricsEndpoint(const MetricsEndpoint&) = delete;
+    MetricsEndpoint& operator=(const MetricsEndpoint&) = delete;
+
+    /**
+     * @brief Retrieves port endpoint is listening on, useful if it was chosen by system
+     *
+     * @returns Local listening port
+     */
+    std::uint16_t localPort() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_METRICSENDPOINT_HPP
@@ -0,0 +1,146 @@
+#ifndef RPT_MINIGAMES_SERVER_MPSCRING_HPP
+#define RPT_MINIGAMES_SERVER_MPSCRING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+/**
+ * @file MpscRing.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Bounded lock-free ring handing values from many producer threads to a single consumer thread
+ *
+ * Each cell has a sequence number telling which lap it is ready for, so producers only contend on a shared write
+ * position and never wait for each other: a producer claims a cell, moves its value inside, then publishes it by
+ * updating cell sequence. Consumer polls cells in order without any atomic read-modify-write operation.
+ *
+ * Ring is full if consumer didn't poll cell which a producer is trying to claim, push then fails so caller can fall
+ * back on another hand-off.
+ *
+ * @tparam T Movable value type
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<typename T>
+class MpscRing {
+private:
+    /// Avoids false sharing between producers and consumer positions
+    static constexpr std::size_t CACHE_LINE { 64 };
+
+    struct Cell {
+        // Equals to cell index for producer lap, then to index + 1 once value is published for consumer
+        std::atomic<std::size_t> sequence;
+        std::optional<T> value;
+    };
+
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(CACHE_LINE) std::atomic<std::size_t> write_position_;
+    alignas(CACHE_LINE) std::size_t read_position_;
+
+    /// Retrieves lowest power of 2 which is at least given capacity
+    static std::size_t roundedCapacity(const std::size_t capacity) {
+        if (capacity == 0)
+            throw std::invalid_argument { "Ring capacity must be positive" };
+
+        std::size_t rounded_capacity { 1 };
+        while (rounded_capacity < capacity)
+            rounded_capacity <<= 1;
+
+        return rounded_capacity;
+    }
+
+public:
+    /**
+     * @brief Constructs empty ring with at least given capacity, rounded to next power of 2
+     *
+     * @param capacity Minimum number of values ring can contain
+     *
+     * @throws std::invalid_argument if capacity is 0
+     */
+    explicit MpscRing(const std::size_t capacity)
+    : mask_ { roundedCapacity(capacity) - 1 }, cells_ { std::make_unique<Cell[]>(mask_ + 1) }, write_position_ { 0 },
+    read_position_ { 0 } {
+        for (std::size_t cell_index { 0 }; cell_index <= mask_; cell_index++)
+            cells_[cell_index].sequence.store(cell_index, std::memory_order_relaxed);
+    }
+
+    // Entity class semantic, threads are referencing instance
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /**
+     * @brief Retrieves ring capacity
+     *
+     * @returns Maximum number of values ring can contain
+     */
+    std::size_t capacity() const {
+        return mask_ + 1;
+    }
+
+    /**
+     * @brief Moves given value at ring end, may be called from any thread
+     *
+     * @param value Value to push, moved only if push succeeded
+     *
+     * @returns `true` if value was pushed, `false` if ring is full
+     */
+    bool tryPush(T& value) {
+        std::size_t position { write_position_.load(std::memory_order_relaxed) };
+
+        while (true) {
+            Cell& cell { cells_[position & mask_] };
+            const std::size_t sequence { cell.sequence.load(std::memory_order_acquire) };
+
+            if (sequence == position) { // Cell is free for this lap, tries to claim it
+                if (write_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.value.emplace(std::move(value));
+                    cell.sequence.store(position + 1, std::memory_order_release); // Published for consumer
+
+                    return true;
+                }
+                // Otherwise, position was updated with another producer claim and next cell is tried
+            } else if (sequence < position) { // Cell still contains a value from previous lap which wasn't polled
+                return false;
+            } else { // Another producer claimed this cell already, retries with current position
+                position = write_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Polls value at ring front, must only be called by consumer thread
+     *
+     * @returns Polled value, or uninitialized if ring is empty or if first value isn't published yet
+     */
+    std::optional<T> tryPop() {
+        Cell& cell { cells_[read_position_ & mask_] };
+
+        if (cell.sequence.load(std::memory_order_acquire) != read_position_ + 1) // Not published yet
+            return {};
+
+        std::optional<T> polled_value { std::move(cell.value) };
+        cell.value.reset();
+
+        // Cell is free for next producers lap
+        cell.sequence.store(read_position_ + mask_ + 1, std::memory_order_release);
+        read_position_++;
+
+        return polled_value;
+    }
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_MPSCRING_HPP
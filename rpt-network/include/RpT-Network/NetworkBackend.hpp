@@ -1,16 +1,30 @@
 #ifndef RPTOGETHER_SERVER_NETWORKBACKEND_HPP
 #define RPTOGETHER_SERVER_NETWORKBACKEND_HPP
 
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <RpT-Core/InputOutputInterface.hpp>
 #include <RpT-Network/MessagesQueueView.hpp>
+#include <RpT-Network/RequestRateLimiter.hpp>
+#include <RpT-Utils/FlatHashMap.hpp>
 #include <RpT-Utils/HandlingResult.hpp>
+#include <RpT-Utils/IterationArena.hpp>
+#include <RpT-Utils/LoadMonitor.hpp>
+#include <RpT-Utils/LoopTracer.hpp>
+#include <RpT-Utils/NamesTable.hpp>
+#include <RpT-Utils/PipelineLatencies.hpp>
+#include <RpT-Utils/RuntimeMetrics.hpp>
 #include <RpT-Utils/TextProtocolParser.hpp>
 
 /**
@@ -210,30 +224,54 @@ public:
  * - Handshake: `LOGIN <uid> <name>`, must NOT be registered
  * - Log out (clean way): `LOGOUT`, must BE registered
  * - Send Service Request command: `SERVICE <SR_command>` (see `Core::ServiceEventRequestProtocol`), must BE registered
+ * - Enable coalesced roster changes: `ROSTER_DELTA`, must BE registered
+ * - Enable session resumption: `SESSION`, must BE registered
+ * - Resume session: `RESUME <uid> <secret>`, must NOT be registered
  *
  * Server to client, private:
  * - Check: `AVAILABILITY <actors_count> <max_actors_number>`, must NOT be registered
  * - Registration confirmation: `REGISTRATION [<uid_1> <actor_1>]...`, must NOT be registered
+ * - Session secret: `SESSION <secret>`, must BE registered
+ * - Session resumed: `RESUMED`, must NOT be registered
  * - Connection closed: `INTERRUPT [ERR_MSG]`, must BE registered
  * - Service Request Response: `SERVICE <SRR>`, must BE registered, see `Core::ServiceEventRequestProtocol` for SRR doc
  *
  * Server to clients, target, must BE registered:
  * - Logged in actor: `LOGGED_IN <uid> <name>`, broadcast
  * - Logged out actor: `LOGGED_OUT <uid>`, broadcast
+ * - Roster changes: `ROSTER_DELTA [LOGGED_IN <uid> <name> | LOGGED_OUT <uid>]...`, broadcast
  * - Service Event command: `SERVICE <SE_command>`, might be broadcast
  *
+ * Clients which enabled `ROSTER_DELTA` don't receive `LOGGED_IN` and `LOGGED_OUT` messages. Instead, every roster
+ * change since previous `synchronize()` call is pushed in order into a single `ROSTER_DELTA` message, queued after
+ * messages pushed meanwhile. So N actors joining at once cost N messages instead of N².
+ *
+ * Clients which enabled `SESSION` receive a secret, and keep their actor if their connection is lost by
+ * implementation with `loseClient()`, like when a phone switches networks. Actor is detached from any connection
+ * for a grace period, still listed inside roster and still queuing messages, but neither left nor joined event is
+ * emitted. Another connection can then send `RESUME` with actor UID and secret, so actor and messages queued meanwhile
+ * are moved to that connection, without handshake nor `REGISTRATION` resync. `RESUME` also takes over actor from a
+ * connection server didn't detect as lost yet. Messages already written to lost connection aren't sent again. Once
+ * grace period elapsed, detached actor is closed with an error as if it was killed. Sessions are held by node which
+ * logged actor in, `ClusterGateway` routes `RESUME` to that node if it is sent as connection first message.
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class NetworkBackend : public Core::InputOutputInterface {
-private:
+public:
     /*
-     * Prefixes for RPTL protocol commands invoked by clients
+     * Prefixes for RPTL protocol commands invoked by clients, public so RPTL clients can stay protocol-accurate
      */
 
     static constexpr std::string_view CHECKOUT_COMMAND { "CHECKOUT" };
     static constexpr std::string_view HANDSHAKE_COMMAND { "LOGIN" };
     static constexpr std::string_view LOGOUT_COMMAND { "LOGOUT" };
     static constexpr std::string_view SERVICE_COMMAND { "SERVICE" };
+    /// Also invoked by server, to send coalesced roster changes to clients which enabled it
+    static constexpr std::string_view ROSTER_DELTA_COMMAND { "ROSTER_DELTA" };
+    /// Also invoked by server, to send secret required to resume session
+    static constexpr std::string_view SESSION_COMMAND { "SESSION" };
+    static constexpr std::string_view RESUME_COMMAND { "RESUME" };
 
     /*
      * Prefixes for RPTL protocol commands invoked and formatted by server
@@ -244,12 +282,18 @@ private:
     static constexpr std::string_view INTERRUPT_COMMAND { "INTERRUPT" };
     static constexpr std::string_view LOGGED_IN_COMMAND { "LOGGED_IN" };
     static constexpr std::string_view LOGGED_OUT_COMMAND { "LOGGED_OUT" };
+    static constexpr std::string_view RESUMED_COMMAND { "RESUMED" };
 
+private:
     /// Parser for RPTL Protocol command, only parsing command name
     class RptlCommandParser : public Utils::TextProtocolParser {
     public:
+        /// Parses given command without throwing, `isEmpty()` must be checked first
         explicit RptlCommandParser(std::string_view rptl_command);
 
+        /// Checks if parsed command is empty, so no command name is invoked
+        bool isEmpty() const;
+
         /// Retrieves invoked command name
         std::string_view invokedCommandName() const;
 
@@ -269,9 +313,8 @@ private:
          *
          * @param parsed_rptl_command Parsed RPTL `LOGIN` command
          *
-         * @throws BadClientMessage if parsed actor UID isn't a valid unsigned integer of 64bits, or if extra args
-         * are given
-         * @throws NotEnoughWords if arguments are missing
+         * @throws BadClientMessage if parsed actor UID isn't a valid unsigned integer of 64bits, or if arguments are
+         * missing or extra args are given
          */
         explicit HandshakeParser(const RptlCommandParser& parsed_rptl_command);
 
@@ -282,18 +325,28 @@ private:
         std::string_view actorName() const;
     };
 
-    /// Parser for RPTL `SERVICE` command arguments
-    class ServiceCommandParser : public Utils::TextProtocolParser {
+    /// Parser for RPTL `RESUME` command arguments
+    class ResumeParser : public Utils::TextProtocolParser {
+    private:
+        std::uint64_t parsed_actor_uid_;
+        std::uint64_t parsed_secret_;
+
     public:
         /**
-         * @brief Parses service request args from given parsed RPTL command
+         * @brief Parses resume args from given parsed RPTL command
+         *
+         * @param parsed_rptl_command Parsed RPTL `RESUME` command
          *
-         * @param parsed_rptl_command Parsed RPTL `SERVICE` command
+         * @throws BadClientMessage if parsed actor UID or secret isn't a valid unsigned integer of 64bits, or if
+         * arguments are missing or extra args are given
          */
-        explicit ServiceCommandParser(const RptlCommandParser& parsed_rptl_command);
+        explicit ResumeParser(const RptlCommandParser& parsed_rptl_command);
 
-        /// Retrieves received Service Request command
-        std::string_view serviceRequest() const;
+        /// Retrieves resumed actor UID
+        std::uint64_t actorUID() const;
+
+        /// Retrieves session secret
+        std::uint64_t secret() const;
     };
 
     /// Connected client status, providing alive/dead status and disconnection reason, if no longer alive
@@ -302,21 +355,79 @@ private:
         Utils::HandlingResult disconnectionReason;
     };
 
-    /// Registered client actor has an UID and a name
+    /// Registered client actor has an UID and a name, stored inside actors names table
     struct Actor {
         std::uint64_t uid;
-        std::string name;
+        Utils::NamesTable::NameId nameId;
+    };
+
+    /// Everything known about a connected client, so resolving its token costs a single table lookup
+    struct ClientRecord {
+        ClientStatus status;
+        // Uninitialized if unregistered
+        std::optional<Actor> actor;
+        // Remaining messages to send, same message might be sent to many clients, so using pooled ref-counted buffers
+        std::queue<MessageBuffer> remainingMessages;
+        // Remaining best-effort messages, sent after critical ones
+        std::queue<MessageBuffer> remainingBestEffortMessages;
+        // Pending roster delta offset from which changes weren't sent yet, uninitialized if ROSTER_DELTA is disabled
+        std::optional<std::size_t> rosterDeltaOffset;
+        // Secret required to resume actor session, uninitialized if SESSION is disabled
+        std::optional<std::uint64_t> sessionSecret;
+        // Time point detached actor is closed at, uninitialized if record is owned by a connection
+        std::optional<std::chrono::steady_clock::time_point> detachedUntil;
+
+        /// Retrieves remaining messages queue for given priority class
+        std::queue<MessageBuffer>& remainingMessagesFor(MessagePriority priority);
     };
 
     std::size_t actors_limit_;
-    // First value for client alive or not status; Second value uninitialized if unregistered
-    std::unordered_map<std::uint64_t, std::pair<ClientStatus, std::optional<Actor>>> connected_clients_;
+    // Storage recycled for RPTL messages, declared before clients so it outlives every queued message
+    MessagesPool messages_pool_;
+    // Each connected client record, by token
+    Utils::FlatHashMap<std::uint64_t, ClientRecord> connected_clients_;
     // Actor UID with its owner client token
-    std::unordered_map<std::uint64_t, std::uint64_t> actors_registry_;
-    // Each client stream remaining messages to send, same message might be sent to many clients, so using sharde_ptr
-    std::unordered_map<std::uint64_t, std::queue<std::shared_ptr<std::string>>> clients_remaining_messages_;
+    Utils::FlatHashMap<std::uint64_t, std::uint64_t> actors_registry_;
+    // Each registered actor name, interned so availability is checked without walking clients
+    Utils::NamesTable actor_names_;
+    // REGISTRATION command listing every registered actor, appended to as actors are registered
+    std::string registration_message_;
+    // Set when an actor is unregistered, so registration message is formatted again on next handshake
+    bool registration_message_stale_;
+    // Roster changes since last sync for clients which enabled ROSTER_DELTA, each one prefixed by a space
+    std::string pending_roster_delta_;
+    // Alive clients which enabled ROSTER_DELTA, roster changes aren't kept while there isn't any
+    std::size_t roster_delta_clients_;
     // Input events emitted waiting to be handled
     std::queue<Core::AnyInputEvent> input_events_queue_;
+    // Clients which are no longer alive since last `pollKilledClients()` call, waiting for connection to be closed
+    std::vector<std::uint64_t> killed_clients_;
+    // Protects tokens for tasks completed by workers threads since last `pushCompletedTasks()` call
+    std::mutex completed_tasks_mutex_;
+    std::vector<std::uint64_t> completed_tasks_;
+    // Pipeline stages latencies are recorded into, if any
+    Utils::PipelineLatencies* latencies_;
+    // Runtime metrics updated for clients and actors, if any
+    Utils::RuntimeMetrics* metrics_;
+    // Main loop tracer clients syncs are recorded into, if any
+    Utils::LoopTracer* tracer_;
+    // Main loop load, new handshakes being rejected while it is overloaded, if any
+    const Utils::LoadMonitor* load_;
+    // RPTL messages formatted for Executor IO interface calls are allocated from, heap if no arena is used
+    std::pmr::memory_resource* transient_resource_;
+    // Duration `spinForEvent()` polls ready handlers for before implementation blocks, `0` if busy-poll is disabled
+    std::chrono::microseconds busy_poll_window_;
+    // SERVICE commands rate for each actor, if limited
+    std::optional<RequestRateLimiter> requests_limiter_;
+    // Duration lost actors are detached for, `0` if sessions can't be resumed
+    std::chrono::milliseconds session_grace_;
+    // Records for detached actors use tokens from top of range, so they don't collide with implementation tokens
+    std::uint64_t next_detached_token_;
+    // Grace deadline and token for each detached record, earliest first. Entries for sessions resumed or closed
+    // meanwhile are dropped once they are due, so expiration doesn't scan clients registry.
+    std::priority_queue<std::pair<std::chrono::steady_clock::time_point, std::uint64_t>,
+                        std::vector<std::pair<std::chrono::steady_clock::time_point, std::uint64_t>>,
+                        std::greater<>> session_deadlines_;
 
     /**
      * @brief If input events queue isn't empty, take and retrive next event to handle
@@ -336,7 +447,7 @@ private:
      *
      * @throws std::invalid_argument if given UID or name is unavailable
      */
-    void registerActor(std::uint64_t client_token, std::uint64_t actor_uid, std::string name);
+    void registerActor(std::uint64_t client_token, std::uint64_t actor_uid, std::string_view name);
 
     /**
      * @brief Remove actor using given UID, making associated client no longer alive
@@ -349,24 +460,74 @@ private:
      * @brief Pushes given message into queue for given client
      *
      * @param client_token Client queue to be pushed
-     * @param new_message Message to push into queue
+     * @param new_message Message to push into queue, copied into pooled storage
+     * @param priority Priority class for message
      */
-    void privateMessage(std::uint64_t client_token, std::string new_message);
+    void privateMessage(std::uint64_t client_token, std::string_view new_message,
+                        MessagePriority priority = MessagePriority::Critical);
 
     /**
      * @brief Pushes given message into queue for each listed client inside UIDs set
      *
      * @param target_uids Actors owning client queues to be pushed
-     * @param new_message Message to push into queues
+     * @param new_message Message to push into queues, copied once into pooled storage
+     * @param priority Priority class for message
      */
-    void targetMessage(const std::unordered_set<std::uint64_t>& target_uids, std::string new_message);
+    void targetMessage(const Core::ActorUidsSet& target_uids, std::string_view new_message,
+                       MessagePriority priority = MessagePriority::Critical);
 
     /**
      * @brief Pushes given message into queue for each registered client
      *
-     * @param new_message Message to push into queues
+     * @param new_message Message to push into queues, copied once into pooled storage
+     * @param priority Priority class for message
+     */
+    void broadcastMessage(std::string_view new_message, MessagePriority priority = MessagePriority::Critical);
+
+    /**
+     * @brief Notifies every registered actor about given roster change, pushing message right now or appending it to
+     * pending roster delta for clients which enabled `ROSTER_DELTA`
+     *
+     * @param roster_message `LOGGED_IN` or `LOGGED_OUT` message for change
+     */
+    void broadcastRosterChange(std::string_view roster_message);
+
+    /**
+     * @brief Pushes `ROSTER_DELTA` message with pending roster changes for each client which enabled it, then clears
+     * pending changes
+     *
+     * Called by `synchronize()` before clients are synced. Message is formatted once for every client which enabled
+     * it before last sync, and shared between them.
+     */
+    void pushRosterDeltas();
+
+    /**
+     * @brief Moves actor owned by given client into a detached record for grace period, then marks client as no longer
+     * alive without closing pipeline
+     *
+     * @param client_token Alive client owning an actor which enabled `SESSION`
+     * @param disconnection_reason Reason for connection to no longer be alive
      */
-    void broadcastMessage(std::string new_message);
+    void detachActor(std::uint64_t client_token, const Utils::HandlingResult& disconnection_reason);
+
+    /**
+     * @brief Moves detached actor, or actor owned by another client, to given unregistered client with messages queued
+     * meanwhile
+     *
+     * @param client_token Alive unregistered client resuming session
+     * @param actor_uid Actor to resume session for
+     * @param secret Secret sent to actor client when it enabled `SESSION`
+     *
+     * @throws InternalError if actor isn't registered, didn't enable `SESSION` or if secret doesn't match
+     */
+    void resumeSession(std::uint64_t client_token, std::uint64_t actor_uid, std::uint64_t secret);
+
+    /**
+     * @brief Closes pipeline with every detached actor which grace period elapsed, only visiting due deadlines
+     *
+     * Called by `synchronize()` before roster changes are pushed, so clients are notified at once.
+     */
+    void closeExpiredSessions();
 
     /**
      * @brief Parses and handles received message from unregistered client
@@ -377,13 +538,13 @@ private:
      * @param client_token Client to be passed into registered mode
      * @param message Handshake data received from connected client
      *
-     * @returns Input event triggered by handshake, or null event if message is a checkout command
+     * @returns Input event triggered by handshake, or null event if message is a checkout or resume command
      *
      * @throws BadClientMessage if invoked command isn't valid connection handshake
      * @throws InternalError if invoked command is valid connection handshake but registration hasn't been done
      * (server internal state fault, example: unavailable UID)
      */
-    Core::AnyInputEvent handleFromUnregistered(std::uint64_t client_token, const std::string& message);
+    Core::AnyInputEvent handleFromUnregistered(std::uint64_t client_token, std::string_view message);
 
     /**
      * @brief Parses given received RPTL message from client with associated registered actor UID and retrieves
@@ -397,14 +558,17 @@ private:
      *
      * @throws BadClientMessage if given client message is ill-formed (missing args, unknown command...)
      */
-    Core::AnyInputEvent handleFromActor(std::uint64_t client_actor, const std::string& regular_message);
+    Core::AnyInputEvent handleFromActor(std::uint64_t client_actor, std::string_view regular_message);
 
     /**
-     * @brief Generates RPTL Registration command message from current server state
+     * @brief Retrieves RPTL Registration command message for current server state
+     *
+     * Message is kept up to date as actors are registered, and only formatted again from every client when an actor
+     * has been unregistered since last call.
      *
-     * @returns Formatted RPTL message using `REGISTRATION` command
+     * @returns Cached RPTL message using `REGISTRATION` command, valid until next registry modification
      */
-    std::string formatRegistrationMessage() const;
+    std::string_view registrationMessage();
 
 protected:
     /**
@@ -413,8 +577,12 @@ protected:
      *
      * Parsing mode (currently available commands) depends on current client connection mode (unregistered/registered).
      *
+     * Triggered event is stamped with given receive time point, if any. If latencies are recorded, message parsing
+     * duration is recorded too, and event is stamped with parsing beginning if no receive time point was given.
+     *
      * @param client_token
-     * @param client_message
+     * @param client_message Received RPTL message, only needs to be valid until this call returns
+     * @param received_at Time point message was read at, defaults to handling beginning if not provided
      *
      * @returns Event triggered by message, type must be `Core::LeftEvent`, `Core::ServiceRequestEvent`,
      * `Core::JoinedEvent` or `Core::NoneEvent` as only these events can be triggered by a client RPTL message
@@ -425,7 +593,31 @@ protected:
      * @throws InternalError if invoked command is valid but server state makes it unable to propery handles command
      * (example: unavailable new actor UID for handshake command)
      */
-    Core::AnyInputEvent handleMessage(std::uint64_t client_token, const std::string& client_message);
+    Core::AnyInputEvent handleMessage(std::uint64_t client_token, std::string_view client_message,
+                                      Utils::PipelineLatencies::Clock::time_point received_at = {});
+
+    /**
+     * @brief Retrieves histograms pipeline stages latencies are recorded into, so implementation can record write
+     * operations
+     *
+     * @returns Recorded latencies, `nullptr` if they aren't recorded
+     */
+    Utils::PipelineLatencies* latencies() const;
+
+    /**
+     * @brief Retrieves runtime metrics, so implementation can count sent bytes, queues depth and TLS handshakes
+     *
+     * @returns Updated metrics, `nullptr` if they aren't recorded
+     */
+    Utils::RuntimeMetrics* metrics() const;
+
+    /**
+     * @brief Retrieves pool every queued RPTL message is stored into, so implementation can store messages it
+     * encodes differently for some clients
+     *
+     * @returns Pool for RPTL messages, which can be used from any thread
+     */
+    MessagesPool& messagesPool();
 
     /**
      * @brief Checks if given actor UID is available or not, called before `registerActor()` to check for
@@ -440,9 +632,33 @@ protected:
     /**
      * @brief Push given triggered input event into queue
      *
+     * Event is constructed directly inside queue, so it is moved only once whether it is a specific event type or
+     * an already constructed `Core::AnyInputEvent`.
+     *
+     * @tparam InputEventT Any `Core::AnyInputEvent` alternative, or `Core::AnyInputEvent` itself
+     *
      * @param input_event Triggered input event to push
      */
-    void pushInputEvent(Core::AnyInputEvent input_event);
+    template<typename InputEventT>
+    void pushInputEvent(InputEventT&& input_event) {
+        input_events_queue_.emplace(std::forward<InputEventT>(input_event));
+    }
+
+    /**
+     * @brief Pushes `Core::TaskCompletedEvent` for each task completed since previous call, in completion order
+     *
+     * Called by `waitForInput()` and `pollInput()` when events queue is empty, and should be called by implementation
+     * once it has been woken up with `wakeForCompletedTasks()`. Must only be called by %Executor thread.
+     */
+    void pushCompletedTasks();
+
+    /**
+     * @brief Wakes up `waitForEvent()` if it is blocking, so it calls `pushCompletedTasks()`
+     *
+     * Called by worker thread each time a task has been completed, implementation must be thread-safe. Default
+     * implementation does nothing, so completed tasks are only pushed by next `waitForInput()` or `pollInput()` call.
+     */
+    virtual void wakeForCompletedTasks();
 
     /**
      * @brief Wait for external input event to happen and to be queued by running implementation asynchronous events
@@ -453,6 +669,24 @@ protected:
      */
     virtual void waitForEvent() = 0;
 
+    /**
+     * @brief Runs handlers for IO operations which have already completed, without blocking, so they might push input
+     * events
+     *
+     * Called by `pollInput()` when events queue is empty. Default implementation does nothing, so only already queued
+     * events can be polled.
+     */
+    virtual void pollReadyEvents();
+
+    /**
+     * @brief Repeatedly calls `pollReadyEvents()` until `inputReady()` evaluates to `true` or busy-poll window
+     * elapsed, so an input event is handled without paying for blocking wait wakeup
+     *
+     * Should be called by `waitForEvent()` implementation after clients have been synced and before blocking. Does
+     * nothing if busy-poll is disabled.
+     */
+    void spinForEvent();
+
     /**
      * @brief Ensures clients state are same than current server state by calling implementation-defined `syncClient
      * ()` method
@@ -504,6 +738,20 @@ protected:
      */
     void killClient(std::uint64_t client_token, const Utils::HandlingResult& disconnection_reason = {});
 
+    /**
+     * @brief Makes sure that client is no longer alive after its connection has been lost, detaching its actor instead
+     * of closing pipeline if session can be resumed
+     *
+     * Should be called by implementation for errors which don't come from client itself, like read or write failures.
+     * Behaves like `killClient()` if sessions resumption is disabled, or if client didn't enable `SESSION`.
+     *
+     * @param client_token Token for client to no longer be alive
+     * @param disconnection_reason Reason for connection loss
+     *
+     * @throws UnknownClientToken if no client is connected using given token
+     */
+    void loseClient(std::uint64_t client_token, const Utils::HandlingResult& disconnection_reason);
+
     /**
      * @brief Removes client which isn't alive
      *
@@ -514,6 +762,16 @@ protected:
      */
     void removeClient(std::uint64_t old_token);
 
+    /**
+     * @brief Retrieves every client which is no longer alive since previous call, so implementation only has to check
+     * clients which actually changed state to close their connection
+     *
+     * Clients removed with `removeClient()` before being polled aren't retrieved.
+     *
+     * @returns Tokens for clients killed since previous call, in killing order
+     */
+    std::vector<std::uint64_t> pollKilledClients();
+
     /**
      * @brief Checks if given client is alive or if its connection can be closed by implementation
      *
@@ -525,6 +783,17 @@ protected:
      */
     bool isAlive(std::uint64_t client_token) const;
 
+    /**
+     * @brief Checks if given client has already been registered as an actor with RPTL handshake
+     *
+     * @param client_token Client token to check registration for
+     *
+     * @returns `true` if an actor is registered for this client, `false` if client is still unregistered
+     *
+     * @throws UnknownClientToken if given client doesn't exist
+     */
+    bool hasActor(std::uint64_t client_token) const;
+
     /**
      * @brief Retrieves reason for given client to no longer be alive
      *
@@ -545,6 +814,103 @@ public:
      */
     explicit NetworkBackend(std::size_t actors_limit);
 
+    /**
+     * @brief Setup latencies recording for receive, parsing and write stages of pipeline
+     *
+     * Must be called before backend begins to handle clients, as IO threads might record write operations.
+     *
+     * @param latencies Histograms to record into, must outlive backend
+     */
+    void recordLatencies(Utils::PipelineLatencies& latencies);
+
+    /**
+     * @brief Setup runtime metrics for connected clients, registered actors, actors limit and network traffic
+     *
+     * Must be called before backend begins to handle clients, as IO threads might update metrics.
+     *
+     * @param metrics Metrics to update, must outlive backend
+     */
+    void recordMetrics(Utils::RuntimeMetrics& metrics);
+
+    /**
+     * @brief Setup main loop tracing for clients syncs
+     *
+     * Each `synchronize()` call is recorded as a span, as it is done by main loop thread while waiting for input.
+     *
+     * @param tracer Tracer to record spans into, must outlive backend
+     */
+    void recordTrace(Utils::LoopTracer& tracer);
+
+    /**
+     * @brief Setup load shedding, so handshakes are rejected with an error while main loop is overloaded
+     *
+     * Must be called before backend begins to handle clients, as IO threads might handle handshakes.
+     *
+     * @param load_monitor Main loop load to check for overload, must outlive backend
+     */
+    void shedLoad(const Utils::LoadMonitor& load_monitor);
+
+    /**
+     * @brief Setup arena RPTL messages are formatted into by `replyTo()`, `outputEvent()` and `closePipelineWith()`
+     * before they are copied into pooled storage
+     *
+     * Arena must be reset by Executor running main loop, as these calls are only done by its thread.
+     *
+     * @param arena Arena for transient formatted messages, must outlive backend
+     */
+    void useIterationArena(Utils::IterationArena& arena);
+
+    /**
+     * @brief Setup busy-poll, so `waitForInput()` spins on ready IO operations handlers for given window before
+     * blocking
+     *
+     * Trades Executor thread CPU time for lower wakeup latency when an input event occurs shortly after previous one
+     * has been handled. Disabled by default.
+     *
+     * @param window Maximum spinning duration each time events queue is empty, `0` disables busy-poll
+     */
+    void busyPoll(std::chrono::microseconds window);
+
+    /**
+     * @brief Pre-sizes clients and actors registries, and messages pool, for given connected clients count
+     *
+     * So registries don't grow and pool doesn't allocate slabs while first clients are connecting. Must be called
+     * from %Executor thread, usually before main loop runs.
+     *
+     * @param clients_capacity Number of clients expected to be connected simultaneously
+     */
+    void reserve(std::size_t clients_capacity);
+
+    /**
+     * @brief Setup `SERVICE` commands rate limiting for each actor
+     *
+     * Commands sent faster than limits are dropped before their SR command is parsed, without any response, and
+     * trigger a `Core::NoneEvent`. Must be called before backend begins to handle clients.
+     *
+     * @param limits Rate and burst allowed for each actor
+     *
+     * @throws std::invalid_argument if limits are invalid, see `RequestRateLimiter`
+     */
+    void limitRequests(const RequestRateLimits& limits);
+
+    /**
+     * @brief Setup sessions resumption, so actors of clients which enabled `SESSION` are kept for given grace period
+     * after their connection has been lost
+     *
+     * Disabled by default, `SESSION` is still replied to but lost actors are closed right away. Must be called before
+     * backend begins to handle clients. Grace period expiration is checked each time clients are synced.
+     *
+     * @param grace Duration lost actors are detached for, `0` disables resumption
+     */
+    void resumeSessions(std::chrono::milliseconds grace);
+
+    /**
+     * @brief Retrieves `SERVICE` commands rate limiter, with its dropped commands counters
+     *
+     * @returns Limiter if requests are limited, `nullptr` otherwise
+     */
+    const RequestRateLimiter* requestsLimiter() const;
+
     /**
      * @brief If any, poll input event inside queue. If queue is empty, wait until input event is triggered.
      *
@@ -554,6 +920,33 @@ public:
      */
     Core::AnyInputEvent waitForInput() final;
 
+    /**
+     * @brief If any, poll input event inside queue. If queue is empty, handles IO operations already completed then
+     * polls again.
+     *
+     * Clients are not synced, so messages for events handled meanwhile are sent together at next `waitForInput()`.
+     *
+     * @returns Next triggered input event, uninitialized if none is ready
+     */
+    std::optional<Core::AnyInputEvent> pollInput() final;
+
+    /**
+     * @brief Retrieves number of input events inside queue, waiting to be handled
+     *
+     * @returns Queued input events count
+     */
+    std::size_t pendingInputs() const final;
+
+    /**
+     * @brief Lists given task as completed, then wakes implementation up with `wakeForCompletedTasks()` so
+     * `Core::TaskCompletedEvent` is pushed by %Executor thread
+     *
+     * @note Thread-safe, called by worker thread which ran task.
+     *
+     * @param token Token for task which has run
+     */
+    void completeTask(std::uint64_t token) override;
+
     /**
      * @brief Unregisters actor using given UID, emits input event for player disconnection and syncs clients about
      * player disconnection sending appropriate messages
@@ -573,7 +966,7 @@ public:
      *
      * @throws UnknownActorUID if given actor doesn't exist
      */
-    void replyTo(std::uint64_t sr_actor, const std::string &sr_response) final;
+    void replyTo(std::uint64_t sr_actor, std::string sr_response) final;
 
     /**
      * @brief Calls RPTL implementation to send given SE formatted for RPTL protocol
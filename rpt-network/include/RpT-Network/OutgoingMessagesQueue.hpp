@@ -0,0 +1,172 @@
+#ifndef RPT_MINIGAMES_SERVER_OUTGOINGMESSAGESQUEUE_HPP
+#define RPT_MINIGAMES_SERVER_OUTGOINGMESSAGESQUEUE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <RpT-Network/MessagesPool.hpp>
+#include <RpT-Network/MessagesQueueView.hpp>
+
+/**
+ * @file OutgoingMessagesQueue.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Watermarks for RPTL messages waiting to be sent to a client, in messages count and in bytes
+ *
+ * Above low watermark, client is considered congested. Above high watermark, client isn't reading fast enough to keep
+ * server memory bounded and queue refuses new messages.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct OutgoingQueueLimits {
+    /// Queued messages count above which client is congested
+    std::size_t lowMessages { 256 };
+    /// Queued bytes above which client is congested
+    std::size_t lowBytes { 256 * 1024 };
+    /// Queued messages count above which queue overflows
+    std::size_t highMessages { 4096 };
+    /// Queued bytes above which queue overflows
+    std::size_t highBytes { 4 * 1024 * 1024 };
+};
+
+
+/**
+ * @brief How many times clients outgoing queues reached their watermarks
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct BackpressureStats {
+    /// Times a client queue went above its low watermark
+    std::uint64_t congestions { 0 };
+    /// Clients evicted because their queue went above high watermark
+    std::uint64_t evictions { 0 };
+    /// Best-effort messages dropped because their client was congested
+    std::uint64_t droppedMessages { 0 };
+};
+
+
+/**
+ * @brief RPTL messages waiting to be sent to a client, bounded by `OutgoingQueueLimits` watermarks
+ *
+ * Congestion uses hysteresis: once low watermark is exceeded, queue is congested until both messages count and bytes
+ * are back under low watermark.
+ *
+ * Messages are queued inside a lane for their `MessagePriority`: critical messages are popped before best-effort ones,
+ * order being kept inside each lane. Best-effort messages are never queued above low watermark, so they are dropped
+ * before any critical message can be refused.
+ *
+ * Each message is stamped when queued, so time it waited before being written can be measured.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class OutgoingMessagesQueue {
+public:
+    /// Result for a message pushed into queue
+    enum struct PushResult {
+        /// Message queued
+        Queued,
+        /// Message queued, and queue has just exceeded its low watermark
+        Congested,
+        /// Message refused as it would exceed high watermark
+        Overflowed,
+        /// Best-effort message refused as queue is congested or it would exceed low watermark
+        Dropped
+    };
+
+private:
+    /// Queued messages of a same priority class
+    struct Lane {
+        std::queue<MessageBuffer> messages;
+        // Time point each queued message was pushed at, same order than messages
+        std::queue<std::chrono::steady_clock::time_point> queuedAt;
+    };
+
+    OutgoingQueueLimits limits_;
+    Lane critical_lane_;
+    Lane best_effort_lane_;
+    std::size_t bytes_;
+    bool congested_;
+
+    /// Clears congestion if queue went back under low watermark
+    void updateCongestion();
+
+public:
+    /**
+     * @brief Constructs empty queue bounded by given watermarks
+     *
+     * @param limits Watermarks for this queue
+     */
+    explicit OutgoingMessagesQueue(const OutgoingQueueLimits& limits = {});
+
+    /**
+     * @brief Queues given message if watermarks allow it
+     *
+     * @param message RPTL message to queue
+     * @param priority Lane to queue message into
+     *
+     * @returns `PushResult::Overflowed` if critical message was refused, `PushResult::Dropped` if best-effort message
+     * was refused, `PushResult::Congested` if low watermark has just been exceeded, `PushResult::Queued` otherwise
+     */
+    PushResult push(MessageBuffer message, MessagePriority priority = MessagePriority::Critical);
+
+    /**
+     * @brief Removes and retrieves oldest queued critical message, or oldest best-effort one if there isn't any
+     *
+     * @returns Next RPTL message to send, empty handle if queue is empty
+     */
+    MessageBuffer pop();
+
+    /**
+     * @brief Removes and retrieves every queued message
+     *
+     * @returns Queued critical RPTL messages from oldest to newest, followed by best-effort ones
+     */
+    std::queue<MessageBuffer> popAll();
+
+    /**
+     * @brief Retrieves time point oldest queued message, from any lane, was pushed at
+     *
+     * @returns Oldest message push time point, default-constructed time point if queue is empty
+     */
+    std::chrono::steady_clock::time_point frontQueuedAt() const;
+
+    /**
+     * @brief Checks if queue is empty
+     *
+     * @returns `true` if there isn't any queued message
+     */
+    bool empty() const;
+
+    /**
+     * @brief Retrieves queued messages count
+     *
+     * @returns Number of queued messages
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Retrieves queued messages total size
+     *
+     * @returns Sum of every queued message size, in bytes
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief Checks if queue is congested
+     *
+     * @returns `true` if low watermark has been exceeded and queue hasn't gone back under it yet
+     */
+    bool congested() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_OUTGOINGMESSAGESQUEUE_HPP
@@ -0,0 +1,285 @@
+#ifndef RPT_MINIGAMES_SERVER_RAWTCPBACKEND_HPP
+#define RPT_MINIGAMES_SERVER_RAWTCPBACKEND_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <RpT-Network/NetworkBackend.hpp>
+#include <RpT-Network/OutgoingMessagesQueue.hpp>
+#include <RpT-Network/TimerWheel.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+/**
+ * @file RawTcpBackend.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Thrown by `RawTcpBackend` constructor if listening socket couldn't be taken over from predecessor process
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class HandoffError : public std::runtime_error {
+public:
+    /**
+     * @brief Constructs error with given reason
+     *
+     * @param reason Why listening socket couldn't be received
+     */
+    explicit HandoffError(const std::string& reason) : std::runtime_error { "Listener handoff failed: " + reason } {}
+};
+
+
+/**
+ * @brief Tuning options for `RawTcpBackend`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct RawTcpBackendOptions {
+    /// Watermarks for RPTL messages waiting to be sent to each client, a client exceeding high watermark is evicted
+    OutgoingQueueLimits outgoingLimits {};
+    /// Maximum length for a received RPTL message, a client announcing a longer frame is disconnected
+    std::size_t maxMessageSize { 64 * 1024 };
+    /// Unix socket path a successor process connects to so it takes listening socket over, empty to disable handoff
+    std::string handoffPath {};
+    /// Unix socket path of a predecessor process listening socket is taken over from instead of binding local
+    /// endpoint, empty to bind it
+    std::string takeOverPath {};
+    /// Once listening socket has been handed off, remaining clients are closed after this delay, 0 to wait for all of
+    /// them to leave
+    std::chrono::seconds drainTimeout { 0 };
+};
+
+
+/**
+ * @brief IO interface implementation exchanging RPTL messages inside length-prefixed frames over plain TCP connections
+ *
+ * Designed for trusted internal clients like bots or gateways, where Websocket handshake, framing and masking are
+ * pure overhead. Each RPTL message is preceded by its length in bytes as a 4 bytes big-endian unsigned integer, so
+ * RPTL semantics are exactly the same as for Websocket backends.
+ *
+ * Every connection is run by Executor thread. Received bytes are read by chunks, so many frames sent at once are
+ * handled with a single read. Queued RPTL messages for a client are all sent with a single gathered write.
+ *
+ * On Unix, a new server process can be deployed without interrupting matches in progress. Running backend waits on
+ * `RawTcpBackendOptions::handoffPath` for a successor, which is constructed with same path as
+ * `RawTcpBackendOptions::takeOverPath`. Listening socket is passed to successor, which accepts new connections
+ * right away, while running backend stops accepting and drains: it keeps serving connected clients, then closes
+ * itself once all of them left or once drain timeout expired. Rooms state isn't transferred, so only new matches are
+ * hosted by successor.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class RawTcpBackend : public NetworkBackend {
+public:
+    /// Number of bytes preceding each RPTL message, containing its length
+    static constexpr std::size_t FRAME_HEADER_SIZE { 4 };
+
+    /// Big-endian length for next RPTL message
+    using FrameHeader = std::array<char, FRAME_HEADER_SIZE>;
+
+    /**
+     * @brief Encodes frame header for RPTL message of given length
+     *
+     * @param message_length RPTL message length in bytes, must fit into 32 bits
+     *
+     * @returns Length as 4 bytes big-endian unsigned integer
+     */
+    static FrameHeader frameHeader(std::size_t message_length);
+
+    /**
+     * @brief Decodes RPTL message length from frame header
+     *
+     * @param header Beginning of `FRAME_HEADER_SIZE` bytes frame header
+     *
+     * @returns Length in bytes for RPTL message following header
+     */
+    static std::size_t frameLength(const char* header);
+
+private:
+    /// TCP connection with a client, with its own RPTL messages pipeline so clients are synced independently
+    struct ClientConnection {
+        boost::asio::ip::tcp::socket socket;
+        // Received bytes which haven't been handled yet, beginning with next frame header
+        std::vector<char> readBuffer;
+        std::size_t bufferedBytes;
+        OutgoingMessagesQueue remainingMessages;
+        bool sending;
+        // Removed from registry, socket is shut down once remaining messages have been sent
+        bool closing;
+        // Queue overflowed and client is being killed, no more message is queued
+        bool evicted;
+    };
+
+    /// RPTL messages sent with a single gathered write, kept alive until write operation completed
+    struct SentFrames {
+        std::vector<MessageBuffer> messages;
+        std::vector<FrameHeader> headers;
+        std::vector<boost::asio::const_buffer> buffers;
+    };
+
+    /// Unix socket successor process connects to, defined for Unix platform only
+    struct HandoffListener;
+
+    static std::vector<int> getCaughtSignals();
+
+    // Provides logging features
+    Utils::LoggerView logger_;
+    // Watermarks for messages waiting to be sent to each client
+    const OutgoingQueueLimits outgoing_limits_;
+    // Longer frames received from a client result into its disconnection
+    const std::size_t max_message_size_;
+    // Congested and evicted clients counters
+    BackpressureStats backpressure_stats_;
+    // Provides running context for every async operation: connections, timers and signals
+    boost::asio::io_context async_io_context_;
+    // Runs every timer countdown with a single Asio timer
+    AsioTimerWheel timers_wheel_;
+    // TCP connection and outgoing messages pipeline for each client token
+    std::unordered_map<std::uint64_t, std::shared_ptr<ClientConnection>> clients_connection_;
+    // Posix signals handling to stop server
+    boost::asio::signal_set stop_signals_handling_;
+    // Provides incoming TCP connections
+    boost::asio::ip::tcp::acceptor tcp_acceptor_;
+    // Keep total clients count so an unique token can be given to each new client
+    std::uint64_t tokens_count_;
+    // Waits for a successor to hand listening socket off to, uninitialized if handoff is disabled or already done
+    std::unique_ptr<HandoffListener> handoff_listener_;
+    // Remaining clients are closed after it, once listening socket has been handed off
+    const std::chrono::seconds drain_timeout_;
+    boost::asio::steady_timer drain_timer_;
+    // Listening socket has been handed off, backend closes itself once no client is connected anymore
+    bool draining_;
+
+    /// Tries to get string representation for TCP socket remote endpoint, `"UNKNOWN"` if it fails
+    static std::string endpointFor(const boost::asio::ip::tcp::socket& client_connection);
+
+    /// Checks if given client connection is still inside registry
+    bool isConnected(std::uint64_t client_token) const;
+
+    /// Accepts next incoming TCP connection, registers it as a new client then waits for next connection again
+    void waitNextClient();
+
+    /// Reads next available bytes from given client, then handles every complete frame received
+    void listenMessagesFrom(std::uint64_t client_token, const std::shared_ptr<ClientConnection>& connection);
+
+    /**
+     * @brief Handles every complete frame inside read buffer, stopping if client is killed
+     *
+     * @param client_token Token for client messages were received from
+     * @param connection Connection containing received bytes
+     *
+     * @returns `true` if client is still alive and must be listened again, `false` otherwise
+     */
+    bool handleReceivedFrames(std::uint64_t client_token, ClientConnection& connection);
+
+    /// Handles one received RPTL message, any error resulting in client being killed
+    void handleReceivedMessage(std::uint64_t client_token, std::string_view rptl_message);
+
+    /// Sends every queued message for given client with one gathered write, handler sends next messages recursively
+    void sendRemainingMessages(std::uint64_t client_token, const std::shared_ptr<ClientConnection>& connection);
+
+    /// Removes given killed client, its connection is shut down once already queued messages have been sent
+    void closeConnection(std::uint64_t client_token);
+
+    /// Shuts down then closes given connection socket, which must no longer be inside registry
+    static void shutdownConnection(ClientConnection& connection);
+
+    /// Closes killed clients connections, then closes backend if it is draining and no client is connected anymore
+    void closeDeadConnections();
+
+    /// Accepts next successor connection on handoff Unix socket, then passes listening socket to it
+    void waitSuccessor();
+
+    /// Stops accepting connections, then closes backend when remaining clients left or when drain timeout expires
+    void beginDraining();
+
+protected:
+    /// Appends flushed messages to client pipeline, evicting client if its queue overflowed
+    void syncClient(std::uint64_t client_token, MessagesQueueView client_messages_queue) final;
+
+    /// Runs next Asio asynchronous operations handler until input events queue is no longer empty
+    void waitForEvent() final;
+
+    /// Closes killed clients connections, then runs every ready asynchronous IO operation handler
+    void pollReadyEvents() final;
+
+    /// Posts completed tasks pushing into Asio events loop, interrupting its wait
+    void wakeForCompletedTasks() final;
+
+public:
+    /**
+     * @brief Constructs IO interface listening for new TCP connections on given local endpoint
+     *
+     * In addition to that, constructor will initialize an Asio signal set listening for `SIGINT` and `SIGTERM` to
+     * close IO interface when required.
+     *
+     * @param local_endpoint Endpoint clients will connect to
+     * @param logging_context Context for TCP backend logging features
+     * If `RawTcpBackendOptions::takeOverPath` is given, constructor blocks until predecessor passed its listening
+     * socket, and local endpoint is ignored.
+     *
+     * @param options Tuning options for connections handling
+     * @param players_limit Maximum number of actors registered simultaneously
+     *
+     * @throws HandoffError if listening socket couldn't be taken over from predecessor
+     */
+    explicit RawTcpBackend(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                           Utils::LoggingContext& logging_context, const RawTcpBackendOptions& options = {},
+                           std::size_t players_limit = 2);
+
+    /// Defined where handoff listener type is complete
+    ~RawTcpBackend() override;
+
+    /**
+     * @brief Retrieves port acceptor is listening on, useful if it was chosen by system
+     *
+     * @returns Local port for incoming connections
+     */
+    std::uint16_t localPort() const;
+
+    /**
+     * @brief Retrieves how many times clients outgoing queues reached their watermarks
+     *
+     * @returns Backpressure counters since backend was constructed
+     */
+    const BackpressureStats& backpressureStats() const;
+
+    /**
+     * @brief Checks if listening socket has been handed off to a successor process
+     *
+     * @returns `true` if backend no longer accepts connections and waits for remaining clients to leave
+     */
+    bool draining() const;
+
+    /**
+     * @brief Set Ready timer state to Pending, then schedules its countdown inside timers wheel, driven by a single
+     * Asio steady timer
+     */
+    void beginTimer(Core::Timer& ready_timer) final;
+
+    /**
+     * @brief Closes all opened TCP connections, stops handling asynchronous IO operations, then mark IO interface as
+     * closed
+     */
+    void close() final;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_RAWTCPBACKEND_HPP
@@ -0,0 +1,101 @@
+#ifndef RPT_MINIGAMES_SERVER_REQUESTRATELIMITER_HPP
+#define RPT_MINIGAMES_SERVER_REQUESTRATELIMITER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * @file RequestRateLimiter.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Rate at which each actor is allowed to send `SERVICE` commands
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct RequestRateLimits {
+    /// Commands allowed for each second, on average
+    double requestsPerSecond { 20 };
+    /// Commands which can be sent at once after an idle period
+    std::uint64_t burst { 40 };
+};
+
+
+/**
+ * @brief Token bucket for each actor, refilled at a constant rate, so actors cannot send commands faster than limits
+ *
+ * Each actor bucket is created full at its first command, and is refilled lazily when it is checked, so idle actors
+ * cost nothing. Commands which don't find any token are counted as dropped, for each actor and in total.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class RequestRateLimiter {
+public:
+    /// Clock used to refill buckets
+    using Clock = std::chrono::steady_clock;
+
+private:
+    /// Available tokens for an actor, with commands it sent without any token
+    struct Bucket {
+        double tokens;
+        Clock::time_point refilled_at;
+        std::uint64_t dropped;
+    };
+
+    const RequestRateLimits limits_;
+    std::unordered_map<std::uint64_t, Bucket> buckets_;
+    std::uint64_t dropped_;
+
+public:
+    /**
+     * @brief Constructs limiter without any actor bucket
+     *
+     * @param limits Refill rate and capacity for each actor bucket
+     *
+     * @throws std::invalid_argument if rate isn't positive or if burst is 0
+     */
+    explicit RequestRateLimiter(const RequestRateLimits& limits);
+
+    /**
+     * @brief Takes a token from given actor bucket, if any
+     *
+     * @param actor Actor sending a command
+     * @param now Time point command was received at
+     *
+     * @returns `true` if command is allowed, `false` if it must be dropped
+     */
+    bool allow(std::uint64_t actor, Clock::time_point now);
+
+    /**
+     * @brief Removes given actor bucket, so next actor using same UID begins with a full bucket
+     *
+     * @param actor Unregistered actor
+     */
+    void forget(std::uint64_t actor);
+
+    /// Retrieves limits applied to each actor
+    const RequestRateLimits& limits() const;
+
+    /// Retrieves commands dropped until now, for every actor
+    std::uint64_t dropped() const;
+
+    /**
+     * @brief Retrieves commands dropped for given actor since it has been registered
+     *
+     * @param actor Actor to retrieve dropped commands for
+     *
+     * @returns Dropped commands count, 0 if actor doesn't have any bucket
+     */
+    std::uint64_t droppedFor(std::uint64_t actor) const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_REQUESTRATELIMITER_HPP
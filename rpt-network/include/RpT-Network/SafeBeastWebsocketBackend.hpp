@@ -1,8 +1,16 @@
 #ifndef RPTOGETHER_SERVER_SAFEBEASTWEBSOCKETBACKEND_HPP
 #define RPTOGETHER_SERVER_SAFEBEASTWEBSOCKETBACKEND_HPP
 
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <boost/beast/ssl.hpp>
 #include <RpT-Network/BeastWebsocketBackendBase.inl>
+#include <RpT-Network/TlsTicketKeys.hpp>
 
 /**
  * @file SafeBeastWebsocketBackend.hpp
@@ -12,15 +20,82 @@
 namespace RpT::Network {
 
 
+/**
+ * @brief TLS handshakes done by `SafeBeastWebsocketBackend`, showing how many full handshakes were saved by sessions
+ * resumption
+ *
+ * Durations are summed for each kind of handshake, from TLS layer opening to handshake completion.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct TlsHandshakeStats {
+    /// Handshakes which resumed a session from cache or from a ticket
+    std::uint64_t resumedHandshakes { 0 };
+    /// Handshakes which negotiated a new session
+    std::uint64_t fullHandshakes { 0 };
+    /// Handshakes which failed
+    std::uint64_t failedHandshakes { 0 };
+    /// Total time spent by resumed handshakes
+    std::chrono::microseconds resumedDuration { 0 };
+    /// Total time spent by full handshakes
+    std::chrono::microseconds fullDuration { 0 };
+};
+
+
 /**
  * @brief Implementation for secure HTTPS using SSL TCP underlying stream
  *
+ * TLS sessions can be resumed by reconnecting clients, using a server-side sessions cache and session tickets
+ * encrypted with periodically rotated keys.
+ *
+ * Certificate and private key are loaded by a background thread, so server setup isn't delayed by files reading and
+ * key parsing. Connections accepted meanwhile wait for TLS context before their handshake begins, and
+ * `waitTlsContext()` reports a loading error.
+ *
+ * Certificate can be rotated without restarting: `reloadTlsContext()`, also called when `SIGUSR2` is received on Unix,
+ * loads same files into a new context used by next handshakes. Open connections keep context they were opened with,
+ * and sessions tickets issued before remain valid as ticket keys are shared by every context.
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class SafeBeastWebsocketBackend : public BeastWebsocketBackendBase<boost::beast::ssl_stream<boost::beast::tcp_stream>> {
 private:
-    // Context providing crypto TLS features
-    boost::asio::ssl::context tls_context_;
+    // Keys for session tickets issued by TLS contexts, must outlive them
+    TlsTicketKeys ticket_keys_;
+    // PEM files loaded again each time TLS context is reloaded
+    const std::string certificate_file_;
+    const std::string private_key_file_;
+    // Sessions settings applied to each new TLS context
+    const std::size_t tls_session_cache_size_;
+    const bool tls_tickets_;
+    const std::chrono::seconds tls_ticket_key_rotation_;
+    // Protects current context, replaced by Executor thread while connections might be opened by IO threads
+    mutable std::mutex tls_context_lock_;
+    // Context providing crypto TLS features to new connections, null until first one has been loaded
+    std::shared_ptr<boost::asio::ssl::context> tls_context_;
+    // First context loading, must be destroyed first so loading is done before members it uses are destroyed
+    std::shared_future<void> tls_context_loaded_;
+    // Contexts successfully loaded after first one
+    std::size_t tls_context_reloads_;
+    // Reloads TLS context when received, handled by Executor thread
+    boost::asio::signal_set reload_signals_;
+    // Time given to a client for completing TLS handshake, 0 if unlimited
+    const std::chrono::milliseconds tls_handshake_timeout_;
+    // Handshakes statistics, only accessed from Executor thread
+    TlsHandshakeStats handshake_stats_;
+
+    /// Builds a new TLS context with sessions settings, then loads certificate and private key into it, throws
+    /// `boost::system::system_error` if loading failed
+    std::shared_ptr<boost::asio::ssl::context> newTlsContext();
+
+    /// Waits for first TLS context to be loaded, then retrieves current one, null if loading failed
+    std::shared_ptr<boost::asio::ssl::context> currentTlsContext() const;
+
+    /// Waits for next reload signal, then reloads TLS context
+    void waitReloadSignal();
+
+    /// Records handshake result into statistics, must be called from Executor thread
+    void recordHandshake(const std::string& remote_endpoint, bool resumed, std::chrono::microseconds duration);
 
     /// Takes Websocket stream from `openWebsocketStream()` implementation to call `openSafeWebsocketLayer()` with open
     /// SSL layer
@@ -38,16 +113,57 @@ public:
     /**
      * @brief Calls superclass constructor then initializes TLS features with given config files paths
      *
+     * Files are loaded in background, see `waitTlsContext()`.
+     *
      * @param certificate_file Path to PEM certificate file
      * @param private_key_file Path to PEM private key file
      * @param local_endpoint Local server endpoint to be listening on
      * @param logging_context Context providing logging features
+     * @param options Tuning options for connections handling and TLS sessions resumption
+     * @param players_limit Maximum number of actors registered simultaneously
      *
-     * @throws boost::system::system_error Error thrown by TLS features initialization
+     * @throws TicketKeyGenerationFailed if first session tickets key cannot be generated
      */
     SafeBeastWebsocketBackend(const std::string& certificate_file, const std::string& private_key_file,
                               const boost::asio::ip::tcp::endpoint& local_endpoint,
-                              Utils::LoggingContext& logging_context);
+                              Utils::LoggingContext& logging_context,
+                              const BeastWebsocketBackendOptions& options = {}, std::size_t players_limit = 2);
+
+    /// Stops IO threads before TLS context and ticket keys they might be using are destroyed
+    ~SafeBeastWebsocketBackend() override;
+
+    /**
+     * @brief Blocks until certificate and private key have been loaded into TLS context
+     *
+     * Connections are accepted before, but they can't be secured if loading failed, so server should be stopped.
+     *
+     * @throws boost::system::system_error Error thrown by certificate or private key loading
+     */
+    void waitTlsContext() const;
+
+    /**
+     * @brief Loads certificate and private key files again into a new TLS context, used by every next handshake
+     *
+     * Open connections keep context they were opened with. If loading fails, current context is kept. Must be called
+     * from Executor thread.
+     *
+     * @returns `true` if new context is used, `false` if loading failed
+     */
+    bool reloadTlsContext();
+
+    /**
+     * @brief Retrieves number of TLS contexts successfully loaded by `reloadTlsContext()`
+     *
+     * @returns Successful reloads count
+     */
+    std::size_t tlsContextReloads() const;
+
+    /**
+     * @brief Retrieves TLS handshakes statistics since backend was constructed, must be called from Executor thread
+     *
+     * @returns Statistics for every handshake done
+     */
+    const TlsHandshakeStats& tlsHandshakeStats() const;
 };
 
 
@@ -0,0 +1,219 @@
+#ifndef RPT_MINIGAMES_SERVER_TIMERWHEEL_HPP
+#define RPT_MINIGAMES_SERVER_TIMERWHEEL_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <RpT-Core/Timer.hpp>
+
+/**
+ * @file TimerWheel.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Hierarchical timing wheel scheduling timer tokens at millisecond ticks deadlines
+ *
+ * Each level is a ring of `SLOTS` slots, a slot of level `n` covering `SLOTS^n` ticks. A token is put inside the
+ * lowest level which covers its deadline, then cascades to lower levels as time goes on, so scheduling and cancelling
+ * are both constant time whatever the number of scheduled tokens. Deadlines further than every level are kept inside
+ * top level until they get close enough.
+ *
+ * Entries are stored inside a pool reused once they expire or are cancelled, so no allocation happens as long as
+ * scheduled tokens count doesn't grow.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class TimerWheel {
+public:
+    /// Bits for slot index inside a level
+    static constexpr unsigned SLOT_BITS { 6 };
+    /// Number of slots for each level
+    static constexpr std::uint64_t SLOTS { 1 << SLOT_BITS };
+    /// Number of levels, covering `SLOTS^LEVELS` ticks (about 4 hours 40 minutes with 1 ms ticks)
+    static constexpr unsigned LEVELS { 4 };
+
+private:
+    /// Index for entry which doesn't exist, ending slot lists
+    static constexpr std::uint32_t NO_ENTRY { UINT32_MAX };
+
+    /// Scheduled token, linked with other tokens inside same slot
+    struct Entry {
+        std::uint64_t token;
+        std::uint64_t deadline;
+        std::uint32_t previous;
+        std::uint32_t next;
+        // Slot this entry is linked into, or next free entry if in free list
+        std::uint32_t slot;
+    };
+
+    /// Retrieves slot index inside given level for given tick
+    static std::uint32_t slotIndex(unsigned level, std::uint64_t tick);
+
+    // Next tick to be handled, every deadline before it has expired
+    std::uint64_t current_tick_;
+    // Entries pool, first free entry chains with other free entries
+    std::vector<Entry> entries_;
+    std::uint32_t first_free_entry_;
+    // First entry for each slot, all levels concatenated
+    std::array<std::uint32_t, SLOTS * LEVELS> slots_;
+    // Scheduled entries count for each level, so empty levels can be skipped
+    std::array<std::size_t, LEVELS> levels_size_;
+    // Entry for each scheduled token
+    std::unordered_map<std::uint64_t, std::uint32_t> scheduled_entries_;
+
+    /// Links given entry into slot covering its deadline
+    void link(std::uint32_t entry_index);
+
+    /// Unlinks given entry from its slot, without freeing it
+    void unlink(std::uint32_t entry_index);
+
+    /// Unlinks, then gives back given entry to pool and forgets its token
+    void release(std::uint32_t entry_index);
+
+    /// Moves every entry from current slot of given level to lower levels, cascading higher levels first if required
+    void cascade(unsigned level);
+
+public:
+    /**
+     * @brief Constructs empty wheel, beginning at given tick
+     *
+     * @param current_tick First tick to be handled
+     */
+    explicit TimerWheel(std::uint64_t current_tick = 0);
+
+    /**
+     * @brief Schedules given token to expire at given deadline, expiring at next advance if deadline has already passed
+     *
+     * @param token Token to schedule, must not be scheduled already
+     * @param deadline Tick at which token expires
+     *
+     * @throws std::invalid_argument if given token is already scheduled
+     */
+    void schedule(std::uint64_t token, std::uint64_t deadline);
+
+    /**
+     * @brief Cancels given token if it is scheduled
+     *
+     * @param token Token to cancel
+     *
+     * @returns `true` if token was scheduled, `false` if it has already expired or has never been scheduled
+     */
+    bool cancel(std::uint64_t token);
+
+    /**
+     * @brief Expires every token with a deadline until given tick, inclusively, in deadline order
+     *
+     * Tokens with same deadline expire in any order. Handler may schedule or cancel tokens.
+     *
+     * @tparam Handler Callable object with a `std::uint64_t` argument
+     *
+     * @param tick Tick to handle tokens until, nothing happens if it is before current tick
+     * @param handler Called with each expired token
+     */
+    template<typename Handler>
+    void advance(const std::uint64_t tick, Handler&& handler) {
+        while (current_tick_ <= tick) {
+            if (slotIndex(0, current_tick_) == 0) // Lowest level wrapped, next entries come from higher levels
+                cascade(1);
+
+            // Handler might schedule new entries into this slot, they also expire as their deadline has passed
+            std::uint32_t& expired_slot { slots_[slotIndex(0, current_tick_)] };
+            while (expired_slot != NO_ENTRY) {
+                const std::uint64_t expired_token { entries_[expired_slot].token };
+
+                release(expired_slot);
+                handler(expired_token);
+            }
+
+            if (levels_size_[0] == 0) // Nothing to expire until next cascade, but time must not go past given tick
+                current_tick_ = std::min((current_tick_ | (SLOTS - 1)) + 1, tick + 1);
+            else
+                current_tick_++;
+        }
+    }
+
+    /**
+     * @brief Retrieves tick at which wheel must be advanced next, either for a token to expire or for higher levels to
+     * cascade
+     *
+     * @returns Next tick to advance to, uninitialized if no token is scheduled
+     */
+    std::optional<std::uint64_t> nextTick() const;
+
+    /**
+     * @brief Retrieves next tick to be handled
+     *
+     * @returns Tick after last advanced one
+     */
+    std::uint64_t currentTick() const;
+
+    /**
+     * @brief Retrieves number of scheduled tokens
+     *
+     * @returns Tokens which haven't expired nor been cancelled yet
+     */
+    std::size_t size() const;
+};
+
+
+/**
+ * @brief Runs `Core::Timer` countdowns with a `TimerWheel` driven by a single Asio steady timer, so beginning or
+ * cancelling a countdown doesn't allocate any Asio timer
+ *
+ * Wheel ticks are milliseconds elapsed since construction. Steady timer is only rescheduled if next tick is earlier
+ * than the one it is already waiting for.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class AsioTimerWheel {
+private:
+    const std::chrono::steady_clock::time_point origin_;
+    TimerWheel wheel_;
+    boost::asio::steady_timer wheel_timer_;
+    // Tick steady timer will expire at, uninitialized if it isn't waiting
+    std::optional<std::uint64_t> armed_tick_;
+    // Called with each timer token once its countdown is done
+    std::function<void(std::uint64_t)> trigger_handler_;
+
+    /// Retrieves milliseconds elapsed since construction
+    std::uint64_t now() const;
+
+    /// Waits for next wheel tick, if steady timer isn't already waiting for an earlier one
+    void arm();
+
+    /// Advances wheel until now, then waits again
+    void expire();
+
+public:
+    /**
+     * @brief Constructs wheel without any countdown, driven by given context
+     *
+     * @param io_context Context running steady timer handler
+     * @param trigger_handler Called from context with timer token each time a countdown is done
+     */
+    AsioTimerWheel(boost::asio::io_context& io_context, std::function<void(std::uint64_t)> trigger_handler);
+
+    /**
+     * @brief Set Ready timer state to Pending, then schedules its countdown, cancelled if timer is cleared
+     *
+     * @param ready_timer Timer to begin countdown for
+     */
+    void beginTimer(Core::Timer& ready_timer);
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_TIMERWHEEL_HPP
@@ -0,0 +1,143 @@
+#ifndef RPT_MINIGAMES_SERVER_TLSTICKETKEYS_HPP
+#define RPT_MINIGAMES_SERVER_TLSTICKETKEYS_HPP
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <openssl/ssl.h>
+
+/**
+ * @file TlsTicketKeys.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Thrown by `TlsTicketKeys` if OpenSSL is unable to generate random key material
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class TicketKeyGenerationFailed : public std::runtime_error {
+public:
+    /**
+     * @brief Constructs exception with basic error message
+     */
+    TicketKeyGenerationFailed() : std::runtime_error { "Unable to generate random TLS session ticket key" } {}
+};
+
+
+/**
+ * @brief Rotating keys used to encrypt and authenticate TLS session tickets, so clients can resume sessions without
+ * server having to store them
+ *
+ * A new key is generated once current one is older than rotation period. Previous key remains valid for decryption
+ * during one more period, so tickets issued just before a rotation can still be used. A ticket decrypted with previous
+ * key is renewed using current one.
+ *
+ * Keys are accessed from connections handshakes, which might be run by IO threads, so access is guarded by a mutex.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class TlsTicketKeys {
+public:
+    /// Size in bytes for key name, required by OpenSSL ticket format
+    static constexpr std::size_t NAME_LENGTH { 16 };
+    /// Size in bytes for AES-256 encryption key
+    static constexpr std::size_t AES_KEY_LENGTH { 32 };
+    /// Size in bytes for HMAC-SHA256 authentication key
+    static constexpr std::size_t HMAC_KEY_LENGTH { 32 };
+
+    /// Material required to encrypt or to decrypt a session ticket
+    struct Key {
+        /// Identifies key inside issued tickets
+        std::array<unsigned char, NAME_LENGTH> name;
+        /// Ticket encryption key
+        std::array<unsigned char, AES_KEY_LENGTH> aesKey;
+        /// Ticket authentication key
+        std::array<unsigned char, HMAC_KEY_LENGTH> hmacKey;
+    };
+
+    /// Key found to decrypt a received ticket
+    struct DecryptionKey {
+        /// Key ticket was encrypted with
+        Key key;
+        /// `true` if ticket was encrypted with previous key, so a new ticket should be issued
+        bool renew;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const std::chrono::seconds rotation_period_;
+    std::mutex keys_access_;
+    Key current_key_;
+    std::optional<Key> previous_key_;
+    Clock::time_point current_key_creation_;
+
+    /// OpenSSL callback providing ticket encryption (`enc == 1`) or decryption (`enc == 0`) context
+    static int ticketKeyCallback(SSL* connection, unsigned char* key_name, unsigned char* iv,
+                                 EVP_CIPHER_CTX* cipher_context, EVP_MAC_CTX* hmac_context, int enc);
+
+    /// Generates a new random key, throws `TicketKeyGenerationFailed` if OpenSSL random generator fails
+    static Key generateKey();
+
+    /// Rotates keys if current one has expired at given time point, `keys_access_` must be locked
+    void rotateIfExpired(Clock::time_point now);
+
+public:
+    /**
+     * @brief Initializes keys with a new random current key and no previous key
+     *
+     * @param rotation_period Time after which a new key is used to encrypt tickets
+     *
+     * @throws TicketKeyGenerationFailed if OpenSSL is unable to generate key
+     */
+    explicit TlsTicketKeys(std::chrono::seconds rotation_period);
+
+    /// Keys might be used by an OpenSSL context callback, so instance must not move
+    TlsTicketKeys(const TlsTicketKeys&) = delete;
+    /// Keys might be used by an OpenSSL context callback, so instance must not move
+    TlsTicketKeys& operator=(const TlsTicketKeys&) = delete;
+
+    /**
+     * @brief Retrieves key to encrypt a new ticket with, rotating keys if current one has expired
+     *
+     * @param now Time point used to check for key expiration
+     *
+     * @returns Current key
+     *
+     * @throws TicketKeyGenerationFailed if keys had to be rotated but OpenSSL is unable to generate new key
+     */
+    Key encryptionKey(Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Retrieves key to decrypt a received ticket with, rotating keys if current one has expired
+     *
+     * @param key_name Name found inside received ticket, must be `NAME_LENGTH` bytes long
+     * @param now Time point used to check for key expiration
+     *
+     * @returns Key with given name if it is still valid, uninitialized otherwise
+     *
+     * @throws TicketKeyGenerationFailed if keys had to be rotated but OpenSSL is unable to generate new key
+     */
+    std::optional<DecryptionKey> decryptionKey(const unsigned char* key_name, Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Enables session tickets for given TLS context using these keys
+     *
+     * Instance must outlive given context and every connection using it.
+     *
+     * @param tls_context Native handle for OpenSSL context
+     */
+    void install(SSL_CTX* tls_context);
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_TLSTICKETKEYS_HPP
@@ -24,7 +24,8 @@ protected:
 public:
     /// Calls superclass constructor
     UnsafeBeastWebsocketBackend(const boost::asio::ip::tcp::endpoint& local_endpoint,
-                                Utils::LoggingContext& logging_context);
+                                Utils::LoggingContext& logging_context,
+                                const BeastWebsocketBackendOptions& options = {}, std::size_t players_limit = 2);
 };
 
 
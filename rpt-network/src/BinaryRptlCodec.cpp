@@ -0,0 +1,147 @@
+#include <RpT-Network/BinaryRptlCodec.hpp>
+
+#include <algorithm>
+#include <charconv>
+
+
+namespace RpT::Network {
+
+
+/// Max varint length for a 64 bits value, 7 bits for each byte
+constexpr std::size_t MAX_VARINT_LENGTH { 10 };
+
+
+/// Checks if word is a decimal number that parsing then formatting again would give back unchanged
+bool isCanonicalNumber(const std::string_view word, std::uint64_t& value) {
+    if (word.empty() || (word.length() > 1 && word.front() == '0')) // Leading zeros would be lost
+        return false;
+
+    const char* const word_end { word.data() + word.size() };
+    const auto [parsed_end, err] { std::from_chars(word.data(), word_end, value) };
+
+    // Whole word must be parsed, otherwise a sign or any other char would be lost
+    return err == std::errc {} && parsed_end == word_end;
+}
+
+/// Appends token for given word to binary message
+void appendWord(std::string& binary_message, const std::string_view word) {
+    const auto keyword { std::find(BinaryRptlCodec::KEYWORDS.cbegin(), BinaryRptlCodec::KEYWORDS.cend(), word) };
+
+    if (keyword != BinaryRptlCodec::KEYWORDS.cend()) { // Protocol words are encoded using their index
+        const auto keyword_index { static_cast<std::uint8_t>(keyword - BinaryRptlCodec::KEYWORDS.cbegin()) };
+
+        binary_message.push_back(static_cast<char>(BinaryRptlCodec::KEYWORD_TAG | keyword_index));
+        return;
+    }
+
+    std::uint64_t number;
+    if (isCanonicalNumber(word, number)) { // UIDs, RUIDs, coordinates...
+        if (number <= BinaryRptlCodec::MAX_SMALL_NUMBER) {
+            binary_message.push_back(static_cast<char>(BinaryRptlCodec::SMALL_NUMBER_TAG | number));
+        } else {
+            binary_message.push_back(static_cast<char>(BinaryRptlCodec::NUMBER_TAG));
+            BinaryRptlCodec::appendVarint(binary_message, number);
+        }
+
+        return;
+    }
+
+    // Any other word is copied with its length
+    binary_message.push_back(static_cast<char>(BinaryRptlCodec::STRING_TAG));
+    BinaryRptlCodec::appendVarint(binary_message, word.length());
+    binary_message.append(word);
+}
+
+
+void BinaryRptlCodec::appendVarint(std::string& output, std::uint64_t value) {
+    // 7 bits for each byte, most significant bit set if another byte follows
+    while (value >= 0x80) {
+        output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    output.push_back(static_cast<char>(value));
+}
+
+std::uint64_t BinaryRptlCodec::readVarint(const std::string_view input, std::size_t& position) {
+    std::uint64_t value { 0 };
+
+    for (std::size_t i { 0 }; i < MAX_VARINT_LENGTH; i++) {
+        if (position >= input.length())
+            throw BadBinaryMessage { "Truncated varint" };
+
+        const auto next_byte { static_cast<std::uint8_t>(input[position++]) };
+        const std::uint64_t value_bits { next_byte & 0x7Fu };
+
+        // Last byte can only hold most significant bit for a 64 bits value
+        if (i == MAX_VARINT_LENGTH - 1 && value_bits > 1)
+            throw BadBinaryMessage { "Varint overflows 64 bits" };
+
+        value |= value_bits << (7 * i);
+
+        if ((next_byte & 0x80) == 0) // No byte follows
+            return value;
+    }
+
+    throw BadBinaryMessage { "Varint overflows 64 bits" };
+}
+
+std::string BinaryRptlCodec::encode(const std::string_view text_message) {
+    std::string binary_message;
+    binary_message.reserve(text_message.length()); // Encoding is expected to be shorter for most messages
+
+    std::size_t word_begin { 0 };
+    while (true) {
+        const std::size_t word_end { text_message.find(' ', word_begin) };
+
+        if (word_end == std::string_view::npos) { // Last word goes until end of message
+            appendWord(binary_message, text_message.substr(word_begin));
+
+            return binary_message;
+        }
+
+        appendWord(binary_message, text_message.substr(word_begin, word_end - word_begin));
+        word_begin = word_end + 1;
+    }
+}
+
+std::string BinaryRptlCodec::decode(const std::string_view binary_message) {
+    std::string text_message;
+    text_message.reserve(binary_message.length() * 2); // Text format is expected to be longer
+
+    std::size_t position { 0 };
+    while (position < binary_message.length()) {
+        if (position > 0) // Words are separated by a single space
+            text_message.push_back(' ');
+
+        const auto tag { static_cast<std::uint8_t>(binary_message[position++]) };
+
+        if ((tag & KEYWORD_TAG) != 0) {
+            const std::size_t keyword_index { tag & 0x7Fu };
+
+            if (keyword_index >= KEYWORDS.size())
+                throw BadBinaryMessage { "Unknown keyword " + std::to_string(keyword_index) };
+
+            text_message += KEYWORDS[keyword_index];
+        } else if ((tag & SMALL_NUMBER_TAG) != 0) {
+            text_message += std::to_string(tag & MAX_SMALL_NUMBER);
+        } else if (tag == NUMBER_TAG) {
+            text_message += std::to_string(readVarint(binary_message, position));
+        } else if (tag == STRING_TAG) {
+            const std::uint64_t word_length { readVarint(binary_message, position) };
+
+            if (word_length > binary_message.length() - position)
+                throw BadBinaryMessage { "Truncated word" };
+
+            text_message += binary_message.substr(position, word_length);
+            position += word_length;
+        } else {
+            throw BadBinaryMessage { "Unknown tag " + std::to_string(tag) };
+        }
+    }
+
+    return text_message;
+}
+
+
+}
@@ -0,0 +1,385 @@
+#include <RpT-Network/ClusterGateway.hpp>
+
+#include <algorithm>
+#include <csignal>
+#include <sstream>
+#include <stdexcept>
+#include <boost/asio/write.hpp>
+#include <RpT-Config/Config.hpp>
+#include <RpT-Network/NetworkBackend.hpp>
+#include <RpT-Network/RawTcpBackend.hpp>
+#include <RpT-Utils/TextProtocolParser.hpp>
+
+
+namespace RpT::Network {
+
+
+namespace {
+
+
+/// Minimum free space inside first bytes buffer before next bytes are read
+constexpr std::size_t FIRST_READ_CHUNK_SIZE { 1024 };
+
+
+/// Parses actor from a RPTL `LOGIN` or `RESUME` command, without throwing if message is anything else
+class PlacementParser : public Utils::TextProtocolParser {
+public:
+    /// Parses RPTL command name, actor UID and actor name or session secret from given message
+    explicit PlacementParser(const std::string_view rptl_message)
+    : Utils::TextProtocolParser { rptl_message, 3, std::nothrow } {}
+
+    /// Checks if parsed message is a `LOGIN` command with its 2 arguments
+    bool isLogin() const {
+        return hasExpectedWords() && getParsedWord(0) == NetworkBackend::HANDSHAKE_COMMAND;
+    }
+
+    /// Checks if parsed message is a `RESUME` command with its 2 arguments
+    bool isResume() const {
+        return hasExpectedWords() && getParsedWord(0) == NetworkBackend::RESUME_COMMAND;
+    }
+
+    /// Retrieves parsed actor UID, only if `isLogin()` or `isResume()`, uninitialized if it isn't an integer
+    std::optional<std::uint64_t> actorUID() const {
+        return parseInteger<std::uint64_t>(getParsedWord(1));
+    }
+
+    /// Retrieves parsed actor name, only if `isLogin()`
+    std::string_view actorName() const {
+        return getParsedWord(2);
+    }
+};
+
+
+/// Retrieves Posix signals stopping gateway, same as for network backends
+std::vector<int> getCaughtSignals() {
+    std::vector<int> caught_signals { SIGTERM }; // SIGTERM is always caught and always exist
+    caught_signals.reserve(3); // At least 3 caught Posix signals: SIGINT, SIGTERM and SIGHUP
+
+#ifdef NDEBUG
+    caught_signals.push_back(SIGINT); // SIGINT used by GDB for debugging
+#endif
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    caught_signals.push_back(SIGHUP); // SIGHUP only available for Unix runtime platform
+#endif
+
+    return caught_signals;
+}
+
+/// Tries to get string representation for TCP socket remote endpoint, `"UNKNOWN"` if it fails
+std::string endpointFor(const boost::asio::ip::tcp::socket& connection) {
+    try {
+        std::ostringstream endpoint_output;
+        endpoint_output << connection.remote_endpoint(); // remote_endpoint() may fail for some reasons
+
+        return endpoint_output.str();
+    } catch (const boost::system::system_error&) { // If it fails, returns fallback string representation
+        return "UNKNOWN";
+    }
+}
+
+
+}
+
+
+void ClusterGateway::waitNextClient() {
+    tcp_acceptor_.async_accept([this](const boost::system::error_code& err,
+                                      boost::asio::ip::tcp::socket new_client_connection) {
+
+        if (err == boost::asio::error::operation_aborted) // Ignores if gateway stopped
+            return;
+
+        if (err) {
+            logger_.error("Unable to accept TCP connection: {}", err.message());
+        } else {
+            boost::system::error_code option_err;
+            // Relayed frames are small and latency matters more than segments count
+            new_client_connection.set_option(boost::asio::ip::tcp::no_delay { true }, option_err);
+
+            const auto routed_client {
+                std::make_shared<RoutedClient>(RoutedClient {
+                    std::move(new_client_connection), boost::asio::ip::tcp::socket { async_io_context_ },
+                    {}, {}, {}, {}, false
+                })
+            };
+
+            readFirstFrame(routed_client);
+        }
+
+        waitNextClient(); // Waits for next client, whatever happened to this one
+    });
+}
+
+void ClusterGateway::readFirstFrame(const std::shared_ptr<RoutedClient>& routed_client) {
+    std::vector<char>& first_bytes { routed_client->firstBytes };
+    const std::size_t buffered_bytes { first_bytes.size() };
+
+    first_bytes.resize(buffered_bytes + FIRST_READ_CHUNK_SIZE);
+
+    routed_client->client.async_read_some(
+            boost::asio::buffer(first_bytes.data() + buffered_bytes, FIRST_READ_CHUNK_SIZE),
+            [this, routed_client, buffered_bytes](const boost::system::error_code& err, const std::size_t bytes_read) {
+                std::vector<char>& received_bytes { routed_client->firstBytes };
+                received_bytes.resize(buffered_bytes + bytes_read);
+
+                if (err) { // Client left before being routed, nothing to relay
+                    if (err != boost::asio::error::operation_aborted)
+                        closeClient(*routed_client);
+
+                    return;
+                }
+
+                if (received_bytes.size() < RawTcpBackend::FRAME_HEADER_SIZE) { // Frame length isn't known yet
+                    readFirstFrame(routed_client);
+                    return;
+                }
+
+                const std::size_t message_length { RawTcpBackend::frameLength(received_bytes.data()) };
+                if (message_length > max_message_size_) {
+                    logger_.error("First frame of {} bytes from {} is too long",
+                                  message_length, endpointFor(routed_client->client));
+
+                    closeClient(*routed_client);
+                    return;
+                }
+
+                if (received_bytes.size() < RawTcpBackend::FRAME_HEADER_SIZE + message_length) { // Frame incomplete
+                    readFirstFrame(routed_client);
+                    return;
+                }
+
+                const std::string_view first_message {
+                    received_bytes.data() + RawTcpBackend::FRAME_HEADER_SIZE, message_length
+                };
+
+                routed_client->routedNode = chooseNode(first_message);
+                nodes_load_[*routed_client->routedNode]++;
+
+                connectNode(routed_client);
+            });
+}
+
+std::size_t ClusterGateway::chooseNode(const std::string_view first_message) {
+    const PlacementParser placement_parser { first_message };
+
+    if (placement_parser.isResume()) {
+        const std::optional<std::uint64_t> actor_uid { placement_parser.actorUID() };
+
+        // Only node which logged actor in holds its detached session
+        const auto session_placement { actor_uid ? session_placements_.find(*actor_uid) : session_placements_.end() };
+        if (session_placement != session_placements_.end())
+            return session_placement->second;
+
+        return leastLoadedNode(); // Unknown session, node will refuse it
+    }
+
+    if (!placement_parser.isLogin()) // No actor to place, any node can handle this client
+        return leastLoadedNode();
+
+    const std::string_view actor_name { placement_parser.actorName() };
+
+    // Placement is sticky, so actor finds its room back when it reconnects
+    const auto actor_placement { placements_.find(std::string { actor_name }) };
+    const bool placed { actor_placement != placements_.end() };
+    const std::size_t chosen_node { placed ? actor_placement->second : leastLoadedNode() };
+
+    if (!placed)
+        place(actor_name, chosen_node);
+
+    const std::optional<std::uint64_t> actor_uid { placement_parser.actorUID() };
+    if (actor_uid) // Session this actor might enable will be resumed on same node
+        placeSession(*actor_uid, chosen_node);
+
+    return chosen_node;
+}
+
+std::size_t ClusterGateway::leastLoadedNode() const {
+    return std::min_element(nodes_load_.cbegin(), nodes_load_.cend()) - nodes_load_.cbegin();
+}
+
+void ClusterGateway::place(const std::string_view actor_name, const std::size_t node) {
+    if (placements_order_.size() == MAX_PLACEMENTS) { // Oldest placement is forgotten so table stays bounded
+        placements_.erase(placements_order_.front());
+        placements_order_.pop_front();
+    }
+
+    placements_order_.emplace_back(actor_name);
+    placements_.insert({ placements_order_.back(), node });
+}
+
+void ClusterGateway::placeSession(const std::uint64_t actor_uid, const std::size_t node) {
+    const auto session_placement { session_placements_.find(actor_uid) };
+    if (session_placement != session_placements_.end()) { // UID logged in again, latest login owns session
+        session_placement->second = node;
+        return;
+    }
+
+    if (session_placements_order_.size() == MAX_PLACEMENTS) { // Oldest placement is forgotten so table stays bounded
+        session_placements_.erase(session_placements_order_.front());
+        session_placements_order_.pop_front();
+    }
+
+    session_placements_order_.push_back(actor_uid);
+    session_placements_.insert({ actor_uid, node });
+}
+
+void ClusterGateway::connectNode(const std::shared_ptr<RoutedClient>& routed_client) {
+    const boost::asio::ip::tcp::endpoint& node_endpoint { nodes_[*routed_client->routedNode] };
+
+    logger_.debug("Routing {} to node {} at {}:{}", endpointFor(routed_client->client), *routed_client->routedNode,
+                  node_endpoint.address().to_string(), node_endpoint.port());
+
+    routed_client->node.async_connect(node_endpoint, [this, routed_client](const boost::system::error_code& err) {
+        if (err) {
+            if (err != boost::asio::error::operation_aborted) {
+                logger_.error("Unable to connect node {}: {}", *routed_client->routedNode, err.message());
+
+                closeClient(*routed_client);
+            }
+
+            return;
+        }
+
+        if (routed_client->closed) // Client might have been closed while connecting
+            return;
+
+        boost::system::error_code option_err;
+        routed_client->node.set_option(boost::asio::ip::tcp::no_delay { true }, option_err);
+
+        // Bytes received while node was chosen are forwarded before anything else
+        boost::asio::async_write(routed_client->node, boost::asio::buffer(routed_client->firstBytes),
+                                 [this, routed_client](const boost::system::error_code& err, std::size_t) {
+            if (err) {
+                closeClient(*routed_client);
+                return;
+            }
+
+            routed_client->firstBytes = {}; // Frees first bytes, no longer required
+
+            relay(routed_client, routed_client->client, routed_client->node, routed_client->toNode);
+            relay(routed_client, routed_client->node, routed_client->client, routed_client->toClient);
+        });
+    });
+}
+
+void ClusterGateway::relay(const std::shared_ptr<RoutedClient>& routed_client,
+                           boost::asio::ip::tcp::socket& source, boost::asio::ip::tcp::socket& destination,
+                           std::array<char, RELAY_BUFFER_SIZE>& buffer) {
+
+    source.async_read_some(boost::asio::buffer(buffer), [this, routed_client, &source, &destination, &buffer](
+            const boost::system::error_code& err, const std::size_t bytes_read) {
+
+        if (err) { // One side is gone, other side must be closed too
+            closeClient(*routed_client);
+            return;
+        }
+
+        // Next bytes are read only once these ones have been written, so buffer isn't modified during write
+        boost::asio::async_write(destination, boost::asio::buffer(buffer.data(), bytes_read),
+                                 [this, routed_client, &source, &destination, &buffer](
+                                         const boost::system::error_code& err, std::size_t) {
+
+            if (err) {
+                closeClient(*routed_client);
+                return;
+            }
+
+            relay(routed_client, source, destination, buffer);
+        });
+    });
+}
+
+void ClusterGateway::closeClient(RoutedClient& routed_client) {
+    if (routed_client.closed) // Both directions relays fail when connection is closed
+        return;
+
+    routed_client.closed = true;
+
+    if (routed_client.routedNode.has_value())
+        nodes_load_[*routed_client.routedNode]--;
+
+    // Errors are ignored as connections are closed anyways, pending operations will be cancelled
+    boost::system::error_code err;
+
+    routed_client.client.shutdown(boost::asio::ip::tcp::socket::shutdown_both, err);
+    routed_client.client.close(err);
+    routed_client.node.shutdown(boost::asio::ip::tcp::socket::shutdown_both, err);
+    routed_client.node.close(err);
+}
+
+ClusterGateway::ClusterGateway(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                               std::vector<boost::asio::ip::tcp::endpoint> nodes,
+                               Utils::LoggingContext& logging_context, const std::size_t max_message_size)
+: logger_ { "Cluster-Gateway", logging_context }, nodes_ { std::move(nodes) }, max_message_size_ { max_message_size },
+nodes_load_(nodes_.size(), 0), stop_signals_handling_ { async_io_context_ },
+tcp_acceptor_ { async_io_context_, local_endpoint } {
+
+    if (nodes_.empty())
+        throw std::invalid_argument { "Gateway requires at least 1 node" };
+
+    // For each Posix signal that must be caught
+    for (const int posix_signal : getCaughtSignals()) {
+        boost::system::error_code err;
+        // Error might occurs when adding signal to add, but it must NOT be fatal
+        stop_signals_handling_.add(posix_signal, err);
+
+        if (err) // Displays warning if signal will not be caught as expected
+            logger_.warn("Posix signal {} will not be caught: {}", posix_signal, err.message());
+    }
+
+    // Listens for Posix signals
+    stop_signals_handling_.async_wait([this](const boost::system::error_code& err, const int posix_signal) {
+        if (err == boost::asio::error::operation_aborted) // Ignores if gateway stopped
+            return;
+
+        if (err)
+            logger_.error("Failed to handle posix signal {}: {}", posix_signal, err.message());
+        else
+            logger_.debug("Posix signal {}, stopping...", posix_signal);
+
+        async_io_context_.stop();
+    });
+
+    waitNextClient();
+}
+
+std::uint16_t ClusterGateway::localPort() const {
+    return tcp_acceptor_.local_endpoint().port();
+}
+
+void ClusterGateway::run() {
+    logger_.info("Routing clients from port {} to {} nodes", localPort(), nodes_.size());
+
+    async_io_context_.run();
+
+    logger_.info("Stopped.");
+}
+
+void ClusterGateway::stop() {
+    async_io_context_.stop();
+}
+
+std::size_t ClusterGateway::nodeLoad(const std::size_t node) const {
+    return nodes_load_.at(node);
+}
+
+std::optional<std::size_t> ClusterGateway::placementFor(const std::string_view actor_name) const {
+    const auto actor_placement { placements_.find(std::string { actor_name }) };
+
+    if (actor_placement == placements_.end())
+        return {};
+
+    return actor_placement->second;
+}
+
+std::optional<std::size_t> ClusterGateway::sessionPlacementFor(const std::uint64_t actor_uid) const {
+    const auto session_placement { session_placements_.find(actor_uid) };
+
+    if (session_placement == session_placements_.end())
+        return {};
+
+    return session_placement->second;
+}
+
+
+}
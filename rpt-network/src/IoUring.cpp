@@ -0,0 +1,236 @@
+#include <RpT-Network/IoUring.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+namespace RpT::Network {
+
+
+/// Maximum number of buffers inside a provided buffers ring, as buffer IDs are 16 bits
+constexpr unsigned MAX_PROVIDED_BUFFERS { 32768 };
+
+
+IoUringError::IoUringError(const std::string& operation, const int error_number)
+: std::runtime_error { "io_uring " + operation + ": " + std::strerror(error_number) } {}
+
+
+void IoUring::release() {
+    if (sqes_ != nullptr)
+        munmap(sqes_, sqes_size_);
+
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+        munmap(cq_ring_, cq_ring_size_);
+
+    if (sq_ring_ != nullptr)
+        munmap(sq_ring_, sq_ring_size_);
+
+    if (ring_fd_ >= 0)
+        ::close(ring_fd_);
+}
+
+IoUring::IoUring(const unsigned entries)
+: ring_fd_ { -1 }, sq_ring_ { nullptr }, sq_ring_size_ { 0 }, cq_ring_ { nullptr }, cq_ring_size_ { 0 },
+sqes_ { nullptr }, sqes_size_ { 0 }, sq_local_tail_ { 0 } {
+
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (ring_fd_ < 0)
+        throw IoUringError { "setup", errno };
+
+    try {
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        // Since Linux 5.4, both rings can be mapped at once
+        const bool single_mapping { (params.features & IORING_FEAT_SINGLE_MMAP) != 0 };
+        if (single_mapping)
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+
+        void* const sq_ring {
+            mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                 IORING_OFF_SQ_RING)
+        };
+
+        if (sq_ring == MAP_FAILED)
+            throw IoUringError { "submission ring mapping", errno };
+
+        sq_ring_ = sq_ring;
+
+        if (single_mapping) {
+            cq_ring_ = sq_ring_;
+        } else {
+            void* const cq_ring {
+                mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                     IORING_OFF_CQ_RING)
+            };
+
+            if (cq_ring == MAP_FAILED)
+                throw IoUringError { "completion ring mapping", errno };
+
+            cq_ring_ = cq_ring;
+        }
+
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* const sqes {
+            mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES)
+        };
+
+        if (sqes == MAP_FAILED)
+            throw IoUringError { "submission entries mapping", errno };
+
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+    } catch (const IoUringError&) { // Destructor will not be called, mapped memory must be released here
+        release();
+
+        throw;
+    }
+
+    char* const sq_ring_bytes { static_cast<char*>(sq_ring_) };
+    sq_head_ = reinterpret_cast<unsigned*>(sq_ring_bytes + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_ring_bytes + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq_ring_bytes + params.sq_off.ring_mask);
+    sq_entries_ = *reinterpret_cast<unsigned*>(sq_ring_bytes + params.sq_off.ring_entries);
+    sq_array_ = reinterpret_cast<unsigned*>(sq_ring_bytes + params.sq_off.array);
+    sq_local_tail_ = *sq_tail_;
+
+    char* const cq_ring_bytes { static_cast<char*>(cq_ring_) };
+    cq_head_ = reinterpret_cast<unsigned*>(cq_ring_bytes + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_ring_bytes + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq_ring_bytes + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ring_bytes + params.cq_off.cqes);
+}
+
+IoUring::~IoUring() {
+    release();
+}
+
+io_uring_sqe& IoUring::prepare(const std::uint8_t opcode, const int fd, const std::uint64_t user_data) {
+    // Entries are consumed by kernel when submitted, if queue is full they must be submitted before
+    if (sq_local_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_entries_) {
+        submit();
+
+        if (sq_local_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_entries_)
+            throw IoUringError { "submission", EBUSY };
+    }
+
+    const unsigned index { sq_local_tail_ & sq_mask_ };
+    io_uring_sqe& sqe { sqes_[index] };
+
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = fd;
+    sqe.user_data = user_data;
+
+    sq_array_[index] = index;
+    sq_local_tail_++;
+
+    return sqe;
+}
+
+void IoUring::submit(const unsigned wait_count) {
+    // Prepared entries must be written before kernel can see new tail
+    __atomic_store_n(sq_tail_, sq_local_tail_, __ATOMIC_RELEASE);
+
+    const unsigned to_submit { sq_local_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) };
+    if (to_submit == 0 && wait_count == 0) // Nothing to do, system call can be saved
+        return;
+
+    const unsigned enter_flags { wait_count > 0 ? IORING_ENTER_GETEVENTS : 0u };
+    const long enter_result {
+        syscall(__NR_io_uring_enter, ring_fd_, to_submit, wait_count, enter_flags, nullptr, 0)
+    };
+
+    // Interrupted by a signal, or completion queue is full: caller will consume completions then submit again
+    if (enter_result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        throw IoUringError { "enter", errno };
+}
+
+void IoUring::registerBuffersRing(const io_uring_buf_reg& registration) {
+    if (syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PBUF_RING, &registration, 1) < 0)
+        throw IoUringError { "provided buffers registration", errno };
+}
+
+void IoUring::unregisterBuffersRing(const std::uint16_t group_id) {
+    io_uring_buf_reg registration;
+    std::memset(&registration, 0, sizeof(registration));
+    registration.bgid = group_id;
+
+    // Ring is being destroyed anyways, nothing can be done if it fails
+    syscall(__NR_io_uring_register, ring_fd_, IORING_UNREGISTER_PBUF_RING, &registration, 1);
+}
+
+
+IoUringBuffers::IoUringBuffers(IoUring& ring, const std::uint16_t group_id, const unsigned count,
+                               const std::size_t buffer_size)
+: ring_ { ring }, group_id_ { group_id }, buffer_size_ { buffer_size }, count_ { 1 }, tail_ { 0 } {
+    // Kernel requires a power of 2 entries
+    while (count_ < std::min(count, MAX_PROVIDED_BUFFERS))
+        count_ <<= 1;
+
+    storage_.resize(count_ * buffer_size_);
+
+    // Ring memory must be page-aligned, so it is mapped instead of allocated
+    buffers_ring_size_ = count_ * sizeof(io_uring_buf);
+    void* const buffers_ring {
+        mmap(nullptr, buffers_ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+    };
+
+    if (buffers_ring == MAP_FAILED)
+        throw IoUringError { "provided buffers mapping", errno };
+
+    buffers_ring_ = static_cast<io_uring_buf_ring*>(buffers_ring);
+
+    io_uring_buf_reg registration;
+    std::memset(&registration, 0, sizeof(registration));
+    registration.ring_addr = reinterpret_cast<std::uint64_t>(buffers_ring_);
+    registration.ring_entries = count_;
+    registration.bgid = group_id_;
+
+    try {
+        ring_.registerBuffersRing(registration);
+    } catch (const IoUringError&) { // Destructor will not be called, mapped memory must be released here
+        munmap(buffers_ring_, buffers_ring_size_);
+
+        throw;
+    }
+
+    // Every buffer is available at beginning
+    for (unsigned i { 0 }; i < count_; i++)
+        recycle(static_cast<std::uint16_t>(i));
+}
+
+IoUringBuffers::~IoUringBuffers() {
+    ring_.unregisterBuffersRing(group_id_);
+    munmap(buffers_ring_, buffers_ring_size_);
+}
+
+std::uint16_t IoUringBuffers::groupId() const {
+    return group_id_;
+}
+
+const char* IoUringBuffers::data(const std::uint16_t buffer_id) const {
+    return storage_.data() + buffer_id * buffer_size_;
+}
+
+void IoUringBuffers::recycle(const std::uint16_t buffer_id) {
+    // Empty struct inside header flexible array declaration isn't zero-sized with C++, so bufs member is shifted by
+    // one entry and can't be used: entries begin at ring beginning, tail overlaid with first entry reserved field
+    io_uring_buf* const entries { reinterpret_cast<io_uring_buf*>(buffers_ring_) };
+    io_uring_buf& entry { entries[tail_ & (count_ - 1)] };
+    entry.addr = reinterpret_cast<std::uint64_t>(storage_.data() + buffer_id * buffer_size_);
+    entry.len = static_cast<std::uint32_t>(buffer_size_);
+    entry.bid = buffer_id;
+
+    // Entry must be written before kernel can see new tail
+    __atomic_store_n(&buffers_ring_->tail, ++tail_, __ATOMIC_RELEASE);
+}
+
+
+}
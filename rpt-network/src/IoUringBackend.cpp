@@ -0,0 +1,709 @@
+#include <RpT-Network/IoUringBackend.hpp>
+
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <queue>
+#include <sstream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <RpT-Config/Config.hpp>
+#include <RpT-Core/Timer.hpp>
+
+
+namespace RpT::Network {
+
+
+/// Bits for operation ID inside user data, remaining most significant byte is operation kind
+constexpr unsigned OPERATION_ID_BITS { 56 };
+/// Mask retrieving operation ID from user data
+constexpr std::uint64_t OPERATION_ID_MASK { (std::uint64_t { 1 } << OPERATION_ID_BITS) - 1 };
+
+
+std::uint64_t IoUringBackend::userData(const Operation operation, const std::uint64_t id) {
+    assert(id <= OPERATION_ID_MASK);
+
+    return (static_cast<std::uint64_t>(operation) << OPERATION_ID_BITS) | id;
+}
+
+std::vector<int> IoUringBackend::getCaughtSignals() {
+    std::vector<int> caught_signals { SIGTERM }; // SIGTERM is always caught and always exist
+    caught_signals.reserve(3); // At least 3 caught Posix signals: SIGINT, SIGTERM and SIGHUP
+
+#ifdef NDEBUG
+    caught_signals.push_back(SIGINT); // SIGINT used by GDB for debugging
+#endif
+
+    caught_signals.push_back(SIGHUP); // io_uring only available for Linux, which is a Unix runtime platform
+
+    return caught_signals;
+}
+
+int IoUringBackend::openListener(const boost::asio::ip::tcp::endpoint& local_endpoint) {
+    const int listener_fd { ::socket(local_endpoint.protocol().family(), SOCK_STREAM | SOCK_CLOEXEC, 0) };
+    if (listener_fd < 0)
+        throw boost::system::system_error { errno, boost::system::system_category(), "Listening socket" };
+
+    const int reuse_address { 1 };
+    if (setsockopt(listener_fd, SOL_SOCKET, SO_REUSEADDR, &reuse_address, sizeof(reuse_address)) < 0
+        || bind(listener_fd, local_endpoint.data(), static_cast<socklen_t>(local_endpoint.size())) < 0
+        || listen(listener_fd, SOMAXCONN) < 0) {
+
+        const int listen_error { errno };
+        ::close(listener_fd);
+
+        throw boost::system::system_error { listen_error, boost::system::system_category(), "Listening socket" };
+    }
+
+    return listener_fd;
+}
+
+std::string IoUringBackend::endpointFor(const int socket_fd) {
+    boost::asio::ip::tcp::endpoint remote_endpoint;
+    socklen_t endpoint_size { static_cast<socklen_t>(remote_endpoint.capacity()) };
+
+    if (getpeername(socket_fd, remote_endpoint.data(), &endpoint_size) < 0) // May fail if connection was reset
+        return "UNKNOWN";
+
+    remote_endpoint.resize(endpoint_size);
+
+    std::ostringstream endpoint_output;
+    endpoint_output << remote_endpoint;
+
+    return endpoint_output.str();
+}
+
+void IoUringBackend::acceptClients() {
+    io_uring_sqe& accept { ring_.prepare(IORING_OP_ACCEPT, listener_fd_, userData(Operation::Accept, 0)) };
+    accept.ioprio = IORING_ACCEPT_MULTISHOT;
+    accept.accept_flags = SOCK_CLOEXEC;
+}
+
+void IoUringBackend::receiveFrom(const std::uint64_t client_token, ClientConnection& connection) {
+    RPT_LOG_TRACE(logger_, "Listening next messages from {}...", client_token);
+
+    io_uring_sqe& receive { ring_.prepare(IORING_OP_RECV, connection.fd, userData(Operation::Receive, client_token)) };
+    receive.ioprio = IORING_RECV_MULTISHOT;
+    receive.flags = IOSQE_BUFFER_SELECT; // No buffer given, one is selected from receive buffers group
+    receive.buf_group = receive_buffers_.groupId();
+
+    connection.receiving = true;
+}
+
+void IoUringBackend::waitSignal() {
+    io_uring_sqe& read { ring_.prepare(IORING_OP_READ, signal_fd_, userData(Operation::Signal, 0)) };
+    read.addr = reinterpret_cast<std::uint64_t>(&caught_signal_);
+    read.len = sizeof(caught_signal_);
+}
+
+void IoUringBackend::waitCompletedTasks() {
+    io_uring_sqe& read { ring_.prepare(IORING_OP_READ, tasks_fd_, userData(Operation::TasksCompleted, 0)) };
+    read.addr = reinterpret_cast<std::uint64_t>(&completed_tasks_count_);
+    read.len = sizeof(completed_tasks_count_);
+}
+
+void IoUringBackend::handleCompletion(const IoUring::Completion& completion) {
+    const auto operation { static_cast<Operation>(completion.userData >> OPERATION_ID_BITS) };
+    const std::uint64_t operation_id { completion.userData & OPERATION_ID_MASK };
+
+    switch (operation) {
+    case Operation::Accept:
+        handleAccepted(completion);
+        break;
+    case Operation::Receive:
+        handleReceived(operation_id, completion);
+        break;
+    case Operation::Send:
+        handleSent(operation_id, completion);
+        break;
+    case Operation::Timer: {
+        const std::uint64_t timer_token { pending_timers_.at(operation_id).token };
+        pending_timers_.erase(operation_id); // Timeout isn't read by kernel anymore
+
+        // Timer might have been cancelled, or server stopped
+        if (completion.result == -ETIME && !closed())
+            pushInputEvent(Core::TimerEvent { 0, timer_token }); // Actor UID doesn't matter, timer token does
+        else if (completion.result != -ECANCELED)
+            logger_.error("Pending timer {} countdown: {}", timer_token, std::strerror(-completion.result));
+
+        break;
+    }
+    case Operation::TimerRemoval: // Timer completion is enough, nothing to do
+        break;
+    case Operation::Signal:
+        if (closed()) // Ignores if server stopped
+            break;
+
+        if (completion.result == sizeof(caught_signal_)) {
+            logger_.debug("Posix signal {}, stopping...", caught_signal_.ssi_signo);
+            close(); // Close IO interface to stop server
+        } else {
+            logger_.error("Failed to handle posix signal: {}", std::strerror(-completion.result));
+        }
+
+        break;
+    case Operation::TasksCompleted:
+        if (closed()) // Ignores if server stopped
+            break;
+
+        if (completion.result == sizeof(completed_tasks_count_))
+            pushCompletedTasks(); // Counter is reset by read, every task completed until then is pushed
+        else
+            logger_.error("Failed to handle completed tasks: {}", std::strerror(-completion.result));
+
+        waitCompletedTasks();
+        break;
+    }
+}
+
+void IoUringBackend::handleAccepted(const IoUring::Completion& completion) {
+    if (closed()) { // Ignores if server stopped, but connection must not be leaked
+        if (completion.result >= 0)
+            ::close(completion.result);
+
+        return;
+    }
+
+    // Multishot accept may stop, for example if kernel ran out of memory, so it must be submitted again
+    if ((completion.flags & IORING_CQE_F_MORE) == 0) {
+        if (completion.result == -EINVAL) { // Not a temporary error, it would be stopped again
+            logger_.fatal("Multishot accept unsupported by running kernel, no connection will be accepted.");
+            return;
+        }
+
+        acceptClients();
+    }
+
+    if (completion.result < 0) {
+        logger_.error("Unable to accept TCP: {}", std::strerror(-completion.result));
+        return;
+    }
+
+    const int new_client_fd { completion.result };
+    const std::string remote_endpoint { endpointFor(new_client_fd) };
+
+    // Frames are small and latency matters more than segments count for internal clients
+    const int no_delay { 1 };
+    if (setsockopt(new_client_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay)) < 0)
+        logger_.warn("Unable to disable Nagle algorithm for {}: {}", remote_endpoint, std::strerror(errno));
+
+    try {
+        const std::uint64_t new_client_token { tokens_count_++ };
+
+        logger_.debug("New token for {}: {}", remote_endpoint, new_client_token);
+
+        // Add token into connected clients NetworkBackend registry
+        addClient(new_client_token); // May throws if token insertion failed
+
+        auto new_connection {
+            std::make_unique<ClientConnection>(ClientConnection {
+                new_client_fd, {}, OutgoingMessagesQueue { outgoing_limits_ }, {}, false, false, false, false
+            })
+        };
+
+        ClientConnection& connection { *new_connection };
+        const auto insert_connection_result {
+            clients_connection_.insert({ new_client_token, std::move(new_connection) })
+        };
+
+        // Checks if client connection insertion has been done
+        assert(insert_connection_result.second);
+
+        receiveFrom(new_client_token, connection); // Now client was added, it can be listened
+    } catch (const std::exception& err) { // Any token insertion error must result in connection closure
+        logger_.error("Unable to add client for {}: {}", remote_endpoint, err.what());
+
+        ::close(new_client_fd); // Nothing to send, connection can be closed right now
+    }
+}
+
+void IoUringBackend::handleReceived(const std::uint64_t client_token, const IoUring::Completion& completion) {
+    const bool selected_buffer { (completion.flags & IORING_CQE_F_BUFFER) != 0 };
+    const auto buffer_id { static_cast<std::uint16_t>(completion.flags >> IORING_CQE_BUFFER_SHIFT) };
+
+    const auto connection_entry { clients_connection_.find(client_token) };
+    if (connection_entry == clients_connection_.end()) { // Connection released since, buffer must still be recycled
+        if (selected_buffer)
+            receive_buffers_.recycle(buffer_id);
+
+        return;
+    }
+
+    ClientConnection& connection { *connection_entry->second };
+
+    if ((completion.flags & IORING_CQE_F_MORE) == 0) // No more completion will be generated by this operation
+        connection.receiving = false;
+
+    if (connection.closing) { // Remaining bytes are ignored, only waiting for operations to be done
+        if (selected_buffer)
+            receive_buffers_.recycle(buffer_id);
+
+        releaseConnection(client_token);
+
+        return;
+    }
+
+    if (completion.result > 0) {
+        assert(selected_buffer);
+
+        const std::string_view received_bytes {
+            receive_buffers_.data(buffer_id), static_cast<std::size_t>(completion.result)
+        };
+
+        handleReceivedBytes(client_token, connection, received_bytes);
+        receive_buffers_.recycle(buffer_id); // Incomplete frame has been copied, buffer can be selected again
+    } else if (completion.result == 0) { // Client closed its connection
+        logger_.info("TCP connection closed by client {}", client_token);
+
+        killClient(client_token);
+    } else if (completion.result == -ENOBUFS) { // Every receive buffer is in use, client must be listened again
+        logger_.warn("No receive buffer left for client {}.", client_token);
+    } else {
+        const std::string error_message { std::strerror(-completion.result) };
+
+        logger_.error("Failed to receive message from client {}: {}", client_token, error_message);
+        // Connection was lost without client closing it, so actor is kept if its session can be resumed
+        loseClient(client_token, Utils::HandlingResult { error_message });
+    }
+
+    // Operation stopped for a temporary reason, like buffers exhaustion, but client must still be listened
+    if (!connection.receiving && isAlive(client_token))
+        receiveFrom(client_token, connection);
+}
+
+void IoUringBackend::handleSent(const std::uint64_t client_token, const IoUring::Completion& completion) {
+    ClientConnection& connection { *clients_connection_.at(client_token) }; // Not released while sending
+    SentFrames& sent_frames { connection.sentFrames };
+
+    connection.sending = false;
+
+    if (completion.result < 0) {
+        // Connection closed from server side doesn't have to be killed again, remaining messages are lost
+        if (connection.closing) {
+            shutdown(connection.fd, SHUT_RDWR);
+            releaseConnection(client_token);
+
+            return;
+        }
+
+        const std::string error_message { std::strerror(-completion.result) };
+
+        logger_.error("Unable to send message to client {}: {}", client_token, error_message);
+
+        // As RPTL protocol requires, connection if closed if any error occurred, using specific error message, but
+        // actor is kept if its session can be resumed
+        loseClient(client_token, Utils::HandlingResult { error_message });
+
+        return; // Client will be closed, no need to send it remaining messages
+    }
+
+    // Stream socket might send only a part of given buffers, sending must be resumed where it stopped
+    auto remaining_sent_bytes { static_cast<std::size_t>(completion.result) };
+
+    if (Utils::RuntimeMetrics* const runtime_metrics { metrics() })
+        runtime_metrics->bytesSent(remaining_sent_bytes);
+    while (sent_frames.nextBuffer < sent_frames.buffers.size()) {
+        iovec& next_buffer { sent_frames.buffers[sent_frames.nextBuffer] };
+
+        if (remaining_sent_bytes < next_buffer.iov_len) {
+            next_buffer.iov_base = static_cast<char*>(next_buffer.iov_base) + remaining_sent_bytes;
+            next_buffer.iov_len -= remaining_sent_bytes;
+
+            break;
+        }
+
+        remaining_sent_bytes -= next_buffer.iov_len;
+        sent_frames.nextBuffer++;
+    }
+
+    if (sent_frames.nextBuffer < sent_frames.buffers.size()) {
+        sendFrames(client_token, connection);
+        return;
+    }
+
+    if (Utils::PipelineLatencies* const recorded_latencies { latencies() })
+        recorded_latencies->recordSince(Utils::PipelineStage::Write, sent_frames.queuedAt);
+
+    // Messages are not referenced by any operation anymore, storage is kept for next frames
+    sent_frames.messages.clear();
+    sent_frames.headers.clear();
+    sent_frames.buffers.clear();
+
+    // Checks for this client messages queue and send next messages if any, even if closing as remaining messages like
+    // INTERRUPT must be received before connection shutdown
+    if (!connection.remainingMessages.empty()) {
+        sendRemainingMessages(client_token, connection);
+    } else if (connection.closing) {
+        shutdown(connection.fd, SHUT_RDWR);
+        releaseConnection(client_token);
+    }
+}
+
+void IoUringBackend::handleReceivedBytes(const std::uint64_t client_token, ClientConnection& connection,
+                                         const std::string_view received_bytes) {
+
+    if (connection.pendingBytes.empty()) { // Frames are handled directly from receive buffer, without any copy
+        const std::size_t handled_bytes { handleFrames(client_token, received_bytes) };
+
+        if (isAlive(client_token)) // Incomplete frame must be kept until its remaining bytes are received
+            connection.pendingBytes.assign(received_bytes.substr(handled_bytes));
+    } else { // Received bytes are completing previous incomplete frame
+        connection.pendingBytes.append(received_bytes);
+
+        const std::size_t handled_bytes { handleFrames(client_token, connection.pendingBytes) };
+
+        if (isAlive(client_token))
+            connection.pendingBytes.erase(0, handled_bytes);
+    }
+}
+
+std::size_t IoUringBackend::handleFrames(const std::uint64_t client_token, const std::string_view frames) {
+    // Offset for next frame which hasn't been handled yet
+    std::size_t frame_begin { 0 };
+
+    while (frames.size() - frame_begin >= RawTcpBackend::FRAME_HEADER_SIZE) {
+        const std::size_t message_length { RawTcpBackend::frameLength(frames.data() + frame_begin) };
+
+        if (message_length > max_message_size_) { // Client must not be able to make server buffer anything
+            logger_.error("Client {} sent a {} bytes message, limit is {}.",
+                          client_token, message_length, max_message_size_);
+
+            killClient(client_token, Utils::HandlingResult { "RPTL message too long" });
+
+            break;
+        }
+
+        // Frame isn't complete yet
+        if (frames.size() - frame_begin - RawTcpBackend::FRAME_HEADER_SIZE < message_length)
+            break;
+
+        handleReceivedMessage(client_token, frames.substr(frame_begin + RawTcpBackend::FRAME_HEADER_SIZE,
+                                                          message_length));
+
+        frame_begin += RawTcpBackend::FRAME_HEADER_SIZE + message_length;
+
+        if (!isAlive(client_token)) // Following frames must be ignored if message resulted in client being killed
+            break;
+    }
+
+    return frame_begin;
+}
+
+void IoUringBackend::handleReceivedMessage(const std::uint64_t client_token, const std::string_view rptl_message) {
+    try {
+        Core::AnyInputEvent client_triggered_event { handleMessage(client_token, rptl_message) };
+
+        // If logout message was sent, client actor is unregistered and connection must be closed
+        if (std::get_if<Core::LeftEvent>(&client_triggered_event) != nullptr)
+            killClient(client_token);
+
+        pushInputEvent(std::move(client_triggered_event)); // Moves triggered event into queue
+    } catch (const std::exception& err) { // Any error in message handling results into client disconnection
+        logger_.error("During {} message handling: {}", client_token, err.what());
+
+        // Client will be disconnect for thrown error reason
+        killClient(client_token, Utils::HandlingResult { err.what() });
+    }
+}
+
+void IoUringBackend::sendRemainingMessages(const std::uint64_t client_token, ClientConnection& connection) {
+    SentFrames& sent_frames { connection.sentFrames };
+    sent_frames.queuedAt = connection.remainingMessages.frontQueuedAt();
+    std::queue<MessageBuffer> queued_messages { connection.remainingMessages.popAll() };
+
+    if (Utils::RuntimeMetrics* const runtime_metrics { metrics() })
+        runtime_metrics->queueDepth(client_token, 0);
+
+    // Buffers are pointing to headers, they must not move
+    sent_frames.headers.reserve(queued_messages.size());
+    sent_frames.nextBuffer = 0;
+
+    while (!queued_messages.empty()) {
+        const MessageBuffer& next_message {
+            sent_frames.messages.emplace_back(std::move(queued_messages.front()))
+        };
+
+        queued_messages.pop();
+
+        RawTcpBackend::FrameHeader& next_header {
+            sent_frames.headers.emplace_back(RawTcpBackend::frameHeader(next_message->size()))
+        };
+
+        sent_frames.buffers.push_back({ next_header.data(), next_header.size() });
+        // Written data isn't modified, iovec only lacks const qualifier
+        sent_frames.buffers.push_back({ const_cast<char*>(next_message->data()), next_message->size() });
+    }
+
+    sendFrames(client_token, connection);
+}
+
+void IoUringBackend::sendFrames(const std::uint64_t client_token, ClientConnection& connection) {
+    SentFrames& sent_frames { connection.sentFrames };
+
+    std::memset(&sent_frames.header, 0, sizeof(sent_frames.header));
+    sent_frames.header.msg_iov = sent_frames.buffers.data() + sent_frames.nextBuffer;
+    sent_frames.header.msg_iovlen = sent_frames.buffers.size() - sent_frames.nextBuffer;
+
+    io_uring_sqe& send { ring_.prepare(IORING_OP_SENDMSG, connection.fd, userData(Operation::Send, client_token)) };
+    send.addr = reinterpret_cast<std::uint64_t>(&sent_frames.header);
+    send.msg_flags = MSG_NOSIGNAL; // Closed connection is an error for this client only, it must not stop server
+
+    connection.sending = true; // Next messages will be sent once these ones will have been sent
+}
+
+void IoUringBackend::closeConnection(const std::uint64_t client_token) {
+    const Utils::HandlingResult& disconnection_reason { disconnectionReason(client_token) };
+
+    // There is no close frame with plain TCP, so reason is only given to registered actors by INTERRUPT message
+    if (disconnection_reason)
+        logger_.debug("Closing connection with client {}.", client_token);
+    else
+        logger_.debug("Closing connection with client {}: {}", client_token, disconnection_reason.errorMessage());
+
+    removeClient(client_token); // Once disconnection reason has been retrieved, client can be removed
+
+    ClientConnection& dead_client { *clients_connection_.at(client_token) };
+    dead_client.closing = true; // No more RPTL message will be queued for this client
+
+    // If messages are still being sent, connection will be shut down once everything has been sent
+    if (!dead_client.sending) {
+        shutdown(dead_client.fd, SHUT_RDWR); // Pending receive operation will complete
+        releaseConnection(client_token);
+    }
+}
+
+void IoUringBackend::releaseConnection(const std::uint64_t client_token) {
+    const auto connection_entry { clients_connection_.find(client_token) };
+    const ClientConnection& connection { *connection_entry->second };
+
+    if (!connection.closing || connection.sending || connection.receiving) // Still referenced by an operation
+        return;
+
+    ::close(connection.fd);
+    clients_connection_.erase(connection_entry);
+}
+
+void IoUringBackend::syncClient(const std::uint64_t client_token, MessagesQueueView client_messages_queue) {
+    if (!client_messages_queue.hasNext()) // Nothing to send
+        return;
+
+    ClientConnection& connection { *clients_connection_.at(client_token) };
+
+    if (connection.evicted) // Evicted connection will not send anything else
+        return;
+
+    // Appends flushed messages to this client own pipeline, as long as client reads them fast enough
+    while (client_messages_queue.hasNext()) {
+        const MessagePriority priority { client_messages_queue.nextPriority() };
+        const auto push_result { connection.remainingMessages.push(client_messages_queue.next(), priority) };
+
+        if (push_result == OutgoingMessagesQueue::PushResult::Dropped) { // Congested client doesn't receive it
+            backpressure_stats_.droppedMessages++;
+        } else if (push_result == OutgoingMessagesQueue::PushResult::Congested) {
+            backpressure_stats_.congestions++;
+
+            logger_.debug("Client {} is congested.", client_token);
+        } else if (push_result == OutgoingMessagesQueue::PushResult::Overflowed) {
+            connection.evicted = true; // Queued messages are still sent until connection is closed
+            backpressure_stats_.evictions++;
+
+            logger_.warn("Client {} outgoing queue overflowed, evicting it.", client_token);
+            killClient(client_token, Utils::HandlingResult { "Too slow to receive messages" });
+
+            break; // Client will be closed, following messages are dropped
+        }
+    }
+
+    // Sends queued messages if there isn't any send operation pending already
+    if (!connection.sending)
+        sendRemainingMessages(client_token, connection);
+    else if (Utils::RuntimeMetrics* const runtime_metrics { metrics() }) // Waiting for pending send to complete
+        runtime_metrics->queueDepth(client_token, connection.remainingMessages.size());
+}
+
+void IoUringBackend::waitForEvent() {
+    // As interaction with clients might occurres, they must be synced with server and game state
+    synchronize();
+    // If busy-poll is enabled, blocking wait is avoided for an input event occurring shortly after
+    spinForEvent();
+
+    while (!inputReady()) { // While input events queue is empty
+        // Only clients killed since previous iteration must be closed
+        for (const std::uint64_t dead_client_token : pollKilledClients())
+            closeConnection(dead_client_token);
+
+        // Submits every operation prepared since previous iteration, waiting for at least one to complete
+        ring_.submit(1);
+        ring_.forEachCompletion([this](const IoUring::Completion& completion) {
+            handleCompletion(completion);
+        });
+    }
+}
+
+void IoUringBackend::pollReadyEvents() {
+    for (const std::uint64_t dead_client_token : pollKilledClients())
+        closeConnection(dead_client_token);
+
+    // Prepared operations are submitted without waiting, then completions already posted are handled
+    ring_.submit();
+    ring_.forEachCompletion([this](const IoUring::Completion& completion) {
+        handleCompletion(completion);
+    });
+}
+
+void IoUringBackend::wakeForCompletedTasks() {
+    if (tasks_fd_ >= 0)
+        eventfd_write(tasks_fd_, 1);
+}
+
+IoUringBackend::IoUringBackend(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                               Utils::LoggingContext& logging_context, const IoUringBackendOptions& options,
+                               const std::size_t players_limit)
+: NetworkBackend { players_limit },
+logger_ { "io_uring-Backend", logging_context },
+outgoing_limits_ { options.outgoingLimits },
+max_message_size_ { options.maxMessageSize },
+ring_ { options.ringEntries },
+receive_buffers_ { ring_, 0, options.receiveBuffers, options.receiveBufferSize },
+listener_fd_ { openListener(local_endpoint) },
+local_port_ { 0 },
+signal_fd_ { -1 },
+tasks_fd_ { eventfd(0, EFD_CLOEXEC) },
+timers_count_ { 0 },
+tokens_count_ { 0 } {
+    boost::asio::ip::tcp::endpoint bound_endpoint { local_endpoint };
+    socklen_t endpoint_size { static_cast<socklen_t>(bound_endpoint.capacity()) };
+
+    // Port might have been chosen by system
+    if (getsockname(listener_fd_, bound_endpoint.data(), &endpoint_size) == 0) {
+        bound_endpoint.resize(endpoint_size);
+        local_port_ = bound_endpoint.port();
+    }
+
+    sigset_t caught_signals;
+    sigemptyset(&caught_signals);
+
+    for (const int posix_signal : getCaughtSignals())
+        sigaddset(&caught_signals, posix_signal);
+
+    // Signals must be blocked to be read from signal file descriptor instead of triggering their default action
+    pthread_sigmask(SIG_BLOCK, &caught_signals, &previous_signals_mask_);
+
+    signal_fd_ = signalfd(-1, &caught_signals, SFD_CLOEXEC);
+    if (signal_fd_ < 0) // Displays warning if signals will not be caught as expected, but it must NOT be fatal
+        logger_.warn("Posix signals will not be caught: {}", std::strerror(errno));
+    else
+        waitSignal();
+
+    if (tasks_fd_ < 0) // Completed tasks are still pushed with next IO event, but waiting isn't interrupted
+        logger_.warn("Completed tasks will not wake up main loop: {}", std::strerror(errno));
+    else
+        waitCompletedTasks();
+
+    logger_.info("Open IO interface on local port {}.", local_port_);
+
+    acceptClients();
+}
+
+IoUringBackend::~IoUringBackend() {
+    for (const auto& [client_token, connection] : clients_connection_)
+        ::close(connection->fd);
+
+    ::close(listener_fd_);
+
+    if (signal_fd_ >= 0)
+        ::close(signal_fd_);
+
+    if (tasks_fd_ >= 0)
+        ::close(tasks_fd_);
+
+    pthread_sigmask(SIG_SETMASK, &previous_signals_mask_, nullptr);
+}
+
+std::uint16_t IoUringBackend::localPort() const {
+    return local_port_;
+}
+
+const BackpressureStats& IoUringBackend::backpressureStats() const {
+    return backpressure_stats_;
+}
+
+void IoUringBackend::beginTimer(Core::Timer& ready_timer) {
+    // Timers with a slack expire at coalesced steady clock deadlines, so their timeouts complete inside a single wait
+    const std::uint64_t now {
+        static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count())
+    };
+
+    // Retrieves duration to wait and set state to Pending, into std::chrono compatible type
+    const std::chrono::milliseconds countdown {
+        Core::coalescedDeadline(now, ready_timer.beginCountdown(), ready_timer.slack()) - now
+    };
+    const std::uint64_t timer_id { timers_count_++ };
+
+    // Node-based map, so timeout address remains valid until operation completes
+    PendingTimer& pending_timer { pending_timers_[timer_id] };
+    pending_timer.token = ready_timer.token();
+    pending_timer.timeout.tv_sec = countdown.count() / 1000;
+    pending_timer.timeout.tv_nsec = (countdown.count() % 1000) * 1000000;
+
+    io_uring_sqe& timeout { ring_.prepare(IORING_OP_TIMEOUT, -1, userData(Operation::Timer, timer_id)) };
+    timeout.addr = reinterpret_cast<std::uint64_t>(&pending_timer.timeout);
+    timeout.len = 1;
+
+    // If RpT timer is cancelled (clear()), then timeout operation must also be cancelled
+    ready_timer.onNextClear([this, timer_id]() {
+        if (pending_timers_.count(timer_id) == 0) // Already completed
+            return;
+
+        io_uring_sqe& removal {
+            ring_.prepare(IORING_OP_TIMEOUT_REMOVE, -1, userData(Operation::TimerRemoval, timer_id))
+        };
+
+        removal.addr = userData(Operation::Timer, timer_id);
+    });
+}
+
+void IoUringBackend::close() {
+    std::vector<std::uint64_t> client_tokens;
+    // One token for each client
+    client_tokens.reserve(clients_connection_.size());
+
+    // As clients_connection_ elements must not be erased during iteration, killClient() calls are deferred
+    for (const auto& [client_token, connection] : clients_connection_) {
+        if (!connection->closing)
+            client_tokens.push_back(client_token);
+    }
+
+    // Each client must be disconnected
+    for (const std::uint64_t token : client_tokens)
+        killClient(token); // No error, server closed
+
+    synchronize(); // Sends interrupt messages to clients before disconnection
+
+    // Now every client is dead, including ones which were already killed before and not closed yet
+    for (const std::uint64_t dead_client_token : pollKilledClients())
+        closeConnection(dead_client_token);
+
+    // A null event must be pushed so waitForEvent() can properly return
+    // None event must not be handled by Executor so actor UID doesn't matter
+    pushInputEvent(Core::NoneEvent { 0 });
+
+    // Stops accepting connections, pending accept operation will complete
+    shutdown(listener_fd_, SHUT_RDWR);
+
+    // Then IO interface can be considered closed, so completions handled below will not trigger anything else
+    InputOutputInterface::close();
+
+    // Interrupt messages are submitted, and sends which already completed are handled so their connection is shut
+    // down, for others it will be done when backend is destroyed
+    ring_.submit();
+    ring_.forEachCompletion([this](const IoUring::Completion& completion) {
+        handleCompletion(completion);
+    });
+}
+
+
+}
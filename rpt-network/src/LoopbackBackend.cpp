@@ -0,0 +1,236 @@
+#include <RpT-Network/LoopbackBackend.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <RpT-Core/Timer.hpp>
+
+
+namespace RpT::Network {
+
+
+void LoopbackBackend::handleNextClientMessage() {
+    ClientMessage next_message { std::move(clients_messages_.front()) };
+    clients_messages_.pop();
+
+    if (!isConnected(next_message.token)) // Client might have been disconnected after message was sent
+        return;
+
+    try {
+        Core::AnyInputEvent client_triggered_event { handleMessage(next_message.token, next_message.message) };
+
+        // If logout message was sent, client actor is unregistered and connection must be closed
+        if (std::get_if<Core::LeftEvent>(&client_triggered_event) != nullptr)
+            killClient(next_message.token);
+
+        pushInputEvent(std::move(client_triggered_event));
+    } catch (const std::exception& err) { // Any error in message handling results into client disconnection
+        killClient(next_message.token, Utils::HandlingResult { err.what() });
+    }
+}
+
+void LoopbackBackend::triggerNextTimer() {
+    const auto next_timer { pending_timers_.cbegin() };
+
+    // No need to wait for countdown, simulated time has just reached deadline
+    simulated_time_ = next_timer->first;
+    const std::uint64_t token { next_timer->second };
+    pending_timers_.erase(next_timer);
+
+    // Actor UID doesn't matter, timer token does
+    pushInputEvent(Core::TimerEvent { 0, token });
+}
+
+void LoopbackBackend::completeNextTask() {
+    const std::uint64_t token { begun_tasks_.front() };
+    begun_tasks_.pop();
+
+    {
+        std::unique_lock<std::mutex> ran_tasks_lock { ran_tasks_mutex_ };
+        task_ran_.wait(ran_tasks_lock, [this, token]() { return ran_tasks_.count(token) == 1; });
+
+        ran_tasks_.erase(token);
+    }
+
+    // Actor UID doesn't matter, task token does
+    pushInputEvent(Core::TaskCompletedEvent { 0, token });
+}
+
+void LoopbackBackend::syncClient(const std::uint64_t client_token, MessagesQueueView client_messages_queue) {
+    while (client_messages_queue.hasNext()) {
+        const MessageBuffer next_message { client_messages_queue.next() };
+        received_messages_count_++;
+
+        if (received_message_handler_)
+            received_message_handler_(client_token, *next_message);
+    }
+}
+
+void LoopbackBackend::waitForEvent() {
+    // Simulated clients are synced exactly as remote clients would be
+    synchronize();
+
+    while (!inputReady()) {
+        // Only clients killed since previous iteration must be removed
+        for (const std::uint64_t dead_client_token : pollKilledClients()) {
+            connected_clients_.erase(dead_client_token);
+            removeClient(dead_client_token);
+        }
+
+        if (!clients_messages_.empty())
+            handleNextClientMessage();
+        else if (!begun_tasks_.empty())
+            completeNextTask();
+        else if (!pending_timers_.empty())
+            triggerNextTimer();
+        else if (!messages_generator_ || !messages_generator_(*this))
+            close(); // Nothing left to simulate, pushes a null event so loop ends
+    }
+}
+
+void LoopbackBackend::pollReadyEvents() {
+    for (const std::uint64_t dead_client_token : pollKilledClients()) {
+        connected_clients_.erase(dead_client_token);
+        removeClient(dead_client_token);
+    }
+
+    while (!inputReady() && !clients_messages_.empty())
+        handleNextClientMessage();
+}
+
+LoopbackBackend::LoopbackBackend(MessagesGenerator messages_generator, const std::size_t actors_limit)
+: NetworkBackend { actors_limit },
+messages_generator_ { std::move(messages_generator) },
+simulated_time_ { 0 }, received_messages_count_ { 0 }, tokens_count_ { 0 } {}
+
+void LoopbackBackend::onReceivedMessage(ReceivedMessageHandler handler) {
+    received_message_handler_ = std::move(handler);
+}
+
+std::uint64_t LoopbackBackend::connect() {
+    const std::uint64_t new_token { tokens_count_++ };
+
+    addClient(new_token);
+    connected_clients_.insert(new_token);
+
+    return new_token;
+}
+
+void LoopbackBackend::send(const std::uint64_t client_token, std::string message) {
+    clients_messages_.push({ client_token, std::move(message) });
+}
+
+void LoopbackBackend::disconnect(const std::uint64_t client_token) {
+    if (isConnected(client_token)) // Client might already have been killed by server
+        killClient(client_token);
+}
+
+bool LoopbackBackend::isConnected(const std::uint64_t client_token) const {
+    return connected_clients_.count(client_token) == 1 && isAlive(client_token);
+}
+
+std::size_t LoopbackBackend::connectedCount() const {
+    return connected_clients_.size();
+}
+
+std::uint64_t LoopbackBackend::receivedMessagesCount() const {
+    return received_messages_count_;
+}
+
+std::chrono::milliseconds LoopbackBackend::simulatedTime() const {
+    return std::chrono::milliseconds { simulated_time_ };
+}
+
+void LoopbackBackend::beginTimer(Core::Timer& ready_timer) {
+    const std::uint64_t token { ready_timer.token() };
+    // Coalesced as a remote backend would, so timers with a slack trigger at same simulated time
+    const std::uint64_t deadline {
+        Core::coalescedDeadline(simulated_time_, ready_timer.beginCountdown(), ready_timer.slack())
+    };
+
+    pending_timers_.insert({ deadline, token });
+
+    // If RpT timer is cancelled (clear()), then it must not be triggered anymore
+    ready_timer.onNextClear([this, deadline, token]() {
+        const auto [deadline_begin, deadline_end] { pending_timers_.equal_range(deadline) };
+
+        // Timer might already have been triggered, in which case it is no longer pending
+        for (auto timer { deadline_begin }; timer != deadline_end; timer++) {
+            if (timer->second == token) {
+                pending_timers_.erase(timer);
+                return;
+            }
+        }
+    });
+}
+
+void LoopbackBackend::beginTask(const std::uint64_t token) {
+    begun_tasks_.push(token);
+}
+
+void LoopbackBackend::completeTask(const std::uint64_t token) {
+    {
+        const std::lock_guard<std::mutex> ran_tasks_lock { ran_tasks_mutex_ };
+        ran_tasks_.insert(token);
+    }
+
+    task_ran_.notify_one();
+}
+
+void LoopbackBackend::close() {
+    // Each client must be disconnected, including ones which were already killed before and not removed yet
+    for (const std::uint64_t client_token : connected_clients_) {
+        if (isAlive(client_token))
+            killClient(client_token); // No error, server closed
+    }
+
+    synchronize(); // Sends interrupt messages to clients before disconnection
+
+    for (const std::uint64_t dead_client_token : pollKilledClients())
+        removeClient(dead_client_token);
+
+    connected_clients_.clear();
+    pending_timers_.clear();
+    begun_tasks_ = {};
+
+    // A null event must be pushed so waitForEvent() can properly return
+    pushInputEvent(Core::NoneEvent { 0 });
+
+    InputOutputInterface::close();
+}
+
+
+LoopbackScript::LoopbackScript(std::istream& script) : script_ { script } {}
+
+bool LoopbackScript::operator()(LoopbackBackend& backend) {
+    std::string line;
+
+    do { // Skips lines which aren't played
+        if (!std::getline(script_, line))
+            return false;
+    } while (line.empty() || line.front() == '#');
+
+    const std::size_t number_end { std::min(line.find(' '), line.length()) };
+    const char* const line_begin { line.data() };
+
+    std::uint64_t client_number;
+    const auto [parsed_end, err] { std::from_chars(line_begin, line_begin + number_end, client_number) };
+
+    if (err != std::errc {} || parsed_end != line_begin + number_end)
+        throw BadClientMessage { "Invalid client number in loopback script line: " + line };
+
+    auto client_token { clients_token_.find(client_number) };
+    if (client_token == clients_token_.end()) // Client is connected the first time it appears
+        client_token = clients_token_.insert({ client_number, backend.connect() }).first;
+
+    if (number_end == line.length()) { // No message, client leaves
+        backend.disconnect(client_token->second);
+        clients_token_.erase(client_token);
+    } else {
+        backend.send(client_token->second, line.substr(number_end + 1));
+    }
+
+    return true;
+}
+
+
+}
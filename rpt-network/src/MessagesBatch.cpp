@@ -0,0 +1,70 @@
+#include <RpT-Network/MessagesBatch.hpp>
+
+#include <RpT-Network/BinaryRptlCodec.hpp>
+
+#include <array>
+#include <charconv>
+
+
+namespace RpT::Network {
+
+
+/// Max length for an unsigned 64 bits integer string representation, followed by header separator
+constexpr std::size_t MAX_HEADER_LENGTH { 21 };
+
+
+MessagesBatch::MessagesBatch(std::queue<MessageBuffer>& messages_queue, const Envelope envelope) {
+    const std::size_t messages_count { messages_queue.size() };
+
+    messages_.reserve(messages_count);
+    headers_.reserve(messages_count * MAX_HEADER_LENGTH); // Headers must NOT be reallocated once buffers are built
+    buffers_.reserve(messages_count * 2); // One buffer for header, another for message data
+
+    std::vector<std::size_t> headers_length; // Required to build buffers once every header has been written
+    headers_length.reserve(messages_count);
+
+    while (!messages_queue.empty()) {
+        MessageBuffer next_message { std::move(messages_queue.front()) };
+        messages_queue.pop();
+
+        const std::size_t previous_headers_length { headers_.length() };
+
+        if (envelope == Envelope::Binary) { // Writes message size as varint, no separator required
+            BinaryRptlCodec::appendVarint(headers_, next_message->size());
+        } else {
+            std::array<char, MAX_HEADER_LENGTH> header;
+            // Writes message size then header separator
+            char* const header_end {
+                std::to_chars(header.data(), header.data() + header.size(), next_message->size()).ptr
+            };
+            *header_end = ':';
+
+            headers_.append(header.data(), static_cast<std::size_t>(header_end - header.data()) + 1);
+        }
+
+        headers_length.push_back(headers_.length() - previous_headers_length);
+
+        messages_.push_back(std::move(next_message));
+    }
+
+    std::size_t header_offset { 0 }; // Position for next header inside headers string
+    for (std::size_t i { 0 }; i < messages_.size(); i++) {
+        const std::string& message { *messages_[i] };
+
+        buffers_.emplace_back(headers_.data() + header_offset, headers_length[i]);
+        buffers_.emplace_back(message.data(), message.size());
+
+        header_offset += headers_length[i];
+    }
+}
+
+std::size_t MessagesBatch::count() const {
+    return messages_.size();
+}
+
+const std::vector<boost::asio::const_buffer>& MessagesBatch::buffers() const {
+    return buffers_;
+}
+
+
+}
@@ -0,0 +1,158 @@
+#include <RpT-Network/MessagesPool.hpp>
+
+#include <cassert>
+#include <stdexcept>
+
+
+namespace RpT::Network {
+
+
+void MessageBuffer::release() {
+    // Last reference gives storage back, acquire-release so every access made with other handles happened before
+    if (message_ && message_->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        message_->pool->release(*message_);
+
+    message_ = nullptr;
+}
+
+MessageBuffer::MessageBuffer(PooledMessage* const message) : message_ { message } {}
+
+MessageBuffer::MessageBuffer(const MessageBuffer& rhs) : message_ { rhs.message_ } {
+    if (message_) // New reference is taken from an existing one, so ordering doesn't matter
+        message_->references.fetch_add(1, std::memory_order_relaxed);
+}
+
+MessageBuffer& MessageBuffer::operator=(const MessageBuffer& rhs) {
+    PooledMessage* const assigned_message { rhs.message_ }; // Saved as release() resets it on self-assignment
+
+    if (assigned_message) // Taken before release, so self-assignment doesn't give message back
+        assigned_message->references.fetch_add(1, std::memory_order_relaxed);
+
+    release();
+    message_ = assigned_message;
+
+    return *this;
+}
+
+MessageBuffer::MessageBuffer(MessageBuffer&& rhs) noexcept : message_ { rhs.message_ } {
+    rhs.message_ = nullptr;
+}
+
+MessageBuffer& MessageBuffer::operator=(MessageBuffer&& rhs) noexcept {
+    if (this != &rhs) {
+        release();
+
+        message_ = rhs.message_;
+        rhs.message_ = nullptr;
+    }
+
+    return *this;
+}
+
+MessageBuffer::~MessageBuffer() {
+    release();
+}
+
+const std::string& MessageBuffer::operator*() const {
+    return message_->content;
+}
+
+const std::string* MessageBuffer::operator->() const {
+    return message_ ? &message_->content : nullptr;
+}
+
+MessageBuffer::operator bool() const {
+    return message_ != nullptr;
+}
+
+std::size_t MessageBuffer::useCount() const {
+    return message_ ? message_->references.load(std::memory_order_relaxed) : 0;
+}
+
+bool MessageBuffer::operator==(const MessageBuffer& rhs) const {
+    return message_ == rhs.message_;
+}
+
+bool MessageBuffer::operator!=(const MessageBuffer& rhs) const {
+    return !(*this == rhs);
+}
+
+
+void MessagesPool::release(PooledMessage& message) {
+    message.content.clear();
+
+    if (message.content.capacity() > MAX_RETAINED_CAPACITY) // Frees huge data instead of keeping it for small messages
+        message.content.shrink_to_fit();
+
+    const std::lock_guard free_messages_guard { free_messages_lock_ };
+
+    message.nextFree = free_messages_;
+    free_messages_ = &message;
+    in_use_--;
+}
+
+void MessagesPool::allocateSlab() {
+    PooledMessage* const slab { slabs_.emplace_back(new PooledMessage[slab_size_]).get() };
+
+    // Storages still free, if any, are chained after new slab ones
+    for (std::size_t i { 0 }; i < slab_size_; i++) {
+        slab[i].pool = this;
+        slab[i].nextFree = i + 1 < slab_size_ ? &slab[i + 1] : free_messages_;
+    }
+
+    free_messages_ = slab;
+}
+
+MessagesPool::MessagesPool(const std::size_t slab_size)
+: slab_size_ { slab_size }, free_messages_ { nullptr }, in_use_ { 0 } {
+
+    if (slab_size_ == 0)
+        throw std::invalid_argument { "Messages slab size must be at least 1" };
+}
+
+MessagesPool::~MessagesPool() {
+    assert(in_use_ == 0); // Remaining handles would refer to freed slabs
+}
+
+MessageBuffer MessagesPool::acquire(const std::string_view content) {
+    PooledMessage* message;
+
+    {
+        const std::lock_guard free_messages_guard { free_messages_lock_ };
+
+        if (!free_messages_) // Every storage is used, a new slab is chained into free list
+            allocateSlab();
+
+        message = free_messages_;
+        free_messages_ = message->nextFree;
+        in_use_++;
+    }
+
+    // Storage is owned by this thread only until handle is returned, no lock required
+    message->content.assign(content);
+    message->references.store(1, std::memory_order_relaxed);
+
+    return MessageBuffer { message };
+}
+
+void MessagesPool::reserve(const std::size_t messages_count) {
+    const std::lock_guard free_messages_guard { free_messages_lock_ };
+
+    while (slabs_.size() * slab_size_ < messages_count)
+        allocateSlab();
+}
+
+std::size_t MessagesPool::capacity() const {
+    const std::lock_guard free_messages_guard { free_messages_lock_ };
+
+    return slabs_.size() * slab_size_;
+}
+
+std::size_t MessagesPool::inUse() const {
+    const std::lock_guard free_messages_guard { free_messages_lock_ };
+
+    return in_use_;
+}
+
+
+}
@@ -4,20 +4,37 @@
 namespace RpT::Network {
 
 
-MessagesQueueView::MessagesQueueView(std::queue<std::shared_ptr<std::string>>& messages_queue)
-: messages_queue_ { messages_queue } {}
+MessagesQueueView::MessagesQueueView(std::queue<MessageBuffer>& messages_queue)
+: messages_queue_ { messages_queue }, best_effort_queue_ { nullptr } {}
+
+MessagesQueueView::MessagesQueueView(std::queue<MessageBuffer>& critical_queue,
+                                     std::queue<MessageBuffer>& best_effort_queue)
+: messages_queue_ { critical_queue }, best_effort_queue_ { &best_effort_queue } {}
 
 bool MessagesQueueView::hasNext() const {
-    return !messages_queue_.get().empty();
+    return !messages_queue_.get().empty() || (best_effort_queue_ && !best_effort_queue_->empty());
+}
+
+MessagePriority MessagesQueueView::nextPriority() const {
+    if (!hasNext())
+        throw NoMoreMessage {};
+
+    // Best-effort lane is consumed only once critical lane is empty
+    return messages_queue_.get().empty() ? MessagePriority::BestEffort : MessagePriority::Critical;
 }
 
-std::shared_ptr<std::string> MessagesQueueView::next() {
+MessageBuffer MessagesQueueView::next() {
     if (!hasNext()) // Checks for queue to have a RPTL message to pop from queue
         throw NoMoreMessage {};
 
+    // Critical lane first, then best-effort one
+    std::queue<MessageBuffer>& next_queue {
+        messages_queue_.get().empty() ? *best_effort_queue_ : messages_queue_.get()
+    };
+
     // Pops message from queue
-    std::shared_ptr<std::string> popped_message { messages_queue_.get().front() }; // Saves message
-    messages_queue_.get().pop(); // Removes it
+    MessageBuffer popped_message { next_queue.front() }; // Saves message
+    next_queue.pop(); // Removes it
 
     return popped_message;
 }
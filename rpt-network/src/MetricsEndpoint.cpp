@@ -0,0 +1,151 @@
+#include <RpT-Network/MetricsEndpoint.hpp>
+
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http.hpp>
+
+
+namespace RpT::Network {
+
+
+namespace {
+
+
+/// Content type for Prometheus text exposition format
+constexpr std::string_view EXPOSITION_CONTENT_TYPE { "text/plain; version=0.0.4; charset=utf-8" };
+
+/// Content type for availability body
+constexpr std::string_view STATUS_CONTENT_TYPE { "application/json" };
+
+/// Maximum size for a scrape request, scrapers only send a few headers
+constexpr std::uint64_t REQUEST_BODY_LIMIT { 8 * 1024 };
+
+
+/// Connected scraper, owning buffers until response has been written
+struct ScrapeSession {
+    boost::asio::ip::tcp::socket connection;
+    boost::beast::flat_buffer readBuffer;
+    boost::beast::http::request_parser<boost::beast::http::empty_body> request;
+    boost::beast::http::response<boost::beast::http::string_body> response;
+
+    explicit ScrapeSession(boost::asio::ip::tcp::socket scraper_connection)
+    : connection { std::move(scraper_connection) } {
+        request.body_limit(REQUEST_BODY_LIMIT);
+    }
+};
+
+
+}
+
+
+void MetricsEndpoint::acceptNext() {
+    acceptor_.async_accept([this](const boost::system::error_code& err, boost::asio::ip::tcp::socket connection) {
+        if (err == boost::asio::error::operation_aborted) // Endpoint is stopping
+            return;
+
+        if (!err) // A failed accept only affects that scraper
+            serve(std::move(connection));
+
+        acceptNext();
+    });
+}
+
+std::string MetricsEndpoint::formatMetrics() const {
+    std::ostringstream body;
+
+    metrics_.exportTo(body);
+    if (latencies_)
+        latencies_->exportTo(body);
+
+    if (slow_requests_)
+        slow_requests_->exportTo(body);
+
+    return body.str();
+}
+
+std::string MetricsEndpoint::formatStatus() const {
+    std::ostringstream body;
+
+    body << "{\"actors\":" << metrics_.registeredActors() << ",\"limit\":" << metrics_.actorsLimit()
+         << ",\"rooms\":" << metrics_.occupiedRooms() << ",\"saturation\":" << metrics_.loopSaturation() << '}';
+
+    return body.str();
+}
+
+bool MetricsEndpoint::available() const {
+    return metrics_.ready() && !metrics_.overloaded() && metrics_.registeredActors() < metrics_.actorsLimit();
+}
+
+void MetricsEndpoint::serve(boost::asio::ip::tcp::socket scraper_connection) {
+    const auto session { std::make_shared<ScrapeSession>(std::move(scraper_connection)) };
+
+    boost::beast::http::async_read(session->connection, session->readBuffer, session->request, [this, session](
+            const boost::system::error_code& err, const std::size_t) {
+
+        if (err) // Ill-formed or aborted request, connection is closed when session is destroyed
+            return;
+
+        const auto& request { session->request.get() };
+        const std::string_view request_target { request.target().data(), request.target().size() };
+        auto& response { session->response };
+
+        response.version(request.version());
+        response.keep_alive(false); // One scrape for each connection
+
+        if (request.method() != boost::beast::http::verb::get) {
+            response.result(boost::beast::http::status::method_not_allowed);
+            response.set(boost::beast::http::field::allow, "GET");
+        } else if (request_target == STATUS_TARGET) { // Health checked, load balancer only reads status code
+            response.result(available() ? boost::beast::http::status::ok
+                                        : boost::beast::http::status::service_unavailable);
+            response.set(boost::beast::http::field::content_type, boost::beast::string_view {
+                STATUS_CONTENT_TYPE.data(), STATUS_CONTENT_TYPE.size()
+            });
+            response.body() = formatStatus();
+        } else if (request_target != METRICS_TARGET) {
+            response.result(boost::beast::http::status::not_found);
+        } else {
+            response.result(boost::beast::http::status::ok);
+            response.set(boost::beast::http::field::content_type, boost::beast::string_view {
+                EXPOSITION_CONTENT_TYPE.data(), EXPOSITION_CONTENT_TYPE.size()
+            });
+            response.body() = formatMetrics();
+        }
+
+        response.prepare_payload();
+
+        boost::beast::http::async_write(session->connection, response, [session](
+                const boost::system::error_code&, const std::size_t) {
+
+            boost::system::error_code ignored_err; // Scraper might already have closed connection
+            session->connection.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored_err);
+        });
+    });
+}
+
+MetricsEndpoint::MetricsEndpoint(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                                 const Utils::RuntimeMetrics& metrics, Utils::LoggingContext& logging_context,
+                                 const Utils::PipelineLatencies* const latencies,
+                                 const Utils::SlowRequestSampler* const slow_requests)
+: metrics_ { metrics }, latencies_ { latencies }, slow_requests_ { slow_requests },
+acceptor_ { listener_context_, local_endpoint } {
+    Utils::LoggerView { "Metrics", logging_context }.info("Serving metrics on local port {}.", localPort());
+
+    acceptNext();
+
+    listener_thread_ = std::thread { [this]() { listener_context_.run(); } };
+}
+
+MetricsEndpoint::~MetricsEndpoint() {
+    listener_context_.stop(); // Pending accept and sessions are dropped with context
+    listener_thread_.join();
+}
+
+std::uint16_t MetricsEndpoint::localPort() const {
+    return acceptor_.local_endpoint().port();
+}
+
+
+}
@@ -2,14 +2,22 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
 #include <RpT-Core/ServiceEvent.hpp>
+#include <RpT-Utils/AllocationProfiler.hpp>
 
 
 namespace RpT::Network {
 
 
 NetworkBackend::RptlCommandParser::RptlCommandParser(const std::string_view rptl_command)
-: Utils::TextProtocolParser { rptl_command, 1 } {}
+: Utils::TextProtocolParser { rptl_command, 1, std::nothrow } {}
+
+bool NetworkBackend::RptlCommandParser::isEmpty() const {
+    return !hasExpectedWords(); // Command name couldn't be parsed if there isn't any word
+}
 
 std::string_view NetworkBackend::RptlCommandParser::invokedCommandName() const {
     return getParsedWord(0);
@@ -21,23 +29,22 @@ std::string_view NetworkBackend::RptlCommandParser::invokedCommandArgs() const {
 
 
 NetworkBackend::HandshakeParser::HandshakeParser(const NetworkBackend::RptlCommandParser& parsed_rptl_command)
-: Utils::TextProtocolParser { parsed_rptl_command.invokedCommandArgs(), 2 } {
+: Utils::TextProtocolParser { parsed_rptl_command, 2, std::nothrow } { // Continues after RPTL command name
 
     // Parsed handshake must be an handshake command
     assert(parsed_rptl_command.invokedCommandName() == HANDSHAKE_COMMAND);
 
+    if (!hasExpectedWords()) // Checks for syntax, actor UID and name are required
+        throw BadClientMessage { "Actor UID and name expected with command " + std::string { HANDSHAKE_COMMAND } };
+
     if (!unparsedWords().empty()) // Checks for syntax, there must NOT be any remaining argument
         throw TooManyArguments { HANDSHAKE_COMMAND };
 
-    try {
-        const std::string actor_uid_copy { getParsedWord(0) }; // Required for conversion to unsigned integer
-
-        // `unsigned long long` return type, which is ALWAYS 64 bits large
-        // See: https://en.cppreference.com/w/cpp/language/types
-        parsed_actor_uid_ = std::stoull(actor_uid_copy);
-    } catch (const std::invalid_argument&) { // If parsed actor UID argument isn't a valid unsigned integer
+    const std::optional<std::uint64_t> parsed_actor_uid { parseInteger<std::uint64_t>(getParsedWord(0)) };
+    if (!parsed_actor_uid.has_value()) // If parsed actor UID argument isn't a valid unsigned integer
         throw BadClientMessage { "Actor UID must be an unsigned integer of 64 bits" };
-    }
+
+    parsed_actor_uid_ = *parsed_actor_uid;
 }
 
 std::uint64_t NetworkBackend::HandshakeParser::actorUID() const {
@@ -49,149 +56,269 @@ std::string_view NetworkBackend::HandshakeParser::actorName() const {
 }
 
 
-NetworkBackend::ServiceCommandParser::ServiceCommandParser(
-        const NetworkBackend::RptlCommandParser& parsed_rptl_command)
-        : Utils::TextProtocolParser { parsed_rptl_command.invokedCommandArgs(), 0 } {
+NetworkBackend::ResumeParser::ResumeParser(const NetworkBackend::RptlCommandParser& parsed_rptl_command)
+: Utils::TextProtocolParser { parsed_rptl_command, 2, std::nothrow } { // Continues after RPTL command name
+
+    // Parsed command must be a resume command
+    assert(parsed_rptl_command.invokedCommandName() == RESUME_COMMAND);
+
+    if (!hasExpectedWords()) // Checks for syntax, actor UID and secret are required
+        throw BadClientMessage { "Actor UID and secret expected with command " + std::string { RESUME_COMMAND } };
+
+    if (!unparsedWords().empty()) // Checks for syntax, there must NOT be any remaining argument
+        throw TooManyArguments { RESUME_COMMAND };
+
+    const std::optional<std::uint64_t> parsed_actor_uid { parseInteger<std::uint64_t>(getParsedWord(0)) };
+    const std::optional<std::uint64_t> parsed_secret { parseInteger<std::uint64_t>(getParsedWord(1)) };
+    if (!parsed_actor_uid.has_value() || !parsed_secret.has_value())
+        throw BadClientMessage { "Actor UID and secret must be unsigned integers of 64 bits" };
+
+    parsed_actor_uid_ = *parsed_actor_uid;
+    parsed_secret_ = *parsed_secret;
+}
+
+std::uint64_t NetworkBackend::ResumeParser::actorUID() const {
+    return parsed_actor_uid_;
+}
 
-    assert(parsed_rptl_command.invokedCommandName() == SERVICE_COMMAND); // Parsed command must be `SERVICE`
+std::uint64_t NetworkBackend::ResumeParser::secret() const {
+    return parsed_secret_;
 }
 
-std::string_view NetworkBackend::ServiceCommandParser::serviceRequest() const {
-    return unparsedWords(); // SR command parsing left to SER Protocol
+
+std::queue<MessageBuffer>& NetworkBackend::ClientRecord::remainingMessagesFor(const MessagePriority priority) {
+    return priority == MessagePriority::BestEffort ? remainingBestEffortMessages : remainingMessages;
 }
 
 
+
 Core::AnyInputEvent NetworkBackend::handleFromUnregistered(const std::uint64_t client_token,
-                                                           const std::string& message) {
+                                                           const std::string_view message) {
 
-    try { // Tries to parse received RPTL command, will fail if command is empty
-        const RptlCommandParser command_parser { message };
+    const RptlCommandParser command_parser { message };
 
-        const std::string_view invoked_command_name { command_parser.invokedCommandName() };
-        // Current actors number needed in both maybe invoked command
-        const std::size_t actors_count { actors_registry_.size() };
+    if (command_parser.isEmpty()) // Unable to parse invoked command name
+        throw EmptyRptlCommand {};
 
-        // Checks for each available command name if it is invoked by received RPTL message
-        if (invoked_command_name == CHECKOUT_COMMAND) {
-            if (!command_parser.invokedCommandArgs().empty()) // Check for command to not have any additional argument
-                throw BadClientMessage { "No arguments expected with command CHECKOUT" };
+    const std::string_view invoked_command_name { command_parser.invokedCommandName() };
+    // Current actors number needed in both maybe invoked command
+    const std::size_t actors_count { actors_registry_.size() };
 
-            std::string availability_response { // Formats AVAILABILITY command message to respond checkout
-                std::string { AVAILABILITY_COMMAND }
-                + ' ' + std::to_string(actors_count) + ' ' + std::to_string(actors_limit_)
-            };
+    // Checks for each available command name if it is invoked by received RPTL message
+    if (invoked_command_name == CHECKOUT_COMMAND) {
+        if (!command_parser.invokedCommandArgs().empty()) // Check for command to not have any additional argument
+            throw BadClientMessage { "No arguments expected with command CHECKOUT" };
 
-            // Push response into messages queue for asking client
-            privateMessage(client_token, std::move(availability_response));
+        std::string availability_response { // Formats AVAILABILITY command message to respond checkout
+            std::string { AVAILABILITY_COMMAND }
+            + ' ' + std::to_string(actors_count) + ' ' + std::to_string(actors_limit_)
+        };
 
-            return Core::NoneEvent { 0 }; // Actor doesn't matter, no modification on server state so null event
-        } else if (invoked_command_name == HANDSHAKE_COMMAND) {
-            const HandshakeParser handshake_parser { command_parser };
-            const std::uint64_t new_actor_uid { handshake_parser.actorUID() };
+        // Push response into messages queue for asking client
+        privateMessage(client_token, availability_response);
 
-            if (actors_count >= actors_limit_) // Checks if server is full
-                throw InternalError { "Limit of " + std::to_string(actors_limit_) + " reached" };
+        return Core::NoneEvent { 0 }; // Actor doesn't matter, no modification on server state so null event
+    } else if (invoked_command_name == HANDSHAKE_COMMAND) {
+        const HandshakeParser handshake_parser { command_parser };
+        const std::uint64_t new_actor_uid { handshake_parser.actorUID() };
 
-            if (isRegistered(new_actor_uid)) // Checks if new actor UID is available
-                throw InternalError { "Player UID \"" + std::to_string(new_actor_uid) + "\" is not available" };
+        if (actors_count >= actors_limit_) // Checks if server is full
+            throw InternalError { "Limit of " + std::to_string(actors_limit_) + " reached" };
 
-            std::string new_actor_name { handshake_parser.actorName() };
+        if (load_ && load_->overloaded()) { // New players are shed first, so running matches keep their latency
+            if (metrics_)
+                metrics_->handshakeShed();
 
-            try { // Tries to register actor, implementation registration may fail
-                registerActor(client_token, new_actor_uid, new_actor_name);
+            throw InternalError { "Server is overloaded, try again later" };
+        }
+
+        if (isRegistered(new_actor_uid)) // Checks if new actor UID is available
+            throw InternalError { "Player UID \"" + std::to_string(new_actor_uid) + "\" is not available" };
 
-                // If registration hasn't been done at this point, this is an implementation error
-                assert(isRegistered(new_actor_uid));
+        std::string new_actor_name { handshake_parser.actorName() };
 
-                // Client must be synced about its own registration
-                privateMessage(client_token, formatRegistrationMessage());
+        try { // Tries to register actor, implementation registration may fail
+            registerActor(client_token, new_actor_uid, new_actor_name);
 
-                // Formats message to notify actors that player joined server
-                std::string logged_in_message {
-                        std::string { LOGGED_IN_COMMAND }
-                        + ' ' + std::to_string(new_actor_uid) + ' ' + new_actor_name
-                };
-                // All players should be aware about new registered player
-                broadcastMessage(std::move(logged_in_message));
-            } catch (const std::exception& err) { // It it fails, then registration must NOT have been done
-                // If registration is still active at this point, this is an implementation error and server must stop
-                assert(!isRegistered(new_actor_uid));
+            // If registration hasn't been done at this point, this is an implementation error
+            assert(isRegistered(new_actor_uid));
 
-                // Handshaking is valid, but server is currently unable to register actor
-                throw InternalError { err.what() };
-            }
+            // Client must be synced about its own registration
+            privateMessage(client_token, registrationMessage());
 
-            // Returns event triggered by actor registration, takes reference to actor's name, no copy done on string
-            return Core::JoinedEvent { new_actor_uid, std::move(new_actor_name) };
-        } else { // If none of available commands is being invoked, then invoked command is unknown
-            throw BadClientMessage {
-                "Unknown RPTL command for unregistered mode: " + std::string { invoked_command_name }
+            // Formats message to notify actors that player joined server
+            std::string logged_in_message {
+                    std::string { LOGGED_IN_COMMAND }
+                    + ' ' + std::to_string(new_actor_uid) + ' ' + new_actor_name
             };
+            // All players should be aware about new registered player
+            broadcastRosterChange(logged_in_message);
+        } catch (const std::exception& err) { // It it fails, then registration must NOT have been done
+            // If registration is still active at this point, this is an implementation error and server must stop
+            assert(!isRegistered(new_actor_uid));
+
+            // Handshaking is valid, but server is currently unable to register actor
+            throw InternalError { err.what() };
         }
-    } catch (const Utils::NotEnoughWords&) { // If command is empty, unable to parse invoked command name
-        throw EmptyRptlCommand {};
+
+        // Returns event triggered by actor registration, takes reference to actor's name, no copy done on string
+        return Core::JoinedEvent { new_actor_uid, std::move(new_actor_name) };
+    } else if (invoked_command_name == RESUME_COMMAND) {
+        const ResumeParser resume_parser { command_parser };
+
+        resumeSession(client_token, resume_parser.actorUID(), resume_parser.secret());
+
+        return Core::NoneEvent { resume_parser.actorUID() }; // Actor never left, so server state isn't modified
+    } else { // If none of available commands is being invoked, then invoked command is unknown
+        throw BadClientMessage {
+            "Unknown RPTL command for unregistered mode: " + std::string { invoked_command_name }
+        };
     }
 }
 
 Core::AnyInputEvent RpT::Network::NetworkBackend::handleFromActor(uint64_t client_actor,
-                                                                  const std::string& regular_message) {
+                                                                  const std::string_view regular_message) {
 
-    try { // Tries to parse received RPTL command, will fail if command is empty
-        const RptlCommandParser command_parser { regular_message };
+    const RptlCommandParser command_parser { regular_message };
 
-        const std::string_view invoked_command_name { command_parser.invokedCommandName() };
+    if (command_parser.isEmpty()) // If there isn't any word to parse (if command is empty)
+        throw EmptyRptlCommand {};
 
-        // Checks for each available command name if it is invoked by received RPTL message
-        if (invoked_command_name == SERVICE_COMMAND) {
-            const ServiceCommandParser service_command_parser { command_parser }; // Parse specific SERVICE command
+    const std::string_view invoked_command_name { command_parser.invokedCommandName() };
 
-            // Copy required to be moved as string inside emitted event
-            std::string sr_command_copy { service_command_parser.serviceRequest() };
+    // Checks for each available command name if it is invoked by received RPTL message
+    if (invoked_command_name == SERVICE_COMMAND) {
+        // Rate is checked before SR command is copied then parsed, so flooding actor costs as little as possible
+        if (requests_limiter_ && !requests_limiter_->allow(client_actor, RequestRateLimiter::Clock::now())) {
+            if (metrics_)
+                metrics_->requestRateLimited();
 
-            // Returns input event triggered by received Service Request command from given actor with new SR command
-            return Core::ServiceRequestEvent { client_actor, std::move(sr_command_copy) };
-        } else if (invoked_command_name == LOGOUT_COMMAND) {
-            if (!command_parser.invokedCommandArgs().empty()) // If any extra arg detected, command call is ill-formed
-                throw TooManyArguments { LOGOUT_COMMAND };
+            return Core::NoneEvent { client_actor }; // Dropped, server state isn't modified
+        }
 
-            // Saves token for client owning current actor before it will be unregister
-            const std::uint64_t owner_client { actors_registry_.at(client_actor) };
+        // SR command is every SERVICE argument, already trimmed by RPTL parser so its parsing is left to SER Protocol.
+        // Only copy done on inbound path, required as emitted event outlives received message buffer.
+        std::string sr_command_copy { command_parser.invokedCommandArgs() };
 
-            unregisterActor(client_actor);
+        // Returns input event triggered by received Service Request command from given actor with new SR command
+        return Core::ServiceRequestEvent { client_actor, std::move(sr_command_copy) };
+    } else if (invoked_command_name == ROSTER_DELTA_COMMAND) {
+        if (!command_parser.invokedCommandArgs().empty()) // If any extra arg detected, command call is ill-formed
+            throw TooManyArguments { ROSTER_DELTA_COMMAND };
 
-            // If actor is still registered, it is an implementation error
-            assert(!isRegistered(client_actor));
+        ClientRecord& client { connected_clients_.at(actors_registry_.at(client_actor)) };
 
-            // Client must be aware it has been logged out properly
-            privateMessage(owner_client, std::string { INTERRUPT_COMMAND });
-            // Players must be notified about current player disconnection
-            broadcastMessage(std::string { LOGGED_OUT_COMMAND } + ' ' + std::to_string(client_actor));
+        if (!client.rosterDeltaOffset.has_value()) { // Enabling it again doesn't change anything
+            // Changes already pending have been pushed to client as LOGGED_IN and LOGGED_OUT messages
+            client.rosterDeltaOffset = pending_roster_delta_.size();
+            roster_delta_clients_++;
+        }
 
-            // Returns input event triggered by player disconnection (or unregistration)
-            // RPTL command way disconnection, clean
-            return Core::LeftEvent { client_actor };
-        } else { // If none of available commands is being invoked, then invoked command is unknown
-            throw BadClientMessage {
-                "Unknown RPTL command fom registered mode: " + std::string { invoked_command_name }
-            };
+        return Core::NoneEvent { client_actor }; // Server state isn't modified
+    } else if (invoked_command_name == SESSION_COMMAND) {
+        if (!command_parser.invokedCommandArgs().empty()) // If any extra arg detected, command call is ill-formed
+            throw TooManyArguments { SESSION_COMMAND };
+
+        const std::uint64_t owner_client { actors_registry_.at(client_actor) };
+        ClientRecord& client { connected_clients_.at(owner_client) };
+
+        if (!client.sessionSecret.has_value()) { // Enabling it again sends same secret
+            std::uint64_t secret;
+            if (RAND_bytes(reinterpret_cast<unsigned char*>(&secret), sizeof(secret)) != 1)
+                throw InternalError { "Unable to generate session secret" };
+
+            client.sessionSecret = secret;
         }
-    } catch (const Utils::NotEnoughWords&) { // If there isn't any word to parse (if command is empty)
-        throw EmptyRptlCommand {};
+
+        privateMessage(owner_client, std::string { SESSION_COMMAND } + ' ' + std::to_string(*client.sessionSecret));
+
+        return Core::NoneEvent { client_actor }; // Server state isn't modified
+    } else if (invoked_command_name == LOGOUT_COMMAND) {
+        if (!command_parser.invokedCommandArgs().empty()) // If any extra arg detected, command call is ill-formed
+            throw TooManyArguments { LOGOUT_COMMAND };
+
+        // Saves token for client owning current actor before it will be unregister
+        const std::uint64_t owner_client { actors_registry_.at(client_actor) };
+
+        unregisterActor(client_actor);
+
+        // If actor is still registered, it is an implementation error
+        assert(!isRegistered(client_actor));
+
+        // Client must be aware it has been logged out properly
+        privateMessage(owner_client, std::string { INTERRUPT_COMMAND });
+        // Players must be notified about current player disconnection
+        broadcastRosterChange(std::string { LOGGED_OUT_COMMAND } + ' ' + std::to_string(client_actor));
+
+        // Returns input event triggered by player disconnection (or unregistration)
+        // RPTL command way disconnection, clean
+        return Core::LeftEvent { client_actor };
+    } else { // If none of available commands is being invoked, then invoked command is unknown
+        throw BadClientMessage {
+            "Unknown RPTL command fom registered mode: " + std::string { invoked_command_name }
+        };
     }
 }
 
-Core::AnyInputEvent NetworkBackend::handleMessage(const std::uint64_t client_token, const std::string& client_message) {
+Core::AnyInputEvent NetworkBackend::handleMessage(const std::uint64_t client_token,
+                                                  const std::string_view client_message,
+                                                  const Utils::PipelineLatencies::Clock::time_point received_at) {
+
+    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
+
     // RPTL message source potential registered actor
-    const std::optional<Actor> client_actor { connected_clients_.at(client_token).second };
+    const std::optional<Actor> client_actor { connected_clients_.at(client_token).actor };
+
+    if (metrics_)
+        metrics_->bytesReceived(client_message.size());
+
+    if (!latencies_) { // Clock isn't read if nothing is recorded
+        Core::AnyInputEvent triggered_event { client_actor.has_value()
+                ? handleFromActor(client_actor->uid, client_message) // Handle command for registered actor
+                : handleFromUnregistered(client_token, client_message)
+        };
+
+        // Read time point given by implementation still travels with event, so slow requests can be sampled
+        if (received_at != Utils::PipelineLatencies::Clock::time_point {}) {
+            std::visit([received_at](Core::InputEvent& event) {
+                event.receivedAt(received_at);
+            }, triggered_event);
+        }
+
+        return triggered_event;
+    }
+
+    const auto parsing_begin { Utils::PipelineLatencies::Clock::now() };
+
+    Core::AnyInputEvent triggered_event { client_actor.has_value()
+            ? handleFromActor(client_actor->uid, client_message)
+            : handleFromUnregistered(client_token, client_message)
+    };
+
+    latencies_->recordSince(Utils::PipelineStage::Parse, parsing_begin);
+
+    // Receive time point travels with event, so Executor can record time until it is handled
+    const auto event_received_at {
+        received_at == Utils::PipelineLatencies::Clock::time_point {} ? parsing_begin : received_at
+    };
 
-    if (!client_actor.has_value()) // If no actor is registered for RPTL message client
-        return handleFromUnregistered(client_token, client_message);
-    else // If any actor is actually registered for RPTL message client
-        return handleFromActor(client_actor->uid, client_message); // Handle command for registered actor
+    std::visit([event_received_at](Core::InputEvent& event) {
+        event.receivedAt(event_received_at);
+    }, triggered_event);
+
+    return triggered_event;
+}
+
+Utils::PipelineLatencies* NetworkBackend::latencies() const {
+    return latencies_;
 }
 
-void NetworkBackend::pushInputEvent(Core::AnyInputEvent input_event) {
-    input_events_queue_.push(std::move(input_event)); // Move triggered input event into queue
+Utils::RuntimeMetrics* NetworkBackend::metrics() const {
+    return metrics_;
+}
+
+MessagesPool& NetworkBackend::messagesPool() {
+    return messages_pool_;
 }
 
 std::optional<Core::AnyInputEvent> NetworkBackend::pollInputEvent() {
@@ -199,32 +326,61 @@ std::optional<Core::AnyInputEvent> NetworkBackend::pollInputEvent() {
         return {};
 
     /*
-     * Else, moves polled event, removes it from queue and retrieves it
+     * Else, moves polled event directly into retrieved value, then removes it from queue
      */
 
-    Core::AnyInputEvent polled_event { std::move(input_events_queue_.front()) };
+    std::optional<Core::AnyInputEvent> polled_event { std::in_place, std::move(input_events_queue_.front()) };
     input_events_queue_.pop();
 
     return polled_event;
 }
 
+void NetworkBackend::pushCompletedTasks() {
+    std::vector<std::uint64_t> completed_tasks;
+    {
+        const std::lock_guard<std::mutex> completed_tasks_lock { completed_tasks_mutex_ };
+        completed_tasks.swap(completed_tasks_);
+    }
+
+    for (const std::uint64_t task_token : completed_tasks)
+        pushInputEvent(Core::TaskCompletedEvent { 0, task_token }); // Actor UID doesn't matter, task token does
+}
+
+void NetworkBackend::wakeForCompletedTasks() {}
+
 bool NetworkBackend::inputReady() const {
     return !input_events_queue_.empty();
 }
 
 void NetworkBackend::synchronize() {
-    // For each client messages queue
-    for (auto& [client_token, messages_queue] : clients_remaining_messages_) {
+    const Utils::TraceSpan sync_span { tracer_, "synchronize" };
+    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
+
+    if (!session_deadlines_.empty()) // Clock isn't read if no grace deadline is pending
+        closeExpiredSessions();
+
+    pushRosterDeltas(); // Roster changes are coalesced until clients are synced
+
+    // For each client messages queue, implementation must not add or remove clients while syncing
+    for (auto& [client_token, client] : connected_clients_) {
+        if (client.detachedUntil.has_value()) // No connection to sync, messages are kept until session is resumed
+            continue;
+
         // Syncs current client providing an access to queue for messages that need to be sent
-        syncClient(client_token, MessagesQueueView { messages_queue });
+        syncClient(client_token, MessagesQueueView { client.remainingMessages, client.remainingBestEffortMessages });
     }
 }
 
 Core::AnyInputEvent NetworkBackend::waitForInput() {
+    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
+
     // Checks for events inside queue before waiting for new input events
     std::optional<Core::AnyInputEvent> last_input_event { pollInputEvent() };
     if (last_input_event.has_value())
-        return *last_input_event;
+        return std::move(*last_input_event);
+
+    // Tasks completed meanwhile don't have to be waited for, but clients are still synced by implementation
+    pushCompletedTasks();
 
     // If queue is empty, new input event must be waited for by NetworkBackend implementation
     waitForEvent();
@@ -233,50 +389,99 @@ Core::AnyInputEvent NetworkBackend::waitForInput() {
     assert(inputReady());
 
     // Then waited for event must be retrieved
-    return *pollInputEvent();
+    return std::move(*pollInputEvent());
 }
 
-void NetworkBackend::registerActor(const std::uint64_t client_token, const std::uint64_t actor_uid, std::string name) {
-    // Checks over all alive actors for UID availability, it must already exists inside actors registry
-    for (const auto& client : connected_clients_) {
-        const std::optional<Actor>& client_actor { client.second.second };  // Second value of client status, actor
+std::optional<Core::AnyInputEvent> NetworkBackend::pollInput() {
+    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
 
-        // Only checks for initialized actor (only alive actors can have initialized actor)
-        if (client_actor.has_value()) {
-            if (client_actor->uid == actor_uid) // First, checks for UID
-                throw std::invalid_argument { "Actor UID " + std::to_string(actor_uid) + " unavailable" };
+    if (!inputReady()) // Completed tasks are pushed only if every queued event has been handled
+        pushCompletedTasks();
 
-            if (client_actor->name == name) // Then, checks for name
-                throw std::invalid_argument { "Actor name \"" + name + "\" unavailable" };
-        }
+    if (!inputReady()) // Completed operations are handled only if every queued event has been handled
+        pollReadyEvents();
+
+    return pollInputEvent();
+}
+
+void NetworkBackend::pollReadyEvents() {}
+
+void NetworkBackend::spinForEvent() {
+    if (busy_poll_window_.count() == 0)
+        return;
+
+    // Window begins once clients have been synced, so sending their messages isn't counted as spinning
+    const auto spin_end { std::chrono::steady_clock::now() + busy_poll_window_ };
+    while (!inputReady() && std::chrono::steady_clock::now() < spin_end)
+        pollReadyEvents();
+}
+
+std::size_t NetworkBackend::pendingInputs() const {
+    return input_events_queue_.size();
+}
+
+void NetworkBackend::completeTask(const std::uint64_t token) {
+    {
+        const std::lock_guard<std::mutex> completed_tasks_lock { completed_tasks_mutex_ };
+        completed_tasks_.push_back(token);
     }
 
+    wakeForCompletedTasks();
+}
+
+void NetworkBackend::registerActor(const std::uint64_t client_token, const std::uint64_t actor_uid,
+                                   const std::string_view name) {
+
+    // First, checks for UID availability, only alive actors are inside registry
+    if (isRegistered(actor_uid))
+        throw std::invalid_argument { "Actor UID " + std::to_string(actor_uid) + " unavailable" };
+
+    // Then, checks for name availability, only alive actors names are interned
+    if (actor_names_.contains(name))
+        throw std::invalid_argument { "Actor name \"" + std::string { name } + "\" unavailable" };
+
     // Checks for client to exists
-    if (connected_clients_.count(client_token) == 0)
+    const auto client_entry { connected_clients_.find(client_token) };
+    if (client_entry == connected_clients_.end())
         throw UnknownClientToken { client_token };
 
-    auto& [client_status, client_actor] { connected_clients_.at(client_token) };
+    ClientRecord& client { client_entry->second };
 
     // Checks for client to have alive connection
-    if (!client_status.alive)
+    if (!client.status.alive)
         throw std::invalid_argument { "Client with token " + std::to_string(client_token) + " is no longer alive" };
 
-    // Initializes actor for given client
-    client_actor = { actor_uid, std::move(name) };
+    // Initializes actor for given client, name being stored once inside names table
+    const std::optional<Utils::NamesTable::NameId> name_id { actor_names_.insert(name) };
+    assert(name_id.has_value()); // Checks for name insertion
+
+    client.actor = { actor_uid, *name_id };
     // Inserts initialized actor UID into registry
     const auto uid_insert_result { actors_registry_.insert({ actor_uid, client_token }) };
 
     assert(uid_insert_result.second); // Checks for UID insertion
+
+    if (!registration_message_stale_) { // Cached roster only needs new actor, if it isn't formatted again anyway
+        registration_message_ += ' ';
+        registration_message_ += std::to_string(actor_uid);
+        registration_message_ += ' ';
+        registration_message_ += name;
+    }
+
+    if (metrics_)
+        metrics_->actorRegistered();
 }
 
-void NetworkBackend::privateMessage(const std::uint64_t client_token, std::string new_message) {
-    const auto new_message_owner { std::make_shared<std::string>(std::move(new_message)) };
+void NetworkBackend::privateMessage(const std::uint64_t client_token, const std::string_view new_message,
+                                    const MessagePriority priority) {
 
-    clients_remaining_messages_.at(client_token).push(new_message_owner);
+    connected_clients_.at(client_token).remainingMessagesFor(priority).push(messages_pool_.acquire(new_message));
 }
 
-void NetworkBackend::targetMessage(const std::unordered_set<std::uint64_t>& target_uids, std::string new_message) {
-    const auto new_message_owner { std::make_shared<std::string>(std::move(new_message)) };
+void NetworkBackend::targetMessage(const Core::ActorUidsSet& target_uids, const std::string_view new_message,
+                                   const MessagePriority priority) {
+
+    const MessageBuffer new_message_owner { messages_pool_.acquire(new_message) };
 
     // For each actor this message is targeting for
     for (const auto target_actor : target_uids) {
@@ -284,21 +489,82 @@ void NetworkBackend::targetMessage(const std::unordered_set<std::uint64_t>& targ
         const std::uint64_t actor_owner { actors_registry_.at(target_actor) };
 
         // Actors queue will share the same data for a broadcast message
-        clients_remaining_messages_.at(actor_owner).push(new_message_owner);
+        connected_clients_.at(actor_owner).remainingMessagesFor(priority).push(new_message_owner);
+    }
+}
+
+void NetworkBackend::broadcastMessage(const std::string_view new_message, const MessagePriority priority) {
+    const MessageBuffer new_message_owner { messages_pool_.acquire(new_message) };
+
+    // Every registered actor is targeted, so registry is walked directly instead of copying each UID inside a set
+    for (const auto [actor_uid, actor_owner] : actors_registry_) {
+        // Actors queue will share the same data for a broadcast message
+        connected_clients_.at(actor_owner).remainingMessagesFor(priority).push(new_message_owner);
+    }
+}
+
+void NetworkBackend::broadcastRosterChange(const std::string_view roster_message) {
+    if (roster_delta_clients_ == 0) { // Every actor receives change right now, and it doesn't have to be kept
+        broadcastMessage(roster_message);
+
+        return;
+    }
+
+    pending_roster_delta_ += ' ';
+    pending_roster_delta_ += roster_message;
+
+    // Copied into pool once a client which didn't enable ROSTER_DELTA is found, then shared with next ones
+    MessageBuffer roster_message_owner;
+
+    for (const auto [actor_uid, actor_owner] : actors_registry_) {
+        ClientRecord& client { connected_clients_.at(actor_owner) };
+
+        if (client.rosterDeltaOffset.has_value()) // Change will be sent inside next ROSTER_DELTA message
+            continue;
+
+        if (!roster_message_owner)
+            roster_message_owner = messages_pool_.acquire(roster_message);
+
+        client.remainingMessages.push(roster_message_owner);
     }
 }
 
-void NetworkBackend::broadcastMessage(std::string new_message) {
-    std::unordered_set<std::uint64_t> registry_uids; // Set of every UID to get every registered client actor
-    registry_uids.reserve(actors_registry_.size()); // To avoid useless reallocations during actors registry mapping
+void NetworkBackend::pushRosterDeltas() {
+    if (pending_roster_delta_.empty()) // Roster didn't change, or no client enabled ROSTER_DELTA
+        return;
 
-    // For each actor entry, insert its UID inside the UIDs set
-    std::transform(actors_registry_.cbegin(), actors_registry_.cend(),
-                   std::inserter(registry_uids, registry_uids.begin()),
-                   [](const std::pair<std::uint64_t, std::uint64_t> actor_entry) { return actor_entry.first; });
+    const std::string_view pending_changes { pending_roster_delta_ };
+    // Formatted for first client which enabled ROSTER_DELTA before last sync, then shared as every such client missed
+    // same changes
+    MessageBuffer whole_delta;
 
-    // With list of every actor UIDs, sends given message
-    targetMessage(registry_uids, std::move(new_message));
+    for (auto& [client_token, client] : connected_clients_) {
+        if (!client.rosterDeltaOffset.has_value())
+            continue;
+
+        const std::size_t delta_offset { *client.rosterDeltaOffset };
+        client.rosterDeltaOffset = 0; // Every pending change is pushed, next ones will be pending from beginning
+
+        if (delta_offset == pending_changes.size()) // No roster change since client enabled ROSTER_DELTA
+            continue;
+
+        if (delta_offset == 0 && whole_delta) {
+            client.remainingMessages.push(whole_delta);
+
+            continue;
+        }
+
+        std::pmr::string delta_message { ROSTER_DELTA_COMMAND, transient_resource_ };
+        delta_message += pending_changes.substr(delta_offset); // Each change is already prefixed by a space
+
+        MessageBuffer delta_owner { messages_pool_.acquire(delta_message) };
+        if (delta_offset == 0)
+            whole_delta = delta_owner;
+
+        client.remainingMessages.push(std::move(delta_owner));
+    }
+
+    pending_roster_delta_.clear(); // Capacity is kept for next changes
 }
 
 void NetworkBackend::unregisterActor(const std::uint64_t actor_uid) {
@@ -306,27 +572,55 @@ void NetworkBackend::unregisterActor(const std::uint64_t actor_uid) {
     const auto uid_entry { actors_registry_.find(actor_uid) };
 
     // Reset actor object to uninitialized associated with owner client token and set status status to false
-    auto& [status, actor] { connected_clients_.at(uid_entry->second) };
-    actor.reset();
+    const std::uint64_t owner_client { uid_entry->second };
+    ClientRecord& owner { connected_clients_.at(owner_client) };
+    actor_names_.erase(owner.actor->nameId); // Name is available again
+    owner.actor.reset();
+
+    if (owner.rosterDeltaOffset.has_value()) { // Dead client doesn't need roster changes anymore
+        owner.rosterDeltaOffset.reset();
+        roster_delta_clients_--;
+    }
+
     // Sets status as no longer alive, doesn't care about disconnection reason
-    status.alive = false;
+    owner.status.alive = false;
+    // Registered client was alive, so it has just been killed, unless its record is detached from any connection
+    if (!owner.detachedUntil.has_value())
+        killed_clients_.push_back(owner_client);
 
     // Remove actor UID from registry, as it is no longer owned by any client
     actors_registry_.erase(uid_entry);
+    // Actor segment isn't searched for inside cached roster, which is formatted again once it is needed
+    registration_message_stale_ = true;
+
+    if (requests_limiter_) // Next actor registered with same UID must not inherit its rate
+        requests_limiter_->forget(actor_uid);
+
+    if (metrics_)
+        metrics_->actorUnregistered();
 }
 
-std::string NetworkBackend::formatRegistrationMessage() const {
-    std::string registration_message { REGISTRATION_COMMAND };
+std::string_view NetworkBackend::registrationMessage() {
+    if (!registration_message_stale_) // Roster didn't lose any actor since it was formatted
+        return registration_message_;
+
+    registration_message_.assign(REGISTRATION_COMMAND); // Capacity is kept for formatting again
 
     for (const auto& client : connected_clients_) { // Checks for each connected client
         // Get potential Actor from client value inside clients dictionary entry
-        const std::optional<Actor>& potential_actor { client.second.second };
+        const std::optional<Actor>& potential_actor { client.second.actor };
 
-        if (potential_actor.has_value()) // If client is registered with actor, append to sync registration message
-            registration_message += ' ' + std::to_string(potential_actor->uid) + ' ' + potential_actor->name;
+        if (potential_actor.has_value()) { // If client is registered with actor, append to sync registration message
+            registration_message_ += ' ';
+            registration_message_ += std::to_string(potential_actor->uid);
+            registration_message_ += ' ';
+            registration_message_ += actor_names_.name(potential_actor->nameId);
+        }
     }
 
-    return registration_message;
+    registration_message_stale_ = false;
+
+    return registration_message_;
 }
 
 bool NetworkBackend::isRegistered(const std::uint64_t actor_uid) const {
@@ -335,17 +629,27 @@ bool NetworkBackend::isRegistered(const std::uint64_t actor_uid) const {
 
 bool NetworkBackend::isAlive(std::uint64_t client_token) const {
     // Checks for client to exist
-    if (connected_clients_.count(client_token) == 0)
+    const auto client_entry { connected_clients_.find(client_token) };
+    if (client_entry == connected_clients_.cend())
         throw UnknownClientToken { client_token };
 
-    return connected_clients_.at(client_token).first.alive;
+    return client_entry->second.status.alive;
+}
+
+bool NetworkBackend::hasActor(const std::uint64_t client_token) const {
+    // Checks for client to exist
+    const auto client_entry { connected_clients_.find(client_token) };
+    if (client_entry == connected_clients_.cend())
+        throw UnknownClientToken { client_token };
+
+    return client_entry->second.actor.has_value();
 }
 
 const Utils::HandlingResult& NetworkBackend::disconnectionReason(const std::uint64_t client_token) const {
     if (isAlive(client_token)) // Will throws if no connected client uses this token
         throw AliveClient { client_token };
 
-    return connected_clients_.at(client_token).first.disconnectionReason;
+    return connected_clients_.at(client_token).status.disconnectionReason;
 }
 
 void NetworkBackend::addClient(const std::uint64_t new_token) {
@@ -353,58 +657,182 @@ void NetworkBackend::addClient(const std::uint64_t new_token) {
     if (connected_clients_.count(new_token) == 1)
         throw UnavailableClientToken { new_token };
 
-    // Inserts client alive and unregistered
+    // Inserts client alive and unregistered, with no disconnection error reason and an empty messages queue
     const auto insert_client_result {
-        connected_clients_.insert({ // Insert new client with alive status and no disconnection error reason
-            new_token, std::make_pair<ClientStatus, std::optional<Actor>>({ true, {} }, {})
-        })
-    };
-    // Needs empty messages queue for new client
-    const auto insert_queue_result {
-        clients_remaining_messages_.insert({ new_token, {} })
+        connected_clients_.try_emplace(new_token, ClientRecord { { true, {} }, {}, {} })
     };
 
-    assert(insert_client_result.second && insert_queue_result.second); // Checks for insertion to be successfully done
+    assert(insert_client_result.second); // Checks for insertion to be successfully done
+
+    if (metrics_)
+        metrics_->clientConnected(new_token);
 }
 
 void NetworkBackend::killClient(const std::uint64_t client_token, const Utils::HandlingResult& disconnection_reason) {
-    if (connected_clients_.count(client_token) == 0) // Checks for client to exist
+    const auto client_entry { connected_clients_.find(client_token) };
+    if (client_entry == connected_clients_.end()) // Checks for client to exist
         throw UnknownClientToken { client_token };
 
-    auto& [status, actor] { connected_clients_.at(client_token) }; // Retrieves status property and potential actor
+    ClientRecord& client { client_entry->second }; // Retrieves status property and potential actor
 
-    if (actor.has_value()) { // If associated actor exists and is registered
+    if (client.actor.has_value()) { // If associated actor exists and is registered
         // Then pipeline must be closed, unregistering actor and making client to no longer be status
-        closePipelineWith(actor->uid, disconnection_reason);
+        closePipelineWith(client.actor->uid, disconnection_reason);
     } else { // Else, only marks it as no longer alive status with given disconnection reason (error or not)
-        status = { false, disconnection_reason };
+        if (client.status.alive) // Client must be retrieved by implementation only once
+            killed_clients_.push_back(client_token);
+
+        client.status = { false, disconnection_reason };
+    }
+}
+
+void NetworkBackend::loseClient(const std::uint64_t client_token, const Utils::HandlingResult& disconnection_reason) {
+    const auto client_entry { connected_clients_.find(client_token) };
+    if (client_entry == connected_clients_.end()) // Checks for client to exist
+        throw UnknownClientToken { client_token };
+
+    const ClientRecord& client { client_entry->second };
+
+    // Session can only be resumed if client enabled it and still owns its actor
+    if (session_grace_.count() == 0 || !client.actor.has_value() || !client.sessionSecret.has_value())
+        killClient(client_token, disconnection_reason);
+    else
+        detachActor(client_token, disconnection_reason);
+}
+
+void NetworkBackend::detachActor(const std::uint64_t client_token, const Utils::HandlingResult& disconnection_reason) {
+    ClientRecord& client { connected_clients_.at(client_token) };
+    const std::uint64_t actor_uid { client.actor->uid };
+
+    const auto detached_until { std::chrono::steady_clock::now() + session_grace_ };
+
+    // Actor and its queues are moved out, so client is left unregistered like a killed one
+    ClientRecord detached_record {
+        { true, {} }, client.actor, std::move(client.remainingMessages), std::move(client.remainingBestEffortMessages),
+        client.rosterDeltaOffset, client.sessionSecret, detached_until
+    };
+
+    client.actor.reset();
+    client.rosterDeltaOffset.reset(); // Clients count which enabled ROSTER_DELTA is unchanged, as detached one still is
+    client.sessionSecret.reset();
+    client.remainingMessages = {};
+    client.remainingBestEffortMessages = {};
+
+    if (client.status.alive) // Client must be retrieved by implementation only once
+        killed_clients_.push_back(client_token);
+
+    client.status = { false, disconnection_reason };
+
+    // Implementation tokens are expected to never reach top of range, but this one must still be available
+    while (connected_clients_.count(next_detached_token_) == 1)
+        next_detached_token_--;
+
+    const std::uint64_t detached_token { next_detached_token_-- };
+
+    // Client reference isn't used anymore, as insertion might move records
+    connected_clients_.try_emplace(detached_token, std::move(detached_record));
+    actors_registry_.at(actor_uid) = detached_token; // Messages for actor keep being queued
+    session_deadlines_.push({ detached_until, detached_token });
+}
+
+void NetworkBackend::resumeSession(const std::uint64_t client_token, const std::uint64_t actor_uid,
+                                   const std::uint64_t secret) {
+
+    const auto uid_entry { actors_registry_.find(actor_uid) };
+    // Same error whether actor or secret is wrong, so registered UIDs can't be probed with secrets
+    const InternalError resume_failed { "No session to resume for actor " + std::to_string(actor_uid) };
+
+    if (uid_entry == actors_registry_.end())
+        throw resume_failed;
+
+    const std::uint64_t owner_token { uid_entry->second };
+    const ClientRecord& owner { connected_clients_.at(owner_token) };
+
+    if (!owner.sessionSecret.has_value()) // SESSION wasn't enabled, there is no secret to compare with
+        throw resume_failed;
+
+    // Both secrets have same length, compared in constant time so guessed secrets can't be refined by timing
+    if (CRYPTO_memcmp(&*owner.sessionSecret, &secret, sizeof(secret)) != 0)
+        throw resume_failed;
+
+    // Owner connection might be lost without server knowing it yet, like after a phone switched networks
+    if (!owner.detachedUntil.has_value())
+        detachActor(owner_token, Utils::HandlingResult { "Session resumed from another connection" });
+
+    const auto detached_entry { connected_clients_.find(actors_registry_.at(actor_uid)) };
+    ClientRecord detached_record { std::move(detached_entry->second) };
+
+    connected_clients_.erase(detached_entry); // Its deadline is dropped once due
+
+    ClientRecord& client { connected_clients_.at(client_token) }; // Retrieved once erasure might have moved records
+
+    client.actor = detached_record.actor;
+    client.rosterDeltaOffset = detached_record.rosterDeltaOffset;
+    client.sessionSecret = detached_record.sessionSecret;
+    actors_registry_.at(actor_uid) = client_token;
+
+    // Client must be aware session has been resumed before messages queued meanwhile are received
+    privateMessage(client_token, RESUMED_COMMAND);
+
+    for (; !detached_record.remainingMessages.empty(); detached_record.remainingMessages.pop())
+        client.remainingMessages.push(std::move(detached_record.remainingMessages.front()));
+
+    for (; !detached_record.remainingBestEffortMessages.empty(); detached_record.remainingBestEffortMessages.pop())
+        client.remainingBestEffortMessages.push(std::move(detached_record.remainingBestEffortMessages.front()));
+}
+
+void NetworkBackend::closeExpiredSessions() {
+    const auto now { std::chrono::steady_clock::now() };
+
+    while (!session_deadlines_.empty() && session_deadlines_.top().first <= now) {
+        const auto [detached_until, detached_token] { session_deadlines_.top() };
+        session_deadlines_.pop();
+
+        // Session might have been resumed or closed meanwhile, then its record has been erased
+        const auto detached_entry { connected_clients_.find(detached_token) };
+        if (detached_entry == connected_clients_.end() || detached_entry->second.detachedUntil != detached_until)
+            continue;
+
+        // Pipeline closure erases detached record, deadline has already been popped
+        closePipelineWith(detached_entry->second.actor->uid, Utils::HandlingResult { "Session expired" });
     }
 }
 
 void NetworkBackend::removeClient(const std::uint64_t old_token) {
-    if (connected_clients_.count(old_token) == 0) // Checks for client to exist
+    const auto client_entry { connected_clients_.find(old_token) };
+    if (client_entry == connected_clients_.end()) // Checks for client to exist
         throw UnknownClientToken { old_token };
 
-    const bool alive_client { connected_clients_.at(old_token).first.alive }; // Retrieves alive client property
-
     // Checks for client to no longer be alive
-    if (alive_client)
+    if (client_entry->second.status.alive)
         throw AliveClient { old_token };
 
-    // Removes client from connected clients and removes its messages queue
-    const std::size_t removed_clients_count { connected_clients_.erase(old_token) };
-    const std::size_t removed_queues_count { clients_remaining_messages_.erase(old_token) };
+    // Removes client record, with its messages queue
+    connected_clients_.erase(client_entry);
 
-    // Must have removed exactly one connected client and one messages queue
-    assert(removed_clients_count == 1 && removed_queues_count);
+    // Removed client must not be retrieved as killed client anymore, as its token might be used by a new client
+    killed_clients_.erase(std::remove(killed_clients_.begin(), killed_clients_.end(), old_token),
+                          killed_clients_.end());
+
+    if (metrics_)
+        metrics_->clientDisconnected(old_token);
+}
+
+std::vector<std::uint64_t> NetworkBackend::pollKilledClients() {
+    std::vector<std::uint64_t> killed_clients;
+    killed_clients.swap(killed_clients_); // Clients are polled so pending list is now empty
+
+    return killed_clients;
 }
 
 void NetworkBackend::closePipelineWith(const std::uint64_t actor, const Utils::HandlingResult& clean_shutdown) {
+    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
+
     // Server must be notified by disconnection, clean if no error occurred, crash with error message otherwise
     if (clean_shutdown)
         pushInputEvent(Core::LeftEvent { actor });
     else
-        pushInputEvent(Core::LeftEvent { actor, clean_shutdown.errorMessage() });
+        pushInputEvent(Core::LeftEvent { actor, std::string { clean_shutdown.errorMessage() } });
 
     // Checks for actor to be registered
     if (!isRegistered(actor))
@@ -418,46 +846,132 @@ void NetworkBackend::closePipelineWith(const std::uint64_t actor, const Utils::H
     assert(!isRegistered(actor)); // Must be sure actor is no longer registered
 
     // Formats interrupt command message, beginning with INTERRUPT command
-    std::string interrupt_message { INTERRUPT_COMMAND };
+    std::pmr::string interrupt_message { INTERRUPT_COMMAND, transient_resource_ };
     // Appends error message if any error occurred
-    if (!clean_shutdown)
-        interrupt_message += ' ' + clean_shutdown.errorMessage();
+    if (!clean_shutdown) {
+        interrupt_message += ' ';
+        interrupt_message += clean_shutdown.errorMessage();
+    }
+
+    std::pmr::string logged_out_message { LOGGED_OUT_COMMAND, transient_resource_ };
+    logged_out_message += ' ';
+    logged_out_message += std::to_string(actor); // Small enough for SSO
 
     // Now clients state sync can be done, as in handleFromActor()
-    privateMessage(owner_client, std::move(interrupt_message));
-    broadcastMessage(std::string { LOGGED_OUT_COMMAND } + ' ' + std::to_string(actor));
+    privateMessage(owner_client, interrupt_message);
+    broadcastRosterChange(logged_out_message);
+
+    const auto owner_entry { connected_clients_.find(owner_client) };
+
+    if (owner_entry->second.detachedUntil.has_value()) { // No connection will remove detached record
+        connected_clients_.erase(owner_entry); // Its deadline is dropped once due
+
+        return;
+    }
 
     // Set appropriate disconnection reason property to client status
-    connected_clients_.at(owner_client).first.disconnectionReason = clean_shutdown;
+    owner_entry->second.status.disconnectionReason = clean_shutdown;
 }
 
-void NetworkBackend::replyTo(const std::uint64_t sr_actor, const std::string& sr_response) {
+void NetworkBackend::replyTo(const std::uint64_t sr_actor, std::string sr_response) {
+    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
+
     if (!isRegistered(sr_actor)) // Checks for given SR command author to exist
         throw UnknownActorUID { sr_actor };
 
     const std::uint64_t owner_client { actors_registry_.at(sr_actor) }; // Fetches client owning given actor
 
-    // Formats message for RPTL protocol using SERVICE command and pushes it into queue
-    privateMessage(owner_client, std::string { SERVICE_COMMAND } + ' ' + sr_response);
+    // Formats message for RPTL protocol using SERVICE command, then pushes it into queue
+    std::pmr::string command { transient_resource_ };
+    command.reserve(SERVICE_COMMAND.size() + 1 + sr_response.size());
+
+    command += SERVICE_COMMAND;
+    command += ' ';
+    command += sr_response;
+
+    privateMessage(owner_client, command);
 }
 
 void NetworkBackend::outputEvent(const Core::ServiceEvent& event) {
-    // Formats message for RPTL protocol using SERVICE command
-    const Core::ServiceEvent rptl_encapsulated {
-        event.prefixWith(std::string { SERVICE_COMMAND } + ' ')
-    };
-    // Sent command copied from object's command view
-    std::string command { rptl_encapsulated.command() };
+    const Utils::AllocationScope network_allocations { Utils::AllocationSubsystem::Network };
+
+    const std::string_view event_prefix { event.prefix() };
+    const std::string_view event_data { event.data() };
+
+    // Formats message for RPTL protocol using SERVICE command, each SE layer being written once into sent message
+    std::pmr::string command { transient_resource_ };
+    command.reserve(SERVICE_COMMAND.size() + 1 + event_prefix.size() + event_data.size());
 
-    if (rptl_encapsulated.targetEveryone()) {
-        broadcastMessage(std::move(command));
+    command += SERVICE_COMMAND;
+    command += ' ';
+    command += event_prefix;
+    command += event_data;
+
+    // Best-effort events are sent once critical messages have been, and might be dropped by congested clients
+    const MessagePriority priority { event.bestEffort() ? MessagePriority::BestEffort : MessagePriority::Critical };
+
+    if (event.targetEveryone()) {
+        broadcastMessage(command, priority);
     } else {
-        targetMessage(rptl_encapsulated.targets(), std::move(command));
+        targetMessage(event.targets(), command, priority);
     }
 }
 
 NetworkBackend::NetworkBackend(std::size_t actors_limit)
-: Core::InputOutputInterface {}, actors_limit_ { actors_limit } {}
+: Core::InputOutputInterface {}, actors_limit_ { actors_limit },
+registration_message_ { REGISTRATION_COMMAND }, registration_message_stale_ { false }, roster_delta_clients_ { 0 },
+latencies_ { nullptr }, metrics_ { nullptr }, tracer_ { nullptr }, load_ { nullptr },
+transient_resource_ { std::pmr::get_default_resource() }, busy_poll_window_ { 0 }, session_grace_ { 0 },
+next_detached_token_ { std::numeric_limits<std::uint64_t>::max() } {}
+
+void NetworkBackend::recordLatencies(Utils::PipelineLatencies& latencies) {
+    latencies_ = &latencies;
+}
+
+void NetworkBackend::recordMetrics(Utils::RuntimeMetrics& metrics) {
+    metrics_ = &metrics;
+    metrics_->actorsLimit(actors_limit_);
+}
+
+void NetworkBackend::recordTrace(Utils::LoopTracer& tracer) {
+    tracer_ = &tracer;
+}
+
+void NetworkBackend::shedLoad(const Utils::LoadMonitor& load_monitor) {
+    load_ = &load_monitor;
+}
+
+void NetworkBackend::useIterationArena(Utils::IterationArena& arena) {
+    transient_resource_ = &arena.resource();
+}
+
+void NetworkBackend::busyPoll(const std::chrono::microseconds window) {
+    busy_poll_window_ = window;
+}
+
+void NetworkBackend::reserve(const std::size_t clients_capacity) {
+    // Only registered clients are actors, which are limited anyway
+    const std::size_t actors_capacity { std::min(clients_capacity, actors_limit_) };
+
+    connected_clients_.reserve(clients_capacity);
+    actors_registry_.reserve(actors_capacity);
+    actor_names_.reserve(actors_capacity);
+    killed_clients_.reserve(clients_capacity);
+    // One private message queued for each client, like handshake replies while many clients are connecting
+    messages_pool_.reserve(clients_capacity);
+}
+
+void NetworkBackend::limitRequests(const RequestRateLimits& limits) {
+    requests_limiter_.emplace(limits);
+}
+
+void NetworkBackend::resumeSessions(const std::chrono::milliseconds grace) {
+    session_grace_ = grace;
+}
+
+const RequestRateLimiter* NetworkBackend::requestsLimiter() const {
+    return requests_limiter_ ? &*requests_limiter_ : nullptr;
+}
 
 
 }
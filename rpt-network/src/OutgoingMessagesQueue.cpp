@@ -0,0 +1,106 @@
+#include <RpT-Network/OutgoingMessagesQueue.hpp>
+
+#include <algorithm>
+
+
+namespace RpT::Network {
+
+
+void OutgoingMessagesQueue::updateCongestion() {
+    // Both counters must be back under low watermark, otherwise client would oscillate around it
+    if (size() <= limits_.lowMessages && bytes_ <= limits_.lowBytes)
+        congested_ = false;
+}
+
+OutgoingMessagesQueue::OutgoingMessagesQueue(const OutgoingQueueLimits& limits)
+: limits_ { limits }, bytes_ { 0 }, congested_ { false } {}
+
+OutgoingMessagesQueue::PushResult OutgoingMessagesQueue::push(MessageBuffer message, const MessagePriority priority) {
+    const std::size_t message_size { message->size() };
+
+    if (priority == MessagePriority::BestEffort) {
+        // Best-effort messages are kept under low watermark, leaving space up to high watermark to critical ones
+        if (congested_ || size() + 1 > limits_.lowMessages || bytes_ + message_size > limits_.lowBytes)
+            return PushResult::Dropped;
+    } else if (size() + 1 > limits_.highMessages || bytes_ + message_size > limits_.highBytes) {
+        // Message is refused if it would exceed any of high watermarks
+        return PushResult::Overflowed;
+    }
+
+    Lane& lane { priority == MessagePriority::BestEffort ? best_effort_lane_ : critical_lane_ };
+    lane.messages.push(std::move(message));
+    lane.queuedAt.push(std::chrono::steady_clock::now());
+    bytes_ += message_size;
+
+    // Congestion is only reported when it begins
+    if (!congested_ && (size() > limits_.lowMessages || bytes_ > limits_.lowBytes)) {
+        congested_ = true;
+
+        return PushResult::Congested;
+    }
+
+    return PushResult::Queued;
+}
+
+MessageBuffer OutgoingMessagesQueue::pop() {
+    if (empty())
+        return MessageBuffer {};
+
+    // Best-effort messages wait for every critical message to be sent
+    Lane& lane { critical_lane_.messages.empty() ? best_effort_lane_ : critical_lane_ };
+
+    MessageBuffer oldest_message { std::move(lane.messages.front()) };
+    lane.messages.pop();
+    lane.queuedAt.pop();
+
+    bytes_ -= oldest_message->size();
+    updateCongestion();
+
+    return oldest_message;
+}
+
+std::queue<MessageBuffer> OutgoingMessagesQueue::popAll() {
+    std::queue<MessageBuffer> queued_messages;
+    queued_messages.swap(critical_lane_.messages);
+    critical_lane_.queuedAt = {};
+
+    for (; !best_effort_lane_.messages.empty(); best_effort_lane_.messages.pop())
+        queued_messages.push(std::move(best_effort_lane_.messages.front()));
+
+    best_effort_lane_.queuedAt = {};
+
+    bytes_ = 0;
+    updateCongestion();
+
+    return queued_messages;
+}
+
+std::chrono::steady_clock::time_point OutgoingMessagesQueue::frontQueuedAt() const {
+    if (critical_lane_.queuedAt.empty())
+        return best_effort_lane_.queuedAt.empty() ? std::chrono::steady_clock::time_point {}
+                                                  : best_effort_lane_.queuedAt.front();
+
+    if (best_effort_lane_.queuedAt.empty())
+        return critical_lane_.queuedAt.front();
+
+    return std::min(critical_lane_.queuedAt.front(), best_effort_lane_.queuedAt.front());
+}
+
+bool OutgoingMessagesQueue::empty() const {
+    return critical_lane_.messages.empty() && best_effort_lane_.messages.empty();
+}
+
+std::size_t OutgoingMessagesQueue::size() const {
+    return critical_lane_.messages.size() + best_effort_lane_.messages.size();
+}
+
+std::size_t OutgoingMessagesQueue::bytes() const {
+    return bytes_;
+}
+
+bool OutgoingMessagesQueue::congested() const {
+    return congested_;
+}
+
+
+}
@@ -0,0 +1,728 @@
+#include <RpT-Network/RawTcpBackend.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <sstream>
+#include <boost/asio/post.hpp>
+#include <boost/asio/write.hpp>
+#include <RpT-Config/Config.hpp>
+#include <RpT-Core/Timer.hpp>
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+#include <sys/socket.h>
+#include <unistd.h>
+#include <boost/asio/local/stream_protocol.hpp>
+#endif
+
+
+namespace RpT::Network {
+
+
+/// Minimum free space inside client read buffer before next bytes are read
+constexpr std::size_t READ_CHUNK_SIZE { 16 * 1024 };
+
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+
+/// Binds Unix socket at given path, path is removed once listener is destroyed so successor can bind it again
+struct RawTcpBackend::HandoffListener {
+    std::string path;
+    boost::asio::local::stream_protocol::acceptor acceptor;
+
+    HandoffListener(boost::asio::io_context& io_context, std::string handoff_path)
+    : path { std::move(handoff_path) }, acceptor { io_context } {
+        ::unlink(path.c_str()); // Socket file might have been left by a crashed process
+
+        const boost::asio::local::stream_protocol::endpoint handoff_endpoint { path };
+
+        acceptor.open(handoff_endpoint.protocol());
+        acceptor.bind(handoff_endpoint);
+        acceptor.listen();
+    }
+
+    ~HandoffListener() {
+        boost::system::error_code err;
+        acceptor.close(err);
+
+        ::unlink(path.c_str());
+    }
+};
+
+
+namespace {
+
+
+/// Sends given listening socket descriptor through given connected Unix socket, along with a single placeholder byte
+boost::system::error_code sendListener(const int successor_connection, const int listener) {
+    char placeholder { 'L' }; // At least 1 byte of data is required to send ancillary data
+    iovec placeholder_buffer { &placeholder, 1 };
+
+    alignas(cmsghdr) char control_buffer[CMSG_SPACE(sizeof(int))] {};
+
+    msghdr message {};
+    message.msg_iov = &placeholder_buffer;
+    message.msg_iovlen = 1;
+    message.msg_control = control_buffer;
+    message.msg_controllen = sizeof(control_buffer);
+
+    cmsghdr* const passed_rights { CMSG_FIRSTHDR(&message) };
+    passed_rights->cmsg_level = SOL_SOCKET;
+    passed_rights->cmsg_type = SCM_RIGHTS;
+    passed_rights->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(passed_rights), &listener, sizeof(int));
+
+    if (::sendmsg(successor_connection, &message, MSG_NOSIGNAL) != 1)
+        return { errno, boost::system::system_category() };
+
+    return {};
+}
+
+/// Connects predecessor Unix socket at given path, then receives listening socket it passes
+boost::asio::ip::tcp::acceptor takeOverListener(boost::asio::io_context& io_context, const std::string& take_over_path) {
+    boost::asio::local::stream_protocol::socket predecessor { io_context };
+
+    boost::system::error_code connection_err;
+    predecessor.connect(boost::asio::local::stream_protocol::endpoint { take_over_path }, connection_err);
+
+    if (connection_err)
+        throw HandoffError { "Unable to connect " + take_over_path + ": " + connection_err.message() };
+
+    char placeholder;
+    iovec placeholder_buffer { &placeholder, 1 };
+
+    alignas(cmsghdr) char control_buffer[CMSG_SPACE(sizeof(int))] {};
+
+    msghdr message {};
+    message.msg_iov = &placeholder_buffer;
+    message.msg_iovlen = 1;
+    message.msg_control = control_buffer;
+    message.msg_controllen = sizeof(control_buffer);
+
+    ssize_t received_bytes;
+    do { // Blocks until predecessor handles connection, which might be interrupted by a signal
+        received_bytes = ::recvmsg(predecessor.native_handle(), &message, MSG_CMSG_CLOEXEC);
+    } while (received_bytes == -1 && errno == EINTR);
+
+    const cmsghdr* const passed_rights { received_bytes == 1 ? CMSG_FIRSTHDR(&message) : nullptr };
+    if (passed_rights == nullptr || passed_rights->cmsg_level != SOL_SOCKET || passed_rights->cmsg_type != SCM_RIGHTS)
+        throw HandoffError { "Predecessor didn't pass any listening socket" };
+
+    int listener;
+    std::memcpy(&listener, CMSG_DATA(passed_rights), sizeof(int));
+
+    // Inherited socket might be IPv4 or IPv6, it doesn't depend on local endpoint given to successor
+    sockaddr_storage listener_address {};
+    socklen_t listener_address_length { sizeof(listener_address) };
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&listener_address), &listener_address_length);
+
+    const boost::asio::ip::tcp listener_protocol {
+        listener_address.ss_family == AF_INET6 ? boost::asio::ip::tcp::v6() : boost::asio::ip::tcp::v4()
+    };
+
+    boost::asio::ip::tcp::acceptor inherited_acceptor { io_context };
+    boost::system::error_code assign_err;
+    inherited_acceptor.assign(listener_protocol, listener, assign_err);
+
+    if (assign_err) {
+        ::close(listener);
+
+        throw HandoffError { "Unable to use passed listening socket: " + assign_err.message() };
+    }
+
+    return inherited_acceptor;
+}
+
+
+}
+
+#else
+
+/// Handoff requires Unix sockets, so it is never enabled on other platforms
+struct RawTcpBackend::HandoffListener {};
+
+
+namespace {
+
+
+/// Always fails, as passing sockets between processes requires Unix sockets
+boost::asio::ip::tcp::acceptor takeOverListener(boost::asio::io_context&, const std::string&) {
+    throw HandoffError { "Only available on Unix" };
+}
+
+
+}
+
+#endif
+
+
+RawTcpBackend::FrameHeader RawTcpBackend::frameHeader(const std::size_t message_length) {
+    // Message length must be encodable, RPTL messages are expected to be much shorter than that anyways
+    assert(message_length <= std::numeric_limits<std::uint32_t>::max());
+
+    return {
+        static_cast<char>((message_length >> 24) & 0xff),
+        static_cast<char>((message_length >> 16) & 0xff),
+        static_cast<char>((message_length >> 8) & 0xff),
+        static_cast<char>(message_length & 0xff)
+    };
+}
+
+std::size_t RawTcpBackend::frameLength(const char* const header) {
+    std::size_t message_length { 0 };
+    for (std::size_t i { 0 }; i < FRAME_HEADER_SIZE; i++) // Most significant byte comes first
+        message_length = (message_length << 8) | static_cast<unsigned char>(header[i]);
+
+    return message_length;
+}
+
+std::vector<int> RawTcpBackend::getCaughtSignals() {
+    std::vector<int> caught_signals { SIGTERM }; // SIGTERM is always caught and always exist
+    caught_signals.reserve(3); // At least 3 caught Posix signals: SIGINT, SIGTERM and SIGHUP
+
+#ifdef NDEBUG
+    caught_signals.push_back(SIGINT); // SIGINT used by GDB for debugging
+#endif
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    caught_signals.push_back(SIGHUP); // SIGHUP only available for Unix runtime platform
+#endif
+
+    return caught_signals;
+}
+
+std::string RawTcpBackend::endpointFor(const boost::asio::ip::tcp::socket& client_connection) {
+    try {
+        std::ostringstream endpoint_output;
+        endpoint_output << client_connection.remote_endpoint(); // remote_endpoint() may fail for some reasons
+
+        return endpoint_output.str();
+    } catch (const boost::system::system_error&) { // If it fails, returns fallback string representation
+        return "UNKNOWN";
+    }
+}
+
+bool RawTcpBackend::isConnected(const std::uint64_t client_token) const {
+    return clients_connection_.count(client_token) == 1;
+}
+
+void RawTcpBackend::waitNextClient() {
+    tcp_acceptor_.async_accept([this](const boost::system::error_code& err,
+                                      boost::asio::ip::tcp::socket new_client_connection) {
+
+        if (err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
+            return;
+
+        std::string remote_endpoint { endpointFor(new_client_connection) };
+
+        if (err) {
+            logger_.error("Unable to accept TCP from {}: {}", remote_endpoint, err.message());
+        } else {
+            try {
+                boost::system::error_code option_err;
+                // Frames are small and latency matters more than segments count for internal clients
+                new_client_connection.set_option(boost::asio::ip::tcp::no_delay { true }, option_err);
+
+                if (option_err)
+                    logger_.warn("Unable to disable Nagle algorithm for {}: {}", remote_endpoint, option_err.message());
+
+                const std::uint64_t new_client_token { tokens_count_++ };
+
+                logger_.debug("New token for {}: {}", remote_endpoint, new_client_token);
+
+                // Add token into connected clients NetworkBackend registry
+                addClient(new_client_token); // May throws if token insertion failed
+
+                const auto new_connection {
+                    std::make_shared<ClientConnection>(ClientConnection {
+                        std::move(new_client_connection), {}, 0, OutgoingMessagesQueue { outgoing_limits_ },
+                        false, false, false
+                    })
+                };
+
+                const auto insert_connection_result { clients_connection_.insert({ new_client_token, new_connection }) };
+                // Checks if client connection insertion has been done
+                assert(insert_connection_result.second);
+
+                listenMessagesFrom(new_client_token, new_connection); // Now client was added, it can be listened
+            } catch (const std::exception& add_err) { // Any token insertion error must result in connection closure
+                logger_.error("Unable to add client for {}: {}", remote_endpoint, add_err.what());
+
+                boost::system::error_code closure_err;
+                new_client_connection.close(closure_err); // Nothing to send, connection can be closed right now
+            }
+        }
+
+        waitNextClient(); // In any case, server must be waiting again for the next TCP connection
+    });
+}
+
+void RawTcpBackend::listenMessagesFrom(const std::uint64_t client_token,
+                                       const std::shared_ptr<ClientConnection>& connection) {
+
+    RPT_LOG_TRACE(logger_, "Listening next messages from {}...", client_token);
+
+    // Buffer only grows if there isn't enough space for a full chunk, so it is allocated once for most clients
+    if (connection->readBuffer.size() - connection->bufferedBytes < READ_CHUNK_SIZE)
+        connection->readBuffer.resize(connection->bufferedBytes + READ_CHUNK_SIZE);
+
+    const boost::asio::mutable_buffer free_space {
+        connection->readBuffer.data() + connection->bufferedBytes,
+        connection->readBuffer.size() - connection->bufferedBytes
+    };
+
+    // Connection owns buffer, so it lives for both async_read_some and callback handler operations
+    connection->socket.async_read_some(free_space, [this, client_token, connection](
+            const boost::system::error_code& err, const std::size_t read_bytes) {
+
+        if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
+            return;
+
+        if (!isConnected(client_token)) // Client connection might have been closed while bytes were being read
+            return;
+
+        if (err) {
+            if (err == boost::asio::error::eof) { // Client closed its connection
+                logger_.info("TCP connection closed by client {}", client_token);
+
+                killClient(client_token);
+            } else {
+                const std::string error_message { err.message() };
+
+                logger_.error("Failed to receive message from client {}: {}", client_token, error_message);
+
+                // Connection was lost without client closing it, so actor is kept if its session can be resumed
+                loseClient(client_token, Utils::HandlingResult { error_message });
+            }
+
+            return; // In any case, an error means that client must NOT be listened anymore
+        }
+
+        connection->bufferedBytes += read_bytes;
+
+        if (handleReceivedFrames(client_token, *connection))
+            listenMessagesFrom(client_token, connection);
+    });
+}
+
+bool RawTcpBackend::handleReceivedFrames(const std::uint64_t client_token, ClientConnection& connection) {
+    const char* const buffered_data { connection.readBuffer.data() };
+    // Offset for next frame which hasn't been handled yet
+    std::size_t frame_begin { 0 };
+
+    while (connection.bufferedBytes - frame_begin >= FRAME_HEADER_SIZE) {
+        const std::size_t message_length { frameLength(buffered_data + frame_begin) };
+
+        if (message_length > max_message_size_) { // Client must not be able to make server buffer anything
+            logger_.error("Client {} sent a {} bytes message, limit is {}.",
+                          client_token, message_length, max_message_size_);
+
+            killClient(client_token, Utils::HandlingResult { "RPTL message too long" });
+
+            return false;
+        }
+
+        if (connection.bufferedBytes - frame_begin - FRAME_HEADER_SIZE < message_length) // Frame isn't complete yet
+            break;
+
+        handleReceivedMessage(client_token, { buffered_data + frame_begin + FRAME_HEADER_SIZE, message_length });
+        frame_begin += FRAME_HEADER_SIZE + message_length;
+
+        if (!isAlive(client_token)) // Following frames must be ignored if message resulted in client being killed
+            return false;
+    }
+
+    // Incomplete frame is moved at buffer beginning so its remaining bytes can be appended to it
+    std::copy(connection.readBuffer.cbegin() + frame_begin,
+              connection.readBuffer.cbegin() + connection.bufferedBytes, connection.readBuffer.begin());
+    connection.bufferedBytes -= frame_begin;
+
+    return true;
+}
+
+void RawTcpBackend::handleReceivedMessage(const std::uint64_t client_token, const std::string_view rptl_message) {
+    try {
+        Core::AnyInputEvent client_triggered_event { handleMessage(client_token, rptl_message) };
+
+        // If logout message was sent, client actor is unregistered and connection must be closed
+        if (std::get_if<Core::LeftEvent>(&client_triggered_event) != nullptr)
+            killClient(client_token);
+
+        pushInputEvent(std::move(client_triggered_event)); // Moves triggered event into queue
+    } catch (const std::exception& err) { // Any error in message handling results into client disconnection
+        logger_.error("During {} message handling: {}", client_token, err.what());
+
+        // Client will be disconnect for thrown error reason
+        killClient(client_token, Utils::HandlingResult { err.what() });
+    }
+}
+
+void RawTcpBackend::sendRemainingMessages(const std::uint64_t client_token,
+                                          const std::shared_ptr<ClientConnection>& connection) {
+
+    connection->sending = true; // Next messages will be sent once these ones will have been sent
+
+    // Frames take messages ownership, they must live until handler is destroyed
+    const auto sent_frames { std::make_shared<SentFrames>() };
+    const std::chrono::steady_clock::time_point queued_at { connection->remainingMessages.frontQueuedAt() };
+    std::queue<MessageBuffer> queued_messages { connection->remainingMessages.popAll() };
+
+    if (Utils::RuntimeMetrics* const runtime_metrics { metrics() })
+        runtime_metrics->queueDepth(client_token, 0);
+
+    sent_frames->messages.reserve(queued_messages.size());
+    sent_frames->headers.reserve(queued_messages.size()); // Buffers are pointing to headers, they must not move
+    sent_frames->buffers.reserve(queued_messages.size() * 2);
+
+    while (!queued_messages.empty()) {
+        const MessageBuffer& next_message { sent_frames->messages.emplace_back(
+                std::move(queued_messages.front())) };
+
+        queued_messages.pop();
+
+        const FrameHeader& next_header { sent_frames->headers.emplace_back(frameHeader(next_message->size())) };
+
+        sent_frames->buffers.emplace_back(next_header.data(), next_header.size());
+        sent_frames->buffers.emplace_back(next_message->data(), next_message->size());
+    }
+
+    boost::asio::async_write(connection->socket, sent_frames->buffers, [this, client_token, connection, sent_frames,
+                                                                     queued_at](
+            const boost::system::error_code& err, const std::size_t sent_bytes) {
+
+        if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
+            return;
+
+        // Sent messages have already been popped from queue, so next messages can be sent
+        connection->sending = false;
+
+        if (Utils::RuntimeMetrics* const runtime_metrics { metrics() })
+            runtime_metrics->bytesSent(sent_bytes);
+
+        if (err) {
+            // Connection closed from server side doesn't have to be killed again, remaining messages are lost
+            if (connection->closing)
+                return;
+
+            const std::string error_message { err.message() };
+
+            logger_.error("Unable to send message to client {}: {}", client_token, error_message);
+
+            // As RPTL protocol requires, connection if closed if any error occurred, using specific error message, but
+            // actor is kept if its session can be resumed
+            loseClient(client_token, Utils::HandlingResult { error_message });
+
+            return; // Client will be closed, no need to send it remaining messages
+        }
+
+        if (Utils::PipelineLatencies* const recorded_latencies { latencies() })
+            recorded_latencies->recordSince(Utils::PipelineStage::Write, queued_at);
+
+        // Checks for this client messages queue and send next messages recursively if any, even if closing as
+        // remaining messages like INTERRUPT must be received before connection shutdown
+        if (!connection->remainingMessages.empty())
+            sendRemainingMessages(client_token, connection);
+        else if (connection->closing)
+            shutdownConnection(*connection);
+    });
+}
+
+void RawTcpBackend::closeConnection(const std::uint64_t client_token) {
+    const Utils::HandlingResult& disconnection_reason { disconnectionReason(client_token) };
+
+    // There is no close frame with plain TCP, so reason is only given to registered actors by INTERRUPT message
+    if (disconnection_reason)
+        logger_.debug("Closing connection with client {}.", client_token);
+    else
+        logger_.debug("Closing connection with client {}: {}", client_token, disconnection_reason.errorMessage());
+
+    removeClient(client_token); // Once disconnection reason has been retrieved, client can be removed
+
+    // Moves client connection entry as it will be closed and no more operation should be performed on
+    // Shared ownership because socket must not be destroyed before remaining messages were sent
+    const std::shared_ptr<ClientConnection> dead_client { std::move(clients_connection_.at(client_token)) };
+
+    const std::size_t removed_connections_count { clients_connection_.erase(client_token) };
+    // Must be sure that exactly ony client connection entry has been removed
+    assert(removed_connections_count == 1);
+
+    dead_client->closing = true; // No more RPTL message will be queued for this client
+
+    // If messages are still being sent, connection will be shut down by write handler once everything has been sent
+    if (!dead_client->sending)
+        shutdownConnection(*dead_client);
+}
+
+void RawTcpBackend::shutdownConnection(ClientConnection& connection) {
+    // Errors are ignored as connection is closed anyways, pending read will be cancelled
+    boost::system::error_code err;
+
+    connection.socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, err);
+    connection.socket.close(err);
+}
+
+void RawTcpBackend::closeDeadConnections() {
+    // Only clients killed since previous call must be closed
+    for (const std::uint64_t dead_client_token : pollKilledClients())
+        closeConnection(dead_client_token);
+
+    if (draining_ && clients_connection_.empty() && !closed()) {
+        logger_.info("Every remaining client left, closing.");
+
+        close(); // Successor is now serving every client
+    }
+}
+
+void RawTcpBackend::waitSuccessor() {
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    handoff_listener_->acceptor.async_accept([this](const boost::system::error_code& err,
+                                                    boost::asio::local::stream_protocol::socket successor) {
+
+        if (err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
+            return;
+
+        if (err) {
+            logger_.error("Unable to accept successor: {}", err.message());
+
+            waitSuccessor();
+            return;
+        }
+
+        const std::string handoff_path { handoff_listener_->path };
+        // Path is removed before listening socket is sent, so it never removes the one successor binds afterwards
+        handoff_listener_.reset();
+
+        const boost::system::error_code send_err { sendListener(successor.native_handle(),
+                                                                tcp_acceptor_.native_handle()) };
+
+        if (send_err) { // Still accepting connections, so successor can be launched again
+            logger_.error("Unable to pass listening socket to successor: {}", send_err.message());
+
+            try {
+                handoff_listener_ = std::make_unique<HandoffListener>(async_io_context_, handoff_path);
+                waitSuccessor();
+            } catch (const boost::system::system_error& bind_err) {
+                logger_.error("Unable to wait for another successor: {}", bind_err.what());
+            }
+
+            return;
+        }
+
+        beginDraining();
+    });
+#endif
+}
+
+void RawTcpBackend::beginDraining() {
+    draining_ = true;
+
+    // Successor owns its own descriptor for listening socket, so it keeps listening
+    boost::system::error_code err;
+    tcp_acceptor_.close(err);
+
+    logger_.info("Listening socket handed off, draining {} remaining clients.", clients_connection_.size());
+
+    if (drain_timeout_.count() == 0) // Remaining clients can stay as long as they want
+        return;
+
+    drain_timer_.expires_after(drain_timeout_);
+    drain_timer_.async_wait([this](const boost::system::error_code& err) {
+        if (err) // Cancelled if backend was closed before timeout
+            return;
+
+        logger_.warn("Drain timeout expired, closing {} remaining clients.", clients_connection_.size());
+
+        close();
+    });
+}
+
+void RawTcpBackend::syncClient(const std::uint64_t client_token, MessagesQueueView client_messages_queue) {
+    if (!client_messages_queue.hasNext()) // Nothing to send
+        return;
+
+    const std::shared_ptr<ClientConnection>& connection { clients_connection_.at(client_token) };
+
+    if (connection->evicted) // Evicted connection will not send anything else
+        return;
+
+    // Appends flushed messages to this client own pipeline, as long as client reads them fast enough
+    while (client_messages_queue.hasNext()) {
+        const MessagePriority priority { client_messages_queue.nextPriority() };
+        const auto push_result { connection->remainingMessages.push(client_messages_queue.next(), priority) };
+
+        if (push_result == OutgoingMessagesQueue::PushResult::Dropped) { // Congested client doesn't receive it
+            backpressure_stats_.droppedMessages++;
+        } else if (push_result == OutgoingMessagesQueue::PushResult::Congested) {
+            backpressure_stats_.congestions++;
+
+            logger_.debug("Client {} is congested.", client_token);
+        } else if (push_result == OutgoingMessagesQueue::PushResult::Overflowed) {
+            connection->evicted = true; // Queued messages are still sent until connection is closed
+            backpressure_stats_.evictions++;
+
+            logger_.warn("Client {} outgoing queue overflowed, evicting it.", client_token);
+            killClient(client_token, Utils::HandlingResult { "Too slow to receive messages" });
+
+            break; // Client will be closed, following messages are dropped
+        }
+    }
+
+    // Initiates recursive calls if no recursive async calls are already sending RPTL messages inside client queue
+    if (!connection->sending)
+        sendRemainingMessages(client_token, connection);
+    else if (Utils::RuntimeMetrics* const runtime_metrics { metrics() }) // Waiting for pending write to complete
+        runtime_metrics->queueDepth(client_token, connection->remainingMessages.size());
+}
+
+void RawTcpBackend::waitForEvent() {
+    // As interaction with clients might occurres, they must be synced with server and game state
+    synchronize();
+    // If busy-poll is enabled, blocking wait is avoided for an input event occurring shortly after
+    spinForEvent();
+
+    while (!inputReady()) { // While input events queue is empty
+        closeDeadConnections();
+
+        // Wait for next asynchronous IO operation handler, it may triggers an input event
+        async_io_context_.run_one();
+    }
+}
+
+void RawTcpBackend::pollReadyEvents() {
+    closeDeadConnections();
+
+    async_io_context_.poll(); // Runs ready handlers only
+}
+
+void RawTcpBackend::wakeForCompletedTasks() {
+    // Asio events loop is only run by Executor thread, which will push completed tasks
+    boost::asio::post(async_io_context_, [this]() { pushCompletedTasks(); });
+}
+
+RawTcpBackend::RawTcpBackend(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                             Utils::LoggingContext& logging_context, const RawTcpBackendOptions& options,
+                             const std::size_t players_limit)
+: NetworkBackend { players_limit },
+logger_ { "TCP-Backend", logging_context },
+outgoing_limits_ { options.outgoingLimits },
+max_message_size_ { options.maxMessageSize },
+timers_wheel_ { async_io_context_, [this](const std::uint64_t token) {
+    pushInputEvent(Core::TimerEvent { 0, token }); // Actor UID doesn't matter, timer token does
+} },
+stop_signals_handling_ { async_io_context_ },
+tcp_acceptor_ {
+    options.takeOverPath.empty()
+    ? boost::asio::ip::tcp::acceptor { async_io_context_, local_endpoint }
+    : takeOverListener(async_io_context_, options.takeOverPath)
+},
+tokens_count_ { 0 },
+drain_timeout_ { options.drainTimeout },
+drain_timer_ { async_io_context_ },
+draining_ { false } {
+    // For each Posix signal that must be caught
+    for (const int posix_signal : getCaughtSignals()) {
+        boost::system::error_code err;
+        // Error might occurs when adding signal to add, but it must NOT be fatal
+        stop_signals_handling_.add(posix_signal, err);
+
+        if (err) // Displays warning if signal will not be caught as expected
+            logger_.warn("Posix signal {} will not be caught: {}", posix_signal, err.message());
+    }
+
+    // Listens for Posix signals
+    stop_signals_handling_.async_wait([this](const boost::system::error_code& err, const int posix_signal) {
+        if (err == boost::asio::error::operation_aborted) // Ignores if backend was closed otherwise, like once drained
+            return;
+
+        if (err) { // Checks for error during signal handling
+            logger_.error("Failed to handle posix signal {}: {}", posix_signal, err.message());
+        } else {
+            logger_.debug("Posix signal {}, stopping...", posix_signal);
+            close(); // Close IO interface to stop server
+        }
+    });
+
+    if (options.takeOverPath.empty())
+        logger_.info("Open IO interface on local port {}.", localPort());
+    else
+        logger_.info("Open IO interface on local port {}, taken over from {}.", localPort(), options.takeOverPath);
+
+    if (!options.handoffPath.empty()) {
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+        handoff_listener_ = std::make_unique<HandoffListener>(async_io_context_, options.handoffPath);
+
+        logger_.info("Waiting for successor on {}.", options.handoffPath);
+
+        waitSuccessor();
+#else
+        logger_.warn("Listener handoff is only available on Unix, ignoring {}.", options.handoffPath);
+#endif
+    }
+
+    waitNextClient();
+}
+
+RawTcpBackend::~RawTcpBackend() = default;
+
+std::uint16_t RawTcpBackend::localPort() const {
+    return tcp_acceptor_.local_endpoint().port();
+}
+
+const BackpressureStats& RawTcpBackend::backpressureStats() const {
+    return backpressure_stats_;
+}
+
+bool RawTcpBackend::draining() const {
+    return draining_;
+}
+
+void RawTcpBackend::beginTimer(Core::Timer& ready_timer) {
+    timers_wheel_.beginTimer(ready_timer);
+}
+
+void RawTcpBackend::close() {
+    std::vector<std::uint64_t> client_tokens;
+    // One token for each client
+    client_tokens.reserve(clients_connection_.size());
+
+    // As clients_connection_ elements must not be erased during iteration, killClient() calls are deferred
+    for (const auto& client : clients_connection_)
+        client_tokens.push_back(client.first);
+
+    // Each client must be disconnected
+    for (const std::uint64_t token : client_tokens)
+        killClient(token); // No error, server closed
+
+    synchronize(); // Sends interrupt messages to clients before disconnection
+
+    // Now every client is dead, including ones which were already killed before and not closed yet
+    for (const std::uint64_t dead_client_token : pollKilledClients())
+        closeConnection(dead_client_token);
+
+    // A null event must be pushed so waitForEvent() can properly return
+    // None event must not be handled by Executor so actor UID doesn't matter
+    pushInputEvent(Core::NoneEvent { 0 });
+
+    // Stops listening for new connections, successor and signals
+    boost::system::error_code err;
+    tcp_acceptor_.close(err);
+    stop_signals_handling_.cancel(err);
+    drain_timer_.cancel();
+    handoff_listener_.reset();
+
+    // Writes which already completed are handled so their connection is shut down, for others it will be done
+    // when backend is destroyed, then handlers execution can be stopped right now
+    async_io_context_.poll();
+    async_io_context_.stop();
+
+    // Then IO interface can be considered closed
+    InputOutputInterface::close();
+}
+
+
+}
@@ -0,0 +1,63 @@
+#include <RpT-Network/RequestRateLimiter.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace RpT::Network {
+
+
+RequestRateLimiter::RequestRateLimiter(const RequestRateLimits& limits) : limits_ { limits }, dropped_ { 0 } {
+    if (!(limits_.requestsPerSecond > 0))
+        throw std::invalid_argument { "Requests rate must be positive" };
+
+    if (limits_.burst == 0)
+        throw std::invalid_argument { "Requests burst must be at least 1" };
+}
+
+bool RequestRateLimiter::allow(const std::uint64_t actor, const Clock::time_point now) {
+    const auto capacity { static_cast<double>(limits_.burst) };
+
+    // First command for this actor, its bucket is full
+    const auto [actor_bucket, created] { buckets_.insert({ actor, Bucket { capacity, now, 0 } }) };
+    Bucket& bucket { actor_bucket->second };
+
+    if (!created) { // Refills tokens for time elapsed since previous command
+        const std::chrono::duration<double> elapsed { now - bucket.refilled_at };
+
+        bucket.tokens = std::min(capacity, bucket.tokens + elapsed.count() * limits_.requestsPerSecond);
+        bucket.refilled_at = now;
+    }
+
+    if (bucket.tokens < 1) {
+        bucket.dropped++;
+        dropped_++;
+
+        return false;
+    }
+
+    bucket.tokens--;
+
+    return true;
+}
+
+void RequestRateLimiter::forget(const std::uint64_t actor) {
+    buckets_.erase(actor);
+}
+
+const RequestRateLimits& RequestRateLimiter::limits() const {
+    return limits_;
+}
+
+std::uint64_t RequestRateLimiter::dropped() const {
+    return dropped_;
+}
+
+std::uint64_t RequestRateLimiter::droppedFor(const std::uint64_t actor) const {
+    const auto actor_bucket { buckets_.find(actor) };
+
+    return actor_bucket == buckets_.end() ? 0 : actor_bucket->second.dropped;
+}
+
+
+}
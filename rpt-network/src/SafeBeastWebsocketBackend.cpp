@@ -4,23 +4,162 @@
 namespace RpT::Network {
 
 
+/// Identifies sessions cached by this server, required for OpenSSL to resume them
+constexpr std::string_view SESSION_ID_CONTEXT { "rpt-minigames-server" };
+
+
+void SafeBeastWebsocketBackend::recordHandshake(const std::string& remote_endpoint, const bool resumed,
+                                                const std::chrono::microseconds duration) {
+
+    if (Utils::RuntimeMetrics* const runtime_metrics { metrics() })
+        runtime_metrics->tlsHandshakeDone();
+
+    if (resumed) {
+        handshake_stats_.resumedHandshakes++;
+        handshake_stats_.resumedDuration += duration;
+    } else {
+        handshake_stats_.fullHandshakes++;
+        handshake_stats_.fullDuration += duration;
+    }
+
+    getLogger().debug("TLS handshake with {}: {} in {} us ({} resumed / {} full).", remote_endpoint,
+                      resumed ? "resumed" : "full", duration.count(),
+                      handshake_stats_.resumedHandshakes, handshake_stats_.fullHandshakes);
+}
+
+
+std::shared_ptr<boost::asio::ssl::context> SafeBeastWebsocketBackend::newTlsContext() {
+    const auto new_context { std::make_shared<boost::asio::ssl::context>(boost::asio::ssl::context::tls_server) };
+    SSL_CTX* const native_context { new_context->native_handle() };
+
+    // Sessions remain resumable as long as a ticket encrypted for them can still be decrypted
+    SSL_CTX_set_timeout(native_context, static_cast<long>(2 * tls_ticket_key_rotation_.count()));
+    SSL_CTX_set_session_id_context(native_context, reinterpret_cast<const unsigned char*>(SESSION_ID_CONTEXT.data()),
+                                   SESSION_ID_CONTEXT.size());
+
+    if (tls_session_cache_size_ > 0) {
+        SSL_CTX_set_session_cache_mode(native_context, SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(native_context, static_cast<long>(tls_session_cache_size_));
+    } else {
+        SSL_CTX_set_session_cache_mode(native_context, SSL_SESS_CACHE_OFF);
+    }
+
+    if (tls_tickets_) // Same keys for every context, so tickets issued by previous ones are still accepted
+        ticket_keys_.install(native_context);
+    else
+        SSL_CTX_set_options(native_context, SSL_OP_NO_TICKET);
+
+    new_context->use_certificate_file(certificate_file_, boost::asio::ssl::context::pem);
+    new_context->use_private_key_file(private_key_file_, boost::asio::ssl::context::pem);
+
+    return new_context;
+}
+
+std::shared_ptr<boost::asio::ssl::context> SafeBeastWebsocketBackend::currentTlsContext() const {
+    tls_context_loaded_.wait();
+
+    const std::lock_guard tls_context_guard { tls_context_lock_ };
+
+    return tls_context_;
+}
+
+void SafeBeastWebsocketBackend::waitReloadSignal() {
+    reload_signals_.async_wait([this](const boost::system::error_code& err, const int) {
+        if (err) // Cancelled as backend is closed
+            return;
+
+        getLogger().info("TLS context reload requested.");
+
+        reloadTlsContext();
+        waitReloadSignal();
+    });
+}
+
+
 SafeBeastWebsocketBackend::SafeBeastWebsocketBackend(
         const std::string& certificate_file, const std::string& private_key_file,
-        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context)
+        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context,
+        const BeastWebsocketBackendOptions& options, const std::size_t players_limit)
         : BeastWebsocketBackendBase<boost::beast::ssl_stream<boost::beast::tcp_stream>> {
-    local_endpoint,logging_context },
-    tls_context_ { boost::asio::ssl::context::tls_server } {
+    local_endpoint, logging_context, options, players_limit },
+    ticket_keys_ { options.tlsTicketKeyRotation },
+    certificate_file_ { certificate_file }, private_key_file_ { private_key_file },
+    tls_session_cache_size_ { options.tlsSessionCacheSize }, tls_tickets_ { options.tlsTickets },
+    tls_ticket_key_rotation_ { options.tlsTicketKeyRotation },
+    tls_context_reloads_ { 0 },
+    reload_signals_ { executorContext() },
+    tls_handshake_timeout_ { options.tlsHandshakeTimeout } {
 
     auto logger { getLogger() };
 
+    if (options.tlsSessionCacheSize > 0)
+        logger.debug("TLS sessions cache enabled for {} sessions.", options.tlsSessionCacheSize);
+
+    if (options.tlsTickets)
+        logger.debug("TLS session tickets enabled, keys rotated every {} s.", options.tlsTicketKeyRotation.count());
+
     logger.debug("TLS certificate from: {}", certificate_file);
     logger.debug("TLS private key from: {}", private_key_file);
 
-    // Initializes path for both private key and certificate files
-    tls_context_.use_certificate_file(certificate_file, boost::asio::ssl::context::pem);
-    tls_context_.use_private_key_file(private_key_file, boost::asio::ssl::context::pem);
+    // First context is loaded while server setup goes on
+    tls_context_loaded_ = std::async(std::launch::async, [this]() {
+        std::shared_ptr<boost::asio::ssl::context> loaded_context { newTlsContext() };
 
-    logger.info("Enabled TLS context.");
+        const std::lock_guard tls_context_guard { tls_context_lock_ };
+        tls_context_ = std::move(loaded_context);
+    }).share();
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    boost::system::error_code err;
+    reload_signals_.add(SIGUSR2, err);
+
+    if (err) // Context can still be reloaded by calling reloadTlsContext()
+        logger.warn("TLS context will not be reloaded on SIGUSR2: {}", err.message());
+    else
+        waitReloadSignal();
+#endif
+
+    logger.info("Enabled TLS context, loading certificate and private key.");
+}
+
+SafeBeastWebsocketBackend::~SafeBeastWebsocketBackend() {
+    stopIoThreads();
+}
+
+void SafeBeastWebsocketBackend::waitTlsContext() const {
+    tls_context_loaded_.get();
+}
+
+bool SafeBeastWebsocketBackend::reloadTlsContext() {
+    tls_context_loaded_.wait(); // First context must not replace a reloaded one
+
+    std::shared_ptr<boost::asio::ssl::context> reloaded_context;
+    try {
+        reloaded_context = newTlsContext();
+    } catch (const boost::system::system_error& err) {
+        getLogger().error("Unable to reload TLS context, current one is kept: {}", err.what());
+
+        return false;
+    }
+
+    {
+        // Previous context is freed once last connection opened with it is closed, as OpenSSL counts its references
+        const std::lock_guard tls_context_guard { tls_context_lock_ };
+        tls_context_ = std::move(reloaded_context);
+    }
+
+    tls_context_reloads_++;
+    getLogger().info("TLS context reloaded, used by next handshakes.");
+
+    return true;
+}
+
+std::size_t SafeBeastWebsocketBackend::tlsContextReloads() const {
+    return tls_context_reloads_;
+}
+
+const TlsHandshakeStats& SafeBeastWebsocketBackend::tlsHandshakeStats() const {
+    return handshake_stats_;
 }
 
 void SafeBeastWebsocketBackend::openSecureLayer(SafeBeastWebsocketBackend::WebsocketStream new_client_stream) {
@@ -30,22 +169,44 @@ void SafeBeastWebsocketBackend::openSecureLayer(SafeBeastWebsocketBackend::Webso
     // Get TLS layer from shared Websocket stream
     boost::beast::ssl_stream<boost::beast::tcp_stream>& tls_layer { new_client_stream_owner->next_layer() };
 
+    // Stalled handshake must not hold its connection forever, deadline is replaced once Websocket handshake begins
+    if (tls_handshake_timeout_.count() > 0)
+        boost::beast::get_lowest_layer(tls_layer).expires_after(tls_handshake_timeout_);
+
+    // Handshake duration is measured to know how much time sessions resumption saves
+    const auto handshake_begin { std::chrono::steady_clock::now() };
+
     // Next layer after TCP stream should be TLS layer
     tls_layer.async_handshake(boost::asio::ssl::stream_base::server,
-                              [this, new_client_stream_owner](const boost::system::error_code& err) {
+                              [this, new_client_stream_owner, handshake_begin](const boost::system::error_code& err) {
+
+        const boost::asio::ip::tcp::socket& underlying_socket { // Get base connection socket for logging
+            new_client_stream_owner->next_layer().next_layer().socket()
+        };
 
         if (err) {
             if (err != boost::asio::error::operation_aborted) {
-                const boost::asio::ip::tcp::socket& underlying_socket { // Get base connection socket for logging
-                    new_client_stream_owner->next_layer().next_layer().socket()
-                };
+                // Handler is called from connection strand, logging must be done by Executor thread
+                dispatchToExecutor([this, remote_endpoint { endpointFor(underlying_socket) }, err]() {
+                    handshake_stats_.failedHandshakes++;
 
-                getLogger().error("TLS handshaking with {}: {}", endpointFor(underlying_socket), err.message());
+                    getLogger().error("TLS handshaking with {}: {}", remote_endpoint, err.message());
+                });
             }
 
             return; // In any case, failed TLS handshaking means client should NOT be added into registry
         }
 
+        const auto handshake_duration {
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - handshake_begin)
+        };
+        // Checked from connection strand as TLS layer must not be accessed from Executor thread
+        const bool resumed { SSL_session_reused(new_client_stream_owner->next_layer().native_handle()) == 1 };
+
+        dispatchToExecutor([this, remote_endpoint { endpointFor(underlying_socket) }, resumed, handshake_duration]() {
+            recordHandshake(remote_endpoint, resumed, handshake_duration);
+        });
+
         // Moves WSS stream to open WSS layer
         openSafeWebsocketLayer(std::move(*new_client_stream_owner));
     });
@@ -55,29 +216,36 @@ void SafeBeastWebsocketBackend::openSafeWebsocketLayer(SafeBeastWebsocketBackend
     // Websocket stream should be alive until WSS layer has been open
     const auto new_client_stream_owner { std::make_shared<WebsocketStream>(std::move(new_client_stream)) };
 
-    new_client_stream_owner->async_accept([this, new_client_stream_owner](const boost::system::error_code& err) {
+    acceptWebsocket(new_client_stream_owner, [this, new_client_stream_owner](const boost::system::error_code& err,
+                                                                             const NegotiatedFeatures& negotiated) {
         boost::asio::ip::tcp::socket& underlying_socket { // Get base TCP socket for logging purpose
                 new_client_stream_owner->next_layer().next_layer().socket()
         };
 
         if (err) {
             if (err != boost::asio::error::operation_aborted) { // Ignores if server stopped
-                getLogger().error("WSS accepting connection from {}: {}",
-                                  endpointFor(underlying_socket), err.message());
+                dispatchToExecutor([this, remote_endpoint { endpointFor(underlying_socket) }, err]() {
+                    getLogger().error("WSS accepting connection from {}: {}", remote_endpoint, err.message());
+                });
             }
 
             return; // In any case, failed WSS handshaking/accepting means client should NOT be added into registry
         }
 
         // Moves WSS open stream into clients registry
-        addClientStream(underlying_socket, std::move(*new_client_stream_owner));
+        addClientStream(underlying_socket, std::move(*new_client_stream_owner), negotiated);
     });
 }
 
 void SafeBeastWebsocketBackend::openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) {
-    // Builds new websocket stream over security layer using TLS features
+    // Connections accepted while certificate is loading wait for it, they are closed if it couldn't be loaded
+    const std::shared_ptr<boost::asio::ssl::context> tls_context { currentTlsContext() };
+    if (!tls_context)
+        return;
+
+    // Builds new websocket stream over security layer using current TLS features
     WebsocketStream new_client_stream {
-        std::move(new_client_connection), tls_context_
+        std::move(new_client_connection), *tls_context
     };
 
     openSecureLayer(std::move(new_client_stream)); // Open TLS layer for given Websocket stream
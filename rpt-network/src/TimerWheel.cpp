@@ -0,0 +1,226 @@
+#include <RpT-Network/TimerWheel.hpp>
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+
+namespace RpT::Network {
+
+
+/// Retrieves number of ticks covered by a slot at given level
+constexpr std::uint64_t slotSpan(const unsigned level) {
+    return std::uint64_t { 1 } << (TimerWheel::SLOT_BITS * level);
+}
+
+
+std::uint32_t TimerWheel::slotIndex(const unsigned level, const std::uint64_t tick) {
+    return static_cast<std::uint32_t>((tick >> (SLOT_BITS * level)) & (SLOTS - 1));
+}
+
+void TimerWheel::link(const std::uint32_t entry_index) {
+    Entry& entry { entries_[entry_index] };
+
+    // Expired deadline is put inside slot handled next
+    std::uint64_t slot_tick { std::max(entry.deadline, current_tick_) };
+    const std::uint64_t delay { slot_tick - current_tick_ };
+
+    unsigned level { 0 };
+    while (level < LEVELS - 1 && delay >= slotSpan(level + 1))
+        level++;
+
+    // Too far for top level, kept at its end until it cascades again
+    if (delay >= slotSpan(LEVELS))
+        slot_tick = current_tick_ + slotSpan(LEVELS) - 1;
+
+    const std::uint32_t slot { level * static_cast<std::uint32_t>(SLOTS) + slotIndex(level, slot_tick) };
+
+    entry.slot = slot;
+    entry.previous = NO_ENTRY;
+    entry.next = slots_[slot];
+
+    if (entry.next != NO_ENTRY)
+        entries_[entry.next].previous = entry_index;
+
+    slots_[slot] = entry_index;
+    levels_size_[level]++;
+}
+
+void TimerWheel::unlink(const std::uint32_t entry_index) {
+    const Entry& entry { entries_[entry_index] };
+
+    if (entry.previous == NO_ENTRY)
+        slots_[entry.slot] = entry.next;
+    else
+        entries_[entry.previous].next = entry.next;
+
+    if (entry.next != NO_ENTRY)
+        entries_[entry.next].previous = entry.previous;
+
+    levels_size_[entry.slot / SLOTS]--;
+}
+
+void TimerWheel::release(const std::uint32_t entry_index) {
+    unlink(entry_index);
+
+    Entry& entry { entries_[entry_index] };
+    scheduled_entries_.erase(entry.token);
+
+    entry.slot = first_free_entry_;
+    first_free_entry_ = entry_index;
+}
+
+void TimerWheel::cascade(const unsigned level) {
+    if (level == LEVELS)
+        return;
+
+    const std::uint32_t index { slotIndex(level, current_tick_) };
+    if (index == 0) // This level also wrapped, so its current slot must first receive entries from next level
+        cascade(level + 1);
+
+    // Slot is emptied before its entries are linked again, as some might go back into same level
+    const std::uint32_t slot { level * static_cast<std::uint32_t>(SLOTS) + index };
+    std::uint32_t next_entry { slots_[slot] };
+    slots_[slot] = NO_ENTRY;
+
+    while (next_entry != NO_ENTRY) {
+        const std::uint32_t cascaded_entry { next_entry };
+        next_entry = entries_[cascaded_entry].next;
+
+        levels_size_[level]--;
+        link(cascaded_entry);
+    }
+}
+
+TimerWheel::TimerWheel(const std::uint64_t current_tick)
+: current_tick_ { current_tick }, first_free_entry_ { NO_ENTRY }, levels_size_ {} {
+    slots_.fill(NO_ENTRY);
+}
+
+void TimerWheel::schedule(const std::uint64_t token, const std::uint64_t deadline) {
+    if (scheduled_entries_.count(token) == 1)
+        throw std::invalid_argument { "Token " + std::to_string(token) + " is already scheduled" };
+
+    std::uint32_t entry_index;
+    if (first_free_entry_ == NO_ENTRY) { // Pool must grow
+        entry_index = static_cast<std::uint32_t>(entries_.size());
+        entries_.emplace_back();
+    } else {
+        entry_index = first_free_entry_;
+        first_free_entry_ = entries_[entry_index].slot;
+    }
+
+    Entry& entry { entries_[entry_index] };
+    entry.token = token;
+    entry.deadline = deadline;
+
+    link(entry_index);
+    scheduled_entries_.insert({ token, entry_index });
+}
+
+bool TimerWheel::cancel(const std::uint64_t token) {
+    const auto scheduled_entry { scheduled_entries_.find(token) };
+    if (scheduled_entry == scheduled_entries_.end())
+        return false;
+
+    release(scheduled_entry->second);
+
+    return true;
+}
+
+std::optional<std::uint64_t> TimerWheel::nextTick() const {
+    if (scheduled_entries_.empty())
+        return {};
+
+    std::optional<std::uint64_t> next_tick;
+
+    // Lowest non-empty higher level cascades before higher ones do, at next multiple of its slots span
+    for (unsigned level { 1 }; level < LEVELS; level++) {
+        if (levels_size_[level] > 0) {
+            const std::uint64_t span { slotSpan(level) };
+            next_tick = (current_tick_ + span - 1) / span * span;
+
+            break;
+        }
+    }
+
+    // Lowest level slots are only checked for ticks before that cascade, which might bring earlier deadlines
+    if (levels_size_[0] > 0) {
+        for (std::uint64_t tick { current_tick_ }; tick < current_tick_ + SLOTS; tick++) {
+            if (next_tick.has_value() && tick >= *next_tick)
+                break;
+
+            if (slots_[slotIndex(0, tick)] != NO_ENTRY)
+                return tick;
+        }
+    }
+
+    assert(next_tick.has_value()); // Some entries are scheduled, so there is at least one non-empty level
+
+    return next_tick;
+}
+
+std::uint64_t TimerWheel::currentTick() const {
+    return current_tick_;
+}
+
+std::size_t TimerWheel::size() const {
+    return scheduled_entries_.size();
+}
+
+
+std::uint64_t AsioTimerWheel::now() const {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - origin_).count());
+}
+
+void AsioTimerWheel::arm() {
+    const std::optional<std::uint64_t> next_tick { wheel_.nextTick() };
+
+    // Steady timer waiting for an earlier tick will arm again once expired
+    if (!next_tick.has_value() || (armed_tick_.has_value() && *armed_tick_ <= *next_tick))
+        return;
+
+    armed_tick_ = *next_tick;
+
+    // Rescheduling cancels previous wait, which handler ignores
+    wheel_timer_.expires_at(origin_ + std::chrono::milliseconds { *next_tick });
+    wheel_timer_.async_wait([this](const boost::system::error_code& err) {
+        if (err == boost::asio::error::operation_aborted) // Rescheduled, or server stopped
+            return;
+
+        expire();
+    });
+}
+
+void AsioTimerWheel::expire() {
+    armed_tick_.reset();
+
+    wheel_.advance(now(), trigger_handler_);
+
+    arm();
+}
+
+AsioTimerWheel::AsioTimerWheel(boost::asio::io_context& io_context,
+                               std::function<void(std::uint64_t)> trigger_handler)
+: origin_ { std::chrono::steady_clock::now() }, wheel_timer_ { io_context },
+trigger_handler_ { std::move(trigger_handler) } {}
+
+void AsioTimerWheel::beginTimer(Core::Timer& ready_timer) {
+    const std::uint64_t token { ready_timer.token() };
+    // Deadline is computed before timer state becomes Pending, as in a countdown beginning with this call. Timers with
+    // a slack share coalesced deadlines, so they expire inside same wheel slot with a single steady timer wakeup
+    const std::uint64_t deadline { Core::coalescedDeadline(now(), ready_timer.beginCountdown(), ready_timer.slack()) };
+
+    wheel_.schedule(token, deadline);
+
+    // If RpT timer is cancelled (clear()), then its token must not expire anymore
+    ready_timer.onNextClear([this, token]() {
+        wheel_.cancel(token);
+    });
+
+    arm();
+}
+
+
+}
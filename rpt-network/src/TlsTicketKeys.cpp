@@ -0,0 +1,146 @@
+#include <RpT-Network/TlsTicketKeys.hpp>
+
+#include <algorithm>
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+
+namespace RpT::Network {
+
+
+/// Size in bytes for AES-256-CBC initialization vector
+constexpr std::size_t IV_LENGTH { 16 };
+
+/// OpenSSL ticket callback return values
+constexpr int TICKET_KEY_NOT_FOUND { 0 };
+constexpr int TICKET_KEY_FOUND { 1 };
+constexpr int TICKET_KEY_FOUND_RENEW { 2 };
+constexpr int TICKET_KEY_ERROR { -1 };
+
+
+/// Retrieves OpenSSL context extra data slot used to find keys instance from ticket callback
+int keysDataIndex() {
+    static const int index { SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr) };
+
+    return index;
+}
+
+/// Sets HMAC-SHA256 authentication with given key for given OpenSSL MAC context
+bool initializeHmac(EVP_MAC_CTX* hmac_context, const TlsTicketKeys::Key& key) {
+    // OpenSSL parameters API requires mutable pointers, even if data isn't modified
+    char digest_name[] { "SHA256" };
+    auto hmac_key { key.hmacKey };
+
+    const OSSL_PARAM hmac_parameters[] {
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest_name, 0),
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, hmac_key.data(), hmac_key.size()),
+        OSSL_PARAM_construct_end()
+    };
+
+    return EVP_MAC_CTX_set_params(hmac_context, hmac_parameters) == 1;
+}
+
+
+int TlsTicketKeys::ticketKeyCallback(SSL* connection, unsigned char* key_name, unsigned char* iv,
+                                     EVP_CIPHER_CTX* cipher_context, EVP_MAC_CTX* hmac_context, const int enc) {
+
+    auto& keys { *static_cast<TlsTicketKeys*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(connection), keysDataIndex())) };
+
+    try {
+        if (enc == 1) { // A new ticket is issued, it must be encrypted with current key
+            const Key key { keys.encryptionKey() };
+
+            if (RAND_bytes(iv, IV_LENGTH) != 1)
+                return TICKET_KEY_ERROR;
+
+            std::copy(key.name.cbegin(), key.name.cend(), key_name);
+
+            if (EVP_EncryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, key.aesKey.data(), iv) != 1)
+                return TICKET_KEY_ERROR;
+
+            return initializeHmac(hmac_context, key) ? TICKET_KEY_FOUND : TICKET_KEY_ERROR;
+        } else { // A ticket was received, key must be found from ticket key name
+            const std::optional<DecryptionKey> decryption_key { keys.decryptionKey(key_name) };
+
+            if (!decryption_key.has_value()) // Unknown or expired key, full handshake will be done
+                return TICKET_KEY_NOT_FOUND;
+
+            const Key& key { decryption_key->key };
+
+            if (EVP_DecryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, key.aesKey.data(), iv) != 1)
+                return TICKET_KEY_ERROR;
+
+            if (!initializeHmac(hmac_context, key))
+                return TICKET_KEY_ERROR;
+
+            return decryption_key->renew ? TICKET_KEY_FOUND_RENEW : TICKET_KEY_FOUND;
+        }
+    } catch (const TicketKeyGenerationFailed&) { // Exceptions must not be propagated through OpenSSL C code
+        return TICKET_KEY_ERROR;
+    }
+}
+
+TlsTicketKeys::Key TlsTicketKeys::generateKey() {
+    Key new_key;
+
+    if (RAND_bytes(new_key.name.data(), new_key.name.size()) != 1
+        || RAND_bytes(new_key.aesKey.data(), new_key.aesKey.size()) != 1
+        || RAND_bytes(new_key.hmacKey.data(), new_key.hmacKey.size()) != 1) {
+
+        throw TicketKeyGenerationFailed {};
+    }
+
+    return new_key;
+}
+
+void TlsTicketKeys::rotateIfExpired(const Clock::time_point now) {
+    const Clock::duration current_key_age { now - current_key_creation_ };
+
+    if (current_key_age < rotation_period_) // Current key still valid, nothing to do
+        return;
+
+    // If current key is older than 2 periods, tickets it encrypted have expired too and it must not be kept
+    if (current_key_age < 2 * rotation_period_)
+        previous_key_ = current_key_;
+    else
+        previous_key_.reset();
+
+    current_key_ = generateKey();
+    current_key_creation_ = now;
+}
+
+TlsTicketKeys::TlsTicketKeys(const std::chrono::seconds rotation_period)
+: rotation_period_ { rotation_period }, current_key_ { generateKey() }, current_key_creation_ { Clock::now() } {}
+
+TlsTicketKeys::Key TlsTicketKeys::encryptionKey(const Clock::time_point now) {
+    const std::lock_guard<std::mutex> keys_lock { keys_access_ };
+
+    rotateIfExpired(now);
+
+    return current_key_;
+}
+
+std::optional<TlsTicketKeys::DecryptionKey> TlsTicketKeys::decryptionKey(const unsigned char* key_name,
+                                                                         const Clock::time_point now) {
+
+    const std::lock_guard<std::mutex> keys_lock { keys_access_ };
+
+    rotateIfExpired(now);
+
+    if (std::equal(current_key_.name.cbegin(), current_key_.name.cend(), key_name))
+        return DecryptionKey { current_key_, false };
+
+    if (previous_key_.has_value() && std::equal(previous_key_->name.cbegin(), previous_key_->name.cend(), key_name))
+        return DecryptionKey { *previous_key_, true };
+
+    return {}; // Key is unknown or has expired
+}
+
+void TlsTicketKeys::install(SSL_CTX* tls_context) {
+    SSL_CTX_set_ex_data(tls_context, keysDataIndex(), this);
+    SSL_CTX_set_tlsext_ticket_key_evp_cb(tls_context, ticketKeyCallback);
+}
+
+
+}
@@ -4,27 +4,33 @@ namespace RpT::Network {
 
 
 UnsafeBeastWebsocketBackend::UnsafeBeastWebsocketBackend(
-        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context)
-        : BeastWebsocketBackendBase<boost::beast::tcp_stream> { local_endpoint, logging_context } {}
+        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context,
+        const BeastWebsocketBackendOptions& options, const std::size_t players_limit)
+        : BeastWebsocketBackendBase<boost::beast::tcp_stream> {
+    local_endpoint, logging_context, options, players_limit } {}
 
 void UnsafeBeastWebsocketBackend::openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) {
     // Stream ownership is not inside connected clients registry yet, ownership need to be preserved by async IO
     // handler
     const auto new_client_stream { std::make_shared<WebsocketStream>(std::move(new_client_connection)) };
 
-    new_client_stream->async_accept([this, new_client_stream](const boost::system::error_code& err) {
+    acceptWebsocket(new_client_stream, [this, new_client_stream](const boost::system::error_code& err,
+                                                                 const NegotiatedFeatures& negotiated) {
         boost::asio::ip::tcp::socket& underlying_socket { new_client_stream->next_layer().socket() };
 
         if (err) {
-            if (err != boost::asio::error::operation_aborted) // Silent if server was stopped
-                getLogger().error("Websocket handshaking with {}: {}",
-                                  endpointFor(underlying_socket), err.message());
+            if (err != boost::asio::error::operation_aborted) { // Silent if server was stopped
+                // Handler is called from connection strand, logging must be done by Executor thread
+                dispatchToExecutor([this, remote_endpoint { endpointFor(underlying_socket) }, err]() {
+                    getLogger().error("Websocket handshaking with {}: {}", remote_endpoint, err.message());
+                });
+            }
 
             return; // In any case, failed Websocket handshake means client should NOT be added to registry
         }
 
         // Successfully handshake Websocket, move stream into registry, providing underlying TCP socket
-        addClientStream(underlying_socket, std::move(*new_client_stream));
+        addClientStream(underlying_socket, std::move(*new_client_stream), negotiated);
     });
 }
 
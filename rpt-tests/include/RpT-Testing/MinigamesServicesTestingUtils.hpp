@@ -1,6 +1,9 @@
 #ifndef RPT_MINIGAMES_SERVER_MINIGAMESSERVICESTESTINGUTILS_HPP
 #define RPT_MINIGAMES_SERVER_MINIGAMESSERVICESTESTINGUTILS_HPP
 
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
 #include <Minigames-Services/BoardGame.hpp>
 #include <Minigames-Services/Grid.hpp>
 
@@ -21,6 +24,60 @@ std::ostream& operator<<(std::ostream& out, Player player);
 std::ostream& operator<<(std::ostream& out, const Coordinates& coordinates);
 /// Required by BOOST_CHECK_EQUAL macro usage with Coordinates type, format: "Coords={<square>} State={updatedState}"
 std::ostream& operator<<(std::ostream& out, const SquareUpdate& square_update);
+/// Required by BOOST_CHECK_EQUAL macro usage with PawnMove type, format: "From={<from>} To={<to>}"
+std::ostream& operator<<(std::ostream& out, const PawnMove& move);
+
+
+/**
+ * @brief Checks for every move between two squares of a new game to be legal if and only if `play()` succeeds with
+ * that move on another new game, and for `legalMoves()` to enumerate exactly these legal moves
+ *
+ * @tparam Game Default constructible `BoardGame` implementation
+ */
+template<typename Game>
+void checkLegalMovesMatchPlay() {
+    const Game game;
+    const std::vector<PawnMove> legal_moves { game.legalMoves() };
+
+    const int lines_count { game.grid().linesCount() };
+    const int columns_count { game.grid().columnsCount() };
+
+    std::size_t legal_moves_count { 0 };
+    for (int from_line { 1 }; from_line <= lines_count; from_line++) {
+        for (int from_column { 1 }; from_column <= columns_count; from_column++) {
+            for (int to_line { 1 }; to_line <= lines_count; to_line++) {
+                for (int to_column { 1 }; to_column <= columns_count; to_column++) {
+                    const PawnMove move { { from_line, from_column }, { to_line, to_column } };
+
+                    bool played;
+                    try {
+                        Game played_game;
+                        played_game.play(move.from, move.to);
+
+                        played = true;
+                    } catch (const std::exception&) {
+                        played = false;
+                    }
+
+                    const bool enumerated {
+                        std::find(legal_moves.begin(), legal_moves.end(), move) != legal_moves.end()
+                    };
+
+                    BOOST_CHECK_MESSAGE(game.isLegal(move) == played, "isLegal() mismatch for " << move);
+                    BOOST_CHECK_MESSAGE(enumerated == played, "legalMoves() mismatch for " << move);
+
+                    if (played)
+                        legal_moves_count++;
+                }
+            }
+        }
+    }
+
+    // Each legal move must be enumerated once
+    BOOST_CHECK_EQUAL(legal_moves.size(), legal_moves_count);
+    BOOST_CHECK_EQUAL(game.hasLegalMove(), legal_moves_count != 0);
+}
+
 
 }
 
@@ -113,4 +113,9 @@ BOOST_AUTO_TEST_CASE(DestinationSquareFree) {
 BOOST_AUTO_TEST_SUITE_END()
 
 
+BOOST_AUTO_TEST_CASE(LegalMovesMatchPlay) {
+    checkLegalMovesMatchPlay<Acores>();
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,62 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <vector>
+#include <RpT-Core/ActorUidsSet.hpp>
+
+
+using namespace RpT::Core;
+
+
+BOOST_AUTO_TEST_SUITE(ActorUidsSetTests)
+
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const ActorUidsSet uids;
+
+    BOOST_CHECK(uids.empty());
+    BOOST_CHECK_EQUAL(uids.size(), 0);
+    BOOST_CHECK(uids.begin() == uids.end());
+    BOOST_CHECK(!uids.contains(0));
+}
+
+BOOST_AUTO_TEST_CASE(DuplicatesIgnored) {
+    ActorUidsSet uids { 1, 2, 1 };
+
+    BOOST_CHECK_EQUAL(uids.size(), 2);
+    BOOST_CHECK(!uids.insert(2));
+    BOOST_CHECK(uids.insert(3));
+
+    // Insertion order is kept
+    const std::vector<std::uint64_t> expected_uids { 1, 2, 3 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(uids.begin(), uids.end(), expected_uids.begin(), expected_uids.end());
+}
+
+BOOST_AUTO_TEST_CASE(InlineStorageOverflow) {
+    ActorUidsSet uids;
+
+    // One UID more than inline storage can contain, so UIDs are moved to heap
+    std::vector<std::uint64_t> expected_uids;
+    for (std::uint64_t actor_uid { 0 }; actor_uid <= ActorUidsSet::INLINE_CAPACITY; actor_uid++) {
+        BOOST_CHECK(uids.insert(actor_uid));
+        expected_uids.push_back(actor_uid);
+    }
+
+    BOOST_CHECK_EQUAL(uids.size(), ActorUidsSet::INLINE_CAPACITY + 1);
+    BOOST_CHECK(uids.contains(ActorUidsSet::INLINE_CAPACITY));
+    BOOST_CHECK(!uids.insert(0));
+    BOOST_CHECK_EQUAL_COLLECTIONS(uids.begin(), uids.end(), expected_uids.begin(), expected_uids.end());
+
+    // Copy must view its own UIDs
+    const ActorUidsSet copy { uids };
+    BOOST_CHECK(copy == uids);
+    BOOST_CHECK(copy.begin() != uids.begin());
+}
+
+BOOST_AUTO_TEST_CASE(EqualityIgnoresOrder) {
+    BOOST_CHECK((ActorUidsSet { 1, 2, 3 } == ActorUidsSet { 3, 1, 2 }));
+    BOOST_CHECK((ActorUidsSet { 1, 2, 3 } != ActorUidsSet { 1, 2 }));
+    BOOST_CHECK((ActorUidsSet { 1, 2 } != ActorUidsSet { 1, 3 }));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
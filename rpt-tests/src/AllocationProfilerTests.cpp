@@ -0,0 +1,100 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <new>
+#include <sstream>
+#include <RpT-Utils/AllocationProfiler.hpp>
+
+
+using namespace RpT::Utils;
+
+
+/// Allocates then frees given number of bytes, calling allocation functions directly so it cannot be elided
+void allocateThenFree(const std::size_t bytes) {
+    ::operator delete(::operator new(bytes));
+}
+
+
+BOOST_AUTO_TEST_SUITE(AllocationProfilerTests)
+
+
+BOOST_AUTO_TEST_CASE(SubsystemNames) {
+    BOOST_CHECK_EQUAL(AllocationProfiler::subsystemName(AllocationSubsystem::Other), "other");
+    BOOST_CHECK_EQUAL(AllocationProfiler::subsystemName(AllocationSubsystem::Network), "network");
+    BOOST_CHECK_EQUAL(AllocationProfiler::subsystemName(AllocationSubsystem::Ser), "ser");
+    BOOST_CHECK_EQUAL(AllocationProfiler::subsystemName(AllocationSubsystem::Services), "services");
+    BOOST_CHECK_EQUAL(AllocationProfiler::subsystemName(AllocationSubsystem::Games), "games");
+}
+
+BOOST_AUTO_TEST_CASE(ScopedAllocations) {
+    const AllocationCounts games_begin { AllocationProfiler::subsystem(AllocationSubsystem::Games) };
+    const AllocationCounts thread_begin { AllocationProfiler::currentThread() };
+
+    {
+        const AllocationScope games_allocations { AllocationSubsystem::Games };
+
+        allocateThenFree(100);
+        allocateThenFree(28);
+    }
+
+    const AllocationCounts games_allocations {
+        AllocationProfiler::subsystem(AllocationSubsystem::Games) - games_begin
+    };
+    const AllocationCounts thread_allocations { AllocationProfiler::currentThread() - thread_begin };
+
+    if constexpr (AllocationProfiler::ENABLED) {
+        BOOST_CHECK_EQUAL(games_allocations.allocations, 2);
+        BOOST_CHECK_EQUAL(games_allocations.bytes, 128);
+        BOOST_CHECK_EQUAL(thread_allocations.allocations, 2);
+    } else { // Nothing is counted without instrumentation
+        BOOST_CHECK_EQUAL(games_allocations.allocations, 0);
+        BOOST_CHECK_EQUAL(thread_allocations.allocations, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NestedScopes) {
+    const AllocationCounts ser_begin { AllocationProfiler::subsystem(AllocationSubsystem::Ser) };
+    const AllocationCounts services_begin { AllocationProfiler::subsystem(AllocationSubsystem::Services) };
+
+    {
+        const AllocationScope ser_allocations { AllocationSubsystem::Ser };
+
+        {
+            const AllocationScope services_allocations { AllocationSubsystem::Services };
+
+            allocateThenFree(16);
+        }
+
+        allocateThenFree(32); // Back to outer scope subsystem
+    }
+
+    const AllocationCounts ser_allocations { AllocationProfiler::subsystem(AllocationSubsystem::Ser) - ser_begin };
+    const AllocationCounts services_allocations {
+        AllocationProfiler::subsystem(AllocationSubsystem::Services) - services_begin
+    };
+
+    if constexpr (AllocationProfiler::ENABLED) {
+        BOOST_CHECK_EQUAL(ser_allocations.bytes, 32);
+        BOOST_CHECK_EQUAL(services_allocations.bytes, 16);
+    } else {
+        BOOST_CHECK_EQUAL(ser_allocations.bytes, 0);
+        BOOST_CHECK_EQUAL(services_allocations.bytes, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ExportInputEvents) {
+    AllocationProfiler::inputEventHandled("TestEvent", { 3, 96 });
+    AllocationProfiler::inputEventHandled("TestEvent", { 1, 4 });
+
+    std::ostringstream output;
+    AllocationProfiler::exportTo(output);
+    const std::string samples { output.str() };
+
+    BOOST_CHECK(samples.find("# TYPE rpt_allocations_total counter\n") != std::string::npos);
+    BOOST_CHECK(samples.find("rpt_allocated_bytes_total{subsystem=\"network\"} ") != std::string::npos);
+    BOOST_CHECK(samples.find("rpt_profiled_input_events_total{event=\"TestEvent\"} 2\n") != std::string::npos);
+    BOOST_CHECK(samples.find("rpt_input_event_allocations_total{event=\"TestEvent\"} 4\n") != std::string::npos);
+    BOOST_CHECK(samples.find("rpt_input_event_allocated_bytes_total{event=\"TestEvent\"} 100\n") != std::string::npos);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <RpT-Utils/AsyncLoggingSink.hpp>
+#include <RpT-Utils/LoggingContext.hpp>
+
+
+using namespace RpT::Utils;
+
+
+/// Records written messages payload, first write being blocked until `release()` is called
+class BlockingSink : public spdlog::sinks::sink {
+private:
+    std::promise<void> first_write_;
+    std::promise<void> released_;
+    std::shared_future<void> release_;
+    bool first_write_done_;
+
+    std::mutex written_mutex_;
+    std::vector<std::string> written_;
+
+public:
+    BlockingSink() : release_ { released_.get_future().share() }, first_write_done_ { false } {}
+
+    /// Waits until flusher thread is writing first message
+    void waitFirstWrite() {
+        first_write_.get_future().wait();
+    }
+
+    /// Unblocks flusher thread
+    void release() {
+        released_.set_value();
+    }
+
+    std::vector<std::string> written() {
+        const std::lock_guard written_lock { written_mutex_ };
+
+        return written_;
+    }
+
+    void log(const spdlog::details::log_msg& msg) override {
+        {
+            const std::lock_guard written_lock { written_mutex_ };
+
+            written_.emplace_back(msg.payload.data(), msg.payload.size());
+        }
+
+        if (!first_write_done_) {
+            first_write_done_ = true;
+
+            first_write_.set_value();
+            release_.wait();
+        }
+    }
+
+    void flush() override {}
+    void set_pattern(const std::string&) override {}
+    void set_formatter(std::unique_ptr<spdlog::formatter>) override {}
+};
+
+/// Logs given payload into given sink
+void logInto(AsyncLoggingSink& sink, const std::string_view payload) {
+    sink.log(spdlog::details::log_msg { "Test", spdlog::level::info, payload });
+}
+
+
+BOOST_AUTO_TEST_SUITE(AsyncLoggingSinkTests)
+
+
+BOOST_AUTO_TEST_CASE(ZeroCapacity) {
+    BOOST_CHECK_THROW((AsyncLoggingSink { {}, 0, LogOverflowPolicy::BLOCK }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(EveryMessageWritten) {
+    const auto backend { std::make_shared<BlockingSink>() };
+    backend->release(); // Never blocks
+
+    {
+        AsyncLoggingSink sink { { backend }, 16, LogOverflowPolicy::BLOCK };
+
+        logInto(sink, "a");
+        logInto(sink, "b");
+        logInto(sink, "c");
+
+        BOOST_CHECK_EQUAL(sink.droppedMessages(), 0);
+    } // Remaining messages are written when sink is destroyed
+
+    const std::vector<std::string> expected_written { "a", "b", "c" };
+    const std::vector<std::string> actual_written { backend->written() };
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual_written.begin(), actual_written.end(),
+                                  expected_written.begin(), expected_written.end());
+}
+
+BOOST_AUTO_TEST_CASE(DropNew) {
+    const auto backend { std::make_shared<BlockingSink>() };
+
+    {
+        AsyncLoggingSink sink { { backend }, 1, LogOverflowPolicy::DROP };
+
+        logInto(sink, "a");
+        backend->waitFirstWrite(); // Queue is empty again, flusher is blocked
+
+        logInto(sink, "b"); // Fills queue
+        logInto(sink, "c"); // Dropped
+
+        BOOST_CHECK_EQUAL(sink.droppedMessages(), 1);
+
+        backend->release();
+    }
+
+    const std::vector<std::string> expected_written { "a", "b" };
+    const std::vector<std::string> actual_written { backend->written() };
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual_written.begin(), actual_written.end(),
+                                  expected_written.begin(), expected_written.end());
+}
+
+BOOST_AUTO_TEST_CASE(DropOldest) {
+    const auto backend { std::make_shared<BlockingSink>() };
+
+    {
+        AsyncLoggingSink sink { { backend }, 1, LogOverflowPolicy::DROP_OLDEST };
+
+        logInto(sink, "a");
+        backend->waitFirstWrite();
+
+        logInto(sink, "b"); // Dropped when next message is logged
+        logInto(sink, "c");
+
+        BOOST_CHECK_EQUAL(sink.droppedMessages(), 1);
+
+        backend->release();
+    }
+
+    const std::vector<std::string> expected_written { "a", "c" };
+    const std::vector<std::string> actual_written { backend->written() };
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual_written.begin(), actual_written.end(),
+                                  expected_written.begin(), expected_written.end());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
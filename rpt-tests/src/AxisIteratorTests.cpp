@@ -194,4 +194,52 @@ BOOST_AUTO_TEST_CASE(DiagonalAxisBetween) {
 }
 
 
+BOOST_AUTO_TEST_CASE(EndOfAxis) {
+    AxisIterator it { grid, { 9, 1 }, { 10, 1 } };
+
+    BOOST_CHECK_EQUAL(it.moveForward(), EMPTY);
+    BOOST_CHECK(!it.hasNext());
+    BOOST_CHECK_THROW(it.moveForward(), BadCoordinates);
+    // Failed move must not have changed iterator position
+    BOOST_CHECK_EQUAL(it.currentPosition(), (Coordinates { 10, 1 }));
+}
+
+BOOST_AUTO_TEST_CASE(EndOfDiagonalAxis) {
+    AxisIterator it { grid, { 2, 2 }, { 3, 3 } };
+
+    // Last column is reached before last line
+    it.moveForward();
+    it.moveForward();
+    BOOST_CHECK_EQUAL(it.moveForward(), EMPTY);
+    BOOST_CHECK(!it.hasNext());
+    BOOST_CHECK_EQUAL(it.currentPosition(), (Coordinates { 5, 5 }));
+}
+
+BOOST_AUTO_TEST_CASE(AllowedDirectionsMask) {
+    BOOST_CHECK(AxisIterator::EVERY_DIRECTION_MASK.has(AxisType::UpLeft));
+    BOOST_CHECK(AxisIterator::EVERY_ORTHOGONAL_DIRECTION_MASK.has(AxisType::Down));
+    BOOST_CHECK(!AxisIterator::EVERY_ORTHOGONAL_DIRECTION_MASK.has(AxisType::DownRight));
+    BOOST_CHECK(AxisIterator::EVERY_DIAGONAL_DIRECTION_MASK.has(AxisType::DownLeft));
+    BOOST_CHECK(!AxisIterator::EVERY_DIAGONAL_DIRECTION_MASK.has(AxisType::Left));
+}
+
+BOOST_AUTO_TEST_CASE(MutableFlag) {
+    const Grid& const_grid { grid };
+    AxisIterator mutable_it { grid, { 1, 1 }, { 1, 2 } };
+    AxisIterator immutable_it { const_grid, { 1, 1 }, { 1, 2 } };
+
+    BOOST_CHECK_THROW(mutable_it.moveForwardImmutable(), BadMutableFlag);
+    BOOST_CHECK_THROW(immutable_it.moveForward(), BadMutableFlag);
+    BOOST_CHECK_EQUAL(immutable_it.moveForwardImmutable(), WHITE);
+}
+
+BOOST_AUTO_TEST_CASE(ModifiesGrid) {
+    AxisIterator it { grid, { 3, 1 }, { 1, 3 } };
+
+    it.moveForward() = BLACK; // Square at (2, 2) is a view into grid
+
+    BOOST_CHECK_EQUAL((grid[{ 2, 2 }]), BLACK);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
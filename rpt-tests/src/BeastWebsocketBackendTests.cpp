@@ -0,0 +1,301 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <boost/asio/read.hpp>
+#include <boost/beast/core/buffers_to_string.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/websocket.hpp>
+#include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/Timer.hpp>
+#include <RpT-Network/UnsafeBeastWebsocketBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Blocking Websocket client stream used to simulate a client
+using ClientStream = boost::beast::websocket::stream<boost::asio::ip::tcp::socket>;
+
+
+/// Checks for given event variant to be of expected input event type
+template<typename ExpectedEventT>
+bool isEventType(const RpT::Core::AnyInputEvent& event_variant) {
+    return std::get_if<ExpectedEventT>(&event_variant) != nullptr;
+}
+
+
+/// Provides a backend listening on a port chosen by system, with short timeouts so tests don't last
+struct BeastWebsocketBackendFixture {
+    /// Each countdown lasts more than every timeout, so a timer event means no client was killed before
+    static constexpr std::size_t COUNTDOWN_MS { 400 };
+    /// Idle clients are pinged every half of it
+    static constexpr std::size_t IDLE_TIMEOUT_MS { 200 };
+    /// Longest message a client can send
+    static constexpr std::size_t MAX_MESSAGE_SIZE { 256 };
+
+    RpT::Utils::LoggingContext logging_context;
+    UnsafeBeastWebsocketBackend backend;
+    RpT::Core::ServiceContext tokens_provider;
+    RpT::Core::Timer countdown;
+
+    /// Every timeout is much shorter than countdown, and login timeout doesn't coincide with first ping, with a small
+    /// messages length limit
+    static BeastWebsocketBackendOptions shortTimeouts() {
+        BeastWebsocketBackendOptions options;
+        options.websocketHandshakeTimeout = std::chrono::milliseconds { 50 };
+        options.loginTimeout = std::chrono::milliseconds { 50 };
+        options.idleTimeout = std::chrono::milliseconds { IDLE_TIMEOUT_MS };
+        options.maxMessageSize = MAX_MESSAGE_SIZE;
+
+        return options;
+    }
+
+    BeastWebsocketBackendFixture()
+    : backend { { boost::asio::ip::address_v4::loopback(), 0 }, logging_context, shortTimeouts() },
+    countdown { tokens_provider, COUNTDOWN_MS } {
+        logging_context.disable();
+    }
+
+    /// Retrieves endpoint a client must connect to
+    boost::asio::ip::tcp::endpoint serverEndpoint() const {
+        return { boost::asio::ip::address_v4::loopback(), backend.localPort() };
+    }
+
+    /// Begins countdown so next input event will be at most a timer event
+    void beginCountdown() {
+        countdown.requestCountdown();
+        backend.beginTimer(countdown);
+    }
+
+    /// Connects given client stream to backend then does Websocket handshake
+    void connectWebsocket(ClientStream& client_stream) const {
+        client_stream.next_layer().connect(serverEndpoint());
+        client_stream.handshake("localhost", "/");
+    }
+};
+
+
+}
+
+
+BOOST_FIXTURE_TEST_SUITE(BeastWebsocketBackendTests, BeastWebsocketBackendFixture)
+
+
+BOOST_AUTO_TEST_CASE(SilentTcpConnectionClosed) {
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client_socket { client_context };
+    client_socket.connect(serverEndpoint());
+
+    // Handshake timeout elapses while waiting for countdown, without any HTTP upgrade request sent
+    beginCountdown();
+    BOOST_CHECK(isEventType<RpT::Core::TimerEvent>(backend.waitForInput()));
+
+    backend.close();
+
+    char unexpected_byte;
+    boost::system::error_code err;
+    boost::asio::read(client_socket, boost::asio::buffer(&unexpected_byte, 1), err);
+
+    BOOST_CHECK(err == boost::asio::error::eof || err == boost::asio::error::connection_reset);
+}
+
+BOOST_AUTO_TEST_CASE(UnregisteredClientClosed) {
+    boost::asio::io_context client_context;
+    ClientStream client_stream { client_context };
+
+    boost::system::error_code read_err;
+    // Client is blocking on its stream, so it must run on its own thread while backend is handling operations
+    std::thread client_thread { [this, &client_stream, &read_err]() {
+        connectWebsocket(client_stream);
+
+        // Client never logs in, so it reads until server closes connection
+        boost::beast::flat_buffer read_buffer;
+        while (!read_err) {
+            client_stream.read(read_buffer, read_err);
+            read_buffer.clear();
+        }
+    } };
+
+    // Login timeout elapses while waiting for countdown
+    beginCountdown();
+    BOOST_CHECK(isEventType<RpT::Core::TimerEvent>(backend.waitForInput()));
+
+    client_thread.join(); // Must have been closed by login timeout, not by backend closure
+    backend.close();
+
+    BOOST_CHECK(read_err == boost::beast::websocket::error::closed);
+    BOOST_CHECK_EQUAL(client_stream.reason().reason, "Login timeout");
+}
+
+BOOST_AUTO_TEST_CASE(PingedClientKept) {
+    boost::asio::io_context client_context;
+    ClientStream client_stream { client_context };
+
+    // Pinged more times than countdown would have allowed if pongs weren't sent, then client stops reading
+    constexpr std::size_t PINGS_COUNT { 2 * COUNTDOWN_MS / (IDLE_TIMEOUT_MS / 2) };
+
+    std::thread client_thread { [this, &client_stream]() {
+        connectWebsocket(client_stream);
+        client_stream.write(boost::asio::buffer(std::string { "LOGIN 42 Alvis" }));
+
+        std::size_t received_pings { 0 };
+        client_stream.control_callback([&client_stream, &received_pings](
+                const boost::beast::websocket::frame_type frame, const boost::beast::string_view) {
+
+            // Server is waiting for pong before idle timeout elapses, blocking read stops without sending anything
+            if (frame == boost::beast::websocket::frame_type::ping && ++received_pings == PINGS_COUNT)
+                client_stream.next_layer().shutdown(boost::asio::ip::tcp::socket::shutdown_receive);
+        });
+
+        // Reading replies to server pings, so client isn't idle
+        boost::beast::flat_buffer read_buffer;
+        boost::system::error_code read_err;
+        while (!read_err) {
+            client_stream.read(read_buffer, read_err);
+            read_buffer.clear();
+        }
+    } };
+
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(backend.waitForInput()));
+
+    // Many idle timeouts elapse while waiting for countdown, client must not have left
+    beginCountdown();
+    BOOST_CHECK(isEventType<RpT::Core::TimerEvent>(backend.waitForInput()));
+
+    // Once client stops reading, it no longer answers pings
+    BOOST_CHECK(isEventType<RpT::Core::LeftEvent>(backend.waitForInput()));
+
+    client_thread.join();
+    backend.close();
+}
+
+BOOST_AUTO_TEST_CASE(UnresponsiveClientKilled) {
+    boost::asio::io_context client_context;
+    ClientStream client_stream { client_context };
+
+    // Client logs in then never reads anything, so server pings aren't answered
+    std::thread client_thread { [this, &client_stream]() {
+        connectWebsocket(client_stream);
+        client_stream.write(boost::asio::buffer(std::string { "LOGIN 42 Alvis" }));
+    } };
+
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(backend.waitForInput()));
+    client_thread.join();
+
+    beginCountdown();
+    const RpT::Core::AnyInputEvent left_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::LeftEvent>(left_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::LeftEvent>(left_event).actor(), 42);
+    BOOST_CHECK(!std::get<RpT::Core::LeftEvent>(left_event).disconnectionReason()); // Closed for idle timeout error
+
+    backend.close();
+}
+
+BOOST_AUTO_TEST_CASE(OversizeMessageKillsClient) {
+    boost::asio::io_context client_context;
+    ClientStream client_stream { client_context };
+
+    boost::system::error_code read_err;
+    // Client logs in, then sends a message longer than limit and reads until server closes connection
+    std::thread client_thread { [this, &client_stream, &read_err]() {
+        connectWebsocket(client_stream);
+        client_stream.write(boost::asio::buffer(std::string { "LOGIN 42 Alvis" }));
+        client_stream.write(boost::asio::buffer(std::string(MAX_MESSAGE_SIZE + 1, 'A')));
+
+        boost::beast::flat_buffer read_buffer;
+        while (!read_err) {
+            client_stream.read(read_buffer, read_err);
+            read_buffer.clear();
+        }
+    } };
+
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(backend.waitForInput()));
+
+    const RpT::Core::AnyInputEvent left_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::LeftEvent>(left_event));
+    const RpT::Utils::HandlingResult& reason { std::get<RpT::Core::LeftEvent>(left_event).disconnectionReason() };
+    BOOST_CHECK(!reason);
+    BOOST_CHECK_EQUAL(reason.errorMessage(), "Message longer than 256 bytes");
+
+    client_thread.join();
+    backend.close();
+
+    // Closed by Beast with Websocket status for messages too big, before payload has been buffered
+    BOOST_CHECK(read_err == boost::beast::websocket::error::closed);
+    BOOST_CHECK_EQUAL(client_stream.reason().code, boost::beast::websocket::close_code::too_big);
+}
+
+BOOST_AUTO_TEST_CASE(ResumedClientKeptAfterLoginTimeout) {
+    backend.resumeSessions(std::chrono::seconds { 10 });
+
+    boost::asio::io_context client_context;
+    ClientStream previous_stream { client_context };
+    ClientStream resumed_stream { client_context };
+
+    // Pinged for as long as countdown, much longer than login timeout, then client stops reading
+    constexpr std::size_t PINGS_COUNT { COUNTDOWN_MS / (IDLE_TIMEOUT_MS / 2) };
+    std::size_t received_pings { 0 };
+
+    // Previous connection enables session then reads its secret, so a new connection can resume it once it is lost
+    std::thread client_thread { [this, &previous_stream, &resumed_stream, &received_pings]() {
+        connectWebsocket(previous_stream);
+        previous_stream.write(boost::asio::buffer(std::string { "LOGIN 42 Alvis" }));
+        previous_stream.write(boost::asio::buffer(std::string { "SESSION" }));
+
+        constexpr std::string_view SESSION_PREFIX { "SESSION " };
+        boost::beast::flat_buffer read_buffer;
+        std::string message;
+        while (message.rfind(SESSION_PREFIX, 0) != 0) {
+            read_buffer.clear();
+            previous_stream.read(read_buffer);
+            message = boost::beast::buffers_to_string(read_buffer.data());
+        }
+
+        previous_stream.next_layer().close(); // Connection lost without any close frame, like after a network switch
+
+        connectWebsocket(resumed_stream);
+        resumed_stream.write(boost::asio::buffer("RESUME 42 " + message.substr(SESSION_PREFIX.size())));
+
+        resumed_stream.control_callback([&resumed_stream, &received_pings](
+                const boost::beast::websocket::frame_type frame, const boost::beast::string_view) {
+
+            // Server is waiting for pong before idle timeout elapses, blocking read stops without sending anything
+            if (frame == boost::beast::websocket::frame_type::ping && ++received_pings == PINGS_COUNT)
+                resumed_stream.next_layer().shutdown(boost::asio::ip::tcp::socket::shutdown_receive);
+        });
+
+        // Reading replies to server pings, so client isn't idle
+        boost::system::error_code read_err;
+        while (!read_err) {
+            read_buffer.clear();
+            resumed_stream.read(read_buffer, read_err);
+        }
+    } };
+
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(backend.waitForInput()));
+    BOOST_REQUIRE(isEventType<RpT::Core::NoneEvent>(backend.waitForInput())); // Session enabled
+    BOOST_REQUIRE(isEventType<RpT::Core::NoneEvent>(backend.waitForInput())); // Session resumed
+
+    // Login timeout elapses while waiting for countdown, resumed actor must not have left
+    beginCountdown();
+    BOOST_CHECK(isEventType<RpT::Core::TimerEvent>(backend.waitForInput()));
+
+    // Pings are sent while waiting for input, so another countdown lets client receive the remaining ones
+    countdown.clear();
+    beginCountdown();
+    BOOST_CHECK(isEventType<RpT::Core::TimerEvent>(backend.waitForInput()));
+
+    client_thread.join(); // Stops reading once pinged enough, a killed client would have been closed before
+    backend.close();
+
+    BOOST_CHECK_EQUAL(received_pings, PINGS_COUNT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
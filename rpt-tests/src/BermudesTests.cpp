@@ -76,6 +76,11 @@ BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(Flip)
 
 
+BOOST_AUTO_TEST_CASE(NoFlippedSquare) {
+    // Destination is a free direct neighbour, so there isn't any square to flip
+    BOOST_CHECK_THROW(game.play({ 7, 1 }, { 6, 1 }), BadCoordinates);
+}
+
 BOOST_AUTO_TEST_CASE(FlippedSquareIsEmpty) {
     BOOST_CHECK_THROW(game.play({ 7, 9 }, { 4, 6 }), BadSquareState);
 }
@@ -118,4 +123,9 @@ BOOST_AUTO_TEST_CASE(TajectoryFreeAndFlippedSquareKeptByOpponent) {
 BOOST_AUTO_TEST_SUITE_END()
 
 
+BOOST_AUTO_TEST_CASE(LegalMovesMatchPlay) {
+    checkLegalMovesMatchPlay<Bermudes>();
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
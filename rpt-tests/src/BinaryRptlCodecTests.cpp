@@ -0,0 +1,133 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Network/BinaryRptlCodec.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Builds binary message from given bytes
+std::string bytes(const std::initializer_list<std::uint8_t> message_bytes) {
+    std::string message;
+
+    for (const std::uint8_t byte : message_bytes)
+        message.push_back(static_cast<char>(byte));
+
+    return message;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(BinaryRptlCodecTests)
+
+
+BOOST_AUTO_TEST_SUITE(Varint)
+
+BOOST_AUTO_TEST_CASE(SingleByte) {
+    std::string output;
+    BinaryRptlCodec::appendVarint(output, 127);
+
+    BOOST_CHECK_EQUAL(output, bytes({ 0x7F }));
+}
+
+BOOST_AUTO_TEST_CASE(ManyBytes) {
+    std::string output;
+    BinaryRptlCodec::appendVarint(output, 300);
+
+    BOOST_CHECK_EQUAL(output, bytes({ 0xAC, 0x02 }));
+
+    std::size_t position { 0 };
+    BOOST_CHECK_EQUAL(BinaryRptlCodec::readVarint(output, position), 300);
+    BOOST_CHECK_EQUAL(position, 2);
+}
+
+BOOST_AUTO_TEST_CASE(MaxValue) {
+    std::string output;
+    BinaryRptlCodec::appendVarint(output, std::numeric_limits<std::uint64_t>::max());
+
+    std::size_t position { 0 };
+    BOOST_CHECK_EQUAL(BinaryRptlCodec::readVarint(output, position), std::numeric_limits<std::uint64_t>::max());
+}
+
+BOOST_AUTO_TEST_CASE(Truncated) {
+    std::size_t position { 0 };
+
+    BOOST_CHECK_THROW(BinaryRptlCodec::readVarint(bytes({ 0x80 }), position), BadBinaryMessage);
+}
+
+BOOST_AUTO_TEST_CASE(Overflow) {
+    std::size_t position { 0 };
+    const std::string too_long { bytes({ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02 }) };
+
+    BOOST_CHECK_THROW(BinaryRptlCodec::readVarint(too_long, position), BadBinaryMessage);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(Encode)
+
+BOOST_AUTO_TEST_CASE(KeywordsAndNumbers) {
+    // SERVICE and EVENT keywords, then Chat string, MESSAGE_FROM string, small number 1 and large number 1000
+    const std::string expected {
+        bytes({ 0x80, 0x8B, 0x00, 4 }) + "Chat" + bytes({ 0x00, 12 }) + "MESSAGE_FROM"
+        + bytes({ 0x41, 0x01, 0xE8, 0x07 })
+    };
+
+    BOOST_CHECK_EQUAL(BinaryRptlCodec::encode("SERVICE EVENT Chat MESSAGE_FROM 1 1000"), expected);
+}
+
+BOOST_AUTO_TEST_CASE(NonCanonicalNumbers) {
+    // Leading zero, sign and too large numbers would not be decoded as is, so they are strings
+    const std::string expected {
+        bytes({ 0x00, 2 }) + "01" + bytes({ 0x00, 2 }) + "+1" + bytes({ 0x00, 20 }) + "99999999999999999999"
+    };
+
+    BOOST_CHECK_EQUAL(BinaryRptlCodec::encode("01 +1 99999999999999999999"), expected);
+}
+
+BOOST_AUTO_TEST_CASE(ConsecutiveSpaces) {
+    BOOST_CHECK_EQUAL(BinaryRptlCodec::encode("OK  KO"), bytes({ 0x8C, 0x00, 0x00, 0x8D }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(Decode)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    BOOST_CHECK_EQUAL(BinaryRptlCodec::decode(""), "");
+}
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+    const std::vector<std::string> text_messages {
+        "", " ", "LOGIN 42 Alvis", "SERVICE REQUEST 7 Chat Hello  world !", "LOGGED_OUT 18446744073709551615",
+        "SERVICE EVENT Minigame SQUARE_STATE 5 3 1 0 007"
+    };
+
+    for (const std::string& text_message : text_messages)
+        BOOST_CHECK_EQUAL(BinaryRptlCodec::decode(BinaryRptlCodec::encode(text_message)), text_message);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownKeyword) {
+    BOOST_CHECK_THROW(BinaryRptlCodec::decode(bytes({ 0xFF })), BadBinaryMessage);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownTag) {
+    BOOST_CHECK_THROW(BinaryRptlCodec::decode(bytes({ 0x02 })), BadBinaryMessage);
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedWord) {
+    BOOST_CHECK_THROW(BinaryRptlCodec::decode(bytes({ 0x00, 5 }) + "abc"), BadBinaryMessage);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+#include <RpT-Testing/TestingUtils.hpp>
+#include <RpT-Testing/MinigamesServicesTestingUtils.hpp>
+
+#include <Minigames-Services/Bitboard.hpp>
+
+
+using namespace MinigamesServices;
+
+
+/// Provides a bitboard for a 3x4 grid with a few pawns
+class BitboardFixture {
+public:
+    Grid grid;
+    Bitboard bitboard;
+
+    BitboardFixture() : grid {
+        { WHITE, EMPTY, EMPTY, BLACK },
+        { EMPTY, WHITE, EMPTY, EMPTY },
+        { BLACK, EMPTY, EMPTY, WHITE }
+    }, bitboard { grid } {}
+
+    /// Retrieves mask containing every given square
+    Bitboard::Mask squares(const std::initializer_list<Coordinates> coords) const {
+        Bitboard::Mask mask;
+        for (const Coordinates& square : coords)
+            mask |= bitboard.maskOf(square);
+
+        return mask;
+    }
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(BitboardTests, BitboardFixture)
+
+
+BOOST_AUTO_TEST_CASE(TooLargeGrid) {
+    // 12 lines of 10 columns, with guard columns it requires 132 bits
+    const std::initializer_list<Square> line { EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY };
+    const Grid large_grid { line, line, line, line, line, line, line, line, line, line, line, line };
+
+    BOOST_CHECK_THROW(Bitboard { large_grid }, BadDimensions);
+}
+
+BOOST_AUTO_TEST_CASE(CopiedFromGrid) {
+    for (int line { 1 }; line <= 3; line++) {
+        for (int column { 1 }; column <= 4; column++)
+            BOOST_CHECK_EQUAL(bitboard.at({ line, column }), (grid[{ line, column }]));
+    }
+
+    BOOST_CHECK_EQUAL(bitboard.pawnsOf(WHITE), squares({ { 1, 1 }, { 2, 2 }, { 3, 4 } }));
+    BOOST_CHECK_EQUAL(bitboard.pawnsOf(BLACK), squares({ { 1, 4 }, { 3, 1 } }));
+    BOOST_CHECK_EQUAL(bitboard.freeSquares().count(), 7);
+    BOOST_CHECK_THROW(bitboard.pawnsOf(EMPTY), BadSquareState);
+}
+
+BOOST_AUTO_TEST_CASE(Set) {
+    bitboard.set({ 1, 1 }, EMPTY);
+    bitboard.set({ 2, 3 }, BLACK);
+    bitboard.set({ 1, 4 }, WHITE);
+
+    BOOST_CHECK_EQUAL(bitboard.pawnsOf(WHITE), squares({ { 1, 4 }, { 2, 2 }, { 3, 4 } }));
+    BOOST_CHECK_EQUAL(bitboard.pawnsOf(BLACK), squares({ { 2, 3 }, { 3, 1 } }));
+    BOOST_CHECK_EQUAL(bitboard.at({ 1, 1 }), EMPTY);
+}
+
+BOOST_AUTO_TEST_CASE(ShiftedInsideGrid) {
+    const Bitboard::Mask middle { squares({ { 2, 2 } }) };
+
+    BOOST_CHECK_EQUAL(bitboard.shifted(middle, AxisType::Up), squares({ { 1, 2 } }));
+    BOOST_CHECK_EQUAL(bitboard.shifted(middle, AxisType::Down), squares({ { 3, 2 } }));
+    BOOST_CHECK_EQUAL(bitboard.shifted(middle, AxisType::Left), squares({ { 2, 1 } }));
+    BOOST_CHECK_EQUAL(bitboard.shifted(middle, AxisType::Right), squares({ { 2, 3 } }));
+    BOOST_CHECK_EQUAL(bitboard.shifted(middle, AxisType::UpLeft), squares({ { 1, 1 } }));
+    BOOST_CHECK_EQUAL(bitboard.shifted(middle, AxisType::DownRight), squares({ { 3, 3 } }));
+}
+
+BOOST_AUTO_TEST_CASE(ShiftedOutsideGrid) {
+    // Squares at grid borders must not appear at the opposite border of another line
+    const Bitboard::Mask right_border { squares({ { 1, 4 }, { 2, 4 }, { 3, 4 } }) };
+    const Bitboard::Mask left_border { squares({ { 1, 1 }, { 2, 1 }, { 3, 1 } }) };
+
+    BOOST_CHECK(bitboard.shifted(right_border, AxisType::Right).none());
+    BOOST_CHECK(bitboard.shifted(right_border, AxisType::DownRight).none());
+    BOOST_CHECK(bitboard.shifted(left_border, AxisType::Left).none());
+    BOOST_CHECK(bitboard.shifted(left_border, AxisType::UpLeft).none());
+    BOOST_CHECK(bitboard.shifted(squares({ { 1, 2 } }), AxisType::Up).none());
+    BOOST_CHECK(bitboard.shifted(squares({ { 3, 2 } }), AxisType::Down).none());
+}
+
+BOOST_AUTO_TEST_CASE(Between) {
+    BOOST_CHECK(bitboard.between({ 1, 1 }, { 1, 2 }).none());
+    BOOST_CHECK_EQUAL(bitboard.between({ 1, 1 }, { 1, 4 }), squares({ { 1, 2 }, { 1, 3 } }));
+    BOOST_CHECK_EQUAL(bitboard.between({ 3, 4 }, { 1, 4 }), squares({ { 2, 4 } }));
+    BOOST_CHECK_EQUAL(bitboard.between({ 3, 3 }, { 1, 1 }), squares({ { 2, 2 } }));
+    BOOST_CHECK_EQUAL(bitboard.between({ 1, 4 }, { 3, 2 }), squares({ { 2, 3 } }));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
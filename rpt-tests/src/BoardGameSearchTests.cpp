@@ -0,0 +1,144 @@
+#include <RpT-Testing/TestingUtils.hpp>
+#include <RpT-Testing/MinigamesServicesTestingUtils.hpp>
+
+#include <atomic>
+#include <Minigames-Services/Acores.hpp>
+#include <Minigames-Services/BoardGameSearch.hpp>
+
+
+using namespace MinigamesServices;
+
+
+/// Pawns move 1 square orthogonally to a free square or onto an opponent pawn, which is then eaten. Player without
+/// any pawn left looses.
+class CaptureGame : public BoardGame {
+public:
+    /// Constructs game with given grid and pawns counts
+    CaptureGame(std::initializer_list<std::initializer_list<Square>> initial_grid, const unsigned int white_pawns,
+                const unsigned int black_pawns) : BoardGame { initial_grid, white_pawns, black_pawns, 1 } {}
+
+    std::unique_ptr<BoardGame> clone() const override {
+        return std::make_unique<CaptureGame>(*this);
+    }
+
+    /// One move by round
+    bool isRoundTerminated() const override {
+        return hasMoved();
+    }
+
+    bool isLegal(const PawnMove& move) const override {
+        return moveRange(move, false) == 1 && game_bitboard_.at(move.from) == colorFor(currentRound())
+               && game_bitboard_.at(move.to) != colorFor(currentRound());
+    }
+
+    std::vector<PawnMove> legalMoves() const override {
+        return enumerateLegalMoves<CaptureGame, 1, false>();
+    }
+
+    GridUpdate play(const Coordinates& from, const Coordinates& to) override {
+        if (!isLegal({ from, to }))
+            throw BadCoordinates { "Illegal move" };
+
+        if (game_bitboard_.at(to) != Square::Free) { // Opponent pawn is eaten
+            if (currentRound() == Player::White)
+                black_pawns_--;
+            else
+                white_pawns_--;
+        }
+
+        game_grid_[to] = game_grid_[from];
+        game_grid_[from] = EMPTY;
+
+        const GridUpdate updates { {}, from, to };
+        syncBitboard(updates);
+        moved();
+
+        return updates;
+    }
+};
+
+
+BOOST_AUTO_TEST_SUITE(BoardGameSearchTests)
+
+
+/// Enough for every search of these tests to complete a few depths
+constexpr std::chrono::milliseconds SEARCH_BUDGET { 50 };
+
+
+BOOST_AUTO_TEST_CASE(NoActionAvailable) {
+    const CaptureGame game { { { WHITE, WHITE } }, 2, 1 };
+    BoardGameSearch search;
+
+    BOOST_CHECK_THROW(search.bestAction(game, SEARCH_BUDGET), MinigamesServices::NoActionAvailable);
+}
+
+BOOST_AUTO_TEST_CASE(OnlyAction) {
+    const CaptureGame game { { { WHITE, EMPTY } }, 1, 1 };
+    BoardGameSearch search;
+
+    // Nothing to search, only the root was visited
+    const BoardGameSearch::Action action { search.bestAction(game, SEARCH_BUDGET) };
+    BOOST_CHECK(action == PawnMove({ { 1, 1 }, { 1, 2 } }));
+    BOOST_CHECK_EQUAL(search.visitedNodes(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ImmediateVictory) {
+    const CaptureGame game {
+        {
+            { WHITE, BLACK, EMPTY },
+            { WHITE, EMPTY, EMPTY }
+        }, 2, 1
+    };
+    BoardGameSearch search;
+
+    // Eating last black pawn wins game
+    const BoardGameSearch::Action action { search.bestAction(game, SEARCH_BUDGET) };
+    BOOST_CHECK(action == PawnMove({ { 1, 1 }, { 1, 2 } }));
+    BOOST_CHECK_EQUAL(search.completedDepth(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(AvoidsDefeat) {
+    const CaptureGame game {
+        {
+            { WHITE, EMPTY, BLACK },
+            { EMPTY, EMPTY, EMPTY },
+            { EMPTY, EMPTY, EMPTY }
+        }, 1, 1
+    };
+    BoardGameSearch search;
+
+    // Moving right would let black pawn eat last white pawn
+    const BoardGameSearch::Action action { search.bestAction(game, SEARCH_BUDGET) };
+    BOOST_CHECK(action == PawnMove({ { 1, 1 }, { 2, 1 } }));
+    BOOST_CHECK_GE(search.completedDepth(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GameNotModified) {
+    const Acores game;
+    const std::uint64_t initial_position { game.positionHash() };
+    BoardGameSearch search;
+
+    const BoardGameSearch::Action action { search.bestAction(game, SEARCH_BUDGET) };
+
+    BOOST_CHECK_EQUAL(game.positionHash(), initial_position);
+    BOOST_CHECK(!game.hasMoved());
+    // Beginning of round, so it must be a move
+    BOOST_REQUIRE(action.has_value());
+    BOOST_CHECK(game.isLegal(*action));
+}
+
+BOOST_AUTO_TEST_CASE(Cancelled) {
+    const Acores game;
+    const std::atomic_bool cancelled { true };
+    BoardGameSearch search;
+
+    // Search stops at first check even with a large budget, then first action is retrieved
+    const BoardGameSearch::Action action { search.bestAction(game, std::chrono::minutes { 1 }, &cancelled) };
+
+    BOOST_CHECK_EQUAL(search.completedDepth(), 0);
+    BOOST_REQUIRE(action.has_value());
+    BOOST_CHECK(*action == game.legalMoves().front());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
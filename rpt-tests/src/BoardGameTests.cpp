@@ -27,6 +27,15 @@ public:
         moved();
     }
 
+    /// Moves pawn inside grid and bitboard from given square to given free square, then calls `moved()`
+    void movePawn(const Coordinates& from, const Coordinates& to) {
+        game_grid_[to] = game_grid_[from];
+        game_grid_[from] = EMPTY;
+
+        syncBitboard({ {}, from, to });
+        moved();
+    }
+
     /// Mocks a specific number of pawns inside grid for white player
     void whitePawns(const unsigned int white_pawns) {
         white_pawns_ = white_pawns;
@@ -43,6 +52,23 @@ public:
 
     bool isRoundTerminated() const override { return false; }
     GridUpdate play(const Coordinates&, const Coordinates&) override { return {}; }
+
+    std::unique_ptr<BoardGame> clone() const override { return std::make_unique<SampleBoardGame>(*this); }
+
+    /// Any move of 1 square toward a free square, so moves enumeration can be tested
+    bool isLegal(const PawnMove& move) const override {
+        return moveRange(move, true) == 1 && game_grid_[move.to] == EMPTY;
+    }
+
+    /// Enumerates moves of 1 square
+    std::vector<PawnMove> legalMoves() const override {
+        return enumerateLegalMoves<SampleBoardGame, 1, true>();
+    }
+
+    /// Accessible protected method `moveRange()`
+    std::optional<int> range(const PawnMove& move, const bool diagonals_allowed) const {
+        return moveRange(move, diagonals_allowed);
+    }
 };
 
 
@@ -238,4 +264,162 @@ BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
 
+/*
+ * moveRange() protected method unit tests
+ */
+BOOST_AUTO_TEST_SUITE(MoveRange)
+
+
+BOOST_AUTO_TEST_CASE(OutsideGrid) {
+    const SampleBoardGame game { { { EMPTY, EMPTY }, { EMPTY, EMPTY } } };
+
+    BOOST_CHECK(!game.range({ { 1, 1 }, { 1, 3 } }, true).has_value());
+    BOOST_CHECK(!game.range({ { 0, 1 }, { 1, 1 } }, true).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(NoAxis) {
+    const SampleBoardGame game { { { EMPTY, EMPTY, EMPTY }, { EMPTY, EMPTY, EMPTY } } };
+
+    BOOST_CHECK(!game.range({ { 1, 1 }, { 1, 1 } }, true).has_value());
+    BOOST_CHECK(!game.range({ { 1, 1 }, { 2, 3 } }, true).has_value());
+    BOOST_CHECK(!game.range({ { 1, 1 }, { 2, 2 } }, false).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(Axis) {
+    const SampleBoardGame game { { { EMPTY, EMPTY, EMPTY }, { EMPTY, EMPTY, EMPTY } } };
+
+    BOOST_CHECK_EQUAL(game.range({ { 1, 1 }, { 1, 3 } }, false).value(), 2);
+    BOOST_CHECK_EQUAL(game.range({ { 2, 3 }, { 1, 3 } }, false).value(), 1);
+    BOOST_CHECK_EQUAL(game.range({ { 2, 3 }, { 1, 2 } }, true).value(), 1);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/*
+ * legalMoves() enumeration unit tests
+ */
+BOOST_AUTO_TEST_SUITE(LegalMoves)
+
+
+BOOST_AUTO_TEST_CASE(CurrentPlayerPawnsOnly) {
+    const SampleBoardGame game { {
+        { EMPTY, BLACK, EMPTY },
+        { EMPTY, WHITE, BLACK },
+        { EMPTY, EMPTY, EMPTY }
+    } };
+
+    // Every free neighbour of the only white pawn
+    const std::vector<PawnMove> expected_moves {
+        { { 2, 2 }, { 1, 1 } }, { { 2, 2 }, { 1, 3 } }, { { 2, 2 }, { 2, 1 } },
+        { { 2, 2 }, { 3, 1 } }, { { 2, 2 }, { 3, 2 } }, { { 2, 2 }, { 3, 3 } }
+    };
+
+    const std::vector<PawnMove> legal_moves { game.legalMoves() };
+
+    BOOST_CHECK_EQUAL(legal_moves.size(), expected_moves.size());
+    for (const PawnMove& expected_move : expected_moves)
+        BOOST_CHECK(std::find(legal_moves.begin(), legal_moves.end(), expected_move) != legal_moves.end());
+
+    BOOST_CHECK(game.hasLegalMove());
+}
+
+BOOST_AUTO_TEST_CASE(Blocked) {
+    const SampleBoardGame game { { { WHITE, BLACK }, { BLACK, BLACK } } };
+
+    BOOST_CHECK(game.legalMoves().empty());
+    BOOST_CHECK(!game.hasLegalMove());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/*
+ * positionHash() and positionOccurrences() unit tests
+ */
+BOOST_AUTO_TEST_SUITE(PositionHash)
+
+
+BOOST_AUTO_TEST_CASE(SameInitialGrid) {
+    const SampleBoardGame game { { { WHITE, EMPTY }, { EMPTY, BLACK } } };
+    const SampleBoardGame same_game { { { WHITE, EMPTY }, { EMPTY, BLACK } } };
+    const SampleBoardGame other_game { { { EMPTY, WHITE }, { EMPTY, BLACK } } };
+
+    BOOST_CHECK_EQUAL(game.positionHash(), same_game.positionHash());
+    BOOST_CHECK_NE(game.positionHash(), other_game.positionHash());
+    BOOST_CHECK_EQUAL(game.positionOccurrences(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(UpdatedByMove) {
+    SampleBoardGame game { { { WHITE, EMPTY }, { EMPTY, BLACK } } };
+    const SampleBoardGame moved_game { { { EMPTY, WHITE }, { EMPTY, BLACK } } };
+    const std::uint64_t initial_hash { game.positionHash() };
+
+    game.movePawn({ 1, 1 }, { 1, 2 });
+
+    // Same squares as a new game with moved pawn, still white player round
+    BOOST_CHECK_EQUAL(game.positionHash(), moved_game.positionHash());
+
+    game.movePawn({ 1, 2 }, { 1, 1 });
+
+    BOOST_CHECK_EQUAL(game.positionHash(), initial_hash);
+}
+
+BOOST_AUTO_TEST_CASE(UpdatedByRound) {
+    SampleBoardGame game { { { WHITE, EMPTY }, { EMPTY, BLACK } } };
+    const std::uint64_t initial_hash { game.positionHash() };
+
+    game.makeMove();
+    game.nextRound();
+
+    // Same squares, but another player round
+    BOOST_CHECK_NE(game.positionHash(), initial_hash);
+
+    game.makeMove();
+    game.nextRound();
+
+    BOOST_CHECK_EQUAL(game.positionHash(), initial_hash);
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedPosition) {
+    SampleBoardGame game { { { WHITE, EMPTY }, { EMPTY, BLACK } } };
+
+    // Each player moves its pawn forth then back, so initial position occurs again
+    game.movePawn({ 1, 1 }, { 1, 2 });
+    game.nextRound();
+    game.movePawn({ 2, 2 }, { 2, 1 });
+    game.nextRound();
+    BOOST_CHECK_EQUAL(game.positionOccurrences(), 1);
+
+    game.movePawn({ 1, 2 }, { 1, 1 });
+    game.nextRound();
+    game.movePawn({ 2, 1 }, { 2, 2 });
+    game.nextRound();
+    BOOST_CHECK_EQUAL(game.positionOccurrences(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(CachedLegalMove) {
+    SampleBoardGame game { { { EMPTY, WHITE, BLACK } } };
+
+    BOOST_CHECK(game.hasLegalMove());
+
+    game.movePawn({ 1, 2 }, { 1, 1 });
+    game.nextRound();
+
+    // Black player position isn't the cached white player one
+    BOOST_CHECK(game.hasLegalMove());
+
+    game.movePawn({ 1, 3 }, { 1, 2 });
+    game.nextRound();
+
+    // White pawn is now blocked
+    BOOST_CHECK(!game.hasLegalMove());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
 BOOST_AUTO_TEST_SUITE_END()
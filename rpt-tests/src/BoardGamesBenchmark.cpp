@@ -0,0 +1,205 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <Minigames-Services/Acores.hpp>
+#include <Minigames-Services/Bermudes.hpp>
+#include <Minigames-Services/Canaries.hpp>
+
+/*
+ * Measures rules engines throughput: Grid squares access, AxisIterator walks, random legal games played with each
+ * play() implementation and perft enumeration of every moves sequence up to a given depth. Perft depth can be given as
+ * first argument, default is 3. Not registered as a test, run it manually from a Release build.
+ *
+ * Rounds are always terminated after one move, so chaining moves aren't enumerated by perft.
+ */
+
+
+using namespace MinigamesServices;
+
+
+namespace {
+
+
+/// Reports given number of processed nodes for given elapsed time since begin
+void report(const std::string& name, const std::size_t nodes,
+            const std::chrono::steady_clock::time_point begin) {
+
+    const std::chrono::duration<double> elapsed { std::chrono::steady_clock::now() - begin };
+
+    std::cout << name << ": " << nodes << " nodes in " << elapsed.count() << " s, "
+              << static_cast<double>(nodes) / elapsed.count() << " nodes/s" << std::endl;
+}
+
+/// Reads every square of Bermudes grid many times, with checked and unchecked accessors
+void benchmarkGrid(std::size_t& checksum) {
+    const Bermudes game;
+    const Grid& grid { game.grid() };
+
+    constexpr std::size_t ROUNDS { 1000000 };
+
+    for (const bool checked : { true, false }) {
+        const auto begin { std::chrono::steady_clock::now() };
+        std::size_t nodes { 0 };
+
+        for (std::size_t round { 0 }; round < ROUNDS; round++) {
+            for (int line { 1 }; line <= grid.linesCount(); line++) {
+                for (int column { 1 }; column <= grid.columnsCount(); column++) {
+                    const Coordinates square { line, column };
+
+                    // Depends on squares state so it isn't optimized out
+                    checksum += static_cast<std::size_t>(checked ? grid[square] : grid.unchecked(square));
+                    nodes++;
+                }
+            }
+        }
+
+        report(checked ? "Grid::operator[]" : "Grid::unchecked()", nodes, begin);
+    }
+}
+
+/// Walks every axis from each square of Bermudes grid to grid border
+void benchmarkAxisIterator(std::size_t& checksum) {
+    const Bermudes game;
+    const Grid& grid { game.grid() };
+
+    constexpr std::size_t ROUNDS { 10000 };
+
+    const auto begin { std::chrono::steady_clock::now() };
+    std::size_t nodes { 0 };
+
+    for (std::size_t round { 0 }; round < ROUNDS; round++) {
+        for (int line { 1 }; line <= grid.linesCount(); line++) {
+            for (int column { 1 }; column <= grid.columnsCount(); column++) {
+                // Destination is any neighbour of current square
+                for (int line_offset { -1 }; line_offset <= 1; line_offset++) {
+                    for (int column_offset { -1 }; column_offset <= 1; column_offset++) {
+                        const Coordinates to { line + line_offset, column + column_offset };
+
+                        if ((line_offset == 0 && column_offset == 0) || !grid.isInsideGrid(to))
+                            continue;
+
+                        AxisIterator axis { grid, { line, column }, to };
+                        while (axis.hasNext()) {
+                            checksum += static_cast<std::size_t>(axis.moveForwardImmutable());
+                            nodes++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    report("AxisIterator", nodes, begin);
+}
+
+/// Plays given moves sequence from a new game, terminating round after each move
+template<typename Game>
+void replay(Game& game, const std::vector<PawnMove>& moves) {
+    for (const PawnMove& move : moves) {
+        game.play(move.from, move.to);
+        game.nextRound();
+    }
+}
+
+/// Plays random legal moves until a player wins, a player is blocked or moves count limit is reached
+template<typename Game>
+void benchmarkRandomGames(const std::string& name, std::size_t& checksum) {
+    constexpr std::size_t GAMES { 500 };
+    constexpr std::size_t MAX_MOVES { 200 };
+
+    std::mt19937 generator { 42 }; // Same games for each run
+
+    const auto begin { std::chrono::steady_clock::now() };
+    std::size_t nodes { 0 };
+
+    for (std::size_t game_i { 0 }; game_i < GAMES; game_i++) {
+        Game game;
+
+        for (std::size_t move_i { 0 }; move_i < MAX_MOVES && !game.victoryFor().has_value(); move_i++) {
+            const std::vector<PawnMove> legal_moves { game.legalMoves() };
+            if (legal_moves.empty())
+                break;
+
+            std::uniform_int_distribution<std::size_t> move_distribution { 0, legal_moves.size() - 1 };
+            const PawnMove& move { legal_moves[move_distribution(generator)] };
+
+            checksum += game.play(move.from, move.to).updatedSquares.size();
+            game.nextRound();
+            nodes++;
+        }
+    }
+
+    report(name + " random games", nodes, begin);
+}
+
+/// Counts every moves sequence of given depth following given moves sequence
+template<typename Game>
+std::size_t perft(std::vector<PawnMove>& moves, const unsigned int depth) {
+    Game game;
+    replay(game, moves);
+
+    if (game.victoryFor().has_value())
+        return 0;
+
+    const std::vector<PawnMove> legal_moves { game.legalMoves() };
+    if (depth == 1)
+        return legal_moves.size();
+
+    std::size_t nodes { 0 };
+    for (const PawnMove& move : legal_moves) {
+        moves.push_back(move);
+        nodes += perft<Game>(moves, depth - 1);
+        moves.pop_back();
+    }
+
+    return nodes;
+}
+
+/// Runs perft enumeration for given depth
+template<typename Game>
+void benchmarkPerft(const std::string& name, const unsigned int depth, std::size_t& checksum) {
+    const auto begin { std::chrono::steady_clock::now() };
+
+    std::vector<PawnMove> moves;
+    const std::size_t nodes { perft<Game>(moves, depth) };
+    checksum += nodes;
+
+    report(name + " perft(" + std::to_string(depth) + ")", nodes, begin);
+}
+
+/// Runs every game benchmark for given game
+template<typename Game>
+void benchmarkGame(const std::string& name, const unsigned int perft_depth, std::size_t& checksum) {
+    benchmarkRandomGames<Game>(name, checksum);
+    benchmarkPerft<Game>(name, perft_depth, checksum);
+}
+
+
+}
+
+
+int main(const int argc, const char** argv) {
+    const unsigned int perft_depth { argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 3 };
+
+    if (perft_depth == 0) {
+        std::cerr << "Perft depth must be positive" << std::endl;
+
+        return 1;
+    }
+
+    std::size_t checksum { 0 };
+
+    benchmarkGrid(checksum);
+    benchmarkAxisIterator(checksum);
+    benchmarkGame<Acores>("Acores", perft_depth, checksum);
+    benchmarkGame<Bermudes>("Bermudes", perft_depth, checksum);
+    benchmarkGame<Canaries>("Canaries", perft_depth, checksum);
+
+    std::cout << "Checksum: " << checksum << std::endl;
+
+    return 0;
+}
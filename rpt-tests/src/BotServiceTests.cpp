@@ -0,0 +1,192 @@
+#include <RpT-Testing/TestingUtils.hpp>
+#include <RpT-Testing/MinigamesServicesTestingUtils.hpp>
+#include <RpT-Testing/SerTestingUtils.hpp>
+
+#include <Minigames-Services/Acores.hpp>
+#include <Minigames-Services/BotService.hpp>
+#include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/ServiceEventRequestProtocol.hpp>
+
+
+using namespace MinigamesServices;
+
+
+/// Provides bot with the Lobby and Minigame services it plays with, running Açores
+class BotFixture {
+private:
+    RpT::Core::ServiceContext context_;
+
+public:
+    MinigameService minigame;
+    LobbyService lobby;
+    BotService service;
+
+    BotFixture() : minigame { context_, []() { return std::make_unique<Acores>(); } },
+    lobby { context_, minigame, 42 },
+    service { context_, lobby, minigame, 20 } {}
+
+    /// Takes every task submitted by services
+    std::vector<RpT::Core::ServiceTask> takeTasks() {
+        std::vector<RpT::Core::ServiceTask> submitted_tasks;
+        context_.takeSubmittedTasks(submitted_tasks);
+
+        return submitted_tasks;
+    }
+
+    /// Consumes every event emitted by each service
+    void clearEvents() {
+        for (RpT::Core::Service* svc : std::initializer_list<RpT::Core::Service*> { &minigame, &lobby, &service }) {
+            while (svc->checkEvent().has_value())
+                svc->pollEvent();
+        }
+    }
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(BotServiceTests, BotFixture)
+
+
+/// UID used by actor playing against bot into these tests
+constexpr std::uint64_t HUMAN_ACTOR { 0 };
+
+
+/*
+ * JOIN and LEAVE SR commands unit tests
+ */
+BOOST_AUTO_TEST_SUITE(HandleRequestCommand)
+
+
+BOOST_AUTO_TEST_CASE(UnknownCommand) {
+    BOOST_CHECK_THROW(service.handleRequestCommand(HUMAN_ACTOR, "PLAY"), RpT::Core::BadServiceRequest);
+}
+
+BOOST_AUTO_TEST_CASE(Join) {
+    lobby.assignActor(HUMAN_ACTOR);
+
+    BOOST_CHECK(service.handleRequestCommand(HUMAN_ACTOR, "JOIN"));
+    BOOST_CHECK(service.isSeated());
+
+    // Bot took black seat, and is ready
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent {
+        "JOINED " + std::to_string(BotService::BOT_ACTOR)
+    });
+    BOOST_CHECK(!service.checkEvent().has_value());
+    BOOST_CHECK_EQUAL(lobby.pollEvent(), RpT::Core::ServiceEvent {
+        "READY_PLAYER " + std::to_string(BotService::BOT_ACTOR)
+    });
+    BOOST_CHECK(lobby.isReady(BotService::BOT_ACTOR));
+}
+
+BOOST_AUTO_TEST_CASE(JoinTwice) {
+    service.handleRequestCommand(HUMAN_ACTOR, "JOIN");
+
+    BOOST_CHECK(!service.handleRequestCommand(HUMAN_ACTOR, "JOIN"));
+}
+
+BOOST_AUTO_TEST_CASE(JoinFullLobby) {
+    lobby.assignActor(HUMAN_ACTOR);
+    lobby.assignActor(HUMAN_ACTOR + 1);
+
+    BOOST_CHECK(!service.handleRequestCommand(HUMAN_ACTOR, "JOIN"));
+    BOOST_CHECK(!service.isSeated());
+}
+
+BOOST_AUTO_TEST_CASE(LeaveNotSeated) {
+    BOOST_CHECK(!service.handleRequestCommand(HUMAN_ACTOR, "LEAVE"));
+}
+
+BOOST_AUTO_TEST_CASE(LeaveDuringGame) {
+    lobby.assignActor(HUMAN_ACTOR);
+    service.join();
+    minigame.start(HUMAN_ACTOR, BotService::BOT_ACTOR);
+    clearEvents();
+
+    BOOST_CHECK(service.handleRequestCommand(HUMAN_ACTOR, "LEAVE"));
+    BOOST_CHECK(!service.isSeated());
+
+    // Game would never end without bot, seat is available again
+    BOOST_CHECK(!minigame.isStarted());
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent { "LEFT" });
+    BOOST_CHECK_EQUAL(lobby.assignActor(HUMAN_ACTOR + 1), Player::Black);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/*
+ * play() method unit tests
+ */
+BOOST_AUTO_TEST_SUITE(Play)
+
+
+BOOST_AUTO_TEST_CASE(NotSeated) {
+    minigame.start(BotService::BOT_ACTOR, HUMAN_ACTOR);
+
+    service.play();
+
+    BOOST_CHECK(takeTasks().empty());
+}
+
+BOOST_AUTO_TEST_CASE(GetsReadyAgain) {
+    service.join();
+    lobby.handleRequestCommand(BotService::BOT_ACTOR, "READY"); // Mocks lobby reset at game start
+
+    service.play();
+
+    BOOST_CHECK(lobby.isReady(BotService::BOT_ACTOR));
+}
+
+BOOST_AUTO_TEST_CASE(OpponentRound) {
+    service.join();
+    minigame.start(HUMAN_ACTOR, BotService::BOT_ACTOR);
+
+    service.play();
+
+    BOOST_CHECK(takeTasks().empty());
+}
+
+BOOST_AUTO_TEST_CASE(BotRound) {
+    service.join();
+    minigame.start(BotService::BOT_ACTOR, HUMAN_ACTOR);
+    clearEvents();
+
+    service.play();
+    service.play(); // Search is already pending, nothing more to do
+
+    // Action will be submitted once search task completed
+    std::vector<RpT::Core::ServiceTask> tasks { takeTasks() };
+    BOOST_REQUIRE_EQUAL(tasks.size(), 1);
+    BOOST_CHECK_EQUAL(minigame.currentActor(), BotService::BOT_ACTOR);
+
+    tasks.front().run();
+    tasks.front().complete();
+
+    // Only normal moves at Açores beginning, which terminate round
+    BOOST_CHECK_EQUAL(minigame.currentActor(), HUMAN_ACTOR);
+    BOOST_CHECK_EQUAL(minigame.pollEvent().data().substr(0, 6), "MOVED ");
+}
+
+BOOST_AUTO_TEST_CASE(GameStoppedDuringSearch) {
+    lobby.assignActor(HUMAN_ACTOR);
+    service.join();
+    minigame.start(BotService::BOT_ACTOR, HUMAN_ACTOR);
+
+    service.play();
+    std::vector<RpT::Core::ServiceTask> tasks { takeTasks() };
+    BOOST_REQUIRE_EQUAL(tasks.size(), 1);
+
+    // Search is cancelled, and its action will never be submitted
+    service.leave();
+    tasks.front().run();
+    tasks.front().complete();
+
+    BOOST_CHECK(!minigame.isStarted());
+    BOOST_CHECK(takeTasks().empty());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE_END()
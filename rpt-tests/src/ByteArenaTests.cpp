@@ -0,0 +1,61 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <RpT-Utils/ByteArena.hpp>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(ByteArenaTests)
+
+
+BOOST_AUTO_TEST_CASE(InvalidChunkSize) {
+    BOOST_CHECK_THROW(ByteArena { 0 }, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(NoChunkUntilCopy) {
+    ByteArena arena;
+
+    BOOST_CHECK_EQUAL(arena.chunksCount(), 0);
+    BOOST_CHECK(arena.copy("").empty());
+    BOOST_CHECK_EQUAL(arena.chunksCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CopiesDontMove) {
+    ByteArena arena { 8 };
+
+    std::string source { "Hello" };
+    const std::string_view hello { arena.copy(source) };
+    source = "World";
+    const std::string_view world { arena.copy(source) }; // Doesn't fit, next chunk is allocated
+
+    BOOST_CHECK_EQUAL(hello, "Hello");
+    BOOST_CHECK_EQUAL(world, "World");
+    BOOST_CHECK_EQUAL(arena.chunksCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(LargeStringChunk) {
+    ByteArena arena { 4 };
+
+    const std::string large(10, 'a');
+    BOOST_CHECK_EQUAL(arena.copy(large), large);
+    BOOST_CHECK_EQUAL(arena.chunksCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ChunksReusedAfterReset) {
+    ByteArena arena { 8 };
+    const std::string_view first { arena.copy("Hello") };
+    arena.copy("World");
+
+    arena.reset();
+
+    // Same storage is used again, without allocating another chunk
+    BOOST_CHECK(arena.copy("Bye").data() == first.data());
+    arena.copy("Again");
+    BOOST_CHECK_EQUAL(arena.chunksCount(), 2);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -13,9 +13,12 @@ class MockedCanaries : public Canaries {
 public:
     MockedCanaries() : Canaries {} {}
 
-    /// Resets underlying game grid to grid constructed with given initial configuration
+    /// Resets underlying game grid, its bitboard and players mobility to grid constructed with given initial
+    /// configuration
     void resetGrid(const std::initializer_list<std::initializer_list<Square>> initial_configuration) {
         game_grid_ = Grid { initial_configuration };
+        game_bitboard_ = Bitboard { game_grid_ };
+        recountMobility();
     }
 };
 
@@ -156,6 +159,22 @@ BOOST_AUTO_TEST_CASE(BlackPlayerBlocked) {
     BOOST_CHECK_EQUAL(game.victoryFor().value(), Player::White);
 }
 
+BOOST_AUTO_TEST_CASE(BlackPlayerBlockedByMove) {
+    game.resetGrid({
+                           { BLACK, WHITE, EMPTY, EMPTY },
+                           { EMPTY, EMPTY, EMPTY, EMPTY },
+                           { WHITE, EMPTY, EMPTY, EMPTY },
+                           { EMPTY, EMPTY, EMPTY, EMPTY }
+    });
+
+    BOOST_CHECK(!game.victoryFor().has_value());
+
+    // Last free neighbour of black pawn is taken by a white pawn
+    game.play({ 3, 1 }, { 2, 1 });
+
+    BOOST_CHECK_EQUAL(game.victoryFor().value(), Player::White);
+}
+
 BOOST_AUTO_TEST_CASE(NormalMoveAvailable) {
     game.resetGrid({ // Normal move from (1, 1) to (1, 2) available
                            { WHITE, EMPTY, BLACK, WHITE },
@@ -182,4 +201,9 @@ BOOST_AUTO_TEST_CASE(EatMoveAvailable) {
 BOOST_AUTO_TEST_SUITE_END()
 
 
+BOOST_AUTO_TEST_CASE(LegalMovesMatchPlay) {
+    checkLegalMovesMatchPlay<Canaries>();
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -115,8 +115,8 @@ BOOST_AUTO_TEST_CASE(RawNonTrimmedMessage) {
 BOOST_AUTO_TEST_CASE(NormalMessageWithCooldownNotFree) {
     service.handleRequestCommand(CONSOLE_ACTOR, "Hello world!"); // Sends a first message, cooldown starts
 
-    const RpT::Utils::HandlingResult second_was_sent { // Even if it is another actor, cooldown block message sending
-        service.handleRequestCommand(1, "Second message")
+    const RpT::Utils::HandlingResult second_was_sent { // Same actor is blocked by its own cooldown
+        service.handleRequestCommand(CONSOLE_ACTOR, "Second message")
     };
 
     // Checks for second message to not have been sent
@@ -127,6 +127,95 @@ BOOST_AUTO_TEST_CASE(NormalMessageWithCooldownNotFree) {
     BOOST_CHECK(!service.checkEvent().has_value()); // No second message
 }
 
+BOOST_AUTO_TEST_CASE(LowTrafficSentImmediately) {
+    BOOST_CHECK(service.handleRequestCommand(CONSOLE_ACTOR, "Hello world!"));
+    BOOST_CHECK(service.handleRequestCommand(1, "Hi"));
+
+    // Threshold isn't reached during this tick, so no message waits for next one
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent { "MESSAGE_FROM 0 Hello world!" });
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent { "MESSAGE_FROM 1 Hi" });
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(OtherActorsBatchedUntilTick) {
+    ChatService busy_service { context, 2000, nullptr, ChatService::DEFAULT_HISTORY_SIZE, 2 };
+
+    busy_service.handleRequestCommand(CONSOLE_ACTOR, "Hello world!");
+    busy_service.handleRequestCommand(1, "Hi");
+
+    // Cooldown of first actors doesn't block other actors, but past threshold their messages wait for next tick
+    BOOST_CHECK(busy_service.handleRequestCommand(2, "How are you?"));
+    BOOST_CHECK(busy_service.handleRequestCommand(3, "Fine"));
+    BOOST_CHECK(busy_service.isCoolingDown(3));
+    BOOST_CHECK_EQUAL(busy_service.pollEvent(), RpT::Core::ServiceEvent { "MESSAGE_FROM 0 Hello world!" });
+    BOOST_CHECK_EQUAL(busy_service.pollEvent(), RpT::Core::ServiceEvent { "MESSAGE_FROM 1 Hi" });
+    BOOST_CHECK(!busy_service.checkEvent().has_value());
+
+    RpT::Core::Timer& tick { busy_service.getWaitingTimers().at(0).get() };
+    BOOST_CHECK_EQUAL(tick.beginCountdown(), 2000 / ChatService::COOLDOWN_SLOTS);
+    tick.trigger();
+    busy_service.flush();
+
+    // Messages kept during previous tick are sent inside one event, each one prefixed by its length
+    BOOST_CHECK_EQUAL(busy_service.pollEvent(), RpT::Core::ServiceEvent { "MESSAGES 2 12 How are you? 3 4 Fine" });
+    BOOST_CHECK(!busy_service.checkEvent().has_value());
+
+    // Next tick has begun as actors are still cooling down, and next message is sent immediately again
+    BOOST_CHECK(tick.isWaitingCountdown());
+    BOOST_CHECK(busy_service.handleRequestCommand(4, "Bye"));
+    BOOST_CHECK_EQUAL(busy_service.pollEvent(), RpT::Core::ServiceEvent { "MESSAGE_FROM 4 Bye" });
+}
+
+BOOST_AUTO_TEST_CASE(CooldownDoneAfterWheelTurn) {
+    service.handleRequestCommand(CONSOLE_ACTOR, "Hello world!");
+    service.pollEvent();
+
+    RpT::Core::Timer& tick { service.getWaitingTimers().at(0).get() };
+    for (std::size_t i { 0 }; i < ChatService::COOLDOWN_SLOTS; i++) {
+        BOOST_CHECK(service.isCoolingDown(CONSOLE_ACTOR)); // Actor is released only once wheel is back to its slot
+
+        tick.beginCountdown();
+        tick.trigger();
+        service.flush();
+    }
+
+    BOOST_CHECK(!service.isCoolingDown(CONSOLE_ACTOR));
+    BOOST_CHECK(tick.isFree()); // Wheel stops as no actor is cooling down anymore
+    BOOST_CHECK(service.handleRequestCommand(CONSOLE_ACTOR, "Second message"));
+}
+
+BOOST_AUTO_TEST_CASE(HistoryForLateJoiner) {
+    ChatService small_history_service { context, 2000, nullptr, 2 };
+
+    small_history_service.sendHistory(3); // Nothing sent yet, no event
+    BOOST_CHECK(!small_history_service.checkEvent().has_value());
+
+    small_history_service.handleRequestCommand(0, "First");
+    small_history_service.handleRequestCommand(1, " Second ");
+    small_history_service.handleRequestCommand(2, "Third one");
+    while (small_history_service.checkEvent().has_value())
+        small_history_service.pollEvent();
+
+    // Oldest message was overwritten, remaining ones are sent from oldest to newest to joining actor only
+    small_history_service.sendHistory(3);
+    BOOST_CHECK_EQUAL(small_history_service.pollEvent(),
+                      (RpT::Core::ServiceEvent { "HISTORY 1 6 Second 2 9 Third one", { { 3 } } }));
+    BOOST_CHECK(!small_history_service.checkEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(ThrottledWhileOverloaded) {
+    RpT::Utils::LoadMonitor load_monitor { 0.9, 1 };
+    ChatService throttled_service { context, 2000, &load_monitor };
+
+    load_monitor.iterationDone({}, {}, 1); // Input queue reaches threshold
+    const RpT::Utils::HandlingResult was_sent { throttled_service.handleRequestCommand(CONSOLE_ACTOR, "Hello") };
+
+    BOOST_CHECK(!was_sent);
+    BOOST_CHECK_EQUAL(was_sent.errorMessage(), "Chat is throttled while server is overloaded");
+    BOOST_CHECK(!throttled_service.checkEvent().has_value());
+    BOOST_CHECK(throttled_service.getWaitingTimers().empty()); // Cooldown isn't started for shed message
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
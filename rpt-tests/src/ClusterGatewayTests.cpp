@@ -0,0 +1,236 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <RpT-Network/ClusterGateway.hpp>
+#include <RpT-Network/RawTcpBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Sends given RPTL message inside a length-prefixed frame using a blocking socket
+void sendFrame(boost::asio::ip::tcp::socket& socket, const std::string& rptl_message) {
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(rptl_message.size()) };
+
+    const std::vector<boost::asio::const_buffer> frame {
+        boost::asio::buffer(header), boost::asio::buffer(rptl_message)
+    };
+
+    boost::asio::write(socket, frame);
+}
+
+/// Receives next RPTL message from a length-prefixed frame using a blocking socket
+std::string receiveFrame(boost::asio::ip::tcp::socket& socket) {
+    RawTcpBackend::FrameHeader header;
+    boost::asio::read(socket, boost::asio::buffer(header));
+
+    std::string rptl_message;
+    rptl_message.resize(RawTcpBackend::frameLength(header.data()));
+    boost::asio::read(socket, boost::asio::buffer(rptl_message));
+
+    return rptl_message;
+}
+
+
+/// Provides 2 fake nodes and a gateway routing to them, running on its own thread
+struct ClusterGatewayFixture {
+    RpT::Utils::LoggingContext logging_context;
+    boost::asio::io_context sockets_context;
+    std::array<boost::asio::ip::tcp::acceptor, 2> nodes;
+    std::optional<ClusterGateway> gateway;
+    std::thread gateway_thread;
+
+    ClusterGatewayFixture()
+    : nodes {
+        boost::asio::ip::tcp::acceptor { sockets_context, { boost::asio::ip::address_v4::loopback(), 0 } },
+        boost::asio::ip::tcp::acceptor { sockets_context, { boost::asio::ip::address_v4::loopback(), 0 } }
+    } {
+        logging_context.disable();
+
+        // Nodes are polled so a client routed to wrong node doesn't block test forever
+        for (boost::asio::ip::tcp::acceptor& node : nodes)
+            node.non_blocking(true);
+
+        gateway.emplace(boost::asio::ip::tcp::endpoint { boost::asio::ip::address_v4::loopback(), 0 },
+                        std::vector<boost::asio::ip::tcp::endpoint> {
+                            nodes[0].local_endpoint(), nodes[1].local_endpoint()
+                        }, logging_context);
+
+        gateway_thread = std::thread { [this]() { gateway->run(); } };
+    }
+
+    ~ClusterGatewayFixture() {
+        stopGateway();
+    }
+
+    /// Stops gateway and waits for its thread, so its state can be checked
+    void stopGateway() {
+        if (gateway_thread.joinable()) {
+            gateway->stop();
+            gateway_thread.join();
+        }
+    }
+
+    /// Connects a new client to gateway
+    boost::asio::ip::tcp::socket connectClient() {
+        boost::asio::ip::tcp::socket client { sockets_context };
+        client.connect({ boost::asio::ip::address_v4::loopback(), gateway->localPort() });
+
+        return client;
+    }
+
+    /// Waits up to 2 seconds for gateway to connect given node
+    std::optional<boost::asio::ip::tcp::socket> acceptFrom(const std::size_t node) {
+        const auto deadline { std::chrono::steady_clock::now() + std::chrono::seconds { 2 } };
+
+        while (std::chrono::steady_clock::now() < deadline) {
+            boost::system::error_code err;
+            boost::asio::ip::tcp::socket routed_connection { nodes[node].accept(err) };
+
+            if (!err) {
+                routed_connection.non_blocking(false);
+                return routed_connection;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds { 1 });
+        }
+
+        return {};
+    }
+};
+
+
+}
+
+
+BOOST_FIXTURE_TEST_SUITE(ClusterGatewayTests, ClusterGatewayFixture)
+
+
+BOOST_AUTO_TEST_CASE(NoNode) {
+    BOOST_CHECK_THROW((ClusterGateway { { boost::asio::ip::address_v4::loopback(), 0 }, {}, logging_context }),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(RelayedBothWays) {
+    boost::asio::ip::tcp::socket client { connectClient() };
+    // Both messages sent at once, second one must be forwarded along with first one
+    sendFrame(client, "LOGIN 42 Alvis");
+    sendFrame(client, "SERVICE REQUEST 0 Chat Hello");
+
+    std::optional<boost::asio::ip::tcp::socket> node_connection { acceptFrom(0) };
+    BOOST_REQUIRE(node_connection.has_value());
+    BOOST_CHECK_EQUAL(receiveFrame(*node_connection), "LOGIN 42 Alvis");
+    BOOST_CHECK_EQUAL(receiveFrame(*node_connection), "SERVICE REQUEST 0 Chat Hello");
+
+    sendFrame(*node_connection, "LOGGED_IN 42 Alvis");
+    BOOST_CHECK_EQUAL(receiveFrame(client), "LOGGED_IN 42 Alvis");
+}
+
+BOOST_AUTO_TEST_CASE(LeastLoadedThenSticky) {
+    std::vector<boost::asio::ip::tcp::socket> clients;
+    std::vector<boost::asio::ip::tcp::socket> node_connections;
+
+    // Placed on least loaded node, first node if there are several of them
+    const std::array<std::pair<std::string, std::size_t>, 4> expected_nodes {{
+        { "Alice", 0 }, { "Bob", 1 }, { "Carl", 0 }, { "Alice", 0 } // Alice reconnects on its node, even if busier
+    }};
+
+    for (const auto& [actor_name, expected_node] : expected_nodes) {
+        clients.push_back(connectClient());
+        sendFrame(clients.back(), "LOGIN 1 " + actor_name);
+
+        std::optional<boost::asio::ip::tcp::socket> node_connection { acceptFrom(expected_node) };
+        BOOST_REQUIRE(node_connection.has_value());
+        BOOST_CHECK_EQUAL(receiveFrame(*node_connection), "LOGIN 1 " + actor_name);
+
+        node_connections.push_back(std::move(*node_connection));
+    }
+
+    stopGateway();
+
+    BOOST_CHECK_EQUAL(gateway->nodeLoad(0), 3);
+    BOOST_CHECK_EQUAL(gateway->nodeLoad(1), 1);
+    BOOST_CHECK_EQUAL(*gateway->placementFor("Alice"), 0);
+    BOOST_CHECK_EQUAL(*gateway->placementFor("Bob"), 1);
+    BOOST_CHECK(!gateway->placementFor("Dave").has_value());
+}
+
+BOOST_AUTO_TEST_CASE(ResumeRoutedToSessionNode) {
+    std::vector<boost::asio::ip::tcp::socket> clients;
+    std::vector<boost::asio::ip::tcp::socket> node_connections;
+
+    // Resume for Bob goes back to its node even if first node is as loaded, unknown session goes to least loaded one
+    const std::array<std::pair<std::string, std::size_t>, 4> expected_nodes {{
+        { "LOGIN 42 Alice", 0 }, { "LOGIN 7 Bob", 1 }, { "RESUME 7 123456", 1 }, { "RESUME 99 123456", 0 }
+    }};
+
+    for (const auto& [first_message, expected_node] : expected_nodes) {
+        clients.push_back(connectClient());
+        sendFrame(clients.back(), first_message);
+
+        std::optional<boost::asio::ip::tcp::socket> node_connection { acceptFrom(expected_node) };
+        BOOST_REQUIRE(node_connection.has_value());
+        BOOST_CHECK_EQUAL(receiveFrame(*node_connection), first_message);
+
+        node_connections.push_back(std::move(*node_connection));
+    }
+
+    stopGateway();
+
+    BOOST_CHECK_EQUAL(*gateway->sessionPlacementFor(42), 0);
+    BOOST_CHECK_EQUAL(*gateway->sessionPlacementFor(7), 1);
+    BOOST_CHECK(!gateway->sessionPlacementFor(99).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(DisconnectionUnloadsNode) {
+    boost::asio::ip::tcp::socket first_client { connectClient() };
+    sendFrame(first_client, "CHECKOUT"); // Not an actor, nothing is placed
+
+    std::optional<boost::asio::ip::tcp::socket> first_node_connection { acceptFrom(0) };
+    BOOST_REQUIRE(first_node_connection.has_value());
+    BOOST_CHECK_EQUAL(receiveFrame(*first_node_connection), "CHECKOUT");
+
+    first_client.close();
+
+    // Node connection is closed once gateway unloaded node
+    char unexpected_byte;
+    boost::system::error_code err;
+    boost::asio::read(*first_node_connection, boost::asio::buffer(&unexpected_byte, 1), err);
+    BOOST_CHECK(err == boost::asio::error::eof || err == boost::asio::error::connection_reset);
+
+    // First node is least loaded again
+    boost::asio::ip::tcp::socket second_client { connectClient() };
+    sendFrame(second_client, "LOGIN 1 Bob");
+
+    BOOST_CHECK(acceptFrom(0).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(TooLongFirstFrame) {
+    boost::asio::ip::tcp::socket client { connectClient() };
+
+    // Only header is sent, announcing a message longer than default limit
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(1024 * 1024) };
+    boost::asio::write(client, boost::asio::buffer(header));
+
+    // Client is closed without being routed
+    char unexpected_byte;
+    boost::system::error_code err;
+    boost::asio::read(client, boost::asio::buffer(&unexpected_byte, 1), err);
+
+    BOOST_CHECK(err == boost::asio::error::eof || err == boost::asio::error::connection_reset);
+    BOOST_CHECK(!acceptFrom(0).has_value());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <RpT-Core/ServiceEventRequestProtocol.hpp>
+
+/*
+ * Core benchmarks suite, run it from a Release build. Results are written as JSON by `benchmarks-report` target.
+ */
+
+
+using namespace RpT::Core;
+
+
+namespace {
+
+
+/// Succeeds with every SR command without emitting any event, events are emitted on demand
+class BenchService : public Service {
+private:
+    std::string name_;
+
+public:
+    BenchService(ServiceContext& run_context, std::string name)
+    : Service { run_context }, name_ { std::move(name) } {}
+
+    std::string_view name() const override {
+        return name_;
+    }
+
+    RpT::Utils::HandlingResult handleRequestCommand(std::uint64_t, std::string_view) override {
+        return {};
+    }
+
+    /// Emits given event command for every actor
+    void emit(const std::string_view event_command) {
+        emitEvent(event_command);
+    }
+};
+
+
+/// Services named `Service0` to `Service<N-1>` running inside same context
+template<std::size_t N>
+struct BenchServices {
+    ServiceContext context;
+    std::array<BenchService, N> services;
+
+    BenchServices() : BenchServices { std::make_index_sequence<N> {} } {}
+
+private:
+    template<std::size_t... Indexes>
+    explicit BenchServices(std::index_sequence<Indexes...>)
+    : services { BenchService { context, "Service" + std::to_string(Indexes) }... } {}
+};
+
+/// Constructs SER Protocol running every given service
+template<std::size_t N, std::size_t... Indexes>
+ServiceEventRequestProtocol makeProtocol(BenchServices<N>& bench_services, RpT::Utils::LoggingContext& logging_context,
+                                         std::index_sequence<Indexes...>) {
+
+    return ServiceEventRequestProtocol { { std::ref(bench_services.services[Indexes])... }, logging_context };
+}
+
+
+/// Parses SR command, dispatches it to service then formats SRR
+void HandleServiceRequest(benchmark::State& state) {
+    RpT::Utils::LoggingContext logging_context { RpT::Utils::LogLevel::FATAL };
+    BenchServices<1> bench_services;
+    ServiceEventRequestProtocol ser_protocol {
+        makeProtocol(bench_services, logging_context, std::make_index_sequence<1> {})
+    };
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ser_protocol.handleServiceRequest(1, "REQUEST 42 Service0 Hello world"));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Emits an event into service queue, then polls it directly from service
+void EmitThenPollEvent(benchmark::State& state) {
+    BenchServices<1> bench_services;
+    BenchService& service { bench_services.services[0] };
+
+    for (auto _ : state) {
+        service.emit("Hello world");
+        benchmark::DoNotOptimize(service.pollEvent());
+
+        bench_services.context.popEmittedEvent(); // Done by SER Protocol when polling, keeps events log bounded
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Each of N services emits an event, then every event is polled with SER Protocol, in order
+template<std::size_t N>
+void PollServiceEvent(benchmark::State& state) {
+    RpT::Utils::LoggingContext logging_context { RpT::Utils::LogLevel::FATAL };
+    BenchServices<N> bench_services;
+    ServiceEventRequestProtocol ser_protocol {
+        makeProtocol(bench_services, logging_context, std::make_index_sequence<N> {})
+    };
+
+    for (auto _ : state) {
+        for (BenchService& service : bench_services.services)
+            service.emit("Hello world");
+
+        std::optional<ServiceEvent> next_event { ser_protocol.pollServiceEvent() };
+        while (next_event) {
+            benchmark::DoNotOptimize(next_event);
+            next_event = ser_protocol.pollServiceEvent();
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+
+}
+
+
+BENCHMARK(HandleServiceRequest);
+BENCHMARK(EmitThenPollEvent);
+BENCHMARK_TEMPLATE(PollServiceEvent, 1);
+BENCHMARK_TEMPLATE(PollServiceEvent, 4);
+BENCHMARK_TEMPLATE(PollServiceEvent, 16);
+BENCHMARK_TEMPLATE(PollServiceEvent, 64);
@@ -0,0 +1,127 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <RpT-Utils/FlatHashMap.hpp>
+
+
+using namespace RpT::Utils;
+
+
+/// Sends every key into the same ideal slot, so probing and shifting are always exercised
+struct CollidingHash {
+    std::size_t operator()(std::uint64_t) const {
+        return 0;
+    }
+};
+
+
+BOOST_AUTO_TEST_SUITE(FlatHashMapTests)
+
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const FlatHashMap<std::uint64_t, std::string> map;
+
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK_EQUAL(map.size(), 0);
+    BOOST_CHECK_EQUAL(map.count(42), 0);
+    BOOST_CHECK(map.find(42) == map.end());
+    BOOST_CHECK(map.begin() == map.end());
+    BOOST_CHECK_THROW(map.at(42), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(InsertAndFind) {
+    FlatHashMap<std::uint64_t, std::string> map;
+
+    BOOST_CHECK(map.insert({ 1, "Alpha" }).second);
+    BOOST_CHECK(map.try_emplace(2, "Beta").second);
+    BOOST_CHECK(!map.insert({ 1, "Gamma" }).second); // Already inside, value isn't replaced
+
+    BOOST_CHECK_EQUAL(map.size(), 2);
+    BOOST_CHECK_EQUAL(map.at(1), "Alpha");
+    BOOST_CHECK_EQUAL(map.find(2)->second, "Beta");
+
+    map[3] = "Delta";
+    BOOST_CHECK_EQUAL(map.at(3), "Delta");
+    BOOST_CHECK_EQUAL(map.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(EraseKeepsCollidingEntriesReachable) {
+    FlatHashMap<std::uint64_t, int, CollidingHash> map;
+
+    for (std::uint64_t key { 0 }; key < 8; key++)
+        map.insert({ key, static_cast<int>(key) * 10 });
+
+    // Erasing inside probe sequence must shift following entries back
+    BOOST_CHECK_EQUAL(map.erase(2), 1);
+    BOOST_CHECK_EQUAL(map.erase(2), 0);
+    map.erase(map.find(5));
+
+    BOOST_CHECK_EQUAL(map.size(), 6);
+    for (const std::uint64_t key : { 0, 1, 3, 4, 6, 7 })
+        BOOST_CHECK_EQUAL(map.at(key), static_cast<int>(key) * 10);
+
+    BOOST_CHECK_EQUAL(map.count(2), 0);
+    BOOST_CHECK_EQUAL(map.count(5), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GrowthKeepsEveryEntry) {
+    FlatHashMap<std::uint64_t, std::uint64_t> map;
+
+    for (std::uint64_t key { 0 }; key < 1000; key++)
+        map.insert({ key << 16, key }); // Aligned keys, spread by hash mixing
+
+    BOOST_CHECK_EQUAL(map.size(), 1000);
+
+    std::uint64_t keys_sum { 0 };
+    for (const auto& [key, value] : map) {
+        BOOST_CHECK_EQUAL(key, value << 16);
+        keys_sum += value;
+    }
+
+    BOOST_CHECK_EQUAL(keys_sum, 999 * 1000 / 2);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesUnorderedMap) {
+    FlatHashMap<std::uint64_t, std::uint64_t> map;
+    std::unordered_map<std::uint64_t, std::uint64_t> expected_map;
+
+    std::mt19937_64 random_engine { 1234 };
+    std::uniform_int_distribution<std::uint64_t> keys_distribution { 0, 300 };
+
+    for (std::uint64_t i { 0 }; i < 20000; i++) {
+        const std::uint64_t key { keys_distribution(random_engine) };
+
+        if (i % 3 == 0) {
+            BOOST_CHECK_EQUAL(map.erase(key), expected_map.erase(key));
+        } else {
+            BOOST_CHECK_EQUAL(map.insert({ key, i }).second, expected_map.insert({ key, i }).second);
+        }
+    }
+
+    BOOST_CHECK_EQUAL(map.size(), expected_map.size());
+    for (const auto& [key, value] : expected_map)
+        BOOST_CHECK_EQUAL(map.at(key), value);
+}
+
+BOOST_AUTO_TEST_CASE(ClearKeepsSlots) {
+    FlatHashMap<std::uint64_t, std::string> map;
+    map.reserve(100);
+
+    for (std::uint64_t key { 0 }; key < 100; key++)
+        map.insert({ key, "Value" });
+
+    map.clear();
+
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.begin() == map.end());
+    BOOST_CHECK_EQUAL(map.count(50), 0);
+
+    map.insert({ 50, "Again" });
+    BOOST_CHECK_EQUAL(map.at(50), "Again");
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
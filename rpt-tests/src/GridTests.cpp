@@ -116,6 +116,26 @@ BOOST_AUTO_TEST_CASE(ManyLinesSameColumnsCount) {
     BOOST_CHECK_NO_THROW((Grid { initial_configuration }));
 }
 
+BOOST_AUTO_TEST_CASE(Layout) {
+    // 2 lines of 3 columns, known at compile time
+    constexpr GridLayout<2, 3> initial_layout {{
+            { WHITE, EMPTY, BLACK },
+            { BLACK, BLACK, EMPTY }
+    }};
+
+    static_assert(countSquares(initial_layout, WHITE) == 1);
+    static_assert(countSquares(initial_layout, BLACK) == 3);
+
+    const Grid grid { initial_layout };
+
+    BOOST_CHECK_EQUAL(grid.linesCount(), 2);
+    BOOST_CHECK_EQUAL(grid.columnsCount(), 3);
+    BOOST_CHECK_EQUAL((grid[{ 1, 1 }]), WHITE);
+    BOOST_CHECK_EQUAL((grid[{ 1, 3 }]), BLACK);
+    BOOST_CHECK_EQUAL((grid[{ 2, 2 }]), BLACK);
+    BOOST_CHECK_EQUAL((grid[{ 2, 3 }]), EMPTY);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -197,6 +217,50 @@ BOOST_AUTO_TEST_CASE(InsideGrid) {
     BOOST_CHECK_EQUAL((grid[{ 1, 1 }]), Square::Black);
 }
 
+BOOST_AUTO_TEST_CASE(PastLineEnd) {
+    // Squares are stored line after line, next line must not be reachable from past current line end
+    BOOST_CHECK_THROW((grid[{ 1, 6 }]), BadCoordinates);
+}
+
+BOOST_AUTO_TEST_CASE(Unchecked) {
+    grid[{ 10, 5 }] = Square::White;
+    grid.unchecked({ 2, 1 }) = Square::Black;
+
+    const Grid& const_grid { grid };
+
+    BOOST_CHECK_EQUAL(const_grid.unchecked({ 10, 5 }), Square::White);
+    BOOST_CHECK_EQUAL((const_grid[{ 2, 1 }]), Square::Black);
+    BOOST_CHECK_EQUAL((const_grid[{ 1, 5 }]), Square::Free);
+}
+
+BOOST_AUTO_TEST_CASE(MaxDimensions) {
+    // Each line has its own pawn color, so squares mixed between lines would be detected
+    const std::initializer_list<Square> white_line {
+        WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE,
+        WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE, WHITE
+    };
+    const std::initializer_list<Square> black_line {
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK
+    };
+
+    const Grid max_grid {
+        white_line, black_line, white_line, black_line, white_line, black_line, white_line, black_line, white_line,
+        black_line, white_line, black_line, white_line, black_line, white_line, black_line, white_line, black_line,
+        white_line, black_line, white_line, black_line, white_line, black_line, white_line, black_line
+    };
+
+    for (int line { 1 }; line <= Grid::MAX_DIMENSION; line++) {
+        const Square expected_color { line % 2 == 1 ? WHITE : BLACK };
+
+        for (int column { 1 }; column <= Grid::MAX_DIMENSION; column++)
+            BOOST_CHECK_EQUAL((max_grid[{ line, column }]), expected_color);
+    }
+
+    BOOST_CHECK_THROW((max_grid[{ 27, 1 }]), BadCoordinates);
+    BOOST_CHECK_THROW((max_grid[{ 1, 27 }]), BadCoordinates);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
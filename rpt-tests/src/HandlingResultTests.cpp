@@ -22,4 +22,15 @@ BOOST_AUTO_TEST_CASE(ErrorMessageConstructor) {
     BOOST_CHECK_EQUAL(result.errorMessage(), "An error"); // Error should be the one given to constructor
 }
 
+BOOST_AUTO_TEST_CASE(StaticErrorMessageConstructor) {
+    constexpr StaticErrorMessage static_error { "A static error" };
+    const HandlingResult result { static_error };
+
+    BOOST_CHECK(!result); // Must be false, as there is reported error
+    BOOST_CHECK_EQUAL(result.errorMessage(), "A static error");
+    // Message must be referenced and not copied
+    BOOST_CHECK_EQUAL(static_cast<const void*>(result.errorMessage().data()),
+                      static_cast<const void*>(static_error.message.data()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
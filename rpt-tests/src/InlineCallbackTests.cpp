@@ -0,0 +1,94 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include <RpT-Utils/InlineCallback.hpp>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(InlineCallbackTests)
+
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    InlineCallback callback;
+
+    BOOST_CHECK(!callback);
+    BOOST_CHECK_THROW(callback(), std::bad_function_call);
+}
+
+BOOST_AUTO_TEST_CASE(MoveOnlyCallable) {
+    int calls { 0 };
+    auto counter { std::make_unique<int>(10) };
+
+    InlineCallback callback { [&calls, counter = std::move(counter)]() { calls += *counter; } };
+    BOOST_CHECK(callback);
+
+    InlineCallback moved { std::move(callback) };
+    BOOST_CHECK(!callback); // Moved callback is left empty
+
+    moved();
+    moved();
+    BOOST_CHECK_EQUAL(calls, 20);
+}
+
+BOOST_AUTO_TEST_CASE(CallableDestroyedOnce) {
+    const auto resource { std::make_shared<int>(0) };
+
+    {
+        InlineCallback callback { [resource]() {} };
+        InlineCallback assigned;
+        assigned = std::move(callback);
+
+        BOOST_CHECK_EQUAL(resource.use_count(), 2); // Only moved, never copied
+    }
+
+    BOOST_CHECK_EQUAL(resource.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(WrappedStdFunction) {
+    int calls { 0 };
+    const std::function<void()> routine { [&calls]() { calls++; } };
+
+    InlineCallback callback { routine };
+    callback();
+
+    BOOST_CHECK_EQUAL(calls, 1);
+}
+
+BOOST_AUTO_TEST_CASE(CallbacksOverflow) {
+    std::vector<int> called_callbacks;
+    InlineCallbacks<2> callbacks;
+
+    for (int i { 0 }; i < 4; i++) // 2 callbacks stored inline, 2 others inside overflow vector
+        callbacks.push([&called_callbacks, i]() { called_callbacks.push_back(i); });
+
+    BOOST_CHECK_EQUAL(callbacks.size(), 4);
+
+    for (std::size_t i { 0 }; i < callbacks.size(); i++)
+        callbacks[i]();
+
+    const std::vector<int> expected_callbacks { 0, 1, 2, 3 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(called_callbacks.cbegin(), called_callbacks.cend(),
+                                  expected_callbacks.cbegin(), expected_callbacks.cend());
+
+    callbacks.clear();
+    BOOST_CHECK_EQUAL(callbacks.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ClearDestroysCallables) {
+    const auto resource { std::make_shared<int>(0) };
+    InlineCallbacks<1> callbacks;
+
+    callbacks.push([resource]() {});
+    callbacks.push([resource]() {});
+    BOOST_CHECK_EQUAL(resource.use_count(), 3);
+
+    callbacks.clear();
+    BOOST_CHECK_EQUAL(resource.use_count(), 1);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,259 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <sstream>
+#include <RpT-Core/InputEventsLog.hpp>
+#include <RpT-Core/InputRecorder.hpp>
+#include <RpT-Core/InputReplay.hpp>
+#include <RpT-Core/ServiceContext.hpp>
+
+
+using namespace RpT::Core;
+using namespace std::chrono_literals;
+
+
+/// Writes given events into a log, each one 1 ms after previous one
+std::string writeLog(std::initializer_list<AnyInputEvent> events) {
+    std::ostringstream log;
+    InputEventsLogWriter log_writer { log };
+
+    std::chrono::nanoseconds offset { 0 };
+    for (const AnyInputEvent& event : events) {
+        log_writer.write(offset, event);
+        offset += 1ms;
+    }
+
+    return log.str();
+}
+
+
+BOOST_AUTO_TEST_SUITE(InputEventsLogTests)
+
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+    ServiceRequestEvent stamped_request { 1, "REQUEST 0 Chat Hello world!" };
+    stamped_request.receivedAt(std::chrono::steady_clock::now());
+
+    std::istringstream log { writeLog({
+        NoneEvent { 0 }, JoinedEvent { 1, "Alice" }, stamped_request, TimerEvent { 0, 42 }, LeftEvent { 1 },
+        LeftEvent { 2, "Crashed" }, TaskCompletedEvent { 0, 300 }
+    }) };
+
+    InputEventsLogReader log_reader { log };
+
+    const std::optional<LoggedInputEvent> none_event { log_reader.next() };
+    BOOST_REQUIRE(none_event);
+    BOOST_CHECK(none_event->offset == 0ms);
+    BOOST_CHECK(!none_event->stamped);
+    BOOST_CHECK(std::get_if<NoneEvent>(&none_event->event));
+
+    const std::optional<LoggedInputEvent> joined_event { log_reader.next() };
+    BOOST_REQUIRE(joined_event);
+    BOOST_CHECK(joined_event->offset == 1ms);
+    BOOST_CHECK_EQUAL(std::get<JoinedEvent>(joined_event->event).actor(), 1);
+    BOOST_CHECK_EQUAL(std::get<JoinedEvent>(joined_event->event).playerName(), "Alice");
+
+    const std::optional<LoggedInputEvent> sr_event { log_reader.next() };
+    BOOST_REQUIRE(sr_event);
+    BOOST_CHECK(sr_event->offset == 2ms);
+    BOOST_CHECK(sr_event->stamped);
+    BOOST_CHECK_EQUAL(std::get<ServiceRequestEvent>(sr_event->event).actor(), 1);
+    BOOST_CHECK_EQUAL(std::get<ServiceRequestEvent>(sr_event->event).serviceRequest(), "REQUEST 0 Chat Hello world!");
+    // Receive time point isn't part of log
+    BOOST_CHECK(std::get<ServiceRequestEvent>(sr_event->event).receivedAt() == std::chrono::steady_clock::time_point {});
+
+    const std::optional<LoggedInputEvent> timer_event { log_reader.next() };
+    BOOST_REQUIRE(timer_event);
+    BOOST_CHECK_EQUAL(std::get<TimerEvent>(timer_event->event).token(), 42);
+
+    const std::optional<LoggedInputEvent> clean_left_event { log_reader.next() };
+    BOOST_REQUIRE(clean_left_event);
+    BOOST_CHECK_EQUAL(std::get<LeftEvent>(clean_left_event->event).actor(), 1);
+    BOOST_CHECK(std::get<LeftEvent>(clean_left_event->event).disconnectionReason());
+
+    const std::optional<LoggedInputEvent> crash_left_event { log_reader.next() };
+    BOOST_REQUIRE(crash_left_event);
+    BOOST_CHECK(crash_left_event->offset == 5ms);
+    BOOST_CHECK_EQUAL(std::get<LeftEvent>(crash_left_event->event).disconnectionReason().errorMessage(), "Crashed");
+
+    const std::optional<LoggedInputEvent> task_event { log_reader.next() };
+    BOOST_REQUIRE(task_event);
+    BOOST_CHECK_EQUAL(std::get<TaskCompletedEvent>(task_event->event).token(), 300);
+
+    BOOST_CHECK(!log_reader.next());
+}
+
+BOOST_AUTO_TEST_CASE(MissingHeader) {
+    std::istringstream log { "NOTALOG" };
+
+    BOOST_CHECK_THROW(InputEventsLogReader { log }, BadInputEventsLog);
+}
+
+BOOST_AUTO_TEST_CASE(OtherVersion) {
+    std::istringstream log { std::string { InputEventsLogFormat::MAGIC } + '\x02' };
+
+    BOOST_CHECK_THROW(InputEventsLogReader { log }, BadInputEventsLog);
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedRecord) {
+    const std::string full_log { writeLog({ JoinedEvent { 1, "Alice" } }) };
+    std::istringstream log { full_log.substr(0, full_log.size() - 2) };
+
+    InputEventsLogReader log_reader { log };
+
+    BOOST_CHECK_THROW(log_reader.next(), BadInputEventsLog);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownEventType) {
+    std::istringstream log { writeLog({}) + '\x05' + '\x00' + '\x00' };
+
+    InputEventsLogReader log_reader { log };
+
+    BOOST_CHECK_THROW(log_reader.next(), BadInputEventsLog);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayThenClose) {
+    std::istringstream log { writeLog({ JoinedEvent { 1, "Alice" }, ServiceRequestEvent { 1, "REQUEST 0 Chat Hi" } }) };
+
+    InputReplay replay { log };
+
+    BOOST_CHECK(std::holds_alternative<JoinedEvent>(replay.waitForInput()));
+    BOOST_CHECK(!replay.closed());
+
+    const std::optional<AnyInputEvent> polled_event { replay.pollInput() };
+    BOOST_REQUIRE(polled_event);
+    BOOST_CHECK(std::get_if<ServiceRequestEvent>(&*polled_event));
+    BOOST_CHECK(replay.closed()); // Last event has been retrieved
+
+    BOOST_CHECK(!replay.pollInput());
+    BOOST_CHECK_EQUAL(replay.replayedEvents(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayEmptyLog) {
+    std::istringstream log { writeLog({}) };
+
+    InputReplay replay { log };
+
+    BOOST_CHECK(std::holds_alternative<NoneEvent>(replay.waitForInput()));
+    BOOST_CHECK(replay.closed());
+}
+
+BOOST_AUTO_TEST_CASE(ReplayStampsEvents) {
+    ServiceRequestEvent stamped_request { 1, "REQUEST 0 Chat Hi" };
+    stamped_request.receivedAt(std::chrono::steady_clock::now());
+
+    std::istringstream log { writeLog({ stamped_request, JoinedEvent { 2, "Bob" } }) };
+
+    InputReplay replay { log };
+
+    const auto replay_begin { std::chrono::steady_clock::now() };
+    BOOST_CHECK(std::get<ServiceRequestEvent>(replay.waitForInput()).receivedAt() >= replay_begin);
+    BOOST_CHECK(std::get<JoinedEvent>(replay.waitForInput()).receivedAt() == std::chrono::steady_clock::time_point {});
+}
+
+BOOST_AUTO_TEST_CASE(ReplayPendingTimersOnly) {
+    ServiceContext tokens_provider;
+    Timer begun_timer { tokens_provider, 1000 };
+    Timer other_timer { tokens_provider, 1000 };
+
+    std::istringstream log { writeLog({
+        TimerEvent { 0, other_timer.token() }, TimerEvent { 0, begun_timer.token() }, NoneEvent { 0 }
+    }) };
+
+    InputReplay replay { log };
+
+    begun_timer.requestCountdown();
+    replay.beginTimer(begun_timer);
+    BOOST_CHECK(begun_timer.isPending());
+
+    // Timer which wasn't begun is skipped
+    BOOST_CHECK_EQUAL(std::get<TimerEvent>(replay.waitForInput()).token(), begun_timer.token());
+    BOOST_CHECK_EQUAL(replay.skippedEvents(), 1);
+    BOOST_CHECK(std::holds_alternative<NoneEvent>(replay.waitForInput()));
+    BOOST_CHECK_EQUAL(replay.replayedEvents(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayPendingTasksOnly) {
+    std::istringstream log { writeLog({ TaskCompletedEvent { 0, 1 }, TaskCompletedEvent { 0, 0 } }) };
+
+    InputReplay replay { log };
+    replay.beginTask(0);
+
+    // Task which wasn't begun is skipped
+    BOOST_CHECK_EQUAL(std::get<TaskCompletedEvent>(replay.waitForInput()).token(), 0);
+    BOOST_CHECK_EQUAL(replay.skippedEvents(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayClearedTimer) {
+    ServiceContext tokens_provider;
+    Timer cleared_timer { tokens_provider, 1000 };
+
+    std::istringstream log { writeLog({ TimerEvent { 0, cleared_timer.token() } }) };
+
+    InputReplay replay { log };
+
+    cleared_timer.requestCountdown();
+    replay.beginTimer(cleared_timer);
+    cleared_timer.clear();
+
+    BOOST_CHECK(std::holds_alternative<NoneEvent>(replay.waitForInput()));
+    BOOST_CHECK_EQUAL(replay.skippedEvents(), 1);
+    BOOST_CHECK(replay.closed());
+}
+
+BOOST_AUTO_TEST_CASE(ReplayOriginalPace) {
+    std::ostringstream log_output;
+    InputEventsLogWriter log_writer { log_output };
+    log_writer.write(0ms, NoneEvent { 0 });
+    log_writer.write(20ms, NoneEvent { 1 });
+
+    std::istringstream log { log_output.str() };
+
+    InputReplay replay { log, ReplayPace::Original };
+
+    const auto replay_begin { std::chrono::steady_clock::now() };
+    replay.waitForInput();
+
+    BOOST_CHECK(!replay.pollInput()); // Offset hasn't elapsed yet
+
+    BOOST_CHECK_EQUAL(std::get<NoneEvent>(replay.waitForInput()).actor(), 1);
+    BOOST_CHECK(std::chrono::steady_clock::now() - replay_begin >= 20ms);
+}
+
+BOOST_AUTO_TEST_CASE(RecordReplayedEvents) {
+    std::istringstream replayed_log {
+        writeLog({ JoinedEvent { 1, "Alice" }, ServiceRequestEvent { 1, "REQUEST 0 Chat Hi" }, LeftEvent { 1 } })
+    };
+
+    InputReplay replay { replayed_log };
+    std::ostringstream recorded_log;
+    InputRecorder recorder { replay, recorded_log };
+
+    recorder.waitForInput();
+    BOOST_CHECK(recorder.pollInput());
+    BOOST_CHECK(!recorder.closed());
+    recorder.waitForInput();
+    BOOST_CHECK(recorder.closed()); // Closed with recorded interface
+
+    BOOST_CHECK_EQUAL(recorder.recordedEvents(), 3);
+
+    std::istringstream log { recorded_log.str() };
+    InputEventsLogReader log_reader { log };
+
+    const std::optional<LoggedInputEvent> joined_event { log_reader.next() };
+    BOOST_REQUIRE(joined_event);
+    BOOST_CHECK(joined_event->offset == 0ms); // Offsets are relative to first recorded event
+    BOOST_CHECK_EQUAL(std::get<JoinedEvent>(joined_event->event).playerName(), "Alice");
+
+    const std::optional<LoggedInputEvent> sr_event { log_reader.next() };
+    BOOST_REQUIRE(sr_event);
+    BOOST_CHECK_EQUAL(std::get<ServiceRequestEvent>(sr_event->event).serviceRequest(), "REQUEST 0 Chat Hi");
+
+    const std::optional<LoggedInputEvent> left_event { log_reader.next() };
+    BOOST_REQUIRE(left_event);
+    BOOST_CHECK(std::get_if<LeftEvent>(&left_event->event));
+
+    BOOST_CHECK(!log_reader.next());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
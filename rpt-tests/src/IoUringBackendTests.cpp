@@ -0,0 +1,189 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Config/Config.hpp>
+
+#if RPT_IO_URING_AVAILABLE
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/Timer.hpp>
+#include <RpT-Network/IoUringBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Checks for given event variant to be of expected input event type
+template<typename ExpectedEventT>
+bool isEventType(const RpT::Core::AnyInputEvent& event_variant) {
+    return std::get_if<ExpectedEventT>(&event_variant) != nullptr;
+}
+
+
+/// Appends given RPTL message inside a length-prefixed frame to given bytes
+void appendFrame(std::string& bytes, const std::string& rptl_message) {
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(rptl_message.size()) };
+
+    bytes.append(header.data(), header.size());
+    bytes.append(rptl_message);
+}
+
+/// Sends given RPTL message inside a length-prefixed frame using a blocking socket
+void sendFrame(boost::asio::ip::tcp::socket& client_socket, const std::string& rptl_message) {
+    std::string frame;
+    appendFrame(frame, rptl_message);
+
+    boost::asio::write(client_socket, boost::asio::buffer(frame));
+}
+
+/// Receives next RPTL message from a length-prefixed frame using a blocking socket
+std::string receiveFrame(boost::asio::ip::tcp::socket& client_socket) {
+    RawTcpBackend::FrameHeader header;
+    boost::asio::read(client_socket, boost::asio::buffer(header));
+
+    std::string rptl_message;
+    rptl_message.resize(RawTcpBackend::frameLength(header.data()));
+    boost::asio::read(client_socket, boost::asio::buffer(rptl_message));
+
+    return rptl_message;
+}
+
+
+/// Provides a backend listening on a port chosen by system, with tiny receive buffers so frames are split
+struct IoUringBackendFixture {
+    RpT::Utils::LoggingContext logging_context;
+    IoUringBackend backend;
+
+    /// Few buffers, smaller than most frames
+    static IoUringBackendOptions tinyBuffers() {
+        IoUringBackendOptions options;
+        options.receiveBuffers = 4;
+        options.receiveBufferSize = 8;
+
+        return options;
+    }
+
+    IoUringBackendFixture()
+    : backend { { boost::asio::ip::address_v4::loopback(), 0 }, logging_context, tinyBuffers() } {
+        logging_context.disable();
+    }
+
+    /// Retrieves endpoint a client must connect to
+    boost::asio::ip::tcp::endpoint serverEndpoint() const {
+        return { boost::asio::ip::address_v4::loopback(), backend.localPort() };
+    }
+};
+
+
+}
+
+
+BOOST_FIXTURE_TEST_SUITE(IoUringBackendTests, IoUringBackendFixture)
+
+
+BOOST_AUTO_TEST_CASE(LoginThenLogout) {
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client_socket { client_context };
+    client_socket.connect(serverEndpoint());
+
+    std::vector<std::string> received_messages;
+    // Client is blocking on its socket, so it must run on its own thread while backend is handling messages
+    std::thread client_thread { [&client_socket, &received_messages]() {
+        // Both messages sent at once, so they're split across many receive buffers
+        std::string frames;
+        appendFrame(frames, "CHECKOUT");
+        appendFrame(frames, "LOGIN 42 Alvis");
+        boost::asio::write(client_socket, boost::asio::buffer(frames));
+
+        received_messages.push_back(receiveFrame(client_socket)); // AVAILABILITY
+        received_messages.push_back(receiveFrame(client_socket)); // REGISTRATION
+        received_messages.push_back(receiveFrame(client_socket)); // LOGGED_IN
+
+        sendFrame(client_socket, "LOGOUT");
+
+        try { // Receives remaining messages until connection is closed by server
+            while (true)
+                received_messages.push_back(receiveFrame(client_socket));
+        } catch (const boost::system::system_error&) {}
+    } };
+
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(backend.waitForInput())); // Checkout
+
+    const RpT::Core::AnyInputEvent joined_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(joined_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::JoinedEvent>(joined_event).actor(), 42);
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::JoinedEvent>(joined_event).playerName(), "Alvis");
+
+    const RpT::Core::AnyInputEvent left_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::LeftEvent>(left_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::LeftEvent>(left_event).actor(), 42);
+
+    // Remaining messages are sent and connection is closed, so client thread stops
+    backend.close();
+    client_thread.join();
+
+    BOOST_REQUIRE_EQUAL(received_messages.size(), 4);
+    BOOST_CHECK_EQUAL(received_messages.at(0), "AVAILABILITY 0 2");
+    BOOST_CHECK_EQUAL(received_messages.at(1).substr(0, 12), "REGISTRATION");
+    BOOST_CHECK_EQUAL(received_messages.at(2), "LOGGED_IN 42 Alvis");
+    BOOST_CHECK_EQUAL(received_messages.at(3), "INTERRUPT"); // Logged out client is closed without error
+}
+
+BOOST_AUTO_TEST_CASE(TooLongFrameKillsClient) {
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client_socket { client_context };
+    client_socket.connect(serverEndpoint());
+
+    // Only header is sent, announcing a message longer than default limit
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(1024 * 1024) };
+    boost::asio::write(client_socket, boost::asio::buffer(header));
+
+    // Other client logs in so an event is triggered once oversized frame has been handled
+    boost::asio::ip::tcp::socket other_socket { client_context };
+    other_socket.connect(serverEndpoint());
+    sendFrame(other_socket, "LOGIN 1 Alvis");
+
+    BOOST_CHECK(isEventType<RpT::Core::JoinedEvent>(backend.waitForInput()));
+
+    backend.close();
+
+    // Killed client connection has been closed without any message
+    char unexpected_byte;
+    boost::system::error_code err;
+    boost::asio::read(client_socket, boost::asio::buffer(&unexpected_byte, 1), err);
+
+    BOOST_CHECK(err == boost::asio::error::eof || err == boost::asio::error::connection_reset);
+}
+
+BOOST_AUTO_TEST_CASE(Timers) {
+    RpT::Core::ServiceContext tokens_provider;
+    RpT::Core::Timer triggered_timer { tokens_provider, 20 };
+    RpT::Core::Timer cancelled_timer { tokens_provider, 10 };
+
+    for (RpT::Core::Timer* timer : { &triggered_timer, &cancelled_timer }) {
+        timer->requestCountdown();
+        backend.beginTimer(*timer);
+    }
+
+    cancelled_timer.clear();
+
+    // Cancelled timer would have been triggered first
+    const RpT::Core::AnyInputEvent timer_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::TimerEvent>(timer_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::TimerEvent>(timer_event).token(), triggered_timer.token());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+#endif
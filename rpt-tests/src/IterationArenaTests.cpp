@@ -0,0 +1,69 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <RpT-Utils/IterationArena.hpp>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(IterationArenaTests)
+
+
+BOOST_AUTO_TEST_CASE(EmptyCapacity) {
+    BOOST_CHECK_THROW(IterationArena { 0 }, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(FitsInsideBuffer) {
+    IterationArena arena { 1024 };
+
+    {
+        std::pmr::vector<int> values { &arena.resource() };
+        values.reserve(100);
+
+        for (int i { 0 }; i < 100; i++)
+            values.push_back(i);
+
+        BOOST_CHECK_EQUAL(values.back(), 99);
+    }
+
+    BOOST_CHECK_EQUAL(arena.capacity(), 1024);
+    BOOST_CHECK_EQUAL(arena.overflows(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(OverflowsToHeap) {
+    IterationArena arena { 64 };
+
+    {
+        const std::pmr::string message { std::string(256, 'A'), &arena.resource() };
+        BOOST_CHECK_EQUAL(message.size(), 256);
+    }
+
+    BOOST_CHECK_EQUAL(arena.overflows(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ResetReusesBuffer) {
+    IterationArena arena { 512 };
+
+    // Each iteration allocates almost the whole buffer, which would overflow without reset
+    const void* first_allocation { nullptr };
+    for (int iteration { 0 }; iteration < 4; iteration++) {
+        {
+            const std::pmr::string message { std::string(400, 'A'), &arena.resource() };
+
+            if (iteration == 0)
+                first_allocation = message.data();
+            else // Same buffer space is used at each iteration
+                BOOST_CHECK(message.data() == first_allocation);
+        }
+
+        arena.reset();
+    }
+
+    BOOST_CHECK_EQUAL(arena.overflows(), 0);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
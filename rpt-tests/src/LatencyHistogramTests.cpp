@@ -0,0 +1,115 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <limits>
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(LatencyHistogramTests)
+
+/*
+ * Buckets ranges unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(Buckets)
+
+BOOST_AUTO_TEST_CASE(SmallValuesAreExact) {
+    for (std::uint64_t value { 0 }; value < LatencyHistogram::SUB_BUCKETS; value++) {
+        const std::size_t index { LatencyHistogram::bucketIndex(value) };
+
+        BOOST_CHECK_EQUAL(LatencyHistogram::bucketLowerBound(index), value);
+        BOOST_CHECK_EQUAL(LatencyHistogram::bucketUpperBound(index), value);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ContiguousRanges) {
+    // Each bucket must begin right after previous one, so any value belongs to exactly one bucket
+    for (std::size_t i { 1 }; i < LatencyHistogram::BUCKETS_COUNT; i++) {
+        BOOST_CHECK_EQUAL(LatencyHistogram::bucketLowerBound(i), LatencyHistogram::bucketUpperBound(i - 1) + 1);
+        BOOST_CHECK_EQUAL(LatencyHistogram::bucketIndex(LatencyHistogram::bucketLowerBound(i)), i);
+        BOOST_CHECK_EQUAL(LatencyHistogram::bucketIndex(LatencyHistogram::bucketUpperBound(i)), i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GreatestValue) {
+    constexpr std::uint64_t GREATEST_VALUE { std::numeric_limits<std::uint64_t>::max() };
+
+    BOOST_CHECK_EQUAL(LatencyHistogram::bucketIndex(GREATEST_VALUE), LatencyHistogram::BUCKETS_COUNT - 1);
+    BOOST_CHECK_EQUAL(LatencyHistogram::bucketUpperBound(LatencyHistogram::BUCKETS_COUNT - 1), GREATEST_VALUE);
+}
+
+BOOST_AUTO_TEST_CASE(RelativePrecision) {
+    // 1000 is inside [992, 1023] bucket, 32 values wide, for 16 sub-buckets per power of two
+    const std::size_t index { LatencyHistogram::bucketIndex(1000) };
+
+    BOOST_CHECK_EQUAL(LatencyHistogram::bucketLowerBound(index), 992);
+    BOOST_CHECK_EQUAL(LatencyHistogram::bucketUpperBound(index), 1023);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * Recording and statistics unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(Statistics)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const LatencyHistogram histogram;
+
+    BOOST_CHECK_EQUAL(histogram.count(), 0);
+    BOOST_CHECK_EQUAL(histogram.min(), 0);
+    BOOST_CHECK_EQUAL(histogram.max(), 0);
+    BOOST_CHECK_EQUAL(histogram.mean(), 0);
+    BOOST_CHECK_EQUAL(histogram.percentile(50), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Percentiles) {
+    LatencyHistogram histogram;
+
+    for (std::uint64_t value { 1 }; value <= 10; value++) // Small values, exact percentiles
+        histogram.record(value);
+
+    BOOST_CHECK_EQUAL(histogram.count(), 10);
+    BOOST_CHECK_EQUAL(histogram.min(), 1);
+    BOOST_CHECK_EQUAL(histogram.max(), 10);
+    BOOST_CHECK_EQUAL(histogram.mean(), 5.5);
+    BOOST_CHECK_EQUAL(histogram.percentile(0), 1);
+    BOOST_CHECK_EQUAL(histogram.percentile(50), 5);
+    BOOST_CHECK_EQUAL(histogram.percentile(90), 9);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), 10);
+}
+
+BOOST_AUTO_TEST_CASE(PercentileCappedByMax) {
+    LatencyHistogram histogram;
+    histogram.record(1000);
+
+    // Bucket upper bound is 1023, but no value above 1000 was recorded
+    BOOST_CHECK_EQUAL(histogram.percentile(99), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(Merge) {
+    LatencyHistogram first;
+    first.record(3);
+    first.record(100);
+
+    LatencyHistogram second;
+    second.record(1);
+
+    first.merge(second);
+
+    BOOST_CHECK_EQUAL(first.count(), 3);
+    BOOST_CHECK_EQUAL(first.min(), 1);
+    BOOST_CHECK_EQUAL(first.max(), 100);
+    BOOST_CHECK_EQUAL(first.percentile(50), 3);
+
+    first.reset();
+    BOOST_CHECK_EQUAL(first.count(), 0);
+    BOOST_CHECK_EQUAL(first.max(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
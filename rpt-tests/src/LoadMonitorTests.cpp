@@ -0,0 +1,71 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <stdexcept>
+#include <RpT-Utils/LoadMonitor.hpp>
+
+
+using namespace RpT::Utils;
+using namespace std::chrono_literals;
+
+
+BOOST_AUTO_TEST_SUITE(LoadMonitorTests)
+
+
+BOOST_AUTO_TEST_CASE(InvalidThresholds) {
+    BOOST_CHECK_THROW((LoadMonitor { 0, 10 }), std::invalid_argument);
+    BOOST_CHECK_THROW((LoadMonitor { 1.5, 10 }), std::invalid_argument);
+    BOOST_CHECK_THROW((LoadMonitor { 0.9, 0 }), std::invalid_argument);
+    BOOST_CHECK_THROW((LoadMonitor { 0.9, 10, 0s }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(NotOverloadedAtFirst) {
+    const LoadMonitor load_monitor { 0.9, 10 };
+
+    BOOST_CHECK(!load_monitor.overloaded());
+    BOOST_CHECK_EQUAL(load_monitor.saturation(), 0);
+    BOOST_CHECK_EQUAL(load_monitor.queueDepth(), 0);
+    BOOST_CHECK_EQUAL(load_monitor.saturationThreshold(), 0.9);
+    BOOST_CHECK_EQUAL(load_monitor.queueDepthThreshold(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(SaturatedWindow) {
+    LoadMonitor load_monitor { 0.75, 10, 100ms };
+
+    BOOST_CHECK(!load_monitor.iterationDone(10ms, 40ms, 0)); // Window isn't done yet
+    BOOST_CHECK(!load_monitor.overloaded());
+
+    BOOST_CHECK(load_monitor.iterationDone(0ms, 50ms, 2)); // 90 ms busy over 100 ms
+    BOOST_CHECK(load_monitor.overloaded());
+    BOOST_CHECK_CLOSE(load_monitor.saturation(), 0.9, 0.001);
+    BOOST_CHECK_EQUAL(load_monitor.queueDepth(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(QueueSpike) {
+    LoadMonitor load_monitor { 0.9, 10, 100ms };
+
+    // Overloaded as soon as queue reaches threshold, without waiting for window end
+    BOOST_CHECK(load_monitor.iterationDone(1ms, 1ms, 10));
+    BOOST_CHECK(load_monitor.overloaded());
+
+    // Still overloaded at window end, as threshold was reached during it
+    BOOST_CHECK(!load_monitor.iterationDone(98ms, 0ms, 0));
+    BOOST_CHECK(load_monitor.overloaded());
+    BOOST_CHECK_EQUAL(load_monitor.queueDepth(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(RecoversAfterCalmWindow) {
+    LoadMonitor load_monitor { 0.5, 10, 100ms };
+
+    load_monitor.iterationDone(0ms, 100ms, 0);
+    BOOST_CHECK(load_monitor.overloaded());
+
+    BOOST_CHECK(!load_monitor.iterationDone(80ms, 10ms, 0)); // Doesn't recover before window end
+    BOOST_CHECK(load_monitor.overloaded());
+
+    BOOST_CHECK(load_monitor.iterationDone(10ms, 0ms, 0)); // 10 ms busy over 100 ms
+    BOOST_CHECK(!load_monitor.overloaded());
+    BOOST_CHECK_CLOSE(load_monitor.saturation(), 0.1, 0.001);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -254,6 +254,47 @@ BOOST_AUTO_TEST_CASE(StartCancelledWas1Ready) {
 }
 
 
+BOOST_AUTO_TEST_CASE(SnapshotWaiting) {
+    service.assignActor(WHITE_PLAYER_ACTOR);
+    service.assignActor(BLACK_PLAYER_ACTOR);
+    service.handleRequestCommand(BLACK_PLAYER_ACTOR, "READY");
+    // Consumes events emitted by test preparation
+    while (service.checkEvent().has_value())
+        service.pollEvent();
+
+    // Actor not assigned to any player can ask for snapshot
+    BOOST_CHECK(service.handleRequestCommand(2, "SNAPSHOT"));
+    BOOST_CHECK_EQUAL(service.pollEvent(),
+                      (RpT::Core::ServiceEvent { "SNAPSHOT WAITING " + std::to_string(BLACK_PLAYER_ACTOR), { { 2 } } }));
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(SnapshotCountdown) {
+    service.assignActor(WHITE_PLAYER_ACTOR);
+    service.assignActor(BLACK_PLAYER_ACTOR);
+    service.handleRequestCommand(WHITE_PLAYER_ACTOR, "READY");
+    service.handleRequestCommand(BLACK_PLAYER_ACTOR, "READY");
+    // Consumes events emitted by test preparation
+    while (service.checkEvent().has_value())
+        service.pollEvent();
+
+    BOOST_CHECK(service.handleRequestCommand(WHITE_PLAYER_ACTOR, "SNAPSHOT"));
+    BOOST_CHECK_EQUAL(service.pollEvent(), (RpT::Core::ServiceEvent {
+        "SNAPSHOT COUNTDOWN " + std::to_string(WHITE_PLAYER_ACTOR) + ' ' + std::to_string(BLACK_PLAYER_ACTOR),
+        { { WHITE_PLAYER_ACTOR } }
+    }));
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(SnapshotPlaying) {
+    minigame.start(WHITE_PLAYER_ACTOR, BLACK_PLAYER_ACTOR);
+
+    BOOST_CHECK(service.handleRequestCommand(2, "SNAPSHOT"));
+    BOOST_CHECK_EQUAL(service.pollEvent(), (RpT::Core::ServiceEvent { "SNAPSHOT PLAYING", { { 2 } } }));
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
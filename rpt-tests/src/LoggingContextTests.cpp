@@ -237,4 +237,69 @@ BOOST_AUTO_TEST_CASE(Disabled) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * LoggerView::shouldLog() method tests
+ */
+
+BOOST_AUTO_TEST_SUITE(ShouldLog)
+
+BOOST_AUTO_TEST_CASE(BelowContextLevel) {
+    LoggingContext logging_context { LogLevel::WARN };
+    const LoggerView logger { "Test", logging_context };
+
+    BOOST_CHECK(!logger.shouldLog(LogLevel::INFO));
+    BOOST_CHECK(logger.shouldLog(LogLevel::WARN));
+    BOOST_CHECK(logger.shouldLog(LogLevel::FATAL));
+}
+
+BOOST_AUTO_TEST_CASE(LowestLevel) {
+    LoggingContext logging_context { LogLevel::TRACE };
+    const LoggerView logger { "Test", logging_context };
+
+    // Trace messages are logged only if they haven't been removed from build
+    BOOST_CHECK_EQUAL(logger.shouldLog(LogLevel::TRACE), LoggerView::isCompiledIn(LogLevel::TRACE));
+}
+
+BOOST_AUTO_TEST_CASE(Disabled) {
+    LoggingContext logging_context { LogLevel::INFO };
+    const LoggerView logger { "Test", logging_context };
+
+    logging_context.disable();
+
+    BOOST_CHECK(!logger.shouldLog(LogLevel::FATAL));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * enableAsyncLogging() method tests
+ */
+
+BOOST_AUTO_TEST_SUITE(EnableAsyncLogging)
+
+BOOST_AUTO_TEST_CASE(Disabled) {
+    const LoggingContext logging_context;
+
+    // Synchronous by default
+    BOOST_CHECK(!logging_context.asyncSink());
+    BOOST_CHECK_EQUAL(logging_context.droppedMessages(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Enabled) {
+    LoggingContext logging_context;
+    logging_context.enableAsyncLogging(16, LogOverflowPolicy::DROP);
+
+    BOOST_CHECK(logging_context.asyncSink());
+    BOOST_CHECK_EQUAL(logging_context.droppedMessages(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(AlreadyEnabled) {
+    LoggingContext logging_context;
+    logging_context.enableAsyncLogging(16, LogOverflowPolicy::DROP);
+
+    BOOST_CHECK_THROW(logging_context.enableAsyncLogging(16, LogOverflowPolicy::BLOCK), std::logic_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <RpT-Utils/LoopTracer.hpp>
+
+
+using namespace RpT::Utils;
+
+
+/// Counts occurrences of given pattern inside given trace
+std::size_t countOccurrences(const std::string& trace, const std::string_view pattern) {
+    std::size_t count { 0 };
+    for (std::size_t i { trace.find(pattern) }; i != std::string::npos; i = trace.find(pattern, i + 1))
+        count++;
+
+    return count;
+}
+
+
+BOOST_AUTO_TEST_SUITE(LoopTracerTests)
+
+
+BOOST_AUTO_TEST_CASE(NoCapacity) {
+    BOOST_CHECK_THROW((LoopTracer { 0, "trace.json" }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyTrace) {
+    const LoopTracer tracer { 4, "trace.json" };
+
+    std::ostringstream trace;
+    tracer.dumpTo(trace);
+
+    BOOST_CHECK_EQUAL(tracer.size(), 0);
+    BOOST_CHECK_EQUAL(trace.str(), "{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+BOOST_AUTO_TEST_CASE(SpansWithIterations) {
+    LoopTracer tracer { 4, "trace.json" };
+
+    tracer.beginIteration();
+    { const TraceSpan span { &tracer, "waitForInput" }; }
+    tracer.beginIteration();
+    { const TraceSpan span { &tracer, "loopRoutine" }; }
+
+    std::ostringstream trace;
+    tracer.dumpTo(trace);
+
+    const std::string trace_str { trace.str() };
+
+    BOOST_CHECK_EQUAL(tracer.size(), 2);
+    BOOST_CHECK_EQUAL(countOccurrences(trace_str, "\"ph\":\"X\""), 2);
+    // Spans are written from oldest to latest
+    BOOST_CHECK_LT(trace_str.find("\"name\":\"waitForInput\""), trace_str.find("\"name\":\"loopRoutine\""));
+    BOOST_CHECK_NE(trace_str.find("\"args\":{\"iteration\":1}"), std::string::npos);
+    BOOST_CHECK_NE(trace_str.find("\"args\":{\"iteration\":2}"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(RingOverwritesOldest) {
+    LoopTracer tracer { 2, "trace.json" };
+
+    { const TraceSpan span { &tracer, "first" }; }
+    { const TraceSpan span { &tracer, "second" }; }
+    { const TraceSpan span { &tracer, "third" }; }
+
+    std::ostringstream trace;
+    tracer.dumpTo(trace);
+
+    const std::string trace_str { trace.str() };
+
+    BOOST_CHECK_EQUAL(tracer.size(), 2);
+    BOOST_CHECK_EQUAL(trace_str.find("\"name\":\"first\""), std::string::npos);
+    BOOST_CHECK_LT(trace_str.find("\"name\":\"second\""), trace_str.find("\"name\":\"third\""));
+}
+
+BOOST_AUTO_TEST_CASE(NoTracer) {
+    // Must not do anything
+    const TraceSpan span { nullptr, "ignored" };
+}
+
+BOOST_AUTO_TEST_CASE(DumpOnlyIfRequested) {
+    LoopTracer tracer { 2, "loop-tracer-tests.json" };
+
+    BOOST_CHECK(!tracer.dumpIfRequested());
+
+    tracer.requestDump();
+
+    BOOST_CHECK(tracer.dumpIfRequested());
+    BOOST_CHECK(!tracer.dumpIfRequested()); // Request is consumed by dump
+
+    std::remove("loop-tracer-tests.json");
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
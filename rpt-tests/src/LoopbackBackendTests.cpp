@@ -0,0 +1,272 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <sstream>
+#include <vector>
+#include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/Timer.hpp>
+#include <RpT-Network/LoopbackBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Checks for given event variant to be of expected input event type
+template<typename ExpectedEventT>
+bool isEventType(const RpT::Core::AnyInputEvent& event_variant) {
+    return std::get_if<ExpectedEventT>(&event_variant) != nullptr;
+}
+
+
+/// Saves every message received by simulated clients
+struct ReceivedMessagesFixture {
+    std::vector<std::pair<std::uint64_t, std::string>> received_messages;
+
+    /// Sets backend received messages handler so they're saved into fixture
+    void listen(LoopbackBackend& backend) {
+        backend.onReceivedMessage([this](const std::uint64_t client_token, const std::string& message) {
+            received_messages.emplace_back(client_token, message);
+        });
+    }
+};
+
+
+}
+
+
+BOOST_FIXTURE_TEST_SUITE(LoopbackBackendTests, ReceivedMessagesFixture)
+
+
+BOOST_AUTO_TEST_CASE(ClosedWithoutGenerator) {
+    LoopbackBackend backend;
+
+    // Nothing to handle and no generator, backend must close itself
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(backend.waitForInput()));
+    BOOST_CHECK(backend.closed());
+}
+
+BOOST_AUTO_TEST_CASE(Checkout) {
+    LoopbackBackend backend;
+    listen(backend);
+
+    const std::uint64_t client { backend.connect() };
+    backend.send(client, "CHECKOUT");
+
+    // Checkout doesn't trigger any actual event
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(backend.waitForInput()));
+    BOOST_CHECK(!backend.closed());
+
+    // Messages are synced at next wait, which also closes backend as there is nothing left to handle
+    backend.waitForInput();
+    BOOST_CHECK(backend.closed());
+
+    BOOST_REQUIRE_EQUAL(received_messages.size(), 1);
+    BOOST_CHECK_EQUAL(received_messages.front().first, client);
+    BOOST_CHECK_EQUAL(received_messages.front().second, "AVAILABILITY 0 2");
+    BOOST_CHECK_EQUAL(backend.receivedMessagesCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Handshake) {
+    LoopbackBackend backend;
+    listen(backend);
+
+    const std::uint64_t client { backend.connect() };
+    backend.send(client, "LOGIN 42 Alvis");
+
+    const RpT::Core::AnyInputEvent joined_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(joined_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::JoinedEvent>(joined_event).actor(), 42);
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::JoinedEvent>(joined_event).playerName(), "Alvis");
+
+    // Closing backend disconnects every client, registered actor must leave
+    BOOST_CHECK(isEventType<RpT::Core::LeftEvent>(backend.waitForInput()));
+    BOOST_CHECK(backend.closed());
+    BOOST_CHECK_EQUAL(backend.connectedCount(), 0);
+
+    // REGISTRATION then LOGGED_IN after handshake, INTERRUPT when closed
+    BOOST_REQUIRE_EQUAL(received_messages.size(), 3);
+    BOOST_CHECK_EQUAL(received_messages.at(0).second.substr(0, 12), "REGISTRATION");
+    BOOST_CHECK_EQUAL(received_messages.at(1).second, "LOGGED_IN 42 Alvis");
+    BOOST_CHECK_EQUAL(received_messages.at(2).second, "INTERRUPT");
+}
+
+BOOST_AUTO_TEST_CASE(BadMessageKillsClient) {
+    LoopbackBackend backend;
+
+    const std::uint64_t bad_client { backend.connect() };
+    const std::uint64_t good_client { backend.connect() };
+    backend.send(bad_client, "UNKNOWN_COMMAND");
+    backend.send(bad_client, "LOGIN 1 Ignored"); // Client will have been killed when message is handled
+    backend.send(good_client, "LOGIN 2 Alvis");
+
+    const RpT::Core::AnyInputEvent joined_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(joined_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::JoinedEvent>(joined_event).actor(), 2);
+
+    BOOST_CHECK(!backend.isConnected(bad_client));
+    BOOST_CHECK(backend.isConnected(good_client));
+    BOOST_CHECK_EQUAL(backend.connectedCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TimersInSimulatedTime) {
+    RpT::Core::ServiceContext tokens_provider;
+    RpT::Core::Timer long_timer { tokens_provider, 5000 };
+    RpT::Core::Timer short_timer { tokens_provider, 1000 };
+    RpT::Core::Timer cancelled_timer { tokens_provider, 500 };
+
+    LoopbackBackend backend;
+    for (RpT::Core::Timer* timer : { &long_timer, &short_timer, &cancelled_timer }) {
+        timer->requestCountdown();
+        backend.beginTimer(*timer);
+    }
+
+    cancelled_timer.clear();
+
+    // Earliest deadline is triggered first, without waiting for it
+    const RpT::Core::AnyInputEvent first_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::TimerEvent>(first_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::TimerEvent>(first_event).token(), short_timer.token());
+    BOOST_CHECK_EQUAL(backend.simulatedTime().count(), 1000);
+
+    const RpT::Core::AnyInputEvent second_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::TimerEvent>(second_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::TimerEvent>(second_event).token(), long_timer.token());
+    BOOST_CHECK_EQUAL(backend.simulatedTime().count(), 5000);
+
+    // Cancelled timer must never be triggered
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(backend.waitForInput()));
+    BOOST_CHECK(backend.closed());
+}
+
+BOOST_AUTO_TEST_CASE(CoalescedTimers) {
+    RpT::Core::ServiceContext tokens_provider;
+    RpT::Core::Timer early_timer { tokens_provider, 1030, 100 };
+    RpT::Core::Timer late_timer { tokens_provider, 1070, 100 };
+    RpT::Core::Timer exact_timer { tokens_provider, 1050 };
+
+    LoopbackBackend backend;
+    for (RpT::Core::Timer* timer : { &early_timer, &late_timer, &exact_timer }) {
+        timer->requestCountdown();
+        backend.beginTimer(*timer);
+    }
+
+    // Timer without slack isn't delayed
+    const RpT::Core::AnyInputEvent exact_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::TimerEvent>(exact_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::TimerEvent>(exact_event).token(), exact_timer.token());
+    BOOST_CHECK_EQUAL(backend.simulatedTime().count(), 1050);
+
+    // Both timers with slack trigger together, at end of their slack window
+    const RpT::Core::AnyInputEvent first_coalesced_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::TimerEvent>(first_coalesced_event));
+    BOOST_CHECK_EQUAL(backend.simulatedTime().count(), 1100);
+
+    const RpT::Core::AnyInputEvent second_coalesced_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::TimerEvent>(second_coalesced_event));
+    BOOST_CHECK_EQUAL(backend.simulatedTime().count(), 1100);
+
+    BOOST_CHECK_NE(std::get<RpT::Core::TimerEvent>(first_coalesced_event).token(),
+                   std::get<RpT::Core::TimerEvent>(second_coalesced_event).token());
+}
+
+BOOST_AUTO_TEST_CASE(PollInputWithoutWaiting) {
+    RpT::Core::ServiceContext tokens_provider;
+    RpT::Core::Timer timer { tokens_provider, 1000 };
+
+    LoopbackBackend backend;
+    listen(backend);
+
+    timer.requestCountdown();
+    backend.beginTimer(timer);
+
+    backend.send(backend.connect(), "CHECKOUT");
+    backend.send(backend.connect(), "CHECKOUT");
+
+    // Clients messages are ready, timer isn't as simulated time only moves while waiting
+    const std::optional<RpT::Core::AnyInputEvent> first_event { backend.pollInput() };
+    BOOST_REQUIRE(first_event.has_value());
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(*first_event));
+    const std::optional<RpT::Core::AnyInputEvent> second_event { backend.pollInput() };
+    BOOST_REQUIRE(second_event.has_value());
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(*second_event));
+    BOOST_CHECK(!backend.pollInput().has_value());
+
+    // Clients aren't synced while polling
+    BOOST_CHECK(received_messages.empty());
+    BOOST_CHECK_EQUAL(backend.simulatedTime().count(), 0);
+
+    BOOST_CHECK(isEventType<RpT::Core::TimerEvent>(backend.waitForInput()));
+    BOOST_CHECK_EQUAL(received_messages.size(), 2); // Synced once for both checkouts
+}
+
+BOOST_AUTO_TEST_CASE(GeneratedClients) {
+    constexpr std::size_t CLIENTS_COUNT { 1000 };
+    std::size_t connected_clients { 0 };
+
+    // Connects a new client checking out server each time there is nothing left to handle
+    LoopbackBackend backend {
+        [&connected_clients](LoopbackBackend& generated_backend) {
+            if (connected_clients == CLIENTS_COUNT)
+                return false;
+
+            generated_backend.send(generated_backend.connect(), "CHECKOUT");
+            connected_clients++;
+
+            return true;
+        }
+    };
+
+    std::size_t none_events_count { 0 };
+    while (!backend.closed()) {
+        BOOST_REQUIRE(isEventType<RpT::Core::NoneEvent>(backend.waitForInput()));
+        none_events_count++;
+    }
+
+    // One event for each checkout, then one when closed
+    BOOST_CHECK_EQUAL(none_events_count, CLIENTS_COUNT + 1);
+    BOOST_CHECK_EQUAL(backend.receivedMessagesCount(), CLIENTS_COUNT);
+}
+
+BOOST_AUTO_TEST_CASE(Script) {
+    std::istringstream script {
+        "# Comment line is ignored\n"
+        "7 LOGIN 1 Alvis\n"
+        "\n"
+        "3 CHECKOUT\n"
+        "7\n"
+    };
+
+    LoopbackBackend backend { LoopbackScript { script } };
+    listen(backend);
+
+    const RpT::Core::AnyInputEvent joined_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(joined_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::JoinedEvent>(joined_event).actor(), 1);
+
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(backend.waitForInput())); // Checkout
+
+    // Client 7 disconnected by script, actor leaves
+    BOOST_CHECK(isEventType<RpT::Core::LeftEvent>(backend.waitForInput()));
+    BOOST_CHECK_EQUAL(backend.connectedCount(), 2); // Killed client is removed at next wait
+
+    // End of script
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(backend.waitForInput()));
+    BOOST_CHECK(backend.closed());
+
+    // Second client checked out server after first one registered
+    BOOST_CHECK_EQUAL(received_messages.at(2).second, "AVAILABILITY 1 2");
+}
+
+BOOST_AUTO_TEST_CASE(ScriptBadClientNumber) {
+    std::istringstream script { "first CHECKOUT\n" };
+
+    LoopbackBackend backend { LoopbackScript { script } };
+
+    BOOST_CHECK_THROW(backend.waitForInput(), BadClientMessage);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,155 @@
+#include <RpT-Testing/TestingUtils.hpp>
+#include <RpT-Testing/MinigamesServicesTestingUtils.hpp> // Required by BOOST_CHECK_EQUAL for operator<<
+
+#include <filesystem>
+#include <fstream>
+#include <Minigames-Services/MatchLog.hpp>
+
+
+using namespace MinigamesServices;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Provides a log path inside temporary directory, removed before and after each test
+struct MatchLogFixture {
+    const std::string logPath;
+
+    MatchLogFixture() : logPath { (std::filesystem::temp_directory_path() / "rpt-match-log-tests.bin").string() } {
+        std::filesystem::remove(logPath);
+    }
+
+    ~MatchLogFixture() {
+        std::filesystem::remove(logPath);
+    }
+
+    /// Appends given matches into log, waiting for writer to write every one of them
+    void append(const std::initializer_list<LoggedMatch> matches) const {
+        MatchLogWriter writer { logPath };
+
+        for (const LoggedMatch& match : matches)
+            writer.append(match);
+    }
+};
+
+
+/// Match won by white with a move, a round end and another move
+const LoggedMatch WON_MATCH {
+    0, 1, 1700000000000, {
+        { false, { 1, 2 }, { 3, 4 } },
+        { true, {}, {} },
+        { false, { 10, 200 }, { 300, 4000 } }
+    }, MatchResult::WhiteVictory
+};
+
+/// Match stopped before any action was played
+const LoggedMatch STOPPED_MATCH { 42, 18446744073709551615u, 0, {}, MatchResult::Stopped };
+
+
+/// Checks that both matches are same
+void checkMatch(const LoggedMatch& match, const LoggedMatch& expected) {
+    BOOST_CHECK_EQUAL(match.whiteActor, expected.whiteActor);
+    BOOST_CHECK_EQUAL(match.blackActor, expected.blackActor);
+    BOOST_CHECK_EQUAL(match.startedAt, expected.startedAt);
+    BOOST_CHECK(match.result == expected.result);
+
+    BOOST_REQUIRE_EQUAL(match.actions.size(), expected.actions.size());
+    for (std::size_t i { 0 }; i < match.actions.size(); i++) {
+        BOOST_CHECK_EQUAL(match.actions[i].roundEnd, expected.actions[i].roundEnd);
+
+        if (!expected.actions[i].roundEnd) {
+            BOOST_CHECK_EQUAL(match.actions[i].from, expected.actions[i].from);
+            BOOST_CHECK_EQUAL(match.actions[i].to, expected.actions[i].to);
+        }
+    }
+}
+
+
+}
+
+
+BOOST_FIXTURE_TEST_SUITE(MatchLogTests, MatchLogFixture)
+
+
+BOOST_AUTO_TEST_CASE(EmptyLog) {
+    append({});
+
+    MatchLogReader reader { logPath };
+    LoggedMatch match;
+
+    BOOST_CHECK(!reader.next(match));
+    BOOST_CHECK(!reader.skip());
+}
+
+BOOST_AUTO_TEST_CASE(MatchesRead) {
+    append({ WON_MATCH, STOPPED_MATCH });
+
+    MatchLogReader reader { logPath };
+    LoggedMatch match;
+
+    BOOST_REQUIRE(reader.next(match));
+    checkMatch(match, WON_MATCH);
+    BOOST_REQUIRE(reader.next(match)); // Actions of previous match must not be kept
+    checkMatch(match, STOPPED_MATCH);
+    BOOST_CHECK(!reader.next(match));
+}
+
+BOOST_AUTO_TEST_CASE(MatchSkipped) {
+    append({ WON_MATCH, STOPPED_MATCH });
+
+    MatchLogReader reader { logPath };
+    LoggedMatch match;
+
+    BOOST_CHECK(reader.skip());
+    BOOST_REQUIRE(reader.next(match));
+    checkMatch(match, STOPPED_MATCH);
+    BOOST_CHECK(!reader.skip());
+}
+
+BOOST_AUTO_TEST_CASE(AppendedToExistingLog) {
+    append({ WON_MATCH });
+    append({ STOPPED_MATCH }); // Header isn't written again
+
+    MatchLogReader reader { logPath };
+    LoggedMatch match;
+
+    BOOST_REQUIRE(reader.next(match));
+    checkMatch(match, WON_MATCH);
+    BOOST_REQUIRE(reader.next(match));
+    checkMatch(match, STOPPED_MATCH);
+    BOOST_CHECK(!reader.next(match));
+}
+
+BOOST_AUTO_TEST_CASE(AppendedMatchesCount) {
+    MatchLogWriter writer { logPath };
+    writer.append(WON_MATCH);
+    writer.append(STOPPED_MATCH);
+
+    BOOST_CHECK_EQUAL(writer.appendedMatches(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(NotMatchLog) {
+    std::ofstream { logPath } << "Not a match log";
+
+    BOOST_CHECK_THROW(MatchLogWriter { logPath }, BadMatchLog);
+    BOOST_CHECK_THROW(MatchLogReader { logPath }, BadMatchLog);
+}
+
+BOOST_AUTO_TEST_CASE(MissingLog) {
+    BOOST_CHECK_THROW(MatchLogReader { logPath }, BadMatchLog);
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedMatch) {
+    append({ WON_MATCH });
+    std::filesystem::resize_file(logPath, std::filesystem::file_size(logPath) - 1); // Result byte is missing
+
+    MatchLogReader reader { logPath };
+    LoggedMatch match;
+
+    BOOST_CHECK_THROW(reader.next(match), BadMatchLog);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <Minigames-Services/Acores.hpp>
+#include <Minigames-Services/MatchReplay.hpp>
+
+
+using namespace MinigamesServices;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Maximum actions count for generated matches, so a match without any victory still ends
+constexpr std::size_t MAX_GENERATED_ACTIONS { 200 };
+
+
+/**
+ * @brief Plays first legal move of each round into a new Acores game, logging actions as `MinigameService` would
+ *
+ * @returns Generated match with result reached by game
+ */
+LoggedMatch generateMatch() {
+    Acores game;
+    LoggedMatch match { 0, 1, 0, {}, MatchResult::Stopped };
+
+    while (match.actions.size() < MAX_GENERATED_ACTIONS) {
+        const std::vector<PawnMove> moves { game.legalMoves() };
+        if (moves.empty()) // Current player is blocked, match is stopped
+            break;
+
+        game.play(moves.front().from, moves.front().to);
+        match.actions.push_back({ false, moves.front().from, moves.front().to });
+
+        const std::optional<Player> winner { game.victoryFor() };
+        if (winner.has_value()) {
+            match.result = *winner == Player::White ? MatchResult::WhiteVictory : MatchResult::BlackVictory;
+
+            break;
+        }
+
+        // Round is ended by player if it could keep playing, otherwise service ends it without logging anything
+        if (!game.isRoundTerminated())
+            match.actions.push_back({ true, {}, {} });
+
+        game.nextRound();
+    }
+
+    return match;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(MatchReplayTests)
+
+
+BOOST_AUTO_TEST_CASE(SameMatch) {
+    const LoggedMatch match { generateMatch() };
+    Acores game;
+
+    BOOST_CHECK(!replayMatch(game, match).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(EmptyStoppedMatch) {
+    Acores game;
+
+    BOOST_CHECK(!replayMatch(game, { 0, 1, 0, {}, MatchResult::Stopped }).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(IllegalMove) {
+    Acores game;
+    // Moves from empty square at grid center
+    const LoggedMatch match { 0, 1, 0, { { false, { 3, 3 }, { 3, 4 } } }, MatchResult::Stopped };
+
+    const std::optional<ReplayDivergence> divergence { replayMatch(game, match) };
+    BOOST_REQUIRE(divergence.has_value());
+    BOOST_CHECK_EQUAL(divergence->action, 0);
+}
+
+BOOST_AUTO_TEST_CASE(RoundEndWithoutMove) {
+    Acores game;
+    const LoggedMatch match { 0, 1, 0, { { true, {}, {} } }, MatchResult::Stopped };
+
+    const std::optional<ReplayDivergence> divergence { replayMatch(game, match) };
+    BOOST_REQUIRE(divergence.has_value());
+    BOOST_CHECK_EQUAL(divergence->action, 0);
+}
+
+BOOST_AUTO_TEST_CASE(DifferentResult) {
+    LoggedMatch match { generateMatch() };
+    // Any other result than the one reached by game
+    match.result = match.result == MatchResult::Stopped ? MatchResult::WhiteVictory : MatchResult::Stopped;
+    Acores game;
+
+    const std::optional<ReplayDivergence> divergence { replayMatch(game, match) };
+    BOOST_REQUIRE(divergence.has_value());
+    BOOST_CHECK_EQUAL(divergence->action, match.actions.size());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
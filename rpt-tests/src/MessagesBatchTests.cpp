@@ -0,0 +1,73 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Network/MessagesBatch.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Pool for every message used by these tests, must outlive them
+MessagesPool test_messages_pool;
+
+
+MessageBuffer rptlMessage(const std::string_view message) {
+    return test_messages_pool.acquire(message);
+}
+
+/// Concatenates every buffer inside batch sequence to retrieve the actually written frame
+std::string frameFor(const MessagesBatch& batch) {
+    std::string frame;
+
+    for (const boost::asio::const_buffer& buffer : batch.buffers())
+        frame.append(static_cast<const char*>(buffer.data()), buffer.size());
+
+    return frame;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(MessagesBatchTests)
+
+
+BOOST_AUTO_TEST_CASE(EmptyQueue) {
+    std::queue<MessageBuffer> messages_queue;
+    const MessagesBatch batch { messages_queue };
+
+    BOOST_CHECK_EQUAL(batch.count(), 0);
+    BOOST_CHECK(batch.buffers().empty());
+}
+
+BOOST_AUTO_TEST_CASE(ManyRptlMessages) {
+    std::queue<MessageBuffer> messages_queue {
+        std::deque<MessageBuffer> {
+            rptlMessage("LOGGED_IN 1 Alvis"), rptlMessage(""), rptlMessage("LOGGED_OUT 1")
+        }
+    };
+    const MessagesBatch batch { messages_queue };
+
+    // Every message must have been moved from queue into batch
+    BOOST_CHECK(messages_queue.empty());
+    BOOST_CHECK_EQUAL(batch.count(), 3);
+    // One header and one data buffer for each message
+    BOOST_CHECK_EQUAL(batch.buffers().size(), 6);
+    BOOST_CHECK_EQUAL(frameFor(batch), "17:LOGGED_IN 1 Alvis0:12:LOGGED_OUT 1");
+}
+
+BOOST_AUTO_TEST_CASE(BinaryEnvelope) {
+    std::queue<MessageBuffer> messages_queue {
+        std::deque<MessageBuffer> { rptlMessage("AB"), rptlMessage(std::string(200, 'C')) }
+    };
+    const MessagesBatch batch { messages_queue, MessagesBatch::Envelope::Binary };
+
+    // Sizes are varints without separator, 200 requires 2 bytes
+    BOOST_CHECK_EQUAL(frameFor(batch), "\x02" "AB" "\xC8\x01" + std::string(200, 'C'));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
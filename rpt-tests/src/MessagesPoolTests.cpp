@@ -0,0 +1,106 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <stdexcept>
+#include <vector>
+#include <RpT-Network/MessagesPool.hpp>
+
+
+using namespace RpT::Network;
+
+
+BOOST_AUTO_TEST_SUITE(MessagesPoolTests)
+
+
+BOOST_AUTO_TEST_CASE(EmptySlab) {
+    BOOST_CHECK_THROW(MessagesPool { 0 }, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyHandle) {
+    const MessageBuffer empty;
+
+    BOOST_CHECK(!empty);
+    BOOST_CHECK(empty.operator->() == nullptr);
+    BOOST_CHECK_EQUAL(empty.useCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SharedMessage) {
+    MessagesPool pool { 4 };
+
+    {
+        const MessageBuffer message { pool.acquire("LOGGED_IN 1 Alvis") };
+
+        BOOST_CHECK_EQUAL(*message, "LOGGED_IN 1 Alvis");
+        BOOST_CHECK_EQUAL(message.useCount(), 1);
+        BOOST_CHECK_EQUAL(pool.capacity(), 4); // First slab has been allocated
+        BOOST_CHECK_EQUAL(pool.inUse(), 1);
+
+        MessageBuffer copy { message };
+        BOOST_CHECK(copy == message);
+        BOOST_CHECK_EQUAL(message.useCount(), 2);
+
+        const MessageBuffer moved { std::move(copy) };
+        BOOST_CHECK(!copy);
+        BOOST_CHECK_EQUAL(message.useCount(), 2); // Moving doesn't take another reference
+
+        copy = moved;
+        copy = copy; // Self-assignment must not give message back
+        BOOST_CHECK_EQUAL(message.useCount(), 3);
+    }
+
+    BOOST_CHECK_EQUAL(pool.inUse(), 0); // Given back once every handle has been destroyed
+}
+
+BOOST_AUTO_TEST_CASE(Reserved) {
+    MessagesPool pool { 4 };
+
+    pool.reserve(9);
+    BOOST_CHECK_EQUAL(pool.capacity(), 12); // Whole slabs are allocated
+
+    {
+        std::vector<MessageBuffer> messages;
+        for (int i { 0 }; i < 12; i++)
+            messages.push_back(pool.acquire("A"));
+
+        BOOST_CHECK_EQUAL(pool.capacity(), 12); // Reserved storages used without allocating another slab
+
+        pool.reserve(4); // Already enough storages
+        BOOST_CHECK_EQUAL(pool.capacity(), 12);
+    }
+
+    BOOST_CHECK_EQUAL(pool.inUse(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RecycledStorage) {
+    MessagesPool pool { 2 };
+
+    const std::string* first_storage;
+    {
+        const MessageBuffer message { pool.acquire("A") };
+        first_storage = &*message;
+    }
+
+    // Last given back storage is the first one to be reused
+    const MessageBuffer recycled { pool.acquire("BC") };
+    BOOST_CHECK(&*recycled == first_storage);
+    BOOST_CHECK_EQUAL(*recycled, "BC");
+
+    const MessageBuffer second { pool.acquire("D") };
+    BOOST_CHECK(second != recycled);
+    BOOST_CHECK_EQUAL(pool.capacity(), 2);
+
+    const MessageBuffer third { pool.acquire("E") }; // Slab is full, another one is allocated
+    BOOST_CHECK_EQUAL(pool.capacity(), 4);
+    BOOST_CHECK_EQUAL(pool.inUse(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(HugeMessageFreed) {
+    MessagesPool pool { 1 };
+
+    pool.acquire(std::string(MessagesPool::MAX_RETAINED_CAPACITY + 1, 'A')); // Given back right away
+
+    const MessageBuffer small { pool.acquire("A") };
+    BOOST_CHECK_LE(small->capacity(), MessagesPool::MAX_RETAINED_CAPACITY);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
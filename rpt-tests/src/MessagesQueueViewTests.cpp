@@ -10,8 +10,12 @@ using namespace RpT::Network;
 namespace {
 
 
-std::shared_ptr<std::string> rptlMessage(std::string message) {
-    return std::make_shared<std::string>(std::move(message)); // Avoid useless copy for smart pointer initialization
+/// Pool for every message used by these tests, must outlive them
+MessagesPool test_messages_pool;
+
+
+MessageBuffer rptlMessage(const std::string_view message) {
+    return test_messages_pool.acquire(message);
 }
 
 
@@ -22,7 +26,7 @@ BOOST_AUTO_TEST_SUITE(MessagesQueueViewTests)
 
 
 BOOST_AUTO_TEST_CASE(EmptyQueue) {
-    std::queue<std::shared_ptr<std::string>> messages_queue;
+    std::queue<MessageBuffer> messages_queue;
     MessagesQueueView view { messages_queue };
 
     // Messages queue is empty
@@ -31,7 +35,7 @@ BOOST_AUTO_TEST_CASE(EmptyQueue) {
 }
 
 BOOST_AUTO_TEST_CASE(ManyRptlMessagesAfterCtor) {
-    std::queue<std::shared_ptr<std::string>> messages_queue;
+    std::queue<MessageBuffer> messages_queue;
     MessagesQueueView view { messages_queue };
 
     const auto firstMessage { rptlMessage("A") };
@@ -42,8 +46,8 @@ BOOST_AUTO_TEST_CASE(ManyRptlMessagesAfterCtor) {
 
     // Messages queue is not empty AFTER view construction
     BOOST_CHECK(view.hasNext());
-    BOOST_CHECK_EQUAL(view.next(), firstMessage); // Ptr identity check
-    BOOST_CHECK_EQUAL(view.next(), secondMessage);
+    BOOST_CHECK(view.next() == firstMessage); // Storage identity check
+    BOOST_CHECK(view.next() == secondMessage);
     BOOST_CHECK_THROW(view.next(), NoMoreMessage); // There were only 2 messages inside queue
 }
 
@@ -51,17 +55,44 @@ BOOST_AUTO_TEST_CASE(ManyRptlMessagesBeforeCtor) {
     const auto firstMessage { rptlMessage("A") };
     const auto secondMessage { rptlMessage("B") };
 
-    std::queue<std::shared_ptr<std::string>> messages_queue { // Constructed with non-empty underlying list (<=> deque)
-        std::deque<std::shared_ptr<std::string>> { firstMessage, secondMessage }
+    std::queue<MessageBuffer> messages_queue { // Constructed with non-empty underlying list (<=> deque)
+        std::deque<MessageBuffer> { firstMessage, secondMessage }
     };
     MessagesQueueView view { messages_queue };
 
     // Messages queue is not empty BEFORE and AFTER view construction
     BOOST_CHECK(view.hasNext());
-    BOOST_CHECK_EQUAL(view.next(), firstMessage); // Ptr identity check
-    BOOST_CHECK_EQUAL(view.next(), secondMessage);
+    BOOST_CHECK(view.next() == firstMessage); // Storage identity check
+    BOOST_CHECK(view.next() == secondMessage);
     BOOST_CHECK_THROW(view.next(), NoMoreMessage); // There were only 2 messages inside queue
 }
 
 
+BOOST_AUTO_TEST_CASE(CriticalLaneFirst) {
+    const auto firstMessage { rptlMessage("A") };
+    const auto secondMessage { rptlMessage("B") };
+    const auto thirdMessage { rptlMessage("C") };
+
+    std::queue<MessageBuffer> critical_queue;
+    std::queue<MessageBuffer> best_effort_queue;
+    MessagesQueueView view { critical_queue, best_effort_queue };
+
+    BOOST_CHECK(!view.hasNext());
+    BOOST_CHECK_THROW(view.nextPriority(), NoMoreMessage);
+
+    best_effort_queue.push(firstMessage);
+    critical_queue.push(secondMessage);
+    critical_queue.push(thirdMessage);
+
+    // Every critical message is consumed before best-effort one, even if it was pushed later
+    BOOST_CHECK(view.nextPriority() == MessagePriority::Critical);
+    BOOST_CHECK(view.next() == secondMessage);
+    BOOST_CHECK(view.next() == thirdMessage);
+    BOOST_CHECK(view.nextPriority() == MessagePriority::BestEffort);
+    BOOST_CHECK(view.next() == firstMessage);
+    BOOST_CHECK(!view.hasNext());
+    BOOST_CHECK_THROW(view.next(), NoMoreMessage);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <string>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http.hpp>
+#include <RpT-Network/MetricsEndpoint.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Provides an endpoint listening on a port chosen by system
+struct MetricsEndpointFixture {
+    RpT::Utils::LoggingContext logging_context;
+    RpT::Utils::RuntimeMetrics metrics;
+    RpT::Utils::PipelineLatencies latencies;
+    MetricsEndpoint endpoint;
+
+    MetricsEndpointFixture()
+    : endpoint { { boost::asio::ip::address_v4::loopback(), 0 }, metrics, disabled(logging_context), &latencies } {}
+
+    /// Disables given context before it is used by endpoint
+    static RpT::Utils::LoggingContext& disabled(RpT::Utils::LoggingContext& context) {
+        context.disable();
+
+        return context;
+    }
+
+    /// Sends a blocking request with given method and target, then retrieves response
+    boost::beast::http::response<boost::beast::http::string_body> request(const boost::beast::http::verb method,
+                                                                          const std::string& target) const {
+
+        boost::asio::io_context client_context;
+        boost::asio::ip::tcp::socket client_socket { client_context };
+        client_socket.connect({ boost::asio::ip::address_v4::loopback(), endpoint.localPort() });
+
+        boost::beast::http::request<boost::beast::http::empty_body> scrape_request { method, target, 11 };
+        boost::beast::http::write(client_socket, scrape_request);
+
+        boost::beast::flat_buffer read_buffer;
+        boost::beast::http::response<boost::beast::http::string_body> response;
+        boost::beast::http::read(client_socket, read_buffer, response);
+
+        return response;
+    }
+};
+
+
+}
+
+
+BOOST_FIXTURE_TEST_SUITE(MetricsEndpointTests, MetricsEndpointFixture)
+
+
+BOOST_AUTO_TEST_CASE(Scrape) {
+    metrics.clientConnected(0);
+    metrics.inputEventHandled();
+    latencies.record(RpT::Utils::PipelineStage::Parse, std::chrono::nanoseconds { 5 });
+
+    const auto response { request(boost::beast::http::verb::get, std::string { MetricsEndpoint::METRICS_TARGET }) };
+
+    BOOST_CHECK_EQUAL(response.result(), boost::beast::http::status::ok);
+    BOOST_CHECK_EQUAL(response[boost::beast::http::field::content_type], "text/plain; version=0.0.4; charset=utf-8");
+    BOOST_CHECK_NE(response.body().find("rpt_connected_clients 1\n"), std::string::npos);
+    BOOST_CHECK_NE(response.body().find("rpt_input_events_total 1\n"), std::string::npos);
+    BOOST_CHECK_NE(response.body().find("rpt_pipeline_latency_ns_count{stage=\"parse\"} 1\n"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Status) {
+    metrics.actorsLimit(2);
+    metrics.actorRegistered();
+    metrics.occupiedRooms(1);
+    metrics.loopLoad(0.5, false);
+
+    // Not listening for clients yet
+    BOOST_CHECK_EQUAL(request(boost::beast::http::verb::get, std::string { MetricsEndpoint::STATUS_TARGET }).result(),
+                      boost::beast::http::status::service_unavailable);
+
+    metrics.serverReady();
+    const auto response { request(boost::beast::http::verb::get, std::string { MetricsEndpoint::STATUS_TARGET }) };
+
+    BOOST_CHECK_EQUAL(response.result(), boost::beast::http::status::ok);
+    BOOST_CHECK_EQUAL(response[boost::beast::http::field::content_type], "application/json");
+    BOOST_CHECK_EQUAL(response.body(), "{\"actors\":1,\"limit\":2,\"rooms\":1,\"saturation\":0.5}");
+
+    // Full server can't be given any other client
+    metrics.actorRegistered();
+    BOOST_CHECK_EQUAL(request(boost::beast::http::verb::get, std::string { MetricsEndpoint::STATUS_TARGET }).result(),
+                      boost::beast::http::status::service_unavailable);
+
+    // Nor overloaded one
+    metrics.actorUnregistered();
+    metrics.loopLoad(0.99, true);
+    BOOST_CHECK_EQUAL(request(boost::beast::http::verb::get, std::string { MetricsEndpoint::STATUS_TARGET }).result(),
+                      boost::beast::http::status::service_unavailable);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownTarget) {
+    const auto response { request(boost::beast::http::verb::get, "/") };
+
+    BOOST_CHECK_EQUAL(response.result(), boost::beast::http::status::not_found);
+}
+
+BOOST_AUTO_TEST_CASE(BadMethod) {
+    const auto response { request(boost::beast::http::verb::post, std::string { MetricsEndpoint::METRICS_TARGET }) };
+
+    BOOST_CHECK_EQUAL(response.result(), boost::beast::http::status::method_not_allowed);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
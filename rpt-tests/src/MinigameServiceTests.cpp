@@ -2,6 +2,8 @@
 #include <RpT-Testing/MinigamesServicesTestingUtils.hpp> // Required by BOOST_CHECK_EQUAL for operartor<<
 #include <RpT-Testing/SerTestingUtils.hpp> // Required by BOOST_CHECK_EQUAL for ServiceEvent operators
 
+#include <filesystem>
+#include <optional>
 #include <Minigames-Services/MinigameService.hpp>
 #include <RpT-Core/ServiceContext.hpp>
 
@@ -56,6 +58,21 @@ public:
         return isRoundTerminatedReturn;
     }
 
+    /// Copies mocked values and tracked calls
+    std::unique_ptr<BoardGame> clone() const override {
+        return std::make_unique<MockedBoardGame>(*this);
+    }
+
+    /// Moves are checked by `play()` mock, not by %Service
+    bool isLegal(const PawnMove&) const override {
+        return false;
+    }
+
+    /// Moves are checked by `play()` mock, not by %Service
+    std::vector<PawnMove> legalMoves() const override {
+        return {};
+    }
+
     /// Keeps track a method call has been performed and arguments used for this call, then call play() method mock,
     /// if any
     GridUpdate play(const Coordinates& from, const Coordinates& to) override {
@@ -108,6 +125,48 @@ public:
     } }, boardGame { nullptr } {}
 };
 
+/// Provides testing instance appending matches into a log inside temporary directory, removed after each test
+class LoggedBoardGameFixture {
+public:
+    const std::string logPath;
+    std::optional<MatchLogWriter> matchLog;
+    RpT::Core::ServiceContext context;
+    std::optional<MinigameService> service;
+    MockedBoardGame* boardGame;
+
+    LoggedBoardGameFixture()
+    : logPath { (std::filesystem::temp_directory_path() / "rpt-minigame-service-tests.bin").string() },
+    boardGame { nullptr } {
+        std::filesystem::remove(logPath);
+
+        matchLog.emplace(logPath);
+        service.emplace(context, [this]() {
+            auto mocked_board_game { std::make_unique<MockedBoardGame>() };
+            boardGame = mocked_board_game.get();
+
+            return mocked_board_game;
+        }, &*matchLog);
+    }
+
+    ~LoggedBoardGameFixture() {
+        std::filesystem::remove(logPath);
+    }
+
+    /// Waits for every appended match to be written, then retrieves them
+    std::vector<LoggedMatch> writtenMatches() {
+        matchLog.reset();
+
+        MatchLogReader reader { logPath };
+        std::vector<LoggedMatch> matches;
+
+        LoggedMatch match;
+        while (reader.next(match))
+            matches.push_back(match);
+
+        return matches;
+    }
+};
+
 
 }
 
@@ -222,6 +281,21 @@ BOOST_AUTO_TEST_CASE(BadActorUID) {
 }
 
 
+BOOST_AUTO_TEST_CASE(Snapshot) {
+    boardGame->makeMove();
+    boardGame->nextRound();
+    boardGame->whitePawns(3);
+    boardGame->blackPawns(2);
+
+    // Actor which isn't playing can ask for snapshot, even if it isn't its turn
+    BOOST_CHECK(service.handleRequestCommand(2, "SNAPSHOT"));
+
+    // Whole game state inside one event sent to requesting actor only, mocked grid has a single free square
+    BOOST_CHECK_EQUAL(service.pollEvent(), (RpT::Core::ServiceEvent { "SNAPSHOT 0 1 BLACK 3 2 1 1 F", { { 2 } } }));
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+
 /*
  * End command unit test
  */
@@ -344,10 +418,158 @@ BOOST_AUTO_TEST_CASE(StillInsideRound) {
 BOOST_AUTO_TEST_SUITE_END()
 
 
+/*
+ * GRID_DELTA capability unit tests
+ */
+BOOST_AUTO_TEST_SUITE(GridDelta)
+
+
+BOOST_AUTO_TEST_CASE(EnabledByEveryPlayer) {
+    boardGame->playReturn = {
+            {
+                { Coordinates { 2, 3 }, Square::Free },
+                { Coordinates { 5, 5 }, Square::White }
+            },
+            { 3, 3 }, { 1, 3 }
+    };
+    boardGame->playCallRoutine = [this]() {
+        boardGame->makeMove();
+
+        boardGame->whitePawns(12);
+        boardGame->blackPawns(11);
+    };
+
+    // Capability can be enabled even if it isn't actor round, without any event
+    BOOST_CHECK(service.handleRequestCommand(BLACK_PLAYER_ACTOR, "GRID_DELTA"));
+    BOOST_CHECK(service.handleRequestCommand(WHITE_PLAYER_ACTOR, "GRID_DELTA"));
+    BOOST_CHECK(!service.checkEvent().has_value());
+
+    BOOST_CHECK(service.handleRequestCommand(WHITE_PLAYER_ACTOR, "MOVE 1 2 3 4"));
+
+    // Move and every updated square inside one event sent to everyone
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent { "GRID_DELTA 3 3 1 3 2 3 FREE 5 5 WHITE" });
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent { "PAWN_COUNTS 12 11" });
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(EnabledByOnePlayer) {
+    boardGame->playReturn = {
+            { { Coordinates { 2, 3 }, Square::Black } }, { 3, 3 }, { 1, 3 }
+    };
+    boardGame->playCallRoutine = [this]() {
+        boardGame->makeMove();
+
+        boardGame->whitePawns(12);
+        boardGame->blackPawns(12);
+    };
+
+    BOOST_CHECK(service.handleRequestCommand(BLACK_PLAYER_ACTOR, "GRID_DELTA"));
+    BOOST_CHECK(service.handleRequestCommand(WHITE_PLAYER_ACTOR, "MOVE 1 2 3 4"));
+
+    // Each player receives move with its own format
+    BOOST_CHECK_EQUAL(service.pollEvent(),
+                      (RpT::Core::ServiceEvent { "GRID_DELTA 3 3 1 3 2 3 BLACK", { { BLACK_PLAYER_ACTOR } } }));
+    BOOST_CHECK_EQUAL(service.pollEvent(),
+                      (RpT::Core::ServiceEvent { "SQUARE_STATE 2 3 BLACK", { { WHITE_PLAYER_ACTOR } } }));
+    BOOST_CHECK_EQUAL(service.pollEvent(),
+                      (RpT::Core::ServiceEvent { "MOVED 3 3 1 3", { { WHITE_PLAYER_ACTOR } } }));
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent { "PAWN_COUNTS 12 12" });
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(ForgottenActor) {
+    boardGame->playReturn = { {}, { 3, 3 }, { 1, 3 } };
+    boardGame->playCallRoutine = [this]() {
+        boardGame->makeMove();
+
+        boardGame->whitePawns(12);
+        boardGame->blackPawns(12);
+    };
+
+    BOOST_CHECK(service.handleRequestCommand(BLACK_PLAYER_ACTOR, "GRID_DELTA"));
+    BOOST_CHECK(service.handleRequestCommand(WHITE_PLAYER_ACTOR, "GRID_DELTA"));
+    service.forgetActor(BLACK_PLAYER_ACTOR);
+
+    BOOST_CHECK(service.handleRequestCommand(WHITE_PLAYER_ACTOR, "MOVE 1 2 3 4"));
+
+    BOOST_CHECK_EQUAL(service.pollEvent(),
+                      (RpT::Core::ServiceEvent { "GRID_DELTA 3 3 1 3", { { WHITE_PLAYER_ACTOR } } }));
+    BOOST_CHECK_EQUAL(service.pollEvent(),
+                      (RpT::Core::ServiceEvent { "MOVED 3 3 1 3", { { BLACK_PLAYER_ACTOR } } }));
+    BOOST_CHECK_EQUAL(service.pollEvent(), RpT::Core::ServiceEvent { "PAWN_COUNTS 12 12" });
+    BOOST_CHECK(!service.checkEvent().has_value());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
 BOOST_AUTO_TEST_SUITE_END()
 
 
+/*
+ * Finished matches logging unit tests
+ */
+BOOST_FIXTURE_TEST_SUITE(MatchLogging, LoggedBoardGameFixture)
+
+
+BOOST_AUTO_TEST_CASE(WonMatch) {
+    service->start(WHITE_PLAYER_ACTOR, BLACK_PLAYER_ACTOR);
+
+    // White player ends its round after a move, then black player wins with next move
+    boardGame->playCallRoutine = [this]() { boardGame->makeMove(); };
+    BOOST_CHECK(service->handleRequestCommand(WHITE_PLAYER_ACTOR, "MOVE 1 2 3 4"));
+    BOOST_CHECK(service->handleRequestCommand(WHITE_PLAYER_ACTOR, "END"));
+
+    boardGame->playCallRoutine = [this]() {
+        boardGame->victoryForReturn = Player::Black;
+        boardGame->makeMove();
+    };
+    BOOST_CHECK(service->handleRequestCommand(BLACK_PLAYER_ACTOR, "MOVE 5 6 7 8"));
+    BOOST_CHECK(!service->isStarted());
+
+    const std::vector<LoggedMatch> matches { writtenMatches() };
+    BOOST_REQUIRE_EQUAL(matches.size(), 1); // Logged once, even if game was stopped after victory
+
+    const LoggedMatch& match { matches.front() };
+    BOOST_CHECK_EQUAL(match.whiteActor, WHITE_PLAYER_ACTOR);
+    BOOST_CHECK_EQUAL(match.blackActor, BLACK_PLAYER_ACTOR);
+    BOOST_CHECK(match.result == MatchResult::BlackVictory);
+
+    BOOST_REQUIRE_EQUAL(match.actions.size(), 3);
+    BOOST_CHECK(!match.actions[0].roundEnd);
+    BOOST_CHECK_EQUAL(match.actions[0].from, (Coordinates { 1, 2 }));
+    BOOST_CHECK_EQUAL(match.actions[0].to, (Coordinates { 3, 4 }));
+    BOOST_CHECK(match.actions[1].roundEnd);
+    BOOST_CHECK(!match.actions[2].roundEnd);
+    BOOST_CHECK_EQUAL(match.actions[2].from, (Coordinates { 5, 6 }));
+    BOOST_CHECK_EQUAL(match.actions[2].to, (Coordinates { 7, 8 }));
+}
+
+BOOST_AUTO_TEST_CASE(StoppedMatches) {
+    service->start(WHITE_PLAYER_ACTOR, BLACK_PLAYER_ACTOR);
+    // Round can't be ended without any move, so nothing is logged for this command
+    BOOST_CHECK_THROW(service->handleRequestCommand(WHITE_PLAYER_ACTOR, "END"), MoveRequired);
+    service->stop();
+
+    // Actions from previous match aren't kept
+    service->start(BLACK_PLAYER_ACTOR, WHITE_PLAYER_ACTOR);
+    service->stop();
+
+    const std::vector<LoggedMatch> matches { writtenMatches() };
+    BOOST_REQUIRE_EQUAL(matches.size(), 2);
+
+    BOOST_CHECK(matches[0].result == MatchResult::Stopped);
+    BOOST_CHECK(matches[0].actions.empty());
+    BOOST_CHECK_EQUAL(matches[1].whiteActor, BLACK_PLAYER_ACTOR);
+    BOOST_CHECK(matches[1].result == MatchResult::Stopped);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -30,5 +30,9 @@ std::ostream& operator<<(std::ostream& out, const SquareUpdate& square_update) {
     return out << "Coords={" << square_update.square << "} State=" << square_update.updatedState;
 }
 
+std::ostream& operator<<(std::ostream& out, const PawnMove& move) {
+    return out << "From={" << move.from << "} To={" << move.to << "}";
+}
+
 
 }
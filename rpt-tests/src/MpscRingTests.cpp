@@ -0,0 +1,107 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <RpT-Network/MpscRing.hpp>
+
+
+using namespace RpT::Network;
+
+
+BOOST_AUTO_TEST_SUITE(MpscRingTests)
+
+
+BOOST_AUTO_TEST_CASE(CapacityRounded) {
+    BOOST_CHECK_THROW(MpscRing<int> { 0 }, std::invalid_argument);
+
+    BOOST_CHECK_EQUAL(MpscRing<int> { 1 }.capacity(), 1);
+    BOOST_CHECK_EQUAL(MpscRing<int> { 5 }.capacity(), 8);
+    BOOST_CHECK_EQUAL(MpscRing<int> { 64 }.capacity(), 64);
+}
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    MpscRing<int> ring { 4 };
+
+    BOOST_CHECK(!ring.tryPop().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(PushOrder) {
+    MpscRing<int> ring { 4 };
+
+    // Wraps around ring many times
+    for (int lap { 0 }; lap < 3; lap++) {
+        for (int value { 0 }; value < 4; value++)
+            BOOST_CHECK(ring.tryPush(value));
+
+        for (int value { 0 }; value < 4; value++)
+            BOOST_CHECK_EQUAL(*ring.tryPop(), value);
+
+        BOOST_CHECK(!ring.tryPop().has_value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Full) {
+    MpscRing<std::unique_ptr<int>> ring { 2 };
+
+    auto first { std::make_unique<int>(1) };
+    auto second { std::make_unique<int>(2) };
+    auto third { std::make_unique<int>(3) };
+
+    BOOST_CHECK(ring.tryPush(first));
+    BOOST_CHECK(ring.tryPush(second));
+    BOOST_CHECK(!ring.tryPush(third));
+    BOOST_CHECK(third); // Not moved as push failed
+
+    BOOST_CHECK_EQUAL(**ring.tryPop(), 1);
+    BOOST_CHECK(ring.tryPush(third)); // Cell was freed
+    BOOST_CHECK_EQUAL(**ring.tryPop(), 2);
+    BOOST_CHECK_EQUAL(**ring.tryPop(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(ManyProducers) {
+    constexpr std::size_t PRODUCERS { 4 };
+    constexpr std::size_t VALUES_PER_PRODUCER { 20000 };
+
+    // Small ring, so producers are often blocked by a full ring
+    MpscRing<std::pair<std::size_t, std::size_t>> ring { 64 };
+
+    std::vector<std::thread> producers;
+    for (std::size_t producer { 0 }; producer < PRODUCERS; producer++) {
+        producers.emplace_back([&ring, producer]() {
+            for (std::size_t value { 0 }; value < VALUES_PER_PRODUCER; value++) {
+                std::pair<std::size_t, std::size_t> pushed_value { producer, value };
+
+                while (!ring.tryPush(pushed_value))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Each producer values must be polled in their push order, none being lost
+    std::vector<std::size_t> next_values(PRODUCERS, 0);
+    std::size_t polled_count { 0 };
+    while (polled_count < PRODUCERS * VALUES_PER_PRODUCER) {
+        const auto polled_value { ring.tryPop() };
+        if (!polled_value.has_value()) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto [producer, value] { *polled_value };
+        BOOST_REQUIRE_EQUAL(value, next_values[producer]);
+
+        next_values[producer]++;
+        polled_count++;
+    }
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    BOOST_CHECK(!ring.tryPop().has_value());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
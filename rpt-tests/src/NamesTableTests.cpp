@@ -0,0 +1,72 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <string>
+#include <RpT-Utils/NamesTable.hpp>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(NamesTableTests)
+
+
+BOOST_AUTO_TEST_CASE(InsertUniqueNames) {
+    NamesTable names;
+
+    const auto alvis { names.insert("Alvis") };
+    const auto bob { names.insert("Bob") };
+
+    BOOST_REQUIRE(alvis.has_value() && bob.has_value());
+    BOOST_CHECK_NE(*alvis, *bob);
+
+    BOOST_CHECK_EQUAL(names.name(*alvis), "Alvis");
+    BOOST_CHECK_EQUAL(names.name(*bob), "Bob");
+    BOOST_CHECK_EQUAL(names.size(), 2);
+
+    BOOST_CHECK(names.contains("Alvis"));
+    BOOST_CHECK(!names.contains("Carl"));
+}
+
+BOOST_AUTO_TEST_CASE(NameAlreadyTaken) {
+    NamesTable names;
+    names.insert("Alvis");
+
+    BOOST_CHECK(!names.insert("Alvis").has_value());
+    BOOST_CHECK_EQUAL(names.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(EraseMakesNameAvailable) {
+    NamesTable names;
+
+    const auto alvis { *names.insert("Alvis") };
+    names.insert("Bob");
+
+    names.erase(alvis);
+    BOOST_CHECK(!names.contains("Alvis"));
+    BOOST_CHECK_EQUAL(names.size(), 1);
+
+    // Erased ID is reused, with new name data
+    const auto carl { names.insert("Carl") };
+    BOOST_REQUIRE(carl.has_value());
+    BOOST_CHECK_EQUAL(*carl, alvis);
+    BOOST_CHECK_EQUAL(names.name(*carl), "Carl");
+
+    BOOST_CHECK(names.insert("Alvis").has_value());
+    BOOST_CHECK(names.contains("Bob"));
+}
+
+BOOST_AUTO_TEST_CASE(ManyNames) {
+    NamesTable names;
+
+    // Longer than SSO buffer, so stored data must not move while table grows
+    for (int i { 0 }; i < 1000; i++)
+        BOOST_REQUIRE(names.insert("LongEnoughPlayerName_" + std::to_string(i)).has_value());
+
+    for (int i { 0 }; i < 1000; i++) {
+        BOOST_CHECK(names.contains("LongEnoughPlayerName_" + std::to_string(i)));
+        BOOST_CHECK_EQUAL(names.name(static_cast<NamesTable::NameId>(i)), "LongEnoughPlayerName_" + std::to_string(i));
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,8 +1,11 @@
 #include <RpT-Testing/TestingUtils.hpp>
 
 #include <array>
+#include <chrono>
 #include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <RpT-Core/ServiceEvent.hpp>
@@ -34,10 +37,10 @@ constexpr int inputIndexFor() {
 template<typename ExpectedEventT>
 ExpectedEventT requireEventType(RpT::Core::AnyInputEvent event_variant) {
     // Checks for type ID before of given variant
-    BOOST_REQUIRE_EQUAL(event_variant.which(), inputIndexFor<ExpectedEventT>());
+    BOOST_REQUIRE_EQUAL(event_variant.index(), inputIndexFor<ExpectedEventT>());
 
     // Move constructs typed event from event variant which will no longer be used
-    return boost::get<ExpectedEventT>(std::move(event_variant));
+    return std::get<ExpectedEventT>(std::move(event_variant));
 }
 
 
@@ -87,7 +90,7 @@ protected:
 
 public:
     /// Where `syncClient()` calls save remaining messages queue, public so it can be asserted
-    std::unordered_map<std::uint64_t, std::queue<std::shared_ptr<std::string>>> messages_queues;
+    std::unordered_map<std::uint64_t, std::queue<MessageBuffer>> messages_queues;
 
     /// Initializes backend with client actor 0 for `waitForEvent()` return value and unregistered client 1 for
     /// testing purpose. Actors number limit is 3.
@@ -138,6 +141,11 @@ public:
         return isAlive(actor_uid);
     }
 
+    /// Checks if given client has a registered actor or not, trivial access to hasActor() for testing purpose
+    bool loggedIn(const std::uint64_t client_token) const {
+        return hasActor(client_token);
+    }
+
     /// Trivial access to addClient() for testing purpose
     void newClient(const std::uint64_t new_token) {
         addClient(new_token);
@@ -153,6 +161,23 @@ public:
         killClient(client_token, disconnnection_reason);
     }
 
+    /// Trivial access to loseClient() for testing purpose
+    void lose(const std::uint64_t client_token, const RpT::Utils::HandlingResult& disconnnection_reason) {
+        loseClient(client_token, disconnnection_reason);
+    }
+
+    /// Sends `SESSION` from given registered client, then retrieves secret from server reply
+    std::string enableSession(const std::uint64_t client_token) {
+        clientMessage(client_token, "SESSION");
+        synchronize();
+
+        auto& client_queue { messages_queues.at(client_token) };
+        const std::string session_message { *client_queue.front() };
+        client_queue.pop();
+
+        return session_message.substr(session_message.find(' ') + 1);
+    }
+
     /// Trivial access to disconnectionReason() for testing purpose
     const RpT::Utils::HandlingResult& killReason(const std::uint64_t client_token) {
         return disconnectionReason(client_token);
@@ -163,6 +188,11 @@ public:
         synchronize();
     }
 
+    /// Trivial access to pollKilledClients() for testing purpose
+    std::vector<std::uint64_t> killedClients() {
+        return pollKilledClients();
+    }
+
     // No responsiblity without Executor
     void beginTimer(RpT::Core::Timer&) override {
         throw std::runtime_error { "Not implemented" };
@@ -170,6 +200,37 @@ public:
 };
 
 
+/**
+ * @brief `SimpleNetworkBackend` spinning with busy-poll before blocking, ready IO operations being simulated
+ */
+class SpinningNetworkBackend : public SimpleNetworkBackend {
+protected:
+    /// Timer event is triggered by polls count given at construction, if any
+    void pollReadyEvents() override {
+        if (++polls_count == ready_at_poll)
+            trigger(RpT::Core::TimerEvent { CONSOLE_ACTOR, 42 });
+    }
+
+    /// Spins for an event to be ready, else `NoneEvent` is triggered as if blocking wait returned
+    void waitForEvent() override {
+        spinForEvent();
+
+        if (!inputReady())
+            SimpleNetworkBackend::waitForEvent();
+    }
+
+public:
+    /// Number of `pollReadyEvents()` calls
+    std::size_t polls_count;
+    /// `pollReadyEvents()` call triggering timer event, `0` if never triggered
+    const std::size_t ready_at_poll;
+
+    /// Initializes backend triggering a timer event at given poll
+    explicit SpinningNetworkBackend(const std::size_t timer_ready_at_poll)
+    : polls_count { 0 }, ready_at_poll { timer_ready_at_poll } {}
+};
+
+
 BOOST_AUTO_TEST_SUITE(NetworkBackendTests)
 
 /*
@@ -251,6 +312,73 @@ BOOST_AUTO_TEST_CASE(ManyQueuedEvents) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * busyPoll() unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(BusyPoll)
+
+BOOST_AUTO_TEST_CASE(Disabled) {
+    SpinningNetworkBackend io_interface { 1 };
+
+    // Without busy-poll, blocking wait is done directly
+    requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput());
+    BOOST_CHECK_EQUAL(io_interface.polls_count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ReadyWhileSpinning) {
+    SpinningNetworkBackend io_interface { 3 };
+    io_interface.busyPoll(std::chrono::seconds { 10 });
+
+    // Spinning stops as soon as an event has been pushed, long before window elapsed
+    const auto event { requireEventType<RpT::Core::TimerEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.token(), 42);
+    BOOST_CHECK_EQUAL(io_interface.polls_count, 3);
+}
+
+BOOST_AUTO_TEST_CASE(WindowElapsed) {
+    SpinningNetworkBackend io_interface { 0 };
+    io_interface.busyPoll(std::chrono::milliseconds { 1 });
+
+    // Nothing became ready while spinning, so blocking wait is done once window elapsed
+    requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput());
+    BOOST_CHECK_GT(io_interface.polls_count, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * recordLatencies() unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(RecordLatencies)
+
+BOOST_AUTO_TEST_CASE(Disabled) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 0 Chat Hello");
+
+    // Event isn't stamped if latencies aren't recorded
+    const auto event { requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK(event.receivedAt() == std::chrono::steady_clock::time_point {});
+}
+
+BOOST_AUTO_TEST_CASE(Enabled) {
+    RpT::Utils::PipelineLatencies latencies;
+    SimpleNetworkBackend io_interface;
+    io_interface.recordLatencies(latencies);
+
+    const auto before_message { std::chrono::steady_clock::now() };
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 0 Chat Hello");
+
+    // Event is stamped at handling beginning, as no receive time point was given
+    const auto event { requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK(event.receivedAt() >= before_message);
+    BOOST_CHECK_EQUAL(latencies.stage(RpT::Utils::PipelineStage::Parse).count(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /*
  * replyTo() unit tests
  */
@@ -278,6 +406,21 @@ BOOST_AUTO_TEST_CASE(UnknownActor) {
     BOOST_CHECK_THROW(io_interface.replyTo(42, ""), UnknownActorUID);
 }
 
+BOOST_AUTO_TEST_CASE(FormattedInsideArena) {
+    SimpleNetworkBackend io_interface;
+    RpT::Utils::IterationArena arena { 1024 };
+    io_interface.useIterationArena(arena);
+
+    io_interface.replyTo(CONSOLE_ACTOR, "Some SRR thing");
+    arena.reset(); // Queued message doesn't depend on arena memory
+    io_interface.sync();
+
+    const auto& console_messages_queue { io_interface.messages_queues.at(CONSOLE_CLIENT) };
+    BOOST_CHECK_EQUAL(console_messages_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*console_messages_queue.front(), "SERVICE Some SRR thing");
+    BOOST_CHECK_EQUAL(arena.overflows(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -305,6 +448,46 @@ BOOST_AUTO_TEST_CASE(AnyServiceEvent) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(BroadcastSharedWithActorsOnly) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.outputEvent(RpT::Core::ServiceEvent { "Some SE thing" });
+    // Flushes messages queue for each client
+    io_interface.sync();
+
+    // Unregistered testing client must not receive anything
+    BOOST_CHECK(io_interface.messages_queues.at(TEST_CLIENT).empty());
+
+    // Every registered client must share the same message data
+    const auto& console_queue { io_interface.messages_queues.at(CONSOLE_CLIENT) };
+    const auto& registered_test_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_CHECK(console_queue.front() == registered_test_queue.front());
+    BOOST_CHECK_EQUAL(console_queue.front().useCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(BestEffortAfterCritical) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.outputEvent(RpT::Core::ServiceEvent { "Chat A" }.asBestEffort());
+    io_interface.outputEvent(RpT::Core::ServiceEvent { "Game A" });
+    io_interface.outputEvent(
+            RpT::Core::ServiceEvent { "Chat B", RpT::Core::ActorUidsSet { CONSOLE_ACTOR } }.asBestEffort());
+    io_interface.outputEvent(RpT::Core::ServiceEvent { "Game B" });
+    // Flushes messages queue for each client
+    io_interface.sync();
+
+    // Critical messages come first, order being kept inside each priority class
+    auto& messages_queue { io_interface.messages_queues.at(CONSOLE_CLIENT) };
+    BOOST_REQUIRE_EQUAL(messages_queue.size(), 4);
+
+    for (const std::string_view expected_message :
+            { "SERVICE Game A", "SERVICE Game B", "SERVICE Chat A", "SERVICE Chat B" }) {
+
+        BOOST_CHECK_EQUAL(*messages_queue.front(), expected_message);
+        messages_queue.pop();
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -331,6 +514,32 @@ BOOST_AUTO_TEST_CASE(UnavailableToken) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * hasActor() unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(HasActor)
+
+BOOST_AUTO_TEST_CASE(UnknownClient) {
+    SimpleNetworkBackend io_interface;
+
+    BOOST_CHECK_THROW(io_interface.loggedIn(42), UnknownClientToken);
+}
+
+BOOST_AUTO_TEST_CASE(UnregisteredAndRegistered) {
+    SimpleNetworkBackend io_interface;
+
+    BOOST_CHECK(!io_interface.loggedIn(TEST_CLIENT));
+    BOOST_CHECK(io_interface.loggedIn(REGISTERED_TEST_CLIENT));
+
+    // Once test client logged in, it should have an actor too
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN " + std::to_string(TEST_ACTOR) + " Test");
+
+    BOOST_CHECK(io_interface.loggedIn(TEST_CLIENT));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /*
  * killClient() unit tests
  */
@@ -459,6 +668,57 @@ BOOST_AUTO_TEST_CASE(ErrorDisconnection) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * pollKilledClients() unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(PollKilledClients)
+
+BOOST_AUTO_TEST_CASE(NoKilledClient) {
+    SimpleNetworkBackend io_interface;
+
+    BOOST_CHECK(io_interface.killedClients().empty());
+}
+
+BOOST_AUTO_TEST_CASE(RegisteredAndUnregistered) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.kill(TEST_CLIENT);
+    io_interface.kill(CONSOLE_CLIENT);
+    io_interface.kill(TEST_CLIENT); // Already dead, must not be retrieved twice
+
+    const std::vector<std::uint64_t> expected_killed_clients { TEST_CLIENT, CONSOLE_CLIENT };
+    const std::vector<std::uint64_t> killed_clients { io_interface.killedClients() };
+    BOOST_CHECK_EQUAL_COLLECTIONS(killed_clients.cbegin(), killed_clients.cend(),
+                                  expected_killed_clients.cbegin(), expected_killed_clients.cend());
+
+    // Clients have been polled, they must not be retrieved again
+    BOOST_CHECK(io_interface.killedClients().empty());
+}
+
+BOOST_AUTO_TEST_CASE(LogoutCommand) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "LOGOUT");
+
+    const std::vector<std::uint64_t> expected_killed_clients { REGISTERED_TEST_CLIENT };
+    const std::vector<std::uint64_t> killed_clients { io_interface.killedClients() };
+    BOOST_CHECK_EQUAL_COLLECTIONS(killed_clients.cbegin(), killed_clients.cend(),
+                                  expected_killed_clients.cbegin(), expected_killed_clients.cend());
+}
+
+BOOST_AUTO_TEST_CASE(RemovedBeforePolling) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.kill(TEST_CLIENT);
+    io_interface.deleteClient(TEST_CLIENT);
+
+    // Removed client must not be retrieved as its token might be used again
+    BOOST_CHECK(io_interface.killedClients().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /*
  * closePipelineWith() unit tests
  */
@@ -543,6 +803,262 @@ BOOST_AUTO_TEST_CASE(Crash) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * SESSION and RESUME sessions resumption unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(SessionResumption)
+
+BOOST_AUTO_TEST_CASE(SameSecretSentAgain) {
+    SimpleNetworkBackend io_interface;
+
+    const std::string secret { io_interface.enableSession(REGISTERED_TEST_CLIENT) };
+    BOOST_CHECK(!secret.empty());
+    BOOST_CHECK_EQUAL(io_interface.enableSession(REGISTERED_TEST_CLIENT), secret);
+
+    // Capability doesn't modify server state
+    const auto event { requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), REGISTERED_TEST_ACTOR);
+}
+
+BOOST_AUTO_TEST_CASE(LostWithoutGrace) {
+    SimpleNetworkBackend io_interface;
+    io_interface.enableSession(REGISTERED_TEST_CLIENT);
+    io_interface.waitForInput(); // SESSION command NoneEvent
+
+    io_interface.lose(REGISTERED_TEST_CLIENT, RpT::Utils::HandlingResult { "Connection reset" });
+
+    // Resumption is disabled, so client is killed
+    BOOST_CHECK(!io_interface.registered(REGISTERED_TEST_ACTOR));
+    const auto left_event { requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(left_event.actor(), REGISTERED_TEST_ACTOR);
+    BOOST_CHECK_EQUAL(left_event.disconnectionReason().errorMessage(), "Connection reset");
+}
+
+BOOST_AUTO_TEST_CASE(LostWithoutSession) {
+    SimpleNetworkBackend io_interface;
+    io_interface.resumeSessions(std::chrono::minutes { 1 });
+
+    io_interface.lose(REGISTERED_TEST_CLIENT, RpT::Utils::HandlingResult { "Connection reset" });
+
+    // Client didn't enable SESSION, so it is killed
+    BOOST_CHECK(!io_interface.registered(REGISTERED_TEST_ACTOR));
+    requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput());
+}
+
+BOOST_AUTO_TEST_CASE(LostThenResumed) {
+    SimpleNetworkBackend io_interface;
+    io_interface.resumeSessions(std::chrono::minutes { 1 });
+    const std::string secret { io_interface.enableSession(REGISTERED_TEST_CLIENT) };
+    io_interface.waitForInput(); // SESSION command NoneEvent
+
+    io_interface.lose(REGISTERED_TEST_CLIENT, RpT::Utils::HandlingResult { "Connection reset" });
+
+    // Connection must be closed, but actor is still registered and didn't leave
+    BOOST_CHECK(!io_interface.alive(REGISTERED_TEST_CLIENT));
+    BOOST_CHECK(!io_interface.loggedIn(REGISTERED_TEST_CLIENT));
+    BOOST_CHECK(io_interface.registered(REGISTERED_TEST_ACTOR));
+    BOOST_CHECK_EQUAL(io_interface.killReason(REGISTERED_TEST_CLIENT).errorMessage(), "Connection reset");
+    BOOST_CHECK(!io_interface.ready());
+
+    const std::vector<std::uint64_t> killed_clients { io_interface.killedClients() };
+    BOOST_CHECK_EQUAL_COLLECTIONS(killed_clients.cbegin(), killed_clients.cend(),
+                                  &REGISTERED_TEST_CLIENT, &REGISTERED_TEST_CLIENT + 1);
+
+    // Messages for detached actor are kept, not synced
+    io_interface.outputEvent(RpT::Core::ServiceEvent { "Missed SE" });
+    io_interface.deleteClient(REGISTERED_TEST_CLIENT);
+    io_interface.sync();
+    BOOST_CHECK_EQUAL(io_interface.messages_queues.size(), 3); // Console, test and lost clients only
+
+    io_interface.newClient(3);
+    io_interface.clientMessage(3, "RESUME " + std::to_string(REGISTERED_TEST_ACTOR) + ' ' + secret);
+
+    // Actor never left, so it doesn't join again
+    const auto event { requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), REGISTERED_TEST_ACTOR);
+    BOOST_CHECK(io_interface.loggedIn(3));
+
+    io_interface.sync();
+
+    // Resumption confirmed before missed messages
+    auto& resumed_queue { io_interface.messages_queues.at(3) };
+    BOOST_REQUIRE_EQUAL(resumed_queue.size(), 2);
+    BOOST_CHECK_EQUAL(*resumed_queue.front(), "RESUMED");
+    resumed_queue.pop();
+    BOOST_CHECK_EQUAL(*resumed_queue.front(), "SERVICE Missed SE");
+
+    // Replies are now sent to new client
+    io_interface.replyTo(REGISTERED_TEST_ACTOR, "OK 0");
+    io_interface.sync();
+    BOOST_CHECK_EQUAL(*io_interface.messages_queues.at(3).back(), "SERVICE OK 0");
+}
+
+BOOST_AUTO_TEST_CASE(TakenOverBeforeLoss) {
+    SimpleNetworkBackend io_interface;
+    io_interface.resumeSessions(std::chrono::minutes { 1 });
+    const std::string secret { io_interface.enableSession(REGISTERED_TEST_CLIENT) };
+
+    // Server didn't detect previous connection as lost yet
+    io_interface.newClient(3);
+    io_interface.clientMessage(3, "RESUME " + std::to_string(REGISTERED_TEST_ACTOR) + ' ' + secret);
+
+    BOOST_CHECK(io_interface.loggedIn(3));
+    BOOST_CHECK(!io_interface.alive(REGISTERED_TEST_CLIENT));
+    BOOST_CHECK_EQUAL(io_interface.killReason(REGISTERED_TEST_CLIENT).errorMessage(),
+                      "Session resumed from another connection");
+}
+
+BOOST_AUTO_TEST_CASE(WrongSecret) {
+    SimpleNetworkBackend io_interface;
+    io_interface.resumeSessions(std::chrono::minutes { 1 });
+    const std::string secret { io_interface.enableSession(REGISTERED_TEST_CLIENT) };
+    io_interface.lose(REGISTERED_TEST_CLIENT, RpT::Utils::HandlingResult { "Connection reset" });
+
+    const std::uint64_t wrong_secret { std::stoull(secret) + 1 };
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "RESUME 10 " + std::to_string(wrong_secret)),
+                      InternalError);
+    // Console never enabled SESSION
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "RESUME 0 0"), InternalError);
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "RESUME 42 " + secret), InternalError);
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "RESUME 10"), BadClientMessage);
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "RESUME 10 secret"), BadClientMessage);
+
+    BOOST_CHECK(!io_interface.loggedIn(TEST_CLIENT));
+}
+
+BOOST_AUTO_TEST_CASE(GraceElapsed) {
+    SimpleNetworkBackend io_interface;
+    io_interface.resumeSessions(std::chrono::milliseconds { 1 });
+    io_interface.enableSession(REGISTERED_TEST_CLIENT);
+    io_interface.waitForInput(); // SESSION command NoneEvent
+
+    io_interface.lose(REGISTERED_TEST_CLIENT, RpT::Utils::HandlingResult { "Connection reset" });
+    io_interface.killedClients();
+    std::this_thread::sleep_for(std::chrono::milliseconds { 2 });
+    io_interface.sync();
+
+    // Detached actor is closed as if it was killed, without any connection to close
+    BOOST_CHECK(!io_interface.registered(REGISTERED_TEST_ACTOR));
+    BOOST_CHECK(io_interface.killedClients().empty());
+
+    const auto left_event { requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(left_event.actor(), REGISTERED_TEST_ACTOR);
+    BOOST_CHECK_EQUAL(left_event.disconnectionReason().errorMessage(), "Session expired");
+
+    const auto& console_queue { io_interface.messages_queues.at(CONSOLE_CLIENT) };
+    BOOST_REQUIRE_EQUAL(console_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*console_queue.front(), "LOGGED_OUT " + std::to_string(REGISTERED_TEST_ACTOR));
+}
+
+BOOST_AUTO_TEST_CASE(ResumedBeforeGraceElapsed) {
+    SimpleNetworkBackend io_interface;
+    io_interface.resumeSessions(std::chrono::milliseconds { 1 });
+    const std::string secret { io_interface.enableSession(REGISTERED_TEST_CLIENT) };
+    io_interface.waitForInput(); // SESSION command NoneEvent
+
+    io_interface.lose(REGISTERED_TEST_CLIENT, RpT::Utils::HandlingResult { "Connection reset" });
+    io_interface.newClient(3);
+    io_interface.clientMessage(3, "RESUME " + std::to_string(REGISTERED_TEST_ACTOR) + ' ' + secret);
+    io_interface.waitForInput(); // RESUME command NoneEvent
+
+    std::this_thread::sleep_for(std::chrono::milliseconds { 2 });
+    io_interface.sync();
+
+    // Deadline of detached record became due, but actor had already been resumed
+    BOOST_CHECK(io_interface.registered(REGISTERED_TEST_ACTOR));
+    BOOST_CHECK(io_interface.loggedIn(3));
+    BOOST_CHECK(io_interface.alive(3));
+    BOOST_CHECK(io_interface.messages_queues.at(CONSOLE_CLIENT).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * ROSTER_DELTA coalesced roster changes unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(RosterDelta)
+
+BOOST_AUTO_TEST_CASE(ChangesCoalescedUntilSync) {
+    SimpleNetworkBackend io_interface;
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "ROSTER_DELTA");
+
+    io_interface.clientMessage(CONSOLE_CLIENT, "LOGOUT");
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis");
+    io_interface.newClient(3);
+    io_interface.clientMessage(3, "LOGIN 43 Bob");
+
+    io_interface.sync();
+
+    // Every change inside a single message, in order
+    const auto& delta_client_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(delta_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*delta_client_queue.front(), "ROSTER_DELTA LOGGED_OUT " + std::to_string(CONSOLE_ACTOR)
+                                                   + " LOGGED_IN 42 Alvis LOGGED_IN 43 Bob");
+
+    // Other clients still receive a message for each change, while they are registered
+    auto& new_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(new_client_queue.size(), 3);
+    new_client_queue.pop(); // REGISTRATION message
+    BOOST_CHECK_EQUAL(*new_client_queue.front(), "LOGGED_IN 42 Alvis");
+    new_client_queue.pop();
+    BOOST_CHECK_EQUAL(*new_client_queue.front(), "LOGGED_IN 43 Bob");
+}
+
+BOOST_AUTO_TEST_CASE(DeltaSharedBetweenClients) {
+    SimpleNetworkBackend io_interface;
+    io_interface.clientMessage(CONSOLE_CLIENT, "ROSTER_DELTA");
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "ROSTER_DELTA");
+
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis");
+    io_interface.sync();
+
+    const auto& console_queue { io_interface.messages_queues.at(CONSOLE_CLIENT) };
+    const auto& test_client_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(console_queue.size(), 1);
+    BOOST_REQUIRE_EQUAL(test_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*console_queue.front(), "ROSTER_DELTA LOGGED_IN 42 Alvis");
+    BOOST_CHECK_EQUAL(&*console_queue.front(), &*test_client_queue.front()); // Formatted once
+}
+
+BOOST_AUTO_TEST_CASE(EnabledBetweenChanges) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.clientMessage(CONSOLE_CLIENT, "LOGOUT");
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "ROSTER_DELTA");
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis");
+
+    io_interface.sync();
+
+    // Change before capability was enabled isn't sent again
+    auto& test_client_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(test_client_queue.size(), 2);
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), "LOGGED_OUT " + std::to_string(CONSOLE_ACTOR));
+    test_client_queue.pop();
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), "ROSTER_DELTA LOGGED_IN 42 Alvis");
+
+    // Next flush only carries changes which happened since
+    test_client_queue.pop();
+    io_interface.clientMessage(TEST_CLIENT, "LOGOUT");
+    io_interface.sync();
+
+    BOOST_REQUIRE_EQUAL(test_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), "ROSTER_DELTA LOGGED_OUT 42");
+}
+
+BOOST_AUTO_TEST_CASE(NoChange) {
+    SimpleNetworkBackend io_interface;
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "ROSTER_DELTA");
+
+    io_interface.sync();
+
+    const auto& test_client_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_CHECK(test_client_queue.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /*
  * handleFromUnregistered() unit tests
  */
@@ -596,6 +1112,38 @@ BOOST_AUTO_TEST_CASE(LoginUid42NameAlvis) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(RegistrationAfterLogout) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis"); // Appended to cached roster
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "LOGOUT"); // Cached roster must be formatted again
+
+    io_interface.newClient(3);
+    io_interface.clientMessage(3, "LOGIN 43 Bob");
+
+    io_interface.sync();
+
+    const std::string& registration_message { *io_interface.messages_queues.at(3).front() };
+    std::istringstream registration_words { registration_message };
+
+    std::string command;
+    registration_words >> command;
+    BOOST_CHECK_EQUAL(command, "REGISTRATION");
+
+    // Roster order isn't specified, so actors are collected into a dictionary
+    std::unordered_map<std::uint64_t, std::string> registered_actors;
+    std::uint64_t actor_uid;
+    std::string actor_name;
+    while (registration_words >> actor_uid >> actor_name)
+        registered_actors.insert({ actor_uid, actor_name });
+
+    const std::unordered_map<std::uint64_t, std::string> expected_actors {
+        { CONSOLE_ACTOR, std::string { CONSOLE_NAME } }, { 42, "Alvis" }, { 43, "Bob" }
+    };
+
+    BOOST_CHECK(registered_actors == expected_actors);
+}
+
 BOOST_AUTO_TEST_CASE(LoginUid1MissingName) {
     SimpleNetworkBackend io_interface;
 
@@ -620,6 +1168,15 @@ BOOST_AUTO_TEST_CASE(LoginInvalidUid) {
     requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput());
 }
 
+BOOST_AUTO_TEST_CASE(LoginOutOfRangeUid) {
+    SimpleNetworkBackend io_interface;
+
+    // UID argument doesn't fit inside 64 bits
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "LOGIN 18446744073709551616 Alvis"), BadClientMessage);
+    BOOST_CHECK(io_interface.alive(TEST_CLIENT));
+    requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput());
+}
+
 BOOST_AUTO_TEST_CASE(LoginExtraArgs) {
     SimpleNetworkBackend io_interface;
 
@@ -656,6 +1213,26 @@ BOOST_AUTO_TEST_CASE(LoginServerFull) {
     requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput());
 }
 
+BOOST_AUTO_TEST_CASE(LoginOverloaded) {
+    SimpleNetworkBackend io_interface;
+    RpT::Utils::RuntimeMetrics metrics;
+    RpT::Utils::LoadMonitor load_monitor { 0.9, 1 };
+    io_interface.recordMetrics(metrics);
+    io_interface.shedLoad(load_monitor);
+
+    load_monitor.iterationDone({}, {}, 1); // Input queue reaches threshold
+
+    // Server isn't full, but new players are shed
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis"), InternalError);
+    BOOST_CHECK(!io_interface.registered(42));
+    BOOST_CHECK(io_interface.alive(TEST_CLIENT));
+    requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput());
+
+    std::ostringstream samples;
+    metrics.exportTo(samples);
+    BOOST_CHECK(samples.str().find("rpt_shed_handshakes_total 1\n") != std::string::npos);
+}
+
 BOOST_AUTO_TEST_CASE(Checkout) {
     SimpleNetworkBackend io_interface;
 
@@ -720,6 +1297,35 @@ BOOST_AUTO_TEST_CASE(ServiceCommandAnyRequest) {
     BOOST_CHECK_EQUAL(event.serviceRequest(), "Any SR command"); // With "Any SR command" args
 }
 
+BOOST_AUTO_TEST_CASE(ServiceCommandRateLimited) {
+    SimpleNetworkBackend io_interface;
+    RpT::Utils::RuntimeMetrics metrics;
+    io_interface.recordMetrics(metrics);
+    io_interface.limitRequests({ 0.001, 2 }); // Bucket isn't refilled during test
+
+    // Burst allows 2 commands, 3rd one is dropped
+    for (int i { 0 }; i < 3; i++)
+        io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 0 Chat Hi");
+
+    requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput());
+    requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput());
+    const auto dropped_event { requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(dropped_event.actor(), REGISTERED_TEST_ACTOR);
+
+    BOOST_REQUIRE(io_interface.requestsLimiter());
+    BOOST_CHECK_EQUAL(io_interface.requestsLimiter()->droppedFor(REGISTERED_TEST_ACTOR), 1);
+    BOOST_CHECK_EQUAL(io_interface.requestsLimiter()->droppedFor(CONSOLE_ACTOR), 0); // Each actor has its bucket
+
+    std::ostringstream samples;
+    metrics.exportTo(samples);
+    BOOST_CHECK(samples.str().find("rpt_rate_limited_requests_total 1\n") != std::string::npos);
+
+    // Other commands aren't limited
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "LOGOUT");
+    requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput());
+    BOOST_CHECK_EQUAL(io_interface.requestsLimiter()->droppedFor(REGISTERED_TEST_ACTOR), 0); // Bucket removed
+}
+
 BOOST_AUTO_TEST_CASE(ServiceCommandNoRequest) {
     SimpleNetworkBackend io_interface;
 
@@ -766,6 +1372,22 @@ BOOST_AUTO_TEST_CASE(LogoutCommandNoArgs) {
     BOOST_CHECK_EQUAL(*test_client_queue.front(), "LOGGED_OUT " + std::to_string(CONSOLE_ACTOR)); // Console left server
 }
 
+BOOST_AUTO_TEST_CASE(RosterDeltaCommandNoArgs) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.clientMessage(CONSOLE_CLIENT, "ROSTER_DELTA");
+
+    // Capability doesn't modify server state
+    const auto event { requireEventType<RpT::Core::NoneEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), CONSOLE_ACTOR);
+}
+
+BOOST_AUTO_TEST_CASE(RosterDeltaCommandExtraArgs) {
+    SimpleNetworkBackend io_interface;
+
+    BOOST_CHECK_THROW(io_interface.clientMessage(CONSOLE_CLIENT, "ROSTER_DELTA extra args"), BadClientMessage);
+}
+
 BOOST_AUTO_TEST_CASE(LogoutCommandExtraArgs) {
     SimpleNetworkBackend io_interface;
 
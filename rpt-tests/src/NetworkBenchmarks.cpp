@@ -0,0 +1,301 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <RpT-Core/ServiceEvent.hpp>
+#include <RpT-Core/Timer.hpp>
+#include <RpT-Network/NetworkBackend.hpp>
+#include <RpT-Network/SafeBeastWebsocketBackend.hpp>
+#include <RpT-Network/UnsafeBeastWebsocketBackend.hpp>
+
+#include <malloc.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+ * Network benchmarks suite, run it from a Release build. Results are written as JSON by `benchmarks-report` target.
+ *
+ * Broadcasting and registration message formatting are private to `NetworkBackend`, they are measured through
+ * `outputEvent()` and handshake handling which call them.
+ *
+ * Idle connections benchmarks run their clients inside a forked process, so only server memory is measured. They
+ * report memory held by each connection after a burst, once its read buffer has been released.
+ */
+
+
+using namespace RpT::Network;
+
+
+namespace {
+
+
+/// Backend with given number of registered actors, client N being kept for handshakes
+class BenchNetworkBackend : public NetworkBackend {
+protected:
+    /// Drops every queued message, as if it had been sent
+    void syncClient(std::uint64_t, MessagesQueueView client_messages_queue) override {
+        while (client_messages_queue.hasNext())
+            benchmark::DoNotOptimize(client_messages_queue.next());
+    }
+
+    void waitForEvent() override {
+        pushInputEvent(RpT::Core::NoneEvent { 0 });
+    }
+
+public:
+    explicit BenchNetworkBackend(const std::uint64_t actors_count) : NetworkBackend { actors_count + 1 } {
+        for (std::uint64_t actor { 0 }; actor < actors_count; actor++) {
+            addClient(actor);
+            handleMessage(actor, "LOGIN " + std::to_string(actor) + " Actor" + std::to_string(actor));
+        }
+
+        synchronize(); // Registrations messages aren't part of benchmarks
+    }
+
+    using NetworkBackend::synchronize;
+
+    // No timer is begun without Executor
+    void beginTimer(RpT::Core::Timer&) override {}
+
+    /// Connects client, registers it as an actor then logs it out and removes it
+    void handshakeThenLogout(const std::uint64_t client_token, const std::string& login_message) {
+        addClient(client_token);
+        benchmark::DoNotOptimize(handleMessage(client_token, login_message));
+        benchmark::DoNotOptimize(handleMessage(client_token, "LOGOUT"));
+        removeClient(client_token);
+    }
+};
+
+
+/// Broadcasts a SE to every registered actor, then syncs every client
+void OutputEventBroadcast(benchmark::State& state) {
+    const auto actors_count { static_cast<std::uint64_t>(state.range(0)) };
+    BenchNetworkBackend backend { actors_count };
+
+    for (auto _ : state) {
+        backend.outputEvent(RpT::Core::ServiceEvent { "EVENT Chat MESSAGE_FROM 0 Hello world" });
+        backend.synchronize();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * actors_count));
+}
+
+/// Registers a new actor, which formats registration message for every registered actor, then logs it out
+void HandshakeRegistration(benchmark::State& state) {
+    const auto actors_count { static_cast<std::uint64_t>(state.range(0)) };
+    BenchNetworkBackend backend { actors_count };
+
+    // New client uses next token and UID
+    const std::string login_message { "LOGIN " + std::to_string(actors_count) + " Newcomer" };
+
+    for (auto _ : state) {
+        backend.handshakeThenLogout(actors_count, login_message);
+        backend.synchronize();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Blocking client for WS connections
+using WsClientStream = boost::beast::websocket::stream<boost::asio::ip::tcp::socket>;
+/// Blocking client for WSS connections
+using WssClientStream = boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>>;
+
+/// Payload for the single large SR command each idle connection client sends before going idle
+constexpr std::size_t BURST_PAYLOAD_SIZE { 16 * 1024 };
+
+/// Resident memory of current process, in bytes
+std::size_t residentBytes() {
+    std::ifstream statm { "/proc/self/statm" };
+    std::size_t total_pages;
+    std::size_t resident_pages;
+    statm >> total_pages >> resident_pages;
+
+    return resident_pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+/// Heap memory currently allocated by current process, in bytes
+std::size_t heapBytes() {
+    return mallinfo2().uordblks;
+}
+
+/// Writes a self-signed certificate for localhost and its private key into given PEM files
+void writeSelfSignedCertificate(const std::string& certificate_file, const std::string& private_key_file) {
+    EVP_PKEY* const private_key { EVP_EC_gen("P-256") };
+    X509* const certificate { X509_new() };
+
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate), 3600);
+    X509_set_pubkey(certificate, private_key);
+
+    X509_NAME* const subject { X509_get_subject_name(certificate) };
+    X509_NAME_add_entry_by_txt(subject, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("localhost"),
+                               -1, -1, 0);
+    X509_set_issuer_name(certificate, subject);
+    X509_sign(certificate, private_key, EVP_sha256());
+
+    BIO* const certificate_output { BIO_new_file(certificate_file.c_str(), "w") };
+    PEM_write_bio_X509(certificate_output, certificate);
+    BIO_free(certificate_output);
+
+    BIO* const private_key_output { BIO_new_file(private_key_file.c_str(), "w") };
+    PEM_write_bio_PrivateKey(private_key_output, private_key, nullptr, nullptr, 0, nullptr, nullptr);
+    BIO_free(private_key_output);
+
+    X509_free(certificate);
+    EVP_PKEY_free(private_key);
+}
+
+/// Opens given number of clients to local server port read from given pipe, each one logging in then sending a
+/// burst, and keeps them open until a byte can be read from given pipe
+template<typename ClientStreamT>
+void runIdleClients(const std::size_t clients_count, const int port_pipe, const int done_pipe) {
+    std::uint16_t server_port;
+    if (read(port_pipe, &server_port, sizeof(server_port)) != sizeof(server_port))
+        return;
+
+    const boost::asio::ip::tcp::endpoint server_endpoint { boost::asio::ip::address_v4::loopback(), server_port };
+    const std::string burst_message { "SERVICE REQUEST 0 Bench " + std::string(BURST_PAYLOAD_SIZE, 'A') };
+
+    boost::asio::io_context clients_context;
+    boost::asio::ssl::context tls_context { boost::asio::ssl::context::tls_client }; // Only used by WSS clients
+    std::vector<std::unique_ptr<ClientStreamT>> clients;
+
+    for (std::size_t client { 0 }; client < clients_count; client++) {
+        std::unique_ptr<ClientStreamT> client_stream;
+        if constexpr (std::is_same_v<ClientStreamT, WsClientStream>) {
+            client_stream = std::make_unique<ClientStreamT>(clients_context);
+            client_stream->next_layer().connect(server_endpoint);
+        } else {
+            client_stream = std::make_unique<ClientStreamT>(clients_context, tls_context);
+            boost::beast::get_lowest_layer(*client_stream).connect(server_endpoint);
+            client_stream->next_layer().handshake(boost::asio::ssl::stream_base::client);
+        }
+
+        client_stream->handshake("localhost", "/");
+        client_stream->write(boost::asio::buffer("LOGIN " + std::to_string(client) + " Idle" + std::to_string(client)));
+        client_stream->write(boost::asio::buffer(burst_message));
+
+        clients.push_back(std::move(client_stream));
+    }
+
+    char done;
+    read(done_pipe, &done, 1);
+}
+
+/// Accepts given number of clients, forked into another process, into given backend, then reports server memory
+/// held by each connection once they are idle
+template<typename ClientStreamT, typename BackendT, typename... BackendArgs>
+void measureIdleConnections(benchmark::State& state, BackendArgs&&... backend_args) {
+    const auto clients_count { static_cast<std::size_t>(state.range(0)) };
+
+    for (auto _ : state) {
+        int port_pipe[2];
+        int done_pipe[2];
+        if (pipe(port_pipe) != 0 || pipe(done_pipe) != 0) {
+            state.SkipWithError("Unable to open pipes with clients process");
+            return;
+        }
+
+        // Forked before backend IO threads are started
+        const pid_t clients_process { fork() };
+        if (clients_process == 0) {
+            runIdleClients<ClientStreamT>(clients_count, port_pipe[0], done_pipe[0]);
+            _exit(0);
+        }
+
+        RpT::Utils::LoggingContext logging_context;
+        logging_context.disable();
+
+        BeastWebsocketBackendOptions options;
+        options.loginTimeout = std::chrono::minutes { 1 }; // Every client must be able to log in
+        BackendT backend { backend_args..., { boost::asio::ip::address_v4::loopback(), 0 }, logging_context, options,
+                           clients_count };
+
+        if constexpr (std::is_same_v<BackendT, SafeBeastWebsocketBackend>)
+            backend.waitTlsContext();
+
+        const std::size_t resident_before { residentBytes() };
+        const std::size_t heap_before { heapBytes() };
+
+        const std::uint16_t server_port { backend.localPort() };
+        write(port_pipe[1], &server_port, sizeof(server_port));
+
+        // Every client must have logged in and sent its burst
+        std::size_t remaining_events { 2 * clients_count };
+        while (remaining_events > 0) {
+            const RpT::Core::AnyInputEvent input_event { backend.waitForInput() };
+
+            if (std::holds_alternative<RpT::Core::JoinedEvent>(input_event)
+                || std::holds_alternative<RpT::Core::ServiceRequestEvent>(input_event)) {
+
+                remaining_events--;
+            } else if (std::holds_alternative<RpT::Core::LeftEvent>(input_event)) {
+                break;
+            }
+        }
+
+        // Gives time to connection strands to listen for next messages, so each read buffer is back to idle state
+        std::this_thread::sleep_for(std::chrono::milliseconds { 200 });
+
+        const std::size_t resident_after { residentBytes() };
+        const std::size_t heap_after { heapBytes() };
+
+        backend.close();
+        write(done_pipe[1], "", 1);
+        waitpid(clients_process, nullptr, 0);
+
+        for (const int pipe_end : { port_pipe[0], port_pipe[1], done_pipe[0], done_pipe[1] })
+            close(pipe_end);
+
+        if (remaining_events > 0) {
+            state.SkipWithError("A client left before it was idle");
+            return;
+        }
+
+        const auto connections { static_cast<double>(clients_count) };
+        state.counters["ResidentBytesPerConnection"] =
+                (static_cast<double>(resident_after) - static_cast<double>(resident_before)) / connections;
+        state.counters["HeapBytesPerConnection"] =
+                (static_cast<double>(heap_after) - static_cast<double>(heap_before)) / connections;
+    }
+}
+
+/// Memory held by each idle WS connection
+void IdleWsConnectionBytes(benchmark::State& state) {
+    measureIdleConnections<WsClientStream, UnsafeBeastWebsocketBackend>(state);
+}
+
+/// Memory held by each idle WSS connection, with a self-signed certificate
+void IdleWssConnectionBytes(benchmark::State& state) {
+    const std::filesystem::path temporary_directory { std::filesystem::temp_directory_path() };
+    const std::string certificate_file { temporary_directory / "rpt-benchmark-certificate.pem" };
+    const std::string private_key_file { temporary_directory / "rpt-benchmark-private-key.pem" };
+    writeSelfSignedCertificate(certificate_file, private_key_file);
+
+    measureIdleConnections<WssClientStream, SafeBeastWebsocketBackend>(state, certificate_file, private_key_file);
+
+    std::filesystem::remove(certificate_file);
+    std::filesystem::remove(private_key_file);
+}
+
+
+}
+
+
+BENCHMARK(OutputEventBroadcast)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(HandshakeRegistration)->RangeMultiplier(4)->Range(1, 256);
+// Connections are only accepted once, memory isn't measured over many iterations
+BENCHMARK(IdleWsConnectionBytes)->Arg(64)->Arg(256)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(IdleWssConnectionBytes)->Arg(64)->Arg(256)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,229 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Network/OutgoingMessagesQueue.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Low watermark at 2 messages or 10 bytes, high watermark at 4 messages or 20 bytes
+constexpr OutgoingQueueLimits TESTING_LIMITS { 2, 10, 4, 20 };
+
+
+/// Pool for every message used by these tests, must outlive them
+MessagesPool test_messages_pool;
+
+
+MessageBuffer rptlMessage(const std::string_view message) {
+    return test_messages_pool.acquire(message);
+}
+
+
+}
+
+
+// Required for ADL to detect operator<< for PushResult inside RpT::Network namespace
+namespace RpT::Network {
+
+
+// Required by BOOST_CHECK_EQUAL macro usage
+std::ostream& operator<<(std::ostream& out, const OutgoingMessagesQueue::PushResult result) {
+    switch (result) {
+    case OutgoingMessagesQueue::PushResult::Queued:
+        return out << "Queued";
+    case OutgoingMessagesQueue::PushResult::Congested:
+        return out << "Congested";
+    case OutgoingMessagesQueue::PushResult::Overflowed:
+        return out << "Overflowed";
+    case OutgoingMessagesQueue::PushResult::Dropped:
+        return out << "Dropped";
+    }
+
+    return out;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(OutgoingMessagesQueueTests)
+
+
+BOOST_AUTO_TEST_CASE(UnderLowWatermark) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("A")), OutgoingMessagesQueue::PushResult::Queued);
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("BC")), OutgoingMessagesQueue::PushResult::Queued);
+
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+    BOOST_CHECK_EQUAL(queue.bytes(), 3);
+    BOOST_CHECK(!queue.congested());
+
+    // Messages must be retrieved in order
+    BOOST_CHECK_EQUAL(*queue.pop(), "A");
+    BOOST_CHECK_EQUAL(*queue.pop(), "BC");
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK_EQUAL(queue.bytes(), 0);
+    BOOST_CHECK(!queue.pop());
+}
+
+BOOST_AUTO_TEST_CASE(MessagesLowWatermark) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    queue.push(rptlMessage("A"));
+    queue.push(rptlMessage("B"));
+    // Third message exceeds low watermark, congestion is reported only once
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("C")), OutgoingMessagesQueue::PushResult::Congested);
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("D")), OutgoingMessagesQueue::PushResult::Queued);
+    BOOST_CHECK(queue.congested());
+
+    queue.pop();
+    // Still above low watermark
+    BOOST_CHECK(queue.congested());
+    queue.pop();
+    // Back under low watermark
+    BOOST_CHECK(!queue.congested());
+}
+
+BOOST_AUTO_TEST_CASE(BytesLowWatermark) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("LOGGED_IN 1 A")), OutgoingMessagesQueue::PushResult::Congested);
+    BOOST_CHECK(queue.congested());
+
+    queue.popAll();
+    BOOST_CHECK(!queue.congested());
+}
+
+BOOST_AUTO_TEST_CASE(MessagesHighWatermark) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    for (int i { 0 }; i < 4; i++)
+        BOOST_CHECK_NE(queue.push(rptlMessage("A")), OutgoingMessagesQueue::PushResult::Overflowed);
+
+    // Fifth message must be refused
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("A")), OutgoingMessagesQueue::PushResult::Overflowed);
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(BytesHighWatermark) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("0123456789ABCDE")), OutgoingMessagesQueue::PushResult::Congested);
+    // Would exceed 20 bytes
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("0123456")), OutgoingMessagesQueue::PushResult::Overflowed);
+    // Still fits in 20 bytes
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("01234")), OutgoingMessagesQueue::PushResult::Queued);
+    BOOST_CHECK_EQUAL(queue.bytes(), 20);
+}
+
+BOOST_AUTO_TEST_CASE(PopAll) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    queue.push(rptlMessage("A"));
+    queue.push(rptlMessage("B"));
+
+    std::queue<MessageBuffer> messages { queue.popAll() };
+
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK_EQUAL(queue.bytes(), 0);
+    BOOST_REQUIRE_EQUAL(messages.size(), 2);
+    BOOST_CHECK_EQUAL(*messages.front(), "A");
+    BOOST_CHECK_EQUAL(*messages.back(), "B");
+}
+
+BOOST_AUTO_TEST_CASE(FrontQueuedAt) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    BOOST_CHECK(queue.frontQueuedAt() == std::chrono::steady_clock::time_point {});
+
+    const auto before_push { std::chrono::steady_clock::now() };
+    queue.push(rptlMessage("A"));
+    const auto first_queued_at { queue.frontQueuedAt() };
+    queue.push(rptlMessage("B"));
+
+    BOOST_CHECK(first_queued_at >= before_push);
+    BOOST_CHECK(queue.frontQueuedAt() == first_queued_at); // Oldest message is still "A"
+
+    queue.pop();
+    BOOST_CHECK(queue.frontQueuedAt() >= first_queued_at);
+
+    queue.popAll();
+    BOOST_CHECK(queue.frontQueuedAt() == std::chrono::steady_clock::time_point {});
+}
+
+BOOST_AUTO_TEST_CASE(CriticalBeforeBestEffort) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    queue.push(rptlMessage("A"), MessagePriority::BestEffort);
+    const auto best_effort_queued_at { queue.frontQueuedAt() };
+    queue.push(rptlMessage("B"));
+
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+    BOOST_CHECK(queue.frontQueuedAt() == best_effort_queued_at); // Oldest message from any lane
+
+    // Critical message is sent first, even if it was queued later
+    BOOST_CHECK_EQUAL(*queue.pop(), "B");
+    BOOST_CHECK_EQUAL(*queue.pop(), "A");
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(OrderKeptInsideLanes) {
+    OutgoingMessagesQueue queue { OutgoingQueueLimits { 8, 100, 16, 200 } }; // Every message stays under low watermark
+
+    queue.push(rptlMessage("A"), MessagePriority::BestEffort);
+    queue.push(rptlMessage("B"));
+    queue.push(rptlMessage("C"), MessagePriority::BestEffort);
+    queue.push(rptlMessage("D"));
+
+    std::queue<MessageBuffer> messages { queue.popAll() };
+
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK_EQUAL(queue.bytes(), 0);
+    BOOST_REQUIRE_EQUAL(messages.size(), 4);
+
+    for (const std::string_view expected_message : { "B", "D", "A", "C" }) {
+        BOOST_CHECK_EQUAL(*messages.front(), expected_message);
+        messages.pop();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(BestEffortDroppedAtLowWatermark) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("A"), MessagePriority::BestEffort),
+                      OutgoingMessagesQueue::PushResult::Queued);
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("B"), MessagePriority::BestEffort),
+                      OutgoingMessagesQueue::PushResult::Queued);
+    // Would exceed low watermark
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("C"), MessagePriority::BestEffort),
+                      OutgoingMessagesQueue::PushResult::Dropped);
+    BOOST_CHECK(!queue.congested());
+
+    // Critical messages are still queued up to high watermark
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("D")), OutgoingMessagesQueue::PushResult::Congested);
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("E")), OutgoingMessagesQueue::PushResult::Queued);
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("F")), OutgoingMessagesQueue::PushResult::Overflowed);
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(BestEffortDroppedWhileCongested) {
+    OutgoingMessagesQueue queue { TESTING_LIMITS };
+
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("0123456789A")), OutgoingMessagesQueue::PushResult::Congested);
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("B"), MessagePriority::BestEffort),
+                      OutgoingMessagesQueue::PushResult::Dropped);
+    BOOST_CHECK_EQUAL(queue.size(), 1);
+
+    // Once congestion is over, best-effort messages are queued again
+    queue.pop();
+    BOOST_CHECK_EQUAL(queue.push(rptlMessage("C"), MessagePriority::BestEffort),
+                      OutgoingMessagesQueue::PushResult::Queued);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
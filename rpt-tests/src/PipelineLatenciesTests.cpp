@@ -0,0 +1,81 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <sstream>
+#include <RpT-Utils/PipelineLatencies.hpp>
+
+
+using namespace RpT::Utils;
+using namespace std::chrono_literals;
+
+
+BOOST_AUTO_TEST_SUITE(PipelineLatenciesTests)
+
+
+BOOST_AUTO_TEST_CASE(StagesNames) {
+    BOOST_CHECK_EQUAL(PipelineLatencies::stageName(PipelineStage::Receive), "receive");
+    BOOST_CHECK_EQUAL(PipelineLatencies::stageName(PipelineStage::Parse), "parse");
+    BOOST_CHECK_EQUAL(PipelineLatencies::stageName(PipelineStage::Dispatch), "dispatch");
+    BOOST_CHECK_EQUAL(PipelineLatencies::stageName(PipelineStage::Polling), "polling");
+    BOOST_CHECK_EQUAL(PipelineLatencies::stageName(PipelineStage::Write), "write");
+}
+
+BOOST_AUTO_TEST_CASE(RecordStage) {
+    PipelineLatencies latencies;
+
+    latencies.record(PipelineStage::Parse, 10ns);
+    latencies.record(PipelineStage::Parse, 12ns);
+    latencies.record(PipelineStage::Write, 1us);
+
+    BOOST_CHECK_EQUAL(latencies.stage(PipelineStage::Parse).count(), 2);
+    BOOST_CHECK_EQUAL(latencies.stage(PipelineStage::Parse).sum(), 22);
+    BOOST_CHECK_EQUAL(latencies.stage(PipelineStage::Write).count(), 1);
+    BOOST_CHECK_EQUAL(latencies.stage(PipelineStage::Receive).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(NegativeLatency) {
+    PipelineLatencies latencies;
+
+    // Recorded as 0, histogram values are unsigned
+    latencies.record(PipelineStage::Receive, -5ns);
+
+    BOOST_CHECK_EQUAL(latencies.stage(PipelineStage::Receive).count(), 1);
+    BOOST_CHECK_EQUAL(latencies.stage(PipelineStage::Receive).max(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RecordService) {
+    PipelineLatencies latencies;
+
+    BOOST_CHECK(!latencies.service("Chat").has_value());
+
+    latencies.recordService("Chat", 3ns);
+    latencies.recordService("Chat", 5ns);
+    latencies.recordService("Lobby", 7ns);
+
+    BOOST_REQUIRE(latencies.service("Chat").has_value());
+    BOOST_CHECK_EQUAL(latencies.service("Chat")->count(), 2);
+    BOOST_REQUIRE(latencies.service("Lobby").has_value());
+    BOOST_CHECK_EQUAL(latencies.service("Lobby")->sum(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(Export) {
+    PipelineLatencies latencies;
+
+    latencies.record(PipelineStage::Dispatch, 8ns);
+    latencies.recordService("Chat", 4ns);
+
+    std::ostringstream exported;
+    latencies.exportTo(exported);
+
+    const std::string exported_text { exported.str() };
+
+    BOOST_CHECK_NE(exported_text.find("# TYPE rpt_pipeline_latency_ns summary\n"), std::string::npos);
+    BOOST_CHECK_NE(exported_text.find("rpt_pipeline_latency_ns{stage=\"dispatch\",quantile=\"0.5\"} 8\n"),
+                   std::string::npos);
+    BOOST_CHECK_NE(exported_text.find("rpt_pipeline_latency_ns_count{stage=\"dispatch\"} 1\n"), std::string::npos);
+    BOOST_CHECK_NE(exported_text.find("rpt_pipeline_latency_ns_count{stage=\"write\"} 0\n"), std::string::npos);
+    BOOST_CHECK_NE(exported_text.find("# TYPE rpt_service_latency_ns summary\n"), std::string::npos);
+    BOOST_CHECK_NE(exported_text.find("rpt_service_latency_ns_sum{service=\"Chat\"} 4\n"), std::string::npos);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,282 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <RpT-Network/RawTcpBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Checks for given event variant to be of expected input event type
+template<typename ExpectedEventT>
+bool isEventType(const RpT::Core::AnyInputEvent& event_variant) {
+    return std::get_if<ExpectedEventT>(&event_variant) != nullptr;
+}
+
+
+/// Sends given RPTL message inside a length-prefixed frame using a blocking socket
+void sendFrame(boost::asio::ip::tcp::socket& client_socket, const std::string& rptl_message) {
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(rptl_message.size()) };
+
+    const std::vector<boost::asio::const_buffer> frame {
+        boost::asio::buffer(header), boost::asio::buffer(rptl_message)
+    };
+
+    boost::asio::write(client_socket, frame);
+}
+
+/// Receives next RPTL message from a length-prefixed frame using a blocking socket
+std::string receiveFrame(boost::asio::ip::tcp::socket& client_socket) {
+    RawTcpBackend::FrameHeader header;
+    boost::asio::read(client_socket, boost::asio::buffer(header));
+
+    std::string rptl_message;
+    rptl_message.resize(RawTcpBackend::frameLength(header.data()));
+    boost::asio::read(client_socket, boost::asio::buffer(rptl_message));
+
+    return rptl_message;
+}
+
+
+/// Provides a backend listening on a port chosen by system
+struct RawTcpBackendFixture {
+    RpT::Utils::LoggingContext logging_context;
+    RawTcpBackend backend;
+
+    RawTcpBackendFixture()
+    : backend { { boost::asio::ip::address_v4::loopback(), 0 }, logging_context } {
+        logging_context.disable();
+    }
+
+    /// Retrieves endpoint a client must connect to
+    boost::asio::ip::tcp::endpoint serverEndpoint() const {
+        return { boost::asio::ip::address_v4::loopback(), backend.localPort() };
+    }
+};
+
+
+/// Provides a backend waiting for a successor to take its listening socket over
+struct HandoffFixture {
+    RpT::Utils::LoggingContext logging_context;
+    const std::string handoff_path;
+    std::optional<RawTcpBackend> predecessor;
+    std::optional<RawTcpBackend> successor;
+
+    HandoffFixture()
+    : handoff_path { (std::filesystem::temp_directory_path() / "rpt-raw-tcp-handoff-tests.sock").string() } {
+        logging_context.disable();
+
+        RawTcpBackendOptions predecessor_options;
+        predecessor_options.handoffPath = handoff_path;
+
+        predecessor.emplace(boost::asio::ip::tcp::endpoint { boost::asio::ip::address_v4::loopback(), 0 },
+                            logging_context, predecessor_options);
+    }
+
+    /// Constructs successor on its own thread, as it blocks until predecessor handled handoff
+    std::thread takeOver() {
+        return std::thread { [this]() {
+            RawTcpBackendOptions successor_options;
+            successor_options.takeOverPath = handoff_path;
+
+            // Local endpoint is ignored, listening socket comes from predecessor
+            successor.emplace(boost::asio::ip::tcp::endpoint { boost::asio::ip::address_v4::loopback(), 0 },
+                              logging_context, successor_options);
+        } };
+    }
+
+    /// Retrieves endpoint a client must connect to, whichever backend is listening
+    boost::asio::ip::tcp::endpoint serverEndpoint() const {
+        return { boost::asio::ip::address_v4::loopback(), predecessor->localPort() };
+    }
+};
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(RawTcpBackendTests)
+
+
+BOOST_AUTO_TEST_SUITE(Framing)
+
+
+BOOST_AUTO_TEST_CASE(BigEndianHeader) {
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(0x01020304) };
+
+    BOOST_CHECK_EQUAL(header[0], 1);
+    BOOST_CHECK_EQUAL(header[1], 2);
+    BOOST_CHECK_EQUAL(header[2], 3);
+    BOOST_CHECK_EQUAL(header[3], 4);
+}
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+    for (const std::size_t message_length : { 0ul, 1ul, 255ul, 256ul, 65536ul, 0xfffffffful }) {
+        const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(message_length) };
+
+        BOOST_CHECK_EQUAL(RawTcpBackend::frameLength(header.data()), message_length);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(HighBytesUnsigned) {
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(0xff80ff80) };
+
+    BOOST_CHECK_EQUAL(RawTcpBackend::frameLength(header.data()), 0xff80ff80);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_FIXTURE_TEST_SUITE(Connections, RawTcpBackendFixture)
+
+
+BOOST_AUTO_TEST_CASE(LoginThenLogout) {
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client_socket { client_context };
+    client_socket.connect(serverEndpoint());
+
+    std::vector<std::string> received_messages;
+    // Client is blocking on its socket, so it must run on its own thread while backend is handling messages
+    std::thread client_thread { [&client_socket, &received_messages]() {
+        // Both messages sent at once, so they're received inside a single read
+        sendFrame(client_socket, "CHECKOUT");
+        sendFrame(client_socket, "LOGIN 42 Alvis");
+
+        received_messages.push_back(receiveFrame(client_socket)); // AVAILABILITY
+        received_messages.push_back(receiveFrame(client_socket)); // REGISTRATION
+        received_messages.push_back(receiveFrame(client_socket)); // LOGGED_IN
+
+        sendFrame(client_socket, "LOGOUT");
+
+        try { // Receives remaining messages until connection is closed by server
+            while (true)
+                received_messages.push_back(receiveFrame(client_socket));
+        } catch (const boost::system::system_error&) {}
+    } };
+
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(backend.waitForInput())); // Checkout
+
+    const RpT::Core::AnyInputEvent joined_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::JoinedEvent>(joined_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::JoinedEvent>(joined_event).actor(), 42);
+
+    const RpT::Core::AnyInputEvent left_event { backend.waitForInput() };
+    BOOST_REQUIRE(isEventType<RpT::Core::LeftEvent>(left_event));
+    BOOST_CHECK_EQUAL(std::get<RpT::Core::LeftEvent>(left_event).actor(), 42);
+
+    // Remaining messages are sent and connection is closed, so client thread stops
+    backend.close();
+    client_thread.join();
+
+    BOOST_REQUIRE_EQUAL(received_messages.size(), 4);
+    BOOST_CHECK_EQUAL(received_messages.at(0), "AVAILABILITY 0 2");
+    BOOST_CHECK_EQUAL(received_messages.at(1).substr(0, 12), "REGISTRATION");
+    BOOST_CHECK_EQUAL(received_messages.at(2), "LOGGED_IN 42 Alvis");
+    BOOST_CHECK_EQUAL(received_messages.at(3), "INTERRUPT"); // Logged out client is closed without error
+}
+
+BOOST_AUTO_TEST_CASE(TooLongFrameKillsClient) {
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client_socket { client_context };
+    client_socket.connect(serverEndpoint());
+
+    // Only header is sent, announcing a message longer than default limit
+    const RawTcpBackend::FrameHeader header { RawTcpBackend::frameHeader(1024 * 1024) };
+    boost::asio::write(client_socket, boost::asio::buffer(header));
+
+    // Other client logs in so an event is triggered once oversized frame has been handled
+    boost::asio::ip::tcp::socket other_socket { client_context };
+    other_socket.connect(serverEndpoint());
+    sendFrame(other_socket, "LOGIN 1 Alvis");
+
+    BOOST_CHECK(isEventType<RpT::Core::JoinedEvent>(backend.waitForInput()));
+
+    // Killed client connection has been closed without any message, before backend was closed
+    char unexpected_byte;
+    boost::system::error_code err;
+    boost::asio::read(client_socket, boost::asio::buffer(&unexpected_byte, 1), err);
+
+    BOOST_CHECK(err == boost::asio::error::eof || err == boost::asio::error::connection_reset);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_FIXTURE_TEST_SUITE(Handoff, HandoffFixture)
+
+
+BOOST_AUTO_TEST_CASE(NoPredecessor) {
+    RawTcpBackendOptions successor_options;
+    successor_options.takeOverPath = handoff_path + ".missing";
+
+    BOOST_CHECK_THROW((RawTcpBackend {
+        { boost::asio::ip::address_v4::loopback(), 0 }, logging_context, successor_options
+    }), HandoffError);
+}
+
+BOOST_AUTO_TEST_CASE(IdlePredecessorClosed) {
+    const boost::asio::ip::tcp::endpoint server_endpoint { serverEndpoint() };
+    std::thread successor_thread { takeOver() };
+
+    // No client to drain, so predecessor closes itself once listening socket was passed
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(predecessor->waitForInput()));
+    BOOST_CHECK(predecessor->closed());
+
+    successor_thread.join();
+    BOOST_REQUIRE(successor.has_value());
+    BOOST_CHECK_EQUAL(successor->localPort(), server_endpoint.port());
+
+    // New connections are accepted by successor
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client_socket { client_context };
+    client_socket.connect(server_endpoint);
+    sendFrame(client_socket, "LOGIN 42 Alvis");
+
+    BOOST_CHECK(isEventType<RpT::Core::JoinedEvent>(successor->waitForInput()));
+}
+
+BOOST_AUTO_TEST_CASE(ConnectedClientDrained) {
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client_socket { client_context };
+    client_socket.connect(serverEndpoint());
+    sendFrame(client_socket, "LOGIN 42 Alvis");
+
+    BOOST_CHECK(isEventType<RpT::Core::JoinedEvent>(predecessor->waitForInput()));
+
+    // Client leaves once successor took listening socket over, so predecessor must still be serving it until then
+    std::thread successor_thread { takeOver() };
+    std::thread client_thread { [&successor_thread, &client_socket]() {
+        successor_thread.join();
+
+        sendFrame(client_socket, "LOGOUT");
+    } };
+
+    BOOST_CHECK(isEventType<RpT::Core::LeftEvent>(predecessor->waitForInput()));
+    BOOST_CHECK(predecessor->draining());
+    BOOST_CHECK(!predecessor->closed());
+
+    client_thread.join();
+
+    // Last client left, so predecessor closes itself
+    BOOST_CHECK(isEventType<RpT::Core::NoneEvent>(predecessor->waitForInput()));
+    BOOST_CHECK(predecessor->closed());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE_END()
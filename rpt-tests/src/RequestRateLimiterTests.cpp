@@ -0,0 +1,67 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <stdexcept>
+#include <RpT-Network/RequestRateLimiter.hpp>
+
+
+using namespace RpT::Network;
+using namespace std::chrono_literals;
+
+
+BOOST_AUTO_TEST_SUITE(RequestRateLimiterTests)
+
+
+BOOST_AUTO_TEST_CASE(InvalidLimits) {
+    BOOST_CHECK_THROW((RequestRateLimiter { { 0, 10 } }), std::invalid_argument);
+    BOOST_CHECK_THROW((RequestRateLimiter { { -1, 10 } }), std::invalid_argument);
+    BOOST_CHECK_THROW((RequestRateLimiter { { 10, 0 } }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(BurstThenDrop) {
+    RequestRateLimiter limiter { { 10, 3 } };
+    const auto now { RequestRateLimiter::Clock::now() };
+
+    BOOST_CHECK(limiter.allow(1, now));
+    BOOST_CHECK(limiter.allow(1, now));
+    BOOST_CHECK(limiter.allow(1, now));
+    BOOST_CHECK(!limiter.allow(1, now)); // Burst exhausted
+
+    BOOST_CHECK(limiter.allow(2, now)); // Other actors have their own bucket
+
+    BOOST_CHECK_EQUAL(limiter.droppedFor(1), 1);
+    BOOST_CHECK_EQUAL(limiter.droppedFor(2), 0);
+    BOOST_CHECK_EQUAL(limiter.dropped(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Refill) {
+    RequestRateLimiter limiter { { 10, 2 } }; // 1 token each 100 ms
+    const auto now { RequestRateLimiter::Clock::now() };
+
+    BOOST_CHECK(limiter.allow(1, now));
+    BOOST_CHECK(limiter.allow(1, now));
+    BOOST_CHECK(!limiter.allow(1, now + 50ms));
+    BOOST_CHECK(limiter.allow(1, now + 150ms)); // 1.5 token refilled
+    BOOST_CHECK(!limiter.allow(1, now + 150ms));
+
+    // Refill never exceeds burst
+    BOOST_CHECK(limiter.allow(1, now + 10s));
+    BOOST_CHECK(limiter.allow(1, now + 10s));
+    BOOST_CHECK(!limiter.allow(1, now + 10s));
+}
+
+BOOST_AUTO_TEST_CASE(Forget) {
+    RequestRateLimiter limiter { { 10, 1 } };
+    const auto now { RequestRateLimiter::Clock::now() };
+
+    limiter.allow(1, now);
+    limiter.allow(1, now);
+    BOOST_CHECK_EQUAL(limiter.droppedFor(1), 1);
+
+    limiter.forget(1);
+    BOOST_CHECK_EQUAL(limiter.droppedFor(1), 0);
+    BOOST_CHECK(limiter.allow(1, now)); // New bucket is full
+    BOOST_CHECK_EQUAL(limiter.dropped(), 1); // Total is kept
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
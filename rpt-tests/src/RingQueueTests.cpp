@@ -0,0 +1,92 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <memory>
+#include <string>
+#include <RpT-Utils/RingQueue.hpp>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(RingQueueTests)
+
+
+BOOST_AUTO_TEST_CASE(EmptyWithoutRing) {
+    const RingQueue<int> queue;
+
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK_EQUAL(queue.size(), 0);
+    BOOST_CHECK_EQUAL(queue.capacity(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FirstInFirstOut) {
+    RingQueue<std::string> queue;
+    queue.push("A");
+    queue.push("B");
+
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+    BOOST_CHECK_EQUAL(queue.front(), "A");
+    queue.pop();
+    BOOST_CHECK_EQUAL(queue.front(), "B");
+    queue.pop();
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(OrderKeptWhileGrowingWrapped) {
+    RingQueue<int> queue;
+
+    // Front is moved forward, so next elements wrap around ring end
+    for (int i { 0 }; i < 6; i++)
+        queue.push(i);
+    for (int i { 0 }; i < 4; i++)
+        queue.pop();
+
+    const std::size_t initial_capacity { queue.capacity() };
+    for (int i { 6 }; i < 20; i++)
+        queue.push(i);
+
+    BOOST_CHECK_GT(queue.capacity(), initial_capacity);
+    BOOST_REQUIRE_EQUAL(queue.size(), 16);
+    for (int i { 4 }; i < 20; i++) {
+        BOOST_CHECK_EQUAL(queue.front(), i);
+        queue.pop();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SteadyDepthDoesNotGrow) {
+    RingQueue<int> queue;
+    queue.push(0);
+    const std::size_t initial_capacity { queue.capacity() };
+
+    for (int i { 1 }; i < 1000; i++) { // Ring is walked many times over with a single element inside
+        queue.push(i);
+        queue.pop();
+    }
+
+    BOOST_CHECK_EQUAL(queue.capacity(), initial_capacity);
+    BOOST_CHECK_EQUAL(queue.front(), 999);
+}
+
+BOOST_AUTO_TEST_CASE(PoppedSlotReleased) {
+    RingQueue<std::shared_ptr<int>> queue;
+    const auto element { std::make_shared<int>(42) };
+
+    queue.push(element);
+    queue.pop();
+
+    BOOST_CHECK_EQUAL(element.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Reserve) {
+    RingQueue<int> queue;
+    queue.push(1);
+    queue.push(2);
+
+    queue.reserve(100);
+    BOOST_CHECK_GE(queue.capacity(), 100);
+    BOOST_CHECK_EQUAL(queue.front(), 1);
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
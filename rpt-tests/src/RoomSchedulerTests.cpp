@@ -0,0 +1,114 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <RpT-Core/RoomScheduler.hpp>
+
+
+using namespace RpT::Core;
+
+
+BOOST_AUTO_TEST_SUITE(RoomSchedulerTests)
+
+
+BOOST_AUTO_TEST_CASE(NoWorker) {
+    BOOST_CHECK_THROW(RoomScheduler { 0 }, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(UnavailableWorkerCpu) {
+    // Started threads are joined before error is thrown
+    BOOST_CHECK_THROW((RoomScheduler { 3, { 0, 1u << 20 } }), std::system_error);
+}
+
+BOOST_AUTO_TEST_CASE(PinnedWorkers) {
+    RoomScheduler scheduler { 3, { 0 } };
+
+    std::vector<std::atomic<int>> runs_count(10);
+    std::vector<RoomScheduler::Step> steps;
+    for (std::size_t room { 0 }; room < runs_count.size(); room++)
+        steps.push_back({ room, [&runs_count, room]() { runs_count[room]++; } });
+
+    scheduler.run(steps);
+
+    for (const std::atomic<int>& room_runs : runs_count)
+        BOOST_CHECK_EQUAL(room_runs.load(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(EveryStepRunsOnce) {
+    RoomScheduler scheduler { 4 };
+    BOOST_CHECK_EQUAL(scheduler.workersCount(), 4);
+
+    std::vector<std::atomic<int>> runs_count(100);
+    std::vector<RoomScheduler::Step> steps;
+    for (std::size_t room { 0 }; room < runs_count.size(); room++)
+        steps.push_back({ room, [&runs_count, room]() { runs_count[room]++; } });
+
+    // Same steps, many batches
+    for (int batch { 0 }; batch < 10; batch++)
+        scheduler.run(steps);
+
+    for (const std::atomic<int>& room_runs : runs_count)
+        BOOST_CHECK_EQUAL(room_runs.load(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(SingleWorker) {
+    RoomScheduler scheduler { 1 };
+
+    std::vector<std::size_t> runs_order;
+    std::vector<RoomScheduler::Step> steps;
+    for (std::size_t room { 0 }; room < 3; room++)
+        steps.push_back({ room, [&runs_order, room]() { runs_order.push_back(room); } });
+
+    scheduler.run(steps);
+
+    // Run by caller thread, in queue order
+    const std::vector<std::size_t> expected_order { 0, 1, 2 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(runs_order.cbegin(), runs_order.cend(),
+                                  expected_order.cbegin(), expected_order.cend());
+}
+
+BOOST_AUTO_TEST_CASE(BusyWorkerStolen) {
+    RoomScheduler scheduler { 2 };
+    std::atomic<bool> stolen_step_done { false };
+
+    std::vector<RoomScheduler::Step> steps {
+        { 0, [&stolen_step_done]() { // Hot room, blocking its worker until other step is done
+            const auto deadline { std::chrono::steady_clock::now() + std::chrono::seconds { 5 } };
+
+            while (!stolen_step_done && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::yield();
+        } },
+        { 0, [&stolen_step_done]() { stolen_step_done = true; } } // Same worker, can only run if stolen
+    };
+
+    scheduler.run(steps);
+
+    BOOST_CHECK(stolen_step_done);
+}
+
+BOOST_AUTO_TEST_CASE(FailedStep) {
+    RoomScheduler scheduler { 2 };
+    std::atomic<int> done_steps { 0 };
+
+    std::vector<RoomScheduler::Step> steps {
+        { 0, []() { throw std::runtime_error { "Step failed" }; } },
+        { 1, [&done_steps]() { done_steps++; } },
+        { 0, [&done_steps]() { done_steps++; } }
+    };
+
+    // Thrown once every step is done
+    BOOST_CHECK_THROW(scheduler.run(steps), std::runtime_error);
+    BOOST_CHECK_EQUAL(done_steps.load(), 2);
+
+    // Scheduler is still usable
+    steps.erase(steps.begin());
+    scheduler.run(steps);
+    BOOST_CHECK_EQUAL(done_steps.load(), 4);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,402 @@
+#include <RpT-Testing/TestingUtils.hpp>
+#include <RpT-Testing/SerTestingUtils.hpp>
+
+#include <RpT-Core/Room.hpp>
+
+
+using namespace RpT::Core;
+
+
+// Facility classes, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Emits an event which targets everyone for each handled command, with command as event data
+class EchoService : public Service {
+public:
+    explicit EchoService(ServiceContext& run_context) : Service { run_context } {}
+
+    std::string_view name() const override {
+        return "Echo";
+    }
+
+    RpT::Utils::HandlingResult handleRequestCommand(std::uint64_t, const std::string_view sr_command_data) override {
+        emitEvent(std::string { sr_command_data });
+
+        return {};
+    }
+};
+
+
+/// For each handled command, emits an event targeting actors 2 and 42, then an event targeting actor 42 only
+class WhisperService : public Service {
+public:
+    explicit WhisperService(ServiceContext& run_context) : Service { run_context } {}
+
+    std::string_view name() const override {
+        return "Whisper";
+    }
+
+    RpT::Utils::HandlingResult handleRequestCommand(std::uint64_t, const std::string_view sr_command_data) override {
+        emitEvent(std::string { sr_command_data }, { 2, 42 });
+        emitEvent(std::string { sr_command_data }, { 42 });
+
+        return {};
+    }
+};
+
+
+/// Room owning its own context and service, sharing timers tokens with other rooms
+class EchoRoom : public Room {
+private:
+    ServiceContext context_;
+    EchoService echo_svc_;
+
+public:
+    EchoRoom(const std::uint64_t id, const std::size_t capacity, ServiceContext& timers_tokens_provider,
+             RpT::Utils::LoggingContext& logging_context)
+    : Room { id, capacity }, context_ { timers_tokens_provider }, echo_svc_ { context_ } {
+
+        runServices({ echo_svc_ }, logging_context);
+    }
+};
+
+
+/// Room of 4 actors running given services, counting spectators backlogs and exposing spectators management
+class AudienceRoom : public Room {
+public:
+    unsigned int backlogs;
+
+    AudienceRoom(const std::initializer_list<std::reference_wrapper<Service>> services,
+                 RpT::Utils::LoggingContext& logging_context)
+    : Room { 0, 4, services, logging_context }, backlogs { 0 } {}
+
+    void spectate(const std::uint64_t actor, const bool spectating) {
+        setSpectator(actor, spectating);
+    }
+
+    void flush() {
+        flushSpectators();
+    }
+
+    void spectatorsBacklogged() override {
+        backlogs++;
+    }
+};
+
+
+/// Provides rooms registry for rooms of 2 actors
+class RoomsFixture {
+public:
+    RpT::Utils::LoggingContext logging_context;
+    ServiceContext timers_tokens_provider;
+    Rooms rooms;
+
+    RoomsFixture() : rooms { [this](const std::uint64_t id) {
+        return std::make_unique<EchoRoom>(id, 2, timers_tokens_provider, logging_context);
+    } } {
+        logging_context.disable();
+    }
+};
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(RoomTests)
+
+
+BOOST_AUTO_TEST_SUITE(RoomActors)
+
+BOOST_AUTO_TEST_CASE(JoinAndLeave) {
+    RpT::Utils::LoggingContext logging_context;
+    logging_context.disable();
+
+    ServiceContext context;
+    EchoService echo_svc { context };
+    Room room { 42, 2, { echo_svc }, logging_context };
+
+    BOOST_CHECK_EQUAL(room.id(), 42);
+    BOOST_CHECK(room.isEmpty());
+
+    room.join(1);
+    BOOST_CHECK_THROW(room.join(1), BadRoomActor); // Already inside room
+    room.join(2);
+
+    BOOST_CHECK(room.isFull());
+    BOOST_CHECK_THROW(room.join(3), BadRoomActor); // Room is full
+
+    room.leave(1);
+    BOOST_CHECK_THROW(room.leave(1), BadRoomActor); // No longer inside room
+    BOOST_CHECK(!room.isFull());
+    BOOST_CHECK_EQUAL(room.actors().count(2), 1);
+}
+
+BOOST_AUTO_TEST_CASE(EventsTargetRoomActors) {
+    RpT::Utils::LoggingContext logging_context;
+    logging_context.disable();
+
+    ServiceContext context;
+    EchoService echo_svc { context };
+    Room room { 0, 2, { echo_svc }, logging_context };
+
+    room.join(1);
+    room.join(2);
+
+    BOOST_CHECK_EQUAL(room.handleServiceRequest(1, "REQUEST 0 Echo Hello"), "RESPONSE 0 OK");
+
+    const ServiceEvent expected_event { "EVENT Echo Hello", ActorUidsSet { 1, 2 } };
+    BOOST_CHECK_EQUAL(*room.pollServiceEvent(), expected_event);
+    BOOST_CHECK(!room.pollServiceEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(TargetsOutsideRoomRemoved) {
+    RpT::Utils::LoggingContext logging_context;
+    logging_context.disable();
+
+    ServiceContext context;
+    WhisperService whisper_svc { context };
+    Room room { 0, 2, { whisper_svc }, logging_context };
+
+    room.join(1);
+    room.join(2);
+
+    room.handleServiceRequest(1, "REQUEST 0 Whisper Hello");
+
+    // Actor 42 isn't inside room, so second event doesn't have any target left and is skipped
+    const ServiceEvent expected_event { "EVENT Whisper Hello", ActorUidsSet { 2 } };
+    BOOST_CHECK_EQUAL(*room.pollServiceEvent(), expected_event);
+    BOOST_CHECK(!room.pollServiceEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(UnlimitedRoomBroadcasts) {
+    RpT::Utils::LoggingContext logging_context;
+    logging_context.disable();
+
+    ServiceContext context;
+    EchoService echo_svc { context };
+    Room room { 0, Room::UNLIMITED, { echo_svc }, logging_context };
+
+    room.join(1);
+    room.handleServiceRequest(1, "REQUEST 0 Echo Hello");
+
+    BOOST_CHECK(room.pollServiceEvent()->targetEveryone());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(RoomSpectators)
+
+BOOST_AUTO_TEST_CASE(OnlyRoomActorsSpectate) {
+    RpT::Utils::LoggingContext logging_context;
+    logging_context.disable();
+
+    ServiceContext context;
+    EchoService echo_svc { context };
+    AudienceRoom room { { echo_svc }, logging_context };
+
+    BOOST_CHECK_THROW(room.spectate(1, true), BadRoomActor);
+
+    room.join(1);
+    room.spectate(1, true);
+    BOOST_CHECK(room.isSpectator(1));
+
+    room.leave(1); // No longer inside room, so no longer a spectator
+    BOOST_CHECK(!room.isSpectator(1));
+    BOOST_CHECK(room.spectators().empty());
+}
+
+BOOST_AUTO_TEST_CASE(RoomWideEventsBatched) {
+    RpT::Utils::LoggingContext logging_context;
+    logging_context.disable();
+
+    ServiceContext context;
+    EchoService echo_svc { context };
+    WhisperService whisper_svc { context };
+    AudienceRoom room { { echo_svc, whisper_svc }, logging_context };
+
+    room.join(1);
+    room.join(2);
+    room.join(3);
+    room.spectate(3, true);
+
+    room.handleServiceRequest(1, "REQUEST 0 Echo A");
+    room.handleServiceRequest(1, "REQUEST 1 Echo B");
+
+    // Players receive events immediately, spectator 3 only once they are flushed
+    const ServiceEvent first_expected { "EVENT Echo A", ActorUidsSet { 1, 2 } };
+    const ServiceEvent second_expected { "EVENT Echo B", ActorUidsSet { 1, 2 } };
+    BOOST_CHECK_EQUAL(*room.pollServiceEvent(), first_expected);
+    BOOST_CHECK_EQUAL(*room.pollServiceEvent(), second_expected);
+    BOOST_CHECK(!room.pollServiceEvent().has_value());
+    BOOST_CHECK_EQUAL(room.backlogs, 1); // Backlog notified once, when it stopped being empty
+
+    room.flush();
+
+    const ServiceEvent first_batched { "EVENT Echo A", ActorUidsSet { 3 } };
+    const ServiceEvent second_batched { "EVENT Echo B", ActorUidsSet { 3 } };
+    BOOST_CHECK_EQUAL(*room.pollServiceEvent(), first_batched);
+    BOOST_CHECK_EQUAL(*room.pollServiceEvent(), second_batched);
+    BOOST_CHECK(!room.pollServiceEvent().has_value());
+
+    // Events targeting spectators explicitly aren't batched
+    room.spectate(2, true);
+    room.handleServiceRequest(1, "REQUEST 2 Whisper C");
+
+    const ServiceEvent whisper_expected { "EVENT Whisper C", ActorUidsSet { 2 } };
+    BOOST_CHECK_EQUAL(*room.pollServiceEvent(), whisper_expected);
+    BOOST_CHECK(!room.pollServiceEvent().has_value());
+    BOOST_CHECK_EQUAL(room.backlogs, 1);
+}
+
+BOOST_AUTO_TEST_CASE(BacklogDroppedWithoutSpectators) {
+    RpT::Utils::LoggingContext logging_context;
+    logging_context.disable();
+
+    ServiceContext context;
+    EchoService echo_svc { context };
+    AudienceRoom room { { echo_svc }, logging_context };
+
+    room.join(1);
+    room.join(2);
+    room.spectate(2, true);
+
+    room.handleServiceRequest(1, "REQUEST 0 Echo A");
+    BOOST_CHECK(room.pollServiceEvent().has_value()); // For player 1
+    BOOST_CHECK(!room.pollServiceEvent().has_value());
+
+    room.leave(2);
+    room.flush();
+
+    BOOST_CHECK(!room.pollServiceEvent().has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_FIXTURE_TEST_SUITE(RoomsAssignment, RoomsFixture)
+
+BOOST_AUTO_TEST_CASE(FirstRoomOpenedAtConstruction) {
+    BOOST_CHECK_EQUAL(rooms.count(), 1);
+    BOOST_CHECK_EQUAL(rooms.occupiedCount(), 0);
+    BOOST_CHECK_EQUAL(rooms.first().id(), 0);
+    BOOST_CHECK(rooms.roomOf(1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(RoomsFilledOneAfterAnother) {
+    BOOST_CHECK_EQUAL(rooms.assign(1).id(), 0);
+    BOOST_CHECK_EQUAL(rooms.assign(2).id(), 0);
+    BOOST_CHECK_EQUAL(rooms.count(), 1);
+
+    BOOST_CHECK_EQUAL(rooms.assign(3).id(), 1); // First room is full, another one is opened
+    BOOST_CHECK_EQUAL(rooms.count(), 2);
+    BOOST_CHECK_EQUAL(rooms.occupiedCount(), 2);
+
+    BOOST_CHECK_EQUAL(rooms.roomOf(1)->id(), 0);
+    BOOST_CHECK_EQUAL(rooms.roomOf(3)->id(), 1);
+
+    BOOST_CHECK_THROW(rooms.assign(3), BadRoomActor); // Already inside a room
+}
+
+BOOST_AUTO_TEST_CASE(RoomReusedAfterUnassign) {
+    rooms.assign(1);
+    rooms.assign(2);
+    rooms.assign(3);
+
+    BOOST_CHECK_EQUAL(rooms.unassign(1).id(), 0);
+    BOOST_CHECK(rooms.roomOf(1) == nullptr);
+    BOOST_CHECK_THROW(rooms.unassign(1), BadRoomActor); // Not inside any room anymore
+
+    // Actor 3 has been waiting for longer than actor 2, so it is paired first
+    BOOST_CHECK_EQUAL(rooms.assign(4).id(), 1);
+    BOOST_CHECK_EQUAL(rooms.assign(5).id(), 0);
+    BOOST_CHECK_EQUAL(rooms.count(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyRoomReused) {
+    rooms.assign(1);
+    rooms.assign(2);
+    rooms.unassign(1);
+    rooms.unassign(2);
+    BOOST_CHECK_EQUAL(rooms.occupiedCount(), 0);
+
+    // Room 0 is empty again, so no other room has to be opened
+    BOOST_CHECK_EQUAL(rooms.assign(3).id(), 0);
+    BOOST_CHECK_EQUAL(rooms.assign(4).id(), 0);
+    BOOST_CHECK_EQUAL(rooms.count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(WaitingActorLeft) {
+    rooms.assign(1);
+    rooms.unassign(1); // Room 0 was still queued as waiting, but it is empty now
+
+    BOOST_CHECK_EQUAL(rooms.assign(2).id(), 0);
+    BOOST_CHECK_EQUAL(rooms.assign(3).id(), 0); // Paired with actor 2, once
+    BOOST_CHECK_EQUAL(rooms.assign(4).id(), 1);
+    BOOST_CHECK_EQUAL(rooms.count(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ActorsPairedInsideTheirBucket) {
+    // Even UIDs and odd UIDs are never paired together
+    Rooms bucketed_rooms {
+        [this](const std::uint64_t id) {
+            return std::make_unique<EchoRoom>(id, 2, timers_tokens_provider, logging_context);
+        },
+        [](const std::uint64_t actor) { return actor % 2; }
+    };
+
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(2).id(), 0);
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(3).id(), 1);
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(5).id(), 1);
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(4).id(), 0);
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(7).id(), 2);
+    BOOST_CHECK_EQUAL(bucketed_rooms.count(), 3);
+
+    // Emptied room is reused for another bucket
+    bucketed_rooms.unassign(2);
+    bucketed_rooms.unassign(4);
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(6).id(), 0);
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(9).id(), 2); // Paired with actor 7 waiting inside odd bucket
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(8).id(), 0); // Paired with actor 6
+    BOOST_CHECK_EQUAL(bucketed_rooms.assign(11).id(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(RoomsAreIndependent) {
+    rooms.assign(1);
+    rooms.assign(2);
+    rooms.assign(3);
+
+    Room& first_room { *rooms.roomOf(1) };
+    Room& second_room { *rooms.roomOf(3) };
+
+    // Each room has its own SER Protocol so RUIDs are checked separately
+    BOOST_CHECK_EQUAL(first_room.handleServiceRequest(1, "REQUEST 0 Echo A"), "RESPONSE 0 OK");
+    BOOST_CHECK_EQUAL(second_room.handleServiceRequest(3, "REQUEST 0 Echo B"), "RESPONSE 0 OK");
+
+    const ServiceEvent first_expected { "EVENT Echo A", ActorUidsSet { 1, 2 } };
+    const ServiceEvent second_expected { "EVENT Echo B", ActorUidsSet { 3 } };
+
+    BOOST_CHECK_EQUAL(*first_room.pollServiceEvent(), first_expected);
+    BOOST_CHECK_EQUAL(*second_room.pollServiceEvent(), second_expected);
+    BOOST_CHECK(!first_room.pollServiceEvent().has_value());
+    BOOST_CHECK(!second_room.pollServiceEvent().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(TimersTokensUniqueAcrossRooms) {
+    rooms.assign(1);
+    rooms.assign(2);
+    rooms.assign(3);
+
+    ServiceContext& first_context { *rooms.roomOf(1)->servicesContexts().front() };
+    ServiceContext& second_context { *rooms.roomOf(3)->servicesContexts().front() };
+
+    BOOST_CHECK(&first_context != &second_context);
+    BOOST_CHECK_EQUAL(first_context.newTimerCreated(), 0);
+    BOOST_CHECK_EQUAL(second_context.newTimerCreated(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE_END()
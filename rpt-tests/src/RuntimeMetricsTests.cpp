@@ -0,0 +1,120 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <sstream>
+#include <string>
+#include <RpT-Utils/RuntimeMetrics.hpp>
+
+
+using namespace RpT::Utils;
+
+
+namespace {
+
+
+/// Retrieves every sample exported by given metrics
+std::string exported(const RuntimeMetrics& metrics) {
+    std::ostringstream output;
+    metrics.exportTo(output);
+
+    return output.str();
+}
+
+/// Checks if given exported text contains given line
+bool hasLine(const std::string& exported_text, const std::string& line) {
+    return exported_text.find(line + '\n') != std::string::npos;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(RuntimeMetricsTests)
+
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const RuntimeMetrics metrics;
+    const std::string exported_text { exported(metrics) };
+
+    BOOST_CHECK(hasLine(exported_text, "# TYPE rpt_connected_clients gauge"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_connected_clients 0"));
+    BOOST_CHECK(hasLine(exported_text, "# TYPE rpt_input_events_total counter"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_input_events_total 0"));
+    BOOST_CHECK(hasLine(exported_text, "# TYPE rpt_client_queue_depth gauge"));
+    BOOST_CHECK(exported_text.find("rpt_client_queue_depth{") == std::string::npos);
+    BOOST_CHECK(hasLine(exported_text, "rpt_ready 0"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_actors_limit 0"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_occupied_rooms 0"));
+}
+
+BOOST_AUTO_TEST_CASE(Ready) {
+    RuntimeMetrics metrics;
+
+    metrics.serverReady();
+
+    BOOST_CHECK(hasLine(exported(metrics), "rpt_ready 1"));
+}
+
+BOOST_AUTO_TEST_CASE(ClientsAndActors) {
+    RuntimeMetrics metrics;
+
+    metrics.clientConnected(1);
+    metrics.clientConnected(2);
+    metrics.actorRegistered();
+    metrics.queueDepth(1, 5);
+
+    BOOST_CHECK_EQUAL(metrics.connectedClients(), 2);
+    BOOST_CHECK_EQUAL(metrics.registeredActors(), 1);
+
+    std::string exported_text { exported(metrics) };
+    BOOST_CHECK(hasLine(exported_text, "rpt_client_queue_depth{client=\"1\"} 5"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_client_queue_depth{client=\"2\"} 0"));
+
+    metrics.actorUnregistered();
+    metrics.clientDisconnected(1);
+    metrics.queueDepth(1, 3); // Client removed, must be ignored
+
+    BOOST_CHECK_EQUAL(metrics.connectedClients(), 1);
+    BOOST_CHECK_EQUAL(metrics.registeredActors(), 0);
+
+    exported_text = exported(metrics);
+    BOOST_CHECK(exported_text.find("rpt_client_queue_depth{client=\"1\"}") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Counters) {
+    RuntimeMetrics metrics;
+
+    metrics.inputEventHandled();
+    metrics.inputEventHandled();
+    metrics.bytesReceived(10);
+    metrics.bytesSent(20);
+    metrics.bytesSent(22);
+    metrics.tlsHandshakeDone();
+    metrics.pendingTimers(3);
+
+    BOOST_CHECK_EQUAL(metrics.inputEvents(), 2);
+
+    const std::string exported_text { exported(metrics) };
+    BOOST_CHECK(hasLine(exported_text, "rpt_input_events_total 2"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_received_bytes_total 10"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_sent_bytes_total 42"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_tls_handshakes_total 1"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_pending_timers 3"));
+}
+
+BOOST_AUTO_TEST_CASE(ServiceRequests) {
+    RuntimeMetrics metrics;
+
+    metrics.serviceRequestHandled("Chat", ServiceRequestResult::Ok);
+    metrics.serviceRequestHandled("Chat", ServiceRequestResult::Ok);
+    metrics.serviceRequestHandled("Chat", ServiceRequestResult::Ko);
+    metrics.serviceRequestHandled("Lobby", ServiceRequestResult::Error);
+
+    const std::string exported_text { exported(metrics) };
+    BOOST_CHECK(hasLine(exported_text, "rpt_service_requests_total{service=\"Chat\",result=\"ok\"} 2"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_service_requests_total{service=\"Chat\",result=\"ko\"} 1"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_service_requests_total{service=\"Chat\",result=\"error\"} 0"));
+    BOOST_CHECK(hasLine(exported_text, "rpt_service_requests_total{service=\"Lobby\",result=\"error\"} 1"));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
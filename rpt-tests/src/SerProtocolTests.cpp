@@ -67,6 +67,20 @@ public:
     }
 };
 
+/// Service with name given at construction
+class NamedService : public MinimalService {
+private:
+    std::string_view name_;
+
+public:
+    NamedService(ServiceContext& run_context, const std::string_view name)
+    : MinimalService { run_context }, name_ { name } {}
+
+    std::string_view name() const override {
+        return name_;
+    }
+};
+
 
 /**
  * @brief Provides `LoggingContext` with disabled logging
@@ -144,6 +158,23 @@ BOOST_AUTO_TEST_CASE(SomeServices) {
     BOOST_CHECK(!ser_protocol.isRegistered("NonexistentService"));
 }
 
+BOOST_AUTO_TEST_CASE(SameLengthAndBoundaryChars) {
+    // Names only differing by their middle char, so they're dispatched from same table slot
+    NamedService svc_x { context, "AxA" };
+    NamedService svc_y { context, "AyA" };
+    NamedService svc_z { context, "AzA" };
+    ServiceEventRequestProtocol ser_protocol { { svc_x, svc_y, svc_z }, logging_context };
+
+    BOOST_CHECK(ser_protocol.isRegistered("AxA"));
+    BOOST_CHECK(ser_protocol.isRegistered("AyA"));
+    BOOST_CHECK(ser_protocol.isRegistered("AzA"));
+    BOOST_CHECK(!ser_protocol.isRegistered("AwA"));
+
+    // Request must be handled by the right service
+    ser_protocol.handleServiceRequest(42, "REQUEST 0 AyA Some command");
+    BOOST_CHECK_EQUAL(svc_y.lastCommandActor(), 42);
+}
+
 BOOST_AUTO_TEST_CASE(SomeServiceAndTwiceSameName) {
     ServiceA svc_a_bis { context };
 
@@ -181,6 +212,14 @@ BOOST_AUTO_TEST_CASE(BadPrefixAndServiceName) {
     BOOST_CHECK_THROW(ser_protocol.handleServiceRequest(0, "BAD_PREFIX ServiceA"), InvalidRequestFormat);
 }
 
+BOOST_AUTO_TEST_CASE(InvalidRequestUid) {
+    // RUID must be a whole unsigned integer...
+    BOOST_CHECK_THROW(ser_protocol.handleServiceRequest(0, "REQUEST 2a ServiceB"), BadServiceRequest);
+    BOOST_CHECK_THROW(ser_protocol.handleServiceRequest(0, "REQUEST -1 ServiceB"), BadServiceRequest);
+    // ...which fits inside 64 bits
+    BOOST_CHECK_THROW(ser_protocol.handleServiceRequest(0, "REQUEST 18446744073709551616 ServiceB"), BadServiceRequest);
+}
+
 BOOST_AUTO_TEST_CASE(RightPrefixAndUnknownServiceName) {
     // Service must be registered
     BOOST_CHECK_THROW(ser_protocol.handleServiceRequest(0, "REQUEST 2 NonexistentService"), ServiceNotFound);
@@ -201,6 +240,26 @@ BOOST_AUTO_TEST_CASE(RightPrefixServiceBNonemptyCommand) {
     BOOST_CHECK_EQUAL(svc_b.lastCommandActor(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(MaxRuidResponseHeadroom) {
+    const std::string sr_response {
+        ser_protocol.handleServiceRequest(1, "REQUEST 18446744073709551615 ServiceB Some random arguments")
+    };
+
+    BOOST_CHECK_EQUAL(sr_response, "RESPONSE 18446744073709551615 OK");
+    // Higher level protocol prefix can be inserted without reallocation
+    BOOST_CHECK_GE(sr_response.capacity() - sr_response.size(), ServiceEventRequestProtocol::SR_RESPONSE_HEADROOM);
+}
+
+BOOST_AUTO_TEST_CASE(SampledRequest) {
+    RpT::Utils::SampledRequest sampled_request {};
+
+    ser_protocol.handleServiceRequest(1, "REQUEST 0 ServiceB Some random arguments", nullptr, nullptr,
+                                      &sampled_request);
+
+    BOOST_CHECK_EQUAL(sampled_request.serviceName(), "ServiceB");
+    BOOST_CHECK(sampled_request.serviceHandling >= RpT::Utils::SampledRequest::Clock::duration::zero());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -259,6 +318,36 @@ BOOST_AUTO_TEST_CASE(ManyEventsInEveryQueues) {
                                            std::optional<ServiceEvent> { "EVENT ServiceC 7" });
 }
 
+BOOST_AUTO_TEST_CASE(SomeEventsPolledFromService) {
+    svc_a.handleRequestCommand(1, "");
+    svc_b.handleRequestCommand(2, "");
+    svc_a.handleRequestCommand(3, "");
+
+    // Polled without SER Protocol, so it must not be polled again
+    svc_a.pollEvent();
+
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                           std::optional<ServiceEvent> { "EVENT ServiceB 2" });
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                           std::optional<ServiceEvent> { "EVENT ServiceA 3" });
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(), std::optional<ServiceEvent> {});
+}
+
+BOOST_AUTO_TEST_CASE(EventsFromUnregisteredService) {
+    // Same context and same name than a running service, but not registered into SER Protocol
+    ServiceA unregistered_svc_a { context };
+
+    unregistered_svc_a.handleRequestCommand(1, "");
+    svc_a.handleRequestCommand(2, "");
+
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                           std::optional<ServiceEvent> { "EVENT ServiceA 2" });
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(), std::optional<ServiceEvent> {});
+
+    // Event is still inside unregistered service queue
+    BOOST_CHECK(unregistered_svc_a.checkEvent().has_value());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,7 @@
 #include <RpT-Testing/TestingUtils.hpp>
 
+#include <functional>
+#include <vector>
 #include <RpT-Core/ServiceContext.hpp>
 
 
@@ -20,4 +22,69 @@ BOOST_AUTO_TEST_CASE(DefaultConstructed) {
     BOOST_CHECK_EQUAL(context.newTimerCreated(), 2);
 }
 
+BOOST_AUTO_TEST_CASE(SharedTimersTokensProvider) {
+    ServiceContext tokens_provider;
+    ServiceContext context_a { tokens_provider };
+    ServiceContext context_b { tokens_provider };
+
+    // Tokens are unique across contexts sharing same provider
+    BOOST_CHECK_EQUAL(context_a.newTimerCreated(), 0);
+    BOOST_CHECK_EQUAL(context_b.newTimerCreated(), 1);
+    BOOST_CHECK_EQUAL(context_a.newTimerCreated(), 2);
+    BOOST_CHECK_EQUAL(tokens_provider.newTimerCreated(), 3);
+
+    // Events IDs are still owned by each context
+    BOOST_CHECK_EQUAL(context_a.newEventPushed(), 0);
+    BOOST_CHECK_EQUAL(context_b.newEventPushed(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DeferredClearCallbacks) {
+    ServiceContext context;
+    std::vector<int> called_callbacks;
+
+    TimerCallbacks clear_callbacks;
+    clear_callbacks.push([&called_callbacks]() { called_callbacks.push_back(1); });
+    clear_callbacks.push([&called_callbacks]() { called_callbacks.push_back(2); });
+
+    context.deferClearCallbacks(true);
+    context.timerCleared(clear_callbacks);
+    BOOST_CHECK(called_callbacks.empty()); // Kept for later
+
+    context.deferClearCallbacks(false);
+    context.runDeferredClearCallbacks();
+
+    const std::vector<int> expected_callbacks { 1, 2 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(called_callbacks.cbegin(), called_callbacks.cend(),
+                                  expected_callbacks.cbegin(), expected_callbacks.cend());
+
+    context.runDeferredClearCallbacks(); // Consumed, not called again
+    BOOST_CHECK_EQUAL(called_callbacks.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(SubmittedTasks) {
+    ServiceContext context;
+    std::vector<int> completed_results;
+
+    context.submitTask([]() { return 42; }, [&completed_results](const int result) {
+        completed_results.push_back(result);
+    });
+    context.submitTask([]() {}, [&completed_results]() { completed_results.push_back(0); });
+
+    std::vector<ServiceTask> tasks;
+    context.takeSubmittedTasks(tasks);
+    BOOST_REQUIRE_EQUAL(tasks.size(), 2);
+
+    for (ServiceTask& task : tasks) {
+        task.run();
+        task.complete();
+    }
+
+    const std::vector<int> expected_results { 42, 0 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(completed_results.cbegin(), completed_results.cend(),
+                                  expected_results.cbegin(), expected_results.cend());
+
+    context.takeSubmittedTasks(tasks); // Consumed, not taken again
+    BOOST_CHECK(tasks.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,126 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <string>
+#include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/ServiceCoroutine.hpp>
+#include <RpT-Core/Timer.hpp>
+
+
+using namespace RpT::Core;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Runs a flow awaiting same timer twice, then another one, recording each step it went through
+class SteppingFlow {
+private:
+    Timer first_timer_;
+    Timer second_timer_;
+    ServiceCoroutine coroutine_;
+
+    void body() {
+        RPT_COROUTINE(coroutine_) {
+            steps += 'A';
+            RPT_AWAIT_TIMER(first_timer_);
+            steps += 'B';
+            RPT_AWAIT_TIMER(first_timer_); // Awaited again from its own trigger
+            steps += 'C';
+            RPT_AWAIT_TIMER(second_timer_);
+            steps += 'D';
+        }
+    }
+
+public:
+    std::string steps;
+
+    explicit SteppingFlow(ServiceContext& run_context)
+    : first_timer_ { run_context, 100 }, second_timer_ { run_context, 200 },
+    coroutine_ { [this]() { body(); } } {}
+
+    Timer& firstTimer() {
+        return first_timer_;
+    }
+
+    Timer& secondTimer() {
+        return second_timer_;
+    }
+
+    ServiceCoroutine& coroutine() {
+        return coroutine_;
+    }
+};
+
+
+/// Begins countdown for given Ready timer then triggers it, as %Executor and IO interface would do
+void runCountdown(Timer& ready_timer) {
+    ready_timer.beginCountdown();
+    ready_timer.trigger();
+}
+
+
+}
+
+
+/// Provides a flow with its timers, constructed with a context
+struct SteppingFlowFixture {
+    ServiceContext run_context;
+    SteppingFlow flow { run_context };
+};
+
+
+BOOST_FIXTURE_TEST_SUITE(ServiceCoroutineTests, SteppingFlowFixture)
+
+
+BOOST_AUTO_TEST_CASE(DoneUntilStarted) {
+    BOOST_CHECK(flow.coroutine().isDone());
+    BOOST_CHECK(!flow.coroutine().isSuspended());
+    BOOST_CHECK(flow.steps.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ResumedByTimersTrigger) {
+    flow.coroutine().start();
+
+    BOOST_CHECK_EQUAL(flow.steps, "A");
+    BOOST_CHECK(flow.coroutine().isSuspended());
+    BOOST_CHECK(flow.firstTimer().isWaitingCountdown());
+
+    runCountdown(flow.firstTimer());
+    BOOST_CHECK_EQUAL(flow.steps, "AB");
+    BOOST_CHECK(flow.firstTimer().isWaitingCountdown()); // Triggered timer cleared and requested again
+
+    runCountdown(flow.firstTimer());
+    BOOST_CHECK_EQUAL(flow.steps, "ABC");
+    BOOST_CHECK(flow.secondTimer().isWaitingCountdown());
+
+    runCountdown(flow.secondTimer());
+    BOOST_CHECK_EQUAL(flow.steps, "ABCD");
+    BOOST_CHECK(flow.coroutine().isDone());
+}
+
+BOOST_AUTO_TEST_CASE(CancelledNotResumed) {
+    flow.coroutine().start();
+    flow.firstTimer().beginCountdown();
+
+    flow.coroutine().cancel(); // Timer is still pending, but its trigger must not resume body
+    flow.firstTimer().trigger();
+
+    BOOST_CHECK_EQUAL(flow.steps, "A");
+    BOOST_CHECK(flow.coroutine().isDone());
+}
+
+BOOST_AUTO_TEST_CASE(RestartedFromBeginning) {
+    flow.coroutine().start();
+    runCountdown(flow.firstTimer());
+
+    flow.coroutine().start(); // Pending first timer is requested again by restarted flow
+    BOOST_CHECK_EQUAL(flow.steps, "ABA");
+    BOOST_CHECK(flow.firstTimer().isWaitingCountdown());
+
+    runCountdown(flow.firstTimer());
+    BOOST_CHECK_EQUAL(flow.steps, "ABAB");
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,10 +5,10 @@
 
 using namespace RpT::Core;
 
-using OptionalUidsSet = std::optional<std::unordered_set<std::uint64_t>>; // Shortcut for actor UIDs set instanciation
+using OptionalUidsSet = std::optional<ActorUidsSet>; // Shortcut for actor UIDs set instanciation
 
 
-BOOST_TEST_DONT_PRINT_LOG_VALUE(std::unordered_set<std::uint64_t>); // Unable to implement operator<< for an std object
+BOOST_TEST_DONT_PRINT_LOG_VALUE(ActorUidsSet);
 
 BOOST_AUTO_TEST_SUITE(ServiceEventTests)
 
@@ -74,7 +74,18 @@ BOOST_AUTO_TEST_CASE(AnyUsage) {
     // Command event data should have been prefixed
     BOOST_CHECK_EQUAL(prefixed_event.command(), "SERVICE EVENT Hello world!");
     // Actor UIDs set should not have been modified
-    BOOST_CHECK_EQUAL(prefixed_event.targets(), (std::unordered_set<std::uint64_t> { 6, 4, 5 }));
+    BOOST_CHECK_EQUAL(prefixed_event.targets(), (ActorUidsSet { 6, 4, 5 }));
+}
+
+BOOST_AUTO_TEST_CASE(LayeredPrefixes) {
+    ServiceEvent event { "Hello world!", OptionalUidsSet { { 1 } } };
+    // Outermost layer inserted last, data must be kept apart
+    const ServiceEvent prefixed_event { std::move(event).prefixWith("EVENT Chat ").prefixWith("SERVICE ") };
+
+    BOOST_CHECK_EQUAL(prefixed_event.prefix(), "SERVICE EVENT Chat ");
+    BOOST_CHECK_EQUAL(prefixed_event.data(), "Hello world!");
+    BOOST_CHECK_EQUAL(prefixed_event.command(), "SERVICE EVENT Chat Hello world!");
+    BOOST_CHECK_EQUAL(prefixed_event.targets(), (ActorUidsSet { 1 }));
 }
 
 
@@ -118,7 +129,63 @@ BOOST_AUTO_TEST_CASE(TargetingEveryone) {
 BOOST_AUTO_TEST_CASE(TargetingSpecifiedActors) {
     // UIDs should be retrieved, no matter the order as a UIDs set is used
     BOOST_CHECK_EQUAL((ServiceEvent { "", OptionalUidsSet { { 5, 0, 2 } } }).targets(),
-                      (std::unordered_set<std::uint64_t> { 2, 5, 0 }));
+                      (ActorUidsSet { 2, 5, 0 }));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/*
+ * asBestEffort() unit tests
+ */
+BOOST_AUTO_TEST_SUITE(AsBestEffort)
+
+
+BOOST_AUTO_TEST_CASE(CriticalByDefault) {
+    BOOST_CHECK(!(ServiceEvent { "" }).bestEffort());
+}
+
+BOOST_AUTO_TEST_CASE(KeptThroughLayers) {
+    ServiceEvent event { "Hello world!", OptionalUidsSet { { 1 } } };
+    // Higher protocols and targets replacement must not make it critical again
+    const ServiceEvent prefixed_event {
+        std::move(event).asBestEffort().prefixWith("EVENT Chat ").withTargets(OptionalUidsSet { { 2 } })
+    };
+
+    BOOST_CHECK(prefixed_event.bestEffort());
+    BOOST_CHECK_EQUAL(prefixed_event.command(), "EVENT Chat Hello world!");
+    BOOST_CHECK_EQUAL(prefixed_event.targets(), (ActorUidsSet { 2 }));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+/*
+ * borrowing() and owningData() unit tests
+ */
+BOOST_AUTO_TEST_SUITE(BorrowedData)
+
+
+BOOST_AUTO_TEST_CASE(ViewsGivenCommand) {
+    const std::string command { "Hello world!" };
+    const ServiceEvent event { ServiceEvent::borrowing(command, OptionalUidsSet { { 1 } }) };
+
+    BOOST_CHECK(event.data().data() == command.data()); // Not copied
+    BOOST_CHECK_EQUAL(event.data(), "Hello world!");
+    BOOST_CHECK_EQUAL(event.targets(), (ActorUidsSet { 1 }));
+    BOOST_CHECK((event == ServiceEvent { "Hello world!", OptionalUidsSet { { 1 } } }));
+}
+
+BOOST_AUTO_TEST_CASE(OwnedAfterCopy) {
+    std::string command { "Hello world!" };
+    const ServiceEvent event { ServiceEvent::borrowing(command).prefixWith("EVENT Chat ").owningData() };
+
+    command.assign("Overwritten!"); // Borrowed storage reused, owned data must not change
+
+    BOOST_CHECK(event.data().data() != command.data());
+    BOOST_CHECK_EQUAL(event.command(), "EVENT Chat Hello world!");
 }
 
 
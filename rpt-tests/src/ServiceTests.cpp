@@ -32,6 +32,18 @@ public:
 };
 
 
+/**
+ * @brief Watches its own timer member, which is constructed after `Service` superclass, as minigames services do
+ */
+class TimerOwningService : public TestingService {
+public:
+    Timer owned_timer;
+
+    explicit TimerOwningService(ServiceContext& run_context)
+    : TestingService { run_context, owned_timer }, owned_timer { run_context, 0 } {}
+};
+
+
 /**
  * @brief Provides `TestingService` instance with just initialized `ServiceContext` required for Service construction.
  *
@@ -113,6 +125,33 @@ BOOST_AUTO_TEST_CASE(ManyQueuedEvents) {
     BOOST_CHECK(!service.checkEvent().has_value());
 }
 
+/*
+ * recycleEventsStorage() unit tests
+ */
+
+BOOST_AUTO_TEST_CASE(EventsStorageRecycledOnceDrained) {
+    service.handleRequestCommand(42, {});
+    const char* const first_data { service.pollEvent().data().data() };
+
+    // FIRE event is still queued, so its command must not be overwritten by next events
+    service.recycleEventsStorage();
+    service.handleRequestCommand(43, {});
+    BOOST_CHECK_EQUAL(service.pollEvent(), (ServiceEvent { "FIRE", { { 42 } } }));
+
+    const ServiceEvent kept_event { service.pollEvent() };
+    BOOST_CHECK_EQUAL(kept_event, ServiceEvent { "43" });
+    BOOST_CHECK(kept_event.data().data() != first_data);
+    service.pollEvent();
+
+    // Queue is drained, next event commands reuse storage
+    service.recycleEventsStorage();
+    service.handleRequestCommand(44, {});
+
+    const ServiceEvent reused_event { service.pollEvent() };
+    BOOST_CHECK_EQUAL(reused_event, ServiceEvent { "44" });
+    BOOST_CHECK(reused_event.data().data() == first_data);
+}
+
 /*
  * getWaitingTimers() unit tests
  */
@@ -206,4 +245,62 @@ BOOST_AUTO_TEST_CASE(NotWatched) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * Ready timers listed by run context unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(ReadyTimers)
+
+BOOST_AUTO_TEST_CASE(InRequestsOrder) {
+    timerC.requestCountdown();
+    timerA.requestCountdown();
+
+    std::vector<Timer*> ready_timers;
+    service.runContext().takeReadyTimers(ready_timers);
+
+    BOOST_CHECK_EQUAL(ready_timers.size(), 2);
+    BOOST_CHECK_EQUAL(ready_timers.at(0), &timerC); // 1st requested is C
+    BOOST_CHECK_EQUAL(ready_timers.at(1), &timerA); // 2nd requested is A
+
+    // Listed timers have been taken, nothing more to take
+    service.runContext().takeReadyTimers(ready_timers);
+    BOOST_CHECK(ready_timers.empty());
+}
+
+BOOST_AUTO_TEST_CASE(NotWatched) {
+    Timer timerD { timer() };
+    timerD.requestCountdown();
+
+    std::vector<Timer*> ready_timers;
+    service.runContext().takeReadyTimers(ready_timers);
+
+    BOOST_CHECK(ready_timers.empty()); // Not watched by service, so not listed inside its context
+}
+
+BOOST_AUTO_TEST_CASE(OwnedTimer) {
+    TimerOwningService timer_owning_service { service.runContext() };
+    timer_owning_service.owned_timer.requestCountdown();
+
+    std::vector<Timer*> ready_timers;
+    service.runContext().takeReadyTimers(ready_timers);
+
+    // Timer was watched before being constructed, it must be listed anyway
+    BOOST_CHECK_EQUAL(ready_timers.size(), 1);
+    BOOST_CHECK_EQUAL(ready_timers.at(0), &timer_owning_service.owned_timer);
+}
+
+BOOST_AUTO_TEST_CASE(ForgottenWhileReady) {
+    timerA.requestCountdown();
+    timerB.requestCountdown();
+    service.forgetTimer(timerA);
+
+    std::vector<Timer*> ready_timers;
+    service.runContext().takeReadyTimers(ready_timers);
+
+    BOOST_CHECK_EQUAL(ready_timers.size(), 1); // Only B is still watched
+    BOOST_CHECK_EQUAL(ready_timers.at(0), &timerB);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
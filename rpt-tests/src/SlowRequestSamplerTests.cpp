@@ -0,0 +1,141 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <sstream>
+#include <RpT-Utils/SlowRequestSampler.hpp>
+
+
+using namespace RpT::Utils;
+using namespace std::chrono_literals;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Claims next ring slot for given actor, filled as a request which took given end-to-end duration
+SampledRequest& sampleRequest(SlowRequestSampler& sampler, const std::uint64_t actor,
+                              const SampledRequest::Clock::duration end_to_end) {
+
+    SampledRequest& request { sampler.begin() };
+    const SampledRequest::Clock::time_point received_at { SampledRequest::Clock::now() };
+
+    request.actor = actor;
+    request.receivedAt = received_at;
+    request.handledAt = received_at;
+    request.dispatchedAt = received_at;
+    request.repliedAt = received_at;
+    request.syncedAt = received_at + end_to_end;
+    request.serviceName("Chat");
+
+    return request;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(SlowRequestSamplerTests)
+
+
+BOOST_AUTO_TEST_CASE(InvalidArguments) {
+    BOOST_CHECK_THROW(SlowRequestSampler { 0us }, std::invalid_argument);
+    BOOST_CHECK_THROW((SlowRequestSampler { 1us, 0 }), std::invalid_argument);
+    BOOST_CHECK_THROW((SlowRequestSampler { 1us, 1, 0 }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ServiceNameTruncated) {
+    SampledRequest request {};
+
+    BOOST_CHECK_EQUAL(request.serviceName(), "");
+
+    request.serviceName("Lobby");
+    BOOST_CHECK_EQUAL(request.serviceName(), "Lobby");
+
+    const std::string long_name(SampledRequest::SERVICE_NAME_CAPACITY + 5, 'a');
+    request.serviceName(long_name);
+    BOOST_CHECK_EQUAL(request.serviceName(), long_name.substr(0, SampledRequest::SERVICE_NAME_CAPACITY));
+}
+
+BOOST_AUTO_TEST_CASE(RingSlotsReused) {
+    SlowRequestSampler sampler { 1ms, 2 };
+
+    SampledRequest& first { sampler.begin() };
+    first.actor = 42;
+    sampler.begin();
+
+    // Oldest slot is claimed again, and cleared
+    SampledRequest& third { sampler.begin() };
+    BOOST_CHECK_EQUAL(&first, &third);
+    BOOST_CHECK_EQUAL(third.actor, 0);
+}
+
+BOOST_AUTO_TEST_CASE(FastRequestIgnored) {
+    SlowRequestSampler sampler { 1ms };
+
+    BOOST_CHECK(!sampler.finish(sampleRequest(sampler, 0, 1ms)));
+
+    std::vector<SampledRequest> unreported;
+    BOOST_CHECK_EQUAL(sampler.takeUnreported(unreported), 0);
+    BOOST_CHECK(unreported.empty());
+    BOOST_CHECK_EQUAL(sampler.slowCount(), 0);
+    BOOST_CHECK(sampler.exemplars().empty());
+}
+
+BOOST_AUTO_TEST_CASE(SlowRequestReportedOnce) {
+    SlowRequestSampler sampler { 1ms };
+
+    BOOST_CHECK(sampler.finish(sampleRequest(sampler, 3, 2ms)));
+
+    std::vector<SampledRequest> unreported;
+    BOOST_CHECK_EQUAL(sampler.takeUnreported(unreported), 1);
+    BOOST_REQUIRE_EQUAL(unreported.size(), 1);
+    BOOST_CHECK_EQUAL(unreported.front().actor, 3);
+    BOOST_CHECK_EQUAL(unreported.front().serviceName(), "Chat");
+    BOOST_CHECK(unreported.front().endToEnd() == 2ms);
+
+    // Already taken, but still kept as exemplar
+    BOOST_CHECK_EQUAL(sampler.takeUnreported(unreported), 0);
+    BOOST_CHECK_EQUAL(sampler.slowCount(), 1);
+    BOOST_CHECK_EQUAL(sampler.exemplars().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(OldestExemplarsReplaced) {
+    SlowRequestSampler sampler { 1ms, 8, 2 };
+
+    for (std::uint64_t actor { 0 }; actor < 3; actor++)
+        sampler.finish(sampleRequest(sampler, actor, 2ms));
+
+    const std::vector<SampledRequest> exemplars { sampler.exemplars() };
+    BOOST_REQUIRE_EQUAL(exemplars.size(), 2);
+    BOOST_CHECK_EQUAL(exemplars[0].actor, 1);
+    BOOST_CHECK_EQUAL(exemplars[1].actor, 2);
+    BOOST_CHECK_EQUAL(sampler.slowCount(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Export) {
+    SlowRequestSampler sampler { 1ms };
+
+    SampledRequest& request { sampleRequest(sampler, 7, 2ms) };
+    request.requestBytes = 30;
+    request.responseBytes = 12;
+    request.pendingInputs = 4;
+    sampler.finish(request);
+
+    std::ostringstream output;
+    sampler.exportTo(output);
+    const std::string samples { output.str() };
+
+    const std::initializer_list<std::string_view> expected_samples {
+        "rpt_slow_requests_total 1\n",
+        "rpt_slow_request_ns{exemplar=\"0\",actor=\"7\",service=\"Chat\",stage=\"total\"} 2000000\n",
+        "rpt_slow_request_bytes{exemplar=\"0\",direction=\"request\"} 30\n",
+        "rpt_slow_request_bytes{exemplar=\"0\",direction=\"response\"} 12\n",
+        "rpt_slow_request_pending_inputs{exemplar=\"0\"} 4\n"
+    };
+
+    for (const std::string_view expected_sample : expected_samples)
+        BOOST_CHECK_NE(samples.find(expected_sample), std::string::npos);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include <RpT-Core/ServiceContext.hpp>
+#include <RpT-Core/TaskPool.hpp>
+
+
+using namespace RpT::Core;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Lists tokens notified by workers, so test thread can wait for them
+class NotifiedTokens {
+private:
+    std::mutex mutex_;
+    std::condition_variable token_notified_;
+    std::vector<std::uint64_t> tokens_;
+
+public:
+    /// Notifier to construct pool with, listing each token
+    TaskPool::CompletionNotifier notifier() {
+        return [this](const std::uint64_t token) {
+            {
+                const std::lock_guard<std::mutex> tokens_lock { mutex_ };
+                tokens_.push_back(token);
+            }
+
+            token_notified_.notify_one();
+        };
+    }
+
+    /// Waits up to 2 seconds for given number of tokens to be notified, then retrieves them sorted
+    std::vector<std::uint64_t> waitFor(const std::size_t tokens_count) {
+        std::unique_lock<std::mutex> tokens_lock { mutex_ };
+        token_notified_.wait_for(tokens_lock, std::chrono::seconds { 2 }, [this, tokens_count]() {
+            return tokens_.size() >= tokens_count;
+        });
+
+        std::vector<std::uint64_t> notified_tokens { tokens_ };
+        std::sort(notified_tokens.begin(), notified_tokens.end());
+
+        return notified_tokens;
+    }
+};
+
+
+/// Takes every task submitted into given context, each one as shared task to submit into a pool
+std::vector<std::shared_ptr<ServiceTask>> takeTasks(ServiceContext& context) {
+    std::vector<ServiceTask> submitted_tasks;
+    context.takeSubmittedTasks(submitted_tasks);
+
+    std::vector<std::shared_ptr<ServiceTask>> tasks;
+    for (ServiceTask& submitted_task : submitted_tasks)
+        tasks.push_back(std::make_shared<ServiceTask>(std::move(submitted_task)));
+
+    return tasks;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(TaskPoolTests)
+
+
+BOOST_AUTO_TEST_CASE(NoWorker) {
+    BOOST_CHECK_THROW((TaskPool { 0, [](std::uint64_t) {} }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(EveryTaskNotifiedOnce) {
+    ServiceContext context;
+    std::atomic<int> runs_count { 0 };
+    int completions_count { 0 };
+
+    for (int i { 0 }; i < 20; i++)
+        context.submitTask([&runs_count]() { runs_count++; }, [&completions_count]() { completions_count++; });
+
+    const std::vector<std::shared_ptr<ServiceTask>> tasks { takeTasks(context) };
+    BOOST_REQUIRE_EQUAL(tasks.size(), 20);
+
+    NotifiedTokens notified_tokens;
+    {
+        TaskPool pool { 4, notified_tokens.notifier() };
+        BOOST_CHECK_EQUAL(pool.workersCount(), 4);
+
+        for (std::uint64_t token { 0 }; token < tasks.size(); token++)
+            pool.submit(token, tasks[token]);
+
+        const std::vector<std::uint64_t> tokens { notified_tokens.waitFor(tasks.size()) };
+        BOOST_REQUIRE_EQUAL(tokens.size(), tasks.size());
+
+        for (std::uint64_t token { 0 }; token < tokens.size(); token++)
+            BOOST_CHECK_EQUAL(tokens[token], token);
+    }
+
+    BOOST_CHECK_EQUAL(runs_count.load(), 20);
+    BOOST_CHECK_EQUAL(completions_count, 0); // Only completed by caller
+
+    for (const std::shared_ptr<ServiceTask>& task : tasks)
+        task->complete();
+
+    BOOST_CHECK_EQUAL(completions_count, 20);
+}
+
+BOOST_AUTO_TEST_CASE(ResultGivenToCompletion) {
+    ServiceContext context;
+    std::unique_ptr<int> owned_operand { std::make_unique<int>(21) };
+    int completed_result { 0 };
+
+    // Work owning move-only data
+    context.submitTask([operand = std::move(owned_operand)]() { return *operand * 2; },
+                       [&completed_result](const int result) { completed_result = result; });
+
+    const std::vector<std::shared_ptr<ServiceTask>> tasks { takeTasks(context) };
+    BOOST_REQUIRE_EQUAL(tasks.size(), 1);
+
+    NotifiedTokens notified_tokens;
+    TaskPool pool { 1, notified_tokens.notifier() };
+    pool.submit(42, tasks.front());
+
+    tasks.front()->complete(); // Waits for work if it isn't done yet
+    BOOST_CHECK_EQUAL(completed_result, 42);
+    BOOST_CHECK_EQUAL(notified_tokens.waitFor(1).front(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(FailedWork) {
+    ServiceContext context;
+    bool completed { false };
+
+    context.submitTask([]() -> int { throw std::runtime_error { "Work failed" }; },
+                       [&completed](int) { completed = true; });
+
+    const std::vector<std::shared_ptr<ServiceTask>> tasks { takeTasks(context) };
+
+    NotifiedTokens notified_tokens;
+    TaskPool pool { 1, notified_tokens.notifier() };
+    pool.submit(0, tasks.front());
+
+    // Still notified, but work exception is thrown instead of completion being called
+    BOOST_CHECK_EQUAL(notified_tokens.waitFor(1).size(), 1);
+    BOOST_CHECK_THROW(tasks.front()->complete(), std::runtime_error);
+    BOOST_CHECK(!completed);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <RpT-Utils/TextProtocolParser.hpp>
+
+/*
+ * Compares TextProtocolParser words splitting with previous implementation, which walked command one char at a time
+ * and stored parsed words inside a vector. Not registered as a test, run it manually from a Release build.
+ */
+
+
+namespace {
+
+
+/// Previous implementation, kept as reference
+class ReferenceParser {
+private:
+    std::vector<std::string_view> parsed_words_;
+    std::string_view unparsed_words_;
+
+public:
+    ReferenceParser(const std::string_view protocol_command, const unsigned int expected_words) {
+        const auto cmd_begin { protocol_command.cbegin() };
+        const auto cmd_end { protocol_command.cend() };
+
+        std::ptrdiff_t word_begin_i { 0 };
+        std::size_t word_length { 0 };
+
+        auto char_it { cmd_begin };
+        while (char_it != cmd_end && parsed_words_.size() < expected_words) {
+            if (*char_it == ' ') {
+                if (word_length != 0) {
+                    parsed_words_.push_back(protocol_command.substr(word_begin_i, word_length));
+                    word_length = 0;
+                }
+            } else {
+                if (word_length == 0)
+                    word_begin_i = char_it - cmd_begin;
+
+                word_length++;
+            }
+
+            char_it++;
+        }
+
+        if (word_length != 0)
+            parsed_words_.push_back(protocol_command.substr(word_begin_i, word_length));
+
+        while (char_it != cmd_end && *char_it == ' ')
+            char_it++;
+
+        unparsed_words_ = protocol_command.substr(char_it - cmd_begin);
+    }
+
+    std::string_view word(const std::size_t i) const {
+        return parsed_words_.at(i);
+    }
+
+    std::string_view unparsed() const {
+        return unparsed_words_;
+    }
+};
+
+/// Gives access to parsed words, like reference parser
+class CurrentParser : public RpT::Utils::TextProtocolParser {
+public:
+    CurrentParser(const std::string_view protocol_command, const unsigned int expected_words)
+    : RpT::Utils::TextProtocolParser { protocol_command, expected_words, std::nothrow } {}
+
+    std::string_view word(const std::size_t i) const {
+        return getParsedWord(i);
+    }
+
+    std::string_view unparsed() const {
+        return unparsedWords();
+    }
+};
+
+/// Parses each command with given words count many times, retrieves elapsed nanoseconds for each parsing
+template<typename Parser>
+double nanosecondsPerCommand(const std::vector<std::pair<std::string, unsigned int>>& commands,
+                             const std::size_t rounds, std::size_t& checksum) {
+
+    const auto begin { std::chrono::steady_clock::now() };
+
+    for (std::size_t round { 0 }; round < rounds; round++) {
+        for (const auto& [command, expected_words] : commands) {
+            const Parser parser { command, expected_words };
+
+            // Depends on parsing results so it isn't optimized out
+            checksum += parser.word(expected_words - 1).size() + parser.unparsed().size();
+        }
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed { std::chrono::steady_clock::now() - begin };
+
+    return elapsed.count() / static_cast<double>(rounds * commands.size());
+}
+
+
+}
+
+
+int main() {
+    // Commands parsed by RPTL, SER and services parsers for usual server traffic
+    const std::vector<std::pair<std::string, unsigned int>> commands {
+        { "SERVICE REQUEST 42 Minigame MOVE 1 2 3 4", 1 },
+        { "REQUEST 42 Minigame MOVE 1 2 3 4", 3 },
+        { "MOVE 1 2 3 4", 1 },
+        { "1 2 3 4", 4 },
+        { "LOGIN 18446744073709551615 SomePlayerName", 1 },
+        { "18446744073709551615 SomePlayerName", 2 },
+        { "SERVICE REQUEST 7 Chat " + std::string(200, 'a') + " and a long chat message", 1 },
+        { "REQUEST 7 Chat " + std::string(200, 'a') + " and a long chat message", 3 }
+    };
+
+    constexpr std::size_t ROUNDS { 1000000 };
+
+    std::size_t reference_checksum { 0 };
+    std::size_t current_checksum { 0 };
+    const double reference_time { nanosecondsPerCommand<ReferenceParser>(commands, ROUNDS, reference_checksum) };
+    const double current_time { nanosecondsPerCommand<CurrentParser>(commands, ROUNDS, current_checksum) };
+
+    if (reference_checksum != current_checksum) {
+        std::cerr << "Parsers results differ" << std::endl;
+
+        return 1;
+    }
+
+    std::cout << "Reference: " << reference_time << " ns/command" << std::endl;
+    std::cout << "Current: " << current_time << " ns/command" << std::endl;
+    std::cout << "Speedup: x" << reference_time / current_time << std::endl;
+
+    return 0;
+}
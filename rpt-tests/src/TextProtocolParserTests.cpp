@@ -1,5 +1,6 @@
 #include <RpT-Testing/TestingUtils.hpp>
 
+#include <string>
 #include <RpT-Utils/TextProtocolParser.hpp>
 
 
@@ -24,6 +25,29 @@ public:
     }
 };
 
+/// Non-throwing implementation for `RpT::Core::TextProtocolParser`, gives access to integer words conversion
+class NoThrowParser : public TextProtocolParser {
+public:
+    NoThrowParser(const std::string_view protocol_command, const unsigned int expected_words) :
+    TextProtocolParser { protocol_command, expected_words, std::nothrow } {}
+
+    /// Continues parsing after given parser
+    NoThrowParser(const TextProtocolParser& previous_layer, const unsigned int expected_words) :
+    TextProtocolParser { previous_layer, expected_words, std::nothrow } {}
+
+    std::optional<std::uint64_t> uintAt(const std::size_t i) const {
+        return parseInteger<std::uint64_t>(getParsedWord(i));
+    }
+
+    std::string_view wordAt(const std::size_t i) const {
+        return getParsedWord(i);
+    }
+
+    std::string_view unparsed() const {
+        return unparsedWords();
+    }
+};
+
 
 BOOST_AUTO_TEST_SUITE(TextProtocolParserTests)
 
@@ -217,4 +241,80 @@ BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * Commands longer than a separators scan block, and with more words than inline storage
+ */
+
+BOOST_AUTO_TEST_SUITE(LongCommand)
+
+BOOST_AUTO_TEST_CASE(ManyWords) {
+    const std::string command {
+        std::string(40, ' ') + "FirstWordWhichIsLongerThanAnyScanBlock" + std::string(33, ' ') + "A B"
+        + std::string(17, ' ') + "C  D E" + std::string(64, ' ') + "Unparsed  words "
+    };
+    const SimpleParser parser { command, 6 };
+
+    BOOST_CHECK_EQUAL(parser.wordAt(0), "FirstWordWhichIsLongerThanAnyScanBlock");
+    BOOST_CHECK_EQUAL(parser.wordAt(1), "A");
+    BOOST_CHECK_EQUAL(parser.wordAt(2), "B");
+    BOOST_CHECK_EQUAL(parser.wordAt(3), "C");
+    BOOST_CHECK_EQUAL(parser.wordAt(4), "D");
+    BOOST_CHECK_EQUAL(parser.wordAt(5), "E");
+    BOOST_CHECK_THROW(parser.wordAt(6), ParsedIndexOutOfRange);
+    BOOST_CHECK_EQUAL(parser.unparsed(), "Unparsed  words ");
+}
+
+BOOST_AUTO_TEST_CASE(OnlySeparators) {
+    BOOST_CHECK_THROW((SimpleParser { std::string(100, ' '), 1 }), NotEnoughWords);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * Non-throwing parsing tests
+ */
+
+BOOST_AUTO_TEST_SUITE(NoThrow)
+
+BOOST_AUTO_TEST_CASE(MissingWords) {
+    const NoThrowParser parser { "Command 1", 3 };
+
+    BOOST_CHECK(!parser.hasExpectedWords());
+}
+
+BOOST_AUTO_TEST_CASE(ExpectedWords) {
+    const NoThrowParser parser { "Command 1 18446744073709551615", 3 };
+
+    BOOST_CHECK(parser.hasExpectedWords());
+    BOOST_CHECK_EQUAL(*parser.uintAt(1), 1);
+    BOOST_CHECK_EQUAL(*parser.uintAt(2), 18446744073709551615ull);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidIntegers) {
+    const NoThrowParser parser { "Command 1a -1 18446744073709551616 +1", 5 };
+
+    BOOST_CHECK(!parser.uintAt(0).has_value()); // Not an integer
+    BOOST_CHECK(!parser.uintAt(1).has_value()); // Chars after digits
+    BOOST_CHECK(!parser.uintAt(2).has_value()); // Negative
+    BOOST_CHECK(!parser.uintAt(3).has_value()); // Out of range
+    BOOST_CHECK(!parser.uintAt(4).has_value()); // Sign isn't allowed
+}
+
+BOOST_AUTO_TEST_CASE(Layers) {
+    const NoThrowParser lower_layer { "  SERVICE   REQUEST 42  Minigame MOVE 1 2 ", 1 };
+    const NoThrowParser higher_layer { lower_layer, 3 };
+
+    BOOST_CHECK_EQUAL(lower_layer.wordAt(0), "SERVICE");
+    BOOST_CHECK(higher_layer.hasExpectedWords());
+    BOOST_CHECK_EQUAL(higher_layer.wordAt(0), "REQUEST");
+    BOOST_CHECK_EQUAL(*higher_layer.uintAt(1), 42);
+    BOOST_CHECK_EQUAL(higher_layer.wordAt(2), "Minigame");
+    BOOST_CHECK_EQUAL(higher_layer.unparsed(), "MOVE 1 2 ");
+
+    // Not enough words remaining after lower layer
+    BOOST_CHECK(!(NoThrowParser { higher_layer, 4 }).hasExpectedWords());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,65 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <RpT-Utils/ThreadAffinity.hpp>
+
+#include <sched.h>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(ThreadAffinityTests)
+
+
+// Pinning is done from a dedicated thread so test runner thread affinity isn't modified
+
+BOOST_AUTO_TEST_CASE(PinnedToCore) {
+    int running_cpu { -1 };
+    std::thread pinned_thread { [&running_cpu]() {
+        pinCurrentThread(0);
+
+        running_cpu = sched_getcpu();
+    } };
+
+    pinned_thread.join();
+
+    BOOST_CHECK_EQUAL(running_cpu, 0);
+}
+
+BOOST_AUTO_TEST_CASE(UnavailableCore) {
+    bool thrown { false };
+    std::thread pinned_thread { [&thrown]() {
+        try {
+            pinCurrentThread(1u << 20);
+        } catch (const std::system_error&) {
+            thrown = true;
+        }
+    } };
+
+    pinned_thread.join();
+
+    BOOST_CHECK(thrown);
+}
+
+BOOST_AUTO_TEST_CASE(OtherThreadPinned) {
+    std::atomic<bool> pinned { false };
+    int running_cpu { -1 };
+    std::thread pinned_thread { [&pinned, &running_cpu]() {
+        while (!pinned)
+            std::this_thread::yield();
+
+        running_cpu = sched_getcpu();
+    } };
+
+    pinThread(pinned_thread, 0);
+    pinned = true;
+    pinned_thread.join();
+
+    BOOST_CHECK_EQUAL(running_cpu, 0);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -31,6 +31,27 @@ BOOST_AUTO_TEST_CASE(Constructor) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(Slack) {
+    const Timer exact_timer { tokens_provider, 1000 };
+    const Timer coalesced_timer { tokens_provider, 1000, 100 };
+
+    BOOST_CHECK_EQUAL(exact_timer.slack(), 0); // Must trigger on time by default
+    BOOST_CHECK_EQUAL(coalesced_timer.slack(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(CoalescedDeadline) {
+    // Without slack, deadline is exact
+    BOOST_CHECK_EQUAL(coalescedDeadline(1234, 1000, 0), 2234);
+    BOOST_CHECK_EQUAL(coalescedDeadline(1234, 1000, 1), 2234);
+
+    // Countdowns expiring inside same slack window share their deadline
+    BOOST_CHECK_EQUAL(coalescedDeadline(1201, 1000, 100), 2300);
+    BOOST_CHECK_EQUAL(coalescedDeadline(1299, 1000, 100), 2300);
+    // Exact deadline already aligned isn't delayed
+    BOOST_CHECK_EQUAL(coalescedDeadline(1300, 1000, 100), 2300);
+    BOOST_CHECK_EQUAL(coalescedDeadline(1301, 1000, 100), 2400);
+}
+
 /*
  * Current state accessors unit tests
  */
@@ -0,0 +1,164 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <map>
+#include <random>
+#include <vector>
+#include <RpT-Network/TimerWheel.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+/// Advances given wheel until given tick, retrieving expired tokens in expiration order
+std::vector<std::uint64_t> advanceUntil(TimerWheel& wheel, const std::uint64_t tick) {
+    std::vector<std::uint64_t> expired_tokens;
+    wheel.advance(tick, [&expired_tokens](const std::uint64_t token) {
+        expired_tokens.push_back(token);
+    });
+
+    return expired_tokens;
+}
+
+/// Checks for given tokens to be the ones expired while advancing given wheel until given tick, in same order
+void checkExpiredUntil(TimerWheel& wheel, const std::uint64_t tick, const std::vector<std::uint64_t>& expected_tokens) {
+    const std::vector<std::uint64_t> expired_tokens { advanceUntil(wheel, tick) };
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(expired_tokens.cbegin(), expired_tokens.cend(),
+                                  expected_tokens.cbegin(), expected_tokens.cend());
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(TimerWheelTests)
+
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    TimerWheel wheel;
+
+    BOOST_CHECK_EQUAL(wheel.size(), 0);
+    BOOST_CHECK(!wheel.nextTick().has_value());
+    BOOST_CHECK(advanceUntil(wheel, 1000).empty());
+    BOOST_CHECK_EQUAL(wheel.currentTick(), 1001);
+}
+
+BOOST_AUTO_TEST_CASE(ExpiresAtDeadline) {
+    TimerWheel wheel { 10 };
+    wheel.schedule(42, 30);
+
+    BOOST_CHECK_EQUAL(wheel.size(), 1);
+    BOOST_CHECK_EQUAL(*wheel.nextTick(), 30);
+
+    BOOST_CHECK(advanceUntil(wheel, 29).empty());
+    checkExpiredUntil(wheel, 30, { 42 });
+    BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PassedDeadline) {
+    TimerWheel wheel { 100 };
+    wheel.schedule(42, 50);
+
+    // Expires at next handled tick
+    BOOST_CHECK_EQUAL(*wheel.nextTick(), 100);
+    checkExpiredUntil(wheel, 100, { 42 });
+}
+
+BOOST_AUTO_TEST_CASE(DeadlinesOrder) {
+    TimerWheel wheel;
+    // Spread across every level
+    wheel.schedule(3, 5000);
+    wheel.schedule(1, 10);
+    wheel.schedule(4, 300000);
+    wheel.schedule(2, 100);
+
+    checkExpiredUntil(wheel, 300000, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(DeadlineBeyondLevels) {
+    TimerWheel wheel;
+    const std::uint64_t far_deadline { 3 * (std::uint64_t { 1 } << (TimerWheel::SLOT_BITS * TimerWheel::LEVELS)) };
+
+    wheel.schedule(42, far_deadline);
+
+    BOOST_CHECK(advanceUntil(wheel, far_deadline - 1).empty());
+    checkExpiredUntil(wheel, far_deadline, { 42 });
+}
+
+BOOST_AUTO_TEST_CASE(Cancel) {
+    TimerWheel wheel;
+    wheel.schedule(1, 10);
+    wheel.schedule(2, 10);
+    wheel.schedule(3, 10000);
+
+    BOOST_CHECK(wheel.cancel(1));
+    BOOST_CHECK(wheel.cancel(3));
+    BOOST_CHECK(!wheel.cancel(3)); // Already cancelled
+    BOOST_CHECK(!wheel.cancel(4)); // Never scheduled
+
+    checkExpiredUntil(wheel, 20000, { 2 });
+    BOOST_CHECK(!wheel.cancel(2)); // Already expired
+}
+
+BOOST_AUTO_TEST_CASE(AlreadyScheduled) {
+    TimerWheel wheel;
+    wheel.schedule(42, 10);
+
+    BOOST_CHECK_THROW(wheel.schedule(42, 20), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(RescheduledFromHandler) {
+    TimerWheel wheel;
+    wheel.schedule(42, 10);
+
+    // Token is scheduled again each time it expires, simulating a restarted countdown
+    std::vector<std::uint64_t> expiration_ticks;
+    wheel.advance(100, [&wheel, &expiration_ticks](const std::uint64_t token) {
+        expiration_ticks.push_back(wheel.currentTick());
+        wheel.schedule(token, wheel.currentTick() + 30);
+    });
+
+    const std::vector<std::uint64_t> expected_ticks { 10, 40, 70, 100 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(expiration_ticks.cbegin(), expiration_ticks.cend(),
+                                  expected_ticks.cbegin(), expected_ticks.cend());
+}
+
+BOOST_AUTO_TEST_CASE(NextTickNeverLate) {
+    std::mt19937_64 random_engine { 42 };
+    std::uniform_int_distribution<std::uint64_t> delays { 0, 100000 };
+
+    TimerWheel wheel;
+    // Expected deadline for each token
+    std::map<std::uint64_t, std::uint64_t> deadlines;
+
+    for (std::uint64_t token { 0 }; token < 1000; token++) {
+        const std::uint64_t deadline { delays(random_engine) };
+
+        wheel.schedule(token, deadline);
+        deadlines.insert({ token, deadline });
+
+        if (token % 3 == 0) { // Some tokens are cancelled
+            wheel.cancel(token);
+            deadlines.erase(token);
+        }
+    }
+
+    // Advancing only to next ticks, as a driving timer would do, must expire every token exactly at its deadline
+    while (wheel.nextTick().has_value()) {
+        const std::uint64_t next_tick { *wheel.nextTick() };
+
+        wheel.advance(next_tick, [&deadlines, next_tick](const std::uint64_t token) {
+            BOOST_REQUIRE_EQUAL(deadlines.at(token), next_tick);
+            deadlines.erase(token);
+        });
+    }
+
+    BOOST_CHECK(deadlines.empty());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
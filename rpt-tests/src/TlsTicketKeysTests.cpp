@@ -0,0 +1,83 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Network/TlsTicketKeys.hpp>
+
+
+using namespace RpT::Network;
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+constexpr std::chrono::seconds ROTATION_PERIOD { 60 };
+
+
+/// Checks if both keys have the same name, so tickets encrypted by one are found for other
+bool sameKey(const TlsTicketKeys::Key& lhs, const TlsTicketKeys::Key& rhs) {
+    return lhs.name == rhs.name;
+}
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(TlsTicketKeysTests)
+
+
+BOOST_AUTO_TEST_CASE(NotExpired) {
+    TlsTicketKeys keys { ROTATION_PERIOD };
+    const auto now { std::chrono::steady_clock::now() };
+
+    const TlsTicketKeys::Key first_key { keys.encryptionKey(now) };
+    // Key must not be rotated before period is over
+    BOOST_CHECK(sameKey(keys.encryptionKey(now + ROTATION_PERIOD / 2), first_key));
+
+    const auto decryption_key { keys.decryptionKey(first_key.name.data(), now + ROTATION_PERIOD / 2) };
+    BOOST_REQUIRE(decryption_key.has_value());
+    BOOST_CHECK(sameKey(decryption_key->key, first_key));
+    BOOST_CHECK(!decryption_key->renew); // Current key, ticket doesn't have to be renewed
+}
+
+BOOST_AUTO_TEST_CASE(RotatedOnce) {
+    TlsTicketKeys keys { ROTATION_PERIOD };
+    const auto now { std::chrono::steady_clock::now() };
+
+    const TlsTicketKeys::Key first_key { keys.encryptionKey(now) };
+    const TlsTicketKeys::Key second_key { keys.encryptionKey(now + ROTATION_PERIOD * 3 / 2) };
+    // Key must have been rotated
+    BOOST_CHECK(!sameKey(first_key, second_key));
+
+    // Ticket encrypted with previous key is still valid, but must be renewed
+    const auto decryption_key { keys.decryptionKey(first_key.name.data(), now + ROTATION_PERIOD * 3 / 2) };
+    BOOST_REQUIRE(decryption_key.has_value());
+    BOOST_CHECK(sameKey(decryption_key->key, first_key));
+    BOOST_CHECK(decryption_key->renew);
+}
+
+BOOST_AUTO_TEST_CASE(RotatedTwice) {
+    TlsTicketKeys keys { ROTATION_PERIOD };
+    const auto now { std::chrono::steady_clock::now() };
+
+    const TlsTicketKeys::Key first_key { keys.encryptionKey(now) };
+    keys.encryptionKey(now + ROTATION_PERIOD * 3 / 2); // Rotates first time
+    keys.encryptionKey(now + ROTATION_PERIOD * 3); // Rotates second time
+
+    // First key has expired, tickets encrypted with it need a full handshake
+    BOOST_CHECK(!keys.decryptionKey(first_key.name.data(), now + ROTATION_PERIOD * 3).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(IdleForTwoPeriods) {
+    TlsTicketKeys keys { ROTATION_PERIOD };
+    const auto now { std::chrono::steady_clock::now() };
+
+    const TlsTicketKeys::Key first_key { keys.encryptionKey(now) };
+    // No rotation happened during 2 periods, first key must not be kept as previous key
+    const TlsTicketKeys::Key second_key { keys.encryptionKey(now + ROTATION_PERIOD * 5 / 2) };
+
+    BOOST_CHECK(!sameKey(first_key, second_key));
+    BOOST_CHECK(!keys.decryptionKey(first_key.name.data(), now + ROTATION_PERIOD * 5 / 2).has_value());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <new>
+#include <string_view>
+#include <RpT-Utils/TextProtocolParser.hpp>
+
+/*
+ * Utils benchmarks suite, run it from a Release build. Results are written as JSON by `benchmarks-report` target.
+ */
+
+
+namespace {
+
+
+/// Typical RPTL message carrying a SR command, parsed by every protocol layer on inbound path
+constexpr std::string_view SR_MESSAGE { "SERVICE REQUEST 42 Chat Hello world, this is a chat message" };
+
+
+/// Gives access to parsed words, so they can be retrieved like protocols do
+class ProtocolLayerParser : public RpT::Utils::TextProtocolParser {
+public:
+    ProtocolLayerParser(const std::string_view protocol_command, const unsigned int expected_words)
+    : RpT::Utils::TextProtocolParser { protocol_command, expected_words, std::nothrow } {}
+
+    ProtocolLayerParser(const ProtocolLayerParser& previous_layer, const unsigned int expected_words)
+    : RpT::Utils::TextProtocolParser { previous_layer, expected_words, std::nothrow } {}
+
+    std::string_view word(const std::size_t i) const {
+        return getParsedWord(i);
+    }
+
+    std::string_view unparsed() const {
+        return unparsedWords();
+    }
+};
+
+
+/// Parses RPTL command name only, like RPTL protocol does
+void TextProtocolParserSingleLayer(benchmark::State& state) {
+    for (auto _ : state) {
+        const ProtocolLayerParser rptl_parser { SR_MESSAGE, 1 };
+
+        benchmark::DoNotOptimize(rptl_parser.word(0));
+        benchmark::DoNotOptimize(rptl_parser.unparsed());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * SR_MESSAGE.size()));
+}
+
+/// Parses RPTL, then SER, then service name layers, each one continuing where previous one stopped
+void TextProtocolParserLayers(benchmark::State& state) {
+    for (auto _ : state) {
+        const ProtocolLayerParser rptl_parser { SR_MESSAGE, 1 };
+        const ProtocolLayerParser ser_parser { rptl_parser, 2 };
+        const ProtocolLayerParser service_parser { ser_parser, 1 };
+
+        benchmark::DoNotOptimize(ser_parser.word(1));
+        benchmark::DoNotOptimize(service_parser.word(0));
+        benchmark::DoNotOptimize(service_parser.unparsed());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * SR_MESSAGE.size()));
+}
+
+
+}
+
+
+BENCHMARK(TextProtocolParserSingleLayer);
+BENCHMARK(TextProtocolParserLayers);
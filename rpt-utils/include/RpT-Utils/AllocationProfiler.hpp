@@ -0,0 +1,179 @@
+#ifndef RPT_MINIGAMES_SERVER_ALLOCATIONPROFILER_HPP
+#define RPT_MINIGAMES_SERVER_ALLOCATIONPROFILER_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <RpT-Config/Config.hpp>
+
+/**
+ * @file AllocationProfiler.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Server part heap allocations are attributed to, selected for current thread with `AllocationScope`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+enum struct AllocationSubsystem : std::size_t {
+    /// Allocations outside of any tagged scope
+    Other,
+    /// Network backend, client messages parsing, queuing and RPTL handling
+    Network,
+    /// Service Event Request protocol, SR commands parsing and service events polling
+    Ser,
+    /// Services handling SR commands, timers and actors updates
+    Services,
+    /// Board games rules run by minigame services
+    Games
+};
+
+
+/**
+ * @brief Heap allocations count and their total size
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct AllocationCounts {
+    /// Number of `operator new` calls
+    std::uint64_t allocations { 0 };
+    /// Number of bytes requested by these calls
+    std::uint64_t bytes { 0 };
+
+    /// Counts done between `since` and these counts
+    AllocationCounts operator-(const AllocationCounts& since) const {
+        return { allocations - since.allocations, bytes - since.bytes };
+    }
+};
+
+
+/**
+ * @brief Process-wide heap allocations counters, for each `AllocationSubsystem` and for each input event type
+ *
+ * Counters are updated by global `operator new` replacements, only compiled with CMake option
+ * `RPT_ALLOCATION_PROFILING`. Otherwise, `ENABLED` is `false` and every counter stays at 0, so instrumented code
+ * checks it with `if constexpr` to pay nothing in regular builds.
+ *
+ * Allocations are attributed to subsystem selected by innermost `AllocationScope` on allocating thread. Each thread
+ * also keeps its own totals, so executor retrieves allocations done while an input event was handled.
+ *
+ * Aligned `operator new` overloads aren't replaced, such allocations aren't counted.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class AllocationProfiler {
+public:
+    /// `true` if built with allocation profiling, so counters are actually updated
+    static constexpr bool ENABLED { RPT_ALLOCATION_PROFILING == 1 };
+
+    /// Number of available subsystems
+    static constexpr std::size_t SUBSYSTEMS_COUNT { 5 };
+
+    /**
+     * @brief Retrieves name used to label given subsystem
+     *
+     * @param subsystem Subsystem to get name for
+     *
+     * @returns Lowercase subsystem name
+     */
+    static std::string_view subsystemName(AllocationSubsystem subsystem);
+
+    /**
+     * @brief Counts an allocation for current thread subsystem, called by global `operator new` replacements
+     *
+     * @param bytes Requested allocation size
+     */
+    static void allocated(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Selects subsystem allocations are attributed to for current thread
+     *
+     * @param subsystem Subsystem to attribute next allocations to
+     *
+     * @returns Previously selected subsystem, so it can be restored
+     */
+    static AllocationSubsystem select(AllocationSubsystem subsystem) noexcept;
+
+    /**
+     * @brief Retrieves allocations attributed to given subsystem, across every thread
+     *
+     * @param subsystem Subsystem to retrieve counts for
+     *
+     * @returns Allocations counted until now
+     */
+    static AllocationCounts subsystem(AllocationSubsystem subsystem);
+
+    /**
+     * @brief Retrieves allocations done by current thread, any subsystem
+     *
+     * @returns Allocations counted until now for calling thread
+     */
+    static AllocationCounts currentThread();
+
+    /**
+     * @brief Adds allocations done while an input event was handled to given event type totals
+     *
+     * @param event_type Handled input event type name, used as label
+     * @param allocations Allocations done to handle that event
+     */
+    static void inputEventHandled(std::string_view event_type, AllocationCounts allocations);
+
+    /**
+     * @brief Writes every counter as Prometheus text samples, with their type
+     *
+     * Subsystems are exported as `rpt_allocations_total` and `rpt_allocated_bytes_total` with a `subsystem` label,
+     * input events as `rpt_input_event_allocations_total` and `rpt_input_event_allocated_bytes_total` with an
+     * `event` label, alongside `rpt_profiled_input_events_total`.
+     *
+     * @param output Stream to write samples into
+     */
+    static void exportTo(std::ostream& output);
+};
+
+
+/**
+ * @brief RAII scope attributing current thread allocations to a subsystem, until it is destroyed
+ *
+ * Scopes can be nested, previous subsystem is restored at destruction. Does nothing if `AllocationProfiler::ENABLED`
+ * is `false`.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class AllocationScope {
+private:
+    AllocationSubsystem previous_;
+
+public:
+    /**
+     * @brief Attributes next allocations of current thread to given subsystem
+     *
+     * @param subsystem Subsystem to attribute allocations to
+     */
+    explicit AllocationScope(const AllocationSubsystem subsystem) : previous_ { AllocationSubsystem::Other } {
+        if constexpr (AllocationProfiler::ENABLED)
+            previous_ = AllocationProfiler::select(subsystem);
+    }
+
+    /// Restores previously selected subsystem
+    ~AllocationScope() {
+        if constexpr (AllocationProfiler::ENABLED)
+            AllocationProfiler::select(previous_);
+    }
+
+    /*
+     * Entity class semantic
+     */
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_ALLOCATIONPROFILER_HPP
@@ -0,0 +1,116 @@
+#ifndef RPTOGETHER_SERVER_ASYNCLOGGINGSINK_HPP
+#define RPTOGETHER_SERVER_ASYNCLOGGINGSINK_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+#include <RpT-Utils/LoggingContext.hpp>
+
+/**
+ * @file AsyncLoggingSink.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief spdlog sink which queues messages so they are written into backend sinks by a background flusher thread
+ *
+ * Logging thread only copies message inside a bounded queue, pattern formatting and writes to console or files are
+ * performed by flusher thread. Flush requests are deferred to flusher thread too, which flushes backend sinks once
+ * queued messages have been written.
+ *
+ * When queue is full, `LogOverflowPolicy` determines if logging thread waits for an available place, or if a
+ * message is dropped. Dropped messages are counted.
+ *
+ * @note Backend sinks are only accessed by flusher thread or while holding a mutex, so single-threaded sinks can be
+ * used.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class AsyncLoggingSink : public spdlog::sinks::sink {
+private:
+    const std::size_t queue_capacity_;
+    const LogOverflowPolicy overflow_policy_;
+
+    std::mutex queue_mutex_;
+    // Notified when a message is queued, a flush is requested or sink is stopping
+    std::condition_variable queue_filled_;
+    // Notified when messages have been dequeued by flusher
+    std::condition_variable queue_emptied_;
+    std::deque<spdlog::details::log_msg_buffer> queued_messages_;
+    bool flush_requested_;
+    bool stopping_;
+
+    std::atomic<std::size_t> dropped_messages_;
+
+    // Guards backend sinks for pattern modifications from logging threads
+    std::mutex backends_mutex_;
+    std::vector<spdlog::sink_ptr> backends_;
+
+    // Started last, once every other member is initialized
+    std::thread flusher_;
+
+    /// Flusher thread loop, writes queued messages until sink is stopping and queue is empty
+    void flushQueue();
+
+public:
+    /**
+     * @brief Constructs sink and starts its flusher thread
+     *
+     * @param backends Sinks receiving queued messages
+     * @param queue_capacity Maximum number of messages waiting for flusher thread
+     * @param overflow_policy Behavior when a message is logged while queue is full
+     *
+     * @throws std::invalid_argument if `queue_capacity == 0`
+     */
+    AsyncLoggingSink(std::vector<spdlog::sink_ptr> backends, std::size_t queue_capacity,
+                     LogOverflowPolicy overflow_policy);
+
+    /// Writes and flushes remaining queued messages, then joins flusher thread
+    ~AsyncLoggingSink() override;
+
+    /*
+     * Entity class semantic
+     */
+
+    AsyncLoggingSink(const AsyncLoggingSink&) = delete;
+    AsyncLoggingSink& operator=(const AsyncLoggingSink&) = delete;
+
+    /**
+     * @brief Queues a copy of given message, waiting or dropping a message if queue is full depending on overflow
+     * policy
+     *
+     * @param msg Message to write into backend sinks
+     */
+    void log(const spdlog::details::log_msg& msg) override;
+
+    /// Requests flusher thread to flush backend sinks once queued messages have been written, without waiting
+    void flush() override;
+
+    /// Sets pattern for every backend sink
+    void set_pattern(const std::string& pattern) override;
+
+    /// Sets a copy of given formatter for every backend sink
+    void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+    /**
+     * @brief Retrieves number of messages dropped because queue was full
+     *
+     * @returns Dropped messages count, always 0 with `LogOverflowPolicy::BLOCK`
+     */
+    std::size_t droppedMessages() const;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_ASYNCLOGGINGSINK_HPP
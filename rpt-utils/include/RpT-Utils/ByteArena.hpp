@@ -0,0 +1,90 @@
+#ifndef RPT_MINIGAMES_SERVER_BYTEARENA_HPP
+#define RPT_MINIGAMES_SERVER_BYTEARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file ByteArena.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Growable storage for strings which are all released at once, keeping its chunks from one reset to the next
+ *
+ * Copied strings are bumped inside fixed-size chunks, and never move once they have been copied, so views on them stay
+ * valid until next reset. When a string doesn't fit inside remaining chunks, a new chunk is allocated, large enough for
+ * that string. Reset makes every chunk available again without freeing any, so an arena which has grown for its steady
+ * usage doesn't allocate anymore.
+ *
+ * Unlike `IterationArena`, chunks are only allocated once a string is copied, so arenas owned by many idle objects
+ * don't cost any memory.
+ *
+ * Arena isn't thread-safe.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class ByteArena {
+public:
+    /// Chunk size, in bytes, if none is given
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE { 2048 };
+
+private:
+    /// Fixed-size storage strings are copied into
+    struct Chunk {
+        std::unique_ptr<char[]> bytes;
+        std::size_t size;
+    };
+
+    const std::size_t chunk_size_;
+    std::vector<Chunk> chunks_;
+    // Chunk strings are currently copied into, equals to chunks count if every chunk is full
+    std::size_t current_chunk_;
+    // Bytes used inside current chunk
+    std::size_t used_bytes_;
+
+public:
+    /**
+     * @brief Constructs arena without any chunk
+     *
+     * @param chunk_size Size of allocated chunks, in bytes, unless a larger string must be copied
+     *
+     * @throws std::invalid_argument if chunk size is 0
+     */
+    explicit ByteArena(std::size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+    /*
+     * Entity class semantic
+     */
+
+    ByteArena(const ByteArena&) = delete;
+    ByteArena& operator=(const ByteArena&) = delete;
+
+    /**
+     * @brief Copies given string into arena
+     *
+     * @param bytes String to copy
+     *
+     * @returns View on copied string, valid until next `reset()` call
+     */
+    std::string_view copy(std::string_view bytes);
+
+    /**
+     * @brief Makes every chunk available again, invalidating every copied string
+     */
+    void reset();
+
+    /// Retrieves number of allocated chunks
+    std::size_t chunksCount() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_BYTEARENA_HPP
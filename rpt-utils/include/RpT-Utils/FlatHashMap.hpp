@@ -0,0 +1,397 @@
+#ifndef RPT_MINIGAMES_SERVER_FLATHASHMAP_HPP
+#define RPT_MINIGAMES_SERVER_FLATHASHMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * @file FlatHashMap.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Open-addressing hash table storing its entries inside a single contiguous array, with linear probing
+ *
+ * Unlike `std::unordered_map`, an entry isn't a separately allocated node, so lookup reads neighbouring slots instead
+ * of following pointers, and inserting doesn't allocate unless table grows. Hashes are mixed with a Fibonacci
+ * multiplier, so sequential or aligned integer keys are still spread across slots. Erased entries are filled back by
+ * shifting following ones, so no tombstone ever slows lookups down.
+ *
+ * Interface mirrors a subset of `std::unordered_map`, but entries are moved when table grows or when an entry is
+ * erased, so every reference and iterator is invalidated by insertion and erasure. Entry keys must not be modified
+ * through iterators.
+ *
+ * @tparam Key Entry key type, copyable and equality comparable
+ * @tparam Value Entry value type, movable
+ * @tparam Hash Hash function for keys
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatHashMap {
+public:
+    /// Entry stored inside table slots
+    using value_type = std::pair<Key, Value>;
+
+private:
+    using Slot = std::optional<value_type>;
+
+    /// Slots count for first allocated array
+    static constexpr std::size_t MIN_CAPACITY { 16 };
+    /// Fibonacci hashing multiplier, 2^64 divided by golden ratio
+    static constexpr std::uint64_t HASH_MULTIPLIER { 0x9E3779B97F4A7C15 };
+
+    /// Iterates over occupied slots only
+    template<typename SlotPointer, typename Entry>
+    class BasicIterator {
+    private:
+        SlotPointer current_;
+        SlotPointer end_;
+
+        void skipEmptySlots() {
+            while (current_ != end_ && !current_->has_value())
+                ++current_;
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Entry*;
+        using reference = Entry&;
+
+        BasicIterator() : current_ { nullptr }, end_ { nullptr } {}
+
+        BasicIterator(const SlotPointer current, const SlotPointer end) : current_ { current }, end_ { end } {
+            skipEmptySlots();
+        }
+
+        /// Non-const iterator is convertible to const iterator
+        template<typename OtherSlotPointer, typename OtherEntry>
+        BasicIterator(const BasicIterator<OtherSlotPointer, OtherEntry>& rhs)
+        : current_ { rhs.current_ }, end_ { rhs.end_ } {}
+
+        Entry& operator*() const {
+            return **current_;
+        }
+
+        Entry* operator->() const {
+            return &**current_;
+        }
+
+        BasicIterator& operator++() {
+            ++current_;
+            skipEmptySlots();
+
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous { *this };
+            ++*this;
+
+            return previous;
+        }
+
+        bool operator==(const BasicIterator& rhs) const {
+            return current_ == rhs.current_;
+        }
+
+        bool operator!=(const BasicIterator& rhs) const {
+            return current_ != rhs.current_;
+        }
+
+        template<typename, typename>
+        friend class BasicIterator;
+
+        friend class FlatHashMap;
+    };
+
+public:
+    using iterator = BasicIterator<Slot*, value_type>;
+    using const_iterator = BasicIterator<const Slot*, const value_type>;
+
+private:
+    std::vector<Slot> slots_;
+    std::size_t size_;
+    // Bits dropped from mixed hash so remaining ones index slots array, slots count being a power of 2
+    unsigned int hash_shift_;
+    Hash hash_;
+
+    /// Retrieves slot index given key should be stored at, before any collision
+    std::size_t idealIndex(const Key& key) const {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(hash_(key)) * HASH_MULTIPLIER) >> hash_shift_);
+    }
+
+    /// Retrieves index for slot storing given key, or slots count if it isn't inside table
+    std::size_t indexOf(const Key& key) const {
+        if (slots_.empty())
+            return 0;
+
+        const std::size_t mask { slots_.size() - 1 };
+
+        // Probing stops at first empty slot, as erasure never leaves a hole inside a probe sequence
+        for (std::size_t i { idealIndex(key) }; slots_[i].has_value(); i = (i + 1) & mask) {
+            if (slots_[i]->first == key)
+                return i;
+        }
+
+        return slots_.size();
+    }
+
+    /// Reallocates slots array with given power of 2 slots count, then moves every entry inside it
+    void rehash(const std::size_t capacity) {
+        std::vector<Slot> previous_slots(capacity); // Braces would select initializer list constructor
+        previous_slots.swap(slots_);
+
+        hash_shift_ = 64;
+        for (std::size_t remaining_slots { capacity }; remaining_slots > 1; remaining_slots >>= 1)
+            hash_shift_--;
+
+        const std::size_t mask { capacity - 1 };
+        for (Slot& previous_slot : previous_slots) {
+            if (!previous_slot.has_value())
+                continue;
+
+            std::size_t i { idealIndex(previous_slot->first) };
+            while (slots_[i].has_value())
+                i = (i + 1) & mask;
+
+            slots_[i].emplace(std::move(*previous_slot));
+        }
+    }
+
+    /// Grows slots array if one more entry would exceed 3/4 load factor
+    void reserveForInsertion() {
+        if (slots_.empty())
+            rehash(MIN_CAPACITY);
+        else if ((size_ + 1) * 4 > slots_.size() * 3)
+            rehash(slots_.size() * 2);
+    }
+
+    /// Empties slot at given index, then shifts following entries back so none of them is unreachable
+    void eraseAt(std::size_t hole) {
+        const std::size_t mask { slots_.size() - 1 };
+
+        for (std::size_t next { (hole + 1) & mask }; slots_[next].has_value(); next = (next + 1) & mask) {
+            const std::size_t next_ideal { idealIndex(slots_[next]->first) };
+
+            // Entry can be moved back only if hole lies between its ideal slot and its current slot
+            if (((next - next_ideal) & mask) >= ((next - hole) & mask)) {
+                slots_[hole] = std::move(slots_[next]);
+                hole = next;
+            }
+        }
+
+        slots_[hole].reset();
+        size_--;
+    }
+
+public:
+    /// Constructs empty table, no slot is allocated until first insertion
+    FlatHashMap() : size_ { 0 }, hash_shift_ { 64 } {}
+
+    iterator begin() {
+        return { slots_.data(), slots_.data() + slots_.size() };
+    }
+
+    iterator end() {
+        return { slots_.data() + slots_.size(), slots_.data() + slots_.size() };
+    }
+
+    const_iterator begin() const {
+        return { slots_.data(), slots_.data() + slots_.size() };
+    }
+
+    const_iterator end() const {
+        return { slots_.data() + slots_.size(), slots_.data() + slots_.size() };
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    /// Retrieves number of entries inside table
+    std::size_t size() const {
+        return size_;
+    }
+
+    /// Checks if table doesn't contain any entry
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Retrieves entry for given key
+     *
+     * @param key Key to look for
+     *
+     * @returns Iterator to entry, `end()` if key isn't inside table
+     */
+    iterator find(const Key& key) {
+        return { slots_.data() + indexOf(key), slots_.data() + slots_.size() };
+    }
+
+    /// Const version of `find()`
+    const_iterator find(const Key& key) const {
+        return { slots_.data() + indexOf(key), slots_.data() + slots_.size() };
+    }
+
+    /**
+     * @brief Checks if table contains given key
+     *
+     * @param key Key to look for
+     *
+     * @returns 1 if key is inside table, 0 otherwise
+     */
+    std::size_t count(const Key& key) const {
+        return indexOf(key) == slots_.size() ? 0 : 1;
+    }
+
+    /**
+     * @brief Retrieves value for given key
+     *
+     * @param key Key to look for
+     *
+     * @returns Value associated with key
+     *
+     * @throws std::out_of_range if key isn't inside table
+     */
+    Value& at(const Key& key) {
+        const std::size_t i { indexOf(key) };
+        if (i == slots_.size())
+            throw std::out_of_range { "Key isn't inside flat hash map" };
+
+        return slots_[i]->second;
+    }
+
+    /// Const version of `at()`
+    const Value& at(const Key& key) const {
+        const std::size_t i { indexOf(key) };
+        if (i == slots_.size())
+            throw std::out_of_range { "Key isn't inside flat hash map" };
+
+        return slots_[i]->second;
+    }
+
+    /**
+     * @brief Inserts entry constructed from given key and value arguments, unless key is already inside table
+     *
+     * @param key Key for new entry
+     * @param value_args Arguments to construct new entry value with
+     *
+     * @returns Iterator to entry with given key, and `true` if it has been inserted
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... value_args) {
+        const std::size_t existing_index { indexOf(key) };
+        if (existing_index != slots_.size())
+            return { { slots_.data() + existing_index, slots_.data() + slots_.size() }, false };
+
+        reserveForInsertion();
+
+        const std::size_t mask { slots_.size() - 1 };
+        std::size_t i { idealIndex(key) };
+        while (slots_[i].has_value())
+            i = (i + 1) & mask;
+
+        slots_[i].emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(value_args)...));
+        size_++;
+
+        return { { slots_.data() + i, slots_.data() + slots_.size() }, true };
+    }
+
+    /**
+     * @brief Inserts given entry, unless its key is already inside table
+     *
+     * @param entry Entry to insert
+     *
+     * @returns Iterator to entry with same key, and `true` if it has been inserted
+     */
+    std::pair<iterator, bool> insert(value_type entry) {
+        return try_emplace(entry.first, std::move(entry.second));
+    }
+
+    /**
+     * @brief Retrieves value for given key, inserting a default constructed one if key isn't inside table
+     *
+     * @param key Key to look for
+     *
+     * @returns Value associated with key
+     */
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Removes entry for given key, if any
+     *
+     * @param key Key to remove
+     *
+     * @returns Number of removed entries, 0 or 1
+     */
+    std::size_t erase(const Key& key) {
+        const std::size_t i { indexOf(key) };
+        if (i == slots_.size())
+            return 0;
+
+        eraseAt(i);
+
+        return 1;
+    }
+
+    /**
+     * @brief Removes entry given iterator points to
+     *
+     * As following entries might be shifted back, no iterator to next entry is returned: table must not be erased
+     * while it is iterated over.
+     *
+     * @param entry Iterator to an entry inside table, must not be `end()`
+     */
+    void erase(const const_iterator entry) {
+        eraseAt(static_cast<std::size_t>(entry.current_ - slots_.data()));
+    }
+
+    /**
+     * @brief Allocates enough slots for given entries count to be inserted without growing again
+     *
+     * @param entries_count Expected entries count
+     */
+    void reserve(const std::size_t entries_count) {
+        std::size_t capacity { slots_.empty() ? MIN_CAPACITY : slots_.size() };
+        while (entries_count * 4 > capacity * 3)
+            capacity *= 2;
+
+        if (capacity != slots_.size())
+            rehash(capacity);
+    }
+
+    /// Removes every entry, keeping allocated slots
+    void clear() {
+        for (Slot& slot : slots_)
+            slot.reset();
+
+        size_ = 0;
+    }
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_FLATHASHMAP_HPP
@@ -1,9 +1,10 @@
 #ifndef RPTOGETHER_SERVER_HANDLINGRESULT_HPP
 #define RPTOGETHER_SERVER_HANDLINGRESULT_HPP
 
-#include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <variant>
 
 /**
  * @file HandlingResult.hpp
@@ -27,16 +28,32 @@ public:
 };
 
 
+/**
+ * @brief Error message from a handler messages table, referenced by `HandlingResult` instead of being copied
+ *
+ * Message must outlive every result using it: it is expected to be a string literal, or a message formatted once and
+ * owned by handler object, for errors a client can trigger at a high rate.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct StaticErrorMessage {
+    /// Referenced message
+    std::string_view message;
+};
+
+
 /**
  * @brief Provides information about handler execution errors, if any occurred
  *
- * Allows to know if handler was done successfully, and if not, what happened during execution
+ * Allows to know if handler was done successfully, and if not, what happened during execution. Common errors reference
+ * a `StaticErrorMessage` so they don't allocate, dynamic messages are owned by result.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
 class HandlingResult {
 private:
-    std::optional<std::string> possible_error_message_;
+    // Empty if handler succeeded, view for static error messages, string for dynamic ones
+    std::variant<std::monostate, std::string_view, std::string> possible_error_message_;
 
 public:
     /**
@@ -51,6 +68,13 @@ public:
      */
     explicit HandlingResult(std::string error_message);
 
+    /**
+     * @brief Error occurred during handler exec, described by a message which isn't copied
+     *
+     * @param error_message Message describing what kind of error happened, must outlive constructed result
+     */
+    explicit HandlingResult(StaticErrorMessage error_message);
+
     /**
      * @brief Has the handler completed successfully ?
      *
@@ -61,11 +85,11 @@ public:
     /**
      * @brief Gets error which happened during handler execution
      *
-     * @returns Error message
+     * @returns Error message, valid as long as this result and the static message it might reference
      *
      * @throws NoErrorMessage if handler actually completed successfully
      */
-    const std::string& errorMessage() const;
+    std::string_view errorMessage() const;
 };
 
 
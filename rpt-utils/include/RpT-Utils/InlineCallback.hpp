@@ -0,0 +1,217 @@
+#ifndef RPT_MINIGAMES_SERVER_INLINECALLBACK_HPP
+#define RPT_MINIGAMES_SERVER_INLINECALLBACK_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file InlineCallback.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Move-only `void()` callable stored inside a fixed-size inline buffer, so wrapping it never allocates
+ *
+ * Unlike `std::function`, callable which doesn't fit inside buffer is rejected at compile time instead of being
+ * allocated on heap. Buffer is large enough for lambdas capturing a few pointers or integers, or for a
+ * `std::function`.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class InlineCallback {
+public:
+    /// Maximum size, in bytes, for wrapped callable
+    static constexpr std::size_t CAPACITY { 4 * sizeof(void*) };
+
+private:
+    /// Type-erased operations for wrapped callable
+    struct Operations {
+        void (*call)(void* callable);
+        // Move-constructs callable into destination buffer, then destroys source
+        void (*relocate)(void* source, void* destination) noexcept;
+        void (*destroy)(void* callable) noexcept;
+    };
+
+    template<typename Callable>
+    static constexpr Operations OPERATIONS_FOR {
+        [](void* const callable) {
+            (*static_cast<Callable*>(callable))();
+        },
+        [](void* const source, void* const destination) noexcept {
+            new (destination) Callable { std::move(*static_cast<Callable*>(source)) };
+            static_cast<Callable*>(source)->~Callable();
+        },
+        [](void* const callable) noexcept {
+            static_cast<Callable*>(callable)->~Callable();
+        }
+    };
+
+    alignas(std::max_align_t) unsigned char storage_[CAPACITY];
+    const Operations* operations_;
+
+    /// Destroys wrapped callable, if any
+    void reset() noexcept {
+        if (operations_) {
+            operations_->destroy(storage_);
+            operations_ = nullptr;
+        }
+    }
+
+public:
+    /// Constructs empty callback
+    InlineCallback() noexcept : operations_ { nullptr } {}
+
+    /**
+     * @brief Constructs callback wrapping given callable inside inline buffer
+     *
+     * @tparam Callable Callable type, invocable without argument, nothrow movable and fitting inside `CAPACITY`
+     *
+     * @param callable Callable to wrap, moved or copied
+     */
+    template<typename Callable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, InlineCallback>>>
+    InlineCallback(Callable&& callable) : operations_ { &OPERATIONS_FOR<std::decay_t<Callable>> } {
+        using StoredCallable = std::decay_t<Callable>;
+
+        static_assert(sizeof(StoredCallable) <= CAPACITY, "Callable too large for inline callback buffer");
+        static_assert(alignof(StoredCallable) <= alignof(std::max_align_t), "Callable over-aligned");
+        static_assert(std::is_nothrow_move_constructible_v<StoredCallable>, "Callable must be nothrow movable");
+        static_assert(std::is_invocable_v<StoredCallable&>, "Callable must be invocable without argument");
+
+        new (storage_) StoredCallable { std::forward<Callable>(callable) };
+    }
+
+    /*
+     * Move-only, as wrapped callable might not be copyable
+     */
+
+    InlineCallback(const InlineCallback&) = delete;
+    InlineCallback& operator=(const InlineCallback&) = delete;
+
+    /// Moves wrapped callable, if any, leaving given callback empty
+    InlineCallback(InlineCallback&& rhs) noexcept : operations_ { rhs.operations_ } {
+        if (operations_) {
+            operations_->relocate(rhs.storage_, storage_);
+            rhs.operations_ = nullptr;
+        }
+    }
+
+    /// Destroys current callable, if any, then moves given one, leaving given callback empty
+    InlineCallback& operator=(InlineCallback&& rhs) noexcept {
+        if (this != &rhs) {
+            reset();
+
+            if (rhs.operations_) {
+                rhs.operations_->relocate(rhs.storage_, storage_);
+                operations_ = rhs.operations_;
+                rhs.operations_ = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    /// Destroys wrapped callable, if any
+    ~InlineCallback() {
+        reset();
+    }
+
+    /**
+     * @brief Calls wrapped callable
+     *
+     * @throws std::bad_function_call if callback is empty
+     */
+    void operator()() {
+        if (!operations_)
+            throw std::bad_function_call {};
+
+        operations_->call(storage_);
+    }
+
+    /**
+     * @brief Checks if callback wraps a callable
+     *
+     * @returns `true` if callback isn't empty
+     */
+    explicit operator bool() const {
+        return operations_ != nullptr;
+    }
+};
+
+
+/**
+ * @brief Sequence of callbacks keeping its first ones inline, so registering a few of them never allocates
+ *
+ * Callbacks beyond inline slots are kept inside an overflow vector, which keeps its capacity once cleared.
+ *
+ * @tparam INLINE_SLOTS Number of callbacks stored without any allocation
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<std::size_t INLINE_SLOTS>
+class InlineCallbacks {
+private:
+    std::array<InlineCallback, INLINE_SLOTS> inline_callbacks_;
+    std::size_t inline_count_;
+    std::vector<InlineCallback> overflow_callbacks_;
+
+public:
+    /// Constructs empty sequence
+    InlineCallbacks() : inline_count_ { 0 } {}
+
+    /**
+     * @brief Appends given callback at end of sequence
+     *
+     * @param callback Callback to append
+     */
+    void push(InlineCallback callback) {
+        if (inline_count_ < INLINE_SLOTS)
+            inline_callbacks_[inline_count_++] = std::move(callback);
+        else
+            overflow_callbacks_.push_back(std::move(callback));
+    }
+
+    /**
+     * @brief Retrieves number of callbacks inside sequence
+     *
+     * @returns Callbacks count
+     */
+    std::size_t size() const {
+        return inline_count_ + overflow_callbacks_.size();
+    }
+
+    /**
+     * @brief Retrieves callback at given position, no bounds checking
+     *
+     * @param i Callback position inside sequence
+     *
+     * @returns Callback, which might be moved by caller
+     */
+    InlineCallback& operator[](const std::size_t i) {
+        return i < INLINE_SLOTS ? inline_callbacks_[i] : overflow_callbacks_[i - INLINE_SLOTS];
+    }
+
+    /**
+     * @brief Destroys every callback inside sequence
+     */
+    void clear() {
+        for (std::size_t i { 0 }; i < inline_count_; i++)
+            inline_callbacks_[i] = InlineCallback {};
+
+        inline_count_ = 0;
+        overflow_callbacks_.clear();
+    }
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_INLINECALLBACK_HPP
@@ -0,0 +1,98 @@
+#ifndef RPT_MINIGAMES_SERVER_ITERATIONARENA_HPP
+#define RPT_MINIGAMES_SERVER_ITERATIONARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+
+/**
+ * @file IterationArena.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Monotonic memory for transient data of a single main loop iteration, reset once iteration is done
+ *
+ * Allocations are bumped inside a buffer allocated once, and deallocations are ignored. Reset makes whole buffer
+ * available again, so transient work inside an iteration doesn't call general-purpose allocator as long as it fits.
+ * If it doesn't, arena falls back on heap until next reset and counts that overflow so capacity can be tuned.
+ *
+ * Arena isn't thread-safe, it must only be used by thread running main loop. Data allocated from it must not outlive
+ * iteration it was allocated during.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class IterationArena {
+public:
+    /// Buffer size, in bytes, if none is given
+    static constexpr std::size_t DEFAULT_CAPACITY { 64 * 1024 };
+
+private:
+    /// Heap fallback used by arena once its buffer is exhausted, counting each allocation
+    class OverflowCounter : public std::pmr::memory_resource {
+    private:
+        std::uint64_t overflows_;
+
+    protected:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    public:
+        /// Constructs counter without any overflow yet
+        OverflowCounter();
+
+        /// Retrieves count of allocations requested from heap
+        std::uint64_t overflows() const;
+    };
+
+    const std::size_t capacity_;
+    const std::unique_ptr<std::byte[]> buffer_;
+    OverflowCounter upstream_;
+    std::pmr::monotonic_buffer_resource resource_;
+
+public:
+    /**
+     * @brief Constructs arena, allocating its whole buffer
+     *
+     * @param capacity Buffer size, in bytes
+     *
+     * @throws std::invalid_argument if capacity is 0
+     */
+    explicit IterationArena(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /*
+     * Entity class semantic
+     */
+
+    IterationArena(const IterationArena&) = delete;
+    IterationArena& operator=(const IterationArena&) = delete;
+
+    /**
+     * @brief Retrieves memory resource for transient containers
+     *
+     * @returns Monotonic resource bumping allocations inside arena buffer
+     */
+    std::pmr::memory_resource& resource();
+
+    /**
+     * @brief Makes whole buffer available again and frees heap fallback memory, once iteration is done
+     */
+    void reset();
+
+    /// Retrieves buffer size, in bytes
+    std::size_t capacity() const;
+
+    /// Retrieves count of allocations which didn't fit inside buffer since arena was constructed
+    std::uint64_t overflows() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_ITERATIONARENA_HPP
@@ -0,0 +1,144 @@
+#ifndef RPT_MINIGAMES_SERVER_LATENCYHISTOGRAM_HPP
+#define RPT_MINIGAMES_SERVER_LATENCYHISTOGRAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file LatencyHistogram.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Fixed-size HDR-style histogram for latencies or any other unsigned values, with constant relative precision
+ *
+ * Values under `SUB_BUCKETS` are counted exactly. Above, each power of two range is split into `SUB_BUCKETS` linear
+ * buckets, so value retrieved from a percentile is never more than `1 / SUB_BUCKETS` away from recorded value. Recording
+ * is a single counter increment, without any allocation.
+ *
+ * Unit is chosen by caller, same unit must be used for every recorded value.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LatencyHistogram {
+public:
+    /// Linear buckets count for each power of two range, as bits
+    static constexpr std::size_t SUB_BUCKETS_BITS { 4 };
+    /// Linear buckets count for each power of two range
+    static constexpr std::size_t SUB_BUCKETS { 1 << SUB_BUCKETS_BITS };
+    /// Total buckets count, enough to hold any 64 bits value
+    static constexpr std::size_t BUCKETS_COUNT { (64 - SUB_BUCKETS_BITS + 1) * SUB_BUCKETS };
+
+private:
+    std::array<std::uint64_t, BUCKETS_COUNT> buckets_;
+    std::uint64_t count_;
+    std::uint64_t sum_;
+    std::uint64_t min_;
+    std::uint64_t max_;
+
+public:
+    /**
+     * @brief Retrieves bucket counting given value
+     *
+     * @param value Value to find bucket for
+     *
+     * @returns Index for bucket counting value
+     */
+    static std::size_t bucketIndex(std::uint64_t value);
+
+    /**
+     * @brief Retrieves smallest value counted by given bucket
+     *
+     * @param index Bucket to get range for, must be less than `BUCKETS_COUNT`
+     *
+     * @returns Lowest value inside bucket range
+     */
+    static std::uint64_t bucketLowerBound(std::size_t index);
+
+    /**
+     * @brief Retrieves greatest value counted by given bucket
+     *
+     * @param index Bucket to get range for, must be less than `BUCKETS_COUNT`
+     *
+     * @returns Highest value inside bucket range
+     */
+    static std::uint64_t bucketUpperBound(std::size_t index);
+
+    /**
+     * @brief Constructs empty histogram
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Counts given value
+     *
+     * @param value Recorded value
+     */
+    void record(std::uint64_t value);
+
+    /**
+     * @brief Adds every value counted by given histogram to this one
+     *
+     * @param other Histogram to merge, left unchanged
+     */
+    void merge(const LatencyHistogram& other);
+
+    /**
+     * @brief Removes every recorded value
+     */
+    void reset();
+
+    /**
+     * @brief Retrieves recorded values count
+     *
+     * @returns Number of recorded values
+     */
+    std::uint64_t count() const;
+
+    /**
+     * @brief Retrieves recorded values total
+     *
+     * @returns Exact sum of recorded values, 0 if empty
+     */
+    std::uint64_t sum() const;
+
+    /**
+     * @brief Retrieves smallest recorded value
+     *
+     * @returns Exact minimum, 0 if empty
+     */
+    std::uint64_t min() const;
+
+    /**
+     * @brief Retrieves greatest recorded value
+     *
+     * @returns Exact maximum, 0 if empty
+     */
+    std::uint64_t max() const;
+
+    /**
+     * @brief Retrieves recorded values average
+     *
+     * @returns Exact mean, 0 if empty
+     */
+    double mean() const;
+
+    /**
+     * @brief Retrieves value under which given percentage of recorded values are
+     *
+     * @param percentage Percentage from 0 to 100
+     *
+     * @returns Upper bound of bucket containing percentile, never above maximum, 0 if empty
+     */
+    std::uint64_t percentile(double percentage) const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_LATENCYHISTOGRAM_HPP
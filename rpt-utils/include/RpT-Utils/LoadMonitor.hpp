@@ -0,0 +1,105 @@
+#ifndef RPT_MINIGAMES_SERVER_LOADMONITOR_HPP
+#define RPT_MINIGAMES_SERVER_LOADMONITOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+/**
+ * @file LoadMonitor.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Tracks main loop saturation and input queue depth to detect overload, so server can shed load
+ *
+ * Main loop reports each iteration with time spent waiting for an input event, time spent busy handling them, and
+ * number of input events still queued once it's done. Saturation is busy time ratio over a window of iterations.
+ *
+ * Server becomes overloaded as soon as queue depth reaches its threshold, or when a window ends with saturation
+ * reaching its threshold. It recovers only at the end of a window during which both stayed below their thresholds,
+ * so shedding doesn't flap with each iteration.
+ *
+ * Iterations must be reported by a single thread, but overload state can be read by any thread, like IO threads
+ * handling handshakes.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LoadMonitor {
+public:
+    /// Clock used for every reported duration
+    using Clock = std::chrono::steady_clock;
+
+    /// Duration of iterations used to compute saturation, if none is given
+    static constexpr Clock::duration DEFAULT_WINDOW { std::chrono::seconds { 1 } };
+
+private:
+    const double saturation_threshold_;
+    const std::size_t queue_depth_threshold_;
+    const Clock::duration window_;
+
+    // Current window, only accessed by reporting thread
+    Clock::duration window_waiting_;
+    Clock::duration window_busy_;
+    std::size_t window_max_depth_;
+
+    // Latest complete window, readable by any thread
+    std::atomic<double> saturation_;
+    std::atomic<std::size_t> queue_depth_;
+    std::atomic<bool> overloaded_;
+
+public:
+    /**
+     * @brief Constructs monitor for a loop which isn't overloaded yet
+     *
+     * @param saturation_threshold Busy time ratio, in ]0;1], from which loop is overloaded
+     * @param queue_depth_threshold Queued input events count from which loop is overloaded
+     * @param window Iterations duration saturation is computed over
+     *
+     * @throws std::invalid_argument if saturation threshold isn't inside ]0;1], or if depth threshold or window is 0
+     */
+    LoadMonitor(double saturation_threshold, std::size_t queue_depth_threshold,
+                Clock::duration window = DEFAULT_WINDOW);
+
+    /*
+     * Entity class semantic
+     */
+
+    LoadMonitor(const LoadMonitor&) = delete;
+    LoadMonitor& operator=(const LoadMonitor&) = delete;
+
+    /**
+     * @brief Reports a main loop iteration, ending current window if it lasted long enough
+     *
+     * @param waiting Time spent blocked waiting for an input event
+     * @param busy Time spent handling input events and syncing clients
+     * @param queue_depth Input events still queued at iteration end
+     *
+     * @returns `true` if overload state changed with this iteration
+     */
+    bool iterationDone(Clock::duration waiting, Clock::duration busy, std::size_t queue_depth);
+
+    /// Retrieves busy time ratio of latest complete window, in [0;1]
+    double saturation() const;
+
+    /// Retrieves highest queue depth reported during latest complete window
+    std::size_t queueDepth() const;
+
+    /// Retrieves if load must be shed
+    bool overloaded() const;
+
+    /// Retrieves saturation from which loop is overloaded
+    double saturationThreshold() const;
+
+    /// Retrieves queue depth from which loop is overloaded
+    std::size_t queueDepthThreshold() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_LOADMONITOR_HPP
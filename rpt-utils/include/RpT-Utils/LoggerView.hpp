@@ -3,7 +3,9 @@
 
 #include <functional>
 #include <string_view>
+#include <vector>
 #include <spdlog/logger.h>
+#include <RpT-Config/Config.hpp>
 #include <RpT-Utils/LoggingContext.hpp>
 
 /**
@@ -31,10 +33,15 @@ namespace RpT::Utils {
  * Log messages follow fmt format specifications and have priority level which is either :
  * trace, debug, info, warn or error. Logging is done by calling appropriate method for each level.
  *
- * Log messages are sunk in both console and daily rotated logging files.
+ * Log messages are sunk in both console and daily rotated logging files. If asynchronous logging is enabled inside
+ * context when logger is registered, they are sunk by context flusher thread instead.
  *
  * Default log level is INFO, but it can be modified later using `LoggingContext::updateLogLevel()`.
  *
+ * Levels below `RPT_MIN_LOG_LEVEL` are never logged. On hot paths, `RPT_LOG_TRACE` and `RPT_LOG_DEBUG` macros should be
+ * used so arguments are evaluated only if message is logged, and so calls are removed from builds without these
+ * levels.
+ *
  * @note Two loggers of different purposes may have the same unique identifier.
  *
  * @author ThisALV, https://github.com/ThisALV
@@ -106,16 +113,29 @@ private:
      */
     template<LogLevel message_level, typename... Args>
     void log(const std::string_view fmt, Args&& ...args) const {
-        refreshLoggingLevel(); // Automatically refresh logging level before
+        if constexpr (isCompiledIn(message_level)) { // Removed from builds without this level
+            refreshLoggingLevel(); // Automatically refresh logging level before
 
-        if (context_.get().isEnabled()) { // Should be logged only if logging is enabled inside this context
-            constexpr spdlog::level::level_enum backend_message_level { apiToBackendLevel(message_level) };
+            if (context_.get().isEnabled()) { // Should be logged only if logging is enabled inside this context
+                constexpr spdlog::level::level_enum backend_message_level { apiToBackendLevel(message_level) };
 
-            backend_->log(backend_message_level, fmt, std::forward<Args>(args)...);
+                backend_->log(backend_message_level, fmt, std::forward<Args>(args)...);
+            }
         }
     }
 
 public:
+    /**
+     * @brief Checks if messages with given level are compiled in
+     *
+     * @param level Messages priority level
+     *
+     * @returns `true` if `level` isn't below `RPT_MIN_LOG_LEVEL`, `false` otherwise
+     */
+    static constexpr bool isCompiledIn(const LogLevel level) {
+        return static_cast<int>(level) >= RPT_MIN_LOG_LEVEL;
+    }
+
     /**
      * @brief Register new logger into given context with given generic name
      *
@@ -124,6 +144,13 @@ public:
      */
     explicit LoggerView(std::string_view generic_name, LoggingContext& context);
 
+    /**
+     * @brief Creates backend sinks for console and daily rotated logging files, not thread-safe
+     *
+     * @returns Sinks messages are written into
+     */
+    static std::vector<spdlog::sink_ptr> makeBackendSinks();
+
     /**
      * @brief Gets backend logger name
      *
@@ -145,6 +172,16 @@ public:
      */
     void refreshLoggingLevel() const;
 
+    /**
+     * @brief Checks if a message with given level would be logged, without computing it
+     *
+     * @param level Message priority level
+     *
+     * @returns `true` if level is compiled in, logging is enabled inside context and level isn't below context
+     * logging level, `false` otherwise
+     */
+    bool shouldLog(LogLevel level) const;
+
     /// Log trace level message
     template<typename... Args>
     void trace(const std::string_view fmt, Args&& ...args) const {
@@ -185,4 +222,27 @@ public:
 
 }
 
+
+/// Logs message with given method if given level should be logged, so arguments are evaluated only if required
+#define RPT_LOG_IF_SHOULD(logger, level, method, ...) \
+    do { \
+        if ((logger).shouldLog(RpT::Utils::LogLevel::level)) \
+            (logger).method(__VA_ARGS__); \
+    } while (false)
+
+#if RPT_MIN_LOG_LEVEL <= RPT_LOG_LEVEL_TRACE
+/// Logs trace level message with given `LoggerView`, expands to nothing if trace level isn't compiled in
+#define RPT_LOG_TRACE(logger, ...) RPT_LOG_IF_SHOULD(logger, TRACE, trace, __VA_ARGS__)
+#else
+#define RPT_LOG_TRACE(logger, ...) static_cast<void>(0)
+#endif
+
+#if RPT_MIN_LOG_LEVEL <= RPT_LOG_LEVEL_DEBUG
+/// Logs debug level message with given `LoggerView`, expands to nothing if debug level isn't compiled in
+#define RPT_LOG_DEBUG(logger, ...) RPT_LOG_IF_SHOULD(logger, DEBUG, debug, __VA_ARGS__)
+#else
+#define RPT_LOG_DEBUG(logger, ...) static_cast<void>(0)
+#endif
+
+
 #endif //RPTOGETHER_SERVER_LOGGERVIEW_HPP
@@ -2,6 +2,7 @@
 #define RPTOGETHER_SERVER_LOGGINGCONTEXT_HPP
 
 #include <functional>
+#include <memory>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
@@ -15,6 +16,7 @@ namespace RpT::Utils {
 
 
 class LoggerView; // Need to be referenced by LoggingContext when a LoggerView is regietered
+class AsyncLoggingSink; // Only owned by LoggingContext, used by LoggerView
 
 /**
  * @brief Available logging levels to use with `LoggingContext::updateLoggingLevel()`
@@ -27,6 +29,21 @@ enum struct LogLevel {
     TRACE, DEBUG, INFO, WARN, ERR, FATAL
 };
 
+/**
+ * @brief Behavior of asynchronous logging when a message is logged while queue is full, used with
+ * `LoggingContext::enableAsyncLogging()`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+enum struct LogOverflowPolicy {
+    /// Logging thread waits until a queued message has been written
+    BLOCK,
+    /// Logged message is dropped
+    DROP,
+    /// Oldest queued message is dropped to make room for logged message
+    DROP_OLDEST
+};
+
 /**
  * @brief Provides context for multiple LoggerView management
  *
@@ -37,6 +54,9 @@ enum struct LogLevel {
  * LoggerView should keep reference to it's assigned context, so it can be refreshed and check for newly assigned
  * default logging level.
  *
+ * By default, messages are written by the logging thread. Asynchronous logging can be enabled so registered loggers
+ * only queue messages, which are written by a background flusher thread.
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class LoggingContext {
@@ -47,6 +67,8 @@ private:
     LogLevel logging_level_;
     // Logging can be disabled at any moment
     bool enabled_;
+    // Shared by loggers registered after asynchronous logging has been enabled, null otherwise
+    std::shared_ptr<AsyncLoggingSink> async_sink_;
 
 public:
     /**
@@ -106,6 +128,32 @@ public:
      * @returns `true` if messages will be logged, `false` otherwise
      */
     bool isEnabled() const;
+
+    /**
+     * @brief Makes loggers registered after this call queue their messages for a background flusher thread, instead of
+     * writing them synchronously. Already registered loggers are unaffected.
+     *
+     * @param queue_capacity Maximum number of messages waiting to be written
+     * @param overflow_policy Behavior when a message is logged while queue is full
+     *
+     * @throws std::logic_error if asynchronous logging is already enabled
+     * @throws std::invalid_argument if `queue_capacity == 0`
+     */
+    void enableAsyncLogging(std::size_t queue_capacity, LogOverflowPolicy overflow_policy);
+
+    /**
+     * @brief Retrieves sink shared by asynchronous loggers
+     *
+     * @returns Sink queuing messages, or null if asynchronous logging isn't enabled
+     */
+    std::shared_ptr<AsyncLoggingSink> asyncSink() const;
+
+    /**
+     * @brief Retrieves number of messages dropped because asynchronous logging queue was full
+     *
+     * @returns Dropped messages count, 0 if asynchronous logging isn't enabled
+     */
+    std::size_t droppedMessages() const;
 };
 
 
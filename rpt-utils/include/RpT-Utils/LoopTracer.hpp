@@ -0,0 +1,158 @@
+#ifndef RPT_MINIGAMES_SERVER_LOOPTRACER_HPP
+#define RPT_MINIGAMES_SERVER_LOOPTRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file LoopTracer.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Records spans for main loop iterations inside a fixed-size ring, dumped with Chrome JSON trace format
+ *
+ * Ring keeps latest spans only, oldest ones being overwritten once it is full, so tracing can stay enabled for a
+ * whole match and a dump shows what happened right before a lag spike. Recording never allocates.
+ *
+ * Spans are recorded and dumped by main loop thread only, so ring doesn't require any synchronization. Dump can be
+ * requested from any thread or from a signal handler, it is done by main loop thread at its next `dumpIfRequested()`
+ * call.
+ *
+ * Dumped trace can be opened with `chrome://tracing` or with Perfetto UI, which both read Chrome JSON format.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LoopTracer {
+public:
+    /// Clock used for spans time points
+    using Clock = std::chrono::steady_clock;
+
+private:
+    /// Recorded span, name must be a string literal as it is only viewed
+    struct Span {
+        std::string_view name;
+        Clock::time_point begin;
+        Clock::duration duration;
+        std::uint64_t iteration;
+    };
+
+    const std::string output_path_;
+    std::vector<Span> spans_;
+    // Next span index, also recorded spans count until ring has been filled once
+    std::size_t next_span_;
+    bool ring_filled_;
+    std::uint64_t iteration_;
+    // Only flag accessed from other threads, lock-free so it can be set by a signal handler
+    std::atomic<bool> dump_requested_;
+    // Trace timestamps are relative to this time point
+    const Clock::time_point origin_;
+
+public:
+    /**
+     * @brief Constructs tracer with empty ring of given capacity
+     *
+     * @param capacity Maximum number of kept spans
+     * @param output_path File trace is written into when dumped
+     *
+     * @throws std::invalid_argument if `capacity == 0`
+     */
+    LoopTracer(std::size_t capacity, std::string output_path);
+
+    /*
+     * Entity class semantic
+     */
+
+    LoopTracer(const LoopTracer&) = delete;
+    LoopTracer& operator=(const LoopTracer&) = delete;
+
+    /// Next recorded spans belong to a new main loop iteration
+    void beginIteration();
+
+    /**
+     * @brief Records a span which began at given time point and ends now
+     *
+     * @param name Span name, must be a string literal
+     * @param begin Span begin time point
+     */
+    void record(std::string_view name, Clock::time_point begin);
+
+    /**
+     * @brief Retrieves number of spans kept inside ring
+     *
+     * @returns Recorded spans count, never above ring capacity
+     */
+    std::size_t size() const;
+
+    /// Requests a dump at next `dumpIfRequested()` call, async-signal-safe
+    void requestDump();
+
+    /**
+     * @brief Writes trace into output file if a dump was requested since previous one
+     *
+     * @returns `true` if trace has been written, `false` if no dump was requested or if output file couldn't be
+     * opened
+     */
+    bool dumpIfRequested();
+
+    /**
+     * @brief Writes kept spans, from oldest to latest, as Chrome JSON trace
+     *
+     * @param output Stream to write trace into
+     */
+    void dumpTo(std::ostream& output) const;
+
+    /// Writes trace into output file now, returns `false` if it couldn't be opened
+    bool dump() const;
+};
+
+
+/**
+ * @brief Records a span from its construction to its destruction, does nothing if there isn't any tracer
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class TraceSpan {
+private:
+    LoopTracer* const tracer_;
+    const std::string_view name_;
+    // Clock isn't read if there isn't any tracer
+    const LoopTracer::Clock::time_point begin_;
+
+public:
+    /**
+     * @brief Begins span with given name
+     *
+     * @param tracer Tracer to record span into, if any
+     * @param name Span name, must be a string literal
+     */
+    TraceSpan(LoopTracer* const tracer, const std::string_view name)
+    : tracer_ { tracer }, name_ { name }, begin_ { tracer ? LoopTracer::Clock::now() : LoopTracer::Clock::time_point {} } {}
+
+    /// Ends span, recording it
+    ~TraceSpan() {
+        if (tracer_)
+            tracer_->record(name_, begin_);
+    }
+
+    /*
+     * Scoped entity
+     */
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_LOOPTRACER_HPP
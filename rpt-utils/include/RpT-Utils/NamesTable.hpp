@@ -0,0 +1,103 @@
+#ifndef RPT_MINIGAMES_SERVER_NAMESTABLE_HPP
+#define RPT_MINIGAMES_SERVER_NAMESTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <RpT-Utils/FlatHashMap.hpp>
+
+/**
+ * @file NamesTable.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Interned set of unique names, each one stored once and referred to by a small ID
+ *
+ * Names are indexed by a flat hash table of views into their storage, so checking if a name is already taken doesn't
+ * depend on names count. Records referring to a name only keep its 32 bits ID, and name data is retrieved from table
+ * when it must be formatted.
+ *
+ * IDs of erased names are reused by next inserted names.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class NamesTable {
+public:
+    /// Refers to a name inside table
+    using NameId = std::uint32_t;
+
+private:
+    // Deque, so stored strings never move and index views stay valid while table grows
+    std::deque<std::string> names_;
+    FlatHashMap<std::string_view, NameId> index_;
+    std::vector<NameId> free_ids_;
+
+public:
+    /// Constructs table without any name
+    NamesTable() = default;
+
+    /*
+     * Entity class semantic
+     */
+
+    NamesTable(const NamesTable&) = delete;
+    NamesTable& operator=(const NamesTable&) = delete;
+
+    /**
+     * @brief Stores given name, unless it is already inside table
+     *
+     * @param name Name to store
+     *
+     * @returns ID for new name, uninitialized if name is already taken
+     */
+    std::optional<NameId> insert(std::string_view name);
+
+    /**
+     * @brief Removes name with given ID, so name is available again and ID might be reused
+     *
+     * @param id ID for a name inside table
+     */
+    void erase(NameId id);
+
+    /**
+     * @brief Checks if given name is inside table
+     *
+     * @param name Name to look for
+     *
+     * @returns `true` if name is already taken
+     */
+    bool contains(std::string_view name) const;
+
+    /**
+     * @brief Allocates index for given names count, so inserting that many names doesn't grow it again
+     *
+     * @param names_count Expected names count
+     */
+    void reserve(std::size_t names_count);
+
+    /**
+     * @brief Retrieves name with given ID
+     *
+     * @param id ID for a name inside table
+     *
+     * @returns View to stored name, valid until it is erased
+     */
+    std::string_view name(NameId id) const;
+
+    /// Retrieves number of names inside table
+    std::size_t size() const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_NAMESTABLE_HPP
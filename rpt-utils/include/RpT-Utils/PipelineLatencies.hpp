@@ -0,0 +1,154 @@
+#ifndef RPT_MINIGAMES_SERVER_PIPELINELATENCIES_HPP
+#define RPT_MINIGAMES_SERVER_PIPELINELATENCIES_HPP
+
+#include <array>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+/**
+ * @file PipelineLatencies.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Stage of requests pipeline, from a client message read to the resulting writes
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+enum struct PipelineStage : std::size_t {
+    /// From socket read completion to input event handling beginning by Executor
+    Receive,
+    /// Client message parsing into an input event by network backend
+    Parse,
+    /// Service Request handling by a room, every service included
+    Dispatch,
+    /// Service events polling by a room after an input event has been handled
+    Polling,
+    /// From oldest message queued for a client to write operation completion
+    Write
+};
+
+
+/**
+ * @brief Latency histograms for each `PipelineStage`, and for each service handling Service Request commands
+ *
+ * Latencies are recorded in nanoseconds. Recording is thread-safe, each histogram being guarded by its own lock, so
+ * network threads and room workers can record into same instance.
+ *
+ * Histograms are exported with text format of Prometheus summaries, a sample for each reported quantile followed by
+ * sum and count samples.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class PipelineLatencies {
+public:
+    /// Clock used for every recorded latency
+    using Clock = std::chrono::steady_clock;
+
+    /// Number of available pipeline stages
+    static constexpr std::size_t STAGES_COUNT { 5 };
+
+private:
+    /// Histogram with lock guarding it
+    struct GuardedHistogram {
+        mutable std::mutex lock;
+        LatencyHistogram histogram;
+    };
+
+    std::array<GuardedHistogram, STAGES_COUNT> stages_;
+    mutable std::mutex services_lock_;
+    // Transparent comparator, so services are searched without copying their names
+    std::map<std::string, LatencyHistogram, std::less<>> services_;
+
+    /// Writes summary samples for given histogram, labeled with given label
+    static void exportSummary(std::ostream& output, std::string_view metric_name, std::string_view label,
+                              const LatencyHistogram& histogram);
+
+public:
+    /**
+     * @brief Retrieves name used to label given stage
+     *
+     * @param stage Stage to get name for
+     *
+     * @returns Lowercase stage name
+     */
+    static std::string_view stageName(PipelineStage stage);
+
+    /// Constructs empty histograms for each stage, without any service
+    PipelineLatencies() = default;
+
+    /*
+     * Entity class semantic
+     */
+
+    PipelineLatencies(const PipelineLatencies&) = delete;
+    PipelineLatencies& operator=(const PipelineLatencies&) = delete;
+
+    /**
+     * @brief Records a latency for given stage
+     *
+     * @param stage Pipeline stage which took given latency
+     * @param latency Stage duration
+     */
+    void record(PipelineStage stage, Clock::duration latency);
+
+    /**
+     * @brief Records time elapsed since given time point for given stage
+     *
+     * @param stage Pipeline stage which began at given time point
+     * @param stage_begin Time point stage began at
+     */
+    void recordSince(PipelineStage stage, Clock::time_point stage_begin);
+
+    /**
+     * @brief Records a latency for Service Request commands handling by given service
+     *
+     * @param service_name Service which handled command
+     * @param latency `Service::handleRequestCommand()` duration
+     */
+    void recordService(std::string_view service_name, Clock::duration latency);
+
+    /**
+     * @brief Retrieves a copy of given stage histogram
+     *
+     * @param stage Stage to retrieve recorded latencies for
+     *
+     * @returns Latencies recorded until now, in nanoseconds
+     */
+    LatencyHistogram stage(PipelineStage stage) const;
+
+    /**
+     * @brief Retrieves a copy of given service histogram
+     *
+     * @param service_name Service to retrieve recorded latencies for
+     *
+     * @returns Latencies recorded until now, in nanoseconds, or uninitialized if none was recorded for this service
+     */
+    std::optional<LatencyHistogram> service(std::string_view service_name) const;
+
+    /**
+     * @brief Writes every histogram as Prometheus summary text samples
+     *
+     * Stages are exported as `rpt_pipeline_latency_ns` with a `stage` label, services as `rpt_service_latency_ns`
+     * with a `service` label.
+     *
+     * @param output Stream to write samples into
+     */
+    void exportTo(std::ostream& output) const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_PIPELINELATENCIES_HPP
@@ -0,0 +1,131 @@
+#ifndef RPT_MINIGAMES_SERVER_RINGQUEUE_HPP
+#define RPT_MINIGAMES_SERVER_RINGQUEUE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @file RingQueue.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief FIFO queue storing its elements inside a single contiguous ring, which grows when it is full
+ *
+ * Unlike `std::queue` backed by `std::deque`, pushing and popping don't allocate or free any block once ring is large
+ * enough for queue steady depth. Ring capacity is doubled when an element is pushed while it is full, elements being
+ * moved into new ring in queue order, and it never shrinks.
+ *
+ * Interface mirrors a subset of `std::queue`. Popped element slot is reset to a default-constructed element, so
+ * resources it owned are released right away.
+ *
+ * @tparam T Element type, default-constructible and movable
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<typename T>
+class RingQueue {
+private:
+    /// Slots count for first allocated ring
+    static constexpr std::size_t MIN_CAPACITY { 8 };
+
+    // Capacity is always a power of 2, so slot index is masked instead of divided
+    std::vector<T> ring_;
+    std::size_t front_;
+    std::size_t size_;
+
+    /// Retrieves ring slot index for given position from queue front
+    std::size_t slotIndex(const std::size_t position) const {
+        return (front_ + position) & (ring_.size() - 1);
+    }
+
+    /// Moves every element, from front to back, into a ring with given power of 2 capacity
+    void rebuild(const std::size_t new_capacity) {
+        std::vector<T> new_ring(new_capacity);
+        for (std::size_t i { 0 }; i < size_; i++)
+            new_ring[i] = std::move(ring_[slotIndex(i)]);
+
+        ring_.swap(new_ring);
+        front_ = 0;
+    }
+
+public:
+    /// Constructs empty queue, without allocating any ring
+    RingQueue() : front_ { 0 }, size_ { 0 } {}
+
+    /// Checks if there isn't any element inside queue
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    /// Retrieves number of elements inside queue
+    std::size_t size() const {
+        return size_;
+    }
+
+    /// Retrieves number of elements queue can contain before ring grows
+    std::size_t capacity() const {
+        return ring_.size();
+    }
+
+    /// Retrieves oldest element, queue must not be empty
+    T& front() {
+        assert(!empty());
+
+        return ring_[front_];
+    }
+
+    /// Retrieves oldest element, queue must not be empty
+    const T& front() const {
+        assert(!empty());
+
+        return ring_[front_];
+    }
+
+    /**
+     * @brief Moves given element at queue back, growing ring if it is full
+     *
+     * @param element Element to push
+     */
+    void push(T element) {
+        if (size_ == ring_.size())
+            rebuild(ring_.empty() ? MIN_CAPACITY : ring_.size() * 2);
+
+        ring_[slotIndex(size_)] = std::move(element);
+        size_++;
+    }
+
+    /// Removes oldest element, queue must not be empty
+    void pop() {
+        assert(!empty());
+
+        ring_[front_] = T {};
+        front_ = slotIndex(1);
+        size_--;
+    }
+
+    /**
+     * @brief Grows ring so it can contain given number of elements without growing again
+     *
+     * @param elements_count Number of elements expected inside queue at the same time
+     */
+    void reserve(const std::size_t elements_count) {
+        std::size_t new_capacity { MIN_CAPACITY };
+        while (new_capacity < elements_count)
+            new_capacity *= 2;
+
+        if (new_capacity > ring_.size())
+            rebuild(new_capacity);
+    }
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_RINGQUEUE_HPP
@@ -0,0 +1,220 @@
+#ifndef RPT_MINIGAMES_SERVER_RUNTIMEMETRICS_HPP
+#define RPT_MINIGAMES_SERVER_RUNTIMEMETRICS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * @file RuntimeMetrics.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Result of a Service Request command handled by a service
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+enum struct ServiceRequestResult {
+    /// Command succeeded, OK response sent
+    Ok,
+    /// Command failed, KO response sent
+    Ko,
+    /// Service threw an error while handling command
+    Error
+};
+
+
+/**
+ * @brief Server runtime counters and gauges, updated by network backend and executor, exported as Prometheus text
+ *
+ * Every update is thread-safe, so IO threads, room workers and metrics endpoint thread can access same instance.
+ * Scalar values are atomic, per-client and per-service values are guarded by their own lock.
+ *
+ * Rates, like input events or TLS handshakes per second, are exported as monotonic counters, so scraper computes them
+ * over its own time window.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class RuntimeMetrics {
+private:
+    /// Results count for SR commands handled by a service
+    struct ServiceRequestsCount {
+        std::uint64_t ok { 0 };
+        std::uint64_t ko { 0 };
+        std::uint64_t error { 0 };
+    };
+
+    std::atomic<std::uint64_t> connected_clients_;
+    std::atomic<std::uint64_t> registered_actors_;
+    std::atomic<std::uint64_t> actors_limit_;
+    std::atomic<std::uint64_t> occupied_rooms_;
+    std::atomic<std::uint64_t> pending_timers_;
+    std::atomic<std::uint64_t> input_events_;
+    std::atomic<std::uint64_t> received_bytes_;
+    std::atomic<std::uint64_t> sent_bytes_;
+    std::atomic<std::uint64_t> tls_handshakes_;
+    std::atomic<double> loop_saturation_;
+    std::atomic<bool> overloaded_;
+    std::atomic<std::uint64_t> shed_handshakes_;
+    std::atomic<std::uint64_t> rate_limited_requests_;
+    std::atomic<bool> ready_;
+
+    mutable std::mutex clients_lock_;
+    // Messages waiting to be sent for each connected client
+    std::map<std::uint64_t, std::size_t> queue_depths_;
+
+    mutable std::mutex services_lock_;
+    // Transparent comparator, so services are searched without copying their names
+    std::map<std::string, ServiceRequestsCount, std::less<>> services_;
+
+public:
+    /// Constructs metrics with every value initialized to 0
+    RuntimeMetrics();
+
+    /*
+     * Entity class semantic
+     */
+
+    RuntimeMetrics(const RuntimeMetrics&) = delete;
+    RuntimeMetrics& operator=(const RuntimeMetrics&) = delete;
+
+    /**
+     * @brief A new client connected, its queue depth is exported from now
+     *
+     * @param client_token New client
+     */
+    void clientConnected(std::uint64_t client_token);
+
+    /**
+     * @brief A client was removed, its queue depth is no longer exported
+     *
+     * @param client_token Removed client
+     */
+    void clientDisconnected(std::uint64_t client_token);
+
+    /// A client registered as an actor
+    void actorRegistered();
+
+    /// An actor was unregistered
+    void actorUnregistered();
+
+    /**
+     * @brief Sets maximum number of registered actors
+     *
+     * @param limit Actors limit server was configured with
+     */
+    void actorsLimit(std::size_t limit);
+
+    /**
+     * @brief Updates number of rooms with at least one actor inside
+     *
+     * @param count Occupied rooms count
+     */
+    void occupiedRooms(std::size_t count);
+
+    /**
+     * @brief Updates number of messages waiting to be sent to given client, ignored if client has been removed
+     *
+     * @param client_token Client owning outgoing queue
+     * @param depth Queued messages count
+     */
+    void queueDepth(std::uint64_t client_token, std::size_t depth);
+
+    /// Executor began to handle an input event
+    void inputEventHandled();
+
+    /**
+     * @brief Updates number of timers whose countdown is running
+     *
+     * @param count Pending timers count
+     */
+    void pendingTimers(std::size_t count);
+
+    /**
+     * @brief Counts RPTL messages bytes received from clients
+     *
+     * @param bytes Received bytes
+     */
+    void bytesReceived(std::size_t bytes);
+
+    /**
+     * @brief Counts bytes written to clients
+     *
+     * @param bytes Written bytes
+     */
+    void bytesSent(std::size_t bytes);
+
+    /// A TLS handshake has been done with a client
+    void tlsHandshakeDone();
+
+    /**
+     * @brief Updates main loop load, see `LoadMonitor`
+     *
+     * @param saturation Busy time ratio of main loop, in [0;1]
+     * @param overloaded If load is currently shed
+     */
+    void loopLoad(double saturation, bool overloaded);
+
+    /// A handshake was rejected because main loop is overloaded
+    void handshakeShed();
+
+    /// A SERVICE command was dropped because its actor exceeded its requests rate
+    void requestRateLimited();
+
+    /// Server is listening for clients, so it can be given traffic
+    void serverReady();
+
+    /**
+     * @brief Counts a SR command handled by given service
+     *
+     * @param service_name Service which handled command
+     * @param result Command handling result
+     */
+    void serviceRequestHandled(std::string_view service_name, ServiceRequestResult result);
+
+    /// Retrieves connected clients count
+    std::uint64_t connectedClients() const;
+
+    /// Retrieves registered actors count
+    std::uint64_t registeredActors() const;
+
+    /// Retrieves handled input events count
+    std::uint64_t inputEvents() const;
+
+    /// Retrieves maximum number of registered actors, 0 if it hasn't been set
+    std::uint64_t actorsLimit() const;
+
+    /// Retrieves rooms count with at least one actor inside
+    std::uint64_t occupiedRooms() const;
+
+    /// Retrieves main loop last saturation
+    double loopSaturation() const;
+
+    /// Retrieves if main loop is shedding load
+    bool overloaded() const;
+
+    /// Retrieves if server is listening for clients
+    bool ready() const;
+
+    /**
+     * @brief Writes every metric as Prometheus text samples, with their type
+     *
+     * @param output Stream to write samples into
+     */
+    void exportTo(std::ostream& output) const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_RUNTIMEMETRICS_HPP
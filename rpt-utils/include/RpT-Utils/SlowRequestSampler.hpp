@@ -0,0 +1,218 @@
+#ifndef RPT_MINIGAMES_SERVER_SLOWREQUESTSAMPLER_HPP
+#define RPT_MINIGAMES_SERVER_SLOWREQUESTSAMPLER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file SlowRequestSampler.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Pipeline context of a single Service Request command, from its read by network backend to its room sync
+ *
+ * Stages time points are written as request goes through pipeline. Service name is copied inside a fixed buffer, so
+ * context can be written without any allocation.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct SampledRequest {
+    /// Clock used for every stage time point
+    using Clock = std::chrono::steady_clock;
+
+    /// Maximum service name length kept by context, longer names are truncated
+    static constexpr std::size_t SERVICE_NAME_CAPACITY { 23 };
+
+    /// Actor which sent request
+    std::uint64_t actor;
+    /// Read by network backend, or handling beginning if IO interface doesn't stamp its events
+    Clock::time_point receivedAt;
+    /// Handling beginning by Executor thread
+    Clock::time_point handledAt;
+    /// Dispatch beginning by room, which might be later than handling if rooms are scheduled
+    Clock::time_point dispatchedAt;
+    /// Dispatch end, once response has been formatted
+    Clock::time_point repliedAt;
+    /// Room sync end, once emitted service events have been polled
+    Clock::time_point syncedAt;
+    /// Time taken by intended service to handle command, included inside dispatch
+    Clock::duration serviceHandling;
+    /// Service Request command size
+    std::size_t requestBytes;
+    /// Service Request Response size
+    std::size_t responseBytes;
+    /// Input events still queued inside IO interface when handling began
+    std::size_t pendingInputs;
+    /// Input events handled before this one inside same main loop batch
+    std::size_t batchPosition;
+    /// Service events polled by room sync
+    std::size_t polledEvents;
+    // Truncated service name, empty if command couldn't be parsed
+    std::array<char, SERVICE_NAME_CAPACITY> service;
+    std::size_t serviceLength;
+
+    /**
+     * @brief Copies intended service name, truncated to `SERVICE_NAME_CAPACITY` characters
+     *
+     * @param service_name Name parsed from command
+     */
+    void serviceName(std::string_view service_name);
+
+    /**
+     * @brief Retrieves intended service name
+     *
+     * @returns Copied name, empty if none was copied
+     */
+    std::string_view serviceName() const;
+
+    /**
+     * @brief Retrieves time elapsed from request read to room sync end
+     *
+     * @returns End-to-end duration
+     */
+    Clock::duration endToEnd() const;
+};
+
+
+/**
+ * @brief Keeps pipeline context of latest Service Requests inside a fixed ring, and only reports those which took
+ * longer than a threshold
+ *
+ * Writing a context into ring is the only cost for each request. Once a request has been synced, its end-to-end
+ * duration is compared to threshold. Slow requests are kept as exemplars, oldest ones being replaced, and queued for
+ * logging by main loop thread.
+ *
+ * Ring slots are claimed and finished by any thread, but a context is only written by thread handling its request.
+ * Ring capacity must be greater than requests handled at the same time, so a slot isn't claimed again before its
+ * request is done.
+ *
+ * Exemplars are exported with text format of Prometheus gauges, labeled with exemplar index, actor and service.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class SlowRequestSampler {
+public:
+    /// Clock used for every stage time point
+    using Clock = SampledRequest::Clock;
+
+    /// Ring capacity, if none is given
+    static constexpr std::size_t DEFAULT_RING_CAPACITY { 1024 };
+    /// Slow requests kept as exemplars, if no count is given
+    static constexpr std::size_t DEFAULT_EXEMPLARS_CAPACITY { 16 };
+
+private:
+    const Clock::duration threshold_;
+    std::vector<SampledRequest> ring_;
+    std::atomic<std::size_t> next_slot_;
+    // Avoids main loop thread to lock at each iteration if no request was slow
+    std::atomic<bool> has_unreported_;
+
+    // Only accessed for slow requests
+    mutable std::mutex slow_lock_;
+    const std::size_t exemplars_capacity_;
+    std::vector<SampledRequest> exemplars_;
+    std::size_t next_exemplar_;
+    std::vector<SampledRequest> unreported_;
+    std::uint64_t slow_count_;
+
+public:
+    /**
+     * @brief Constructs sampler with an empty ring
+     *
+     * @param threshold End-to-end duration from which a request is slow
+     * @param ring_capacity Number of latest requests contexts kept by ring
+     * @param exemplars_capacity Number of latest slow requests kept as exemplars
+     *
+     * @throws std::invalid_argument if threshold isn't positive, or if a capacity is 0
+     */
+    explicit SlowRequestSampler(Clock::duration threshold, std::size_t ring_capacity = DEFAULT_RING_CAPACITY,
+                                std::size_t exemplars_capacity = DEFAULT_EXEMPLARS_CAPACITY);
+
+    /*
+     * Entity class semantic
+     */
+
+    SlowRequestSampler(const SlowRequestSampler&) = delete;
+    SlowRequestSampler& operator=(const SlowRequestSampler&) = delete;
+
+    /**
+     * @brief Retrieves end-to-end duration from which a request is slow
+     *
+     * @returns Configured threshold
+     */
+    Clock::duration threshold() const;
+
+    /**
+     * @brief Retrieves number of latest requests contexts kept by ring
+     *
+     * @returns Configured ring capacity
+     */
+    std::size_t ringCapacity() const;
+
+    /**
+     * @brief Claims next ring slot for a new request, overwriting oldest context
+     *
+     * @returns Cleared context to write request stages into
+     */
+    SampledRequest& begin();
+
+    /**
+     * @brief Checks end-to-end duration of given synced request, keeping it as an exemplar if it is slow
+     *
+     * @param request Context claimed with `begin()`, which must have been synced
+     *
+     * @returns `true` if request was slow
+     */
+    bool finish(const SampledRequest& request);
+
+    /**
+     * @brief Moves slow requests finished since last call into given buffer, so they can be logged
+     *
+     * @param slow_requests Buffer to append unreported slow requests into
+     *
+     * @returns Number of appended slow requests
+     */
+    std::size_t takeUnreported(std::vector<SampledRequest>& slow_requests);
+
+    /**
+     * @brief Retrieves total number of slow requests
+     *
+     * @returns Requests which took longer than threshold until now
+     */
+    std::uint64_t slowCount() const;
+
+    /**
+     * @brief Retrieves a copy of kept exemplars
+     *
+     * @returns Latest slow requests, from oldest to newest
+     */
+    std::vector<SampledRequest> exemplars() const;
+
+    /**
+     * @brief Writes slow requests count and exemplars as Prometheus text samples
+     *
+     * Count is exported as `rpt_slow_requests_total`. Each exemplar stage is exported as `rpt_slow_request_ns` with
+     * a `stage` label, its bytes as `rpt_slow_request_bytes` with a `direction` label and its queue depth as
+     * `rpt_slow_request_pending_inputs`.
+     *
+     * @param output Stream to write samples into
+     */
+    void exportTo(std::ostream& output) const;
+};
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_SLOWREQUESTSAMPLER_HPP
@@ -1,8 +1,14 @@
 #ifndef RPTOGETHER_SERVER_TEXTPROTOCOLPARSER_HPP
 #define RPTOGETHER_SERVER_TEXTPROTOCOLPARSER_HPP
 
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <new>
+#include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 
@@ -58,12 +64,33 @@ public:
  * For example, a protocol which takes a command and a string will try to parse one word, give access to that
  * specific command (the first word) and give access to argument (unparsed string words).
  *
+ * Subclasses parsing untrusted input should use the non-throwing constructor and `parseInteger()`, so ill-formed
+ * commands are reported by checking returned values instead of unwinding exceptions.
+ *
+ * Separators are scanned many chars at once using SSE2 (or AVX2 if enabled at compile time) on x86-64 and NEON on
+ * ARM, falling back to one char at a time on other targets. Up to `INLINE_WORDS_CAPACITY` parsed words are stored
+ * inside instance, which covers every protocol of this project, so only larger expected words counts allocate.
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class TextProtocolParser {
+public:
+    /// Maximum number of parsed words stored without heap allocation
+    static constexpr std::size_t INLINE_WORDS_CAPACITY { 4 };
+
 private:
-    std::vector<std::string_view> parsed_words_;
+    std::array<std::string_view, INLINE_WORDS_CAPACITY> inline_parsed_words_;
+    // Only used for words following inline ones
+    std::vector<std::string_view> extra_parsed_words_;
+    std::size_t parsed_words_count_;
     std::string_view unparsed_words_;
+    bool has_expected_words_;
+
+    /// Appends given word to parsed ones
+    void pushParsedWord(std::string_view word);
+
+    /// Parses given words count from given command, skipping leading separators only if they weren't already trimmed
+    void parseWords(std::string_view protocol_command, unsigned int expected_words, bool leading_separators_trimmed);
 
 protected:
     /**
@@ -80,6 +107,49 @@ protected:
      */
     TextProtocolParser(std::string_view protocol_command, unsigned int expected_words);
 
+    /**
+     * @brief Constructs parser which will try to parse given words count without throwing if there are not enough
+     * words, `hasExpectedWords()` must then be checked before accessing parsed words
+     *
+     * @param protocol_command Protocol text command to parse
+     * @param expected_words Number of words to parse, and minimum words count expected inside command
+     */
+    TextProtocolParser(std::string_view protocol_command, unsigned int expected_words, std::nothrow_t);
+
+    /**
+     * @brief Constructs parser for a higher protocol layer, which continues where given lower layer parser stopped
+     * without throwing
+     *
+     * Given parser unparsed words are already trimmed, so each command char is scanned once no matter how many
+     * layers parse it.
+     *
+     * @param previous_layer Parser for lower protocol layer, its unparsed words must outlive this instance
+     * @param expected_words Number of words to parse, and minimum words count expected inside unparsed words
+     */
+    TextProtocolParser(const TextProtocolParser& previous_layer, unsigned int expected_words, std::nothrow_t);
+
+    /**
+     * @brief Converts given whole word into an integer
+     *
+     * @tparam Integer Integer type to convert word into
+     *
+     * @param word Word to convert, no char is allowed after integer digits
+     *
+     * @returns Converted integer, or uninitialized if word isn't a valid integer or if it is out of `Integer` range
+     */
+    template<typename Integer>
+    static std::optional<Integer> parseInteger(const std::string_view word) {
+        const char* const word_end { word.data() + word.size() };
+
+        Integer parsed_integer;
+        const auto [parsed_end, conversion_error] { std::from_chars(word.data(), word_end, parsed_integer) };
+
+        if (conversion_error != std::errc {} || parsed_end != word_end) // Every char must be part of integer
+            return {};
+
+        return parsed_integer;
+    }
+
     /**
      * @brief Retrieve parsed word at given index
      *
@@ -99,6 +169,13 @@ protected:
     std::string_view unparsedWords() const;
 
 public:
+    /**
+     * @brief Checks if expected words count was reached by parsing
+     *
+     * @returns `true` if every expected word was parsed, always `true` if constructed with throwing constructor
+     */
+    bool hasExpectedWords() const;
+
     /// Required for polymorphic instance destruction
     virtual ~TextProtocolParser() = default;
 };
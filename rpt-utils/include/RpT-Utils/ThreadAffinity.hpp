@@ -0,0 +1,43 @@
+#ifndef RPT_MINIGAMES_SERVER_THREADAFFINITY_HPP
+#define RPT_MINIGAMES_SERVER_THREADAFFINITY_HPP
+
+#include <cstddef>
+#include <thread>
+
+/**
+ * @file ThreadAffinity.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Pins calling thread to given CPU core, so scheduler never migrates it to another core
+ *
+ * Threads started by calling thread afterwards inherit its affinity, so workers should be started before.
+ *
+ * @param cpu Index of CPU core thread must only run on
+ *
+ * @throws std::system_error if given core doesn't exist or if thread affinity couldn't be set
+ */
+void pinCurrentThread(std::size_t cpu);
+
+/**
+ * @brief Pins given running thread to given CPU core, so its owner can handle pinning errors
+ *
+ * On Linux, memory pages are allocated on NUMA node of the thread which first writes them, so data allocated by a
+ * pinned thread stays on its core node.
+ *
+ * @param thread Thread which must only run on given core
+ * @param cpu Index of CPU core
+ *
+ * @throws std::system_error if given core doesn't exist or if thread affinity couldn't be set
+ */
+void pinThread(std::thread& thread, std::size_t cpu);
+
+
+}
+
+
+#endif //RPT_MINIGAMES_SERVER_THREADAFFINITY_HPP
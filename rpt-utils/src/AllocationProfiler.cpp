@@ -0,0 +1,220 @@
+#include <RpT-Utils/AllocationProfiler.hpp>
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+
+
+namespace RpT::Utils {
+
+
+namespace {
+
+
+/// Allocations counters for a subsystem, updated by any thread
+struct SubsystemCounters {
+    std::atomic<std::uint64_t> allocations { 0 };
+    std::atomic<std::uint64_t> bytes { 0 };
+};
+
+/// Allocations done to handle every input event of a type
+struct InputEventCounts {
+    std::uint64_t events { 0 };
+    AllocationCounts allocations;
+};
+
+/// Input events totals with lock guarding them
+struct GuardedInputEvents {
+    std::mutex lock;
+    // Transparent comparator, so event types are searched without copying their names
+    std::map<std::string, InputEventCounts, std::less<>> counts;
+};
+
+
+// Constant initialized, so they are usable by allocations done before main()
+std::array<SubsystemCounters, AllocationProfiler::SUBSYSTEMS_COUNT> subsystems_counters;
+thread_local AllocationSubsystem current_subsystem { AllocationSubsystem::Other };
+thread_local AllocationCounts current_thread_counts;
+
+/// Constructed at first use, so it doesn't depend on static initialization order
+GuardedInputEvents& inputEvents() {
+    static GuardedInputEvents input_events;
+
+    return input_events;
+}
+
+
+}
+
+
+std::string_view AllocationProfiler::subsystemName(const AllocationSubsystem subsystem) {
+    switch (subsystem) {
+    case AllocationSubsystem::Other:
+        return "other";
+    case AllocationSubsystem::Network:
+        return "network";
+    case AllocationSubsystem::Ser:
+        return "ser";
+    case AllocationSubsystem::Services:
+        return "services";
+    case AllocationSubsystem::Games:
+        return "games";
+    }
+
+    assert(false); // Every subsystem must be named
+    return {};
+}
+
+void AllocationProfiler::allocated(const std::size_t bytes) noexcept {
+    SubsystemCounters& counters { subsystems_counters[static_cast<std::size_t>(current_subsystem)] };
+
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    current_thread_counts.allocations++;
+    current_thread_counts.bytes += bytes;
+}
+
+AllocationSubsystem AllocationProfiler::select(const AllocationSubsystem subsystem) noexcept {
+    const AllocationSubsystem previous { current_subsystem };
+    current_subsystem = subsystem;
+
+    return previous;
+}
+
+AllocationCounts AllocationProfiler::subsystem(const AllocationSubsystem subsystem) {
+    const SubsystemCounters& counters { subsystems_counters[static_cast<std::size_t>(subsystem)] };
+
+    return {
+        counters.allocations.load(std::memory_order_relaxed), counters.bytes.load(std::memory_order_relaxed)
+    };
+}
+
+AllocationCounts AllocationProfiler::currentThread() {
+    return current_thread_counts;
+}
+
+void AllocationProfiler::inputEventHandled(const std::string_view event_type, const AllocationCounts allocations) {
+    GuardedInputEvents& input_events { inputEvents() };
+    const std::lock_guard input_events_lock { input_events.lock };
+
+    auto event_counts { input_events.counts.find(event_type) };
+    if (event_counts == input_events.counts.end()) // First event handled with this type
+        event_counts = input_events.counts.emplace(std::string { event_type }, InputEventCounts {}).first;
+
+    event_counts->second.events++;
+    event_counts->second.allocations.allocations += allocations.allocations;
+    event_counts->second.allocations.bytes += allocations.bytes;
+}
+
+void AllocationProfiler::exportTo(std::ostream& output) {
+    output << "# TYPE rpt_allocations_total counter\n";
+    for (std::size_t i { 0 }; i < SUBSYSTEMS_COUNT; i++) {
+        const auto exported_subsystem { static_cast<AllocationSubsystem>(i) };
+
+        output << "rpt_allocations_total{subsystem=\"" << subsystemName(exported_subsystem) << "\"} "
+               << subsystem(exported_subsystem).allocations << '\n';
+    }
+
+    output << "# TYPE rpt_allocated_bytes_total counter\n";
+    for (std::size_t i { 0 }; i < SUBSYSTEMS_COUNT; i++) {
+        const auto exported_subsystem { static_cast<AllocationSubsystem>(i) };
+
+        output << "rpt_allocated_bytes_total{subsystem=\"" << subsystemName(exported_subsystem) << "\"} "
+               << subsystem(exported_subsystem).bytes << '\n';
+    }
+
+    // Copied so lock isn't held while writing into stream
+    std::map<std::string, InputEventCounts, std::less<>> input_events_copy;
+    {
+        GuardedInputEvents& input_events { inputEvents() };
+        const std::lock_guard input_events_lock { input_events.lock };
+
+        input_events_copy = input_events.counts;
+    }
+
+    output << "# TYPE rpt_profiled_input_events_total counter\n";
+    for (const auto& [event_type, counts] : input_events_copy)
+        output << "rpt_profiled_input_events_total{event=\"" << event_type << "\"} " << counts.events << '\n';
+
+    output << "# TYPE rpt_input_event_allocations_total counter\n";
+    for (const auto& [event_type, counts] : input_events_copy) {
+        output << "rpt_input_event_allocations_total{event=\"" << event_type << "\"} "
+               << counts.allocations.allocations << '\n';
+    }
+
+    output << "# TYPE rpt_input_event_allocated_bytes_total counter\n";
+    for (const auto& [event_type, counts] : input_events_copy) {
+        output << "rpt_input_event_allocated_bytes_total{event=\"" << event_type << "\"} "
+               << counts.allocations.bytes << '\n';
+    }
+}
+
+
+}
+
+
+#if RPT_ALLOCATION_PROFILING
+
+/*
+ * Global allocation functions replacements, counting every allocation before forwarding it to malloc(). Delete
+ * overloads must be replaced too, as memory is no longer allocated by default implementation.
+ */
+
+void* operator new(const std::size_t size) {
+    RpT::Utils::AllocationProfiler::allocated(size);
+
+    // Zero-sized allocations must still return a unique pointer
+    if (void* const allocated { std::malloc(size == 0 ? 1 : size) })
+        return allocated;
+
+    throw std::bad_alloc {};
+}
+
+void* operator new[](const std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return operator new(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept {
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void* const allocated) noexcept {
+    std::free(allocated);
+}
+
+void operator delete[](void* const allocated) noexcept {
+    std::free(allocated);
+}
+
+void operator delete(void* const allocated, std::size_t) noexcept {
+    std::free(allocated);
+}
+
+void operator delete[](void* const allocated, std::size_t) noexcept {
+    std::free(allocated);
+}
+
+void operator delete(void* const allocated, const std::nothrow_t&) noexcept {
+    std::free(allocated);
+}
+
+void operator delete[](void* const allocated, const std::nothrow_t&) noexcept {
+    std::free(allocated);
+}
+
+#endif
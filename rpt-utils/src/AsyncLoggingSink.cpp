@@ -0,0 +1,136 @@
+#include <RpT-Utils/AsyncLoggingSink.hpp>
+
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+
+namespace RpT::Utils {
+
+
+AsyncLoggingSink::AsyncLoggingSink(std::vector<spdlog::sink_ptr> backends, const std::size_t queue_capacity,
+                                   const LogOverflowPolicy overflow_policy) :
+queue_capacity_ { queue_capacity }, overflow_policy_ { overflow_policy }, flush_requested_ { false },
+stopping_ { false }, dropped_messages_ { 0 }, backends_ { std::move(backends) } {
+
+    if (queue_capacity_ == 0) // A message could never be queued
+        throw std::invalid_argument { "Logging queue capacity must be positive strict" };
+
+    flusher_ = std::thread { &AsyncLoggingSink::flushQueue, this };
+}
+
+AsyncLoggingSink::~AsyncLoggingSink() {
+    {
+        const std::lock_guard queue_lock { queue_mutex_ };
+
+        // Remaining messages must be written before application exits
+        stopping_ = true;
+        flush_requested_ = true;
+    }
+
+    queue_filled_.notify_one();
+    flusher_.join();
+}
+
+void AsyncLoggingSink::flushQueue() {
+    // Messages are moved out of queue so it is unlocked while they are written
+    std::vector<spdlog::details::log_msg_buffer> written_messages;
+
+    while (true) {
+        bool flush_requested;
+        {
+            std::unique_lock queue_lock { queue_mutex_ };
+
+            queue_filled_.wait(queue_lock, [this]() {
+                return !queued_messages_.empty() || flush_requested_ || stopping_;
+            });
+
+            // Stopping sink with every message already written and flushed
+            if (queued_messages_.empty() && !flush_requested_)
+                return;
+
+            written_messages.assign(std::make_move_iterator(queued_messages_.begin()),
+                                    std::make_move_iterator(queued_messages_.end()));
+            queued_messages_.clear();
+
+            flush_requested = std::exchange(flush_requested_, false);
+        }
+
+        queue_emptied_.notify_all(); // Blocked logging threads can queue messages again
+
+        {
+            const std::lock_guard backends_lock { backends_mutex_ };
+
+            for (const spdlog::details::log_msg_buffer& message : written_messages) {
+                for (const spdlog::sink_ptr& backend : backends_) {
+                    if (backend->should_log(message.level))
+                        backend->log(message);
+                }
+            }
+
+            if (flush_requested) {
+                for (const spdlog::sink_ptr& backend : backends_)
+                    backend->flush();
+            }
+        }
+
+        written_messages.clear();
+    }
+}
+
+void AsyncLoggingSink::log(const spdlog::details::log_msg& msg) {
+    {
+        std::unique_lock queue_lock { queue_mutex_ };
+
+        if (queued_messages_.size() == queue_capacity_) {
+            switch (overflow_policy_) {
+            case LogOverflowPolicy::BLOCK:
+                queue_emptied_.wait(queue_lock, [this]() { return queued_messages_.size() < queue_capacity_; });
+                break;
+            case LogOverflowPolicy::DROP:
+                dropped_messages_++;
+                return;
+            case LogOverflowPolicy::DROP_OLDEST:
+                queued_messages_.pop_front();
+                dropped_messages_++;
+                break;
+            }
+        }
+
+        // Message payload and logger name are views, they must be copied before logging call returns
+        queued_messages_.emplace_back(msg);
+    }
+
+    queue_filled_.notify_one();
+}
+
+void AsyncLoggingSink::flush() {
+    {
+        const std::lock_guard queue_lock { queue_mutex_ };
+
+        flush_requested_ = true;
+    }
+
+    queue_filled_.notify_one();
+}
+
+void AsyncLoggingSink::set_pattern(const std::string& pattern) {
+    const std::lock_guard backends_lock { backends_mutex_ };
+
+    for (const spdlog::sink_ptr& backend : backends_)
+        backend->set_pattern(pattern);
+}
+
+void AsyncLoggingSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) {
+    const std::lock_guard backends_lock { backends_mutex_ };
+
+    for (const spdlog::sink_ptr& backend : backends_)
+        backend->set_formatter(sink_formatter->clone());
+}
+
+std::size_t AsyncLoggingSink::droppedMessages() const {
+    return dropped_messages_;
+}
+
+
+}
@@ -0,0 +1,50 @@
+#include <RpT-Utils/ByteArena.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace RpT::Utils {
+
+
+ByteArena::ByteArena(const std::size_t chunk_size)
+: chunk_size_ { chunk_size }, current_chunk_ { 0 }, used_bytes_ { 0 } {
+
+    if (chunk_size == 0)
+        throw std::invalid_argument { "Byte arena chunk size must be at least 1 byte" };
+}
+
+std::string_view ByteArena::copy(const std::string_view bytes) {
+    if (bytes.empty()) // Nothing to store, no chunk has to be allocated
+        return {};
+
+    // Remaining bytes of a chunk which can't fit string are skipped until next reset
+    while (current_chunk_ < chunks_.size() && used_bytes_ + bytes.size() > chunks_[current_chunk_].size) {
+        current_chunk_++;
+        used_bytes_ = 0;
+    }
+
+    if (current_chunk_ == chunks_.size()) { // Every chunk is full, arena grows
+        const std::size_t new_chunk_size { std::max(chunk_size_, bytes.size()) };
+
+        chunks_.push_back({ std::unique_ptr<char[]> { new char[new_chunk_size] }, new_chunk_size });
+    }
+
+    char* const copied_bytes { chunks_[current_chunk_].bytes.get() + used_bytes_ };
+    std::copy(bytes.cbegin(), bytes.cend(), copied_bytes);
+    used_bytes_ += bytes.size();
+
+    return { copied_bytes, bytes.size() };
+}
+
+void ByteArena::reset() {
+    current_chunk_ = 0;
+    used_bytes_ = 0;
+}
+
+std::size_t ByteArena::chunksCount() const {
+    return chunks_.size();
+}
+
+
+}
@@ -6,15 +6,21 @@ namespace RpT::Utils {
 
 HandlingResult::HandlingResult(std::string error_message) : possible_error_message_ { std::move(error_message) } {}
 
+HandlingResult::HandlingResult(const StaticErrorMessage error_message)
+: possible_error_message_ { error_message.message } {}
+
 HandlingResult::operator bool() const {
-    return !possible_error_message_.has_value();
+    return std::holds_alternative<std::monostate>(possible_error_message_);
 }
 
-const std::string& HandlingResult::errorMessage() const {
-    if (!possible_error_message_.has_value()) // An error must have occurred
-        throw NoErrorMessage {};
+std::string_view HandlingResult::errorMessage() const {
+    if (const auto static_message { std::get_if<std::string_view>(&possible_error_message_) })
+        return *static_message;
+
+    if (const auto dynamic_message { std::get_if<std::string>(&possible_error_message_) })
+        return *dynamic_message;
 
-    return *possible_error_message_;
+    throw NoErrorMessage {}; // An error must have occurred
 }
 
 
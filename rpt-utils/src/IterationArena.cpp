@@ -0,0 +1,67 @@
+#include <RpT-Utils/IterationArena.hpp>
+
+#include <stdexcept>
+
+
+namespace RpT::Utils {
+
+
+namespace {
+
+
+/// Retrieves given arena capacity if it is valid, so buffer and resource are never constructed empty
+std::size_t checkedCapacity(const std::size_t capacity) {
+    if (capacity == 0)
+        throw std::invalid_argument { "Iteration arena capacity must be at least 1 byte" };
+
+    return capacity;
+}
+
+
+}
+
+
+void* IterationArena::OverflowCounter::do_allocate(const std::size_t bytes, const std::size_t alignment) {
+    overflows_++;
+
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void IterationArena::OverflowCounter::do_deallocate(void* const p, const std::size_t bytes,
+                                                    const std::size_t alignment) {
+
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+bool IterationArena::OverflowCounter::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+IterationArena::OverflowCounter::OverflowCounter() : overflows_ { 0 } {}
+
+std::uint64_t IterationArena::OverflowCounter::overflows() const {
+    return overflows_;
+}
+
+IterationArena::IterationArena(const std::size_t capacity)
+: capacity_ { checkedCapacity(capacity) }, buffer_ { new std::byte[capacity_] },
+resource_ { buffer_.get(), capacity_, &upstream_ } {}
+
+std::pmr::memory_resource& IterationArena::resource() {
+    return resource_;
+}
+
+void IterationArena::reset() {
+    resource_.release(); // Next allocation begins at buffer start again
+}
+
+std::size_t IterationArena::capacity() const {
+    return capacity_;
+}
+
+std::uint64_t IterationArena::overflows() const {
+    return upstream_.overflows();
+}
+
+
+}
@@ -0,0 +1,110 @@
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace RpT::Utils {
+
+
+std::size_t LatencyHistogram::bucketIndex(const std::uint64_t value) {
+    if (value < SUB_BUCKETS) // Small values are counted exactly
+        return value;
+
+    // Position of most significant bit, at least SUB_BUCKETS_BITS as value >= SUB_BUCKETS
+    const std::size_t msb_position { 63 - static_cast<std::size_t>(__builtin_clzll(value)) };
+    // Bits under sub-bucket bits are lost, that's where precision loss is
+    const std::size_t shift { msb_position - SUB_BUCKETS_BITS };
+    // Value shifted is inside [SUB_BUCKETS, 2 * SUB_BUCKETS), giving linear sub-bucket inside power of two range
+    const std::size_t sub_bucket { static_cast<std::size_t>(value >> shift) - SUB_BUCKETS };
+
+    return (shift + 1) * SUB_BUCKETS + sub_bucket;
+}
+
+std::uint64_t LatencyHistogram::bucketLowerBound(const std::size_t index) {
+    if (index < SUB_BUCKETS)
+        return index;
+
+    const std::size_t shift { index / SUB_BUCKETS - 1 };
+    const std::uint64_t sub_bucket { index % SUB_BUCKETS };
+
+    return (SUB_BUCKETS + sub_bucket) << shift;
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(const std::size_t index) {
+    if (index < SUB_BUCKETS)
+        return index;
+
+    const std::size_t shift { index / SUB_BUCKETS - 1 };
+
+    return bucketLowerBound(index) + ((std::uint64_t { 1 } << shift) - 1);
+}
+
+LatencyHistogram::LatencyHistogram() : buckets_ {}, count_ { 0 }, sum_ { 0 },
+min_ { std::numeric_limits<std::uint64_t>::max() }, max_ { 0 } {}
+
+void LatencyHistogram::record(const std::uint64_t value) {
+    buckets_[bucketIndex(value)]++;
+    count_++;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (std::size_t i { 0 }; i < BUCKETS_COUNT; i++)
+        buckets_[i] += other.buckets_[i];
+
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void LatencyHistogram::reset() {
+    *this = LatencyHistogram {};
+}
+
+std::uint64_t LatencyHistogram::count() const {
+    return count_;
+}
+
+std::uint64_t LatencyHistogram::sum() const {
+    return sum_;
+}
+
+std::uint64_t LatencyHistogram::min() const {
+    return count_ == 0 ? 0 : min_;
+}
+
+std::uint64_t LatencyHistogram::max() const {
+    return max_;
+}
+
+double LatencyHistogram::mean() const {
+    return count_ == 0 ? 0 : static_cast<double>(sum_) / static_cast<double>(count_);
+}
+
+std::uint64_t LatencyHistogram::percentile(const double percentage) const {
+    if (count_ == 0)
+        return 0;
+
+    // Rank of value to find among sorted recorded values, at least first one
+    const auto rank {
+        std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(percentage / 100 * count_)))
+    };
+
+    std::uint64_t counted_values { 0 };
+    for (std::size_t i { 0 }; i < BUCKETS_COUNT; i++) {
+        counted_values += buckets_[i];
+
+        if (counted_values >= rank) // Bucket upper bound might be greater than any recorded value
+            return std::min(bucketUpperBound(i), max_);
+    }
+
+    return max_; // Percentage above 100
+}
+
+
+}
@@ -0,0 +1,82 @@
+#include <RpT-Utils/LoadMonitor.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace RpT::Utils {
+
+
+LoadMonitor::LoadMonitor(const double saturation_threshold, const std::size_t queue_depth_threshold,
+                         const Clock::duration window)
+: saturation_threshold_ { saturation_threshold }, queue_depth_threshold_ { queue_depth_threshold },
+window_ { window }, window_waiting_ { 0 }, window_busy_ { 0 }, window_max_depth_ { 0 }, saturation_ { 0 },
+queue_depth_ { 0 }, overloaded_ { false } {
+
+    if (!(saturation_threshold_ > 0 && saturation_threshold_ <= 1))
+        throw std::invalid_argument { "Saturation threshold must be inside ]0;1]" };
+
+    if (queue_depth_threshold_ == 0)
+        throw std::invalid_argument { "Queue depth threshold must be at least 1" };
+
+    if (window_ <= Clock::duration::zero())
+        throw std::invalid_argument { "Saturation window must be a positive duration" };
+}
+
+bool LoadMonitor::iterationDone(const Clock::duration waiting, const Clock::duration busy,
+                                const std::size_t queue_depth) {
+
+    const bool was_overloaded { overloaded_.load(std::memory_order_relaxed) };
+
+    window_waiting_ += waiting;
+    window_busy_ += busy;
+    window_max_depth_ = std::max(window_max_depth_, queue_depth);
+
+    if (window_waiting_ + window_busy_ < window_) { // Window isn't done, only a queue spike can change state
+        if (!was_overloaded && queue_depth >= queue_depth_threshold_) {
+            overloaded_.store(true, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    const std::chrono::duration<double> window_busy { window_busy_ };
+    const double saturation { window_busy / std::chrono::duration<double> { window_waiting_ + window_busy_ } };
+    const bool overloaded { saturation >= saturation_threshold_ || window_max_depth_ >= queue_depth_threshold_ };
+
+    saturation_.store(saturation, std::memory_order_relaxed);
+    queue_depth_.store(window_max_depth_, std::memory_order_relaxed);
+    overloaded_.store(overloaded, std::memory_order_relaxed);
+
+    // Next window begins
+    window_waiting_ = Clock::duration::zero();
+    window_busy_ = Clock::duration::zero();
+    window_max_depth_ = 0;
+
+    return overloaded != was_overloaded;
+}
+
+double LoadMonitor::saturation() const {
+    return saturation_.load(std::memory_order_relaxed);
+}
+
+std::size_t LoadMonitor::queueDepth() const {
+    return queue_depth_.load(std::memory_order_relaxed);
+}
+
+bool LoadMonitor::overloaded() const {
+    return overloaded_.load(std::memory_order_relaxed);
+}
+
+double LoadMonitor::saturationThreshold() const {
+    return saturation_threshold_;
+}
+
+std::size_t LoadMonitor::queueDepthThreshold() const {
+    return queue_depth_threshold_;
+}
+
+
+}
@@ -1,6 +1,7 @@
 #include <RpT-Utils/LoggerView.hpp>
 
 #include <iostream>
+#include <RpT-Utils/AsyncLoggingSink.hpp>
 #include <spdlog/sinks/sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/daily_file_sink.h>
@@ -18,7 +19,7 @@ void LoggerView::handleError(const std::string& msg) {
     std::cerr << "Logging error: " << msg << std::endl;
 }
 
-LoggerView::LoggerView(const std::string_view generic_name, LoggingContext& context) : context_ { context } {
+std::vector<spdlog::sink_ptr> LoggerView::makeBackendSinks() {
     // Creates both console and rotating file sinks
     auto stdout_sink { std::make_shared<spdlog::sinks::stdout_color_sink_st>() };
     auto daily_file_sink {
@@ -34,15 +35,25 @@ LoggerView::LoggerView(const std::string_view generic_name, LoggingContext& cont
     stdout_sink->set_color(spdlog::level::trace, BACKGROUND_BLUE | BACKGROUND_INTENSITY);
 #endif
 
+    return { stdout_sink, daily_file_sink };
+}
+
+LoggerView::LoggerView(const std::string_view generic_name, LoggingContext& context) : context_ { context } {
     // Signal backend logger to context and retrieve next available UID
     const std::size_t uid { context_.get().newLoggerFor(generic_name) };
     // Required for concatenation when creating unique logger name
     const std::string generic_name_copy { generic_name };
 
-    // Instances logger with unique name and two instanced sinks
-    backend_ = std::make_shared<spdlog::logger>(
-            generic_name_copy + '-' + std::to_string(uid),
-            spdlog::sinks_init_list { stdout_sink, daily_file_sink });
+    const std::shared_ptr<AsyncLoggingSink> async_sink { context_.get().asyncSink() };
+    // Instances logger with unique name and either context shared asynchronous sink or its own instanced sinks
+    if (async_sink) {
+        backend_ = std::make_shared<spdlog::logger>(generic_name_copy + '-' + std::to_string(uid), async_sink);
+    } else {
+        const std::vector<spdlog::sink_ptr> backend_sinks { makeBackendSinks() };
+
+        backend_ = std::make_shared<spdlog::logger>(
+                generic_name_copy + '-' + std::to_string(uid), backend_sinks.begin(), backend_sinks.end());
+    }
 
     // Logger settings
     refreshLoggingLevel();
@@ -63,6 +74,13 @@ void LoggerView::refreshLoggingLevel() const {
     backend_->flush_on(backend_logging_level);
 }
 
+bool LoggerView::shouldLog(const LogLevel level) const {
+    const LoggingContext& context { context_.get() };
+
+    return isCompiledIn(level) && context.isEnabled()
+            && static_cast<int>(level) >= static_cast<int>(context.retrieveLoggingLevel());
+}
+
 LogLevel LoggerView::loggingLevel() const {
     const LogLevel current_logging_level { backendToApiLevel(backend_->level()) };
 
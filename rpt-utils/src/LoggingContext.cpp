@@ -1,5 +1,9 @@
 #include <RpT-Utils/LoggingContext.hpp>
 
+#include <stdexcept>
+#include <RpT-Utils/AsyncLoggingSink.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
 
 namespace RpT::Utils {
 
@@ -34,5 +38,20 @@ bool LoggingContext::isEnabled() const {
     return enabled_;
 }
 
+void LoggingContext::enableAsyncLogging(const std::size_t queue_capacity, const LogOverflowPolicy overflow_policy) {
+    if (async_sink_) // Loggers already using current sink would be separated from new ones
+        throw std::logic_error { "Asynchronous logging is already enabled" };
+
+    async_sink_ = std::make_shared<AsyncLoggingSink>(LoggerView::makeBackendSinks(), queue_capacity, overflow_policy);
+}
+
+std::shared_ptr<AsyncLoggingSink> LoggingContext::asyncSink() const {
+    return async_sink_;
+}
+
+std::size_t LoggingContext::droppedMessages() const {
+    return async_sink_ ? async_sink_->droppedMessages() : 0;
+}
+
 
 }
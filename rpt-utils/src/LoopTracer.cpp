@@ -0,0 +1,92 @@
+#include <RpT-Utils/LoopTracer.hpp>
+
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+
+namespace RpT::Utils {
+
+
+namespace {
+
+
+/// Chrome trace timestamps and durations are given in microseconds
+std::int64_t toMicroseconds(const LoopTracer::Clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+
+}
+
+
+LoopTracer::LoopTracer(const std::size_t capacity, std::string output_path) :
+output_path_ { std::move(output_path) }, next_span_ { 0 }, ring_filled_ { false }, iteration_ { 0 },
+dump_requested_ { false }, origin_ { Clock::now() } {
+
+    if (capacity == 0)
+        throw std::invalid_argument { "Trace ring capacity must be at least 1" };
+
+    spans_.resize(capacity);
+}
+
+void LoopTracer::beginIteration() {
+    iteration_++;
+}
+
+void LoopTracer::record(const std::string_view name, const Clock::time_point begin) {
+    spans_[next_span_] = { name, begin, Clock::now() - begin, iteration_ };
+
+    if (++next_span_ == spans_.size()) { // Oldest span will be overwritten next
+        next_span_ = 0;
+        ring_filled_ = true;
+    }
+}
+
+std::size_t LoopTracer::size() const {
+    return ring_filled_ ? spans_.size() : next_span_;
+}
+
+void LoopTracer::requestDump() {
+    dump_requested_.store(true, std::memory_order_relaxed);
+}
+
+bool LoopTracer::dumpIfRequested() {
+    if (!dump_requested_.exchange(false, std::memory_order_relaxed))
+        return false;
+
+    return dump();
+}
+
+void LoopTracer::dumpTo(std::ostream& output) const {
+    // Oldest span is the next one to be overwritten if ring has been filled, the first one otherwise
+    const std::size_t oldest_span { ring_filled_ ? next_span_ : 0 };
+    const std::size_t spans_count { size() };
+
+    output << "{\"traceEvents\":[";
+    for (std::size_t i { 0 }; i < spans_count; i++) {
+        const Span& span { spans_[(oldest_span + i) % spans_.size()] };
+
+        if (i != 0)
+            output << ',';
+
+        // Complete events ("X" phase), every span is recorded by main loop thread
+        output << "{\"name\":\"" << span.name << "\",\"cat\":\"executor\",\"ph\":\"X\",\"ts\":"
+               << toMicroseconds(span.begin - origin_) << ",\"dur\":" << toMicroseconds(span.duration)
+               << ",\"pid\":1,\"tid\":1,\"args\":{\"iteration\":" << span.iteration << "}}";
+    }
+    output << "],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+bool LoopTracer::dump() const {
+    std::ofstream trace_file { output_path_, std::ios::trunc };
+    if (!trace_file)
+        return false;
+
+    dumpTo(trace_file);
+
+    return static_cast<bool>(trace_file);
+}
+
+
+}
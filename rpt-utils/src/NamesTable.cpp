@@ -0,0 +1,57 @@
+#include <RpT-Utils/NamesTable.hpp>
+
+#include <cassert>
+
+
+namespace RpT::Utils {
+
+
+std::optional<NamesTable::NameId> NamesTable::insert(const std::string_view name) {
+    if (contains(name))
+        return {};
+
+    NameId new_id;
+    if (free_ids_.empty()) { // Every storage is used, a new one is appended
+        new_id = static_cast<NameId>(names_.size());
+        names_.emplace_back(name);
+    } else { // Erased name storage is reused
+        new_id = free_ids_.back();
+        free_ids_.pop_back();
+
+        names_[new_id].assign(name);
+    }
+
+    // View is taken once name has been stored, as it must refer to table own data
+    const auto insert_result { index_.insert({ names_[new_id], new_id }) };
+    assert(insert_result.second);
+
+    return new_id;
+}
+
+void NamesTable::erase(const NameId id) {
+    const std::size_t erased_count { index_.erase(names_.at(id)) };
+    assert(erased_count == 1); // Erasing same ID twice would make it free twice
+
+    names_[id].clear();
+    free_ids_.push_back(id);
+}
+
+bool NamesTable::contains(const std::string_view name) const {
+    return index_.count(name) == 1;
+}
+
+std::string_view NamesTable::name(const NameId id) const {
+    return names_.at(id);
+}
+
+void NamesTable::reserve(const std::size_t names_count) {
+    index_.reserve(names_count);
+    free_ids_.reserve(names_count);
+}
+
+std::size_t NamesTable::size() const {
+    return index_.size();
+}
+
+
+}
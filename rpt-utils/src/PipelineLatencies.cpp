@@ -0,0 +1,124 @@
+#include <RpT-Utils/PipelineLatencies.hpp>
+
+#include <cassert>
+
+
+namespace RpT::Utils {
+
+
+namespace {
+
+
+/// Quantiles exported for each summary, with percentage they are retrieved from
+struct ExportedQuantile {
+    std::string_view label;
+    double percentage;
+};
+
+constexpr std::array<ExportedQuantile, 4> EXPORTED_QUANTILES {{
+    { "0.5", 50 }, { "0.9", 90 }, { "0.99", 99 }, { "0.999", 99.9 }
+}};
+
+/// Converts given latency into recorded nanoseconds, negative durations being recorded as 0
+std::uint64_t toNanoseconds(const PipelineLatencies::Clock::duration latency) {
+    const auto nanoseconds { std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count() };
+
+    return nanoseconds > 0 ? static_cast<std::uint64_t>(nanoseconds) : 0;
+}
+
+
+}
+
+
+std::string_view PipelineLatencies::stageName(const PipelineStage stage) {
+    switch (stage) {
+    case PipelineStage::Receive:
+        return "receive";
+    case PipelineStage::Parse:
+        return "parse";
+    case PipelineStage::Dispatch:
+        return "dispatch";
+    case PipelineStage::Polling:
+        return "polling";
+    case PipelineStage::Write:
+        return "write";
+    }
+
+    assert(false); // Every stage must be named
+    return {};
+}
+
+void PipelineLatencies::record(const PipelineStage stage, const Clock::duration latency) {
+    GuardedHistogram& stage_latencies { stages_[static_cast<std::size_t>(stage)] };
+    const std::lock_guard stage_lock { stage_latencies.lock };
+
+    stage_latencies.histogram.record(toNanoseconds(latency));
+}
+
+void PipelineLatencies::recordSince(const PipelineStage stage, const Clock::time_point stage_begin) {
+    record(stage, Clock::now() - stage_begin);
+}
+
+void PipelineLatencies::recordService(const std::string_view service_name, const Clock::duration latency) {
+    const std::lock_guard services_lock { services_lock_ };
+
+    auto service_latencies { services_.find(service_name) };
+    if (service_latencies == services_.end()) // First command handled by this service
+        service_latencies = services_.emplace(std::string { service_name }, LatencyHistogram {}).first;
+
+    service_latencies->second.record(toNanoseconds(latency));
+}
+
+LatencyHistogram PipelineLatencies::stage(const PipelineStage stage) const {
+    const GuardedHistogram& stage_latencies { stages_[static_cast<std::size_t>(stage)] };
+    const std::lock_guard stage_lock { stage_latencies.lock };
+
+    return stage_latencies.histogram;
+}
+
+std::optional<LatencyHistogram> PipelineLatencies::service(const std::string_view service_name) const {
+    const std::lock_guard services_lock { services_lock_ };
+
+    const auto service_latencies { services_.find(service_name) };
+    if (service_latencies == services_.end())
+        return {};
+
+    return service_latencies->second;
+}
+
+void PipelineLatencies::exportSummary(std::ostream& output, const std::string_view metric_name,
+                                      const std::string_view label, const LatencyHistogram& histogram) {
+
+    for (const ExportedQuantile& quantile : EXPORTED_QUANTILES) {
+        output << metric_name << '{' << label << ",quantile=\"" << quantile.label << "\"} "
+               << histogram.percentile(quantile.percentage) << '\n';
+    }
+
+    output << metric_name << "_sum{" << label << "} " << histogram.sum() << '\n';
+    output << metric_name << "_count{" << label << "} " << histogram.count() << '\n';
+}
+
+void PipelineLatencies::exportTo(std::ostream& output) const {
+    output << "# TYPE rpt_pipeline_latency_ns summary\n";
+    for (std::size_t stage_i { 0 }; stage_i < STAGES_COUNT; stage_i++) {
+        const PipelineStage exported_stage { static_cast<PipelineStage>(stage_i) };
+        const std::string label { "stage=\"" + std::string { stageName(exported_stage) } + '"' };
+
+        // Copied so lock isn't held while writing into stream
+        exportSummary(output, "rpt_pipeline_latency_ns", label, stage(exported_stage));
+    }
+
+    std::map<std::string, LatencyHistogram, std::less<>> services_copy;
+    {
+        const std::lock_guard services_lock { services_lock_ };
+
+        services_copy = services_;
+    }
+
+    output << "# TYPE rpt_service_latency_ns summary\n";
+    for (const auto& [service_name, service_latencies] : services_copy)
+        exportSummary(output, "rpt_service_latency_ns", "service=\"" + service_name + '"', service_latencies);
+}
+
+
+}
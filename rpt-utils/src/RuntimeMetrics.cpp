@@ -0,0 +1,213 @@
+#include <RpT-Utils/RuntimeMetrics.hpp>
+
+#include <RpT-Utils/AllocationProfiler.hpp>
+
+
+namespace RpT::Utils {
+
+
+namespace {
+
+
+/// Writes type comment followed by an unlabeled sample for given metric
+void exportScalar(std::ostream& output, const std::string_view metric_name, const std::string_view type,
+                  const std::uint64_t value) {
+
+    output << "# TYPE " << metric_name << ' ' << type << '\n';
+    output << metric_name << ' ' << value << '\n';
+}
+
+
+}
+
+
+RuntimeMetrics::RuntimeMetrics() :
+connected_clients_ { 0 }, registered_actors_ { 0 }, actors_limit_ { 0 }, occupied_rooms_ { 0 }, pending_timers_ { 0 },
+input_events_ { 0 },
+received_bytes_ { 0 }, sent_bytes_ { 0 }, tls_handshakes_ { 0 }, loop_saturation_ { 0 }, overloaded_ { false },
+shed_handshakes_ { 0 }, rate_limited_requests_ { 0 }, ready_ { false } {}
+
+void RuntimeMetrics::clientConnected(const std::uint64_t client_token) {
+    connected_clients_.fetch_add(1, std::memory_order_relaxed);
+
+    const std::lock_guard clients_lock { clients_lock_ };
+
+    queue_depths_.insert({ client_token, 0 });
+}
+
+void RuntimeMetrics::clientDisconnected(const std::uint64_t client_token) {
+    connected_clients_.fetch_sub(1, std::memory_order_relaxed);
+
+    const std::lock_guard clients_lock { clients_lock_ };
+
+    queue_depths_.erase(client_token);
+}
+
+void RuntimeMetrics::actorRegistered() {
+    registered_actors_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::actorUnregistered() {
+    registered_actors_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::queueDepth(const std::uint64_t client_token, const std::size_t depth) {
+    const std::lock_guard clients_lock { clients_lock_ };
+
+    // IO threads might still be sending messages to a client removed meanwhile
+    const auto client_depth { queue_depths_.find(client_token) };
+    if (client_depth != queue_depths_.end())
+        client_depth->second = depth;
+}
+
+void RuntimeMetrics::actorsLimit(const std::size_t limit) {
+    actors_limit_.store(limit, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::occupiedRooms(const std::size_t count) {
+    occupied_rooms_.store(count, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::inputEventHandled() {
+    input_events_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::pendingTimers(const std::size_t count) {
+    pending_timers_.store(count, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::bytesReceived(const std::size_t bytes) {
+    received_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::bytesSent(const std::size_t bytes) {
+    sent_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::tlsHandshakeDone() {
+    tls_handshakes_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::loopLoad(const double saturation, const bool overloaded) {
+    loop_saturation_.store(saturation, std::memory_order_relaxed);
+    overloaded_.store(overloaded, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::handshakeShed() {
+    shed_handshakes_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::requestRateLimited() {
+    rate_limited_requests_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::serverReady() {
+    ready_.store(true, std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::serviceRequestHandled(const std::string_view service_name, const ServiceRequestResult result) {
+    const std::lock_guard services_lock { services_lock_ };
+
+    auto service_counts { services_.find(service_name) };
+    if (service_counts == services_.end()) // First command handled by this service
+        service_counts = services_.emplace(std::string { service_name }, ServiceRequestsCount {}).first;
+
+    switch (result) {
+    case ServiceRequestResult::Ok:
+        service_counts->second.ok++;
+        break;
+    case ServiceRequestResult::Ko:
+        service_counts->second.ko++;
+        break;
+    case ServiceRequestResult::Error:
+        service_counts->second.error++;
+        break;
+    }
+}
+
+std::uint64_t RuntimeMetrics::connectedClients() const {
+    return connected_clients_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t RuntimeMetrics::registeredActors() const {
+    return registered_actors_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t RuntimeMetrics::inputEvents() const {
+    return input_events_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t RuntimeMetrics::actorsLimit() const {
+    return actors_limit_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t RuntimeMetrics::occupiedRooms() const {
+    return occupied_rooms_.load(std::memory_order_relaxed);
+}
+
+double RuntimeMetrics::loopSaturation() const {
+    return loop_saturation_.load(std::memory_order_relaxed);
+}
+
+bool RuntimeMetrics::overloaded() const {
+    return overloaded_.load(std::memory_order_relaxed);
+}
+
+bool RuntimeMetrics::ready() const {
+    return ready_.load(std::memory_order_relaxed);
+}
+
+void RuntimeMetrics::exportTo(std::ostream& output) const {
+    exportScalar(output, "rpt_connected_clients", "gauge", connected_clients_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_registered_actors", "gauge", registered_actors_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_actors_limit", "gauge", actors_limit_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_occupied_rooms", "gauge", occupied_rooms_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_pending_timers", "gauge", pending_timers_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_input_events_total", "counter", input_events_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_received_bytes_total", "counter", received_bytes_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_sent_bytes_total", "counter", sent_bytes_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_tls_handshakes_total", "counter", tls_handshakes_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_overloaded", "gauge", overloaded_.load(std::memory_order_relaxed) ? 1 : 0);
+    exportScalar(output, "rpt_shed_handshakes_total", "counter", shed_handshakes_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_rate_limited_requests_total", "counter",
+                 rate_limited_requests_.load(std::memory_order_relaxed));
+    exportScalar(output, "rpt_ready", "gauge", ready_.load(std::memory_order_relaxed) ? 1 : 0);
+
+    // Only non integer sample
+    output << "# TYPE rpt_loop_saturation gauge\n";
+    output << "rpt_loop_saturation " << loop_saturation_.load(std::memory_order_relaxed) << '\n';
+
+    // Copied so locks aren't held while writing into stream
+
+    std::map<std::uint64_t, std::size_t> queue_depths_copy;
+    {
+        const std::lock_guard clients_lock { clients_lock_ };
+
+        queue_depths_copy = queue_depths_;
+    }
+
+    output << "# TYPE rpt_client_queue_depth gauge\n";
+    for (const auto [client_token, depth] : queue_depths_copy)
+        output << "rpt_client_queue_depth{client=\"" << client_token << "\"} " << depth << '\n';
+
+    std::map<std::string, ServiceRequestsCount, std::less<>> services_copy;
+    {
+        const std::lock_guard services_lock { services_lock_ };
+
+        services_copy = services_;
+    }
+
+    output << "# TYPE rpt_service_requests_total counter\n";
+    for (const auto& [service_name, counts] : services_copy) {
+        output << "rpt_service_requests_total{service=\"" << service_name << "\",result=\"ok\"} " << counts.ok << '\n';
+        output << "rpt_service_requests_total{service=\"" << service_name << "\",result=\"ko\"} " << counts.ko << '\n';
+        output << "rpt_service_requests_total{service=\"" << service_name << "\",result=\"error\"} " << counts.error
+               << '\n';
+    }
+
+    if constexpr (AllocationProfiler::ENABLED) // Reported only by instrumentation builds
+        AllocationProfiler::exportTo(output);
+}
+
+
+}
@@ -0,0 +1,168 @@
+#include <RpT-Utils/SlowRequestSampler.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace RpT::Utils {
+
+
+namespace {
+
+
+/// Stage exported for each exemplar, with duration it took
+struct ExportedStage {
+    std::string_view label;
+    SampledRequest::Clock::duration duration;
+};
+
+/// Converts given duration into exported nanoseconds, negative durations being exported as 0
+std::int64_t exportedNanoseconds(const SampledRequest::Clock::duration duration) {
+    return std::max<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), 0);
+}
+
+
+}
+
+
+void SampledRequest::serviceName(const std::string_view service_name) {
+    serviceLength = std::min(service_name.size(), SERVICE_NAME_CAPACITY);
+
+    std::copy_n(service_name.begin(), serviceLength, service.begin());
+}
+
+std::string_view SampledRequest::serviceName() const {
+    return { service.data(), serviceLength };
+}
+
+SampledRequest::Clock::duration SampledRequest::endToEnd() const {
+    return syncedAt - receivedAt;
+}
+
+
+SlowRequestSampler::SlowRequestSampler(const Clock::duration threshold, const std::size_t ring_capacity,
+                                       const std::size_t exemplars_capacity)
+: threshold_ { threshold }, ring_ { ring_capacity }, next_slot_ { 0 }, has_unreported_ { false },
+exemplars_capacity_ { exemplars_capacity }, next_exemplar_ { 0 }, slow_count_ { 0 } {
+
+    if (threshold <= Clock::duration::zero())
+        throw std::invalid_argument { "Slow requests threshold must be positive" };
+
+    if (ring_capacity == 0 || exemplars_capacity == 0)
+        throw std::invalid_argument { "Ring and exemplars capacities must be positive" };
+
+    exemplars_.reserve(exemplars_capacity);
+}
+
+SlowRequestSampler::Clock::duration SlowRequestSampler::threshold() const {
+    return threshold_;
+}
+
+std::size_t SlowRequestSampler::ringCapacity() const {
+    return ring_.size();
+}
+
+SampledRequest& SlowRequestSampler::begin() {
+    // Only slot index is shared between threads, relaxed order is enough
+    SampledRequest& slot { ring_[next_slot_.fetch_add(1, std::memory_order_relaxed) % ring_.size()] };
+    slot = {};
+
+    return slot;
+}
+
+bool SlowRequestSampler::finish(const SampledRequest& request) {
+    if (request.endToEnd() <= threshold_) // Fast path, nothing but ring was written for this request
+        return false;
+
+    const std::lock_guard slow_lock { slow_lock_ };
+
+    if (exemplars_.size() < exemplars_capacity_) // Oldest exemplar is replaced once every slot is used
+        exemplars_.push_back(request);
+    else
+        exemplars_[next_exemplar_] = request;
+
+    next_exemplar_ = (next_exemplar_ + 1) % exemplars_capacity_;
+    unreported_.push_back(request);
+    slow_count_++;
+
+    has_unreported_.store(true, std::memory_order_release);
+
+    return true;
+}
+
+std::size_t SlowRequestSampler::takeUnreported(std::vector<SampledRequest>& slow_requests) {
+    if (!has_unreported_.load(std::memory_order_acquire))
+        return 0;
+
+    const std::lock_guard slow_lock { slow_lock_ };
+
+    const std::size_t unreported_count { unreported_.size() };
+    slow_requests.insert(slow_requests.end(), unreported_.cbegin(), unreported_.cend());
+
+    unreported_.clear();
+    has_unreported_.store(false, std::memory_order_relaxed);
+
+    return unreported_count;
+}
+
+std::uint64_t SlowRequestSampler::slowCount() const {
+    const std::lock_guard slow_lock { slow_lock_ };
+
+    return slow_count_;
+}
+
+std::vector<SampledRequest> SlowRequestSampler::exemplars() const {
+    const std::lock_guard slow_lock { slow_lock_ };
+
+    if (exemplars_.size() < exemplars_capacity_) // No exemplar replaced yet, already ordered
+        return exemplars_;
+
+    // Once every slot is used, next replaced exemplar is the oldest one
+    std::vector<SampledRequest> ordered_exemplars { exemplars_.cbegin() + next_exemplar_, exemplars_.cend() };
+    ordered_exemplars.insert(ordered_exemplars.end(), exemplars_.cbegin(), exemplars_.cbegin() + next_exemplar_);
+
+    return ordered_exemplars;
+}
+
+void SlowRequestSampler::exportTo(std::ostream& output) const {
+    const std::vector<SampledRequest> exported_exemplars { exemplars() }; // Lock isn't held while writing
+
+    output << "# TYPE rpt_slow_requests_total counter\n";
+    output << "rpt_slow_requests_total " << slowCount() << '\n';
+
+    output << "# TYPE rpt_slow_request_ns gauge\n";
+    for (std::size_t i { 0 }; i < exported_exemplars.size(); i++) {
+        const SampledRequest& exemplar { exported_exemplars[i] };
+        const std::array<ExportedStage, 6> stages {{
+            { "total", exemplar.endToEnd() },
+            { "queued", exemplar.handledAt - exemplar.receivedAt },
+            { "scheduled", exemplar.dispatchedAt - exemplar.handledAt },
+            { "dispatch", exemplar.repliedAt - exemplar.dispatchedAt },
+            { "service", exemplar.serviceHandling },
+            { "sync", exemplar.syncedAt - exemplar.repliedAt }
+        }};
+
+        for (const ExportedStage& stage : stages) {
+            output << "rpt_slow_request_ns{exemplar=\"" << i << "\",actor=\"" << exemplar.actor << "\",service=\""
+                   << exemplar.serviceName() << "\",stage=\"" << stage.label << "\"} "
+                   << exportedNanoseconds(stage.duration) << '\n';
+        }
+    }
+
+    output << "# TYPE rpt_slow_request_bytes gauge\n";
+    for (std::size_t i { 0 }; i < exported_exemplars.size(); i++) {
+        output << "rpt_slow_request_bytes{exemplar=\"" << i << "\",direction=\"request\"} "
+               << exported_exemplars[i].requestBytes << '\n';
+        output << "rpt_slow_request_bytes{exemplar=\"" << i << "\",direction=\"response\"} "
+               << exported_exemplars[i].responseBytes << '\n';
+    }
+
+    output << "# TYPE rpt_slow_request_pending_inputs gauge\n";
+    for (std::size_t i { 0 }; i < exported_exemplars.size(); i++) {
+        output << "rpt_slow_request_pending_inputs{exemplar=\"" << i << "\"} " << exported_exemplars[i].pendingInputs
+               << '\n';
+    }
+}
+
+
+}
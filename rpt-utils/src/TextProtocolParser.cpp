@@ -2,75 +2,201 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 
 namespace RpT::Utils {
 
 
-TextProtocolParser::TextProtocolParser(const std::string_view protocol_command,
-                                       const unsigned int expected_words) {
+namespace {
+
+
+/// Chars separating words
+constexpr char SEPARATOR { ' ' };
 
-    // Iterators to non-trimmed begin and end of command string
-    const auto cmd_begin { protocol_command.cbegin() };
-    const auto cmd_end { protocol_command.cend() };
+#if defined(__AVX2__)
 
-    std::ptrdiff_t word_begin_i { 0 }; // Currently parsed word begin index
-    std::size_t word_length { 0 }; // Currently parsed word length
+/// Number of chars compared at once
+constexpr std::ptrdiff_t SCAN_WIDTH { 32 };
 
-    auto char_it { cmd_begin }; // Parsing begins at command begin
+/// Bit `i` is set if char `i` of given block is a separator
+std::uint32_t separatorsMask(const char* const block) {
+    const __m256i chars { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)) };
 
-    // Iterates over all chars until command string end, or until expected parsed words count has been reached
-    while (char_it != cmd_end && parsed_words_.size() < expected_words) {
-        const char current_char { *char_it };
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8(SEPARATOR))));
+}
 
-        if (current_char == ' ') { // When separator is met
-            if (word_length != 0) { // If word is currently parsed, push it into parsed words
-                const std::string_view current_parsed_word { protocol_command.substr(word_begin_i, word_length) };
+/// Index of first set bit for a non-null separators mask
+unsigned int firstMaskedChar(const std::uint32_t mask) {
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+}
 
-                parsed_words_.push_back(current_parsed_word);
+/// Mask with a bit set for each char of a block
+constexpr std::uint32_t FULL_MASK { 0xffffffff };
 
-                word_length = 0; // No word is currently into parsing stage
-            }
-        } else { // If iterator is inside any word
-            if (word_length == 0) // If new word enters into parsing stage, new word begin position must be saved
-                word_begin_i = char_it - cmd_begin;
+#elif defined(__SSE2__) || defined(_M_X64)
 
-            word_length++; // Parsing stage word is one char longer after this iteration
-        }
+constexpr std::ptrdiff_t SCAN_WIDTH { 16 };
 
-        char_it++; // Parsing goes forward to next char
-    }
+std::uint32_t separatorsMask(const char* const block) {
+    const __m128i chars { _mm_loadu_si128(reinterpret_cast<const __m128i*>(block)) };
+
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8(SEPARATOR))));
+}
+
+unsigned int firstMaskedChar(const std::uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long first_bit;
+    _BitScanForward(&first_bit, mask);
+
+    return static_cast<unsigned int>(first_bit);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+}
+
+constexpr std::uint32_t FULL_MASK { 0xffff };
 
-    // Checks for word in parsing stage when end of string was met
-    if (word_length != 0) { // If there is one, push it into parsed words
-        const std::string_view current_parsed_word { protocol_command.substr(word_begin_i, word_length) };
+#elif defined(__ARM_NEON)
 
-        parsed_words_.push_back(current_parsed_word);
+constexpr std::ptrdiff_t SCAN_WIDTH { 16 };
+
+/// NEON doesn't have any movemask, so each char comparison result is narrowed to 4 bits of a 64 bits mask
+std::uint64_t separatorsMask(const char* const block) {
+    const uint8x16_t chars { vld1q_u8(reinterpret_cast<const std::uint8_t*>(block)) };
+    const uint8x16_t comparison { vceqq_u8(chars, vdupq_n_u8(static_cast<std::uint8_t>(SEPARATOR))) };
+    const uint8x8_t narrowed { vshrn_n_u16(vreinterpretq_u16_u8(comparison), 4) };
+
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+unsigned int firstMaskedChar(const std::uint64_t mask) {
+    return static_cast<unsigned int>(__builtin_ctzll(mask)) / 4; // 4 bits for each char
+}
+
+constexpr std::uint64_t FULL_MASK { 0xffffffffffffffff };
+
+#else
+#define RPT_SCALAR_WORDS_SCAN
+#endif
+
+/**
+ * @brief Retrieves first char inside given range which is (or which isn't, if `Separator` is `false`) a separator
+ *
+ * @returns Pointer to found char, or range end if there isn't any
+ */
+template<bool Separator>
+const char* findFirst(const char* position, const char* const end) {
+#ifndef RPT_SCALAR_WORDS_SCAN
+    // Whole blocks are scanned at once, never reading past range end
+    while (end - position >= SCAN_WIDTH) {
+        auto mask { separatorsMask(position) };
+        if constexpr (!Separator) // Looking for non-separator chars
+            mask = ~mask & FULL_MASK;
+
+        if (mask != 0)
+            return position + firstMaskedChar(mask);
+
+        position += SCAN_WIDTH;
     }
+#endif
+
+    // Remaining chars which cannot fill a block
+    while (position != end && (*position == SEPARATOR) != Separator)
+        position++;
+
+    return position;
+}
+
+/// Retrieves first separator inside given range, or range end if there isn't any
+const char* findSeparator(const char* const begin, const char* const end) {
+    return findFirst<true>(begin, end);
+}
+
+/// Retrieves first non-separator char inside given range, or range end if there isn't any
+const char* skipSeparators(const char* const begin, const char* const end) {
+    return findFirst<false>(begin, end);
+}
+
+
+}
+
+
+TextProtocolParser::TextProtocolParser(const std::string_view protocol_command, const unsigned int expected_words)
+: TextProtocolParser { protocol_command, expected_words, std::nothrow } {
 
     // Checks for expected minimum words count
-    if (parsed_words_.size() < expected_words)
-        throw NotEnoughWords { static_cast<unsigned int>(parsed_words_.size()), expected_words };
+    if (!has_expected_words_)
+        throw NotEnoughWords { static_cast<unsigned int>(parsed_words_count_), expected_words };
+}
+
+TextProtocolParser::TextProtocolParser(const std::string_view protocol_command, const unsigned int expected_words,
+                                       std::nothrow_t) : inline_parsed_words_ {}, parsed_words_count_ { 0 } {
+
+    parseWords(protocol_command, expected_words, false);
+}
 
-    // Trims after last parsed word
-    while (char_it != cmd_end && *char_it == ' ')
-        char_it++;
+TextProtocolParser::TextProtocolParser(const TextProtocolParser& previous_layer, const unsigned int expected_words,
+                                       std::nothrow_t) : inline_parsed_words_ {}, parsed_words_count_ { 0 } {
 
-    const std::ptrdiff_t unparsed_words_begin_i { char_it - cmd_begin }; // Index for unparsed substring begin
-    unparsed_words_ = protocol_command.substr(unparsed_words_begin_i); // Push unparsed words into instance
+    // Previous layer already trimmed separators before its unparsed words
+    parseWords(previous_layer.unparsedWords(), expected_words, true);
 }
 
-std::string_view TextProtocolParser::getParsedWord(std::size_t i) const {
-    try { // Tries to retrieve word for given index...
-        return parsed_words_.at(i);
-    } catch (const std::out_of_range&) { // ...and if index is out of range, throw custom exception class
-        throw ParsedIndexOutOfRange { i, parsed_words_.size() };
+void TextProtocolParser::parseWords(const std::string_view protocol_command, const unsigned int expected_words,
+                                    const bool leading_separators_trimmed) {
+
+    const char* const cmd_end { protocol_command.data() + protocol_command.size() };
+    const char* position { protocol_command.data() }; // Parsing begins at command begin
+
+    if (!leading_separators_trimmed)
+        position = skipSeparators(position, cmd_end);
+
+    // Parses words until command string end, or until expected parsed words count has been reached. Position is
+    // always at a word begin (or at command end), so each char is scanned once.
+    while (parsed_words_count_ < expected_words && position != cmd_end) {
+        const char* const word_end { findSeparator(position, cmd_end) };
+        pushParsedWord({ position, static_cast<std::size_t>(word_end - position) });
+
+        position = skipSeparators(word_end, cmd_end); // Trims after parsed word
     }
+
+    // Checks for expected minimum words count, reported by caller
+    has_expected_words_ = parsed_words_count_ >= expected_words;
+
+    // Pushes unparsed words into instance, already trimmed after last parsed word
+    unparsed_words_ = { position, static_cast<std::size_t>(cmd_end - position) };
+}
+
+void TextProtocolParser::pushParsedWord(const std::string_view word) {
+    if (parsed_words_count_ < INLINE_WORDS_CAPACITY)
+        inline_parsed_words_[parsed_words_count_] = word;
+    else
+        extra_parsed_words_.push_back(word);
+
+    parsed_words_count_++;
+}
+
+std::string_view TextProtocolParser::getParsedWord(const std::size_t i) const {
+    if (i >= parsed_words_count_) // Checks for index to be in range
+        throw ParsedIndexOutOfRange { i, parsed_words_count_ };
+
+    return i < INLINE_WORDS_CAPACITY ? inline_parsed_words_[i] : extra_parsed_words_[i - INLINE_WORDS_CAPACITY];
 }
 
 std::string_view TextProtocolParser::unparsedWords() const {
     return unparsed_words_;
 }
 
+bool TextProtocolParser::hasExpectedWords() const {
+    return has_expected_words_;
+}
+
 
 }
@@ -0,0 +1,73 @@
+#include <RpT-Utils/ThreadAffinity.hpp>
+
+#include <system_error>
+#include <RpT-Config/Config.hpp>
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+#include <pthread.h>
+#include <sched.h>
+#else
+#include <windows.h>
+#endif
+
+
+namespace RpT::Utils {
+
+
+// Facility functions, anonymous namespace to avoid name clashes
+namespace {
+
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+/// Thread handle pinning is done with
+using NativeThread = pthread_t;
+#else
+/// Thread handle pinning is done with
+using NativeThread = HANDLE;
+#endif
+
+
+/// Sets given thread affinity to given core only
+void pinNativeThread(const NativeThread thread, const std::size_t cpu) {
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    if (cpu >= CPU_SETSIZE) // CPU set cannot even represent given core
+        throw std::system_error { std::make_error_code(std::errc::invalid_argument), "CPU core out of range" };
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+
+    // Fails with EINVAL if given core isn't available for this process
+    const int error_code { pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set) };
+    if (error_code != 0)
+        throw std::system_error { error_code, std::generic_category(), "Unable to pin thread to CPU core" };
+#else
+    if (cpu >= sizeof(DWORD_PTR) * 8) // Affinity mask cannot even represent given core
+        throw std::system_error { std::make_error_code(std::errc::invalid_argument), "CPU core out of range" };
+
+    if (SetThreadAffinityMask(thread, DWORD_PTR { 1 } << cpu) == 0) {
+        throw std::system_error {
+            static_cast<int>(GetLastError()), std::system_category(), "Unable to pin thread to CPU core"
+        };
+    }
+#endif
+}
+
+
+}
+
+
+void pinCurrentThread(const std::size_t cpu) {
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    pinNativeThread(pthread_self(), cpu);
+#else
+    pinNativeThread(GetCurrentThread(), cpu);
+#endif
+}
+
+void pinThread(std::thread& thread, const std::size_t cpu) {
+    pinNativeThread(thread.native_handle(), cpu);
+}
+
+
+}